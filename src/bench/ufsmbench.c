@@ -0,0 +1,664 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* Runtime benchmark. Builds synthetic charts of a few shapes, processes a
+ * repeating event sequence on each and prints one CSV line per chart with
+ * the throughput, the per event latency percentiles and the memory used
+ * by a machine. Given the output of an earlier run with -b, the change
+ * against it is printed to stderr. With -t the cost of recording every
+ * step to a trace ring is printed to stderr as well.
+ *
+ * Built with UFSMBENCH_XMI set to its number of states, a chart made by
+ * ufsmgen and imported with ufsmimport is run as well, see 'make xmi'.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ufsm.h>
+
+#define BENCH_DEFAULT_EVENTS 200000
+#define BENCH_WARMUP_EVENTS 10000
+#define BENCH_MAX_SEQUENCE 64
+#define BENCH_LINE_SIZE 256
+#define BENCH_TRACE_RECORDS 1024
+#define BENCH_TRACE_CHUNK 10000
+
+#define BENCH_HEADER "chart,param,events,events_per_s,ns_p50,ns_p90," \
+                     "ns_p99,ns_max,machine_bytes,definition_bytes," \
+                     "instance_bytes"
+
+enum bench_events
+{
+    EV_IN,
+    EV_OUT,
+    EV_TOGGLE,
+    EV_GO,
+    EV_BACK,
+    EV_DATA,
+    EV_NEXT,
+};
+
+struct bench
+{
+    struct ufsm_machine *m;
+    uint32_t sequence[BENCH_MAX_SEQUENCE];
+    uint32_t no_of_sequence;
+    size_t definition_bytes;
+    void **objects;
+    uint32_t no_of_objects;
+};
+
+struct bench_result
+{
+    uint64_t events;
+    double events_per_s;
+    uint64_t ns_p50;
+    uint64_t ns_p90;
+    uint64_t ns_p99;
+    uint64_t ns_max;
+    size_t instance_bytes;
+};
+
+struct bench_chart
+{
+    const char *name;
+    uint32_t param;
+    void (*build)(struct bench *b, struct ufsm_region *root, uint32_t param);
+};
+
+#ifdef UFSMBENCH_XMI
+struct ufsm_machine * ufsmgen_machine(void);
+#endif
+
+static struct ufsm_trace trace;
+static struct ufsm_trace_record trace_records[BENCH_TRACE_RECORDS];
+static bool traced = false;
+
+static bool never_f(void)
+{
+    return false;
+}
+
+static struct ufsm_guard never_guard =
+{
+    .name = "never",
+    .f = &never_f,
+    .next = NULL,
+};
+
+static void * bench_new(struct bench *b, size_t size)
+{
+    void *p = calloc(1, size);
+
+    if (p == NULL) {
+        printf ("Error: Out of memory\n");
+        exit(1);
+    }
+
+    b->objects = realloc(b->objects, sizeof(void *) * (b->no_of_objects + 1));
+    b->objects[b->no_of_objects++] = p;
+    b->definition_bytes += size;
+
+    return p;
+}
+
+static void bench_free(struct bench *b)
+{
+    for (uint32_t n = 0; n < b->no_of_objects; n++)
+        free(b->objects[n]);
+
+    free(b->objects);
+    if (b->m)
+        free(b->m->storage);
+    free(b->m);
+    memset(b, 0, sizeof(*b));
+}
+
+static struct ufsm_region * new_region(struct bench *b,
+                                       struct ufsm_state *parent)
+{
+    struct ufsm_region *r = bench_new(b, sizeof(struct ufsm_region));
+
+    r->name = "region";
+    r->parent_state = parent;
+
+    if (parent) {
+        r->next = parent->region;
+        parent->region = r;
+    }
+
+    return r;
+}
+
+static struct ufsm_state * new_state(struct bench *b,
+                                     struct ufsm_region *r,
+                                     enum ufsm_state_kind kind)
+{
+    struct ufsm_state *s = bench_new(b, sizeof(struct ufsm_state));
+    struct ufsm_state **last = &r->state;
+
+    s->name = "state";
+    s->kind = kind;
+    s->parent_region = r;
+
+    while (*last)
+        last = &(*last)->next;
+
+    *last = s;
+
+    return s;
+}
+
+/* Adds a transition to the region of 'source', triggered by 'ev' or, when
+ * 'ev' is UFSM_NO_TRIGGER, taken without a trigger.
+ */
+static struct ufsm_transition * new_transition(struct bench *b,
+                                               struct ufsm_state *source,
+                                               struct ufsm_state *dest,
+                                               int32_t ev)
+{
+    struct ufsm_transition *t = bench_new(b, sizeof(struct ufsm_transition));
+    struct ufsm_transition **last = &source->parent_region->transition;
+
+    t->name = "transition";
+    t->kind = UFSM_TRANSITION_EXTERNAL;
+    t->source = source;
+    t->dest = dest;
+
+    if (ev != UFSM_NO_TRIGGER) {
+        t->trigger = bench_new(b, sizeof(struct ufsm_trigger));
+        t->trigger->name = "trigger";
+        t->trigger->trigger = (uint32_t) ev;
+    }
+
+    while (*last)
+        last = &(*last)->next;
+
+    *last = t;
+
+    return t;
+}
+
+static void new_init(struct bench *b, struct ufsm_region *r,
+                     struct ufsm_state *dest)
+{
+    new_transition(b, new_state(b, r, UFSM_STATE_INIT), dest,
+                                                    UFSM_NO_TRIGGER);
+}
+
+static void bench_sequence(struct bench *b, uint32_t ev)
+{
+    if (b->no_of_sequence < BENCH_MAX_SEQUENCE)
+        b->sequence[b->no_of_sequence++] = ev;
+}
+
+/* A leaf 'param' levels down is entered from, and left for, a state at
+ * the top, so every event exits and enters the whole nesting.
+ */
+static void build_deep(struct bench *b, struct ufsm_region *root,
+                       uint32_t param)
+{
+    struct ufsm_state *top = new_state(b, root, UFSM_STATE_SIMPLE);
+    struct ufsm_region *r = root;
+    struct ufsm_state *leaf = NULL;
+
+    new_init(b, root, top);
+
+    for (uint32_t n = 1; n < param; n++) {
+        struct ufsm_state *s = new_state(b, r, UFSM_STATE_SIMPLE);
+
+        r = new_region(b, s);
+    }
+
+    leaf = new_state(b, r, UFSM_STATE_SIMPLE);
+
+    for (struct ufsm_region *ri = r; ri != root;
+                            ri = ri->parent_state->parent_region) {
+        struct ufsm_state *first = ri->state;
+
+        new_init(b, ri, first);
+    }
+
+    new_transition(b, top, leaf, EV_IN);
+    new_transition(b, leaf, top, EV_OUT);
+
+    bench_sequence(b, EV_IN);
+    bench_sequence(b, EV_OUT);
+}
+
+/* 'param' orthogonal regions that all toggle between two states on the
+ * same event
+ */
+static void build_wide(struct bench *b, struct ufsm_region *root,
+                       uint32_t param)
+{
+    struct ufsm_state *parent = new_state(b, root, UFSM_STATE_SIMPLE);
+
+    new_init(b, root, parent);
+
+    for (uint32_t n = 0; n < param; n++) {
+        struct ufsm_region *r = new_region(b, parent);
+        struct ufsm_state *s1 = new_state(b, r, UFSM_STATE_SIMPLE);
+        struct ufsm_state *s2 = new_state(b, r, UFSM_STATE_SIMPLE);
+
+        new_init(b, r, s1);
+        new_transition(b, s1, s2, EV_TOGGLE);
+        new_transition(b, s2, s1, EV_TOGGLE);
+    }
+
+    bench_sequence(b, EV_TOGGLE);
+}
+
+/* Two states with 'param' transitions between them, one per event id.
+ * Ids from UFSM_TRIGGER_MASK_BITS and up are matched on the trigger list.
+ */
+static void build_transitions(struct bench *b, struct ufsm_region *root,
+                              uint32_t param)
+{
+    struct ufsm_state *s1 = new_state(b, root, UFSM_STATE_SIMPLE);
+    struct ufsm_state *s2 = new_state(b, root, UFSM_STATE_SIMPLE);
+
+    new_init(b, root, s1);
+
+    for (uint32_t n = 0; n < param; n++) {
+        new_transition(b, s1, s2, (int32_t) n);
+        new_transition(b, s2, s1, (int32_t) n);
+    }
+
+    for (uint32_t n = 0; n < param; n += (param + 15) / 16)
+        bench_sequence(b, n);
+
+    bench_sequence(b, param - 1);
+}
+
+/* A chain of 'param' choices whose guarded branch is never taken */
+static void build_choice(struct bench *b, struct ufsm_region *root,
+                         uint32_t param)
+{
+    struct ufsm_state *s1 = new_state(b, root, UFSM_STATE_SIMPLE);
+    struct ufsm_state *s2 = new_state(b, root, UFSM_STATE_SIMPLE);
+    struct ufsm_state *prev = s1;
+    int32_t ev = EV_GO;
+
+    new_init(b, root, s1);
+
+    for (uint32_t n = 0; n < param; n++) {
+        struct ufsm_state *c = new_state(b, root, UFSM_STATE_CHOICE);
+
+        new_transition(b, prev, c, ev);
+
+        if (prev != s1)
+            new_transition(b, prev, s1, UFSM_NO_TRIGGER)->guard =
+                                                            &never_guard;
+
+        prev = c;
+        ev = UFSM_NO_TRIGGER;
+    }
+
+    new_transition(b, prev, s1, UFSM_NO_TRIGGER)->guard = &never_guard;
+    new_transition(b, prev, s2, UFSM_NO_TRIGGER);
+    new_transition(b, s2, s1, EV_BACK);
+
+    bench_sequence(b, EV_GO);
+    bench_sequence(b, EV_BACK);
+}
+
+/* A chain of 'param' junctions */
+static void build_junction(struct bench *b, struct ufsm_region *root,
+                           uint32_t param)
+{
+    struct ufsm_state *s1 = new_state(b, root, UFSM_STATE_SIMPLE);
+    struct ufsm_state *s2 = new_state(b, root, UFSM_STATE_SIMPLE);
+    struct ufsm_state *prev = s1;
+    int32_t ev = EV_GO;
+
+    new_init(b, root, s1);
+
+    for (uint32_t n = 0; n < param; n++) {
+        struct ufsm_state *j = new_state(b, root, UFSM_STATE_JUNCTION);
+
+        new_transition(b, prev, j, ev);
+        prev = j;
+        ev = UFSM_NO_TRIGGER;
+    }
+
+    new_transition(b, prev, s2, UFSM_NO_TRIGGER);
+    new_transition(b, s2, s1, EV_BACK);
+
+    bench_sequence(b, EV_GO);
+    bench_sequence(b, EV_BACK);
+}
+
+/* 'param' events are deferred and then handled when the state changes */
+static void build_defer(struct bench *b, struct ufsm_region *root,
+                        uint32_t param)
+{
+    struct ufsm_state *s1 = new_state(b, root, UFSM_STATE_SIMPLE);
+    struct ufsm_state *s2 = new_state(b, root, UFSM_STATE_SIMPLE);
+    struct ufsm_transition *t = NULL;
+
+    new_init(b, root, s1);
+
+    t = new_transition(b, s1, s1, EV_DATA);
+    t->kind = UFSM_TRANSITION_INTERNAL;
+    t->defer = true;
+
+    new_transition(b, s1, s2, EV_NEXT);
+    new_transition(b, s2, s2, EV_DATA)->kind = UFSM_TRANSITION_INTERNAL;
+    new_transition(b, s2, s1, EV_BACK);
+
+    for (uint32_t n = 0; n < param; n++)
+        bench_sequence(b, EV_DATA);
+
+    bench_sequence(b, EV_NEXT);
+    bench_sequence(b, EV_BACK);
+}
+
+static const struct bench_chart charts[] =
+{
+    {"deep", 4, &build_deep},
+    {"deep", 16, &build_deep},
+    {"wide", 4, &build_wide},
+    {"wide", 16, &build_wide},
+    {"transitions", 8, &build_transitions},
+    {"transitions", 128, &build_transitions},
+    {"choice", 4, &build_choice},
+    {"choice", 16, &build_choice},
+    {"junction", 4, &build_junction},
+    {"junction", 16, &build_junction},
+    {"defer", 4, &build_defer},
+    {"defer", 15, &build_defer},
+#ifdef UFSMBENCH_XMI
+    {"xmi", UFSMBENCH_XMI, NULL},
+#endif
+};
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a;
+    uint64_t y = *(const uint64_t *) b;
+
+    return (x > y) - (x < y);
+}
+
+/* Processes one event and everything it put back on the queue. The time
+ * of each ufsm_process() call is stored in 'samples', if given. A deferred
+ * event is reported as not processed, which isn't an error here.
+ */
+static uint32_t bench_step(struct ufsm_machine *m, uint32_t ev,
+                           uint64_t *samples, uint32_t *count)
+{
+    uint32_t err = UFSM_OK;
+
+    do {
+        uint64_t start = samples ? ufsm_run_time() : 0;
+
+        err = ufsm_process(m, ev);
+
+        if (samples)
+            samples[*count] = ufsm_run_time() - start;
+
+        (*count)++;
+
+        if (err == UFSM_ERROR_EVENT_NOT_PROCESSED)
+            err = UFSM_OK;
+
+        if (err != UFSM_OK)
+            return err;
+    } while (ufsm_queue_get(&m->queue, &ev) == UFSM_OK);
+
+    return err;
+}
+
+/* Runs the sequence until 'no_of_events' calls have been made, a step is
+ * never cut short.
+ */
+static uint32_t bench_run(struct bench *b, uint32_t no_of_events,
+                          uint64_t *samples, uint32_t *count)
+{
+    uint32_t err = UFSM_OK;
+    uint32_t pos = 0;
+
+    *count = 0;
+
+    while (*count < no_of_events && err == UFSM_OK) {
+        err = bench_step(b->m, b->sequence[pos], samples, count);
+        pos = (pos + 1) % b->no_of_sequence;
+    }
+
+    return err;
+}
+
+/* Alternates chunks of events without and with a trace ring on the same
+ * machine and prints how much slower the fastest traced chunk was than the
+ * fastest untraced one. Whole runs differ by more than the cost of a few
+ * percent that is measured here.
+ */
+static uint32_t bench_trace_cost(struct bench *b,
+                                 const struct bench_chart *c,
+                                 uint32_t no_of_events)
+{
+    uint64_t best[2] = {UINT64_MAX, UINT64_MAX};
+    uint32_t rounds = no_of_events / BENCH_TRACE_CHUNK;
+    uint32_t count = 0;
+    uint32_t err = UFSM_OK;
+
+    for (uint32_t r = 0; r < (rounds ? rounds : 1) && err == UFSM_OK; r++) {
+        for (uint32_t on = 0; on < 2 && err == UFSM_OK; on++) {
+            uint64_t start = 0;
+            uint64_t elapsed = 0;
+
+            ufsm_trace_machine(b->m, on ? &trace : NULL);
+
+            start = ufsm_run_time();
+            err = bench_run(b, BENCH_TRACE_CHUNK, NULL, &count);
+            elapsed = ufsm_run_time() - start;
+
+            if (elapsed < best[on])
+                best[on] = elapsed;
+        }
+    }
+
+    ufsm_trace_machine(b->m, NULL);
+
+    if (err == UFSM_OK)
+        fprintf (stderr, "%-12s %5u  trace %+6.1f%%\n", c->name, c->param,
+                    best[0] ? ((double) best[1] / best[0] - 1) * 100.0 : 0.0);
+
+    return err;
+}
+
+static uint32_t bench_chart(const struct bench_chart *c,
+                            uint32_t no_of_events,
+                            struct bench_result *result)
+{
+    struct bench b = {0};
+    struct ufsm_region *root = NULL;
+    uint64_t *samples = calloc(no_of_events + BENCH_MAX_SEQUENCE * 2,
+                               sizeof(uint64_t));
+    uint64_t start = 0;
+    uint64_t elapsed = 0;
+    uint32_t count = 0;
+    uint32_t err = UFSM_OK;
+
+    b.m = calloc(1, sizeof(struct ufsm_machine));
+
+    if (!samples || !b.m) {
+        printf ("Error: Out of memory\n");
+        exit(1);
+    }
+
+    if (c->build) {
+        root = new_region(&b, NULL);
+        c->build(&b, root, c->param);
+
+        b.m->name = c->name;
+        b.m->region = root;
+        b.m->storage = calloc(1, sizeof(struct ufsm_storage));
+
+        if (!b.m->storage) {
+            printf ("Error: Out of memory\n");
+            exit(1);
+        }
+    } else {
+#ifdef UFSMBENCH_XMI
+        /* The generated definition is static, every event in turn */
+        *b.m = *ufsmgen_machine();
+
+        for (uint32_t ev = 0; ev < b.m->no_of_events; ev++)
+            bench_sequence(&b, ev);
+#endif
+    }
+
+    err = ufsm_init_machine(b.m);
+
+    if (err == UFSM_OK)
+        err = bench_run(&b, BENCH_WARMUP_EVENTS, NULL, &count);
+
+    /* Throughput without the clock in the loop, then the latencies */
+    if (err == UFSM_OK) {
+        start = ufsm_run_time();
+        err = bench_run(&b, no_of_events, NULL, &count);
+        elapsed = ufsm_run_time() - start;
+    }
+
+    if (err == UFSM_OK) {
+        result->events = count;
+        result->events_per_s = elapsed ? (count * 1e9 / elapsed) : 0;
+        err = bench_run(&b, no_of_events, samples, &count);
+    }
+
+    if (err == UFSM_OK) {
+        qsort(samples, count, sizeof(uint64_t), &compare_u64);
+        result->ns_p50 = samples[count / 2];
+        result->ns_p90 = samples[(uint64_t) count * 90 / 100];
+        result->ns_p99 = samples[(uint64_t) count * 99 / 100];
+        result->ns_max = samples[count - 1];
+        result->instance_bytes = sizeof(struct ufsm_instance) +
+                    sizeof(uint32_t) * UFSM_INSTANCE_DATA_SIZE(
+                                b.m->no_of_regions, b.m->no_of_states);
+
+        printf ("%s,%u,%llu,%.0f,%llu,%llu,%llu,%llu,%zu,%zu,%zu\n",
+                    c->name, c->param,
+                    (unsigned long long) result->events,
+                    result->events_per_s,
+                    (unsigned long long) result->ns_p50,
+                    (unsigned long long) result->ns_p90,
+                    (unsigned long long) result->ns_p99,
+                    (unsigned long long) result->ns_max,
+                    sizeof(struct ufsm_machine),
+                    b.definition_bytes,
+                    result->instance_bytes);
+
+        if (traced)
+            err = bench_trace_cost(&b, c, no_of_events);
+    } else {
+        fprintf (stderr, "Error: %s/%u failed with %u\n",
+                                            c->name, c->param, err);
+    }
+
+    free(samples);
+    bench_free(&b);
+
+    return err;
+}
+
+/* Prints the change of the throughput and the median against the line
+ * for the same chart in 'fp'
+ */
+static void bench_compare(FILE *fp, const struct bench_chart *c,
+                          const struct bench_result *result)
+{
+    char line[BENCH_LINE_SIZE];
+    char name[BENCH_LINE_SIZE];
+    unsigned int param = 0;
+    unsigned long long events = 0;
+    double events_per_s = 0;
+    unsigned long long p50 = 0;
+
+    rewind(fp);
+
+    while (fgets(line, sizeof(line), fp)) {
+        if (sscanf(line, "%255[^,],%u,%llu,%lf,%llu", name, &param, &events,
+                                            &events_per_s, &p50) != 5)
+            continue;
+
+        if (strcmp(name, c->name) != 0 || param != c->param)
+            continue;
+
+        fprintf (stderr, "%-12s %5u  events/s %+6.1f%%  p50 %+6.1f%%\n",
+                c->name, c->param,
+                events_per_s ? (result->events_per_s / events_per_s - 1) *
+                                                            100.0 : 0.0,
+                p50 ? ((double) result->ns_p50 / p50 - 1) * 100.0 : 0.0);
+        return;
+    }
+
+    fprintf (stderr, "%-12s %5u  not in baseline\n", c->name, c->param);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t no_of_events = BENCH_DEFAULT_EVENTS;
+    const char *only = NULL;
+    uint32_t err = UFSM_OK;
+    FILE *fp = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && (i + 1) < argc) {
+            no_of_events = (uint32_t) strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "-c") == 0 && (i + 1) < argc) {
+            only = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0) {
+            traced = true;
+        } else if (strcmp(argv[i], "-b") == 0 && (i + 1) < argc) {
+            fp = fopen(argv[++i], "r");
+
+            if (fp == NULL) {
+                printf ("Error: Could not open file '%s'\n", argv[i]);
+                return -1;
+            }
+        } else {
+            printf ("Usage: ufsmbench [options]\n");
+            printf ("   -n <events>    - Events per chart, default %u\n",
+                                                    BENCH_DEFAULT_EVENTS);
+            printf ("   -c <chart>     - Only run charts of this shape\n");
+            printf ("   -b <baseline>  - Compare with an earlier run\n");
+            printf ("   -t             - Measure the cost of tracing\n");
+            exit(0);
+        }
+    }
+
+    if (!no_of_events)
+        no_of_events = 1;
+
+    /* Without a clock, only the records themselves are measured */
+    if (traced)
+        ufsm_trace_init(&trace, BENCH_TRACE_RECORDS, trace_records, NULL);
+
+    printf ("%s\n", BENCH_HEADER);
+
+    for (uint32_t n = 0; n < sizeof(charts) / sizeof(charts[0]); n++) {
+        struct bench_result result = {0};
+
+        if (only && strcmp(only, charts[n].name) != 0)
+            continue;
+
+        if (bench_chart(&charts[n], no_of_events, &result) != UFSM_OK)
+            err = UFSM_ERROR;
+        else if (fp)
+            bench_compare(fp, &charts[n], &result);
+    }
+
+    if (fp)
+        fclose(fp);
+
+    return (err == UFSM_OK) ? 0 : -1;
+}
@@ -20,8 +20,7 @@
 
 static struct ufsm_machine *m = NULL;
 static struct ufsm_queue *q = NULL;
-static pthread_mutex_t queue_lock;
-static pthread_mutex_t event_loop_lock;
+static uint32_t queue_seq[UFSM_QUEUE_SIZE];
 static char *ifacename = NULL;
 
 #define MSG(x...) printf("    | Message    | " x)
@@ -153,21 +152,6 @@ void dhcp_collect_reply(void)
 
 /* Help functions */
 
-void dhcp_run_eventloop(void)
-{
-    pthread_mutex_unlock(&event_loop_lock);
-}
-
-void dhcp_lock_queue(void)
-{
-    pthread_mutex_lock(&queue_lock);
-}
-
-void dhcp_unlock_queue(void)
-{
-    pthread_mutex_unlock(&queue_lock);
-}
-
 void * q_test (void *arg)
 {
     while (true)
@@ -179,9 +163,7 @@ void * q_test (void *arg)
 
 int main(int argc, char **argv)
 {
-    bool running = true;
     uint32_t err = UFSM_OK;
-    uint32_t ev = 0;
 
     printf ("uFSM dhcp client demo\n");
 
@@ -192,18 +174,6 @@ int main(int argc, char **argv)
 
     ifacename = argv[1];
 
-    if (pthread_mutex_init (&queue_lock, NULL) != 0)
-    {
-        printf ("Error: Could not initialise queue lock\n");
-        return -1;
-    }
-
-    if (pthread_mutex_init (&event_loop_lock, NULL) != 0)
-    {
-        printf ("Error: Could not initialise event loop lock\n");
-        return -1;
-    }
-
     m = get_DHCPClient();
     q = ufsm_get_queue(m);
 
@@ -216,9 +186,13 @@ int main(int argc, char **argv)
     m->debug_enter_state = &debug_enter_state;
     m->debug_exit_state = &debug_exit_state;
 
-    q->on_data = &dhcp_run_eventloop;
-    q->lock = &dhcp_lock_queue;
-    q->unlock = &dhcp_unlock_queue;
+    /* Events are posted from several threads */
+    if (ufsm_queue_init_mpsc(q, q->no_of_elements, q->events,
+                                                 queue_seq) != UFSM_OK)
+    {
+        printf ("Error: Could not initialise queue\n");
+        return -1;
+    }
 
     printf (" EV |     OP     | Details\n");
     ufsm_init_machine(m);
@@ -226,24 +200,11 @@ int main(int argc, char **argv)
     pthread_t t;
     //pthread_create(&t, NULL, &q_test, NULL);
     
-    while (running)
-    {
-        pthread_mutex_lock(&event_loop_lock);
-        err = ufsm_queue_get(q, &ev);
-
-        if (err == UFSM_OK) {
-            pthread_mutex_unlock(&event_loop_lock);
-
-            err = ufsm_process(m, ev);
-            if (err != UFSM_OK)
-                MSG ("Error: %s\n", ufsm_errors[err]);
-        } else {
-            MSG ("Eventloop: No more events to process, sleeping...\n");
-        }
-    }
+    /* Sleeps while the queue is empty */
+    err = ufsm_run(m);
 
-    pthread_mutex_destroy(&queue_lock);
-    pthread_mutex_destroy(&event_loop_lock);
+    if (err != UFSM_OK)
+        MSG ("Error: %s\n", ufsm_errors[err]);
 
     return 0;
 }
@@ -1,6 +1,10 @@
 #include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
 #include "common.h"
 
+static char log_buf[256];
+
 void test_process(struct ufsm_machine *m, uint32_t ev)
 {
     uint32_t err = UFSM_OK;
@@ -12,11 +16,11 @@ void test_process(struct ufsm_machine *m, uint32_t ev)
     assert (err == UFSM_OK);
 
 
-    if (m->stack.pos == UFSM_STACK_SIZE)
+    if (m->context.stack.pos == UFSM_STACK_SIZE)
         printf ("ERROR: Stack overflow!\n");
-    else if (m->stack.pos > 0)
+    else if (m->context.stack.pos > 0)
         printf ("ERROR: Stack did not return to zero\n");
-    assert (m->stack.pos == 0);
+    assert (m->context.stack.pos == 0);
 
     struct ufsm_queue *q = ufsm_get_queue(m);
     uint32_t q_ev;
@@ -31,11 +35,11 @@ void test_process(struct ufsm_machine *m, uint32_t ev)
         assert (err == UFSM_OK);
 
 
-        if (m->stack.pos == UFSM_STACK_SIZE)
+        if (m->context.stack.pos == UFSM_STACK_SIZE)
             printf ("ERROR: Stack overflow!\n");
-        else if (m->stack.pos > 0)
+        else if (m->context.stack.pos > 0)
             printf ("ERROR: Stack did not return to zero\n");
-        assert (m->stack.pos == 0);
+        assert (m->context.stack.pos == 0);
     }
 }
 
@@ -46,4 +50,42 @@ void test_init(struct ufsm_machine *m)
 
 }
 
+/* Appends to the log that the hooks of a test write what they saw to,
+ * 'separator' goes between entries.
+ * */
+void test_log(const char *separator, const char *fmt, ...)
+{
+    size_t len = strlen(log_buf);
+    va_list args;
+
+    if (len)
+        len += snprintf(&log_buf[len], sizeof(log_buf) - len, "%s",
+                                                            separator);
+
+    if (len >= sizeof(log_buf))
+        return;
+
+    va_start(args, fmt);
+    vsnprintf(&log_buf[len], sizeof(log_buf) - len, fmt, args);
+    va_end(args);
+}
+
+void test_log_clear(void)
+{
+    log_buf[0] = 0;
+}
 
+void test_log_expect(const char *expected)
+{
+    if (strcmp(log_buf, expected) != 0)
+        printf ("ERROR: '%s', expected '%s'\n", log_buf, expected);
+    assert (strcmp(log_buf, expected) == 0);
+}
+
+/* Processes 'ev' and checks what was logged meanwhile */
+void test_step(struct ufsm_machine *m, uint32_t ev, const char *expected)
+{
+    test_log_clear();
+    test_process(m, ev);
+    test_log_expect(expected);
+}
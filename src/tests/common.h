@@ -6,5 +6,9 @@
 
 void test_process(struct ufsm_machine *m, uint32_t ev);
 void test_init(struct ufsm_machine *m);
+void test_log(const char *separator, const char *fmt, ...);
+void test_log_clear(void);
+void test_log_expect(const char *expected);
+void test_step(struct ufsm_machine *m, uint32_t ev, const char *expected);
 
 #endif
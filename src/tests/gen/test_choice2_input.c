@@ -0,0 +1,502 @@
+#include "gen/test_choice2_input.h"
+static struct ufsm_machine AAAAAAFj9Wa8uULt_O0;
+static struct ufsm_region AAAAAAFj9Wa8uULuTB0;
+static struct ufsm_transition AAAAAAFj9XmW4kQQH_s;
+static struct ufsm_transition AAAAAAFj9XnAjERHYos;
+static struct ufsm_action AAAAAAFj9XnLdURZYqU;
+static struct ufsm_state AAAAAAFj9Xmpv0QhPjQ;
+static struct ufsm_state AAAAAAFj9Xj8d0PJufI;
+static struct ufsm_region AAAAAAFj9Xj8d0PK2dk;
+static struct ufsm_transition AAAAAAFj9WbhmEMrp4A;
+static struct ufsm_transition AAAAAAFj9WciSENRW5g;
+static struct ufsm_transition AAAAAAFj9WdRhUNqFLE;
+static struct ufsm_action AAAAAAFj9Wfik0O2Sx8;
+static struct ufsm_guard AAAAAAFj9Xr3CkRgmiM;
+static struct ufsm_transition AAAAAAFj9WefIUOj1Pc;
+static struct ufsm_state AAAAAAFj9WeLAUN9pOs;
+static struct ufsm_entry_exit AAAAAAFj9Wfw1UO5N5Y;
+static struct ufsm_state AAAAAAFj9WbPA0L0lNQ;
+static struct ufsm_state AAAAAAFj9WdAQENleqM;
+static struct ufsm_state AAAAAAFj9Wb9okM9zC0;
+static struct ufsm_state AAAAAAFj9WbhKkMax4o;
+static struct ufsm_state AAAAAAFj9XmWX0P_pAU;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFj9Xmpv0QhPjQ,
+  &AAAAAAFj9Xj8d0PJufI,
+  &AAAAAAFj9XmWX0P_pAU,
+  &AAAAAAFj9WeLAUN9pOs,
+  &AAAAAAFj9WbPA0L0lNQ,
+  &AAAAAAFj9WdAQENleqM,
+  &AAAAAAFj9Wb9okM9zC0,
+  &AAAAAAFj9WbhKkMax4o,
+};
+
+
+
+static void *AAAAAAFj9Wa8uULt_O0_stack[16];
+static void *AAAAAAFj9Wa8uULt_O0_stack2[2];
+static void *AAAAAAFj9Wa8uULt_O0_completion_stack[1];
+static uint32_t AAAAAAFj9Wa8uULt_O0_data[UFSM_MACHINE_DATA_SIZE(8)];
+static struct ufsm_event AAAAAAFj9Wa8uULt_O0_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFj9Wa8uULt_O0 = {
+  .id     = "AAAAAAFj9Wa8uULt+O0=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFj9Wa8uULuTB0,    
+  .no_of_regions = 2,
+  .no_of_states = 8,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 1,
+  .no_of_transitions = 6,
+  .context = {
+    .m = &AAAAAAFj9Wa8uULt_O0,
+    .stack = {
+      .no_of_elements = 16,
+      .data = AAAAAAFj9Wa8uULt_O0_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 2,
+      .data = AAAAAAFj9Wa8uULt_O0_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFj9Wa8uULt_O0_completion_stack,
+    },
+  },
+  .data = AAAAAAFj9Wa8uULt_O0_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFj9Wa8uULt_O0_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFj9Wa8uULuTB0 = {
+  .id = "AAAAAAFj9Wa8uULuTB0=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFj9Xmpv0QhPjQ,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFj9XmW4kQQH_s,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFj9XmW4kQQH_s = {
+  .id = "AAAAAAFj9XmW4kQQH/s=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFj9XmWX0P_pAU,
+  .dest = &AAAAAAFj9Xj8d0PJufI,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFj9XnAjERHYos,
+};
+static struct ufsm_transition AAAAAAFj9XnAjERHYos = {
+  .id = "AAAAAAFj9XnAjERHYos=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 2,
+  .action = &AAAAAAFj9XnLdURZYqU,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFj9Xj8d0PJufI,
+  .dest = &AAAAAAFj9Xmpv0QhPjQ,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFj9XnLdURZYqU = {
+  .id = "AAAAAAFj9XnLdURZYqU=",
+  .name = "t2",
+  .f = &t2,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFj9Xmpv0QhPjQ_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFj9Xmpv0QhPjQ_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFj9Xmpv0QhPjQ = {
+  .id   = "AAAAAAFj9Xmpv0QhPjQ=",
+  .name = "State3",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFj9Wa8uULuTB0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFj9Xmpv0QhPjQ_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFj9Xmpv0QhPjQ_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFj9Xj8d0PJufI,
+};
+static struct ufsm_dispatch AAAAAAFj9Xj8d0PJufI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFj9Xj8d0PJufI_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFj9Xj8d0PJufI = {
+  .id   = "AAAAAAFj9Xj8d0PJufI=",
+  .name = "Composite",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFj9Wa8uULuTB0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFj9Xj8d0PK2dk,
+  .submachine = NULL,
+  .dispatch = AAAAAAFj9Xj8d0PJufI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFj9Xj8d0PJufI_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFj9XnAjERHYos,
+  .next = &AAAAAAFj9XmWX0P_pAU,
+};
+static struct ufsm_region AAAAAAFj9Xj8d0PK2dk = {
+  .id = "AAAAAAFj9Xj8d0PK2dk=",
+  .name = "Compositeregion0",
+  .state = &AAAAAAFj9WeLAUN9pOs,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFj9WbhmEMrp4A,
+  .parent_state = &AAAAAAFj9Xj8d0PJufI,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFj9WbhmEMrp4A = {
+  .id = "AAAAAAFj9WbhmEMrp4A=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFj9WbhKkMax4o,
+  .dest = &AAAAAAFj9WbPA0L0lNQ,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFj9WciSENRW5g,
+};
+static struct ufsm_trigger AAAAAAFj9WciSENRW5g_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFj9WciSENRW5g = {
+  .id = "AAAAAAFj9WciSENRW5g=",
+  .name = "",
+  .trigger = AAAAAAFj9WciSENRW5g_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFj9WbPA0L0lNQ,
+  .dest = &AAAAAAFj9Wb9okM9zC0,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFj9WdRhUNqFLE,
+};
+static struct ufsm_transition AAAAAAFj9WdRhUNqFLE = {
+  .id = "AAAAAAFj9WdRhUNqFLE=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 5,
+  .action = &AAAAAAFj9Wfik0O2Sx8,
+  .defer = false,
+  .guard = &AAAAAAFj9Xr3CkRgmiM,
+  .source = &AAAAAAFj9Wb9okM9zC0,
+  .dest = &AAAAAAFj9WdAQENleqM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFj9WefIUOj1Pc,
+};
+static struct ufsm_action AAAAAAFj9Wfik0O2Sx8 = {
+  .id = "AAAAAAFj9Wfik0O2Sx8=",
+  .name = "t1",
+  .f = &t1,
+  .next = NULL,
+};
+static struct ufsm_guard AAAAAAFj9Xr3CkRgmiM = {
+  .id = "AAAAAAFj9Xr3CkRgmiM=",
+  .name = "g",
+  .f = &g,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFj9WefIUOj1Pc = {
+  .id = "AAAAAAFj9WefIUOj1Pc=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 6,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFj9Wb9okM9zC0,
+  .dest = &AAAAAAFj9WeLAUN9pOs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFj9WeLAUN9pOs_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFj9WeLAUN9pOs_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFj9WeLAUN9pOs = {
+  .id   = "AAAAAAFj9WeLAUN9pOs=",
+  .name = "State2",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &AAAAAAFj9Xj8d0PK2dk,
+  .entry = &AAAAAAFj9Wfw1UO5N5Y,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFj9WeLAUN9pOs_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFj9WeLAUN9pOs_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFj9WbPA0L0lNQ,
+};
+static struct ufsm_entry_exit AAAAAAFj9Wfw1UO5N5Y = {
+  .id = "AAAAAAFj9Wfw1UO5N5Y=",
+  .name = "e2",
+  .f = &e2,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFj9WbPA0L0lNQ_dispatch_0[] = {
+  &AAAAAAFj9WciSENRW5g,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFj9WbPA0L0lNQ_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFj9WbPA0L0lNQ_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFj9WbPA0L0lNQ_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFj9WbPA0L0lNQ_flat_dispatch_0[] = {
+  &AAAAAAFj9WciSENRW5g,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFj9WbPA0L0lNQ_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFj9WbPA0L0lNQ_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFj9WbPA0L0lNQ = {
+  .id   = "AAAAAAFj9WbPA0L0lNQ=",
+  .name = "Start",
+  .kind = 0,
+  .index = 5,
+  .parent_region = &AAAAAAFj9Xj8d0PK2dk,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFj9WbPA0L0lNQ_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFj9WbPA0L0lNQ_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFj9WbPA0L0lNQ_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFj9WdAQENleqM,
+};
+static struct ufsm_dispatch AAAAAAFj9WdAQENleqM_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFj9WdAQENleqM_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFj9WdAQENleqM = {
+  .id   = "AAAAAAFj9WdAQENleqM=",
+  .name = "Final",
+  .kind = 2,
+  .index = 6,
+  .parent_region = &AAAAAAFj9Xj8d0PK2dk,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFj9WdAQENleqM_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFj9WdAQENleqM_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFj9Wb9okM9zC0,
+};
+static struct ufsm_dispatch AAAAAAFj9Wb9okM9zC0_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFj9Wb9okM9zC0_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFj9Wb9okM9zC0 = {
+  .id   = "AAAAAAFj9Wb9okM9zC0=",
+  .name = "(null)",
+  .kind = 9,
+  .index = 7,
+  .parent_region = &AAAAAAFj9Xj8d0PK2dk,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFj9Wb9okM9zC0_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFj9Wb9okM9zC0_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFj9WdRhUNqFLE,
+  .next = &AAAAAAFj9WbhKkMax4o,
+};
+static struct ufsm_dispatch AAAAAAFj9WbhKkMax4o_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFj9WbhKkMax4o_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFj9WbhKkMax4o = {
+  .id   = "AAAAAAFj9WbhKkMax4o=",
+  .name = "Init",
+  .kind = 1,
+  .index = 8,
+  .parent_region = &AAAAAAFj9Xj8d0PK2dk,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFj9WbhKkMax4o_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFj9WbhKkMax4o_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFj9WbhmEMrp4A,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFj9XmWX0P_pAU_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFj9XmWX0P_pAU_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFj9XmWX0P_pAU = {
+  .id   = "AAAAAAFj9XmWX0P/pAU=",
+  .name = "Init",
+  .kind = 1,
+  .index = 3,
+  .parent_region = &AAAAAAFj9Wa8uULuTB0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFj9XmWX0P_pAU_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFj9XmWX0P_pAU_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFj9XmW4kQQH_s,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFj9Wa8uULt_O0; }
@@ -0,0 +1,21 @@
+#ifndef UFSM_GEN_test_choice2_input_H__
+#define UFSM_GEN_test_choice2_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 2, active regions 2, completion states 1, stacks 16/2/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 19
+void e2(void);
+bool g(void);
+void t2(void);
+void t1(void);
+enum {
+  EV,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(2, 8)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 6, 8, 1)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(8)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
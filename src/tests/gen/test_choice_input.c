@@ -0,0 +1,421 @@
+#include "gen/test_choice_input.h"
+static struct ufsm_machine AAAAAAFjuC48Ciql0Sk;
+static struct ufsm_region AAAAAAFjuC48Cyqm5VE;
+static struct ufsm_transition AAAAAAFjuC8uRCtRbog;
+static struct ufsm_guard AAAAAAFjuEREqiwWK2E;
+static struct ufsm_transition AAAAAAFjuC9EmitiYQ4;
+static struct ufsm_guard AAAAAAFjuEREqiwXnUA;
+static struct ufsm_transition AAAAAAFjuC9knitzuDM;
+static struct ufsm_guard AAAAAAFjuEREqiwYYVg;
+static struct ufsm_transition AAAAAAFjuDCtASu_rws;
+static struct ufsm_transition AAAAAAFjuDDEvivTzBk;
+static struct ufsm_state AAAAAAFjuDCWRiuZAEU;
+static struct ufsm_state AAAAAAFjuC8fHissjtY;
+static struct ufsm_entry_exit AAAAAAFjuEPzgCwO8xk;
+static struct ufsm_state AAAAAAFjuC8LyCsHLrg;
+static struct ufsm_entry_exit AAAAAAFjuEPgvCwHiy0;
+static struct ufsm_state AAAAAAFjuC72CiriL_c;
+static struct ufsm_entry_exit AAAAAAFjuEPQFSwAra8;
+static struct ufsm_state AAAAAAFjuC7MEyrAOIw;
+static struct ufsm_state AAAAAAFjuC59MCqsap0;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjuDCWRiuZAEU,
+  &AAAAAAFjuC8fHissjtY,
+  &AAAAAAFjuC8LyCsHLrg,
+  &AAAAAAFjuC72CiriL_c,
+  &AAAAAAFjuC7MEyrAOIw,
+  &AAAAAAFjuC59MCqsap0,
+};
+
+
+
+static void *AAAAAAFjuC48Ciql0Sk_stack[12];
+static void *AAAAAAFjuC48Ciql0Sk_stack2[1];
+static void *AAAAAAFjuC48Ciql0Sk_completion_stack[1];
+static uint32_t AAAAAAFjuC48Ciql0Sk_data[UFSM_MACHINE_DATA_SIZE(6)];
+static struct ufsm_event AAAAAAFjuC48Ciql0Sk_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjuC48Ciql0Sk = {
+  .id     = "AAAAAAFjuC48Ciql0Sk=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFjuC48Cyqm5VE,    
+  .no_of_regions = 1,
+  .no_of_states = 6,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 1,
+  .no_of_transitions = 5,
+  .context = {
+    .m = &AAAAAAFjuC48Ciql0Sk,
+    .stack = {
+      .no_of_elements = 12,
+      .data = AAAAAAFjuC48Ciql0Sk_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjuC48Ciql0Sk_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjuC48Ciql0Sk_completion_stack,
+    },
+  },
+  .data = AAAAAAFjuC48Ciql0Sk_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjuC48Ciql0Sk_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjuC48Cyqm5VE = {
+  .id = "AAAAAAFjuC48Cyqm5VE=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFjuDCWRiuZAEU,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjuC8uRCtRbog,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjuC8uRCtRbog = {
+  .id = "AAAAAAFjuC8uRCtRbog=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = &AAAAAAFjuEREqiwWK2E,
+  .source = &AAAAAAFjuC59MCqsap0,
+  .dest = &AAAAAAFjuC72CiriL_c,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjuC9EmitiYQ4,
+};
+static struct ufsm_guard AAAAAAFjuEREqiwWK2E = {
+  .id = "AAAAAAFjuEREqiwWK2E=",
+  .name = "g1",
+  .f = &g1,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjuC9EmitiYQ4 = {
+  .id = "AAAAAAFjuC9EmitiYQ4=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = &AAAAAAFjuEREqiwXnUA,
+  .source = &AAAAAAFjuC59MCqsap0,
+  .dest = &AAAAAAFjuC8LyCsHLrg,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjuC9knitzuDM,
+};
+static struct ufsm_guard AAAAAAFjuEREqiwXnUA = {
+  .id = "AAAAAAFjuEREqiwXnUA=",
+  .name = "g2",
+  .f = &g2,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjuC9knitzuDM = {
+  .id = "AAAAAAFjuC9knitzuDM=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = &AAAAAAFjuEREqiwYYVg,
+  .source = &AAAAAAFjuC59MCqsap0,
+  .dest = &AAAAAAFjuC8fHissjtY,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjuDCtASu_rws,
+};
+static struct ufsm_guard AAAAAAFjuEREqiwYYVg = {
+  .id = "AAAAAAFjuEREqiwYYVg=",
+  .name = "g3",
+  .f = &g3,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjuDCtASu_rws_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjuDCtASu_rws = {
+  .id = "AAAAAAFjuDCtASu/rws=",
+  .name = "",
+  .trigger = AAAAAAFjuDCtASu_rws_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjuDCWRiuZAEU,
+  .dest = &AAAAAAFjuC59MCqsap0,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjuDDEvivTzBk,
+};
+static struct ufsm_transition AAAAAAFjuDDEvivTzBk = {
+  .id = "AAAAAAFjuDDEvivTzBk=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjuC7MEyrAOIw,
+  .dest = &AAAAAAFjuDCWRiuZAEU,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjuDCWRiuZAEU_dispatch_0[] = {
+  &AAAAAAFjuDCtASu_rws,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjuDCWRiuZAEU_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjuDCWRiuZAEU_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjuDCWRiuZAEU_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjuDCWRiuZAEU_flat_dispatch_0[] = {
+  &AAAAAAFjuDCtASu_rws,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjuDCWRiuZAEU_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjuDCWRiuZAEU_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjuDCWRiuZAEU = {
+  .id   = "AAAAAAFjuDCWRiuZAEU=",
+  .name = "A",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjuC48Cyqm5VE,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjuDCWRiuZAEU_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjuDCWRiuZAEU_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjuDCWRiuZAEU_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjuC8fHissjtY,
+};
+static struct ufsm_dispatch AAAAAAFjuC8fHissjtY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjuC8fHissjtY_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjuC8fHissjtY = {
+  .id   = "AAAAAAFjuC8fHissjtY=",
+  .name = "State3",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFjuC48Cyqm5VE,
+  .entry = &AAAAAAFjuEPzgCwO8xk,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjuC8fHissjtY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjuC8fHissjtY_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjuC8LyCsHLrg,
+};
+static struct ufsm_entry_exit AAAAAAFjuEPzgCwO8xk = {
+  .id = "AAAAAAFjuEPzgCwO8xk=",
+  .name = "e3",
+  .f = &e3,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjuC8LyCsHLrg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjuC8LyCsHLrg_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjuC8LyCsHLrg = {
+  .id   = "AAAAAAFjuC8LyCsHLrg=",
+  .name = "State2",
+  .kind = 0,
+  .index = 3,
+  .parent_region = &AAAAAAFjuC48Cyqm5VE,
+  .entry = &AAAAAAFjuEPgvCwHiy0,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjuC8LyCsHLrg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjuC8LyCsHLrg_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjuC72CiriL_c,
+};
+static struct ufsm_entry_exit AAAAAAFjuEPgvCwHiy0 = {
+  .id = "AAAAAAFjuEPgvCwHiy0=",
+  .name = "e2",
+  .f = &e2,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjuC72CiriL_c_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjuC72CiriL_c_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjuC72CiriL_c = {
+  .id   = "AAAAAAFjuC72CiriL+c=",
+  .name = "State1",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &AAAAAAFjuC48Cyqm5VE,
+  .entry = &AAAAAAFjuEPQFSwAra8,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjuC72CiriL_c_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjuC72CiriL_c_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjuC7MEyrAOIw,
+};
+static struct ufsm_entry_exit AAAAAAFjuEPQFSwAra8 = {
+  .id = "AAAAAAFjuEPQFSwAra8=",
+  .name = "e1",
+  .f = &e1,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjuC7MEyrAOIw_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjuC7MEyrAOIw_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjuC7MEyrAOIw = {
+  .id   = "AAAAAAFjuC7MEyrAOIw=",
+  .name = "Init",
+  .kind = 1,
+  .index = 5,
+  .parent_region = &AAAAAAFjuC48Cyqm5VE,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjuC7MEyrAOIw_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjuC7MEyrAOIw_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjuDDEvivTzBk,
+  .next = &AAAAAAFjuC59MCqsap0,
+};
+static struct ufsm_dispatch AAAAAAFjuC59MCqsap0_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjuC59MCqsap0_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjuC59MCqsap0 = {
+  .id   = "AAAAAAFjuC59MCqsap0=",
+  .name = "(null)",
+  .kind = 9,
+  .index = 6,
+  .parent_region = &AAAAAAFjuC48Cyqm5VE,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjuC59MCqsap0_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjuC59MCqsap0_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjuC8uRCtRbog,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFjuC48Ciql0Sk; }
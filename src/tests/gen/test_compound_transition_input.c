@@ -0,0 +1,676 @@
+#include "gen/test_compound_transition_input.h"
+static struct ufsm_machine AAAAAAFjoJh_rXtKrkk;
+static struct ufsm_region AAAAAAFjoJh_rntLh_8;
+static struct ufsm_transition AAAAAAFjoJ90rX1IDhY;
+static struct ufsm_state AAAAAAFjoJi0BntRS0U;
+static struct ufsm_region AAAAAAFjoJi0BntSyIc;
+static struct ufsm_transition AAAAAAFjoJ9Pgn0kXKY;
+static struct ufsm_state AAAAAAFjoJzJqXwWyH8;
+static struct ufsm_region AAAAAAFjoJzJqXwXPPo;
+static struct ufsm_state AAAAAAFjoJ0j_XxEqyU;
+static struct ufsm_region AAAAAAFjoJ0j_XxFRtw;
+static struct ufsm_transition AAAAAAFjoJ7PNXzaAIA;
+static struct ufsm_action AAAAAAFjoJ7aUHzsFdA;
+static struct ufsm_state AAAAAAFjoJ2ek3x_6sE;
+static struct ufsm_entry_exit AAAAAAFjoJ6WkHzTVxc;
+static struct ufsm_state AAAAAAFjoJ3yP3yppvg;
+static struct ufsm_entry_exit AAAAAAFjoJ18bHx4dSc;
+static struct ufsm_entry_exit AAAAAAFjoJ1ijHxxQkI;
+static struct ufsm_state AAAAAAFjoJjkInt8UTM;
+static struct ufsm_region AAAAAAFjoJjkI3t9L_c;
+static struct ufsm_transition AAAAAAFjoJtcQ3v6YCM;
+static struct ufsm_action AAAAAAFjoJts0XwNiBw;
+static struct ufsm_transition AAAAAAFjoJ5KlHy_eCE;
+static struct ufsm_action AAAAAAFjoJ5Yg3zQgks;
+static struct ufsm_transition AAAAAAFjoJ8X6Hz_vZ8;
+static struct ufsm_state AAAAAAFjoJnDvHuyB_k;
+static struct ufsm_entry_exit AAAAAAFjoJoPaHvbuSM;
+static struct ufsm_state AAAAAAFjoJ8XmXzuazU;
+static struct ufsm_state AAAAAAFjoJponnvlHFY;
+static struct ufsm_entry_exit AAAAAAFjoJl1Snur7_Y;
+static struct ufsm_state AAAAAAFjoJ9PT30T4KM;
+static struct ufsm_state AAAAAAFjoJ90fH03A1k;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjoJi0BntRS0U,
+  &AAAAAAFjoJ90fH03A1k,
+  &AAAAAAFjoJzJqXwWyH8,
+  &AAAAAAFjoJjkInt8UTM,
+  &AAAAAAFjoJ9PT30T4KM,
+  &AAAAAAFjoJnDvHuyB_k,
+  &AAAAAAFjoJ8XmXzuazU,
+  &AAAAAAFjoJponnvlHFY,
+  &AAAAAAFjoJ0j_XxEqyU,
+  &AAAAAAFjoJ2ek3x_6sE,
+  &AAAAAAFjoJ3yP3yppvg,
+};
+
+
+
+static void *AAAAAAFjoJh_rXtKrkk_stack[20];
+static void *AAAAAAFjoJh_rXtKrkk_stack2[4];
+static void *AAAAAAFjoJh_rXtKrkk_completion_stack[1];
+static uint32_t AAAAAAFjoJh_rXtKrkk_data[UFSM_MACHINE_DATA_SIZE(11)];
+static struct ufsm_event AAAAAAFjoJh_rXtKrkk_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjoJh_rXtKrkk = {
+  .id     = "AAAAAAFjoJh/rXtKrkk=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFjoJh_rntLh_8,    
+  .no_of_regions = 5,
+  .no_of_states = 11,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 1,
+  .no_of_transitions = 6,
+  .context = {
+    .m = &AAAAAAFjoJh_rXtKrkk,
+    .stack = {
+      .no_of_elements = 20,
+      .data = AAAAAAFjoJh_rXtKrkk_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 4,
+      .data = AAAAAAFjoJh_rXtKrkk_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjoJh_rXtKrkk_completion_stack,
+    },
+  },
+  .data = AAAAAAFjoJh_rXtKrkk_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjoJh_rXtKrkk_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjoJh_rntLh_8 = {
+  .id = "AAAAAAFjoJh/rntLh/8=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFjoJi0BntRS0U,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjoJ90rX1IDhY,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjoJ90rX1IDhY = {
+  .id = "AAAAAAFjoJ90rX1IDhY=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjoJ90fH03A1k,
+  .dest = &AAAAAAFjoJi0BntRS0U,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJi0BntRS0U_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjoJi0BntRS0U_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJi0BntRS0U = {
+  .id   = "AAAAAAFjoJi0BntRS0U=",
+  .name = "S",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjoJh_rntLh_8,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFjoJi0BntSyIc,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJi0BntRS0U_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjoJi0BntRS0U_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjoJ90fH03A1k,
+};
+static struct ufsm_region AAAAAAFjoJi0BntSyIc = {
+  .id = "AAAAAAFjoJi0BntSyIc=",
+  .name = "Sregion0",
+  .state = &AAAAAAFjoJzJqXwWyH8,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFjoJ9Pgn0kXKY,
+  .parent_state = &AAAAAAFjoJi0BntRS0U,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjoJ9Pgn0kXKY = {
+  .id = "AAAAAAFjoJ9Pgn0kXKY=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjoJ9PT30T4KM,
+  .dest = &AAAAAAFjoJjkInt8UTM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJzJqXwWyH8_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjoJzJqXwWyH8_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJzJqXwWyH8 = {
+  .id   = "AAAAAAFjoJzJqXwWyH8=",
+  .name = "T1",
+  .kind = 0,
+  .index = 3,
+  .parent_region = &AAAAAAFjoJi0BntSyIc,
+  .entry = &AAAAAAFjoJ1ijHxxQkI,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFjoJzJqXwXPPo,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJzJqXwWyH8_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjoJzJqXwWyH8_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjoJjkInt8UTM,
+};
+static struct ufsm_region AAAAAAFjoJzJqXwXPPo = {
+  .id = "AAAAAAFjoJzJqXwXPPo=",
+  .name = "T1region0",
+  .state = &AAAAAAFjoJ0j_XxEqyU,
+  .has_history = false,
+  .history = NULL,
+  .index = 3,
+  .transition = NULL,
+  .parent_state = &AAAAAAFjoJzJqXwWyH8,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJ0j_XxEqyU_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjoJ0j_XxEqyU_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJ0j_XxEqyU = {
+  .id   = "AAAAAAFjoJ0j+XxEqyU=",
+  .name = "T11",
+  .kind = 0,
+  .index = 9,
+  .parent_region = &AAAAAAFjoJzJqXwXPPo,
+  .entry = &AAAAAAFjoJ18bHx4dSc,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFjoJ0j_XxFRtw,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJ0j_XxEqyU_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjoJ0j_XxEqyU_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFjoJ0j_XxFRtw = {
+  .id = "AAAAAAFjoJ0j+XxFRtw=",
+  .name = "T11region0",
+  .state = &AAAAAAFjoJ2ek3x_6sE,
+  .has_history = false,
+  .history = NULL,
+  .index = 4,
+  .transition = &AAAAAAFjoJ7PNXzaAIA,
+  .parent_state = &AAAAAAFjoJ0j_XxEqyU,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjoJ7PNXzaAIA = {
+  .id = "AAAAAAFjoJ7PNXzaAIA=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 6,
+  .action = &AAAAAAFjoJ7aUHzsFdA,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjoJ3yP3yppvg,
+  .dest = &AAAAAAFjoJ2ek3x_6sE,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFjoJ7aUHzsFdA = {
+  .id = "AAAAAAFjoJ7aUHzsFdA=",
+  .name = "t3",
+  .f = &t3,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJ2ek3x_6sE_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjoJ2ek3x_6sE_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJ2ek3x_6sE = {
+  .id   = "AAAAAAFjoJ2ek3x/6sE=",
+  .name = "T111",
+  .kind = 0,
+  .index = 10,
+  .parent_region = &AAAAAAFjoJ0j_XxFRtw,
+  .entry = &AAAAAAFjoJ6WkHzTVxc,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJ2ek3x_6sE_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjoJ2ek3x_6sE_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjoJ3yP3yppvg,
+};
+static struct ufsm_entry_exit AAAAAAFjoJ6WkHzTVxc = {
+  .id = "AAAAAAFjoJ6WkHzTVxc=",
+  .name = "eT111",
+  .f = &eT111,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJ3yP3yppvg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjoJ3yP3yppvg_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJ3yP3yppvg = {
+  .id   = "AAAAAAFjoJ3yP3yppvg=",
+  .name = "(null)",
+  .kind = 6,
+  .index = 11,
+  .parent_region = &AAAAAAFjoJ0j_XxFRtw,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJ3yP3yppvg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjoJ3yP3yppvg_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjoJ7PNXzaAIA,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjoJ18bHx4dSc = {
+  .id = "AAAAAAFjoJ18bHx4dSc=",
+  .name = "eT11",
+  .f = &eT11,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjoJ1ijHxxQkI = {
+  .id = "AAAAAAFjoJ1ijHxxQkI=",
+  .name = "eT1",
+  .f = &eT1,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJjkInt8UTM_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjoJjkInt8UTM_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJjkInt8UTM = {
+  .id   = "AAAAAAFjoJjkInt8UTM=",
+  .name = "S1",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &AAAAAAFjoJi0BntSyIc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = &AAAAAAFjoJl1Snur7_Y,
+  .region = &AAAAAAFjoJjkI3t9L_c,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJjkInt8UTM_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjoJjkInt8UTM_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjoJ9PT30T4KM,
+};
+static struct ufsm_region AAAAAAFjoJjkI3t9L_c = {
+  .id = "AAAAAAFjoJjkI3t9L/c=",
+  .name = "S1region0",
+  .state = &AAAAAAFjoJnDvHuyB_k,
+  .has_history = false,
+  .history = NULL,
+  .index = 2,
+  .transition = &AAAAAAFjoJtcQ3v6YCM,
+  .parent_state = &AAAAAAFjoJjkInt8UTM,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjoJtcQ3v6YCM_triggers[] = {
+{
+  .trigger = 0,
+  .name = "sig",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjoJtcQ3v6YCM = {
+  .id = "AAAAAAFjoJtcQ3v6YCM=",
+  .name = "",
+  .trigger = AAAAAAFjoJtcQ3v6YCM_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 3,
+  .action = &AAAAAAFjoJts0XwNiBw,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjoJnDvHuyB_k,
+  .dest = &AAAAAAFjoJponnvlHFY,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjoJ5KlHy_eCE,
+};
+static struct ufsm_action AAAAAAFjoJts0XwNiBw = {
+  .id = "AAAAAAFjoJts0XwNiBw=",
+  .name = "t1",
+  .f = &t1,
+  .next = NULL,
+};
+static struct ufsm_region * AAAAAAFjoJ5KlHy_eCE_exit_path[] = {
+  &AAAAAAFjoJjkI3t9L_c,
+  NULL,
+};
+static struct ufsm_region * AAAAAAFjoJ5KlHy_eCE_enter_path[] = {
+  &AAAAAAFjoJzJqXwXPPo,
+  &AAAAAAFjoJ0j_XxFRtw,
+  NULL,
+};
+static struct ufsm_transition AAAAAAFjoJ5KlHy_eCE = {
+  .id = "AAAAAAFjoJ5KlHy+eCE=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 4,
+  .action = &AAAAAAFjoJ5Yg3zQgks,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjoJponnvlHFY,
+  .dest = &AAAAAAFjoJ3yP3yppvg,
+  .lca = &AAAAAAFjoJi0BntSyIc,
+  .exit_path = AAAAAAFjoJ5KlHy_eCE_exit_path,
+  .enter_path = AAAAAAFjoJ5KlHy_eCE_enter_path,
+  .next = &AAAAAAFjoJ8X6Hz_vZ8,
+};
+static struct ufsm_action AAAAAAFjoJ5Yg3zQgks = {
+  .id = "AAAAAAFjoJ5Yg3zQgks=",
+  .name = "t2",
+  .f = &t2,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjoJ8X6Hz_vZ8 = {
+  .id = "AAAAAAFjoJ8X6Hz/vZ8=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjoJ8XmXzuazU,
+  .dest = &AAAAAAFjoJnDvHuyB_k,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjoJnDvHuyB_k_dispatch_0[] = {
+  &AAAAAAFjoJtcQ3v6YCM,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJnDvHuyB_k_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjoJnDvHuyB_k_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjoJnDvHuyB_k_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjoJnDvHuyB_k_flat_dispatch_0[] = {
+  &AAAAAAFjoJtcQ3v6YCM,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJnDvHuyB_k_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjoJnDvHuyB_k_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJnDvHuyB_k = {
+  .id   = "AAAAAAFjoJnDvHuyB+k=",
+  .name = "S11",
+  .kind = 0,
+  .index = 6,
+  .parent_region = &AAAAAAFjoJjkI3t9L_c,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = &AAAAAAFjoJoPaHvbuSM,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJnDvHuyB_k_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjoJnDvHuyB_k_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjoJnDvHuyB_k_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjoJ8XmXzuazU,
+};
+static struct ufsm_entry_exit AAAAAAFjoJoPaHvbuSM = {
+  .id = "AAAAAAFjoJoPaHvbuSM=",
+  .name = "xS11",
+  .f = &xS11,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJ8XmXzuazU_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjoJ8XmXzuazU_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJ8XmXzuazU = {
+  .id   = "AAAAAAFjoJ8XmXzuazU=",
+  .name = "Init",
+  .kind = 1,
+  .index = 7,
+  .parent_region = &AAAAAAFjoJjkI3t9L_c,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJ8XmXzuazU_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjoJ8XmXzuazU_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjoJ8X6Hz_vZ8,
+  .next = &AAAAAAFjoJponnvlHFY,
+};
+static struct ufsm_dispatch AAAAAAFjoJponnvlHFY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjoJponnvlHFY_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJponnvlHFY = {
+  .id   = "AAAAAAFjoJponnvlHFY=",
+  .name = "(null)",
+  .kind = 5,
+  .index = 8,
+  .parent_region = &AAAAAAFjoJjkI3t9L_c,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJponnvlHFY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjoJponnvlHFY_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjoJ5KlHy_eCE,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjoJl1Snur7_Y = {
+  .id = "AAAAAAFjoJl1Snur7/Y=",
+  .name = "xS1",
+  .f = &xS1,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJ9PT30T4KM_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjoJ9PT30T4KM_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJ9PT30T4KM = {
+  .id   = "AAAAAAFjoJ9PT30T4KM=",
+  .name = "Init",
+  .kind = 1,
+  .index = 5,
+  .parent_region = &AAAAAAFjoJi0BntSyIc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJ9PT30T4KM_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjoJ9PT30T4KM_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjoJ9Pgn0kXKY,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjoJ90fH03A1k_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjoJ90fH03A1k_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoJ90fH03A1k = {
+  .id   = "AAAAAAFjoJ90fH03A1k=",
+  .name = "Init",
+  .kind = 1,
+  .index = 2,
+  .parent_region = &AAAAAAFjoJh_rntLh_8,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoJ90fH03A1k_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjoJ90fH03A1k_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjoJ90rX1IDhY,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFjoJh_rXtKrkk; }
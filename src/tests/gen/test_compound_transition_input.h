@@ -0,0 +1,25 @@
+#ifndef UFSM_GEN_test_compound_transition_input_H__
+#define UFSM_GEN_test_compound_transition_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 4, active regions 4, completion states 0, stacks 20/4/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 25
+void eT111(void);
+void eT11(void);
+void eT1(void);
+void xS11(void);
+void xS1(void);
+void t3(void);
+void t1(void);
+void t2(void);
+enum {
+  sig,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(5, 11)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 6, 11, 1)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(11)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
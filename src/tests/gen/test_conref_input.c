@@ -0,0 +1,669 @@
+#include "gen/test_conref_input.h"
+static struct ufsm_machine AAAAAAFjxYRqw4cH_1M;
+static struct ufsm_region AAAAAAFjxYRqw4cIX0Q;
+static struct ufsm_transition AAAAAAFjxYSMjIdFpJY;
+static struct ufsm_transition AAAAAAFjxYXxZoe1OtQ;
+static struct ufsm_action AAAAAAFjxYeOt4gozb4;
+static struct ufsm_transition AAAAAAFjxYcf6ogIBrc;
+static struct ufsm_state AAAAAAFjxYZJBYfMb0M;
+static struct ufsm_entry_exit AAAAAAFjxYdBkogcACE;
+static struct ufsm_state AAAAAAFjxYTTZIdfUTY;
+static struct ufsm_entry_exit AAAAAAFjxjAHJYk0xXk;
+static struct ufsm_entry_exit AAAAAAFjxjCK_Yk7_B4;
+static struct ufsm_state AAAAAAFjxYR8hIcOjBY;
+static struct ufsm_entry_exit AAAAAAFjxYepG4grJHQ;
+static struct ufsm_state AAAAAAFjxYSMCYc0mcg;
+static struct ufsm_machine AAAAAAFjxYS5VYdWqfQ;
+static struct ufsm_region AAAAAAFjxYS5VYdXRQM;
+static struct ufsm_transition AAAAAAFjxYZj04fyI74;
+static struct ufsm_action AAAAAAFjxYdmLogkiQ4;
+static struct ufsm_transition AAAAAAFjxYl_BoiG8Qs;
+static struct ufsm_action AAAAAAFjxYmXKYiYHWI;
+static struct ufsm_transition AAAAAAFjxYnZBoisRnc;
+static struct ufsm_action AAAAAAFjxYntnYi_8dM;
+static struct ufsm_transition AAAAAAFjxYop5ojU_KA;
+static struct ufsm_state AAAAAAFjxYfa6Igy7Vk;
+static struct ufsm_entry_exit AAAAAAFjxjDTSolCYbw;
+static struct ufsm_entry_exit AAAAAAFjxjDpdYlJM4s;
+static struct ufsm_state AAAAAAFjxYopMojDEfw;
+static struct ufsm_state AAAAAAFjxYm_ZIiapOo;
+static struct ufsm_state AAAAAAFjxYlY1Yh0QoA;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjxYZJBYfMb0M,
+  &AAAAAAFjxYTTZIdfUTY,
+  &AAAAAAFjxYR8hIcOjBY,
+  &AAAAAAFjxYSMCYc0mcg,
+  &AAAAAAFjxYfa6Igy7Vk,
+  &AAAAAAFjxYopMojDEfw,
+  &AAAAAAFjxYm_ZIiapOo,
+  &AAAAAAFjxYlY1Yh0QoA,
+};
+
+
+
+static void *AAAAAAFjxYRqw4cH_1M_stack[14];
+static void *AAAAAAFjxYRqw4cH_1M_stack2[2];
+static void *AAAAAAFjxYRqw4cH_1M_completion_stack[1];
+static uint32_t AAAAAAFjxYRqw4cH_1M_data[UFSM_MACHINE_DATA_SIZE(8)];
+static struct ufsm_event AAAAAAFjxYRqw4cH_1M_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjxYRqw4cH_1M = {
+  .id     = "AAAAAAFjxYRqw4cH+1M=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFjxYRqw4cIX0Q,    
+  .no_of_regions = 2,
+  .no_of_states = 8,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 1,
+  .no_of_transitions = 7,
+  .context = {
+    .m = &AAAAAAFjxYRqw4cH_1M,
+    .stack = {
+      .no_of_elements = 14,
+      .data = AAAAAAFjxYRqw4cH_1M_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 2,
+      .data = AAAAAAFjxYRqw4cH_1M_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjxYRqw4cH_1M_completion_stack,
+    },
+  },
+  .data = AAAAAAFjxYRqw4cH_1M_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjxYRqw4cH_1M_queue,
+  },
+  .next = &AAAAAAFjxYS5VYdWqfQ, 
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjxYRqw4cIX0Q = {
+  .id = "AAAAAAFjxYRqw4cIX0Q=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFjxYZJBYfMb0M,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjxYSMjIdFpJY,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjxYSMjIdFpJY = {
+  .id = "AAAAAAFjxYSMjIdFpJY=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjxYSMCYc0mcg,
+  .dest = &AAAAAAFjxYR8hIcOjBY,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjxYXxZoe1OtQ,
+};
+static struct ufsm_trigger AAAAAAFjxYXxZoe1OtQ_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * AAAAAAFjxYXxZoe1OtQ_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * AAAAAAFjxYXxZoe1OtQ_enter_path[] = {
+  &AAAAAAFjxYS5VYdXRQM,
+  NULL,
+};
+static struct ufsm_transition AAAAAAFjxYXxZoe1OtQ = {
+  .id = "AAAAAAFjxYXxZoe1OtQ=",
+  .name = "",
+  .trigger = AAAAAAFjxYXxZoe1OtQ_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 2,
+  .action = &AAAAAAFjxYeOt4gozb4,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjxYR8hIcOjBY,
+  .dest = &AAAAAAFjxYlY1Yh0QoA,
+  .lca = &AAAAAAFjxYRqw4cIX0Q,
+  .exit_path = AAAAAAFjxYXxZoe1OtQ_exit_path,
+  .enter_path = AAAAAAFjxYXxZoe1OtQ_enter_path,
+  .next = &AAAAAAFjxYcf6ogIBrc,
+};
+static struct ufsm_action AAAAAAFjxYeOt4gozb4 = {
+  .id = "AAAAAAFjxYeOt4gozb4=",
+  .name = "t0",
+  .f = &t0,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjxYcf6ogIBrc_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjxYcf6ogIBrc = {
+  .id = "AAAAAAFjxYcf6ogIBrc=",
+  .name = "",
+  .trigger = AAAAAAFjxYcf6ogIBrc_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjxYZJBYfMb0M,
+  .dest = &AAAAAAFjxYR8hIcOjBY,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjxYZJBYfMb0M_dispatch_0[] = {
+  &AAAAAAFjxYcf6ogIBrc,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjxYZJBYfMb0M_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjxYZJBYfMb0M_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjxYZJBYfMb0M_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjxYZJBYfMb0M_flat_dispatch_0[] = {
+  &AAAAAAFjxYcf6ogIBrc,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjxYZJBYfMb0M_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjxYZJBYfMb0M_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjxYZJBYfMb0M = {
+  .id   = "AAAAAAFjxYZJBYfMb0M=",
+  .name = "C",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjxYRqw4cIX0Q,
+  .entry = &AAAAAAFjxYdBkogcACE,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjxYZJBYfMb0M_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjxYZJBYfMb0M_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjxYZJBYfMb0M_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjxYTTZIdfUTY,
+};
+static struct ufsm_entry_exit AAAAAAFjxYdBkogcACE = {
+  .id = "AAAAAAFjxYdBkogcACE=",
+  .name = "eC",
+  .f = &eC,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjxYTTZIdfUTY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjxYTTZIdfUTY_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjxYTTZIdfUTY = {
+  .id   = "AAAAAAFjxYTTZIdfUTY=",
+  .name = "B",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFjxYRqw4cIX0Q,
+  .entry = &AAAAAAFjxjAHJYk0xXk,
+  .doact = NULL,
+  .exit = &AAAAAAFjxjCK_Yk7_B4,
+  .region = &AAAAAAFjxYS5VYdXRQM,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjxYTTZIdfUTY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjxYTTZIdfUTY_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjxYR8hIcOjBY,
+};
+static struct ufsm_entry_exit AAAAAAFjxjAHJYk0xXk = {
+  .id = "AAAAAAFjxjAHJYk0xXk=",
+  .name = "eB",
+  .f = &eB,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjxjCK_Yk7_B4 = {
+  .id = "AAAAAAFjxjCK+Yk7+B4=",
+  .name = "xB",
+  .f = &xB,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjxYR8hIcOjBY_dispatch_0[] = {
+  &AAAAAAFjxYXxZoe1OtQ,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjxYR8hIcOjBY_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjxYR8hIcOjBY_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjxYR8hIcOjBY_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjxYR8hIcOjBY_flat_dispatch_0[] = {
+  &AAAAAAFjxYXxZoe1OtQ,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjxYR8hIcOjBY_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjxYR8hIcOjBY_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjxYR8hIcOjBY = {
+  .id   = "AAAAAAFjxYR8hIcOjBY=",
+  .name = "A",
+  .kind = 0,
+  .index = 3,
+  .parent_region = &AAAAAAFjxYRqw4cIX0Q,
+  .entry = &AAAAAAFjxYepG4grJHQ,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjxYR8hIcOjBY_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjxYR8hIcOjBY_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjxYR8hIcOjBY_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjxYSMCYc0mcg,
+};
+static struct ufsm_entry_exit AAAAAAFjxYepG4grJHQ = {
+  .id = "AAAAAAFjxYepG4grJHQ=",
+  .name = "eA",
+  .f = &eA,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjxYSMCYc0mcg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjxYSMCYc0mcg_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjxYSMCYc0mcg = {
+  .id   = "AAAAAAFjxYSMCYc0mcg=",
+  .name = "Init",
+  .kind = 1,
+  .index = 4,
+  .parent_region = &AAAAAAFjxYRqw4cIX0Q,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjxYSMCYc0mcg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjxYSMCYc0mcg_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjxYSMjIdFpJY,
+  .next = NULL,
+};
+static void *AAAAAAFjxYS5VYdWqfQ_stack[10];
+static void *AAAAAAFjxYS5VYdWqfQ_stack2[1];
+static void *AAAAAAFjxYS5VYdWqfQ_completion_stack[1];
+static uint32_t AAAAAAFjxYS5VYdWqfQ_data[UFSM_MACHINE_DATA_SIZE(8)];
+static struct ufsm_event AAAAAAFjxYS5VYdWqfQ_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjxYS5VYdWqfQ = {
+  .id     = "AAAAAAFjxYS5VYdWqfQ=", 
+  .name   = "StateMachine2", 
+  .region = &AAAAAAFjxYS5VYdXRQM,    
+  .no_of_regions = 2,
+  .no_of_states = 8,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 1,
+  .no_of_transitions = 7,
+  .context = {
+    .m = &AAAAAAFjxYS5VYdWqfQ,
+    .stack = {
+      .no_of_elements = 10,
+      .data = AAAAAAFjxYS5VYdWqfQ_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjxYS5VYdWqfQ_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjxYS5VYdWqfQ_completion_stack,
+    },
+  },
+  .data = AAAAAAFjxYS5VYdWqfQ_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjxYS5VYdWqfQ_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjxYS5VYdXRQM = {
+  .id = "AAAAAAFjxYS5VYdXRQM=",
+  .name = "StateMachine2region0",
+  .state = &AAAAAAFjxYfa6Igy7Vk,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFjxYZj04fyI74,
+  .parent_state = &AAAAAAFjxYTTZIdfUTY,
+  .next = NULL,
+};
+static struct ufsm_region * AAAAAAFjxYZj04fyI74_exit_path[] = {
+  &AAAAAAFjxYS5VYdXRQM,
+  NULL,
+};
+static struct ufsm_region * AAAAAAFjxYZj04fyI74_enter_path[] = {
+  &AAAAAAFjxYRqw4cIX0Q,
+  NULL,
+};
+static struct ufsm_transition AAAAAAFjxYZj04fyI74 = {
+  .id = "AAAAAAFjxYZj04fyI74=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 4,
+  .action = &AAAAAAFjxYdmLogkiQ4,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjxYm_ZIiapOo,
+  .dest = &AAAAAAFjxYZJBYfMb0M,
+  .lca = &AAAAAAFjxYRqw4cIX0Q,
+  .exit_path = AAAAAAFjxYZj04fyI74_exit_path,
+  .enter_path = AAAAAAFjxYZj04fyI74_enter_path,
+  .next = &AAAAAAFjxYl_BoiG8Qs,
+};
+static struct ufsm_action AAAAAAFjxYdmLogkiQ4 = {
+  .id = "AAAAAAFjxYdmLogkiQ4=",
+  .name = "t1",
+  .f = &t1,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjxYl_BoiG8Qs = {
+  .id = "AAAAAAFjxYl/BoiG8Qs=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 5,
+  .action = &AAAAAAFjxYmXKYiYHWI,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjxYlY1Yh0QoA,
+  .dest = &AAAAAAFjxYfa6Igy7Vk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjxYnZBoisRnc,
+};
+static struct ufsm_action AAAAAAFjxYmXKYiYHWI = {
+  .id = "AAAAAAFjxYmXKYiYHWI=",
+  .name = "t3",
+  .f = &t3,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjxYnZBoisRnc_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjxYnZBoisRnc = {
+  .id = "AAAAAAFjxYnZBoisRnc=",
+  .name = "",
+  .trigger = AAAAAAFjxYnZBoisRnc_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 6,
+  .action = &AAAAAAFjxYntnYi_8dM,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjxYfa6Igy7Vk,
+  .dest = &AAAAAAFjxYm_ZIiapOo,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjxYop5ojU_KA,
+};
+static struct ufsm_action AAAAAAFjxYntnYi_8dM = {
+  .id = "AAAAAAFjxYntnYi+8dM=",
+  .name = "t4",
+  .f = &t4,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjxYop5ojU_KA = {
+  .id = "AAAAAAFjxYop5ojU/KA=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 7,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjxYopMojDEfw,
+  .dest = &AAAAAAFjxYfa6Igy7Vk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjxYfa6Igy7Vk_dispatch_0[] = {
+  &AAAAAAFjxYnZBoisRnc,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjxYfa6Igy7Vk_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjxYfa6Igy7Vk_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjxYfa6Igy7Vk_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjxYfa6Igy7Vk_flat_dispatch_0[] = {
+  &AAAAAAFjxYnZBoisRnc,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjxYfa6Igy7Vk_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjxYfa6Igy7Vk_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjxYfa6Igy7Vk = {
+  .id   = "AAAAAAFjxYfa6Igy7Vk=",
+  .name = "SA",
+  .kind = 0,
+  .index = 5,
+  .parent_region = &AAAAAAFjxYS5VYdXRQM,
+  .entry = &AAAAAAFjxjDTSolCYbw,
+  .doact = NULL,
+  .exit = &AAAAAAFjxjDpdYlJM4s,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjxYfa6Igy7Vk_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjxYfa6Igy7Vk_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjxYfa6Igy7Vk_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjxYopMojDEfw,
+};
+static struct ufsm_entry_exit AAAAAAFjxjDTSolCYbw = {
+  .id = "AAAAAAFjxjDTSolCYbw=",
+  .name = "eSA",
+  .f = &eSA,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjxjDpdYlJM4s = {
+  .id = "AAAAAAFjxjDpdYlJM4s=",
+  .name = "xSA",
+  .f = &xSA,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjxYopMojDEfw_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjxYopMojDEfw_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjxYopMojDEfw = {
+  .id   = "AAAAAAFjxYopMojDEfw=",
+  .name = "Init",
+  .kind = 1,
+  .index = 6,
+  .parent_region = &AAAAAAFjxYS5VYdXRQM,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjxYopMojDEfw_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjxYopMojDEfw_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjxYop5ojU_KA,
+  .next = &AAAAAAFjxYm_ZIiapOo,
+};
+static struct ufsm_dispatch AAAAAAFjxYm_ZIiapOo_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjxYm_ZIiapOo_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjxYm_ZIiapOo = {
+  .id   = "AAAAAAFjxYm+ZIiapOo=",
+  .name = "OUT",
+  .kind = 5,
+  .index = 7,
+  .parent_region = &AAAAAAFjxYS5VYdXRQM,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjxYm_ZIiapOo_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjxYm_ZIiapOo_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjxYZj04fyI74,
+  .next = &AAAAAAFjxYlY1Yh0QoA,
+};
+static struct ufsm_dispatch AAAAAAFjxYlY1Yh0QoA_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjxYlY1Yh0QoA_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjxYlY1Yh0QoA = {
+  .id   = "AAAAAAFjxYlY1Yh0QoA=",
+  .name = "IN",
+  .kind = 6,
+  .index = 8,
+  .parent_region = &AAAAAAFjxYS5VYdXRQM,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjxYlY1Yh0QoA_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjxYlY1Yh0QoA_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjxYl_BoiG8Qs,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFjxYRqw4cH_1M; }
+struct ufsm_machine * get_StateMachine2(void) { return &AAAAAAFjxYS5VYdWqfQ; }
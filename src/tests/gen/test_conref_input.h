@@ -0,0 +1,34 @@
+#ifndef UFSM_GEN_test_conref_input_H__
+#define UFSM_GEN_test_conref_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 2, active regions 2, completion states 0, stacks 14/2/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 17
+/* StateMachine2: depth 1, active regions 1, completion states 0, stacks 10/1/1, queues 16/0 */
+#define StateMachine2_CONTEXT_DATA_SIZE 12
+void eC(void);
+void eB(void);
+void xB(void);
+void eA(void);
+void eSA(void);
+void xSA(void);
+void t0(void);
+void t1(void);
+void t3(void);
+void t4(void);
+enum {
+  EV1,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(2, 8)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 7, 8, 1)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(8)
+struct ufsm_machine * get_StateMachine1(void);
+#define StateMachine2_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(2, 8)
+#define StateMachine2_NO_OF_TIMERS 0
+#define StateMachine2_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 7, 8, 1)
+#define StateMachine2_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(8)
+struct ufsm_machine * get_StateMachine2(void);
+#endif
@@ -0,0 +1,19 @@
+#ifndef UFSM_GEN_test_defer_input_H__
+#define UFSM_GEN_test_defer_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 2, active regions 2, completion states 0, stacks 8/2/1, queues 16/16 */
+#define StateMachine1_CONTEXT_DATA_SIZE 11
+void final(void);
+enum {
+  EV_D,
+  EV,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(2, 6)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 6, 6, 2)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(6)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
@@ -0,0 +1,303 @@
+#include "gen/test_do_input.h"
+static struct ufsm_machine AAAAAAFjy7_FJY0kKh8;
+static struct ufsm_region AAAAAAFjy7_FJo0lkWM;
+static struct ufsm_transition AAAAAAFjy8AqzY13yCY;
+static struct ufsm_transition AAAAAAFjzEXaD42uNpg;
+static struct ufsm_action AAAAAAFjzEXmBo3Atuk;
+static struct ufsm_transition AAAAAAFjzEb74o3pJ2c;
+static struct ufsm_state AAAAAAFjzEbnL43DlLY;
+static struct ufsm_state AAAAAAFjy7_ZDo0reHg;
+static struct ufsm_entry_exit AAAAAAFjy7_ssI1RuOM;
+static struct ufsm_doact AAAAAAFjy7__q41YmXc;
+static struct ufsm_entry_exit AAAAAAFjy8ASyY1f3qw;
+static struct ufsm_state AAAAAAFjy8A7RY2ICY8;
+static struct ufsm_state AAAAAAFjy8AqOI1m7_A;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjzEbnL43DlLY,
+  &AAAAAAFjy7_ZDo0reHg,
+  &AAAAAAFjy8A7RY2ICY8,
+  &AAAAAAFjy8AqOI1m7_A,
+};
+
+
+
+static void *AAAAAAFjy7_FJY0kKh8_stack[8];
+static void *AAAAAAFjy7_FJY0kKh8_stack2[1];
+static void *AAAAAAFjy7_FJY0kKh8_completion_stack[1];
+static uint32_t AAAAAAFjy7_FJY0kKh8_data[UFSM_MACHINE_DATA_SIZE(4)];
+static struct ufsm_event AAAAAAFjy7_FJY0kKh8_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjy7_FJY0kKh8 = {
+  .id     = "AAAAAAFjy7/FJY0kKh8=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFjy7_FJo0lkWM,    
+  .no_of_regions = 1,
+  .no_of_states = 4,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 1,
+  .no_of_transitions = 3,
+  .context = {
+    .m = &AAAAAAFjy7_FJY0kKh8,
+    .stack = {
+      .no_of_elements = 8,
+      .data = AAAAAAFjy7_FJY0kKh8_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjy7_FJY0kKh8_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjy7_FJY0kKh8_completion_stack,
+    },
+  },
+  .data = AAAAAAFjy7_FJY0kKh8_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjy7_FJY0kKh8_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjy7_FJo0lkWM = {
+  .id = "AAAAAAFjy7/FJo0lkWM=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFjzEbnL43DlLY,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjy8AqzY13yCY,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjy8AqzY13yCY = {
+  .id = "AAAAAAFjy8AqzY13yCY=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjy8AqOI1m7_A,
+  .dest = &AAAAAAFjy7_ZDo0reHg,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjzEXaD42uNpg,
+};
+static struct ufsm_transition AAAAAAFjzEXaD42uNpg = {
+  .id = "AAAAAAFjzEXaD42uNpg=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 2,
+  .action = &AAAAAAFjzEXmBo3Atuk,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjy7_ZDo0reHg,
+  .dest = &AAAAAAFjy8A7RY2ICY8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjzEb74o3pJ2c,
+};
+static struct ufsm_action AAAAAAFjzEXmBo3Atuk = {
+  .id = "AAAAAAFjzEXmBo3Atuk=",
+  .name = "final",
+  .f = &final,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjzEb74o3pJ2c_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjzEb74o3pJ2c = {
+  .id = "AAAAAAFjzEb74o3pJ2c=",
+  .name = "",
+  .trigger = AAAAAAFjzEb74o3pJ2c_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjy7_ZDo0reHg,
+  .dest = &AAAAAAFjzEbnL43DlLY,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjzEbnL43DlLY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjzEbnL43DlLY_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjzEbnL43DlLY = {
+  .id   = "AAAAAAFjzEbnL43DlLY=",
+  .name = "B",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjy7_FJo0lkWM,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjzEbnL43DlLY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjzEbnL43DlLY_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjy7_ZDo0reHg,
+};
+static struct ufsm_transition * AAAAAAFjy7_ZDo0reHg_dispatch_0[] = {
+  &AAAAAAFjzEb74o3pJ2c,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjy7_ZDo0reHg_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjy7_ZDo0reHg_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjy7_ZDo0reHg_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjy7_ZDo0reHg_flat_dispatch_0[] = {
+  &AAAAAAFjzEb74o3pJ2c,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjy7_ZDo0reHg_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjy7_ZDo0reHg_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjy7_ZDo0reHg = {
+  .id   = "AAAAAAFjy7/ZDo0reHg=",
+  .name = "A",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFjy7_FJo0lkWM,
+  .entry = &AAAAAAFjy7_ssI1RuOM,
+  .doact = &AAAAAAFjy7__q41YmXc,
+  .exit = &AAAAAAFjy8ASyY1f3qw,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjy7_ZDo0reHg_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjy7_ZDo0reHg_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjy7_ZDo0reHg_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFjzEXaD42uNpg,
+  .next = &AAAAAAFjy8A7RY2ICY8,
+};
+static struct ufsm_entry_exit AAAAAAFjy7_ssI1RuOM = {
+  .id = "AAAAAAFjy7/ssI1RuOM=",
+  .name = "eA",
+  .f = &eA,
+  .next = NULL,
+};
+static struct ufsm_doact AAAAAAFjy7__q41YmXc = {
+  .id = "AAAAAAFjy7//q41YmXc=",
+  .name = "dA",
+  .f_start = &dA_start,
+  .f_stop = &dA_stop,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjy8ASyY1f3qw = {
+  .id = "AAAAAAFjy8ASyY1f3qw=",
+  .name = "xA",
+  .f = &xA,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjy8A7RY2ICY8_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjy8A7RY2ICY8_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjy8A7RY2ICY8 = {
+  .id   = "AAAAAAFjy8A7RY2ICY8=",
+  .name = "Final",
+  .kind = 2,
+  .index = 3,
+  .parent_region = &AAAAAAFjy7_FJo0lkWM,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjy8A7RY2ICY8_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjy8A7RY2ICY8_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjy8AqOI1m7_A,
+};
+static struct ufsm_dispatch AAAAAAFjy8AqOI1m7_A_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjy8AqOI1m7_A_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjy8AqOI1m7_A = {
+  .id   = "AAAAAAFjy8AqOI1m7+A=",
+  .name = "Init",
+  .kind = 1,
+  .index = 4,
+  .parent_region = &AAAAAAFjy7_FJo0lkWM,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjy8AqOI1m7_A_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjy8AqOI1m7_A_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjy8AqzY13yCY,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFjy7_FJY0kKh8; }
@@ -0,0 +1,22 @@
+#ifndef UFSM_GEN_test_do_input_H__
+#define UFSM_GEN_test_do_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 1, active regions 1, completion states 1, stacks 8/1/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 10
+void eA(void);
+void xA(void);
+void dA_start(struct ufsm_context *c, struct ufsm_state *s, ufsm_doact_cb_t cb);
+void dA_stop(void);
+void final(void);
+enum {
+  EV,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(1, 4)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 3, 4, 1)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(4)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
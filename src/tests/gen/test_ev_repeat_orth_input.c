@@ -0,0 +1,472 @@
+#include "gen/test_ev_repeat_orth_input.h"
+static struct ufsm_machine AAAAAAFpJl371bH1isc;
+static struct ufsm_region AAAAAAFpJl371bH2Grk;
+static struct ufsm_transition AAAAAAFpJl_YRbLg5iU;
+static struct ufsm_state AAAAAAFpJl4kdrH85mk;
+static struct ufsm_region AAAAAAFpJl5WqrIneO8;
+static struct ufsm_transition AAAAAAFpJl9uFLKaVOw;
+static struct ufsm_transition AAAAAAFpJmDZhrOwk9k;
+static struct ufsm_transition AAAAAAFpJmDxALPEovk;
+static struct ufsm_state AAAAAAFpJl_RF7MY4lI;
+static struct ufsm_entry_exit AAAAAAFpJmAr5rNNi6g;
+static struct ufsm_entry_exit AAAAAAFpJmGzurPnlS8;
+static struct ufsm_state AAAAAAFpJl_wX7LxU8g;
+static struct ufsm_entry_exit AAAAAAFpJmAUR7NGEeI;
+static struct ufsm_entry_exit AAAAAAFpJmGcwLPgT5c;
+static struct ufsm_state AAAAAAFpJl7_drJchpM;
+static struct ufsm_entry_exit AAAAAAFpJl_6ubM_bKU;
+static struct ufsm_entry_exit AAAAAAFpJmE8tLPZoLs;
+static struct ufsm_state AAAAAAFpJl9txbKJ0Cc;
+static struct ufsm_region AAAAAAFpJl43vLIh4PE;
+static struct ufsm_transition AAAAAAFpJl_Bg7K9VQ8;
+static struct ufsm_state AAAAAAFpJl7kzbI2LP0;
+static struct ufsm_entry_exit AAAAAAFpJmfmv7PutK4;
+static struct ufsm_state AAAAAAFpJl_BOLKsFFg;
+static struct ufsm_state AAAAAAFpJl_X9bLP8kw;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFpJl4kdrH85mk,
+  &AAAAAAFpJl_X9bLP8kw,
+  &AAAAAAFpJl_RF7MY4lI,
+  &AAAAAAFpJl_wX7LxU8g,
+  &AAAAAAFpJl7_drJchpM,
+  &AAAAAAFpJl9txbKJ0Cc,
+  &AAAAAAFpJl7kzbI2LP0,
+  &AAAAAAFpJl_BOLKsFFg,
+};
+
+
+
+static void *AAAAAAFpJl371bH1isc_stack[14];
+static void *AAAAAAFpJl371bH1isc_stack2[3];
+static void *AAAAAAFpJl371bH1isc_completion_stack[1];
+static uint32_t AAAAAAFpJl371bH1isc_data[UFSM_MACHINE_DATA_SIZE(8)];
+static struct ufsm_event AAAAAAFpJl371bH1isc_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFpJl371bH1isc = {
+  .id     = "AAAAAAFpJl371bH1isc=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFpJl371bH2Grk,    
+  .no_of_regions = 3,
+  .no_of_states = 8,
+  .states = ufsm_states,
+  .flat = false,
+  .no_of_events = 1,
+  .no_of_transitions = 5,
+  .context = {
+    .m = &AAAAAAFpJl371bH1isc,
+    .stack = {
+      .no_of_elements = 14,
+      .data = AAAAAAFpJl371bH1isc_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 3,
+      .data = AAAAAAFpJl371bH1isc_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFpJl371bH1isc_completion_stack,
+    },
+  },
+  .data = AAAAAAFpJl371bH1isc_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFpJl371bH1isc_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFpJl371bH2Grk = {
+  .id = "AAAAAAFpJl371bH2Grk=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFpJl4kdrH85mk,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFpJl_YRbLg5iU,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpJl_YRbLg5iU = {
+  .id = "AAAAAAFpJl+YRbLg5iU=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpJl_X9bLP8kw,
+  .dest = &AAAAAAFpJl4kdrH85mk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpJl4kdrH85mk_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpJl4kdrH85mk = {
+  .id   = "AAAAAAFpJl4kdrH85mk=",
+  .name = "State1",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFpJl371bH2Grk,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFpJl5WqrIneO8,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpJl4kdrH85mk_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpJl_X9bLP8kw,
+};
+static struct ufsm_region AAAAAAFpJl5WqrIneO8 = {
+  .id = "AAAAAAFpJl5WqrIneO8=",
+  .name = "Region2",
+  .state = &AAAAAAFpJl_RF7MY4lI,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFpJl9uFLKaVOw,
+  .parent_state = &AAAAAAFpJl4kdrH85mk,
+  .next = &AAAAAAFpJl43vLIh4PE,
+};
+static struct ufsm_transition AAAAAAFpJl9uFLKaVOw = {
+  .id = "AAAAAAFpJl9uFLKaVOw=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpJl9txbKJ0Cc,
+  .dest = &AAAAAAFpJl7_drJchpM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpJmDZhrOwk9k,
+};
+static struct ufsm_trigger AAAAAAFpJmDZhrOwk9k_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpJmDZhrOwk9k = {
+  .id = "AAAAAAFpJmDZhrOwk9k=",
+  .name = "",
+  .trigger = AAAAAAFpJmDZhrOwk9k_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpJl7_drJchpM,
+  .dest = &AAAAAAFpJl_wX7LxU8g,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpJmDxALPEovk,
+};
+static struct ufsm_trigger AAAAAAFpJmDxALPEovk_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpJmDxALPEovk = {
+  .id = "AAAAAAFpJmDxALPEovk=",
+  .name = "",
+  .trigger = AAAAAAFpJmDxALPEovk_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpJl_wX7LxU8g,
+  .dest = &AAAAAAFpJl_RF7MY4lI,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpJl_RF7MY4lI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpJl_RF7MY4lI = {
+  .id   = "AAAAAAFpJl/RF7MY4lI=",
+  .name = "B3",
+  .kind = 0,
+  .index = 3,
+  .parent_region = &AAAAAAFpJl5WqrIneO8,
+  .entry = &AAAAAAFpJmAr5rNNi6g,
+  .doact = NULL,
+  .exit = &AAAAAAFpJmGzurPnlS8,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpJl_RF7MY4lI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpJl_wX7LxU8g,
+};
+static struct ufsm_entry_exit AAAAAAFpJmAr5rNNi6g = {
+  .id = "AAAAAAFpJmAr5rNNi6g=",
+  .name = "eB3",
+  .f = &eB3,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpJmGzurPnlS8 = {
+  .id = "AAAAAAFpJmGzurPnlS8=",
+  .name = "xB3",
+  .f = &xB3,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpJl_wX7LxU8g_dispatch_0[] = {
+  &AAAAAAFpJmDxALPEovk,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpJl_wX7LxU8g_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFpJl_wX7LxU8g_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpJl_wX7LxU8g_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpJl_wX7LxU8g = {
+  .id   = "AAAAAAFpJl+wX7LxU8g=",
+  .name = "B2",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &AAAAAAFpJl5WqrIneO8,
+  .entry = &AAAAAAFpJmAUR7NGEeI,
+  .doact = NULL,
+  .exit = &AAAAAAFpJmGcwLPgT5c,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpJl_wX7LxU8g_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpJl_wX7LxU8g_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpJl7_drJchpM,
+};
+static struct ufsm_entry_exit AAAAAAFpJmAUR7NGEeI = {
+  .id = "AAAAAAFpJmAUR7NGEeI=",
+  .name = "eB2",
+  .f = &eB2,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpJmGcwLPgT5c = {
+  .id = "AAAAAAFpJmGcwLPgT5c=",
+  .name = "xB2",
+  .f = &xB2,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpJl7_drJchpM_dispatch_0[] = {
+  &AAAAAAFpJmDZhrOwk9k,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpJl7_drJchpM_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFpJl7_drJchpM_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpJl7_drJchpM_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpJl7_drJchpM = {
+  .id   = "AAAAAAFpJl7/drJchpM=",
+  .name = "B1",
+  .kind = 0,
+  .index = 5,
+  .parent_region = &AAAAAAFpJl5WqrIneO8,
+  .entry = &AAAAAAFpJl_6ubM_bKU,
+  .doact = NULL,
+  .exit = &AAAAAAFpJmE8tLPZoLs,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpJl7_drJchpM_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpJl7_drJchpM_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpJl9txbKJ0Cc,
+};
+static struct ufsm_entry_exit AAAAAAFpJl_6ubM_bKU = {
+  .id = "AAAAAAFpJl/6ubM/bKU=",
+  .name = "eB1",
+  .f = &eB1,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpJmE8tLPZoLs = {
+  .id = "AAAAAAFpJmE8tLPZoLs=",
+  .name = "xB1",
+  .f = &xB1,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpJl9txbKJ0Cc_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpJl9txbKJ0Cc = {
+  .id   = "AAAAAAFpJl9txbKJ0Cc=",
+  .name = "Init",
+  .kind = 1,
+  .index = 6,
+  .parent_region = &AAAAAAFpJl5WqrIneO8,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpJl9txbKJ0Cc_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpJl9uFLKaVOw,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFpJl43vLIh4PE = {
+  .id = "AAAAAAFpJl43vLIh4PE=",
+  .name = "Region1",
+  .state = &AAAAAAFpJl7kzbI2LP0,
+  .has_history = false,
+  .history = NULL,
+  .index = 2,
+  .transition = &AAAAAAFpJl_Bg7K9VQ8,
+  .parent_state = &AAAAAAFpJl4kdrH85mk,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpJl_Bg7K9VQ8 = {
+  .id = "AAAAAAFpJl+Bg7K9VQ8=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpJl_BOLKsFFg,
+  .dest = &AAAAAAFpJl7kzbI2LP0,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpJl7kzbI2LP0_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpJl7kzbI2LP0 = {
+  .id   = "AAAAAAFpJl7kzbI2LP0=",
+  .name = "A1",
+  .kind = 0,
+  .index = 7,
+  .parent_region = &AAAAAAFpJl43vLIh4PE,
+  .entry = &AAAAAAFpJmfmv7PutK4,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpJl7kzbI2LP0_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpJl_BOLKsFFg,
+};
+static struct ufsm_entry_exit AAAAAAFpJmfmv7PutK4 = {
+  .id = "AAAAAAFpJmfmv7PutK4=",
+  .name = "eA1",
+  .f = &eA1,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpJl_BOLKsFFg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpJl_BOLKsFFg = {
+  .id   = "AAAAAAFpJl+BOLKsFFg=",
+  .name = "Init",
+  .kind = 1,
+  .index = 8,
+  .parent_region = &AAAAAAFpJl43vLIh4PE,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpJl_BOLKsFFg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpJl_Bg7K9VQ8,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpJl_X9bLP8kw_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpJl_X9bLP8kw = {
+  .id   = "AAAAAAFpJl+X9bLP8kw=",
+  .name = "Init",
+  .kind = 1,
+  .index = 2,
+  .parent_region = &AAAAAAFpJl371bH2Grk,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpJl_X9bLP8kw_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpJl_YRbLg5iU,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFpJl371bH1isc; }
@@ -0,0 +1,24 @@
+#ifndef UFSM_GEN_test_ev_repeat_orth_input_H__
+#define UFSM_GEN_test_ev_repeat_orth_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 2, active regions 3, completion states 0, stacks 14/3/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 18
+void eB3(void);
+void xB3(void);
+void eB2(void);
+void xB2(void);
+void eB1(void);
+void xB1(void);
+void eA1(void);
+enum {
+  EV,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(3, 8)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 5, 8, 1)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(8)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
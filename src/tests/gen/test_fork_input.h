@@ -0,0 +1,26 @@
+#ifndef UFSM_GEN_test_fork_input_H__
+#define UFSM_GEN_test_fork_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 2, active regions 3, completion states 1, stacks 20/3/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 24
+void eB2(void);
+void xB2(void);
+void eA2(void);
+void xA2(void);
+void eAB(void);
+void xAB(void);
+bool gA(void);
+bool g2(void);
+void finalC(void);
+enum {
+  EV,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(3, 14)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 13, 14, 1)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(14)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
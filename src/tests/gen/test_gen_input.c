@@ -0,0 +1,45972 @@
+#include "gen/test_gen_input.h"
+static struct ufsm_machine machine;
+static struct ufsm_region r0;
+static struct ufsm_transition t0;
+static struct ufsm_action t0effect;
+static struct ufsm_transition t73;
+static struct ufsm_action t73effect;
+static struct ufsm_transition t74;
+static struct ufsm_action t74effect;
+static struct ufsm_guard t74guard;
+static struct ufsm_transition t75;
+static struct ufsm_action t75effect;
+static struct ufsm_guard t75guard;
+static struct ufsm_transition t76;
+static struct ufsm_action t76effect;
+static struct ufsm_transition t77;
+static struct ufsm_action t77effect;
+static struct ufsm_guard t77guard;
+static struct ufsm_transition t78;
+static struct ufsm_action t78effect;
+static struct ufsm_transition t79;
+static struct ufsm_action t79effect;
+static struct ufsm_transition t80;
+static struct ufsm_action t80effect;
+static struct ufsm_guard t80guard;
+static struct ufsm_transition t683;
+static struct ufsm_action t683effect;
+static struct ufsm_transition t684;
+static struct ufsm_action t684effect;
+static struct ufsm_transition t685;
+static struct ufsm_action t685effect;
+static struct ufsm_transition t688;
+static struct ufsm_action t688effect;
+static struct ufsm_transition t704;
+static struct ufsm_action t704effect;
+static struct ufsm_state s4;
+static struct ufsm_region r8;
+static struct ufsm_transition t8;
+static struct ufsm_action t8effect;
+static struct ufsm_transition t137;
+static struct ufsm_action t137effect;
+static struct ufsm_guard t137guard;
+static struct ufsm_transition t138;
+static struct ufsm_action t138effect;
+static struct ufsm_guard t138guard;
+static struct ufsm_transition t139;
+static struct ufsm_action t139effect;
+static struct ufsm_transition t140;
+static struct ufsm_action t140effect;
+static struct ufsm_transition t141;
+static struct ufsm_action t141effect;
+static struct ufsm_transition t142;
+static struct ufsm_action t142effect;
+static struct ufsm_transition t143;
+static struct ufsm_action t143effect;
+static struct ufsm_guard t143guard;
+static struct ufsm_transition t144;
+static struct ufsm_action t144effect;
+static struct ufsm_transition t687;
+static struct ufsm_action t687effect;
+static struct ufsm_transition t708;
+static struct ufsm_action t708effect;
+static struct ufsm_state s44;
+static struct ufsm_region r72;
+static struct ufsm_transition t72;
+static struct ufsm_action t72effect;
+static struct ufsm_transition t649;
+static struct ufsm_action t649effect;
+static struct ufsm_transition t650;
+static struct ufsm_action t650effect;
+static struct ufsm_guard t650guard;
+static struct ufsm_transition t651;
+static struct ufsm_action t651effect;
+static struct ufsm_guard t651guard;
+static struct ufsm_transition t652;
+static struct ufsm_action t652effect;
+static struct ufsm_transition t653;
+static struct ufsm_action t653effect;
+static struct ufsm_guard t653guard;
+static struct ufsm_transition t654;
+static struct ufsm_action t654effect;
+static struct ufsm_transition t655;
+static struct ufsm_action t655effect;
+static struct ufsm_transition t656;
+static struct ufsm_action t656effect;
+static struct ufsm_guard t656guard;
+static struct ufsm_state s364;
+static struct ufsm_entry_exit s364entry;
+static struct ufsm_entry_exit s364exit;
+static struct ufsm_state s363;
+static struct ufsm_entry_exit s363entry;
+static struct ufsm_entry_exit s363exit;
+static struct ufsm_state s362;
+static struct ufsm_entry_exit s362entry;
+static struct ufsm_entry_exit s362exit;
+static struct ufsm_state s361;
+static struct ufsm_entry_exit s361entry;
+static struct ufsm_entry_exit s361exit;
+static struct ufsm_state s360;
+static struct ufsm_region r71;
+static struct ufsm_transition t71;
+static struct ufsm_action t71effect;
+static struct ufsm_transition t641;
+static struct ufsm_action t641effect;
+static struct ufsm_transition t642;
+static struct ufsm_action t642effect;
+static struct ufsm_guard t642guard;
+static struct ufsm_transition t643;
+static struct ufsm_action t643effect;
+static struct ufsm_transition t644;
+static struct ufsm_action t644effect;
+static struct ufsm_guard t644guard;
+static struct ufsm_transition t645;
+static struct ufsm_action t645effect;
+static struct ufsm_transition t646;
+static struct ufsm_action t646effect;
+static struct ufsm_guard t646guard;
+static struct ufsm_transition t647;
+static struct ufsm_action t647effect;
+static struct ufsm_transition t648;
+static struct ufsm_action t648effect;
+static struct ufsm_state s359;
+static struct ufsm_entry_exit s359entry;
+static struct ufsm_entry_exit s359exit;
+static struct ufsm_state s358;
+static struct ufsm_entry_exit s358entry;
+static struct ufsm_entry_exit s358exit;
+static struct ufsm_state s357;
+static struct ufsm_entry_exit s357entry;
+static struct ufsm_entry_exit s357exit;
+static struct ufsm_state s356;
+static struct ufsm_entry_exit s356entry;
+static struct ufsm_entry_exit s356exit;
+static struct ufsm_state s355;
+static struct ufsm_entry_exit s44entry;
+static struct ufsm_entry_exit s44exit;
+static struct ufsm_state s43;
+static struct ufsm_region r70;
+static struct ufsm_transition t70;
+static struct ufsm_action t70effect;
+static struct ufsm_transition t633;
+static struct ufsm_action t633effect;
+static struct ufsm_transition t634;
+static struct ufsm_action t634effect;
+static struct ufsm_guard t634guard;
+static struct ufsm_transition t635;
+static struct ufsm_action t635effect;
+static struct ufsm_transition t636;
+static struct ufsm_action t636effect;
+static struct ufsm_transition t637;
+static struct ufsm_action t637effect;
+static struct ufsm_transition t638;
+static struct ufsm_action t638effect;
+static struct ufsm_transition t639;
+static struct ufsm_action t639effect;
+static struct ufsm_transition t640;
+static struct ufsm_action t640effect;
+static struct ufsm_state s354;
+static struct ufsm_entry_exit s354entry;
+static struct ufsm_entry_exit s354exit;
+static struct ufsm_state s353;
+static struct ufsm_entry_exit s353entry;
+static struct ufsm_entry_exit s353exit;
+static struct ufsm_state s352;
+static struct ufsm_entry_exit s352entry;
+static struct ufsm_entry_exit s352exit;
+static struct ufsm_state s351;
+static struct ufsm_entry_exit s351entry;
+static struct ufsm_entry_exit s351exit;
+static struct ufsm_state s350;
+static struct ufsm_region r69;
+static struct ufsm_transition t69;
+static struct ufsm_action t69effect;
+static struct ufsm_transition t625;
+static struct ufsm_action t625effect;
+static struct ufsm_transition t626;
+static struct ufsm_action t626effect;
+static struct ufsm_transition t627;
+static struct ufsm_action t627effect;
+static struct ufsm_guard t627guard;
+static struct ufsm_transition t628;
+static struct ufsm_action t628effect;
+static struct ufsm_guard t628guard;
+static struct ufsm_transition t629;
+static struct ufsm_action t629effect;
+static struct ufsm_guard t629guard;
+static struct ufsm_transition t630;
+static struct ufsm_action t630effect;
+static struct ufsm_transition t631;
+static struct ufsm_action t631effect;
+static struct ufsm_transition t632;
+static struct ufsm_action t632effect;
+static struct ufsm_guard t632guard;
+static struct ufsm_transition t707;
+static struct ufsm_action t707effect;
+static struct ufsm_state s349;
+static struct ufsm_entry_exit s349entry;
+static struct ufsm_entry_exit s349exit;
+static struct ufsm_state s348;
+static struct ufsm_entry_exit s348entry;
+static struct ufsm_entry_exit s348exit;
+static struct ufsm_state s347;
+static struct ufsm_entry_exit s347entry;
+static struct ufsm_entry_exit s347exit;
+static struct ufsm_state s346;
+static struct ufsm_entry_exit s346entry;
+static struct ufsm_entry_exit s346exit;
+static struct ufsm_state s384;
+static struct ufsm_state s345;
+static struct ufsm_entry_exit s43entry;
+static struct ufsm_entry_exit s43exit;
+static struct ufsm_state s42;
+static struct ufsm_region r68;
+static struct ufsm_transition t68;
+static struct ufsm_action t68effect;
+static struct ufsm_transition t617;
+static struct ufsm_action t617effect;
+static struct ufsm_transition t618;
+static struct ufsm_action t618effect;
+static struct ufsm_guard t618guard;
+static struct ufsm_transition t619;
+static struct ufsm_action t619effect;
+static struct ufsm_transition t620;
+static struct ufsm_action t620effect;
+static struct ufsm_transition t621;
+static struct ufsm_action t621effect;
+static struct ufsm_transition t622;
+static struct ufsm_action t622effect;
+static struct ufsm_guard t622guard;
+static struct ufsm_transition t623;
+static struct ufsm_action t623effect;
+static struct ufsm_guard t623guard;
+static struct ufsm_transition t624;
+static struct ufsm_action t624effect;
+static struct ufsm_state s344;
+static struct ufsm_entry_exit s344entry;
+static struct ufsm_entry_exit s344exit;
+static struct ufsm_state s343;
+static struct ufsm_entry_exit s343entry;
+static struct ufsm_entry_exit s343exit;
+static struct ufsm_state s342;
+static struct ufsm_entry_exit s342entry;
+static struct ufsm_entry_exit s342exit;
+static struct ufsm_state s341;
+static struct ufsm_entry_exit s341entry;
+static struct ufsm_entry_exit s341exit;
+static struct ufsm_state s340;
+static struct ufsm_region r67;
+static struct ufsm_transition t67;
+static struct ufsm_action t67effect;
+static struct ufsm_transition t609;
+static struct ufsm_action t609effect;
+static struct ufsm_transition t610;
+static struct ufsm_action t610effect;
+static struct ufsm_transition t611;
+static struct ufsm_action t611effect;
+static struct ufsm_transition t612;
+static struct ufsm_action t612effect;
+static struct ufsm_transition t613;
+static struct ufsm_action t613effect;
+static struct ufsm_transition t614;
+static struct ufsm_action t614effect;
+static struct ufsm_transition t615;
+static struct ufsm_action t615effect;
+static struct ufsm_transition t616;
+static struct ufsm_action t616effect;
+static struct ufsm_state s339;
+static struct ufsm_entry_exit s339entry;
+static struct ufsm_entry_exit s339exit;
+static struct ufsm_state s338;
+static struct ufsm_entry_exit s338entry;
+static struct ufsm_entry_exit s338exit;
+static struct ufsm_state s337;
+static struct ufsm_entry_exit s337entry;
+static struct ufsm_entry_exit s337exit;
+static struct ufsm_state s336;
+static struct ufsm_entry_exit s336entry;
+static struct ufsm_entry_exit s336exit;
+static struct ufsm_state s335;
+static struct ufsm_entry_exit s42entry;
+static struct ufsm_entry_exit s42exit;
+static struct ufsm_state s41;
+static struct ufsm_region r66;
+static struct ufsm_transition t66;
+static struct ufsm_action t66effect;
+static struct ufsm_transition t601;
+static struct ufsm_action t601effect;
+static struct ufsm_transition t602;
+static struct ufsm_action t602effect;
+static struct ufsm_guard t602guard;
+static struct ufsm_transition t603;
+static struct ufsm_action t603effect;
+static struct ufsm_transition t604;
+static struct ufsm_action t604effect;
+static struct ufsm_guard t604guard;
+static struct ufsm_transition t605;
+static struct ufsm_action t605effect;
+static struct ufsm_transition t606;
+static struct ufsm_action t606effect;
+static struct ufsm_transition t607;
+static struct ufsm_action t607effect;
+static struct ufsm_transition t608;
+static struct ufsm_action t608effect;
+static struct ufsm_guard t608guard;
+static struct ufsm_transition t657;
+static struct ufsm_action t657effect;
+static struct ufsm_transition t658;
+static struct ufsm_action t658effect;
+static struct ufsm_guard t658guard;
+static struct ufsm_transition t659;
+static struct ufsm_action t659effect;
+static struct ufsm_state s334;
+static struct ufsm_entry_exit s334entry;
+static struct ufsm_entry_exit s334exit;
+static struct ufsm_state s333;
+static struct ufsm_entry_exit s333entry;
+static struct ufsm_entry_exit s333exit;
+static struct ufsm_state s332;
+static struct ufsm_entry_exit s332entry;
+static struct ufsm_entry_exit s332exit;
+static struct ufsm_state s331;
+static struct ufsm_entry_exit s331entry;
+static struct ufsm_entry_exit s331exit;
+static struct ufsm_state s365;
+static struct ufsm_state s330;
+static struct ufsm_region r65;
+static struct ufsm_transition t65;
+static struct ufsm_action t65effect;
+static struct ufsm_transition t593;
+static struct ufsm_action t593effect;
+static struct ufsm_guard t593guard;
+static struct ufsm_transition t594;
+static struct ufsm_action t594effect;
+static struct ufsm_transition t595;
+static struct ufsm_action t595effect;
+static struct ufsm_guard t595guard;
+static struct ufsm_transition t596;
+static struct ufsm_action t596effect;
+static struct ufsm_transition t597;
+static struct ufsm_action t597effect;
+static struct ufsm_transition t598;
+static struct ufsm_action t598effect;
+static struct ufsm_transition t599;
+static struct ufsm_action t599effect;
+static struct ufsm_transition t600;
+static struct ufsm_action t600effect;
+static struct ufsm_guard t600guard;
+static struct ufsm_state s329;
+static struct ufsm_entry_exit s329entry;
+static struct ufsm_entry_exit s329exit;
+static struct ufsm_state s328;
+static struct ufsm_entry_exit s328entry;
+static struct ufsm_entry_exit s328exit;
+static struct ufsm_state s327;
+static struct ufsm_entry_exit s327entry;
+static struct ufsm_entry_exit s327exit;
+static struct ufsm_state s326;
+static struct ufsm_entry_exit s326entry;
+static struct ufsm_entry_exit s326exit;
+static struct ufsm_state s325;
+static struct ufsm_entry_exit s41entry;
+static struct ufsm_entry_exit s41exit;
+static struct ufsm_state s40;
+static struct ufsm_region r7;
+static struct ufsm_transition t7;
+static struct ufsm_action t7effect;
+static struct ufsm_transition t129;
+static struct ufsm_action t129effect;
+static struct ufsm_transition t130;
+static struct ufsm_action t130effect;
+static struct ufsm_transition t131;
+static struct ufsm_action t131effect;
+static struct ufsm_transition t132;
+static struct ufsm_action t132effect;
+static struct ufsm_transition t133;
+static struct ufsm_action t133effect;
+static struct ufsm_transition t134;
+static struct ufsm_action t134effect;
+static struct ufsm_transition t135;
+static struct ufsm_action t135effect;
+static struct ufsm_transition t136;
+static struct ufsm_action t136effect;
+static struct ufsm_guard t136guard;
+static struct ufsm_transition t677;
+static struct ufsm_action t677effect;
+static struct ufsm_guard t677guard;
+static struct ufsm_transition t678;
+static struct ufsm_action t678effect;
+static struct ufsm_transition t679;
+static struct ufsm_action t679effect;
+static struct ufsm_transition t682;
+static struct ufsm_action t682effect;
+static struct ufsm_transition t686;
+static struct ufsm_action t686effect;
+static struct ufsm_state s39;
+static struct ufsm_region r64;
+static struct ufsm_transition t64;
+static struct ufsm_action t64effect;
+static struct ufsm_transition t585;
+static struct ufsm_action t585effect;
+static struct ufsm_guard t585guard;
+static struct ufsm_transition t586;
+static struct ufsm_action t586effect;
+static struct ufsm_transition t587;
+static struct ufsm_action t587effect;
+static struct ufsm_guard t587guard;
+static struct ufsm_transition t588;
+static struct ufsm_action t588effect;
+static struct ufsm_transition t589;
+static struct ufsm_action t589effect;
+static struct ufsm_guard t589guard;
+static struct ufsm_transition t590;
+static struct ufsm_action t590effect;
+static struct ufsm_transition t591;
+static struct ufsm_action t591effect;
+static struct ufsm_guard t591guard;
+static struct ufsm_transition t592;
+static struct ufsm_action t592effect;
+static struct ufsm_transition t681;
+static struct ufsm_action t681effect;
+static struct ufsm_state s324;
+static struct ufsm_entry_exit s324entry;
+static struct ufsm_entry_exit s324exit;
+static struct ufsm_state s323;
+static struct ufsm_entry_exit s323entry;
+static struct ufsm_entry_exit s323exit;
+static struct ufsm_state s322;
+static struct ufsm_entry_exit s322entry;
+static struct ufsm_entry_exit s322exit;
+static struct ufsm_state s321;
+static struct ufsm_entry_exit s321entry;
+static struct ufsm_entry_exit s321exit;
+static struct ufsm_state s320;
+static struct ufsm_region r63;
+static struct ufsm_transition t63;
+static struct ufsm_action t63effect;
+static struct ufsm_transition t577;
+static struct ufsm_action t577effect;
+static struct ufsm_transition t578;
+static struct ufsm_action t578effect;
+static struct ufsm_transition t579;
+static struct ufsm_action t579effect;
+static struct ufsm_transition t580;
+static struct ufsm_action t580effect;
+static struct ufsm_guard t580guard;
+static struct ufsm_transition t581;
+static struct ufsm_action t581effect;
+static struct ufsm_transition t582;
+static struct ufsm_action t582effect;
+static struct ufsm_transition t583;
+static struct ufsm_action t583effect;
+static struct ufsm_transition t584;
+static struct ufsm_action t584effect;
+static struct ufsm_transition t680;
+static struct ufsm_action t680effect;
+static struct ufsm_state s319;
+static struct ufsm_entry_exit s319entry;
+static struct ufsm_entry_exit s319exit;
+static struct ufsm_state s318;
+static struct ufsm_entry_exit s318entry;
+static struct ufsm_entry_exit s318exit;
+static struct ufsm_state s317;
+static struct ufsm_entry_exit s317entry;
+static struct ufsm_entry_exit s317exit;
+static struct ufsm_state s316;
+static struct ufsm_entry_exit s316entry;
+static struct ufsm_entry_exit s316exit;
+static struct ufsm_state s315;
+static struct ufsm_entry_exit s39entry;
+static struct ufsm_entry_exit s39exit;
+static struct ufsm_state s38;
+static struct ufsm_region r62;
+static struct ufsm_transition t62;
+static struct ufsm_action t62effect;
+static struct ufsm_transition t569;
+static struct ufsm_action t569effect;
+static struct ufsm_transition t570;
+static struct ufsm_action t570effect;
+static struct ufsm_guard t570guard;
+static struct ufsm_transition t571;
+static struct ufsm_action t571effect;
+static struct ufsm_transition t572;
+static struct ufsm_action t572effect;
+static struct ufsm_transition t573;
+static struct ufsm_action t573effect;
+static struct ufsm_transition t574;
+static struct ufsm_action t574effect;
+static struct ufsm_guard t574guard;
+static struct ufsm_transition t575;
+static struct ufsm_action t575effect;
+static struct ufsm_guard t575guard;
+static struct ufsm_transition t576;
+static struct ufsm_action t576effect;
+static struct ufsm_guard t576guard;
+static struct ufsm_state s314;
+static struct ufsm_entry_exit s314entry;
+static struct ufsm_entry_exit s314exit;
+static struct ufsm_state s313;
+static struct ufsm_entry_exit s313entry;
+static struct ufsm_entry_exit s313exit;
+static struct ufsm_state s312;
+static struct ufsm_entry_exit s312entry;
+static struct ufsm_entry_exit s312exit;
+static struct ufsm_state s311;
+static struct ufsm_entry_exit s311entry;
+static struct ufsm_entry_exit s311exit;
+static struct ufsm_state s310;
+static struct ufsm_region r61;
+static struct ufsm_transition t61;
+static struct ufsm_action t61effect;
+static struct ufsm_transition t561;
+static struct ufsm_action t561effect;
+static struct ufsm_transition t562;
+static struct ufsm_action t562effect;
+static struct ufsm_transition t563;
+static struct ufsm_action t563effect;
+static struct ufsm_transition t564;
+static struct ufsm_action t564effect;
+static struct ufsm_transition t565;
+static struct ufsm_action t565effect;
+static struct ufsm_guard t565guard;
+static struct ufsm_transition t566;
+static struct ufsm_action t566effect;
+static struct ufsm_guard t566guard;
+static struct ufsm_transition t567;
+static struct ufsm_action t567effect;
+static struct ufsm_transition t568;
+static struct ufsm_action t568effect;
+static struct ufsm_guard t568guard;
+static struct ufsm_state s309;
+static struct ufsm_entry_exit s309entry;
+static struct ufsm_entry_exit s309exit;
+static struct ufsm_state s308;
+static struct ufsm_entry_exit s308entry;
+static struct ufsm_entry_exit s308exit;
+static struct ufsm_state s307;
+static struct ufsm_entry_exit s307entry;
+static struct ufsm_entry_exit s307exit;
+static struct ufsm_state s306;
+static struct ufsm_entry_exit s306entry;
+static struct ufsm_entry_exit s306exit;
+static struct ufsm_state s305;
+static struct ufsm_entry_exit s38entry;
+static struct ufsm_entry_exit s38exit;
+static struct ufsm_state s37;
+static struct ufsm_region r60;
+static struct ufsm_transition t60;
+static struct ufsm_action t60effect;
+static struct ufsm_transition t553;
+static struct ufsm_action t553effect;
+static struct ufsm_transition t554;
+static struct ufsm_action t554effect;
+static struct ufsm_transition t555;
+static struct ufsm_action t555effect;
+static struct ufsm_guard t555guard;
+static struct ufsm_transition t556;
+static struct ufsm_action t556effect;
+static struct ufsm_guard t556guard;
+static struct ufsm_transition t557;
+static struct ufsm_action t557effect;
+static struct ufsm_transition t558;
+static struct ufsm_action t558effect;
+static struct ufsm_transition t559;
+static struct ufsm_action t559effect;
+static struct ufsm_transition t560;
+static struct ufsm_action t560effect;
+static struct ufsm_state s304;
+static struct ufsm_entry_exit s304entry;
+static struct ufsm_entry_exit s304exit;
+static struct ufsm_state s303;
+static struct ufsm_entry_exit s303entry;
+static struct ufsm_entry_exit s303exit;
+static struct ufsm_state s302;
+static struct ufsm_entry_exit s302entry;
+static struct ufsm_entry_exit s302exit;
+static struct ufsm_state s301;
+static struct ufsm_entry_exit s301entry;
+static struct ufsm_entry_exit s301exit;
+static struct ufsm_state s300;
+static struct ufsm_region r59;
+static struct ufsm_transition t59;
+static struct ufsm_action t59effect;
+static struct ufsm_transition t545;
+static struct ufsm_action t545effect;
+static struct ufsm_guard t545guard;
+static struct ufsm_transition t546;
+static struct ufsm_action t546effect;
+static struct ufsm_transition t547;
+static struct ufsm_action t547effect;
+static struct ufsm_guard t547guard;
+static struct ufsm_transition t548;
+static struct ufsm_action t548effect;
+static struct ufsm_guard t548guard;
+static struct ufsm_transition t549;
+static struct ufsm_action t549effect;
+static struct ufsm_transition t550;
+static struct ufsm_action t550effect;
+static struct ufsm_transition t551;
+static struct ufsm_action t551effect;
+static struct ufsm_guard t551guard;
+static struct ufsm_transition t552;
+static struct ufsm_action t552effect;
+static struct ufsm_transition t673;
+static struct ufsm_action t673effect;
+static struct ufsm_transition t674;
+static struct ufsm_action t674effect;
+static struct ufsm_state s299;
+static struct ufsm_entry_exit s299entry;
+static struct ufsm_entry_exit s299exit;
+static struct ufsm_state s298;
+static struct ufsm_entry_exit s298entry;
+static struct ufsm_entry_exit s298exit;
+static struct ufsm_state s297;
+static struct ufsm_entry_exit s297entry;
+static struct ufsm_entry_exit s297exit;
+static struct ufsm_state s296;
+static struct ufsm_entry_exit s296entry;
+static struct ufsm_entry_exit s296exit;
+static struct ufsm_state s371;
+static struct ufsm_state s295;
+static struct ufsm_entry_exit s37entry;
+static struct ufsm_entry_exit s37exit;
+static struct ufsm_state s36;
+static struct ufsm_region r58;
+static struct ufsm_transition t58;
+static struct ufsm_action t58effect;
+static struct ufsm_transition t537;
+static struct ufsm_action t537effect;
+static struct ufsm_transition t538;
+static struct ufsm_action t538effect;
+static struct ufsm_guard t538guard;
+static struct ufsm_transition t539;
+static struct ufsm_action t539effect;
+static struct ufsm_transition t540;
+static struct ufsm_action t540effect;
+static struct ufsm_transition t541;
+static struct ufsm_action t541effect;
+static struct ufsm_guard t541guard;
+static struct ufsm_transition t542;
+static struct ufsm_action t542effect;
+static struct ufsm_transition t543;
+static struct ufsm_action t543effect;
+static struct ufsm_transition t544;
+static struct ufsm_action t544effect;
+static struct ufsm_state s294;
+static struct ufsm_entry_exit s294entry;
+static struct ufsm_entry_exit s294exit;
+static struct ufsm_state s293;
+static struct ufsm_entry_exit s293entry;
+static struct ufsm_entry_exit s293exit;
+static struct ufsm_state s292;
+static struct ufsm_entry_exit s292entry;
+static struct ufsm_entry_exit s292exit;
+static struct ufsm_state s291;
+static struct ufsm_entry_exit s291entry;
+static struct ufsm_entry_exit s291exit;
+static struct ufsm_state s290;
+static struct ufsm_region r57;
+static struct ufsm_transition t57;
+static struct ufsm_action t57effect;
+static struct ufsm_transition t529;
+static struct ufsm_action t529effect;
+static struct ufsm_transition t530;
+static struct ufsm_action t530effect;
+static struct ufsm_transition t531;
+static struct ufsm_action t531effect;
+static struct ufsm_transition t532;
+static struct ufsm_action t532effect;
+static struct ufsm_guard t532guard;
+static struct ufsm_transition t533;
+static struct ufsm_action t533effect;
+static struct ufsm_transition t534;
+static struct ufsm_action t534effect;
+static struct ufsm_transition t535;
+static struct ufsm_action t535effect;
+static struct ufsm_guard t535guard;
+static struct ufsm_transition t536;
+static struct ufsm_action t536effect;
+static struct ufsm_state s289;
+static struct ufsm_entry_exit s289entry;
+static struct ufsm_entry_exit s289exit;
+static struct ufsm_state s288;
+static struct ufsm_entry_exit s288entry;
+static struct ufsm_entry_exit s288exit;
+static struct ufsm_state s287;
+static struct ufsm_entry_exit s287entry;
+static struct ufsm_entry_exit s287exit;
+static struct ufsm_state s286;
+static struct ufsm_entry_exit s286entry;
+static struct ufsm_entry_exit s286exit;
+static struct ufsm_state s285;
+static struct ufsm_entry_exit s36entry;
+static struct ufsm_entry_exit s36exit;
+static struct ufsm_state s374;
+static struct ufsm_state s373;
+static struct ufsm_state s35;
+static struct ufsm_entry_exit s4entry;
+static struct ufsm_entry_exit s4exit;
+static struct ufsm_state s3;
+static struct ufsm_region r6;
+static struct ufsm_transition t6;
+static struct ufsm_action t6effect;
+static struct ufsm_transition t121;
+static struct ufsm_action t121effect;
+static struct ufsm_transition t122;
+static struct ufsm_action t122effect;
+static struct ufsm_guard t122guard;
+static struct ufsm_transition t123;
+static struct ufsm_action t123effect;
+static struct ufsm_transition t124;
+static struct ufsm_action t124effect;
+static struct ufsm_guard t124guard;
+static struct ufsm_transition t125;
+static struct ufsm_action t125effect;
+static struct ufsm_transition t126;
+static struct ufsm_action t126effect;
+static struct ufsm_transition t127;
+static struct ufsm_action t127effect;
+static struct ufsm_transition t128;
+static struct ufsm_action t128effect;
+static struct ufsm_guard t128guard;
+static struct ufsm_state s34;
+static struct ufsm_region r56;
+static struct ufsm_transition t56;
+static struct ufsm_action t56effect;
+static struct ufsm_transition t521;
+static struct ufsm_action t521effect;
+static struct ufsm_transition t522;
+static struct ufsm_action t522effect;
+static struct ufsm_transition t523;
+static struct ufsm_action t523effect;
+static struct ufsm_guard t523guard;
+static struct ufsm_transition t524;
+static struct ufsm_action t524effect;
+static struct ufsm_guard t524guard;
+static struct ufsm_transition t525;
+static struct ufsm_action t525effect;
+static struct ufsm_transition t526;
+static struct ufsm_action t526effect;
+static struct ufsm_guard t526guard;
+static struct ufsm_transition t527;
+static struct ufsm_action t527effect;
+static struct ufsm_transition t528;
+static struct ufsm_action t528effect;
+static struct ufsm_state s284;
+static struct ufsm_entry_exit s284entry;
+static struct ufsm_entry_exit s284exit;
+static struct ufsm_state s283;
+static struct ufsm_entry_exit s283entry;
+static struct ufsm_entry_exit s283exit;
+static struct ufsm_state s282;
+static struct ufsm_entry_exit s282entry;
+static struct ufsm_entry_exit s282exit;
+static struct ufsm_state s281;
+static struct ufsm_entry_exit s281entry;
+static struct ufsm_entry_exit s281exit;
+static struct ufsm_state s280;
+static struct ufsm_region r55;
+static struct ufsm_transition t55;
+static struct ufsm_action t55effect;
+static struct ufsm_transition t513;
+static struct ufsm_action t513effect;
+static struct ufsm_transition t514;
+static struct ufsm_action t514effect;
+static struct ufsm_transition t515;
+static struct ufsm_action t515effect;
+static struct ufsm_transition t516;
+static struct ufsm_action t516effect;
+static struct ufsm_transition t517;
+static struct ufsm_action t517effect;
+static struct ufsm_transition t518;
+static struct ufsm_action t518effect;
+static struct ufsm_transition t519;
+static struct ufsm_action t519effect;
+static struct ufsm_transition t520;
+static struct ufsm_action t520effect;
+static struct ufsm_state s279;
+static struct ufsm_entry_exit s279entry;
+static struct ufsm_entry_exit s279exit;
+static struct ufsm_state s278;
+static struct ufsm_entry_exit s278entry;
+static struct ufsm_entry_exit s278exit;
+static struct ufsm_state s277;
+static struct ufsm_entry_exit s277entry;
+static struct ufsm_entry_exit s277exit;
+static struct ufsm_state s276;
+static struct ufsm_entry_exit s276entry;
+static struct ufsm_entry_exit s276exit;
+static struct ufsm_state s275;
+static struct ufsm_entry_exit s34entry;
+static struct ufsm_entry_exit s34exit;
+static struct ufsm_state s33;
+static struct ufsm_region r54;
+static struct ufsm_transition t54;
+static struct ufsm_action t54effect;
+static struct ufsm_transition t505;
+static struct ufsm_action t505effect;
+static struct ufsm_transition t506;
+static struct ufsm_action t506effect;
+static struct ufsm_guard t506guard;
+static struct ufsm_transition t507;
+static struct ufsm_action t507effect;
+static struct ufsm_transition t508;
+static struct ufsm_action t508effect;
+static struct ufsm_transition t509;
+static struct ufsm_action t509effect;
+static struct ufsm_guard t509guard;
+static struct ufsm_transition t510;
+static struct ufsm_action t510effect;
+static struct ufsm_transition t511;
+static struct ufsm_action t511effect;
+static struct ufsm_transition t512;
+static struct ufsm_action t512effect;
+static struct ufsm_guard t512guard;
+static struct ufsm_state s274;
+static struct ufsm_entry_exit s274entry;
+static struct ufsm_entry_exit s274exit;
+static struct ufsm_state s273;
+static struct ufsm_entry_exit s273entry;
+static struct ufsm_entry_exit s273exit;
+static struct ufsm_state s272;
+static struct ufsm_entry_exit s272entry;
+static struct ufsm_entry_exit s272exit;
+static struct ufsm_state s271;
+static struct ufsm_entry_exit s271entry;
+static struct ufsm_entry_exit s271exit;
+static struct ufsm_state s270;
+static struct ufsm_region r53;
+static struct ufsm_transition t53;
+static struct ufsm_action t53effect;
+static struct ufsm_transition t497;
+static struct ufsm_action t497effect;
+static struct ufsm_transition t498;
+static struct ufsm_action t498effect;
+static struct ufsm_guard t498guard;
+static struct ufsm_transition t499;
+static struct ufsm_action t499effect;
+static struct ufsm_guard t499guard;
+static struct ufsm_transition t500;
+static struct ufsm_action t500effect;
+static struct ufsm_transition t501;
+static struct ufsm_action t501effect;
+static struct ufsm_transition t502;
+static struct ufsm_action t502effect;
+static struct ufsm_transition t503;
+static struct ufsm_action t503effect;
+static struct ufsm_transition t504;
+static struct ufsm_action t504effect;
+static struct ufsm_state s269;
+static struct ufsm_entry_exit s269entry;
+static struct ufsm_entry_exit s269exit;
+static struct ufsm_state s268;
+static struct ufsm_entry_exit s268entry;
+static struct ufsm_entry_exit s268exit;
+static struct ufsm_state s267;
+static struct ufsm_entry_exit s267entry;
+static struct ufsm_entry_exit s267exit;
+static struct ufsm_state s266;
+static struct ufsm_entry_exit s266entry;
+static struct ufsm_entry_exit s266exit;
+static struct ufsm_state s265;
+static struct ufsm_entry_exit s33entry;
+static struct ufsm_entry_exit s33exit;
+static struct ufsm_state s32;
+static struct ufsm_region r52;
+static struct ufsm_transition t52;
+static struct ufsm_action t52effect;
+static struct ufsm_transition t489;
+static struct ufsm_action t489effect;
+static struct ufsm_guard t489guard;
+static struct ufsm_transition t490;
+static struct ufsm_action t490effect;
+static struct ufsm_transition t491;
+static struct ufsm_action t491effect;
+static struct ufsm_guard t491guard;
+static struct ufsm_transition t492;
+static struct ufsm_action t492effect;
+static struct ufsm_transition t493;
+static struct ufsm_action t493effect;
+static struct ufsm_transition t494;
+static struct ufsm_action t494effect;
+static struct ufsm_transition t495;
+static struct ufsm_action t495effect;
+static struct ufsm_guard t495guard;
+static struct ufsm_transition t496;
+static struct ufsm_action t496effect;
+static struct ufsm_state s264;
+static struct ufsm_entry_exit s264entry;
+static struct ufsm_entry_exit s264exit;
+static struct ufsm_state s263;
+static struct ufsm_entry_exit s263entry;
+static struct ufsm_entry_exit s263exit;
+static struct ufsm_state s262;
+static struct ufsm_entry_exit s262entry;
+static struct ufsm_entry_exit s262exit;
+static struct ufsm_state s261;
+static struct ufsm_entry_exit s261entry;
+static struct ufsm_entry_exit s261exit;
+static struct ufsm_state s260;
+static struct ufsm_region r51;
+static struct ufsm_transition t51;
+static struct ufsm_action t51effect;
+static struct ufsm_transition t481;
+static struct ufsm_action t481effect;
+static struct ufsm_transition t482;
+static struct ufsm_action t482effect;
+static struct ufsm_transition t483;
+static struct ufsm_action t483effect;
+static struct ufsm_guard t483guard;
+static struct ufsm_transition t484;
+static struct ufsm_action t484effect;
+static struct ufsm_transition t485;
+static struct ufsm_action t485effect;
+static struct ufsm_transition t486;
+static struct ufsm_action t486effect;
+static struct ufsm_transition t487;
+static struct ufsm_action t487effect;
+static struct ufsm_transition t488;
+static struct ufsm_action t488effect;
+static struct ufsm_state s259;
+static struct ufsm_entry_exit s259entry;
+static struct ufsm_entry_exit s259exit;
+static struct ufsm_state s258;
+static struct ufsm_entry_exit s258entry;
+static struct ufsm_entry_exit s258exit;
+static struct ufsm_state s257;
+static struct ufsm_entry_exit s257entry;
+static struct ufsm_entry_exit s257exit;
+static struct ufsm_state s256;
+static struct ufsm_entry_exit s256entry;
+static struct ufsm_entry_exit s256exit;
+static struct ufsm_state s255;
+static struct ufsm_entry_exit s32entry;
+static struct ufsm_entry_exit s32exit;
+static struct ufsm_state s31;
+static struct ufsm_region r50;
+static struct ufsm_transition t50;
+static struct ufsm_action t50effect;
+static struct ufsm_transition t473;
+static struct ufsm_action t473effect;
+static struct ufsm_guard t473guard;
+static struct ufsm_transition t474;
+static struct ufsm_action t474effect;
+static struct ufsm_transition t475;
+static struct ufsm_action t475effect;
+static struct ufsm_transition t476;
+static struct ufsm_action t476effect;
+static struct ufsm_guard t476guard;
+static struct ufsm_transition t477;
+static struct ufsm_action t477effect;
+static struct ufsm_guard t477guard;
+static struct ufsm_transition t478;
+static struct ufsm_action t478effect;
+static struct ufsm_transition t479;
+static struct ufsm_action t479effect;
+static struct ufsm_transition t480;
+static struct ufsm_action t480effect;
+static struct ufsm_guard t480guard;
+static struct ufsm_state s254;
+static struct ufsm_entry_exit s254entry;
+static struct ufsm_entry_exit s254exit;
+static struct ufsm_state s253;
+static struct ufsm_entry_exit s253entry;
+static struct ufsm_entry_exit s253exit;
+static struct ufsm_state s252;
+static struct ufsm_entry_exit s252entry;
+static struct ufsm_entry_exit s252exit;
+static struct ufsm_state s251;
+static struct ufsm_entry_exit s251entry;
+static struct ufsm_entry_exit s251exit;
+static struct ufsm_state s250;
+static struct ufsm_region r49;
+static struct ufsm_transition t49;
+static struct ufsm_action t49effect;
+static struct ufsm_transition t465;
+static struct ufsm_action t465effect;
+static struct ufsm_transition t466;
+static struct ufsm_action t466effect;
+static struct ufsm_transition t467;
+static struct ufsm_action t467effect;
+static struct ufsm_transition t468;
+static struct ufsm_action t468effect;
+static struct ufsm_transition t469;
+static struct ufsm_action t469effect;
+static struct ufsm_guard t469guard;
+static struct ufsm_transition t470;
+static struct ufsm_action t470effect;
+static struct ufsm_transition t471;
+static struct ufsm_action t471effect;
+static struct ufsm_transition t472;
+static struct ufsm_action t472effect;
+static struct ufsm_state s249;
+static struct ufsm_entry_exit s249entry;
+static struct ufsm_entry_exit s249exit;
+static struct ufsm_state s248;
+static struct ufsm_entry_exit s248entry;
+static struct ufsm_entry_exit s248exit;
+static struct ufsm_state s247;
+static struct ufsm_entry_exit s247entry;
+static struct ufsm_entry_exit s247exit;
+static struct ufsm_state s246;
+static struct ufsm_entry_exit s246entry;
+static struct ufsm_entry_exit s246exit;
+static struct ufsm_state s245;
+static struct ufsm_entry_exit s31entry;
+static struct ufsm_entry_exit s31exit;
+static struct ufsm_state s30;
+static struct ufsm_region r5;
+static struct ufsm_transition t5;
+static struct ufsm_action t5effect;
+static struct ufsm_transition t113;
+static struct ufsm_action t113effect;
+static struct ufsm_guard t113guard;
+static struct ufsm_transition t114;
+static struct ufsm_action t114effect;
+static struct ufsm_guard t114guard;
+static struct ufsm_transition t115;
+static struct ufsm_action t115effect;
+static struct ufsm_guard t115guard;
+static struct ufsm_transition t116;
+static struct ufsm_action t116effect;
+static struct ufsm_transition t117;
+static struct ufsm_action t117effect;
+static struct ufsm_guard t117guard;
+static struct ufsm_transition t118;
+static struct ufsm_action t118effect;
+static struct ufsm_transition t119;
+static struct ufsm_action t119effect;
+static struct ufsm_transition t120;
+static struct ufsm_action t120effect;
+static struct ufsm_guard t120guard;
+static struct ufsm_transition t706;
+static struct ufsm_action t706effect;
+static struct ufsm_state s29;
+static struct ufsm_region r48;
+static struct ufsm_transition t48;
+static struct ufsm_action t48effect;
+static struct ufsm_transition t457;
+static struct ufsm_action t457effect;
+static struct ufsm_guard t457guard;
+static struct ufsm_transition t458;
+static struct ufsm_action t458effect;
+static struct ufsm_transition t459;
+static struct ufsm_action t459effect;
+static struct ufsm_guard t459guard;
+static struct ufsm_transition t460;
+static struct ufsm_action t460effect;
+static struct ufsm_transition t461;
+static struct ufsm_action t461effect;
+static struct ufsm_transition t462;
+static struct ufsm_action t462effect;
+static struct ufsm_transition t463;
+static struct ufsm_action t463effect;
+static struct ufsm_transition t464;
+static struct ufsm_action t464effect;
+static struct ufsm_state s244;
+static struct ufsm_entry_exit s244entry;
+static struct ufsm_entry_exit s244exit;
+static struct ufsm_state s243;
+static struct ufsm_entry_exit s243entry;
+static struct ufsm_entry_exit s243exit;
+static struct ufsm_state s242;
+static struct ufsm_entry_exit s242entry;
+static struct ufsm_entry_exit s242exit;
+static struct ufsm_state s241;
+static struct ufsm_entry_exit s241entry;
+static struct ufsm_entry_exit s241exit;
+static struct ufsm_state s240;
+static struct ufsm_region r47;
+static struct ufsm_transition t47;
+static struct ufsm_action t47effect;
+static struct ufsm_transition t449;
+static struct ufsm_action t449effect;
+static struct ufsm_transition t450;
+static struct ufsm_action t450effect;
+static struct ufsm_transition t451;
+static struct ufsm_action t451effect;
+static struct ufsm_transition t452;
+static struct ufsm_action t452effect;
+static struct ufsm_transition t453;
+static struct ufsm_action t453effect;
+static struct ufsm_guard t453guard;
+static struct ufsm_transition t454;
+static struct ufsm_action t454effect;
+static struct ufsm_transition t455;
+static struct ufsm_action t455effect;
+static struct ufsm_transition t456;
+static struct ufsm_action t456effect;
+static struct ufsm_state s239;
+static struct ufsm_entry_exit s239entry;
+static struct ufsm_entry_exit s239exit;
+static struct ufsm_state s238;
+static struct ufsm_entry_exit s238entry;
+static struct ufsm_entry_exit s238exit;
+static struct ufsm_state s237;
+static struct ufsm_entry_exit s237entry;
+static struct ufsm_entry_exit s237exit;
+static struct ufsm_state s236;
+static struct ufsm_entry_exit s236entry;
+static struct ufsm_entry_exit s236exit;
+static struct ufsm_state s235;
+static struct ufsm_entry_exit s29entry;
+static struct ufsm_entry_exit s29exit;
+static struct ufsm_state s28;
+static struct ufsm_region r46;
+static struct ufsm_transition t46;
+static struct ufsm_action t46effect;
+static struct ufsm_transition t441;
+static struct ufsm_action t441effect;
+static struct ufsm_guard t441guard;
+static struct ufsm_transition t442;
+static struct ufsm_action t442effect;
+static struct ufsm_transition t443;
+static struct ufsm_action t443effect;
+static struct ufsm_transition t444;
+static struct ufsm_action t444effect;
+static struct ufsm_guard t444guard;
+static struct ufsm_transition t445;
+static struct ufsm_action t445effect;
+static struct ufsm_transition t446;
+static struct ufsm_action t446effect;
+static struct ufsm_guard t446guard;
+static struct ufsm_transition t447;
+static struct ufsm_action t447effect;
+static struct ufsm_transition t448;
+static struct ufsm_action t448effect;
+static struct ufsm_guard t448guard;
+static struct ufsm_state s234;
+static struct ufsm_entry_exit s234entry;
+static struct ufsm_entry_exit s234exit;
+static struct ufsm_state s233;
+static struct ufsm_entry_exit s233entry;
+static struct ufsm_entry_exit s233exit;
+static struct ufsm_state s232;
+static struct ufsm_entry_exit s232entry;
+static struct ufsm_entry_exit s232exit;
+static struct ufsm_state s231;
+static struct ufsm_entry_exit s231entry;
+static struct ufsm_entry_exit s231exit;
+static struct ufsm_state s230;
+static struct ufsm_region r45;
+static struct ufsm_transition t45;
+static struct ufsm_action t45effect;
+static struct ufsm_transition t433;
+static struct ufsm_action t433effect;
+static struct ufsm_guard t433guard;
+static struct ufsm_transition t434;
+static struct ufsm_action t434effect;
+static struct ufsm_transition t435;
+static struct ufsm_action t435effect;
+static struct ufsm_transition t436;
+static struct ufsm_action t436effect;
+static struct ufsm_transition t437;
+static struct ufsm_action t437effect;
+static struct ufsm_guard t437guard;
+static struct ufsm_transition t438;
+static struct ufsm_action t438effect;
+static struct ufsm_transition t439;
+static struct ufsm_action t439effect;
+static struct ufsm_guard t439guard;
+static struct ufsm_transition t440;
+static struct ufsm_action t440effect;
+static struct ufsm_state s229;
+static struct ufsm_entry_exit s229entry;
+static struct ufsm_entry_exit s229exit;
+static struct ufsm_state s228;
+static struct ufsm_entry_exit s228entry;
+static struct ufsm_entry_exit s228exit;
+static struct ufsm_state s227;
+static struct ufsm_entry_exit s227entry;
+static struct ufsm_entry_exit s227exit;
+static struct ufsm_state s226;
+static struct ufsm_entry_exit s226entry;
+static struct ufsm_entry_exit s226exit;
+static struct ufsm_state s225;
+static struct ufsm_entry_exit s28entry;
+static struct ufsm_entry_exit s28exit;
+static struct ufsm_state s27;
+static struct ufsm_region r44;
+static struct ufsm_transition t44;
+static struct ufsm_action t44effect;
+static struct ufsm_transition t425;
+static struct ufsm_action t425effect;
+static struct ufsm_transition t426;
+static struct ufsm_action t426effect;
+static struct ufsm_guard t426guard;
+static struct ufsm_transition t427;
+static struct ufsm_action t427effect;
+static struct ufsm_transition t428;
+static struct ufsm_action t428effect;
+static struct ufsm_transition t429;
+static struct ufsm_action t429effect;
+static struct ufsm_transition t430;
+static struct ufsm_action t430effect;
+static struct ufsm_guard t430guard;
+static struct ufsm_transition t431;
+static struct ufsm_action t431effect;
+static struct ufsm_transition t432;
+static struct ufsm_action t432effect;
+static struct ufsm_guard t432guard;
+static struct ufsm_state s224;
+static struct ufsm_entry_exit s224entry;
+static struct ufsm_entry_exit s224exit;
+static struct ufsm_state s223;
+static struct ufsm_entry_exit s223entry;
+static struct ufsm_entry_exit s223exit;
+static struct ufsm_state s222;
+static struct ufsm_entry_exit s222entry;
+static struct ufsm_entry_exit s222exit;
+static struct ufsm_state s221;
+static struct ufsm_entry_exit s221entry;
+static struct ufsm_entry_exit s221exit;
+static struct ufsm_state s220;
+static struct ufsm_region r43;
+static struct ufsm_transition t43;
+static struct ufsm_action t43effect;
+static struct ufsm_transition t417;
+static struct ufsm_action t417effect;
+static struct ufsm_guard t417guard;
+static struct ufsm_transition t418;
+static struct ufsm_action t418effect;
+static struct ufsm_guard t418guard;
+static struct ufsm_transition t419;
+static struct ufsm_action t419effect;
+static struct ufsm_transition t420;
+static struct ufsm_action t420effect;
+static struct ufsm_guard t420guard;
+static struct ufsm_transition t421;
+static struct ufsm_action t421effect;
+static struct ufsm_guard t421guard;
+static struct ufsm_transition t422;
+static struct ufsm_action t422effect;
+static struct ufsm_transition t423;
+static struct ufsm_action t423effect;
+static struct ufsm_guard t423guard;
+static struct ufsm_transition t424;
+static struct ufsm_action t424effect;
+static struct ufsm_state s219;
+static struct ufsm_entry_exit s219entry;
+static struct ufsm_entry_exit s219exit;
+static struct ufsm_state s218;
+static struct ufsm_entry_exit s218entry;
+static struct ufsm_entry_exit s218exit;
+static struct ufsm_state s217;
+static struct ufsm_entry_exit s217entry;
+static struct ufsm_entry_exit s217exit;
+static struct ufsm_state s216;
+static struct ufsm_entry_exit s216entry;
+static struct ufsm_entry_exit s216exit;
+static struct ufsm_state s215;
+static struct ufsm_entry_exit s27entry;
+static struct ufsm_entry_exit s27exit;
+static struct ufsm_state s26;
+static struct ufsm_region r42;
+static struct ufsm_transition t42;
+static struct ufsm_action t42effect;
+static struct ufsm_transition t409;
+static struct ufsm_action t409effect;
+static struct ufsm_guard t409guard;
+static struct ufsm_transition t410;
+static struct ufsm_action t410effect;
+static struct ufsm_transition t411;
+static struct ufsm_action t411effect;
+static struct ufsm_transition t412;
+static struct ufsm_action t412effect;
+static struct ufsm_transition t413;
+static struct ufsm_action t413effect;
+static struct ufsm_transition t414;
+static struct ufsm_action t414effect;
+static struct ufsm_transition t415;
+static struct ufsm_action t415effect;
+static struct ufsm_transition t416;
+static struct ufsm_action t416effect;
+static struct ufsm_guard t416guard;
+static struct ufsm_state s214;
+static struct ufsm_entry_exit s214entry;
+static struct ufsm_entry_exit s214exit;
+static struct ufsm_state s213;
+static struct ufsm_entry_exit s213entry;
+static struct ufsm_entry_exit s213exit;
+static struct ufsm_state s212;
+static struct ufsm_entry_exit s212entry;
+static struct ufsm_entry_exit s212exit;
+static struct ufsm_state s211;
+static struct ufsm_entry_exit s211entry;
+static struct ufsm_entry_exit s211exit;
+static struct ufsm_state s210;
+static struct ufsm_region r41;
+static struct ufsm_transition t41;
+static struct ufsm_action t41effect;
+static struct ufsm_transition t401;
+static struct ufsm_action t401effect;
+static struct ufsm_guard t401guard;
+static struct ufsm_transition t402;
+static struct ufsm_action t402effect;
+static struct ufsm_guard t402guard;
+static struct ufsm_transition t403;
+static struct ufsm_action t403effect;
+static struct ufsm_transition t404;
+static struct ufsm_action t404effect;
+static struct ufsm_transition t405;
+static struct ufsm_action t405effect;
+static struct ufsm_transition t406;
+static struct ufsm_action t406effect;
+static struct ufsm_guard t406guard;
+static struct ufsm_transition t407;
+static struct ufsm_action t407effect;
+static struct ufsm_transition t408;
+static struct ufsm_action t408effect;
+static struct ufsm_guard t408guard;
+static struct ufsm_transition t705;
+static struct ufsm_action t705effect;
+static struct ufsm_state s209;
+static struct ufsm_entry_exit s209entry;
+static struct ufsm_entry_exit s209exit;
+static struct ufsm_state s208;
+static struct ufsm_entry_exit s208entry;
+static struct ufsm_entry_exit s208exit;
+static struct ufsm_state s207;
+static struct ufsm_entry_exit s207entry;
+static struct ufsm_entry_exit s207exit;
+static struct ufsm_state s206;
+static struct ufsm_entry_exit s206entry;
+static struct ufsm_entry_exit s206exit;
+static struct ufsm_state s383;
+static struct ufsm_state s205;
+static struct ufsm_entry_exit s26entry;
+static struct ufsm_entry_exit s26exit;
+static struct ufsm_state s25;
+static struct ufsm_entry_exit s3entry;
+static struct ufsm_entry_exit s3exit;
+static struct ufsm_state s2;
+static struct ufsm_region r4;
+static struct ufsm_transition t4;
+static struct ufsm_action t4effect;
+static struct ufsm_transition t105;
+static struct ufsm_action t105effect;
+static struct ufsm_transition t106;
+static struct ufsm_action t106effect;
+static struct ufsm_guard t106guard;
+static struct ufsm_transition t107;
+static struct ufsm_action t107effect;
+static struct ufsm_guard t107guard;
+static struct ufsm_transition t108;
+static struct ufsm_action t108effect;
+static struct ufsm_transition t109;
+static struct ufsm_action t109effect;
+static struct ufsm_transition t110;
+static struct ufsm_action t110effect;
+static struct ufsm_transition t111;
+static struct ufsm_action t111effect;
+static struct ufsm_transition t112;
+static struct ufsm_action t112effect;
+static struct ufsm_guard t112guard;
+static struct ufsm_transition t689;
+static struct ufsm_action t689effect;
+static struct ufsm_transition t690;
+static struct ufsm_action t690effect;
+static struct ufsm_transition t691;
+static struct ufsm_action t691effect;
+static struct ufsm_transition t694;
+static struct ufsm_action t694effect;
+static struct ufsm_state s24;
+static struct ufsm_region r40;
+static struct ufsm_transition t40;
+static struct ufsm_action t40effect;
+static struct ufsm_transition t393;
+static struct ufsm_action t393effect;
+static struct ufsm_guard t393guard;
+static struct ufsm_transition t394;
+static struct ufsm_action t394effect;
+static struct ufsm_transition t395;
+static struct ufsm_action t395effect;
+static struct ufsm_transition t396;
+static struct ufsm_action t396effect;
+static struct ufsm_transition t397;
+static struct ufsm_action t397effect;
+static struct ufsm_transition t398;
+static struct ufsm_action t398effect;
+static struct ufsm_transition t399;
+static struct ufsm_action t399effect;
+static struct ufsm_guard t399guard;
+static struct ufsm_transition t400;
+static struct ufsm_action t400effect;
+static struct ufsm_state s204;
+static struct ufsm_entry_exit s204entry;
+static struct ufsm_entry_exit s204exit;
+static struct ufsm_state s203;
+static struct ufsm_entry_exit s203entry;
+static struct ufsm_entry_exit s203exit;
+static struct ufsm_state s202;
+static struct ufsm_entry_exit s202entry;
+static struct ufsm_entry_exit s202exit;
+static struct ufsm_state s201;
+static struct ufsm_entry_exit s201entry;
+static struct ufsm_entry_exit s201exit;
+static struct ufsm_state s200;
+static struct ufsm_region r39;
+static struct ufsm_transition t39;
+static struct ufsm_action t39effect;
+static struct ufsm_transition t385;
+static struct ufsm_action t385effect;
+static struct ufsm_transition t386;
+static struct ufsm_action t386effect;
+static struct ufsm_transition t387;
+static struct ufsm_action t387effect;
+static struct ufsm_guard t387guard;
+static struct ufsm_transition t388;
+static struct ufsm_action t388effect;
+static struct ufsm_guard t388guard;
+static struct ufsm_transition t389;
+static struct ufsm_action t389effect;
+static struct ufsm_transition t390;
+static struct ufsm_action t390effect;
+static struct ufsm_transition t391;
+static struct ufsm_action t391effect;
+static struct ufsm_transition t392;
+static struct ufsm_action t392effect;
+static struct ufsm_guard t392guard;
+static struct ufsm_state s199;
+static struct ufsm_entry_exit s199entry;
+static struct ufsm_entry_exit s199exit;
+static struct ufsm_state s198;
+static struct ufsm_entry_exit s198entry;
+static struct ufsm_entry_exit s198exit;
+static struct ufsm_state s197;
+static struct ufsm_entry_exit s197entry;
+static struct ufsm_entry_exit s197exit;
+static struct ufsm_state s196;
+static struct ufsm_entry_exit s196entry;
+static struct ufsm_entry_exit s196exit;
+static struct ufsm_state s195;
+static struct ufsm_entry_exit s24entry;
+static struct ufsm_entry_exit s24exit;
+static struct ufsm_state s23;
+static struct ufsm_region r38;
+static struct ufsm_transition t38;
+static struct ufsm_action t38effect;
+static struct ufsm_transition t377;
+static struct ufsm_action t377effect;
+static struct ufsm_transition t378;
+static struct ufsm_action t378effect;
+static struct ufsm_transition t379;
+static struct ufsm_action t379effect;
+static struct ufsm_transition t380;
+static struct ufsm_action t380effect;
+static struct ufsm_guard t380guard;
+static struct ufsm_transition t381;
+static struct ufsm_action t381effect;
+static struct ufsm_transition t382;
+static struct ufsm_action t382effect;
+static struct ufsm_transition t383;
+static struct ufsm_action t383effect;
+static struct ufsm_transition t384;
+static struct ufsm_action t384effect;
+static struct ufsm_guard t384guard;
+static struct ufsm_transition t693;
+static struct ufsm_action t693effect;
+static struct ufsm_state s194;
+static struct ufsm_entry_exit s194entry;
+static struct ufsm_entry_exit s194exit;
+static struct ufsm_state s193;
+static struct ufsm_entry_exit s193entry;
+static struct ufsm_entry_exit s193exit;
+static struct ufsm_state s192;
+static struct ufsm_entry_exit s192entry;
+static struct ufsm_entry_exit s192exit;
+static struct ufsm_state s191;
+static struct ufsm_entry_exit s191entry;
+static struct ufsm_entry_exit s191exit;
+static struct ufsm_state s190;
+static struct ufsm_region r37;
+static struct ufsm_transition t37;
+static struct ufsm_action t37effect;
+static struct ufsm_transition t369;
+static struct ufsm_action t369effect;
+static struct ufsm_guard t369guard;
+static struct ufsm_transition t370;
+static struct ufsm_action t370effect;
+static struct ufsm_guard t370guard;
+static struct ufsm_transition t371;
+static struct ufsm_action t371effect;
+static struct ufsm_guard t371guard;
+static struct ufsm_transition t372;
+static struct ufsm_action t372effect;
+static struct ufsm_guard t372guard;
+static struct ufsm_transition t373;
+static struct ufsm_action t373effect;
+static struct ufsm_guard t373guard;
+static struct ufsm_transition t374;
+static struct ufsm_action t374effect;
+static struct ufsm_transition t375;
+static struct ufsm_action t375effect;
+static struct ufsm_transition t376;
+static struct ufsm_action t376effect;
+static struct ufsm_guard t376guard;
+static struct ufsm_transition t692;
+static struct ufsm_action t692effect;
+static struct ufsm_state s189;
+static struct ufsm_entry_exit s189entry;
+static struct ufsm_entry_exit s189exit;
+static struct ufsm_state s188;
+static struct ufsm_entry_exit s188entry;
+static struct ufsm_entry_exit s188exit;
+static struct ufsm_state s187;
+static struct ufsm_entry_exit s187entry;
+static struct ufsm_entry_exit s187exit;
+static struct ufsm_state s186;
+static struct ufsm_entry_exit s186entry;
+static struct ufsm_entry_exit s186exit;
+static struct ufsm_state s185;
+static struct ufsm_entry_exit s23entry;
+static struct ufsm_entry_exit s23exit;
+static struct ufsm_state s22;
+static struct ufsm_region r36;
+static struct ufsm_transition t36;
+static struct ufsm_action t36effect;
+static struct ufsm_transition t361;
+static struct ufsm_action t361effect;
+static struct ufsm_transition t362;
+static struct ufsm_action t362effect;
+static struct ufsm_guard t362guard;
+static struct ufsm_transition t363;
+static struct ufsm_action t363effect;
+static struct ufsm_transition t364;
+static struct ufsm_action t364effect;
+static struct ufsm_transition t365;
+static struct ufsm_action t365effect;
+static struct ufsm_transition t366;
+static struct ufsm_action t366effect;
+static struct ufsm_guard t366guard;
+static struct ufsm_transition t367;
+static struct ufsm_action t367effect;
+static struct ufsm_transition t368;
+static struct ufsm_action t368effect;
+static struct ufsm_guard t368guard;
+static struct ufsm_state s184;
+static struct ufsm_entry_exit s184entry;
+static struct ufsm_entry_exit s184exit;
+static struct ufsm_state s183;
+static struct ufsm_entry_exit s183entry;
+static struct ufsm_entry_exit s183exit;
+static struct ufsm_state s182;
+static struct ufsm_entry_exit s182entry;
+static struct ufsm_entry_exit s182exit;
+static struct ufsm_state s181;
+static struct ufsm_entry_exit s181entry;
+static struct ufsm_entry_exit s181exit;
+static struct ufsm_state s180;
+static struct ufsm_region r35;
+static struct ufsm_transition t35;
+static struct ufsm_action t35effect;
+static struct ufsm_transition t353;
+static struct ufsm_action t353effect;
+static struct ufsm_transition t354;
+static struct ufsm_action t354effect;
+static struct ufsm_guard t354guard;
+static struct ufsm_transition t355;
+static struct ufsm_action t355effect;
+static struct ufsm_guard t355guard;
+static struct ufsm_transition t356;
+static struct ufsm_action t356effect;
+static struct ufsm_transition t357;
+static struct ufsm_action t357effect;
+static struct ufsm_guard t357guard;
+static struct ufsm_transition t358;
+static struct ufsm_action t358effect;
+static struct ufsm_guard t358guard;
+static struct ufsm_transition t359;
+static struct ufsm_action t359effect;
+static struct ufsm_transition t360;
+static struct ufsm_action t360effect;
+static struct ufsm_transition t666;
+static struct ufsm_action t666effect;
+static struct ufsm_transition t667;
+static struct ufsm_action t667effect;
+static struct ufsm_guard t667guard;
+static struct ufsm_transition t668;
+static struct ufsm_action t668effect;
+static struct ufsm_transition t669;
+static struct ufsm_action t669effect;
+static struct ufsm_transition t670;
+static struct ufsm_action t670effect;
+static struct ufsm_state s179;
+static struct ufsm_entry_exit s179entry;
+static struct ufsm_entry_exit s179exit;
+static struct ufsm_state s178;
+static struct ufsm_entry_exit s178entry;
+static struct ufsm_entry_exit s178exit;
+static struct ufsm_state s177;
+static struct ufsm_entry_exit s177entry;
+static struct ufsm_entry_exit s177exit;
+static struct ufsm_state s176;
+static struct ufsm_entry_exit s176entry;
+static struct ufsm_entry_exit s176exit;
+static struct ufsm_state s369;
+static struct ufsm_state s368;
+static struct ufsm_state s175;
+static struct ufsm_entry_exit s22entry;
+static struct ufsm_entry_exit s22exit;
+static struct ufsm_state s21;
+static struct ufsm_region r34;
+static struct ufsm_transition t34;
+static struct ufsm_action t34effect;
+static struct ufsm_transition t345;
+static struct ufsm_action t345effect;
+static struct ufsm_transition t346;
+static struct ufsm_action t346effect;
+static struct ufsm_guard t346guard;
+static struct ufsm_transition t347;
+static struct ufsm_action t347effect;
+static struct ufsm_transition t348;
+static struct ufsm_action t348effect;
+static struct ufsm_transition t349;
+static struct ufsm_action t349effect;
+static struct ufsm_guard t349guard;
+static struct ufsm_transition t350;
+static struct ufsm_action t350effect;
+static struct ufsm_transition t351;
+static struct ufsm_action t351effect;
+static struct ufsm_transition t352;
+static struct ufsm_action t352effect;
+static struct ufsm_guard t352guard;
+static struct ufsm_state s174;
+static struct ufsm_entry_exit s174entry;
+static struct ufsm_entry_exit s174exit;
+static struct ufsm_state s173;
+static struct ufsm_entry_exit s173entry;
+static struct ufsm_entry_exit s173exit;
+static struct ufsm_state s172;
+static struct ufsm_entry_exit s172entry;
+static struct ufsm_entry_exit s172exit;
+static struct ufsm_state s171;
+static struct ufsm_entry_exit s171entry;
+static struct ufsm_entry_exit s171exit;
+static struct ufsm_state s170;
+static struct ufsm_region r33;
+static struct ufsm_transition t33;
+static struct ufsm_action t33effect;
+static struct ufsm_transition t337;
+static struct ufsm_action t337effect;
+static struct ufsm_transition t338;
+static struct ufsm_action t338effect;
+static struct ufsm_guard t338guard;
+static struct ufsm_transition t339;
+static struct ufsm_action t339effect;
+static struct ufsm_transition t340;
+static struct ufsm_action t340effect;
+static struct ufsm_transition t341;
+static struct ufsm_action t341effect;
+static struct ufsm_transition t342;
+static struct ufsm_action t342effect;
+static struct ufsm_transition t343;
+static struct ufsm_action t343effect;
+static struct ufsm_transition t344;
+static struct ufsm_action t344effect;
+static struct ufsm_guard t344guard;
+static struct ufsm_state s169;
+static struct ufsm_entry_exit s169entry;
+static struct ufsm_entry_exit s169exit;
+static struct ufsm_state s168;
+static struct ufsm_entry_exit s168entry;
+static struct ufsm_entry_exit s168exit;
+static struct ufsm_state s167;
+static struct ufsm_entry_exit s167entry;
+static struct ufsm_entry_exit s167exit;
+static struct ufsm_state s166;
+static struct ufsm_entry_exit s166entry;
+static struct ufsm_entry_exit s166exit;
+static struct ufsm_state s165;
+static struct ufsm_entry_exit s21entry;
+static struct ufsm_entry_exit s21exit;
+static struct ufsm_state s378;
+static struct ufsm_state s377;
+static struct ufsm_state s20;
+static struct ufsm_region r3;
+static struct ufsm_transition t3;
+static struct ufsm_action t3effect;
+static struct ufsm_transition t97;
+static struct ufsm_action t97effect;
+static struct ufsm_transition t98;
+static struct ufsm_action t98effect;
+static struct ufsm_guard t98guard;
+static struct ufsm_transition t99;
+static struct ufsm_action t99effect;
+static struct ufsm_transition t100;
+static struct ufsm_action t100effect;
+static struct ufsm_transition t101;
+static struct ufsm_action t101effect;
+static struct ufsm_transition t102;
+static struct ufsm_action t102effect;
+static struct ufsm_guard t102guard;
+static struct ufsm_transition t103;
+static struct ufsm_action t103effect;
+static struct ufsm_guard t103guard;
+static struct ufsm_transition t104;
+static struct ufsm_action t104effect;
+static struct ufsm_state s19;
+static struct ufsm_region r32;
+static struct ufsm_transition t32;
+static struct ufsm_action t32effect;
+static struct ufsm_transition t329;
+static struct ufsm_action t329effect;
+static struct ufsm_transition t330;
+static struct ufsm_action t330effect;
+static struct ufsm_transition t331;
+static struct ufsm_action t331effect;
+static struct ufsm_guard t331guard;
+static struct ufsm_transition t332;
+static struct ufsm_action t332effect;
+static struct ufsm_transition t333;
+static struct ufsm_action t333effect;
+static struct ufsm_transition t334;
+static struct ufsm_action t334effect;
+static struct ufsm_transition t335;
+static struct ufsm_action t335effect;
+static struct ufsm_guard t335guard;
+static struct ufsm_transition t336;
+static struct ufsm_action t336effect;
+static struct ufsm_transition t671;
+static struct ufsm_action t671effect;
+static struct ufsm_transition t672;
+static struct ufsm_action t672effect;
+static struct ufsm_state s164;
+static struct ufsm_entry_exit s164entry;
+static struct ufsm_entry_exit s164exit;
+static struct ufsm_state s163;
+static struct ufsm_entry_exit s163entry;
+static struct ufsm_entry_exit s163exit;
+static struct ufsm_state s162;
+static struct ufsm_entry_exit s162entry;
+static struct ufsm_entry_exit s162exit;
+static struct ufsm_state s161;
+static struct ufsm_entry_exit s161entry;
+static struct ufsm_entry_exit s161exit;
+static struct ufsm_state s370;
+static struct ufsm_state s160;
+static struct ufsm_region r31;
+static struct ufsm_transition t31;
+static struct ufsm_action t31effect;
+static struct ufsm_transition t321;
+static struct ufsm_action t321effect;
+static struct ufsm_guard t321guard;
+static struct ufsm_transition t322;
+static struct ufsm_action t322effect;
+static struct ufsm_guard t322guard;
+static struct ufsm_transition t323;
+static struct ufsm_action t323effect;
+static struct ufsm_transition t324;
+static struct ufsm_action t324effect;
+static struct ufsm_transition t325;
+static struct ufsm_action t325effect;
+static struct ufsm_transition t326;
+static struct ufsm_action t326effect;
+static struct ufsm_transition t327;
+static struct ufsm_action t327effect;
+static struct ufsm_transition t328;
+static struct ufsm_action t328effect;
+static struct ufsm_state s159;
+static struct ufsm_entry_exit s159entry;
+static struct ufsm_entry_exit s159exit;
+static struct ufsm_state s158;
+static struct ufsm_entry_exit s158entry;
+static struct ufsm_entry_exit s158exit;
+static struct ufsm_state s157;
+static struct ufsm_entry_exit s157entry;
+static struct ufsm_entry_exit s157exit;
+static struct ufsm_state s156;
+static struct ufsm_entry_exit s156entry;
+static struct ufsm_entry_exit s156exit;
+static struct ufsm_state s155;
+static struct ufsm_entry_exit s19entry;
+static struct ufsm_entry_exit s19exit;
+static struct ufsm_state s18;
+static struct ufsm_region r30;
+static struct ufsm_transition t30;
+static struct ufsm_action t30effect;
+static struct ufsm_transition t313;
+static struct ufsm_action t313effect;
+static struct ufsm_transition t314;
+static struct ufsm_action t314effect;
+static struct ufsm_guard t314guard;
+static struct ufsm_transition t315;
+static struct ufsm_action t315effect;
+static struct ufsm_transition t316;
+static struct ufsm_action t316effect;
+static struct ufsm_transition t317;
+static struct ufsm_action t317effect;
+static struct ufsm_transition t318;
+static struct ufsm_action t318effect;
+static struct ufsm_transition t319;
+static struct ufsm_action t319effect;
+static struct ufsm_guard t319guard;
+static struct ufsm_transition t320;
+static struct ufsm_action t320effect;
+static struct ufsm_guard t320guard;
+static struct ufsm_state s154;
+static struct ufsm_entry_exit s154entry;
+static struct ufsm_entry_exit s154exit;
+static struct ufsm_state s153;
+static struct ufsm_entry_exit s153entry;
+static struct ufsm_entry_exit s153exit;
+static struct ufsm_state s152;
+static struct ufsm_entry_exit s152entry;
+static struct ufsm_entry_exit s152exit;
+static struct ufsm_state s151;
+static struct ufsm_entry_exit s151entry;
+static struct ufsm_entry_exit s151exit;
+static struct ufsm_state s150;
+static struct ufsm_region r29;
+static struct ufsm_transition t29;
+static struct ufsm_action t29effect;
+static struct ufsm_transition t305;
+static struct ufsm_action t305effect;
+static struct ufsm_transition t306;
+static struct ufsm_action t306effect;
+static struct ufsm_guard t306guard;
+static struct ufsm_transition t307;
+static struct ufsm_action t307effect;
+static struct ufsm_guard t307guard;
+static struct ufsm_transition t308;
+static struct ufsm_action t308effect;
+static struct ufsm_transition t309;
+static struct ufsm_action t309effect;
+static struct ufsm_transition t310;
+static struct ufsm_action t310effect;
+static struct ufsm_transition t311;
+static struct ufsm_action t311effect;
+static struct ufsm_transition t312;
+static struct ufsm_action t312effect;
+static struct ufsm_state s149;
+static struct ufsm_entry_exit s149entry;
+static struct ufsm_entry_exit s149exit;
+static struct ufsm_state s148;
+static struct ufsm_entry_exit s148entry;
+static struct ufsm_entry_exit s148exit;
+static struct ufsm_state s147;
+static struct ufsm_entry_exit s147entry;
+static struct ufsm_entry_exit s147exit;
+static struct ufsm_state s146;
+static struct ufsm_entry_exit s146entry;
+static struct ufsm_entry_exit s146exit;
+static struct ufsm_state s145;
+static struct ufsm_entry_exit s18entry;
+static struct ufsm_entry_exit s18exit;
+static struct ufsm_state s17;
+static struct ufsm_region r28;
+static struct ufsm_transition t28;
+static struct ufsm_action t28effect;
+static struct ufsm_transition t297;
+static struct ufsm_action t297effect;
+static struct ufsm_transition t298;
+static struct ufsm_action t298effect;
+static struct ufsm_guard t298guard;
+static struct ufsm_transition t299;
+static struct ufsm_action t299effect;
+static struct ufsm_transition t300;
+static struct ufsm_action t300effect;
+static struct ufsm_transition t301;
+static struct ufsm_action t301effect;
+static struct ufsm_transition t302;
+static struct ufsm_action t302effect;
+static struct ufsm_guard t302guard;
+static struct ufsm_transition t303;
+static struct ufsm_action t303effect;
+static struct ufsm_transition t304;
+static struct ufsm_action t304effect;
+static struct ufsm_state s144;
+static struct ufsm_entry_exit s144entry;
+static struct ufsm_entry_exit s144exit;
+static struct ufsm_state s143;
+static struct ufsm_entry_exit s143entry;
+static struct ufsm_entry_exit s143exit;
+static struct ufsm_state s142;
+static struct ufsm_entry_exit s142entry;
+static struct ufsm_entry_exit s142exit;
+static struct ufsm_state s141;
+static struct ufsm_entry_exit s141entry;
+static struct ufsm_entry_exit s141exit;
+static struct ufsm_state s140;
+static struct ufsm_region r27;
+static struct ufsm_transition t27;
+static struct ufsm_action t27effect;
+static struct ufsm_transition t289;
+static struct ufsm_action t289effect;
+static struct ufsm_guard t289guard;
+static struct ufsm_transition t290;
+static struct ufsm_action t290effect;
+static struct ufsm_transition t291;
+static struct ufsm_action t291effect;
+static struct ufsm_transition t292;
+static struct ufsm_action t292effect;
+static struct ufsm_transition t293;
+static struct ufsm_action t293effect;
+static struct ufsm_transition t294;
+static struct ufsm_action t294effect;
+static struct ufsm_guard t294guard;
+static struct ufsm_transition t295;
+static struct ufsm_action t295effect;
+static struct ufsm_guard t295guard;
+static struct ufsm_transition t296;
+static struct ufsm_action t296effect;
+static struct ufsm_state s139;
+static struct ufsm_entry_exit s139entry;
+static struct ufsm_entry_exit s139exit;
+static struct ufsm_state s138;
+static struct ufsm_entry_exit s138entry;
+static struct ufsm_entry_exit s138exit;
+static struct ufsm_state s137;
+static struct ufsm_entry_exit s137entry;
+static struct ufsm_entry_exit s137exit;
+static struct ufsm_state s136;
+static struct ufsm_entry_exit s136entry;
+static struct ufsm_entry_exit s136exit;
+static struct ufsm_state s135;
+static struct ufsm_entry_exit s17entry;
+static struct ufsm_entry_exit s17exit;
+static struct ufsm_state s16;
+static struct ufsm_region r26;
+static struct ufsm_transition t26;
+static struct ufsm_action t26effect;
+static struct ufsm_transition t281;
+static struct ufsm_action t281effect;
+static struct ufsm_transition t282;
+static struct ufsm_action t282effect;
+static struct ufsm_transition t283;
+static struct ufsm_action t283effect;
+static struct ufsm_transition t284;
+static struct ufsm_action t284effect;
+static struct ufsm_transition t285;
+static struct ufsm_action t285effect;
+static struct ufsm_transition t286;
+static struct ufsm_action t286effect;
+static struct ufsm_guard t286guard;
+static struct ufsm_transition t287;
+static struct ufsm_action t287effect;
+static struct ufsm_guard t287guard;
+static struct ufsm_transition t288;
+static struct ufsm_action t288effect;
+static struct ufsm_guard t288guard;
+static struct ufsm_state s134;
+static struct ufsm_entry_exit s134entry;
+static struct ufsm_entry_exit s134exit;
+static struct ufsm_state s133;
+static struct ufsm_entry_exit s133entry;
+static struct ufsm_entry_exit s133exit;
+static struct ufsm_state s132;
+static struct ufsm_entry_exit s132entry;
+static struct ufsm_entry_exit s132exit;
+static struct ufsm_state s131;
+static struct ufsm_entry_exit s131entry;
+static struct ufsm_entry_exit s131exit;
+static struct ufsm_state s130;
+static struct ufsm_region r25;
+static struct ufsm_transition t25;
+static struct ufsm_action t25effect;
+static struct ufsm_transition t273;
+static struct ufsm_action t273effect;
+static struct ufsm_transition t274;
+static struct ufsm_action t274effect;
+static struct ufsm_transition t275;
+static struct ufsm_action t275effect;
+static struct ufsm_guard t275guard;
+static struct ufsm_transition t276;
+static struct ufsm_action t276effect;
+static struct ufsm_guard t276guard;
+static struct ufsm_transition t277;
+static struct ufsm_action t277effect;
+static struct ufsm_transition t278;
+static struct ufsm_action t278effect;
+static struct ufsm_transition t279;
+static struct ufsm_action t279effect;
+static struct ufsm_transition t280;
+static struct ufsm_action t280effect;
+static struct ufsm_guard t280guard;
+static struct ufsm_state s129;
+static struct ufsm_entry_exit s129entry;
+static struct ufsm_entry_exit s129exit;
+static struct ufsm_state s128;
+static struct ufsm_entry_exit s128entry;
+static struct ufsm_entry_exit s128exit;
+static struct ufsm_state s127;
+static struct ufsm_entry_exit s127entry;
+static struct ufsm_entry_exit s127exit;
+static struct ufsm_state s126;
+static struct ufsm_entry_exit s126entry;
+static struct ufsm_entry_exit s126exit;
+static struct ufsm_state s125;
+static struct ufsm_entry_exit s16entry;
+static struct ufsm_entry_exit s16exit;
+static struct ufsm_state s15;
+static struct ufsm_entry_exit s2entry;
+static struct ufsm_entry_exit s2exit;
+static struct ufsm_state s1;
+static struct ufsm_region r2;
+static struct ufsm_transition t2;
+static struct ufsm_action t2effect;
+static struct ufsm_transition t89;
+static struct ufsm_action t89effect;
+static struct ufsm_guard t89guard;
+static struct ufsm_transition t90;
+static struct ufsm_action t90effect;
+static struct ufsm_transition t91;
+static struct ufsm_action t91effect;
+static struct ufsm_transition t92;
+static struct ufsm_action t92effect;
+static struct ufsm_transition t93;
+static struct ufsm_action t93effect;
+static struct ufsm_guard t93guard;
+static struct ufsm_transition t94;
+static struct ufsm_action t94effect;
+static struct ufsm_guard t94guard;
+static struct ufsm_transition t95;
+static struct ufsm_action t95effect;
+static struct ufsm_transition t96;
+static struct ufsm_action t96effect;
+static struct ufsm_state s14;
+static struct ufsm_region r24;
+static struct ufsm_transition t24;
+static struct ufsm_action t24effect;
+static struct ufsm_transition t265;
+static struct ufsm_action t265effect;
+static struct ufsm_transition t266;
+static struct ufsm_action t266effect;
+static struct ufsm_transition t267;
+static struct ufsm_action t267effect;
+static struct ufsm_transition t268;
+static struct ufsm_action t268effect;
+static struct ufsm_guard t268guard;
+static struct ufsm_transition t269;
+static struct ufsm_action t269effect;
+static struct ufsm_guard t269guard;
+static struct ufsm_transition t270;
+static struct ufsm_action t270effect;
+static struct ufsm_transition t271;
+static struct ufsm_action t271effect;
+static struct ufsm_guard t271guard;
+static struct ufsm_transition t272;
+static struct ufsm_action t272effect;
+static struct ufsm_transition t663;
+static struct ufsm_action t663effect;
+static struct ufsm_transition t664;
+static struct ufsm_action t664effect;
+static struct ufsm_guard t664guard;
+static struct ufsm_transition t665;
+static struct ufsm_action t665effect;
+static struct ufsm_state s124;
+static struct ufsm_entry_exit s124entry;
+static struct ufsm_entry_exit s124exit;
+static struct ufsm_state s123;
+static struct ufsm_entry_exit s123entry;
+static struct ufsm_entry_exit s123exit;
+static struct ufsm_state s122;
+static struct ufsm_entry_exit s122entry;
+static struct ufsm_entry_exit s122exit;
+static struct ufsm_state s121;
+static struct ufsm_entry_exit s121entry;
+static struct ufsm_entry_exit s121exit;
+static struct ufsm_state s367;
+static struct ufsm_state s120;
+static struct ufsm_region r23;
+static struct ufsm_transition t23;
+static struct ufsm_action t23effect;
+static struct ufsm_transition t257;
+static struct ufsm_action t257effect;
+static struct ufsm_transition t258;
+static struct ufsm_action t258effect;
+static struct ufsm_transition t259;
+static struct ufsm_action t259effect;
+static struct ufsm_transition t260;
+static struct ufsm_action t260effect;
+static struct ufsm_transition t261;
+static struct ufsm_action t261effect;
+static struct ufsm_transition t262;
+static struct ufsm_action t262effect;
+static struct ufsm_transition t263;
+static struct ufsm_action t263effect;
+static struct ufsm_transition t264;
+static struct ufsm_action t264effect;
+static struct ufsm_transition t660;
+static struct ufsm_action t660effect;
+static struct ufsm_guard t660guard;
+static struct ufsm_transition t661;
+static struct ufsm_action t661effect;
+static struct ufsm_guard t661guard;
+static struct ufsm_transition t662;
+static struct ufsm_action t662effect;
+static struct ufsm_state s119;
+static struct ufsm_entry_exit s119entry;
+static struct ufsm_entry_exit s119exit;
+static struct ufsm_state s118;
+static struct ufsm_entry_exit s118entry;
+static struct ufsm_entry_exit s118exit;
+static struct ufsm_state s117;
+static struct ufsm_entry_exit s117entry;
+static struct ufsm_entry_exit s117exit;
+static struct ufsm_state s116;
+static struct ufsm_entry_exit s116entry;
+static struct ufsm_entry_exit s116exit;
+static struct ufsm_state s366;
+static struct ufsm_state s115;
+static struct ufsm_entry_exit s14entry;
+static struct ufsm_entry_exit s14exit;
+static struct ufsm_state s13;
+static struct ufsm_region r22;
+static struct ufsm_transition t22;
+static struct ufsm_action t22effect;
+static struct ufsm_transition t249;
+static struct ufsm_action t249effect;
+static struct ufsm_guard t249guard;
+static struct ufsm_transition t250;
+static struct ufsm_action t250effect;
+static struct ufsm_transition t251;
+static struct ufsm_action t251effect;
+static struct ufsm_transition t252;
+static struct ufsm_action t252effect;
+static struct ufsm_transition t253;
+static struct ufsm_action t253effect;
+static struct ufsm_transition t254;
+static struct ufsm_action t254effect;
+static struct ufsm_transition t255;
+static struct ufsm_action t255effect;
+static struct ufsm_transition t256;
+static struct ufsm_action t256effect;
+static struct ufsm_state s114;
+static struct ufsm_entry_exit s114entry;
+static struct ufsm_entry_exit s114exit;
+static struct ufsm_state s113;
+static struct ufsm_entry_exit s113entry;
+static struct ufsm_entry_exit s113exit;
+static struct ufsm_state s112;
+static struct ufsm_entry_exit s112entry;
+static struct ufsm_entry_exit s112exit;
+static struct ufsm_state s111;
+static struct ufsm_entry_exit s111entry;
+static struct ufsm_entry_exit s111exit;
+static struct ufsm_state s110;
+static struct ufsm_region r21;
+static struct ufsm_transition t21;
+static struct ufsm_action t21effect;
+static struct ufsm_transition t241;
+static struct ufsm_action t241effect;
+static struct ufsm_transition t242;
+static struct ufsm_action t242effect;
+static struct ufsm_transition t243;
+static struct ufsm_action t243effect;
+static struct ufsm_transition t244;
+static struct ufsm_action t244effect;
+static struct ufsm_guard t244guard;
+static struct ufsm_transition t245;
+static struct ufsm_action t245effect;
+static struct ufsm_transition t246;
+static struct ufsm_action t246effect;
+static struct ufsm_transition t247;
+static struct ufsm_action t247effect;
+static struct ufsm_transition t248;
+static struct ufsm_action t248effect;
+static struct ufsm_transition t675;
+static struct ufsm_action t675effect;
+static struct ufsm_guard t675guard;
+static struct ufsm_transition t676;
+static struct ufsm_action t676effect;
+static struct ufsm_state s109;
+static struct ufsm_entry_exit s109entry;
+static struct ufsm_entry_exit s109exit;
+static struct ufsm_state s108;
+static struct ufsm_entry_exit s108entry;
+static struct ufsm_entry_exit s108exit;
+static struct ufsm_state s107;
+static struct ufsm_entry_exit s107entry;
+static struct ufsm_entry_exit s107exit;
+static struct ufsm_state s106;
+static struct ufsm_entry_exit s106entry;
+static struct ufsm_entry_exit s106exit;
+static struct ufsm_state s372;
+static struct ufsm_state s105;
+static struct ufsm_entry_exit s13entry;
+static struct ufsm_entry_exit s13exit;
+static struct ufsm_state s12;
+static struct ufsm_region r20;
+static struct ufsm_transition t20;
+static struct ufsm_action t20effect;
+static struct ufsm_transition t233;
+static struct ufsm_action t233effect;
+static struct ufsm_transition t234;
+static struct ufsm_action t234effect;
+static struct ufsm_guard t234guard;
+static struct ufsm_transition t235;
+static struct ufsm_action t235effect;
+static struct ufsm_guard t235guard;
+static struct ufsm_transition t236;
+static struct ufsm_action t236effect;
+static struct ufsm_transition t237;
+static struct ufsm_action t237effect;
+static struct ufsm_guard t237guard;
+static struct ufsm_transition t238;
+static struct ufsm_action t238effect;
+static struct ufsm_transition t239;
+static struct ufsm_action t239effect;
+static struct ufsm_guard t239guard;
+static struct ufsm_transition t240;
+static struct ufsm_action t240effect;
+static struct ufsm_state s104;
+static struct ufsm_entry_exit s104entry;
+static struct ufsm_entry_exit s104exit;
+static struct ufsm_state s103;
+static struct ufsm_entry_exit s103entry;
+static struct ufsm_entry_exit s103exit;
+static struct ufsm_state s102;
+static struct ufsm_entry_exit s102entry;
+static struct ufsm_entry_exit s102exit;
+static struct ufsm_state s101;
+static struct ufsm_entry_exit s101entry;
+static struct ufsm_entry_exit s101exit;
+static struct ufsm_state s100;
+static struct ufsm_region r19;
+static struct ufsm_transition t19;
+static struct ufsm_action t19effect;
+static struct ufsm_transition t225;
+static struct ufsm_action t225effect;
+static struct ufsm_guard t225guard;
+static struct ufsm_transition t226;
+static struct ufsm_action t226effect;
+static struct ufsm_guard t226guard;
+static struct ufsm_transition t227;
+static struct ufsm_action t227effect;
+static struct ufsm_transition t228;
+static struct ufsm_action t228effect;
+static struct ufsm_transition t229;
+static struct ufsm_action t229effect;
+static struct ufsm_guard t229guard;
+static struct ufsm_transition t230;
+static struct ufsm_action t230effect;
+static struct ufsm_guard t230guard;
+static struct ufsm_transition t231;
+static struct ufsm_action t231effect;
+static struct ufsm_transition t232;
+static struct ufsm_action t232effect;
+static struct ufsm_state s99;
+static struct ufsm_entry_exit s99entry;
+static struct ufsm_entry_exit s99exit;
+static struct ufsm_state s98;
+static struct ufsm_entry_exit s98entry;
+static struct ufsm_entry_exit s98exit;
+static struct ufsm_state s97;
+static struct ufsm_entry_exit s97entry;
+static struct ufsm_entry_exit s97exit;
+static struct ufsm_state s96;
+static struct ufsm_entry_exit s96entry;
+static struct ufsm_entry_exit s96exit;
+static struct ufsm_state s95;
+static struct ufsm_entry_exit s12entry;
+static struct ufsm_entry_exit s12exit;
+static struct ufsm_state s11;
+static struct ufsm_region r18;
+static struct ufsm_transition t18;
+static struct ufsm_action t18effect;
+static struct ufsm_transition t217;
+static struct ufsm_action t217effect;
+static struct ufsm_transition t218;
+static struct ufsm_action t218effect;
+static struct ufsm_transition t219;
+static struct ufsm_action t219effect;
+static struct ufsm_transition t220;
+static struct ufsm_action t220effect;
+static struct ufsm_transition t221;
+static struct ufsm_action t221effect;
+static struct ufsm_transition t222;
+static struct ufsm_action t222effect;
+static struct ufsm_transition t223;
+static struct ufsm_action t223effect;
+static struct ufsm_transition t224;
+static struct ufsm_action t224effect;
+static struct ufsm_guard t224guard;
+static struct ufsm_state s94;
+static struct ufsm_entry_exit s94entry;
+static struct ufsm_entry_exit s94exit;
+static struct ufsm_state s93;
+static struct ufsm_entry_exit s93entry;
+static struct ufsm_entry_exit s93exit;
+static struct ufsm_state s92;
+static struct ufsm_entry_exit s92entry;
+static struct ufsm_entry_exit s92exit;
+static struct ufsm_state s91;
+static struct ufsm_entry_exit s91entry;
+static struct ufsm_entry_exit s91exit;
+static struct ufsm_state s90;
+static struct ufsm_region r17;
+static struct ufsm_transition t17;
+static struct ufsm_action t17effect;
+static struct ufsm_transition t209;
+static struct ufsm_action t209effect;
+static struct ufsm_guard t209guard;
+static struct ufsm_transition t210;
+static struct ufsm_action t210effect;
+static struct ufsm_transition t211;
+static struct ufsm_action t211effect;
+static struct ufsm_transition t212;
+static struct ufsm_action t212effect;
+static struct ufsm_guard t212guard;
+static struct ufsm_transition t213;
+static struct ufsm_action t213effect;
+static struct ufsm_transition t214;
+static struct ufsm_action t214effect;
+static struct ufsm_guard t214guard;
+static struct ufsm_transition t215;
+static struct ufsm_action t215effect;
+static struct ufsm_transition t216;
+static struct ufsm_action t216effect;
+static struct ufsm_guard t216guard;
+static struct ufsm_state s89;
+static struct ufsm_entry_exit s89entry;
+static struct ufsm_entry_exit s89exit;
+static struct ufsm_state s88;
+static struct ufsm_entry_exit s88entry;
+static struct ufsm_entry_exit s88exit;
+static struct ufsm_state s87;
+static struct ufsm_entry_exit s87entry;
+static struct ufsm_entry_exit s87exit;
+static struct ufsm_state s86;
+static struct ufsm_entry_exit s86entry;
+static struct ufsm_entry_exit s86exit;
+static struct ufsm_state s85;
+static struct ufsm_entry_exit s11entry;
+static struct ufsm_entry_exit s11exit;
+static struct ufsm_state s10;
+static struct ufsm_region r1;
+static struct ufsm_transition t1;
+static struct ufsm_action t1effect;
+static struct ufsm_transition t81;
+static struct ufsm_action t81effect;
+static struct ufsm_transition t82;
+static struct ufsm_action t82effect;
+static struct ufsm_guard t82guard;
+static struct ufsm_transition t83;
+static struct ufsm_action t83effect;
+static struct ufsm_transition t84;
+static struct ufsm_action t84effect;
+static struct ufsm_transition t85;
+static struct ufsm_action t85effect;
+static struct ufsm_transition t86;
+static struct ufsm_action t86effect;
+static struct ufsm_transition t87;
+static struct ufsm_action t87effect;
+static struct ufsm_guard t87guard;
+static struct ufsm_transition t88;
+static struct ufsm_action t88effect;
+static struct ufsm_transition t695;
+static struct ufsm_action t695effect;
+static struct ufsm_transition t696;
+static struct ufsm_action t696effect;
+static struct ufsm_transition t697;
+static struct ufsm_action t697effect;
+static struct ufsm_transition t700;
+static struct ufsm_action t700effect;
+static struct ufsm_transition t702;
+static struct ufsm_action t702effect;
+static struct ufsm_transition t703;
+static struct ufsm_action t703effect;
+static struct ufsm_state s9;
+static struct ufsm_region r16;
+static struct ufsm_transition t16;
+static struct ufsm_action t16effect;
+static struct ufsm_transition t201;
+static struct ufsm_action t201effect;
+static struct ufsm_guard t201guard;
+static struct ufsm_transition t202;
+static struct ufsm_action t202effect;
+static struct ufsm_transition t203;
+static struct ufsm_action t203effect;
+static struct ufsm_transition t204;
+static struct ufsm_action t204effect;
+static struct ufsm_guard t204guard;
+static struct ufsm_transition t205;
+static struct ufsm_action t205effect;
+static struct ufsm_transition t206;
+static struct ufsm_action t206effect;
+static struct ufsm_transition t207;
+static struct ufsm_action t207effect;
+static struct ufsm_transition t208;
+static struct ufsm_action t208effect;
+static struct ufsm_transition t699;
+static struct ufsm_action t699effect;
+static struct ufsm_state s84;
+static struct ufsm_entry_exit s84entry;
+static struct ufsm_entry_exit s84exit;
+static struct ufsm_state s83;
+static struct ufsm_entry_exit s83entry;
+static struct ufsm_entry_exit s83exit;
+static struct ufsm_state s82;
+static struct ufsm_entry_exit s82entry;
+static struct ufsm_entry_exit s82exit;
+static struct ufsm_state s81;
+static struct ufsm_entry_exit s81entry;
+static struct ufsm_entry_exit s81exit;
+static struct ufsm_state s80;
+static struct ufsm_region r15;
+static struct ufsm_transition t15;
+static struct ufsm_action t15effect;
+static struct ufsm_transition t193;
+static struct ufsm_action t193effect;
+static struct ufsm_transition t194;
+static struct ufsm_action t194effect;
+static struct ufsm_transition t195;
+static struct ufsm_action t195effect;
+static struct ufsm_transition t196;
+static struct ufsm_action t196effect;
+static struct ufsm_transition t197;
+static struct ufsm_action t197effect;
+static struct ufsm_transition t198;
+static struct ufsm_action t198effect;
+static struct ufsm_guard t198guard;
+static struct ufsm_transition t199;
+static struct ufsm_action t199effect;
+static struct ufsm_transition t200;
+static struct ufsm_action t200effect;
+static struct ufsm_transition t698;
+static struct ufsm_action t698effect;
+static struct ufsm_state s79;
+static struct ufsm_entry_exit s79entry;
+static struct ufsm_entry_exit s79exit;
+static struct ufsm_state s78;
+static struct ufsm_entry_exit s78entry;
+static struct ufsm_entry_exit s78exit;
+static struct ufsm_state s77;
+static struct ufsm_entry_exit s77entry;
+static struct ufsm_entry_exit s77exit;
+static struct ufsm_state s76;
+static struct ufsm_entry_exit s76entry;
+static struct ufsm_entry_exit s76exit;
+static struct ufsm_state s75;
+static struct ufsm_entry_exit s9entry;
+static struct ufsm_entry_exit s9exit;
+static struct ufsm_state s8;
+static struct ufsm_region r14;
+static struct ufsm_transition t14;
+static struct ufsm_action t14effect;
+static struct ufsm_transition t185;
+static struct ufsm_action t185effect;
+static struct ufsm_guard t185guard;
+static struct ufsm_transition t186;
+static struct ufsm_action t186effect;
+static struct ufsm_transition t187;
+static struct ufsm_action t187effect;
+static struct ufsm_transition t188;
+static struct ufsm_action t188effect;
+static struct ufsm_transition t189;
+static struct ufsm_action t189effect;
+static struct ufsm_transition t190;
+static struct ufsm_action t190effect;
+static struct ufsm_transition t191;
+static struct ufsm_action t191effect;
+static struct ufsm_transition t192;
+static struct ufsm_action t192effect;
+static struct ufsm_guard t192guard;
+static struct ufsm_state s74;
+static struct ufsm_entry_exit s74entry;
+static struct ufsm_entry_exit s74exit;
+static struct ufsm_state s73;
+static struct ufsm_entry_exit s73entry;
+static struct ufsm_entry_exit s73exit;
+static struct ufsm_state s72;
+static struct ufsm_entry_exit s72entry;
+static struct ufsm_entry_exit s72exit;
+static struct ufsm_state s71;
+static struct ufsm_entry_exit s71entry;
+static struct ufsm_entry_exit s71exit;
+static struct ufsm_state s70;
+static struct ufsm_region r13;
+static struct ufsm_transition t13;
+static struct ufsm_action t13effect;
+static struct ufsm_transition t177;
+static struct ufsm_action t177effect;
+static struct ufsm_transition t178;
+static struct ufsm_action t178effect;
+static struct ufsm_transition t179;
+static struct ufsm_action t179effect;
+static struct ufsm_transition t180;
+static struct ufsm_action t180effect;
+static struct ufsm_guard t180guard;
+static struct ufsm_transition t181;
+static struct ufsm_action t181effect;
+static struct ufsm_transition t182;
+static struct ufsm_action t182effect;
+static struct ufsm_transition t183;
+static struct ufsm_action t183effect;
+static struct ufsm_transition t184;
+static struct ufsm_action t184effect;
+static struct ufsm_guard t184guard;
+static struct ufsm_state s69;
+static struct ufsm_entry_exit s69entry;
+static struct ufsm_entry_exit s69exit;
+static struct ufsm_state s68;
+static struct ufsm_entry_exit s68entry;
+static struct ufsm_entry_exit s68exit;
+static struct ufsm_state s67;
+static struct ufsm_entry_exit s67entry;
+static struct ufsm_entry_exit s67exit;
+static struct ufsm_state s66;
+static struct ufsm_entry_exit s66entry;
+static struct ufsm_entry_exit s66exit;
+static struct ufsm_state s65;
+static struct ufsm_entry_exit s8entry;
+static struct ufsm_entry_exit s8exit;
+static struct ufsm_state s7;
+static struct ufsm_region r12;
+static struct ufsm_transition t12;
+static struct ufsm_action t12effect;
+static struct ufsm_transition t169;
+static struct ufsm_action t169effect;
+static struct ufsm_transition t170;
+static struct ufsm_action t170effect;
+static struct ufsm_transition t171;
+static struct ufsm_action t171effect;
+static struct ufsm_transition t172;
+static struct ufsm_action t172effect;
+static struct ufsm_transition t173;
+static struct ufsm_action t173effect;
+static struct ufsm_transition t174;
+static struct ufsm_action t174effect;
+static struct ufsm_transition t175;
+static struct ufsm_action t175effect;
+static struct ufsm_transition t176;
+static struct ufsm_action t176effect;
+static struct ufsm_state s64;
+static struct ufsm_entry_exit s64entry;
+static struct ufsm_entry_exit s64exit;
+static struct ufsm_state s63;
+static struct ufsm_entry_exit s63entry;
+static struct ufsm_entry_exit s63exit;
+static struct ufsm_state s62;
+static struct ufsm_entry_exit s62entry;
+static struct ufsm_entry_exit s62exit;
+static struct ufsm_state s61;
+static struct ufsm_entry_exit s61entry;
+static struct ufsm_entry_exit s61exit;
+static struct ufsm_state s60;
+static struct ufsm_region r11;
+static struct ufsm_transition t11;
+static struct ufsm_action t11effect;
+static struct ufsm_transition t161;
+static struct ufsm_action t161effect;
+static struct ufsm_guard t161guard;
+static struct ufsm_transition t162;
+static struct ufsm_action t162effect;
+static struct ufsm_transition t163;
+static struct ufsm_action t163effect;
+static struct ufsm_transition t164;
+static struct ufsm_action t164effect;
+static struct ufsm_transition t165;
+static struct ufsm_action t165effect;
+static struct ufsm_guard t165guard;
+static struct ufsm_transition t166;
+static struct ufsm_action t166effect;
+static struct ufsm_transition t167;
+static struct ufsm_action t167effect;
+static struct ufsm_transition t168;
+static struct ufsm_action t168effect;
+static struct ufsm_transition t701;
+static struct ufsm_action t701effect;
+static struct ufsm_state s59;
+static struct ufsm_entry_exit s59entry;
+static struct ufsm_entry_exit s59exit;
+static struct ufsm_state s58;
+static struct ufsm_entry_exit s58entry;
+static struct ufsm_entry_exit s58exit;
+static struct ufsm_state s57;
+static struct ufsm_entry_exit s57entry;
+static struct ufsm_entry_exit s57exit;
+static struct ufsm_state s56;
+static struct ufsm_entry_exit s56entry;
+static struct ufsm_entry_exit s56exit;
+static struct ufsm_state s381;
+static struct ufsm_state s55;
+static struct ufsm_entry_exit s7entry;
+static struct ufsm_entry_exit s7exit;
+static struct ufsm_state s6;
+static struct ufsm_region r10;
+static struct ufsm_transition t10;
+static struct ufsm_action t10effect;
+static struct ufsm_transition t153;
+static struct ufsm_action t153effect;
+static struct ufsm_transition t154;
+static struct ufsm_action t154effect;
+static struct ufsm_transition t155;
+static struct ufsm_action t155effect;
+static struct ufsm_transition t156;
+static struct ufsm_action t156effect;
+static struct ufsm_transition t157;
+static struct ufsm_action t157effect;
+static struct ufsm_guard t157guard;
+static struct ufsm_transition t158;
+static struct ufsm_action t158effect;
+static struct ufsm_guard t158guard;
+static struct ufsm_transition t159;
+static struct ufsm_action t159effect;
+static struct ufsm_transition t160;
+static struct ufsm_action t160effect;
+static struct ufsm_state s54;
+static struct ufsm_entry_exit s54entry;
+static struct ufsm_entry_exit s54exit;
+static struct ufsm_state s53;
+static struct ufsm_entry_exit s53entry;
+static struct ufsm_entry_exit s53exit;
+static struct ufsm_state s52;
+static struct ufsm_entry_exit s52entry;
+static struct ufsm_entry_exit s52exit;
+static struct ufsm_state s51;
+static struct ufsm_entry_exit s51entry;
+static struct ufsm_entry_exit s51exit;
+static struct ufsm_state s50;
+static struct ufsm_region r9;
+static struct ufsm_transition t9;
+static struct ufsm_action t9effect;
+static struct ufsm_transition t145;
+static struct ufsm_action t145effect;
+static struct ufsm_transition t146;
+static struct ufsm_action t146effect;
+static struct ufsm_transition t147;
+static struct ufsm_action t147effect;
+static struct ufsm_guard t147guard;
+static struct ufsm_transition t148;
+static struct ufsm_action t148effect;
+static struct ufsm_transition t149;
+static struct ufsm_action t149effect;
+static struct ufsm_transition t150;
+static struct ufsm_action t150effect;
+static struct ufsm_guard t150guard;
+static struct ufsm_transition t151;
+static struct ufsm_action t151effect;
+static struct ufsm_transition t152;
+static struct ufsm_action t152effect;
+static struct ufsm_state s49;
+static struct ufsm_entry_exit s49entry;
+static struct ufsm_entry_exit s49exit;
+static struct ufsm_state s48;
+static struct ufsm_entry_exit s48entry;
+static struct ufsm_entry_exit s48exit;
+static struct ufsm_state s47;
+static struct ufsm_entry_exit s47entry;
+static struct ufsm_entry_exit s47exit;
+static struct ufsm_state s46;
+static struct ufsm_entry_exit s46entry;
+static struct ufsm_entry_exit s46exit;
+static struct ufsm_state s45;
+static struct ufsm_entry_exit s6entry;
+static struct ufsm_entry_exit s6exit;
+static struct ufsm_state s382;
+static struct ufsm_state s380;
+static struct ufsm_state s379;
+static struct ufsm_state s5;
+static struct ufsm_entry_exit s1entry;
+static struct ufsm_entry_exit s1exit;
+static struct ufsm_state s376;
+static struct ufsm_state s375;
+static struct ufsm_state s0;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &s4,
+  &s3,
+  &s2,
+  &s1,
+  &s376,
+  &s375,
+  &s0,
+  &s14,
+  &s13,
+  &s12,
+  &s11,
+  &s10,
+  &s9,
+  &s8,
+  &s7,
+  &s6,
+  &s382,
+  &s380,
+  &s379,
+  &s5,
+  &s54,
+  &s53,
+  &s52,
+  &s51,
+  &s50,
+  &s49,
+  &s48,
+  &s47,
+  &s46,
+  &s45,
+  &s64,
+  &s63,
+  &s62,
+  &s61,
+  &s60,
+  &s59,
+  &s58,
+  &s57,
+  &s56,
+  &s381,
+  &s55,
+  &s74,
+  &s73,
+  &s72,
+  &s71,
+  &s70,
+  &s69,
+  &s68,
+  &s67,
+  &s66,
+  &s65,
+  &s84,
+  &s83,
+  &s82,
+  &s81,
+  &s80,
+  &s79,
+  &s78,
+  &s77,
+  &s76,
+  &s75,
+  &s94,
+  &s93,
+  &s92,
+  &s91,
+  &s90,
+  &s89,
+  &s88,
+  &s87,
+  &s86,
+  &s85,
+  &s104,
+  &s103,
+  &s102,
+  &s101,
+  &s100,
+  &s99,
+  &s98,
+  &s97,
+  &s96,
+  &s95,
+  &s114,
+  &s113,
+  &s112,
+  &s111,
+  &s110,
+  &s109,
+  &s108,
+  &s107,
+  &s106,
+  &s372,
+  &s105,
+  &s124,
+  &s123,
+  &s122,
+  &s121,
+  &s367,
+  &s120,
+  &s119,
+  &s118,
+  &s117,
+  &s116,
+  &s366,
+  &s115,
+  &s24,
+  &s23,
+  &s22,
+  &s21,
+  &s378,
+  &s377,
+  &s20,
+  &s19,
+  &s18,
+  &s17,
+  &s16,
+  &s15,
+  &s134,
+  &s133,
+  &s132,
+  &s131,
+  &s130,
+  &s129,
+  &s128,
+  &s127,
+  &s126,
+  &s125,
+  &s144,
+  &s143,
+  &s142,
+  &s141,
+  &s140,
+  &s139,
+  &s138,
+  &s137,
+  &s136,
+  &s135,
+  &s154,
+  &s153,
+  &s152,
+  &s151,
+  &s150,
+  &s149,
+  &s148,
+  &s147,
+  &s146,
+  &s145,
+  &s164,
+  &s163,
+  &s162,
+  &s161,
+  &s370,
+  &s160,
+  &s159,
+  &s158,
+  &s157,
+  &s156,
+  &s155,
+  &s174,
+  &s173,
+  &s172,
+  &s171,
+  &s170,
+  &s169,
+  &s168,
+  &s167,
+  &s166,
+  &s165,
+  &s184,
+  &s183,
+  &s182,
+  &s181,
+  &s180,
+  &s179,
+  &s178,
+  &s177,
+  &s176,
+  &s369,
+  &s368,
+  &s175,
+  &s194,
+  &s193,
+  &s192,
+  &s191,
+  &s190,
+  &s189,
+  &s188,
+  &s187,
+  &s186,
+  &s185,
+  &s204,
+  &s203,
+  &s202,
+  &s201,
+  &s200,
+  &s199,
+  &s198,
+  &s197,
+  &s196,
+  &s195,
+  &s34,
+  &s33,
+  &s32,
+  &s31,
+  &s30,
+  &s29,
+  &s28,
+  &s27,
+  &s26,
+  &s25,
+  &s214,
+  &s213,
+  &s212,
+  &s211,
+  &s210,
+  &s209,
+  &s208,
+  &s207,
+  &s206,
+  &s383,
+  &s205,
+  &s224,
+  &s223,
+  &s222,
+  &s221,
+  &s220,
+  &s219,
+  &s218,
+  &s217,
+  &s216,
+  &s215,
+  &s234,
+  &s233,
+  &s232,
+  &s231,
+  &s230,
+  &s229,
+  &s228,
+  &s227,
+  &s226,
+  &s225,
+  &s244,
+  &s243,
+  &s242,
+  &s241,
+  &s240,
+  &s239,
+  &s238,
+  &s237,
+  &s236,
+  &s235,
+  &s254,
+  &s253,
+  &s252,
+  &s251,
+  &s250,
+  &s249,
+  &s248,
+  &s247,
+  &s246,
+  &s245,
+  &s264,
+  &s263,
+  &s262,
+  &s261,
+  &s260,
+  &s259,
+  &s258,
+  &s257,
+  &s256,
+  &s255,
+  &s274,
+  &s273,
+  &s272,
+  &s271,
+  &s270,
+  &s269,
+  &s268,
+  &s267,
+  &s266,
+  &s265,
+  &s284,
+  &s283,
+  &s282,
+  &s281,
+  &s280,
+  &s279,
+  &s278,
+  &s277,
+  &s276,
+  &s275,
+  &s44,
+  &s43,
+  &s42,
+  &s41,
+  &s40,
+  &s39,
+  &s38,
+  &s37,
+  &s36,
+  &s374,
+  &s373,
+  &s35,
+  &s294,
+  &s293,
+  &s292,
+  &s291,
+  &s290,
+  &s289,
+  &s288,
+  &s287,
+  &s286,
+  &s285,
+  &s304,
+  &s303,
+  &s302,
+  &s301,
+  &s300,
+  &s299,
+  &s298,
+  &s297,
+  &s296,
+  &s371,
+  &s295,
+  &s314,
+  &s313,
+  &s312,
+  &s311,
+  &s310,
+  &s309,
+  &s308,
+  &s307,
+  &s306,
+  &s305,
+  &s324,
+  &s323,
+  &s322,
+  &s321,
+  &s320,
+  &s319,
+  &s318,
+  &s317,
+  &s316,
+  &s315,
+  &s334,
+  &s333,
+  &s332,
+  &s331,
+  &s365,
+  &s330,
+  &s329,
+  &s328,
+  &s327,
+  &s326,
+  &s325,
+  &s344,
+  &s343,
+  &s342,
+  &s341,
+  &s340,
+  &s339,
+  &s338,
+  &s337,
+  &s336,
+  &s335,
+  &s354,
+  &s353,
+  &s352,
+  &s351,
+  &s350,
+  &s349,
+  &s348,
+  &s347,
+  &s346,
+  &s384,
+  &s345,
+  &s364,
+  &s363,
+  &s362,
+  &s361,
+  &s360,
+  &s359,
+  &s358,
+  &s357,
+  &s356,
+  &s355,
+};
+
+
+
+static void *machine_stack[234];
+static void *machine_stack2[7];
+static void *machine_completion_stack[3];
+static uint32_t machine_data[UFSM_MACHINE_DATA_SIZE(385)];
+static struct ufsm_event machine_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine machine = {
+  .id     = "machine", 
+  .name   = "test_gen_input", 
+  .region = &r0,    
+  .no_of_regions = 73,
+  .no_of_states = 385,
+  .states = ufsm_states,
+  .flat = false,
+  .no_of_events = 8,
+  .no_of_transitions = 709,
+  .context = {
+    .m = &machine,
+    .stack = {
+      .no_of_elements = 234,
+      .data = machine_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 7,
+      .data = machine_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 3,
+      .data = machine_completion_stack,
+    },
+  },
+  .data = machine_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = machine_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region r0 = {
+  .id = "r0",
+  .name = "R0",
+  .state = &s4,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &t0,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition t0 = {
+  .id = "t0",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = &t0effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s0,
+  .dest = &s1,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t73,
+};
+static struct ufsm_action t0effect = {
+  .id = "t0effect",
+  .name = "a0",
+  .f = &a0,
+  .next = NULL,
+};
+static struct ufsm_trigger t73_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t73 = {
+  .id = "t73",
+  .name = "",
+  .trigger = t73_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 2,
+  .action = &t73effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s1,
+  .dest = &s1,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t74,
+};
+static struct ufsm_action t73effect = {
+  .id = "t73effect",
+  .name = "a73",
+  .f = &a73,
+  .next = NULL,
+};
+static struct ufsm_trigger t74_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t74 = {
+  .id = "t74",
+  .name = "",
+  .trigger = t74_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 3,
+  .action = &t74effect,
+  .defer = false,
+  .guard = &t74guard,
+  .source = &s1,
+  .dest = &s2,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t75,
+};
+static struct ufsm_action t74effect = {
+  .id = "t74effect",
+  .name = "a74",
+  .f = &a74,
+  .next = NULL,
+};
+static struct ufsm_guard t74guard = {
+  .id = "t74guard",
+  .name = "g0",
+  .f = &g0,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t75_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t75_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t75_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t75 = {
+  .id = "t75",
+  .name = "",
+  .trigger = t75_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 4,
+  .action = &t75effect,
+  .defer = false,
+  .guard = &t75guard,
+  .source = &s2,
+  .dest = &s6,
+  .lca = &r0,
+  .exit_path = t75_exit_path,
+  .enter_path = t75_enter_path,
+  .next = &t76,
+};
+static struct ufsm_action t75effect = {
+  .id = "t75effect",
+  .name = "a75",
+  .f = &a75,
+  .next = NULL,
+};
+static struct ufsm_guard t75guard = {
+  .id = "t75guard",
+  .name = "g1",
+  .f = &g1,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t76_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t76 = {
+  .id = "t76",
+  .name = "",
+  .trigger = t76_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 5,
+  .action = &t76effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s2,
+  .dest = &s1,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t77,
+};
+static struct ufsm_action t76effect = {
+  .id = "t76effect",
+  .name = "a76",
+  .f = &a76,
+  .next = NULL,
+};
+static struct ufsm_trigger t77_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t77_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t77_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t77 = {
+  .id = "t77",
+  .name = "",
+  .trigger = t77_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 6,
+  .action = &t77effect,
+  .defer = false,
+  .guard = &t77guard,
+  .source = &s3,
+  .dest = &s44,
+  .lca = &r0,
+  .exit_path = t77_exit_path,
+  .enter_path = t77_enter_path,
+  .next = &t78,
+};
+static struct ufsm_action t77effect = {
+  .id = "t77effect",
+  .name = "a77",
+  .f = &a77,
+  .next = NULL,
+};
+static struct ufsm_guard t77guard = {
+  .id = "t77guard",
+  .name = "g2",
+  .f = &g2,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t78_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t78_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t78_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t78 = {
+  .id = "t78",
+  .name = "",
+  .trigger = t78_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 7,
+  .action = &t78effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s3,
+  .dest = &s7,
+  .lca = &r0,
+  .exit_path = t78_exit_path,
+  .enter_path = t78_enter_path,
+  .next = &t79,
+};
+static struct ufsm_action t78effect = {
+  .id = "t78effect",
+  .name = "a78",
+  .f = &a78,
+  .next = NULL,
+};
+static struct ufsm_trigger t79_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t79_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t79_enter_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_transition t79 = {
+  .id = "t79",
+  .name = "",
+  .trigger = t79_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 8,
+  .action = &t79effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s4,
+  .dest = &s29,
+  .lca = &r0,
+  .exit_path = t79_exit_path,
+  .enter_path = t79_enter_path,
+  .next = &t80,
+};
+static struct ufsm_action t79effect = {
+  .id = "t79effect",
+  .name = "a79",
+  .f = &a79,
+  .next = NULL,
+};
+static struct ufsm_trigger t80_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t80_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t80_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t80 = {
+  .id = "t80",
+  .name = "",
+  .trigger = t80_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 9,
+  .action = &t80effect,
+  .defer = false,
+  .guard = &t80guard,
+  .source = &s4,
+  .dest = &s44,
+  .lca = &r0,
+  .exit_path = t80_exit_path,
+  .enter_path = t80_enter_path,
+  .next = &t683,
+};
+static struct ufsm_action t80effect = {
+  .id = "t80effect",
+  .name = "a80",
+  .f = &a80,
+  .next = NULL,
+};
+static struct ufsm_guard t80guard = {
+  .id = "t80guard",
+  .name = "g3",
+  .f = &g3,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t683_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t683 = {
+  .id = "t683",
+  .name = "",
+  .trigger = t683_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 10,
+  .action = &t683effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s2,
+  .dest = &s375,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t684,
+};
+static struct ufsm_action t683effect = {
+  .id = "t683effect",
+  .name = "a683",
+  .f = &a683,
+  .next = NULL,
+};
+static struct ufsm_region * t684_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t684_enter_path[] = {
+  &r7,
+  NULL,
+};
+static struct ufsm_transition t684 = {
+  .id = "t684",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 11,
+  .action = &t684effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s375,
+  .dest = &s36,
+  .lca = &r0,
+  .exit_path = t684_exit_path,
+  .enter_path = t684_enter_path,
+  .next = &t685,
+};
+static struct ufsm_action t684effect = {
+  .id = "t684effect",
+  .name = "a684",
+  .f = &a684,
+  .next = NULL,
+};
+static struct ufsm_region * t685_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t685_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t685 = {
+  .id = "t685",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 12,
+  .action = &t685effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s375,
+  .dest = &s43,
+  .lca = &r0,
+  .exit_path = t685_exit_path,
+  .enter_path = t685_enter_path,
+  .next = &t688,
+};
+static struct ufsm_action t685effect = {
+  .id = "t685effect",
+  .name = "a685",
+  .f = &a685,
+  .next = NULL,
+};
+static struct ufsm_transition t688 = {
+  .id = "t688",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 13,
+  .action = &t688effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s376,
+  .dest = &s1,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t704,
+};
+static struct ufsm_action t688effect = {
+  .id = "t688effect",
+  .name = "a688",
+  .f = &a688,
+  .next = NULL,
+};
+static struct ufsm_trigger t704_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t704_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t704_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t704 = {
+  .id = "t704",
+  .name = "",
+  .trigger = t704_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 14,
+  .action = &t704effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s1,
+  .dest = &s382,
+  .lca = &r0,
+  .exit_path = t704_exit_path,
+  .enter_path = t704_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t704effect = {
+  .id = "t704effect",
+  .name = "a704",
+  .f = &a704,
+  .next = NULL,
+};
+static struct ufsm_transition * s4_dispatch_0[] = {
+  &t79,
+  &t80,
+  NULL,
+};
+static struct ufsm_dispatch s4_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s4_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s4_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state s4 = {
+  .id   = "s4",
+  .name = "S4",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &r0,
+  .entry = &s4entry,
+  .doact = NULL,
+  .exit = &s4exit,
+  .region = &r8,
+  .submachine = NULL,
+  .dispatch = s4_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s4_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s3,
+};
+static struct ufsm_region r8 = {
+  .id = "r8",
+  .name = "R8",
+  .state = &s44,
+  .has_history = false,
+  .history = NULL,
+  .index = 55,
+  .transition = &t8,
+  .parent_state = &s4,
+  .next = &r7,
+};
+static struct ufsm_transition t8 = {
+  .id = "t8",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 533,
+  .action = &t8effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s40,
+  .dest = &s43,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t137,
+};
+static struct ufsm_action t8effect = {
+  .id = "t8effect",
+  .name = "a8",
+  .f = &a8,
+  .next = NULL,
+};
+static struct ufsm_trigger t137_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t137_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t137_enter_path[] = {
+  &r72,
+  NULL,
+};
+static struct ufsm_transition t137 = {
+  .id = "t137",
+  .name = "",
+  .trigger = t137_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 534,
+  .action = &t137effect,
+  .defer = false,
+  .guard = &t137guard,
+  .source = &s41,
+  .dest = &s363,
+  .lca = &r8,
+  .exit_path = t137_exit_path,
+  .enter_path = t137_enter_path,
+  .next = &t138,
+};
+static struct ufsm_action t137effect = {
+  .id = "t137effect",
+  .name = "a137",
+  .f = &a137,
+  .next = NULL,
+};
+static struct ufsm_guard t137guard = {
+  .id = "t137guard",
+  .name = "g24",
+  .f = &g24,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t138_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t138 = {
+  .id = "t138",
+  .name = "",
+  .trigger = t138_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 535,
+  .action = &t138effect,
+  .defer = false,
+  .guard = &t138guard,
+  .source = &s41,
+  .dest = &s44,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t139,
+};
+static struct ufsm_action t138effect = {
+  .id = "t138effect",
+  .name = "a138",
+  .f = &a138,
+  .next = NULL,
+};
+static struct ufsm_guard t138guard = {
+  .id = "t138guard",
+  .name = "g25",
+  .f = &g25,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t139_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t139 = {
+  .id = "t139",
+  .name = "",
+  .trigger = t139_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 536,
+  .action = &t139effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s42,
+  .dest = &s44,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t140,
+};
+static struct ufsm_action t139effect = {
+  .id = "t139effect",
+  .name = "a139",
+  .f = &a139,
+  .next = NULL,
+};
+static struct ufsm_trigger t140_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t140_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t140_enter_path[] = {
+  &r70,
+  NULL,
+};
+static struct ufsm_transition t140 = {
+  .id = "t140",
+  .name = "",
+  .trigger = t140_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 537,
+  .action = &t140effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s42,
+  .dest = &s351,
+  .lca = &r8,
+  .exit_path = t140_exit_path,
+  .enter_path = t140_enter_path,
+  .next = &t141,
+};
+static struct ufsm_action t140effect = {
+  .id = "t140effect",
+  .name = "a140",
+  .f = &a140,
+  .next = NULL,
+};
+static struct ufsm_trigger t141_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t141 = {
+  .id = "t141",
+  .name = "",
+  .trigger = t141_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 538,
+  .action = &t141effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s43,
+  .dest = &s42,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t142,
+};
+static struct ufsm_action t141effect = {
+  .id = "t141effect",
+  .name = "a141",
+  .f = &a141,
+  .next = NULL,
+};
+static struct ufsm_trigger t142_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t142_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t142_enter_path[] = {
+  &r65,
+  NULL,
+};
+static struct ufsm_transition t142 = {
+  .id = "t142",
+  .name = "",
+  .trigger = t142_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 539,
+  .action = &t142effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s43,
+  .dest = &s329,
+  .lca = &r8,
+  .exit_path = t142_exit_path,
+  .enter_path = t142_enter_path,
+  .next = &t143,
+};
+static struct ufsm_action t142effect = {
+  .id = "t142effect",
+  .name = "a142",
+  .f = &a142,
+  .next = NULL,
+};
+static struct ufsm_trigger t143_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t143 = {
+  .id = "t143",
+  .name = "",
+  .trigger = t143_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 540,
+  .action = &t143effect,
+  .defer = false,
+  .guard = &t143guard,
+  .source = &s44,
+  .dest = &s44,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t144,
+};
+static struct ufsm_action t143effect = {
+  .id = "t143effect",
+  .name = "a143",
+  .f = &a143,
+  .next = NULL,
+};
+static struct ufsm_guard t143guard = {
+  .id = "t143guard",
+  .name = "g26",
+  .f = &g26,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t144_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t144 = {
+  .id = "t144",
+  .name = "",
+  .trigger = t144_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 541,
+  .action = &t144effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s44,
+  .dest = &s41,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t687,
+};
+static struct ufsm_action t144effect = {
+  .id = "t144effect",
+  .name = "a144",
+  .f = &a144,
+  .next = NULL,
+};
+static struct ufsm_transition t687 = {
+  .id = "t687",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 542,
+  .action = &t687effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s44,
+  .dest = &s376,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t708,
+};
+static struct ufsm_action t687effect = {
+  .id = "t687effect",
+  .name = "a687",
+  .f = &a687,
+  .next = NULL,
+};
+static struct ufsm_trigger t708_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t708_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t708_enter_path[] = {
+  &r69,
+  NULL,
+};
+static struct ufsm_transition t708 = {
+  .id = "t708",
+  .name = "",
+  .trigger = t708_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 543,
+  .action = &t708effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s43,
+  .dest = &s384,
+  .lca = &r8,
+  .exit_path = t708_exit_path,
+  .enter_path = t708_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t708effect = {
+  .id = "t708effect",
+  .name = "a708",
+  .f = &a708,
+  .next = NULL,
+};
+static struct ufsm_transition * s44_dispatch_6[] = {
+  &t143,
+  NULL,
+};
+static struct ufsm_transition * s44_dispatch_7[] = {
+  &t144,
+  NULL,
+};
+static struct ufsm_dispatch s44_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s44_dispatch_6,
+},
+{
+  .ev = 7,
+  .transition = s44_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s44_interest[] = {
+  0x000000c1,
+};
+static struct ufsm_state s44 = {
+  .id   = "s44",
+  .name = "S44",
+  .kind = 0,
+  .index = 291,
+  .parent_region = &r8,
+  .entry = &s44entry,
+  .doact = NULL,
+  .exit = &s44exit,
+  .region = &r72,
+  .submachine = NULL,
+  .dispatch = s44_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s44_interest,
+  .time_events = NULL,
+  .completion = &t687,
+  .next = &s43,
+};
+static struct ufsm_region r72 = {
+  .id = "r72",
+  .name = "R72",
+  .state = &s364,
+  .has_history = false,
+  .history = NULL,
+  .index = 71,
+  .transition = &t72,
+  .parent_state = &s44,
+  .next = &r71,
+};
+static struct ufsm_transition t72 = {
+  .id = "t72",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 692,
+  .action = &t72effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s360,
+  .dest = &s364,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t649,
+};
+static struct ufsm_action t72effect = {
+  .id = "t72effect",
+  .name = "a72",
+  .f = &a72,
+  .next = NULL,
+};
+static struct ufsm_trigger t649_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t649 = {
+  .id = "t649",
+  .name = "",
+  .trigger = t649_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 693,
+  .action = &t649effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s361,
+  .dest = &s361,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t650,
+};
+static struct ufsm_action t649effect = {
+  .id = "t649effect",
+  .name = "a649",
+  .f = &a649,
+  .next = NULL,
+};
+static struct ufsm_trigger t650_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t650 = {
+  .id = "t650",
+  .name = "",
+  .trigger = t650_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 694,
+  .action = &t650effect,
+  .defer = false,
+  .guard = &t650guard,
+  .source = &s361,
+  .dest = &s361,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t651,
+};
+static struct ufsm_action t650effect = {
+  .id = "t650effect",
+  .name = "a650",
+  .f = &a650,
+  .next = NULL,
+};
+static struct ufsm_guard t650guard = {
+  .id = "t650guard",
+  .name = "g183",
+  .f = &g183,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t651_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t651_exit_path[] = {
+  &r72,
+  NULL,
+};
+static struct ufsm_region * t651_enter_path[] = {
+  &r66,
+  NULL,
+};
+static struct ufsm_transition t651 = {
+  .id = "t651",
+  .name = "",
+  .trigger = t651_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 695,
+  .action = &t651effect,
+  .defer = false,
+  .guard = &t651guard,
+  .source = &s362,
+  .dest = &s331,
+  .lca = &r8,
+  .exit_path = t651_exit_path,
+  .enter_path = t651_enter_path,
+  .next = &t652,
+};
+static struct ufsm_action t651effect = {
+  .id = "t651effect",
+  .name = "a651",
+  .f = &a651,
+  .next = NULL,
+};
+static struct ufsm_guard t651guard = {
+  .id = "t651guard",
+  .name = "g184",
+  .f = &g184,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t652_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t652 = {
+  .id = "t652",
+  .name = "",
+  .trigger = t652_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 696,
+  .action = &t652effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s362,
+  .dest = &s361,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t653,
+};
+static struct ufsm_action t652effect = {
+  .id = "t652effect",
+  .name = "a652",
+  .f = &a652,
+  .next = NULL,
+};
+static struct ufsm_trigger t653_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t653_exit_path[] = {
+  &r72,
+  &r8,
+  NULL,
+};
+static struct ufsm_region * t653_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t653 = {
+  .id = "t653",
+  .name = "",
+  .trigger = t653_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 697,
+  .action = &t653effect,
+  .defer = false,
+  .guard = &t653guard,
+  .source = &s363,
+  .dest = &s12,
+  .lca = &r0,
+  .exit_path = t653_exit_path,
+  .enter_path = t653_enter_path,
+  .next = &t654,
+};
+static struct ufsm_action t653effect = {
+  .id = "t653effect",
+  .name = "a653",
+  .f = &a653,
+  .next = NULL,
+};
+static struct ufsm_guard t653guard = {
+  .id = "t653guard",
+  .name = "g185",
+  .f = &g185,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t654_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t654_exit_path[] = {
+  &r72,
+  NULL,
+};
+static struct ufsm_region * t654_enter_path[] = {
+  &r71,
+  NULL,
+};
+static struct ufsm_transition t654 = {
+  .id = "t654",
+  .name = "",
+  .trigger = t654_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 698,
+  .action = &t654effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s363,
+  .dest = &s358,
+  .lca = &r8,
+  .exit_path = t654_exit_path,
+  .enter_path = t654_enter_path,
+  .next = &t655,
+};
+static struct ufsm_action t654effect = {
+  .id = "t654effect",
+  .name = "a654",
+  .f = &a654,
+  .next = NULL,
+};
+static struct ufsm_trigger t655_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t655 = {
+  .id = "t655",
+  .name = "",
+  .trigger = t655_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 699,
+  .action = &t655effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s364,
+  .dest = &s364,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t656,
+};
+static struct ufsm_action t655effect = {
+  .id = "t655effect",
+  .name = "a655",
+  .f = &a655,
+  .next = NULL,
+};
+static struct ufsm_trigger t656_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t656 = {
+  .id = "t656",
+  .name = "",
+  .trigger = t656_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 700,
+  .action = &t656effect,
+  .defer = false,
+  .guard = &t656guard,
+  .source = &s364,
+  .dest = &s361,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t656effect = {
+  .id = "t656effect",
+  .name = "a656",
+  .f = &a656,
+  .next = NULL,
+};
+static struct ufsm_guard t656guard = {
+  .id = "t656guard",
+  .name = "g186",
+  .f = &g186,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s364_dispatch_0[] = {
+  &t656,
+  NULL,
+};
+static struct ufsm_transition * s364_dispatch_3[] = {
+  &t655,
+  NULL,
+};
+static struct ufsm_dispatch s364_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s364_dispatch_0,
+},
+{
+  .ev = 3,
+  .transition = s364_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s364_interest[] = {
+  0x000000c9,
+};
+static struct ufsm_state s364 = {
+  .id   = "s364",
+  .name = "S364",
+  .kind = 0,
+  .index = 376,
+  .parent_region = &r72,
+  .entry = &s364entry,
+  .doact = NULL,
+  .exit = &s364exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s364_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s364_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s363,
+};
+static struct ufsm_entry_exit s364entry = {
+  .id = "s364entry",
+  .name = "e364",
+  .f = &e364,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s364exit = {
+  .id = "s364exit",
+  .name = "x364",
+  .f = &x364,
+  .next = NULL,
+};
+static struct ufsm_transition * s363_dispatch_0[] = {
+  &t654,
+  NULL,
+};
+static struct ufsm_transition * s363_dispatch_5[] = {
+  &t653,
+  NULL,
+};
+static struct ufsm_dispatch s363_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s363_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s363_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s363_interest[] = {
+  0x000000e1,
+};
+static struct ufsm_state s363 = {
+  .id   = "s363",
+  .name = "S363",
+  .kind = 0,
+  .index = 377,
+  .parent_region = &r72,
+  .entry = &s363entry,
+  .doact = NULL,
+  .exit = &s363exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s363_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s363_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s362,
+};
+static struct ufsm_entry_exit s363entry = {
+  .id = "s363entry",
+  .name = "e363",
+  .f = &e363,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s363exit = {
+  .id = "s363exit",
+  .name = "x363",
+  .f = &x363,
+  .next = NULL,
+};
+static struct ufsm_transition * s362_dispatch_0[] = {
+  &t651,
+  &t652,
+  NULL,
+};
+static struct ufsm_dispatch s362_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s362_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s362_interest[] = {
+  0x000000c1,
+};
+static struct ufsm_state s362 = {
+  .id   = "s362",
+  .name = "S362",
+  .kind = 0,
+  .index = 378,
+  .parent_region = &r72,
+  .entry = &s362entry,
+  .doact = NULL,
+  .exit = &s362exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s362_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s362_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s361,
+};
+static struct ufsm_entry_exit s362entry = {
+  .id = "s362entry",
+  .name = "e362",
+  .f = &e362,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s362exit = {
+  .id = "s362exit",
+  .name = "x362",
+  .f = &x362,
+  .next = NULL,
+};
+static struct ufsm_transition * s361_dispatch_0[] = {
+  &t650,
+  NULL,
+};
+static struct ufsm_transition * s361_dispatch_3[] = {
+  &t649,
+  NULL,
+};
+static struct ufsm_dispatch s361_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s361_dispatch_0,
+},
+{
+  .ev = 3,
+  .transition = s361_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s361_interest[] = {
+  0x000000c9,
+};
+static struct ufsm_state s361 = {
+  .id   = "s361",
+  .name = "S361",
+  .kind = 0,
+  .index = 379,
+  .parent_region = &r72,
+  .entry = &s361entry,
+  .doact = NULL,
+  .exit = &s361exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s361_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s361_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s360,
+};
+static struct ufsm_entry_exit s361entry = {
+  .id = "s361entry",
+  .name = "e361",
+  .f = &e361,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s361exit = {
+  .id = "s361exit",
+  .name = "x361",
+  .f = &x361,
+  .next = NULL,
+};
+static struct ufsm_dispatch s360_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s360_interest[] = {
+  0x000000c1,
+};
+static struct ufsm_state s360 = {
+  .id   = "s360",
+  .name = "Init",
+  .kind = 1,
+  .index = 380,
+  .parent_region = &r72,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s360_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s360_interest,
+  .time_events = NULL,
+  .completion = &t72,
+  .next = NULL,
+};
+static struct ufsm_region r71 = {
+  .id = "r71",
+  .name = "R71",
+  .state = &s359,
+  .has_history = false,
+  .history = NULL,
+  .index = 72,
+  .transition = &t71,
+  .parent_state = &s44,
+  .next = NULL,
+};
+static struct ufsm_transition t71 = {
+  .id = "t71",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 701,
+  .action = &t71effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s355,
+  .dest = &s356,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t641,
+};
+static struct ufsm_action t71effect = {
+  .id = "t71effect",
+  .name = "a71",
+  .f = &a71,
+  .next = NULL,
+};
+static struct ufsm_trigger t641_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t641 = {
+  .id = "t641",
+  .name = "",
+  .trigger = t641_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 702,
+  .action = &t641effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s356,
+  .dest = &s357,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t642,
+};
+static struct ufsm_action t641effect = {
+  .id = "t641effect",
+  .name = "a641",
+  .f = &a641,
+  .next = NULL,
+};
+static struct ufsm_trigger t642_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t642 = {
+  .id = "t642",
+  .name = "",
+  .trigger = t642_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 703,
+  .action = &t642effect,
+  .defer = false,
+  .guard = &t642guard,
+  .source = &s356,
+  .dest = &s356,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t643,
+};
+static struct ufsm_action t642effect = {
+  .id = "t642effect",
+  .name = "a642",
+  .f = &a642,
+  .next = NULL,
+};
+static struct ufsm_guard t642guard = {
+  .id = "t642guard",
+  .name = "g180",
+  .f = &g180,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t643_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t643 = {
+  .id = "t643",
+  .name = "",
+  .trigger = t643_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 704,
+  .action = &t643effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s357,
+  .dest = &s358,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t644,
+};
+static struct ufsm_action t643effect = {
+  .id = "t643effect",
+  .name = "a643",
+  .f = &a643,
+  .next = NULL,
+};
+static struct ufsm_trigger t644_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t644_exit_path[] = {
+  &r71,
+  NULL,
+};
+static struct ufsm_region * t644_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t644 = {
+  .id = "t644",
+  .name = "",
+  .trigger = t644_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 705,
+  .action = &t644effect,
+  .defer = false,
+  .guard = &t644guard,
+  .source = &s357,
+  .dest = &s41,
+  .lca = &r8,
+  .exit_path = t644_exit_path,
+  .enter_path = t644_enter_path,
+  .next = &t645,
+};
+static struct ufsm_action t644effect = {
+  .id = "t644effect",
+  .name = "a644",
+  .f = &a644,
+  .next = NULL,
+};
+static struct ufsm_guard t644guard = {
+  .id = "t644guard",
+  .name = "g181",
+  .f = &g181,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t645_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t645_exit_path[] = {
+  &r71,
+  &r8,
+  NULL,
+};
+static struct ufsm_region * t645_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t645 = {
+  .id = "t645",
+  .name = "",
+  .trigger = t645_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 706,
+  .action = &t645effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s358,
+  .dest = &s11,
+  .lca = &r0,
+  .exit_path = t645_exit_path,
+  .enter_path = t645_enter_path,
+  .next = &t646,
+};
+static struct ufsm_action t645effect = {
+  .id = "t645effect",
+  .name = "a645",
+  .f = &a645,
+  .next = NULL,
+};
+static struct ufsm_trigger t646_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t646 = {
+  .id = "t646",
+  .name = "",
+  .trigger = t646_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 707,
+  .action = &t646effect,
+  .defer = false,
+  .guard = &t646guard,
+  .source = &s358,
+  .dest = &s356,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t647,
+};
+static struct ufsm_action t646effect = {
+  .id = "t646effect",
+  .name = "a646",
+  .f = &a646,
+  .next = NULL,
+};
+static struct ufsm_guard t646guard = {
+  .id = "t646guard",
+  .name = "g182",
+  .f = &g182,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t647_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t647 = {
+  .id = "t647",
+  .name = "",
+  .trigger = t647_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 708,
+  .action = &t647effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s359,
+  .dest = &s356,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t648,
+};
+static struct ufsm_action t647effect = {
+  .id = "t647effect",
+  .name = "a647",
+  .f = &a647,
+  .next = NULL,
+};
+static struct ufsm_trigger t648_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t648 = {
+  .id = "t648",
+  .name = "",
+  .trigger = t648_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 709,
+  .action = &t648effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s359,
+  .dest = &s357,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t648effect = {
+  .id = "t648effect",
+  .name = "a648",
+  .f = &a648,
+  .next = NULL,
+};
+static struct ufsm_transition * s359_dispatch_1[] = {
+  &t648,
+  NULL,
+};
+static struct ufsm_transition * s359_dispatch_7[] = {
+  &t647,
+  NULL,
+};
+static struct ufsm_dispatch s359_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s359_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s359_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s359_interest[] = {
+  0x000000c3,
+};
+static struct ufsm_state s359 = {
+  .id   = "s359",
+  .name = "S359",
+  .kind = 0,
+  .index = 381,
+  .parent_region = &r71,
+  .entry = &s359entry,
+  .doact = NULL,
+  .exit = &s359exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s359_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s359_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s358,
+};
+static struct ufsm_entry_exit s359entry = {
+  .id = "s359entry",
+  .name = "e359",
+  .f = &e359,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s359exit = {
+  .id = "s359exit",
+  .name = "x359",
+  .f = &x359,
+  .next = NULL,
+};
+static struct ufsm_transition * s358_dispatch_1[] = {
+  &t645,
+  NULL,
+};
+static struct ufsm_transition * s358_dispatch_5[] = {
+  &t646,
+  NULL,
+};
+static struct ufsm_dispatch s358_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s358_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s358_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s358_interest[] = {
+  0x000000e3,
+};
+static struct ufsm_state s358 = {
+  .id   = "s358",
+  .name = "S358",
+  .kind = 0,
+  .index = 382,
+  .parent_region = &r71,
+  .entry = &s358entry,
+  .doact = NULL,
+  .exit = &s358exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s358_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s358_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s357,
+};
+static struct ufsm_entry_exit s358entry = {
+  .id = "s358entry",
+  .name = "e358",
+  .f = &e358,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s358exit = {
+  .id = "s358exit",
+  .name = "x358",
+  .f = &x358,
+  .next = NULL,
+};
+static struct ufsm_transition * s357_dispatch_2[] = {
+  &t644,
+  NULL,
+};
+static struct ufsm_transition * s357_dispatch_5[] = {
+  &t643,
+  NULL,
+};
+static struct ufsm_dispatch s357_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s357_dispatch_2,
+},
+{
+  .ev = 5,
+  .transition = s357_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s357_interest[] = {
+  0x000000e5,
+};
+static struct ufsm_state s357 = {
+  .id   = "s357",
+  .name = "S357",
+  .kind = 0,
+  .index = 383,
+  .parent_region = &r71,
+  .entry = &s357entry,
+  .doact = NULL,
+  .exit = &s357exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s357_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s357_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s356,
+};
+static struct ufsm_entry_exit s357entry = {
+  .id = "s357entry",
+  .name = "e357",
+  .f = &e357,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s357exit = {
+  .id = "s357exit",
+  .name = "x357",
+  .f = &x357,
+  .next = NULL,
+};
+static struct ufsm_transition * s356_dispatch_0[] = {
+  &t641,
+  NULL,
+};
+static struct ufsm_transition * s356_dispatch_5[] = {
+  &t642,
+  NULL,
+};
+static struct ufsm_dispatch s356_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s356_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s356_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s356_interest[] = {
+  0x000000e1,
+};
+static struct ufsm_state s356 = {
+  .id   = "s356",
+  .name = "S356",
+  .kind = 0,
+  .index = 384,
+  .parent_region = &r71,
+  .entry = &s356entry,
+  .doact = NULL,
+  .exit = &s356exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s356_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s356_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s355,
+};
+static struct ufsm_entry_exit s356entry = {
+  .id = "s356entry",
+  .name = "e356",
+  .f = &e356,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s356exit = {
+  .id = "s356exit",
+  .name = "x356",
+  .f = &x356,
+  .next = NULL,
+};
+static struct ufsm_dispatch s355_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s355_interest[] = {
+  0x000000c1,
+};
+static struct ufsm_state s355 = {
+  .id   = "s355",
+  .name = "Init",
+  .kind = 1,
+  .index = 385,
+  .parent_region = &r71,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s355_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s355_interest,
+  .time_events = NULL,
+  .completion = &t71,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s44entry = {
+  .id = "s44entry",
+  .name = "e44",
+  .f = &e44,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s44exit = {
+  .id = "s44exit",
+  .name = "x44",
+  .f = &x44,
+  .next = NULL,
+};
+static struct ufsm_transition * s43_dispatch_2[] = {
+  &t142,
+  NULL,
+};
+static struct ufsm_transition * s43_dispatch_3[] = {
+  &t141,
+  NULL,
+};
+static struct ufsm_transition * s43_dispatch_7[] = {
+  &t708,
+  NULL,
+};
+static struct ufsm_dispatch s43_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s43_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s43_dispatch_3,
+},
+{
+  .ev = 7,
+  .transition = s43_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s43_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s43 = {
+  .id   = "s43",
+  .name = "S43",
+  .kind = 0,
+  .index = 292,
+  .parent_region = &r8,
+  .entry = &s43entry,
+  .doact = NULL,
+  .exit = &s43exit,
+  .region = &r70,
+  .submachine = NULL,
+  .dispatch = s43_dispatch,
+  .no_of_dispatch = 3,
+  .flat_dispatch = NULL,
+  .interest = s43_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s42,
+};
+static struct ufsm_region r70 = {
+  .id = "r70",
+  .name = "R70",
+  .state = &s354,
+  .has_history = false,
+  .history = NULL,
+  .index = 69,
+  .transition = &t70,
+  .parent_state = &s43,
+  .next = &r69,
+};
+static struct ufsm_transition t70 = {
+  .id = "t70",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 673,
+  .action = &t70effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s350,
+  .dest = &s354,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t633,
+};
+static struct ufsm_action t70effect = {
+  .id = "t70effect",
+  .name = "a70",
+  .f = &a70,
+  .next = NULL,
+};
+static struct ufsm_trigger t633_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t633_exit_path[] = {
+  &r70,
+  NULL,
+};
+static struct ufsm_region * t633_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t633 = {
+  .id = "t633",
+  .name = "",
+  .trigger = t633_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 674,
+  .action = &t633effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s351,
+  .dest = &s43,
+  .lca = &r8,
+  .exit_path = t633_exit_path,
+  .enter_path = t633_enter_path,
+  .next = &t634,
+};
+static struct ufsm_action t633effect = {
+  .id = "t633effect",
+  .name = "a633",
+  .f = &a633,
+  .next = NULL,
+};
+static struct ufsm_trigger t634_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t634_exit_path[] = {
+  &r70,
+  &r8,
+  NULL,
+};
+static struct ufsm_region * t634_enter_path[] = {
+  &r7,
+  NULL,
+};
+static struct ufsm_transition t634 = {
+  .id = "t634",
+  .name = "",
+  .trigger = t634_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 675,
+  .action = &t634effect,
+  .defer = false,
+  .guard = &t634guard,
+  .source = &s351,
+  .dest = &s36,
+  .lca = &r0,
+  .exit_path = t634_exit_path,
+  .enter_path = t634_enter_path,
+  .next = &t635,
+};
+static struct ufsm_action t634effect = {
+  .id = "t634effect",
+  .name = "a634",
+  .f = &a634,
+  .next = NULL,
+};
+static struct ufsm_guard t634guard = {
+  .id = "t634guard",
+  .name = "g179",
+  .f = &g179,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t635_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t635_exit_path[] = {
+  &r70,
+  NULL,
+};
+static struct ufsm_region * t635_enter_path[] = {
+  &r67,
+  NULL,
+};
+static struct ufsm_transition t635 = {
+  .id = "t635",
+  .name = "",
+  .trigger = t635_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 676,
+  .action = &t635effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s352,
+  .dest = &s339,
+  .lca = &r8,
+  .exit_path = t635_exit_path,
+  .enter_path = t635_enter_path,
+  .next = &t636,
+};
+static struct ufsm_action t635effect = {
+  .id = "t635effect",
+  .name = "a635",
+  .f = &a635,
+  .next = NULL,
+};
+static struct ufsm_trigger t636_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t636 = {
+  .id = "t636",
+  .name = "",
+  .trigger = t636_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 677,
+  .action = &t636effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s352,
+  .dest = &s353,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t637,
+};
+static struct ufsm_action t636effect = {
+  .id = "t636effect",
+  .name = "a636",
+  .f = &a636,
+  .next = NULL,
+};
+static struct ufsm_trigger t637_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t637 = {
+  .id = "t637",
+  .name = "",
+  .trigger = t637_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 678,
+  .action = &t637effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s353,
+  .dest = &s351,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t638,
+};
+static struct ufsm_action t637effect = {
+  .id = "t637effect",
+  .name = "a637",
+  .f = &a637,
+  .next = NULL,
+};
+static struct ufsm_trigger t638_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t638_exit_path[] = {
+  &r70,
+  NULL,
+};
+static struct ufsm_region * t638_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t638 = {
+  .id = "t638",
+  .name = "",
+  .trigger = t638_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 679,
+  .action = &t638effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s353,
+  .dest = &s44,
+  .lca = &r8,
+  .exit_path = t638_exit_path,
+  .enter_path = t638_enter_path,
+  .next = &t639,
+};
+static struct ufsm_action t638effect = {
+  .id = "t638effect",
+  .name = "a638",
+  .f = &a638,
+  .next = NULL,
+};
+static struct ufsm_trigger t639_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t639 = {
+  .id = "t639",
+  .name = "",
+  .trigger = t639_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 680,
+  .action = &t639effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s354,
+  .dest = &s351,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t640,
+};
+static struct ufsm_action t639effect = {
+  .id = "t639effect",
+  .name = "a639",
+  .f = &a639,
+  .next = NULL,
+};
+static struct ufsm_trigger t640_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t640 = {
+  .id = "t640",
+  .name = "",
+  .trigger = t640_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 681,
+  .action = &t640effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s354,
+  .dest = &s352,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t640effect = {
+  .id = "t640effect",
+  .name = "a640",
+  .f = &a640,
+  .next = NULL,
+};
+static struct ufsm_transition * s354_dispatch_5[] = {
+  &t640,
+  NULL,
+};
+static struct ufsm_transition * s354_dispatch_6[] = {
+  &t639,
+  NULL,
+};
+static struct ufsm_dispatch s354_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s354_dispatch_5,
+},
+{
+  .ev = 6,
+  .transition = s354_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s354_interest[] = {
+  0x000000ed,
+};
+static struct ufsm_state s354 = {
+  .id   = "s354",
+  .name = "S354",
+  .kind = 0,
+  .index = 365,
+  .parent_region = &r70,
+  .entry = &s354entry,
+  .doact = NULL,
+  .exit = &s354exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s354_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s354_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s353,
+};
+static struct ufsm_entry_exit s354entry = {
+  .id = "s354entry",
+  .name = "e354",
+  .f = &e354,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s354exit = {
+  .id = "s354exit",
+  .name = "x354",
+  .f = &x354,
+  .next = NULL,
+};
+static struct ufsm_transition * s353_dispatch_1[] = {
+  &t637,
+  NULL,
+};
+static struct ufsm_transition * s353_dispatch_5[] = {
+  &t638,
+  NULL,
+};
+static struct ufsm_dispatch s353_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s353_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s353_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s353_interest[] = {
+  0x000000af,
+};
+static struct ufsm_state s353 = {
+  .id   = "s353",
+  .name = "S353",
+  .kind = 0,
+  .index = 366,
+  .parent_region = &r70,
+  .entry = &s353entry,
+  .doact = NULL,
+  .exit = &s353exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s353_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s353_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s352,
+};
+static struct ufsm_entry_exit s353entry = {
+  .id = "s353entry",
+  .name = "e353",
+  .f = &e353,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s353exit = {
+  .id = "s353exit",
+  .name = "x353",
+  .f = &x353,
+  .next = NULL,
+};
+static struct ufsm_transition * s352_dispatch_0[] = {
+  &t636,
+  NULL,
+};
+static struct ufsm_transition * s352_dispatch_2[] = {
+  &t635,
+  NULL,
+};
+static struct ufsm_dispatch s352_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s352_dispatch_0,
+},
+{
+  .ev = 2,
+  .transition = s352_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s352_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s352 = {
+  .id   = "s352",
+  .name = "S352",
+  .kind = 0,
+  .index = 367,
+  .parent_region = &r70,
+  .entry = &s352entry,
+  .doact = NULL,
+  .exit = &s352exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s352_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s352_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s351,
+};
+static struct ufsm_entry_exit s352entry = {
+  .id = "s352entry",
+  .name = "e352",
+  .f = &e352,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s352exit = {
+  .id = "s352exit",
+  .name = "x352",
+  .f = &x352,
+  .next = NULL,
+};
+static struct ufsm_transition * s351_dispatch_1[] = {
+  &t634,
+  NULL,
+};
+static struct ufsm_transition * s351_dispatch_7[] = {
+  &t633,
+  NULL,
+};
+static struct ufsm_dispatch s351_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s351_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s351_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s351_interest[] = {
+  0x0000008f,
+};
+static struct ufsm_state s351 = {
+  .id   = "s351",
+  .name = "S351",
+  .kind = 0,
+  .index = 368,
+  .parent_region = &r70,
+  .entry = &s351entry,
+  .doact = NULL,
+  .exit = &s351exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s351_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s351_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s350,
+};
+static struct ufsm_entry_exit s351entry = {
+  .id = "s351entry",
+  .name = "e351",
+  .f = &e351,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s351exit = {
+  .id = "s351exit",
+  .name = "x351",
+  .f = &x351,
+  .next = NULL,
+};
+static struct ufsm_dispatch s350_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s350_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s350 = {
+  .id   = "s350",
+  .name = "Init",
+  .kind = 1,
+  .index = 369,
+  .parent_region = &r70,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s350_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s350_interest,
+  .time_events = NULL,
+  .completion = &t70,
+  .next = NULL,
+};
+static struct ufsm_region r69 = {
+  .id = "r69",
+  .name = "R69",
+  .state = &s349,
+  .has_history = true,
+  .history = NULL,
+  .index = 70,
+  .transition = &t69,
+  .parent_state = &s43,
+  .next = NULL,
+};
+static struct ufsm_transition t69 = {
+  .id = "t69",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 682,
+  .action = &t69effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s345,
+  .dest = &s347,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t625,
+};
+static struct ufsm_action t69effect = {
+  .id = "t69effect",
+  .name = "a69",
+  .f = &a69,
+  .next = NULL,
+};
+static struct ufsm_trigger t625_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t625_exit_path[] = {
+  &r69,
+  NULL,
+};
+static struct ufsm_region * t625_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t625 = {
+  .id = "t625",
+  .name = "",
+  .trigger = t625_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 683,
+  .action = &t625effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s346,
+  .dest = &s43,
+  .lca = &r8,
+  .exit_path = t625_exit_path,
+  .enter_path = t625_enter_path,
+  .next = &t626,
+};
+static struct ufsm_action t625effect = {
+  .id = "t625effect",
+  .name = "a625",
+  .f = &a625,
+  .next = NULL,
+};
+static struct ufsm_trigger t626_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t626 = {
+  .id = "t626",
+  .name = "",
+  .trigger = t626_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 684,
+  .action = &t626effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s346,
+  .dest = &s346,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t627,
+};
+static struct ufsm_action t626effect = {
+  .id = "t626effect",
+  .name = "a626",
+  .f = &a626,
+  .next = NULL,
+};
+static struct ufsm_trigger t627_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t627_exit_path[] = {
+  &r69,
+  NULL,
+};
+static struct ufsm_region * t627_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t627 = {
+  .id = "t627",
+  .name = "",
+  .trigger = t627_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 685,
+  .action = &t627effect,
+  .defer = false,
+  .guard = &t627guard,
+  .source = &s347,
+  .dest = &s44,
+  .lca = &r8,
+  .exit_path = t627_exit_path,
+  .enter_path = t627_enter_path,
+  .next = &t628,
+};
+static struct ufsm_action t627effect = {
+  .id = "t627effect",
+  .name = "a627",
+  .f = &a627,
+  .next = NULL,
+};
+static struct ufsm_guard t627guard = {
+  .id = "t627guard",
+  .name = "g175",
+  .f = &g175,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t628_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t628 = {
+  .id = "t628",
+  .name = "",
+  .trigger = t628_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 686,
+  .action = &t628effect,
+  .defer = false,
+  .guard = &t628guard,
+  .source = &s347,
+  .dest = &s346,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t629,
+};
+static struct ufsm_action t628effect = {
+  .id = "t628effect",
+  .name = "a628",
+  .f = &a628,
+  .next = NULL,
+};
+static struct ufsm_guard t628guard = {
+  .id = "t628guard",
+  .name = "g176",
+  .f = &g176,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t629_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t629 = {
+  .id = "t629",
+  .name = "",
+  .trigger = t629_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 687,
+  .action = &t629effect,
+  .defer = false,
+  .guard = &t629guard,
+  .source = &s348,
+  .dest = &s346,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t630,
+};
+static struct ufsm_action t629effect = {
+  .id = "t629effect",
+  .name = "a629",
+  .f = &a629,
+  .next = NULL,
+};
+static struct ufsm_guard t629guard = {
+  .id = "t629guard",
+  .name = "g177",
+  .f = &g177,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t630_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t630_exit_path[] = {
+  &r69,
+  NULL,
+};
+static struct ufsm_region * t630_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t630 = {
+  .id = "t630",
+  .name = "",
+  .trigger = t630_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 688,
+  .action = &t630effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s348,
+  .dest = &s41,
+  .lca = &r8,
+  .exit_path = t630_exit_path,
+  .enter_path = t630_enter_path,
+  .next = &t631,
+};
+static struct ufsm_action t630effect = {
+  .id = "t630effect",
+  .name = "a630",
+  .f = &a630,
+  .next = NULL,
+};
+static struct ufsm_trigger t631_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t631_exit_path[] = {
+  &r69,
+  NULL,
+};
+static struct ufsm_region * t631_enter_path[] = {
+  &r67,
+  NULL,
+};
+static struct ufsm_transition t631 = {
+  .id = "t631",
+  .name = "",
+  .trigger = t631_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 689,
+  .action = &t631effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s349,
+  .dest = &s338,
+  .lca = &r8,
+  .exit_path = t631_exit_path,
+  .enter_path = t631_enter_path,
+  .next = &t632,
+};
+static struct ufsm_action t631effect = {
+  .id = "t631effect",
+  .name = "a631",
+  .f = &a631,
+  .next = NULL,
+};
+static struct ufsm_trigger t632_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t632 = {
+  .id = "t632",
+  .name = "",
+  .trigger = t632_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 690,
+  .action = &t632effect,
+  .defer = false,
+  .guard = &t632guard,
+  .source = &s349,
+  .dest = &s347,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t707,
+};
+static struct ufsm_action t632effect = {
+  .id = "t632effect",
+  .name = "a632",
+  .f = &a632,
+  .next = NULL,
+};
+static struct ufsm_guard t632guard = {
+  .id = "t632guard",
+  .name = "g178",
+  .f = &g178,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition t707 = {
+  .id = "t707",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 691,
+  .action = &t707effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s384,
+  .dest = &s347,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t707effect = {
+  .id = "t707effect",
+  .name = "a707",
+  .f = &a707,
+  .next = NULL,
+};
+static struct ufsm_transition * s349_dispatch_1[] = {
+  &t631,
+  NULL,
+};
+static struct ufsm_transition * s349_dispatch_7[] = {
+  &t632,
+  NULL,
+};
+static struct ufsm_dispatch s349_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s349_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s349_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s349_interest[] = {
+  0x0000008f,
+};
+static struct ufsm_state s349 = {
+  .id   = "s349",
+  .name = "S349",
+  .kind = 0,
+  .index = 370,
+  .parent_region = &r69,
+  .entry = &s349entry,
+  .doact = NULL,
+  .exit = &s349exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s349_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s349_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s348,
+};
+static struct ufsm_entry_exit s349entry = {
+  .id = "s349entry",
+  .name = "e349",
+  .f = &e349,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s349exit = {
+  .id = "s349exit",
+  .name = "x349",
+  .f = &x349,
+  .next = NULL,
+};
+static struct ufsm_transition * s348_dispatch_1[] = {
+  &t630,
+  NULL,
+};
+static struct ufsm_transition * s348_dispatch_4[] = {
+  &t629,
+  NULL,
+};
+static struct ufsm_dispatch s348_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s348_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s348_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s348_interest[] = {
+  0x0000009f,
+};
+static struct ufsm_state s348 = {
+  .id   = "s348",
+  .name = "S348",
+  .kind = 0,
+  .index = 371,
+  .parent_region = &r69,
+  .entry = &s348entry,
+  .doact = NULL,
+  .exit = &s348exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s348_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s348_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s347,
+};
+static struct ufsm_entry_exit s348entry = {
+  .id = "s348entry",
+  .name = "e348",
+  .f = &e348,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s348exit = {
+  .id = "s348exit",
+  .name = "x348",
+  .f = &x348,
+  .next = NULL,
+};
+static struct ufsm_transition * s347_dispatch_4[] = {
+  &t628,
+  NULL,
+};
+static struct ufsm_transition * s347_dispatch_7[] = {
+  &t627,
+  NULL,
+};
+static struct ufsm_dispatch s347_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s347_dispatch_4,
+},
+{
+  .ev = 7,
+  .transition = s347_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s347_interest[] = {
+  0x0000009d,
+};
+static struct ufsm_state s347 = {
+  .id   = "s347",
+  .name = "S347",
+  .kind = 0,
+  .index = 372,
+  .parent_region = &r69,
+  .entry = &s347entry,
+  .doact = NULL,
+  .exit = &s347exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s347_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s347_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s346,
+};
+static struct ufsm_entry_exit s347entry = {
+  .id = "s347entry",
+  .name = "e347",
+  .f = &e347,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s347exit = {
+  .id = "s347exit",
+  .name = "x347",
+  .f = &x347,
+  .next = NULL,
+};
+static struct ufsm_transition * s346_dispatch_1[] = {
+  &t625,
+  NULL,
+};
+static struct ufsm_transition * s346_dispatch_5[] = {
+  &t626,
+  NULL,
+};
+static struct ufsm_dispatch s346_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s346_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s346_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s346_interest[] = {
+  0x000000af,
+};
+static struct ufsm_state s346 = {
+  .id   = "s346",
+  .name = "S346",
+  .kind = 0,
+  .index = 373,
+  .parent_region = &r69,
+  .entry = &s346entry,
+  .doact = NULL,
+  .exit = &s346exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s346_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s346_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s384,
+};
+static struct ufsm_entry_exit s346entry = {
+  .id = "s346entry",
+  .name = "e346",
+  .f = &e346,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s346exit = {
+  .id = "s346exit",
+  .name = "x346",
+  .f = &x346,
+  .next = NULL,
+};
+static struct ufsm_dispatch s384_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s384_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s384 = {
+  .id   = "s384",
+  .name = "(null)",
+  .kind = 4,
+  .index = 374,
+  .parent_region = &r69,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s384_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s384_interest,
+  .time_events = NULL,
+  .completion = &t707,
+  .next = &s345,
+};
+static struct ufsm_dispatch s345_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s345_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s345 = {
+  .id   = "s345",
+  .name = "Init",
+  .kind = 1,
+  .index = 375,
+  .parent_region = &r69,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s345_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s345_interest,
+  .time_events = NULL,
+  .completion = &t69,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s43entry = {
+  .id = "s43entry",
+  .name = "e43",
+  .f = &e43,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s43exit = {
+  .id = "s43exit",
+  .name = "x43",
+  .f = &x43,
+  .next = NULL,
+};
+static struct ufsm_transition * s42_dispatch_1[] = {
+  &t139,
+  NULL,
+};
+static struct ufsm_transition * s42_dispatch_2[] = {
+  &t140,
+  NULL,
+};
+static struct ufsm_dispatch s42_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s42_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = s42_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s42_interest[] = {
+  0x00000007,
+};
+static struct ufsm_state s42 = {
+  .id   = "s42",
+  .name = "S42",
+  .kind = 0,
+  .index = 293,
+  .parent_region = &r8,
+  .entry = &s42entry,
+  .doact = NULL,
+  .exit = &s42exit,
+  .region = &r68,
+  .submachine = NULL,
+  .dispatch = s42_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s42_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s41,
+};
+static struct ufsm_region r68 = {
+  .id = "r68",
+  .name = "R68",
+  .state = &s344,
+  .has_history = false,
+  .history = NULL,
+  .index = 67,
+  .transition = &t68,
+  .parent_state = &s42,
+  .next = &r67,
+};
+static struct ufsm_transition t68 = {
+  .id = "t68",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 655,
+  .action = &t68effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s340,
+  .dest = &s341,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t617,
+};
+static struct ufsm_action t68effect = {
+  .id = "t68effect",
+  .name = "a68",
+  .f = &a68,
+  .next = NULL,
+};
+static struct ufsm_trigger t617_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t617 = {
+  .id = "t617",
+  .name = "",
+  .trigger = t617_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 656,
+  .action = &t617effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s341,
+  .dest = &s342,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t618,
+};
+static struct ufsm_action t617effect = {
+  .id = "t617effect",
+  .name = "a617",
+  .f = &a617,
+  .next = NULL,
+};
+static struct ufsm_trigger t618_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t618 = {
+  .id = "t618",
+  .name = "",
+  .trigger = t618_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 657,
+  .action = &t618effect,
+  .defer = false,
+  .guard = &t618guard,
+  .source = &s341,
+  .dest = &s341,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t619,
+};
+static struct ufsm_action t618effect = {
+  .id = "t618effect",
+  .name = "a618",
+  .f = &a618,
+  .next = NULL,
+};
+static struct ufsm_guard t618guard = {
+  .id = "t618guard",
+  .name = "g172",
+  .f = &g172,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t619_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t619 = {
+  .id = "t619",
+  .name = "",
+  .trigger = t619_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 658,
+  .action = &t619effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s342,
+  .dest = &s341,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t620,
+};
+static struct ufsm_action t619effect = {
+  .id = "t619effect",
+  .name = "a619",
+  .f = &a619,
+  .next = NULL,
+};
+static struct ufsm_trigger t620_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t620_exit_path[] = {
+  &r68,
+  NULL,
+};
+static struct ufsm_region * t620_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t620 = {
+  .id = "t620",
+  .name = "",
+  .trigger = t620_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 659,
+  .action = &t620effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s342,
+  .dest = &s41,
+  .lca = &r8,
+  .exit_path = t620_exit_path,
+  .enter_path = t620_enter_path,
+  .next = &t621,
+};
+static struct ufsm_action t620effect = {
+  .id = "t620effect",
+  .name = "a620",
+  .f = &a620,
+  .next = NULL,
+};
+static struct ufsm_trigger t621_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t621 = {
+  .id = "t621",
+  .name = "",
+  .trigger = t621_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 660,
+  .action = &t621effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s343,
+  .dest = &s341,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t622,
+};
+static struct ufsm_action t621effect = {
+  .id = "t621effect",
+  .name = "a621",
+  .f = &a621,
+  .next = NULL,
+};
+static struct ufsm_trigger t622_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t622_exit_path[] = {
+  &r68,
+  NULL,
+};
+static struct ufsm_region * t622_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t622 = {
+  .id = "t622",
+  .name = "",
+  .trigger = t622_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 661,
+  .action = &t622effect,
+  .defer = false,
+  .guard = &t622guard,
+  .source = &s343,
+  .dest = &s44,
+  .lca = &r8,
+  .exit_path = t622_exit_path,
+  .enter_path = t622_enter_path,
+  .next = &t623,
+};
+static struct ufsm_action t622effect = {
+  .id = "t622effect",
+  .name = "a622",
+  .f = &a622,
+  .next = NULL,
+};
+static struct ufsm_guard t622guard = {
+  .id = "t622guard",
+  .name = "g173",
+  .f = &g173,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t623_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t623 = {
+  .id = "t623",
+  .name = "",
+  .trigger = t623_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 662,
+  .action = &t623effect,
+  .defer = false,
+  .guard = &t623guard,
+  .source = &s344,
+  .dest = &s344,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t624,
+};
+static struct ufsm_action t623effect = {
+  .id = "t623effect",
+  .name = "a623",
+  .f = &a623,
+  .next = NULL,
+};
+static struct ufsm_guard t623guard = {
+  .id = "t623guard",
+  .name = "g174",
+  .f = &g174,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t624_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t624 = {
+  .id = "t624",
+  .name = "",
+  .trigger = t624_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 663,
+  .action = &t624effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s344,
+  .dest = &s341,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t624effect = {
+  .id = "t624effect",
+  .name = "a624",
+  .f = &a624,
+  .next = NULL,
+};
+static struct ufsm_transition * s344_dispatch_2[] = {
+  &t624,
+  NULL,
+};
+static struct ufsm_transition * s344_dispatch_7[] = {
+  &t623,
+  NULL,
+};
+static struct ufsm_dispatch s344_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s344_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s344_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s344_interest[] = {
+  0x00000087,
+};
+static struct ufsm_state s344 = {
+  .id   = "s344",
+  .name = "S344",
+  .kind = 0,
+  .index = 355,
+  .parent_region = &r68,
+  .entry = &s344entry,
+  .doact = NULL,
+  .exit = &s344exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s344_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s344_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s343,
+};
+static struct ufsm_entry_exit s344entry = {
+  .id = "s344entry",
+  .name = "e344",
+  .f = &e344,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s344exit = {
+  .id = "s344exit",
+  .name = "x344",
+  .f = &x344,
+  .next = NULL,
+};
+static struct ufsm_transition * s343_dispatch_1[] = {
+  &t621,
+  NULL,
+};
+static struct ufsm_transition * s343_dispatch_5[] = {
+  &t622,
+  NULL,
+};
+static struct ufsm_dispatch s343_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s343_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s343_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s343_interest[] = {
+  0x00000027,
+};
+static struct ufsm_state s343 = {
+  .id   = "s343",
+  .name = "S343",
+  .kind = 0,
+  .index = 356,
+  .parent_region = &r68,
+  .entry = &s343entry,
+  .doact = NULL,
+  .exit = &s343exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s343_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s343_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s342,
+};
+static struct ufsm_entry_exit s343entry = {
+  .id = "s343entry",
+  .name = "e343",
+  .f = &e343,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s343exit = {
+  .id = "s343exit",
+  .name = "x343",
+  .f = &x343,
+  .next = NULL,
+};
+static struct ufsm_transition * s342_dispatch_1[] = {
+  &t620,
+  NULL,
+};
+static struct ufsm_transition * s342_dispatch_6[] = {
+  &t619,
+  NULL,
+};
+static struct ufsm_dispatch s342_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s342_dispatch_1,
+},
+{
+  .ev = 6,
+  .transition = s342_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s342_interest[] = {
+  0x00000047,
+};
+static struct ufsm_state s342 = {
+  .id   = "s342",
+  .name = "S342",
+  .kind = 0,
+  .index = 357,
+  .parent_region = &r68,
+  .entry = &s342entry,
+  .doact = NULL,
+  .exit = &s342exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s342_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s342_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s341,
+};
+static struct ufsm_entry_exit s342entry = {
+  .id = "s342entry",
+  .name = "e342",
+  .f = &e342,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s342exit = {
+  .id = "s342exit",
+  .name = "x342",
+  .f = &x342,
+  .next = NULL,
+};
+static struct ufsm_transition * s341_dispatch_0[] = {
+  &t617,
+  NULL,
+};
+static struct ufsm_transition * s341_dispatch_3[] = {
+  &t618,
+  NULL,
+};
+static struct ufsm_dispatch s341_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s341_dispatch_0,
+},
+{
+  .ev = 3,
+  .transition = s341_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s341_interest[] = {
+  0x0000000f,
+};
+static struct ufsm_state s341 = {
+  .id   = "s341",
+  .name = "S341",
+  .kind = 0,
+  .index = 358,
+  .parent_region = &r68,
+  .entry = &s341entry,
+  .doact = NULL,
+  .exit = &s341exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s341_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s341_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s340,
+};
+static struct ufsm_entry_exit s341entry = {
+  .id = "s341entry",
+  .name = "e341",
+  .f = &e341,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s341exit = {
+  .id = "s341exit",
+  .name = "x341",
+  .f = &x341,
+  .next = NULL,
+};
+static struct ufsm_dispatch s340_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s340_interest[] = {
+  0x00000007,
+};
+static struct ufsm_state s340 = {
+  .id   = "s340",
+  .name = "Init",
+  .kind = 1,
+  .index = 359,
+  .parent_region = &r68,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s340_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s340_interest,
+  .time_events = NULL,
+  .completion = &t68,
+  .next = NULL,
+};
+static struct ufsm_region r67 = {
+  .id = "r67",
+  .name = "R67",
+  .state = &s339,
+  .has_history = false,
+  .history = NULL,
+  .index = 68,
+  .transition = &t67,
+  .parent_state = &s42,
+  .next = NULL,
+};
+static struct ufsm_transition t67 = {
+  .id = "t67",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 664,
+  .action = &t67effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s335,
+  .dest = &s339,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t609,
+};
+static struct ufsm_action t67effect = {
+  .id = "t67effect",
+  .name = "a67",
+  .f = &a67,
+  .next = NULL,
+};
+static struct ufsm_trigger t609_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t609 = {
+  .id = "t609",
+  .name = "",
+  .trigger = t609_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 665,
+  .action = &t609effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s336,
+  .dest = &s336,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t610,
+};
+static struct ufsm_action t609effect = {
+  .id = "t609effect",
+  .name = "a609",
+  .f = &a609,
+  .next = NULL,
+};
+static struct ufsm_trigger t610_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t610 = {
+  .id = "t610",
+  .name = "",
+  .trigger = t610_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 666,
+  .action = &t610effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s336,
+  .dest = &s336,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t611,
+};
+static struct ufsm_action t610effect = {
+  .id = "t610effect",
+  .name = "a610",
+  .f = &a610,
+  .next = NULL,
+};
+static struct ufsm_trigger t611_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t611_exit_path[] = {
+  &r67,
+  NULL,
+};
+static struct ufsm_region * t611_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t611 = {
+  .id = "t611",
+  .name = "",
+  .trigger = t611_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 667,
+  .action = &t611effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s337,
+  .dest = &s41,
+  .lca = &r8,
+  .exit_path = t611_exit_path,
+  .enter_path = t611_enter_path,
+  .next = &t612,
+};
+static struct ufsm_action t611effect = {
+  .id = "t611effect",
+  .name = "a611",
+  .f = &a611,
+  .next = NULL,
+};
+static struct ufsm_trigger t612_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t612_exit_path[] = {
+  &r67,
+  &r8,
+  NULL,
+};
+static struct ufsm_region * t612_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t612 = {
+  .id = "t612",
+  .name = "",
+  .trigger = t612_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 668,
+  .action = &t612effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s337,
+  .dest = &s4,
+  .lca = &r0,
+  .exit_path = t612_exit_path,
+  .enter_path = t612_enter_path,
+  .next = &t613,
+};
+static struct ufsm_action t612effect = {
+  .id = "t612effect",
+  .name = "a612",
+  .f = &a612,
+  .next = NULL,
+};
+static struct ufsm_trigger t613_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t613_exit_path[] = {
+  &r67,
+  NULL,
+};
+static struct ufsm_region * t613_enter_path[] = {
+  &r69,
+  NULL,
+};
+static struct ufsm_transition t613 = {
+  .id = "t613",
+  .name = "",
+  .trigger = t613_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 669,
+  .action = &t613effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s338,
+  .dest = &s346,
+  .lca = &r8,
+  .exit_path = t613_exit_path,
+  .enter_path = t613_enter_path,
+  .next = &t614,
+};
+static struct ufsm_action t613effect = {
+  .id = "t613effect",
+  .name = "a613",
+  .f = &a613,
+  .next = NULL,
+};
+static struct ufsm_trigger t614_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t614 = {
+  .id = "t614",
+  .name = "",
+  .trigger = t614_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 670,
+  .action = &t614effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s338,
+  .dest = &s336,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t615,
+};
+static struct ufsm_action t614effect = {
+  .id = "t614effect",
+  .name = "a614",
+  .f = &a614,
+  .next = NULL,
+};
+static struct ufsm_trigger t615_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t615 = {
+  .id = "t615",
+  .name = "",
+  .trigger = t615_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 671,
+  .action = &t615effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s339,
+  .dest = &s339,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t616,
+};
+static struct ufsm_action t615effect = {
+  .id = "t615effect",
+  .name = "a615",
+  .f = &a615,
+  .next = NULL,
+};
+static struct ufsm_trigger t616_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t616 = {
+  .id = "t616",
+  .name = "",
+  .trigger = t616_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 672,
+  .action = &t616effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s339,
+  .dest = &s338,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t616effect = {
+  .id = "t616effect",
+  .name = "a616",
+  .f = &a616,
+  .next = NULL,
+};
+static struct ufsm_transition * s339_dispatch_4[] = {
+  &t615,
+  NULL,
+};
+static struct ufsm_transition * s339_dispatch_5[] = {
+  &t616,
+  NULL,
+};
+static struct ufsm_dispatch s339_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s339_dispatch_4,
+},
+{
+  .ev = 5,
+  .transition = s339_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s339_interest[] = {
+  0x00000037,
+};
+static struct ufsm_state s339 = {
+  .id   = "s339",
+  .name = "S339",
+  .kind = 0,
+  .index = 360,
+  .parent_region = &r67,
+  .entry = &s339entry,
+  .doact = NULL,
+  .exit = &s339exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s339_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s339_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s338,
+};
+static struct ufsm_entry_exit s339entry = {
+  .id = "s339entry",
+  .name = "e339",
+  .f = &e339,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s339exit = {
+  .id = "s339exit",
+  .name = "x339",
+  .f = &x339,
+  .next = NULL,
+};
+static struct ufsm_transition * s338_dispatch_1[] = {
+  &t613,
+  &t614,
+  NULL,
+};
+static struct ufsm_dispatch s338_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s338_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s338_interest[] = {
+  0x00000007,
+};
+static struct ufsm_state s338 = {
+  .id   = "s338",
+  .name = "S338",
+  .kind = 0,
+  .index = 361,
+  .parent_region = &r67,
+  .entry = &s338entry,
+  .doact = NULL,
+  .exit = &s338exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s338_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s338_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s337,
+};
+static struct ufsm_entry_exit s338entry = {
+  .id = "s338entry",
+  .name = "e338",
+  .f = &e338,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s338exit = {
+  .id = "s338exit",
+  .name = "x338",
+  .f = &x338,
+  .next = NULL,
+};
+static struct ufsm_transition * s337_dispatch_2[] = {
+  &t611,
+  NULL,
+};
+static struct ufsm_transition * s337_dispatch_7[] = {
+  &t612,
+  NULL,
+};
+static struct ufsm_dispatch s337_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s337_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s337_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s337_interest[] = {
+  0x00000087,
+};
+static struct ufsm_state s337 = {
+  .id   = "s337",
+  .name = "S337",
+  .kind = 0,
+  .index = 362,
+  .parent_region = &r67,
+  .entry = &s337entry,
+  .doact = NULL,
+  .exit = &s337exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s337_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s337_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s336,
+};
+static struct ufsm_entry_exit s337entry = {
+  .id = "s337entry",
+  .name = "e337",
+  .f = &e337,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s337exit = {
+  .id = "s337exit",
+  .name = "x337",
+  .f = &x337,
+  .next = NULL,
+};
+static struct ufsm_transition * s336_dispatch_7[] = {
+  &t609,
+  &t610,
+  NULL,
+};
+static struct ufsm_dispatch s336_dispatch[] = {
+{
+  .ev = 7,
+  .transition = s336_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s336_interest[] = {
+  0x00000087,
+};
+static struct ufsm_state s336 = {
+  .id   = "s336",
+  .name = "S336",
+  .kind = 0,
+  .index = 363,
+  .parent_region = &r67,
+  .entry = &s336entry,
+  .doact = NULL,
+  .exit = &s336exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s336_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s336_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s335,
+};
+static struct ufsm_entry_exit s336entry = {
+  .id = "s336entry",
+  .name = "e336",
+  .f = &e336,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s336exit = {
+  .id = "s336exit",
+  .name = "x336",
+  .f = &x336,
+  .next = NULL,
+};
+static struct ufsm_dispatch s335_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s335_interest[] = {
+  0x00000007,
+};
+static struct ufsm_state s335 = {
+  .id   = "s335",
+  .name = "Init",
+  .kind = 1,
+  .index = 364,
+  .parent_region = &r67,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s335_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s335_interest,
+  .time_events = NULL,
+  .completion = &t67,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s42entry = {
+  .id = "s42entry",
+  .name = "e42",
+  .f = &e42,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s42exit = {
+  .id = "s42exit",
+  .name = "x42",
+  .f = &x42,
+  .next = NULL,
+};
+static struct ufsm_transition * s41_dispatch_4[] = {
+  &t138,
+  NULL,
+};
+static struct ufsm_transition * s41_dispatch_6[] = {
+  &t137,
+  NULL,
+};
+static struct ufsm_dispatch s41_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s41_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s41_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s41_interest[] = {
+  0x00000051,
+};
+static struct ufsm_state s41 = {
+  .id   = "s41",
+  .name = "S41",
+  .kind = 0,
+  .index = 294,
+  .parent_region = &r8,
+  .entry = &s41entry,
+  .doact = NULL,
+  .exit = &s41exit,
+  .region = &r66,
+  .submachine = NULL,
+  .dispatch = s41_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s41_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s40,
+};
+static struct ufsm_region r66 = {
+  .id = "r66",
+  .name = "R66",
+  .state = &s334,
+  .has_history = false,
+  .history = NULL,
+  .index = 65,
+  .transition = &t66,
+  .parent_state = &s41,
+  .next = &r65,
+};
+static struct ufsm_transition t66 = {
+  .id = "t66",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 634,
+  .action = &t66effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s330,
+  .dest = &s334,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t601,
+};
+static struct ufsm_action t66effect = {
+  .id = "t66effect",
+  .name = "a66",
+  .f = &a66,
+  .next = NULL,
+};
+static struct ufsm_trigger t601_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t601 = {
+  .id = "t601",
+  .name = "",
+  .trigger = t601_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 635,
+  .action = &t601effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s331,
+  .dest = &s331,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t602,
+};
+static struct ufsm_action t601effect = {
+  .id = "t601effect",
+  .name = "a601",
+  .f = &a601,
+  .next = NULL,
+};
+static struct ufsm_trigger t602_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t602 = {
+  .id = "t602",
+  .name = "",
+  .trigger = t602_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 636,
+  .action = &t602effect,
+  .defer = false,
+  .guard = &t602guard,
+  .source = &s331,
+  .dest = &s332,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t603,
+};
+static struct ufsm_action t602effect = {
+  .id = "t602effect",
+  .name = "a602",
+  .f = &a602,
+  .next = NULL,
+};
+static struct ufsm_guard t602guard = {
+  .id = "t602guard",
+  .name = "g169",
+  .f = &g169,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t603_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t603 = {
+  .id = "t603",
+  .name = "",
+  .trigger = t603_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 637,
+  .action = &t603effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s332,
+  .dest = &s332,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t604,
+};
+static struct ufsm_action t603effect = {
+  .id = "t603effect",
+  .name = "a603",
+  .f = &a603,
+  .next = NULL,
+};
+static struct ufsm_trigger t604_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t604 = {
+  .id = "t604",
+  .name = "",
+  .trigger = t604_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 638,
+  .action = &t604effect,
+  .defer = false,
+  .guard = &t604guard,
+  .source = &s332,
+  .dest = &s331,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t605,
+};
+static struct ufsm_action t604effect = {
+  .id = "t604effect",
+  .name = "a604",
+  .f = &a604,
+  .next = NULL,
+};
+static struct ufsm_guard t604guard = {
+  .id = "t604guard",
+  .name = "g170",
+  .f = &g170,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t605_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t605 = {
+  .id = "t605",
+  .name = "",
+  .trigger = t605_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 639,
+  .action = &t605effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s333,
+  .dest = &s333,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t606,
+};
+static struct ufsm_action t605effect = {
+  .id = "t605effect",
+  .name = "a605",
+  .f = &a605,
+  .next = NULL,
+};
+static struct ufsm_trigger t606_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t606 = {
+  .id = "t606",
+  .name = "",
+  .trigger = t606_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 640,
+  .action = &t606effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s333,
+  .dest = &s333,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t607,
+};
+static struct ufsm_action t606effect = {
+  .id = "t606effect",
+  .name = "a606",
+  .f = &a606,
+  .next = NULL,
+};
+static struct ufsm_trigger t607_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t607_exit_path[] = {
+  &r66,
+  NULL,
+};
+static struct ufsm_region * t607_enter_path[] = {
+  &r71,
+  NULL,
+};
+static struct ufsm_transition t607 = {
+  .id = "t607",
+  .name = "",
+  .trigger = t607_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 641,
+  .action = &t607effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s334,
+  .dest = &s358,
+  .lca = &r8,
+  .exit_path = t607_exit_path,
+  .enter_path = t607_enter_path,
+  .next = &t608,
+};
+static struct ufsm_action t607effect = {
+  .id = "t607effect",
+  .name = "a607",
+  .f = &a607,
+  .next = NULL,
+};
+static struct ufsm_trigger t608_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t608_exit_path[] = {
+  &r66,
+  NULL,
+};
+static struct ufsm_region * t608_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t608 = {
+  .id = "t608",
+  .name = "",
+  .trigger = t608_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 642,
+  .action = &t608effect,
+  .defer = false,
+  .guard = &t608guard,
+  .source = &s334,
+  .dest = &s42,
+  .lca = &r8,
+  .exit_path = t608_exit_path,
+  .enter_path = t608_enter_path,
+  .next = &t657,
+};
+static struct ufsm_action t608effect = {
+  .id = "t608effect",
+  .name = "a608",
+  .f = &a608,
+  .next = NULL,
+};
+static struct ufsm_guard t608guard = {
+  .id = "t608guard",
+  .name = "g171",
+  .f = &g171,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t657_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t657 = {
+  .id = "t657",
+  .name = "",
+  .trigger = t657_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 643,
+  .action = &t657effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s333,
+  .dest = &s365,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t658,
+};
+static struct ufsm_action t657effect = {
+  .id = "t657effect",
+  .name = "a657",
+  .f = &a657,
+  .next = NULL,
+};
+static struct ufsm_transition t658 = {
+  .id = "t658",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 644,
+  .action = &t658effect,
+  .defer = false,
+  .guard = &t658guard,
+  .source = &s365,
+  .dest = &s334,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t659,
+};
+static struct ufsm_action t658effect = {
+  .id = "t658effect",
+  .name = "a658",
+  .f = &a658,
+  .next = NULL,
+};
+static struct ufsm_guard t658guard = {
+  .id = "t658guard",
+  .name = "g187",
+  .f = &g187,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition t659 = {
+  .id = "t659",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 645,
+  .action = &t659effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s365,
+  .dest = &s331,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t659effect = {
+  .id = "t659effect",
+  .name = "a659",
+  .f = &a659,
+  .next = NULL,
+};
+static struct ufsm_transition * s334_dispatch_2[] = {
+  &t607,
+  NULL,
+};
+static struct ufsm_transition * s334_dispatch_7[] = {
+  &t608,
+  NULL,
+};
+static struct ufsm_dispatch s334_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s334_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s334_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s334_interest[] = {
+  0x000000d5,
+};
+static struct ufsm_state s334 = {
+  .id   = "s334",
+  .name = "S334",
+  .kind = 0,
+  .index = 344,
+  .parent_region = &r66,
+  .entry = &s334entry,
+  .doact = NULL,
+  .exit = &s334exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s334_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s334_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s333,
+};
+static struct ufsm_entry_exit s334entry = {
+  .id = "s334entry",
+  .name = "e334",
+  .f = &e334,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s334exit = {
+  .id = "s334exit",
+  .name = "x334",
+  .f = &x334,
+  .next = NULL,
+};
+static struct ufsm_transition * s333_dispatch_5[] = {
+  &t605,
+  NULL,
+};
+static struct ufsm_transition * s333_dispatch_6[] = {
+  &t657,
+  NULL,
+};
+static struct ufsm_transition * s333_dispatch_7[] = {
+  &t606,
+  NULL,
+};
+static struct ufsm_dispatch s333_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s333_dispatch_5,
+},
+{
+  .ev = 6,
+  .transition = s333_dispatch_6,
+},
+{
+  .ev = 7,
+  .transition = s333_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s333_interest[] = {
+  0x000000f1,
+};
+static struct ufsm_state s333 = {
+  .id   = "s333",
+  .name = "S333",
+  .kind = 0,
+  .index = 345,
+  .parent_region = &r66,
+  .entry = &s333entry,
+  .doact = NULL,
+  .exit = &s333exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s333_dispatch,
+  .no_of_dispatch = 3,
+  .flat_dispatch = NULL,
+  .interest = s333_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s332,
+};
+static struct ufsm_entry_exit s333entry = {
+  .id = "s333entry",
+  .name = "e333",
+  .f = &e333,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s333exit = {
+  .id = "s333exit",
+  .name = "x333",
+  .f = &x333,
+  .next = NULL,
+};
+static struct ufsm_transition * s332_dispatch_4[] = {
+  &t604,
+  NULL,
+};
+static struct ufsm_transition * s332_dispatch_7[] = {
+  &t603,
+  NULL,
+};
+static struct ufsm_dispatch s332_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s332_dispatch_4,
+},
+{
+  .ev = 7,
+  .transition = s332_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s332_interest[] = {
+  0x000000d1,
+};
+static struct ufsm_state s332 = {
+  .id   = "s332",
+  .name = "S332",
+  .kind = 0,
+  .index = 346,
+  .parent_region = &r66,
+  .entry = &s332entry,
+  .doact = NULL,
+  .exit = &s332exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s332_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s332_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s331,
+};
+static struct ufsm_entry_exit s332entry = {
+  .id = "s332entry",
+  .name = "e332",
+  .f = &e332,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s332exit = {
+  .id = "s332exit",
+  .name = "x332",
+  .f = &x332,
+  .next = NULL,
+};
+static struct ufsm_transition * s331_dispatch_0[] = {
+  &t601,
+  NULL,
+};
+static struct ufsm_transition * s331_dispatch_7[] = {
+  &t602,
+  NULL,
+};
+static struct ufsm_dispatch s331_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s331_dispatch_0,
+},
+{
+  .ev = 7,
+  .transition = s331_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s331_interest[] = {
+  0x000000d1,
+};
+static struct ufsm_state s331 = {
+  .id   = "s331",
+  .name = "S331",
+  .kind = 0,
+  .index = 347,
+  .parent_region = &r66,
+  .entry = &s331entry,
+  .doact = NULL,
+  .exit = &s331exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s331_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s331_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s365,
+};
+static struct ufsm_entry_exit s331entry = {
+  .id = "s331entry",
+  .name = "e331",
+  .f = &e331,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s331exit = {
+  .id = "s331exit",
+  .name = "x331",
+  .f = &x331,
+  .next = NULL,
+};
+static struct ufsm_dispatch s365_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s365_interest[] = {
+  0x00000051,
+};
+static struct ufsm_state s365 = {
+  .id   = "s365",
+  .name = "(null)",
+  .kind = 9,
+  .index = 348,
+  .parent_region = &r66,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s365_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s365_interest,
+  .time_events = NULL,
+  .completion = &t658,
+  .next = &s330,
+};
+static struct ufsm_dispatch s330_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s330_interest[] = {
+  0x00000051,
+};
+static struct ufsm_state s330 = {
+  .id   = "s330",
+  .name = "Init",
+  .kind = 1,
+  .index = 349,
+  .parent_region = &r66,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s330_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s330_interest,
+  .time_events = NULL,
+  .completion = &t66,
+  .next = NULL,
+};
+static struct ufsm_region r65 = {
+  .id = "r65",
+  .name = "R65",
+  .state = &s329,
+  .has_history = false,
+  .history = NULL,
+  .index = 66,
+  .transition = &t65,
+  .parent_state = &s41,
+  .next = NULL,
+};
+static struct ufsm_transition t65 = {
+  .id = "t65",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 646,
+  .action = &t65effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s325,
+  .dest = &s329,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t593,
+};
+static struct ufsm_action t65effect = {
+  .id = "t65effect",
+  .name = "a65",
+  .f = &a65,
+  .next = NULL,
+};
+static struct ufsm_trigger t593_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t593 = {
+  .id = "t593",
+  .name = "",
+  .trigger = t593_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 647,
+  .action = &t593effect,
+  .defer = false,
+  .guard = &t593guard,
+  .source = &s326,
+  .dest = &s326,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t594,
+};
+static struct ufsm_action t593effect = {
+  .id = "t593effect",
+  .name = "a593",
+  .f = &a593,
+  .next = NULL,
+};
+static struct ufsm_guard t593guard = {
+  .id = "t593guard",
+  .name = "g166",
+  .f = &g166,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t594_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t594_exit_path[] = {
+  &r65,
+  NULL,
+};
+static struct ufsm_region * t594_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t594 = {
+  .id = "t594",
+  .name = "",
+  .trigger = t594_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 648,
+  .action = &t594effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s326,
+  .dest = &s41,
+  .lca = &r8,
+  .exit_path = t594_exit_path,
+  .enter_path = t594_enter_path,
+  .next = &t595,
+};
+static struct ufsm_action t594effect = {
+  .id = "t594effect",
+  .name = "a594",
+  .f = &a594,
+  .next = NULL,
+};
+static struct ufsm_trigger t595_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t595 = {
+  .id = "t595",
+  .name = "",
+  .trigger = t595_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 649,
+  .action = &t595effect,
+  .defer = false,
+  .guard = &t595guard,
+  .source = &s327,
+  .dest = &s326,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t596,
+};
+static struct ufsm_action t595effect = {
+  .id = "t595effect",
+  .name = "a595",
+  .f = &a595,
+  .next = NULL,
+};
+static struct ufsm_guard t595guard = {
+  .id = "t595guard",
+  .name = "g167",
+  .f = &g167,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t596_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t596 = {
+  .id = "t596",
+  .name = "",
+  .trigger = t596_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 650,
+  .action = &t596effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s327,
+  .dest = &s329,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t597,
+};
+static struct ufsm_action t596effect = {
+  .id = "t596effect",
+  .name = "a596",
+  .f = &a596,
+  .next = NULL,
+};
+static struct ufsm_trigger t597_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t597_exit_path[] = {
+  &r65,
+  &r8,
+  NULL,
+};
+static struct ufsm_region * t597_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t597 = {
+  .id = "t597",
+  .name = "",
+  .trigger = t597_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 651,
+  .action = &t597effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s328,
+  .dest = &s7,
+  .lca = &r0,
+  .exit_path = t597_exit_path,
+  .enter_path = t597_enter_path,
+  .next = &t598,
+};
+static struct ufsm_action t597effect = {
+  .id = "t597effect",
+  .name = "a597",
+  .f = &a597,
+  .next = NULL,
+};
+static struct ufsm_trigger t598_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t598 = {
+  .id = "t598",
+  .name = "",
+  .trigger = t598_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 652,
+  .action = &t598effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s328,
+  .dest = &s326,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t599,
+};
+static struct ufsm_action t598effect = {
+  .id = "t598effect",
+  .name = "a598",
+  .f = &a598,
+  .next = NULL,
+};
+static struct ufsm_trigger t599_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t599 = {
+  .id = "t599",
+  .name = "",
+  .trigger = t599_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 653,
+  .action = &t599effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s329,
+  .dest = &s327,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t600,
+};
+static struct ufsm_action t599effect = {
+  .id = "t599effect",
+  .name = "a599",
+  .f = &a599,
+  .next = NULL,
+};
+static struct ufsm_trigger t600_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t600 = {
+  .id = "t600",
+  .name = "",
+  .trigger = t600_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 654,
+  .action = &t600effect,
+  .defer = false,
+  .guard = &t600guard,
+  .source = &s329,
+  .dest = &s326,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t600effect = {
+  .id = "t600effect",
+  .name = "a600",
+  .f = &a600,
+  .next = NULL,
+};
+static struct ufsm_guard t600guard = {
+  .id = "t600guard",
+  .name = "g168",
+  .f = &g168,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s329_dispatch_0[] = {
+  &t599,
+  NULL,
+};
+static struct ufsm_transition * s329_dispatch_6[] = {
+  &t600,
+  NULL,
+};
+static struct ufsm_dispatch s329_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s329_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s329_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s329_interest[] = {
+  0x00000051,
+};
+static struct ufsm_state s329 = {
+  .id   = "s329",
+  .name = "S329",
+  .kind = 0,
+  .index = 350,
+  .parent_region = &r65,
+  .entry = &s329entry,
+  .doact = NULL,
+  .exit = &s329exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s329_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s329_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s328,
+};
+static struct ufsm_entry_exit s329entry = {
+  .id = "s329entry",
+  .name = "e329",
+  .f = &e329,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s329exit = {
+  .id = "s329exit",
+  .name = "x329",
+  .f = &x329,
+  .next = NULL,
+};
+static struct ufsm_transition * s328_dispatch_1[] = {
+  &t598,
+  NULL,
+};
+static struct ufsm_transition * s328_dispatch_4[] = {
+  &t597,
+  NULL,
+};
+static struct ufsm_dispatch s328_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s328_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s328_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s328_interest[] = {
+  0x00000053,
+};
+static struct ufsm_state s328 = {
+  .id   = "s328",
+  .name = "S328",
+  .kind = 0,
+  .index = 351,
+  .parent_region = &r65,
+  .entry = &s328entry,
+  .doact = NULL,
+  .exit = &s328exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s328_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s328_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s327,
+};
+static struct ufsm_entry_exit s328entry = {
+  .id = "s328entry",
+  .name = "e328",
+  .f = &e328,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s328exit = {
+  .id = "s328exit",
+  .name = "x328",
+  .f = &x328,
+  .next = NULL,
+};
+static struct ufsm_transition * s327_dispatch_0[] = {
+  &t596,
+  NULL,
+};
+static struct ufsm_transition * s327_dispatch_2[] = {
+  &t595,
+  NULL,
+};
+static struct ufsm_dispatch s327_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s327_dispatch_0,
+},
+{
+  .ev = 2,
+  .transition = s327_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s327_interest[] = {
+  0x00000055,
+};
+static struct ufsm_state s327 = {
+  .id   = "s327",
+  .name = "S327",
+  .kind = 0,
+  .index = 352,
+  .parent_region = &r65,
+  .entry = &s327entry,
+  .doact = NULL,
+  .exit = &s327exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s327_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s327_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s326,
+};
+static struct ufsm_entry_exit s327entry = {
+  .id = "s327entry",
+  .name = "e327",
+  .f = &e327,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s327exit = {
+  .id = "s327exit",
+  .name = "x327",
+  .f = &x327,
+  .next = NULL,
+};
+static struct ufsm_transition * s326_dispatch_0[] = {
+  &t594,
+  NULL,
+};
+static struct ufsm_transition * s326_dispatch_6[] = {
+  &t593,
+  NULL,
+};
+static struct ufsm_dispatch s326_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s326_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s326_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s326_interest[] = {
+  0x00000051,
+};
+static struct ufsm_state s326 = {
+  .id   = "s326",
+  .name = "S326",
+  .kind = 0,
+  .index = 353,
+  .parent_region = &r65,
+  .entry = &s326entry,
+  .doact = NULL,
+  .exit = &s326exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s326_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s326_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s325,
+};
+static struct ufsm_entry_exit s326entry = {
+  .id = "s326entry",
+  .name = "e326",
+  .f = &e326,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s326exit = {
+  .id = "s326exit",
+  .name = "x326",
+  .f = &x326,
+  .next = NULL,
+};
+static struct ufsm_dispatch s325_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s325_interest[] = {
+  0x00000051,
+};
+static struct ufsm_state s325 = {
+  .id   = "s325",
+  .name = "Init",
+  .kind = 1,
+  .index = 354,
+  .parent_region = &r65,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s325_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s325_interest,
+  .time_events = NULL,
+  .completion = &t65,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s41entry = {
+  .id = "s41entry",
+  .name = "e41",
+  .f = &e41,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s41exit = {
+  .id = "s41exit",
+  .name = "x41",
+  .f = &x41,
+  .next = NULL,
+};
+static struct ufsm_dispatch s40_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s40_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state s40 = {
+  .id   = "s40",
+  .name = "Init",
+  .kind = 1,
+  .index = 295,
+  .parent_region = &r8,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s40_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s40_interest,
+  .time_events = NULL,
+  .completion = &t8,
+  .next = NULL,
+};
+static struct ufsm_region r7 = {
+  .id = "r7",
+  .name = "R7",
+  .state = &s39,
+  .has_history = false,
+  .history = NULL,
+  .index = 56,
+  .transition = &t7,
+  .parent_state = &s4,
+  .next = NULL,
+};
+static struct ufsm_transition t7 = {
+  .id = "t7",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 544,
+  .action = &t7effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s35,
+  .dest = &s37,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t129,
+};
+static struct ufsm_action t7effect = {
+  .id = "t7effect",
+  .name = "a7",
+  .f = &a7,
+  .next = NULL,
+};
+static struct ufsm_trigger t129_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t129 = {
+  .id = "t129",
+  .name = "",
+  .trigger = t129_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 545,
+  .action = &t129effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s36,
+  .dest = &s36,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t130,
+};
+static struct ufsm_action t129effect = {
+  .id = "t129effect",
+  .name = "a129",
+  .f = &a129,
+  .next = NULL,
+};
+static struct ufsm_trigger t130_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t130 = {
+  .id = "t130",
+  .name = "",
+  .trigger = t130_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 546,
+  .action = &t130effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s36,
+  .dest = &s38,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t131,
+};
+static struct ufsm_action t130effect = {
+  .id = "t130effect",
+  .name = "a130",
+  .f = &a130,
+  .next = NULL,
+};
+static struct ufsm_trigger t131_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t131 = {
+  .id = "t131",
+  .name = "",
+  .trigger = t131_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 547,
+  .action = &t131effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s37,
+  .dest = &s36,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t132,
+};
+static struct ufsm_action t131effect = {
+  .id = "t131effect",
+  .name = "a131",
+  .f = &a131,
+  .next = NULL,
+};
+static struct ufsm_trigger t132_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t132_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t132_enter_path[] = {
+  &r57,
+  NULL,
+};
+static struct ufsm_transition t132 = {
+  .id = "t132",
+  .name = "",
+  .trigger = t132_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 548,
+  .action = &t132effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s37,
+  .dest = &s288,
+  .lca = &r7,
+  .exit_path = t132_exit_path,
+  .enter_path = t132_enter_path,
+  .next = &t133,
+};
+static struct ufsm_action t132effect = {
+  .id = "t132effect",
+  .name = "a132",
+  .f = &a132,
+  .next = NULL,
+};
+static struct ufsm_trigger t133_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t133_exit_path[] = {
+  &r7,
+  NULL,
+};
+static struct ufsm_region * t133_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t133 = {
+  .id = "t133",
+  .name = "",
+  .trigger = t133_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 549,
+  .action = &t133effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s38,
+  .dest = &s14,
+  .lca = &r0,
+  .exit_path = t133_exit_path,
+  .enter_path = t133_enter_path,
+  .next = &t134,
+};
+static struct ufsm_action t133effect = {
+  .id = "t133effect",
+  .name = "a133",
+  .f = &a133,
+  .next = NULL,
+};
+static struct ufsm_trigger t134_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t134_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t134_enter_path[] = {
+  &r58,
+  NULL,
+};
+static struct ufsm_transition t134 = {
+  .id = "t134",
+  .name = "",
+  .trigger = t134_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 550,
+  .action = &t134effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s38,
+  .dest = &s293,
+  .lca = &r7,
+  .exit_path = t134_exit_path,
+  .enter_path = t134_enter_path,
+  .next = &t135,
+};
+static struct ufsm_action t134effect = {
+  .id = "t134effect",
+  .name = "a134",
+  .f = &a134,
+  .next = NULL,
+};
+static struct ufsm_trigger t135_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t135_exit_path[] = {
+  &r7,
+  NULL,
+};
+static struct ufsm_region * t135_enter_path[] = {
+  &r6,
+  NULL,
+};
+static struct ufsm_transition t135 = {
+  .id = "t135",
+  .name = "",
+  .trigger = t135_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 551,
+  .action = &t135effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s39,
+  .dest = &s32,
+  .lca = &r0,
+  .exit_path = t135_exit_path,
+  .enter_path = t135_enter_path,
+  .next = &t136,
+};
+static struct ufsm_action t135effect = {
+  .id = "t135effect",
+  .name = "a135",
+  .f = &a135,
+  .next = NULL,
+};
+static struct ufsm_trigger t136_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t136_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t136_enter_path[] = {
+  &r57,
+  NULL,
+};
+static struct ufsm_transition t136 = {
+  .id = "t136",
+  .name = "",
+  .trigger = t136_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 552,
+  .action = &t136effect,
+  .defer = false,
+  .guard = &t136guard,
+  .source = &s39,
+  .dest = &s287,
+  .lca = &r7,
+  .exit_path = t136_exit_path,
+  .enter_path = t136_enter_path,
+  .next = &t677,
+};
+static struct ufsm_action t136effect = {
+  .id = "t136effect",
+  .name = "a136",
+  .f = &a136,
+  .next = NULL,
+};
+static struct ufsm_guard t136guard = {
+  .id = "t136guard",
+  .name = "g23",
+  .f = &g23,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t677_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t677 = {
+  .id = "t677",
+  .name = "",
+  .trigger = t677_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 553,
+  .action = &t677effect,
+  .defer = false,
+  .guard = &t677guard,
+  .source = &s36,
+  .dest = &s373,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t678,
+};
+static struct ufsm_action t677effect = {
+  .id = "t677effect",
+  .name = "a677",
+  .f = &a677,
+  .next = NULL,
+};
+static struct ufsm_guard t677guard = {
+  .id = "t677guard",
+  .name = "g193",
+  .f = &g193,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_region * t678_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t678_enter_path[] = {
+  &r63,
+  NULL,
+};
+static struct ufsm_transition t678 = {
+  .id = "t678",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 554,
+  .action = &t678effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s373,
+  .dest = &s319,
+  .lca = &r7,
+  .exit_path = t678_exit_path,
+  .enter_path = t678_enter_path,
+  .next = &t679,
+};
+static struct ufsm_action t678effect = {
+  .id = "t678effect",
+  .name = "a678",
+  .f = &a678,
+  .next = NULL,
+};
+static struct ufsm_region * t679_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t679_enter_path[] = {
+  &r64,
+  NULL,
+};
+static struct ufsm_transition t679 = {
+  .id = "t679",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 555,
+  .action = &t679effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s373,
+  .dest = &s323,
+  .lca = &r7,
+  .exit_path = t679_exit_path,
+  .enter_path = t679_enter_path,
+  .next = &t682,
+};
+static struct ufsm_action t679effect = {
+  .id = "t679effect",
+  .name = "a679",
+  .f = &a679,
+  .next = NULL,
+};
+static struct ufsm_transition t682 = {
+  .id = "t682",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 556,
+  .action = &t682effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s374,
+  .dest = &s36,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t686,
+};
+static struct ufsm_action t682effect = {
+  .id = "t682effect",
+  .name = "a682",
+  .f = &a682,
+  .next = NULL,
+};
+static struct ufsm_transition t686 = {
+  .id = "t686",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 557,
+  .action = &t686effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s36,
+  .dest = &s376,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t686effect = {
+  .id = "t686effect",
+  .name = "a686",
+  .f = &a686,
+  .next = NULL,
+};
+static struct ufsm_transition * s39_dispatch_5[] = {
+  &t135,
+  NULL,
+};
+static struct ufsm_transition * s39_dispatch_7[] = {
+  &t136,
+  NULL,
+};
+static struct ufsm_dispatch s39_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s39_dispatch_5,
+},
+{
+  .ev = 7,
+  .transition = s39_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s39_interest[] = {
+  0x000000a1,
+};
+static struct ufsm_state s39 = {
+  .id   = "s39",
+  .name = "S39",
+  .kind = 0,
+  .index = 296,
+  .parent_region = &r7,
+  .entry = &s39entry,
+  .doact = NULL,
+  .exit = &s39exit,
+  .region = &r64,
+  .submachine = NULL,
+  .dispatch = s39_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s39_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s38,
+};
+static struct ufsm_region r64 = {
+  .id = "r64",
+  .name = "R64",
+  .state = &s324,
+  .has_history = false,
+  .history = NULL,
+  .index = 63,
+  .transition = &t64,
+  .parent_state = &s39,
+  .next = &r63,
+};
+static struct ufsm_transition t64 = {
+  .id = "t64",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 614,
+  .action = &t64effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s320,
+  .dest = &s324,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t585,
+};
+static struct ufsm_action t64effect = {
+  .id = "t64effect",
+  .name = "a64",
+  .f = &a64,
+  .next = NULL,
+};
+static struct ufsm_trigger t585_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t585 = {
+  .id = "t585",
+  .name = "",
+  .trigger = t585_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 615,
+  .action = &t585effect,
+  .defer = false,
+  .guard = &t585guard,
+  .source = &s321,
+  .dest = &s324,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t586,
+};
+static struct ufsm_action t585effect = {
+  .id = "t585effect",
+  .name = "a585",
+  .f = &a585,
+  .next = NULL,
+};
+static struct ufsm_guard t585guard = {
+  .id = "t585guard",
+  .name = "g162",
+  .f = &g162,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t586_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t586 = {
+  .id = "t586",
+  .name = "",
+  .trigger = t586_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 616,
+  .action = &t586effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s321,
+  .dest = &s322,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t587,
+};
+static struct ufsm_action t586effect = {
+  .id = "t586effect",
+  .name = "a586",
+  .f = &a586,
+  .next = NULL,
+};
+static struct ufsm_trigger t587_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t587 = {
+  .id = "t587",
+  .name = "",
+  .trigger = t587_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 617,
+  .action = &t587effect,
+  .defer = false,
+  .guard = &t587guard,
+  .source = &s322,
+  .dest = &s322,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t588,
+};
+static struct ufsm_action t587effect = {
+  .id = "t587effect",
+  .name = "a587",
+  .f = &a587,
+  .next = NULL,
+};
+static struct ufsm_guard t587guard = {
+  .id = "t587guard",
+  .name = "g163",
+  .f = &g163,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t588_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t588 = {
+  .id = "t588",
+  .name = "",
+  .trigger = t588_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 618,
+  .action = &t588effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s322,
+  .dest = &s323,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t589,
+};
+static struct ufsm_action t588effect = {
+  .id = "t588effect",
+  .name = "a588",
+  .f = &a588,
+  .next = NULL,
+};
+static struct ufsm_trigger t589_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t589 = {
+  .id = "t589",
+  .name = "",
+  .trigger = t589_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 619,
+  .action = &t589effect,
+  .defer = false,
+  .guard = &t589guard,
+  .source = &s323,
+  .dest = &s321,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t590,
+};
+static struct ufsm_action t589effect = {
+  .id = "t589effect",
+  .name = "a589",
+  .f = &a589,
+  .next = NULL,
+};
+static struct ufsm_guard t589guard = {
+  .id = "t589guard",
+  .name = "g164",
+  .f = &g164,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t590_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t590 = {
+  .id = "t590",
+  .name = "",
+  .trigger = t590_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 620,
+  .action = &t590effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s323,
+  .dest = &s321,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t591,
+};
+static struct ufsm_action t590effect = {
+  .id = "t590effect",
+  .name = "a590",
+  .f = &a590,
+  .next = NULL,
+};
+static struct ufsm_trigger t591_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t591 = {
+  .id = "t591",
+  .name = "",
+  .trigger = t591_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 621,
+  .action = &t591effect,
+  .defer = false,
+  .guard = &t591guard,
+  .source = &s324,
+  .dest = &s321,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t592,
+};
+static struct ufsm_action t591effect = {
+  .id = "t591effect",
+  .name = "a591",
+  .f = &a591,
+  .next = NULL,
+};
+static struct ufsm_guard t591guard = {
+  .id = "t591guard",
+  .name = "g165",
+  .f = &g165,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t592_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t592 = {
+  .id = "t592",
+  .name = "",
+  .trigger = t592_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 622,
+  .action = &t592effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s324,
+  .dest = &s321,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t681,
+};
+static struct ufsm_action t592effect = {
+  .id = "t592effect",
+  .name = "a592",
+  .f = &a592,
+  .next = NULL,
+};
+static struct ufsm_transition t681 = {
+  .id = "t681",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 623,
+  .action = &t681effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s322,
+  .dest = &s374,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t681effect = {
+  .id = "t681effect",
+  .name = "a681",
+  .f = &a681,
+  .next = NULL,
+};
+static struct ufsm_transition * s324_dispatch_0[] = {
+  &t592,
+  NULL,
+};
+static struct ufsm_transition * s324_dispatch_3[] = {
+  &t591,
+  NULL,
+};
+static struct ufsm_dispatch s324_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s324_dispatch_0,
+},
+{
+  .ev = 3,
+  .transition = s324_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s324_interest[] = {
+  0x000000a9,
+};
+static struct ufsm_state s324 = {
+  .id   = "s324",
+  .name = "S324",
+  .kind = 0,
+  .index = 334,
+  .parent_region = &r64,
+  .entry = &s324entry,
+  .doact = NULL,
+  .exit = &s324exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s324_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s324_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s323,
+};
+static struct ufsm_entry_exit s324entry = {
+  .id = "s324entry",
+  .name = "e324",
+  .f = &e324,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s324exit = {
+  .id = "s324exit",
+  .name = "x324",
+  .f = &x324,
+  .next = NULL,
+};
+static struct ufsm_transition * s323_dispatch_0[] = {
+  &t590,
+  NULL,
+};
+static struct ufsm_transition * s323_dispatch_7[] = {
+  &t589,
+  NULL,
+};
+static struct ufsm_dispatch s323_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s323_dispatch_0,
+},
+{
+  .ev = 7,
+  .transition = s323_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s323_interest[] = {
+  0x000000a1,
+};
+static struct ufsm_state s323 = {
+  .id   = "s323",
+  .name = "S323",
+  .kind = 0,
+  .index = 335,
+  .parent_region = &r64,
+  .entry = &s323entry,
+  .doact = NULL,
+  .exit = &s323exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s323_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s323_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s322,
+};
+static struct ufsm_entry_exit s323entry = {
+  .id = "s323entry",
+  .name = "e323",
+  .f = &e323,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s323exit = {
+  .id = "s323exit",
+  .name = "x323",
+  .f = &x323,
+  .next = NULL,
+};
+static struct ufsm_transition * s322_dispatch_1[] = {
+  &t588,
+  NULL,
+};
+static struct ufsm_transition * s322_dispatch_3[] = {
+  &t587,
+  NULL,
+};
+static struct ufsm_dispatch s322_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s322_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s322_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s322_interest[] = {
+  0x000000ab,
+};
+static struct ufsm_state s322 = {
+  .id   = "s322",
+  .name = "S322",
+  .kind = 0,
+  .index = 336,
+  .parent_region = &r64,
+  .entry = &s322entry,
+  .doact = NULL,
+  .exit = &s322exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s322_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s322_interest,
+  .time_events = NULL,
+  .completion = &t681,
+  .next = &s321,
+};
+static struct ufsm_entry_exit s322entry = {
+  .id = "s322entry",
+  .name = "e322",
+  .f = &e322,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s322exit = {
+  .id = "s322exit",
+  .name = "x322",
+  .f = &x322,
+  .next = NULL,
+};
+static struct ufsm_transition * s321_dispatch_4[] = {
+  &t585,
+  NULL,
+};
+static struct ufsm_transition * s321_dispatch_5[] = {
+  &t586,
+  NULL,
+};
+static struct ufsm_dispatch s321_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s321_dispatch_4,
+},
+{
+  .ev = 5,
+  .transition = s321_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s321_interest[] = {
+  0x000000b1,
+};
+static struct ufsm_state s321 = {
+  .id   = "s321",
+  .name = "S321",
+  .kind = 0,
+  .index = 337,
+  .parent_region = &r64,
+  .entry = &s321entry,
+  .doact = NULL,
+  .exit = &s321exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s321_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s321_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s320,
+};
+static struct ufsm_entry_exit s321entry = {
+  .id = "s321entry",
+  .name = "e321",
+  .f = &e321,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s321exit = {
+  .id = "s321exit",
+  .name = "x321",
+  .f = &x321,
+  .next = NULL,
+};
+static struct ufsm_dispatch s320_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s320_interest[] = {
+  0x000000a1,
+};
+static struct ufsm_state s320 = {
+  .id   = "s320",
+  .name = "Init",
+  .kind = 1,
+  .index = 338,
+  .parent_region = &r64,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s320_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s320_interest,
+  .time_events = NULL,
+  .completion = &t64,
+  .next = NULL,
+};
+static struct ufsm_region r63 = {
+  .id = "r63",
+  .name = "R63",
+  .state = &s319,
+  .has_history = false,
+  .history = NULL,
+  .index = 64,
+  .transition = &t63,
+  .parent_state = &s39,
+  .next = NULL,
+};
+static struct ufsm_transition t63 = {
+  .id = "t63",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 624,
+  .action = &t63effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s315,
+  .dest = &s317,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t577,
+};
+static struct ufsm_action t63effect = {
+  .id = "t63effect",
+  .name = "a63",
+  .f = &a63,
+  .next = NULL,
+};
+static struct ufsm_trigger t577_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t577_exit_path[] = {
+  &r63,
+  NULL,
+};
+static struct ufsm_region * t577_enter_path[] = {
+  &r7,
+  NULL,
+};
+static struct ufsm_transition t577 = {
+  .id = "t577",
+  .name = "",
+  .trigger = t577_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 625,
+  .action = &t577effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s316,
+  .dest = &s38,
+  .lca = &r7,
+  .exit_path = t577_exit_path,
+  .enter_path = t577_enter_path,
+  .next = &t578,
+};
+static struct ufsm_action t577effect = {
+  .id = "t577effect",
+  .name = "a577",
+  .f = &a577,
+  .next = NULL,
+};
+static struct ufsm_trigger t578_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t578 = {
+  .id = "t578",
+  .name = "",
+  .trigger = t578_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 626,
+  .action = &t578effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s316,
+  .dest = &s316,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t579,
+};
+static struct ufsm_action t578effect = {
+  .id = "t578effect",
+  .name = "a578",
+  .f = &a578,
+  .next = NULL,
+};
+static struct ufsm_trigger t579_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t579 = {
+  .id = "t579",
+  .name = "",
+  .trigger = t579_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 627,
+  .action = &t579effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s317,
+  .dest = &s316,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t580,
+};
+static struct ufsm_action t579effect = {
+  .id = "t579effect",
+  .name = "a579",
+  .f = &a579,
+  .next = NULL,
+};
+static struct ufsm_trigger t580_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t580_exit_path[] = {
+  &r63,
+  NULL,
+};
+static struct ufsm_region * t580_enter_path[] = {
+  &r64,
+  NULL,
+};
+static struct ufsm_transition t580 = {
+  .id = "t580",
+  .name = "",
+  .trigger = t580_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 628,
+  .action = &t580effect,
+  .defer = false,
+  .guard = &t580guard,
+  .source = &s317,
+  .dest = &s323,
+  .lca = &r7,
+  .exit_path = t580_exit_path,
+  .enter_path = t580_enter_path,
+  .next = &t581,
+};
+static struct ufsm_action t580effect = {
+  .id = "t580effect",
+  .name = "a580",
+  .f = &a580,
+  .next = NULL,
+};
+static struct ufsm_guard t580guard = {
+  .id = "t580guard",
+  .name = "g161",
+  .f = &g161,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t581_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t581 = {
+  .id = "t581",
+  .name = "",
+  .trigger = t581_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 629,
+  .action = &t581effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s318,
+  .dest = &s317,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t582,
+};
+static struct ufsm_action t581effect = {
+  .id = "t581effect",
+  .name = "a581",
+  .f = &a581,
+  .next = NULL,
+};
+static struct ufsm_trigger t582_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t582 = {
+  .id = "t582",
+  .name = "",
+  .trigger = t582_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 630,
+  .action = &t582effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s318,
+  .dest = &s318,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t583,
+};
+static struct ufsm_action t582effect = {
+  .id = "t582effect",
+  .name = "a582",
+  .f = &a582,
+  .next = NULL,
+};
+static struct ufsm_trigger t583_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t583 = {
+  .id = "t583",
+  .name = "",
+  .trigger = t583_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 631,
+  .action = &t583effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s319,
+  .dest = &s319,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t584,
+};
+static struct ufsm_action t583effect = {
+  .id = "t583effect",
+  .name = "a583",
+  .f = &a583,
+  .next = NULL,
+};
+static struct ufsm_trigger t584_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t584 = {
+  .id = "t584",
+  .name = "",
+  .trigger = t584_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 632,
+  .action = &t584effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s319,
+  .dest = &s318,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t680,
+};
+static struct ufsm_action t584effect = {
+  .id = "t584effect",
+  .name = "a584",
+  .f = &a584,
+  .next = NULL,
+};
+static struct ufsm_transition t680 = {
+  .id = "t680",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 633,
+  .action = &t680effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s316,
+  .dest = &s374,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t680effect = {
+  .id = "t680effect",
+  .name = "a680",
+  .f = &a680,
+  .next = NULL,
+};
+static struct ufsm_transition * s319_dispatch_0[] = {
+  &t584,
+  NULL,
+};
+static struct ufsm_transition * s319_dispatch_7[] = {
+  &t583,
+  NULL,
+};
+static struct ufsm_dispatch s319_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s319_dispatch_0,
+},
+{
+  .ev = 7,
+  .transition = s319_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s319_interest[] = {
+  0x000000a1,
+};
+static struct ufsm_state s319 = {
+  .id   = "s319",
+  .name = "S319",
+  .kind = 0,
+  .index = 339,
+  .parent_region = &r63,
+  .entry = &s319entry,
+  .doact = NULL,
+  .exit = &s319exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s319_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s319_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s318,
+};
+static struct ufsm_entry_exit s319entry = {
+  .id = "s319entry",
+  .name = "e319",
+  .f = &e319,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s319exit = {
+  .id = "s319exit",
+  .name = "x319",
+  .f = &x319,
+  .next = NULL,
+};
+static struct ufsm_transition * s318_dispatch_2[] = {
+  &t582,
+  NULL,
+};
+static struct ufsm_transition * s318_dispatch_4[] = {
+  &t581,
+  NULL,
+};
+static struct ufsm_dispatch s318_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s318_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s318_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s318_interest[] = {
+  0x000000b5,
+};
+static struct ufsm_state s318 = {
+  .id   = "s318",
+  .name = "S318",
+  .kind = 0,
+  .index = 340,
+  .parent_region = &r63,
+  .entry = &s318entry,
+  .doact = NULL,
+  .exit = &s318exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s318_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s318_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s317,
+};
+static struct ufsm_entry_exit s318entry = {
+  .id = "s318entry",
+  .name = "e318",
+  .f = &e318,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s318exit = {
+  .id = "s318exit",
+  .name = "x318",
+  .f = &x318,
+  .next = NULL,
+};
+static struct ufsm_transition * s317_dispatch_0[] = {
+  &t580,
+  NULL,
+};
+static struct ufsm_transition * s317_dispatch_1[] = {
+  &t579,
+  NULL,
+};
+static struct ufsm_dispatch s317_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s317_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = s317_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s317_interest[] = {
+  0x000000a3,
+};
+static struct ufsm_state s317 = {
+  .id   = "s317",
+  .name = "S317",
+  .kind = 0,
+  .index = 341,
+  .parent_region = &r63,
+  .entry = &s317entry,
+  .doact = NULL,
+  .exit = &s317exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s317_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s317_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s316,
+};
+static struct ufsm_entry_exit s317entry = {
+  .id = "s317entry",
+  .name = "e317",
+  .f = &e317,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s317exit = {
+  .id = "s317exit",
+  .name = "x317",
+  .f = &x317,
+  .next = NULL,
+};
+static struct ufsm_transition * s316_dispatch_0[] = {
+  &t578,
+  NULL,
+};
+static struct ufsm_transition * s316_dispatch_4[] = {
+  &t577,
+  NULL,
+};
+static struct ufsm_dispatch s316_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s316_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s316_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s316_interest[] = {
+  0x000000b1,
+};
+static struct ufsm_state s316 = {
+  .id   = "s316",
+  .name = "S316",
+  .kind = 0,
+  .index = 342,
+  .parent_region = &r63,
+  .entry = &s316entry,
+  .doact = NULL,
+  .exit = &s316exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s316_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s316_interest,
+  .time_events = NULL,
+  .completion = &t680,
+  .next = &s315,
+};
+static struct ufsm_entry_exit s316entry = {
+  .id = "s316entry",
+  .name = "e316",
+  .f = &e316,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s316exit = {
+  .id = "s316exit",
+  .name = "x316",
+  .f = &x316,
+  .next = NULL,
+};
+static struct ufsm_dispatch s315_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s315_interest[] = {
+  0x000000a1,
+};
+static struct ufsm_state s315 = {
+  .id   = "s315",
+  .name = "Init",
+  .kind = 1,
+  .index = 343,
+  .parent_region = &r63,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s315_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s315_interest,
+  .time_events = NULL,
+  .completion = &t63,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s39entry = {
+  .id = "s39entry",
+  .name = "e39",
+  .f = &e39,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s39exit = {
+  .id = "s39exit",
+  .name = "x39",
+  .f = &x39,
+  .next = NULL,
+};
+static struct ufsm_transition * s38_dispatch_0[] = {
+  &t133,
+  NULL,
+};
+static struct ufsm_transition * s38_dispatch_5[] = {
+  &t134,
+  NULL,
+};
+static struct ufsm_dispatch s38_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s38_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s38_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s38_interest[] = {
+  0x00000021,
+};
+static struct ufsm_state s38 = {
+  .id   = "s38",
+  .name = "S38",
+  .kind = 0,
+  .index = 297,
+  .parent_region = &r7,
+  .entry = &s38entry,
+  .doact = NULL,
+  .exit = &s38exit,
+  .region = &r62,
+  .submachine = NULL,
+  .dispatch = s38_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s38_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s37,
+};
+static struct ufsm_region r62 = {
+  .id = "r62",
+  .name = "R62",
+  .state = &s314,
+  .has_history = false,
+  .history = NULL,
+  .index = 61,
+  .transition = &t62,
+  .parent_state = &s38,
+  .next = &r61,
+};
+static struct ufsm_transition t62 = {
+  .id = "t62",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 596,
+  .action = &t62effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s310,
+  .dest = &s314,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t569,
+};
+static struct ufsm_action t62effect = {
+  .id = "t62effect",
+  .name = "a62",
+  .f = &a62,
+  .next = NULL,
+};
+static struct ufsm_trigger t569_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t569 = {
+  .id = "t569",
+  .name = "",
+  .trigger = t569_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 597,
+  .action = &t569effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s311,
+  .dest = &s312,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t570,
+};
+static struct ufsm_action t569effect = {
+  .id = "t569effect",
+  .name = "a569",
+  .f = &a569,
+  .next = NULL,
+};
+static struct ufsm_trigger t570_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t570_exit_path[] = {
+  &r62,
+  &r7,
+  NULL,
+};
+static struct ufsm_region * t570_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t570 = {
+  .id = "t570",
+  .name = "",
+  .trigger = t570_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 598,
+  .action = &t570effect,
+  .defer = false,
+  .guard = &t570guard,
+  .source = &s311,
+  .dest = &s3,
+  .lca = &r0,
+  .exit_path = t570_exit_path,
+  .enter_path = t570_enter_path,
+  .next = &t571,
+};
+static struct ufsm_action t570effect = {
+  .id = "t570effect",
+  .name = "a570",
+  .f = &a570,
+  .next = NULL,
+};
+static struct ufsm_guard t570guard = {
+  .id = "t570guard",
+  .name = "g157",
+  .f = &g157,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t571_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t571 = {
+  .id = "t571",
+  .name = "",
+  .trigger = t571_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 599,
+  .action = &t571effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s312,
+  .dest = &s312,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t572,
+};
+static struct ufsm_action t571effect = {
+  .id = "t571effect",
+  .name = "a571",
+  .f = &a571,
+  .next = NULL,
+};
+static struct ufsm_trigger t572_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t572 = {
+  .id = "t572",
+  .name = "",
+  .trigger = t572_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 600,
+  .action = &t572effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s312,
+  .dest = &s312,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t573,
+};
+static struct ufsm_action t572effect = {
+  .id = "t572effect",
+  .name = "a572",
+  .f = &a572,
+  .next = NULL,
+};
+static struct ufsm_trigger t573_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t573 = {
+  .id = "t573",
+  .name = "",
+  .trigger = t573_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 601,
+  .action = &t573effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s313,
+  .dest = &s313,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t574,
+};
+static struct ufsm_action t573effect = {
+  .id = "t573effect",
+  .name = "a573",
+  .f = &a573,
+  .next = NULL,
+};
+static struct ufsm_trigger t574_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t574 = {
+  .id = "t574",
+  .name = "",
+  .trigger = t574_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 602,
+  .action = &t574effect,
+  .defer = false,
+  .guard = &t574guard,
+  .source = &s313,
+  .dest = &s311,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t575,
+};
+static struct ufsm_action t574effect = {
+  .id = "t574effect",
+  .name = "a574",
+  .f = &a574,
+  .next = NULL,
+};
+static struct ufsm_guard t574guard = {
+  .id = "t574guard",
+  .name = "g158",
+  .f = &g158,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t575_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t575_exit_path[] = {
+  &r62,
+  NULL,
+};
+static struct ufsm_region * t575_enter_path[] = {
+  &r57,
+  NULL,
+};
+static struct ufsm_transition t575 = {
+  .id = "t575",
+  .name = "",
+  .trigger = t575_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 603,
+  .action = &t575effect,
+  .defer = false,
+  .guard = &t575guard,
+  .source = &s314,
+  .dest = &s289,
+  .lca = &r7,
+  .exit_path = t575_exit_path,
+  .enter_path = t575_enter_path,
+  .next = &t576,
+};
+static struct ufsm_action t575effect = {
+  .id = "t575effect",
+  .name = "a575",
+  .f = &a575,
+  .next = NULL,
+};
+static struct ufsm_guard t575guard = {
+  .id = "t575guard",
+  .name = "g159",
+  .f = &g159,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t576_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t576 = {
+  .id = "t576",
+  .name = "",
+  .trigger = t576_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 604,
+  .action = &t576effect,
+  .defer = false,
+  .guard = &t576guard,
+  .source = &s314,
+  .dest = &s313,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t576effect = {
+  .id = "t576effect",
+  .name = "a576",
+  .f = &a576,
+  .next = NULL,
+};
+static struct ufsm_guard t576guard = {
+  .id = "t576guard",
+  .name = "g160",
+  .f = &g160,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s314_dispatch_2[] = {
+  &t575,
+  NULL,
+};
+static struct ufsm_transition * s314_dispatch_4[] = {
+  &t576,
+  NULL,
+};
+static struct ufsm_dispatch s314_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s314_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s314_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s314_interest[] = {
+  0x00000035,
+};
+static struct ufsm_state s314 = {
+  .id   = "s314",
+  .name = "S314",
+  .kind = 0,
+  .index = 324,
+  .parent_region = &r62,
+  .entry = &s314entry,
+  .doact = NULL,
+  .exit = &s314exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s314_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s314_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s313,
+};
+static struct ufsm_entry_exit s314entry = {
+  .id = "s314entry",
+  .name = "e314",
+  .f = &e314,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s314exit = {
+  .id = "s314exit",
+  .name = "x314",
+  .f = &x314,
+  .next = NULL,
+};
+static struct ufsm_transition * s313_dispatch_5[] = {
+  &t574,
+  NULL,
+};
+static struct ufsm_transition * s313_dispatch_6[] = {
+  &t573,
+  NULL,
+};
+static struct ufsm_dispatch s313_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s313_dispatch_5,
+},
+{
+  .ev = 6,
+  .transition = s313_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s313_interest[] = {
+  0x00000061,
+};
+static struct ufsm_state s313 = {
+  .id   = "s313",
+  .name = "S313",
+  .kind = 0,
+  .index = 325,
+  .parent_region = &r62,
+  .entry = &s313entry,
+  .doact = NULL,
+  .exit = &s313exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s313_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s313_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s312,
+};
+static struct ufsm_entry_exit s313entry = {
+  .id = "s313entry",
+  .name = "e313",
+  .f = &e313,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s313exit = {
+  .id = "s313exit",
+  .name = "x313",
+  .f = &x313,
+  .next = NULL,
+};
+static struct ufsm_transition * s312_dispatch_4[] = {
+  &t571,
+  NULL,
+};
+static struct ufsm_transition * s312_dispatch_5[] = {
+  &t572,
+  NULL,
+};
+static struct ufsm_dispatch s312_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s312_dispatch_4,
+},
+{
+  .ev = 5,
+  .transition = s312_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s312_interest[] = {
+  0x00000031,
+};
+static struct ufsm_state s312 = {
+  .id   = "s312",
+  .name = "S312",
+  .kind = 0,
+  .index = 326,
+  .parent_region = &r62,
+  .entry = &s312entry,
+  .doact = NULL,
+  .exit = &s312exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s312_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s312_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s311,
+};
+static struct ufsm_entry_exit s312entry = {
+  .id = "s312entry",
+  .name = "e312",
+  .f = &e312,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s312exit = {
+  .id = "s312exit",
+  .name = "x312",
+  .f = &x312,
+  .next = NULL,
+};
+static struct ufsm_transition * s311_dispatch_2[] = {
+  &t570,
+  NULL,
+};
+static struct ufsm_transition * s311_dispatch_6[] = {
+  &t569,
+  NULL,
+};
+static struct ufsm_dispatch s311_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s311_dispatch_2,
+},
+{
+  .ev = 6,
+  .transition = s311_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s311_interest[] = {
+  0x00000065,
+};
+static struct ufsm_state s311 = {
+  .id   = "s311",
+  .name = "S311",
+  .kind = 0,
+  .index = 327,
+  .parent_region = &r62,
+  .entry = &s311entry,
+  .doact = NULL,
+  .exit = &s311exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s311_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s311_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s310,
+};
+static struct ufsm_entry_exit s311entry = {
+  .id = "s311entry",
+  .name = "e311",
+  .f = &e311,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s311exit = {
+  .id = "s311exit",
+  .name = "x311",
+  .f = &x311,
+  .next = NULL,
+};
+static struct ufsm_dispatch s310_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s310_interest[] = {
+  0x00000021,
+};
+static struct ufsm_state s310 = {
+  .id   = "s310",
+  .name = "Init",
+  .kind = 1,
+  .index = 328,
+  .parent_region = &r62,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s310_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s310_interest,
+  .time_events = NULL,
+  .completion = &t62,
+  .next = NULL,
+};
+static struct ufsm_region r61 = {
+  .id = "r61",
+  .name = "R61",
+  .state = &s309,
+  .has_history = false,
+  .history = NULL,
+  .index = 62,
+  .transition = &t61,
+  .parent_state = &s38,
+  .next = NULL,
+};
+static struct ufsm_transition t61 = {
+  .id = "t61",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 605,
+  .action = &t61effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s305,
+  .dest = &s308,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t561,
+};
+static struct ufsm_action t61effect = {
+  .id = "t61effect",
+  .name = "a61",
+  .f = &a61,
+  .next = NULL,
+};
+static struct ufsm_trigger t561_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t561 = {
+  .id = "t561",
+  .name = "",
+  .trigger = t561_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 606,
+  .action = &t561effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s306,
+  .dest = &s308,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t562,
+};
+static struct ufsm_action t561effect = {
+  .id = "t561effect",
+  .name = "a561",
+  .f = &a561,
+  .next = NULL,
+};
+static struct ufsm_trigger t562_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t562 = {
+  .id = "t562",
+  .name = "",
+  .trigger = t562_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 607,
+  .action = &t562effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s306,
+  .dest = &s309,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t563,
+};
+static struct ufsm_action t562effect = {
+  .id = "t562effect",
+  .name = "a562",
+  .f = &a562,
+  .next = NULL,
+};
+static struct ufsm_trigger t563_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t563_exit_path[] = {
+  &r61,
+  NULL,
+};
+static struct ufsm_region * t563_enter_path[] = {
+  &r63,
+  NULL,
+};
+static struct ufsm_transition t563 = {
+  .id = "t563",
+  .name = "",
+  .trigger = t563_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 608,
+  .action = &t563effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s307,
+  .dest = &s317,
+  .lca = &r7,
+  .exit_path = t563_exit_path,
+  .enter_path = t563_enter_path,
+  .next = &t564,
+};
+static struct ufsm_action t563effect = {
+  .id = "t563effect",
+  .name = "a563",
+  .f = &a563,
+  .next = NULL,
+};
+static struct ufsm_trigger t564_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t564 = {
+  .id = "t564",
+  .name = "",
+  .trigger = t564_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 609,
+  .action = &t564effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s307,
+  .dest = &s308,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t565,
+};
+static struct ufsm_action t564effect = {
+  .id = "t564effect",
+  .name = "a564",
+  .f = &a564,
+  .next = NULL,
+};
+static struct ufsm_trigger t565_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t565_exit_path[] = {
+  &r61,
+  &r7,
+  NULL,
+};
+static struct ufsm_region * t565_enter_path[] = {
+  &r6,
+  NULL,
+};
+static struct ufsm_transition t565 = {
+  .id = "t565",
+  .name = "",
+  .trigger = t565_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 610,
+  .action = &t565effect,
+  .defer = false,
+  .guard = &t565guard,
+  .source = &s308,
+  .dest = &s31,
+  .lca = &r0,
+  .exit_path = t565_exit_path,
+  .enter_path = t565_enter_path,
+  .next = &t566,
+};
+static struct ufsm_action t565effect = {
+  .id = "t565effect",
+  .name = "a565",
+  .f = &a565,
+  .next = NULL,
+};
+static struct ufsm_guard t565guard = {
+  .id = "t565guard",
+  .name = "g154",
+  .f = &g154,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t566_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t566 = {
+  .id = "t566",
+  .name = "",
+  .trigger = t566_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 611,
+  .action = &t566effect,
+  .defer = false,
+  .guard = &t566guard,
+  .source = &s308,
+  .dest = &s306,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t567,
+};
+static struct ufsm_action t566effect = {
+  .id = "t566effect",
+  .name = "a566",
+  .f = &a566,
+  .next = NULL,
+};
+static struct ufsm_guard t566guard = {
+  .id = "t566guard",
+  .name = "g155",
+  .f = &g155,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t567_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t567 = {
+  .id = "t567",
+  .name = "",
+  .trigger = t567_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 612,
+  .action = &t567effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s309,
+  .dest = &s309,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t568,
+};
+static struct ufsm_action t567effect = {
+  .id = "t567effect",
+  .name = "a567",
+  .f = &a567,
+  .next = NULL,
+};
+static struct ufsm_trigger t568_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t568 = {
+  .id = "t568",
+  .name = "",
+  .trigger = t568_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 613,
+  .action = &t568effect,
+  .defer = false,
+  .guard = &t568guard,
+  .source = &s309,
+  .dest = &s309,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t568effect = {
+  .id = "t568effect",
+  .name = "a568",
+  .f = &a568,
+  .next = NULL,
+};
+static struct ufsm_guard t568guard = {
+  .id = "t568guard",
+  .name = "g156",
+  .f = &g156,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s309_dispatch_5[] = {
+  &t567,
+  NULL,
+};
+static struct ufsm_transition * s309_dispatch_6[] = {
+  &t568,
+  NULL,
+};
+static struct ufsm_dispatch s309_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s309_dispatch_5,
+},
+{
+  .ev = 6,
+  .transition = s309_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s309_interest[] = {
+  0x00000061,
+};
+static struct ufsm_state s309 = {
+  .id   = "s309",
+  .name = "S309",
+  .kind = 0,
+  .index = 329,
+  .parent_region = &r61,
+  .entry = &s309entry,
+  .doact = NULL,
+  .exit = &s309exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s309_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s309_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s308,
+};
+static struct ufsm_entry_exit s309entry = {
+  .id = "s309entry",
+  .name = "e309",
+  .f = &e309,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s309exit = {
+  .id = "s309exit",
+  .name = "x309",
+  .f = &x309,
+  .next = NULL,
+};
+static struct ufsm_transition * s308_dispatch_6[] = {
+  &t566,
+  NULL,
+};
+static struct ufsm_transition * s308_dispatch_7[] = {
+  &t565,
+  NULL,
+};
+static struct ufsm_dispatch s308_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s308_dispatch_6,
+},
+{
+  .ev = 7,
+  .transition = s308_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s308_interest[] = {
+  0x000000e1,
+};
+static struct ufsm_state s308 = {
+  .id   = "s308",
+  .name = "S308",
+  .kind = 0,
+  .index = 330,
+  .parent_region = &r61,
+  .entry = &s308entry,
+  .doact = NULL,
+  .exit = &s308exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s308_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s308_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s307,
+};
+static struct ufsm_entry_exit s308entry = {
+  .id = "s308entry",
+  .name = "e308",
+  .f = &e308,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s308exit = {
+  .id = "s308exit",
+  .name = "x308",
+  .f = &x308,
+  .next = NULL,
+};
+static struct ufsm_transition * s307_dispatch_1[] = {
+  &t564,
+  NULL,
+};
+static struct ufsm_transition * s307_dispatch_3[] = {
+  &t563,
+  NULL,
+};
+static struct ufsm_dispatch s307_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s307_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s307_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s307_interest[] = {
+  0x0000002b,
+};
+static struct ufsm_state s307 = {
+  .id   = "s307",
+  .name = "S307",
+  .kind = 0,
+  .index = 331,
+  .parent_region = &r61,
+  .entry = &s307entry,
+  .doact = NULL,
+  .exit = &s307exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s307_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s307_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s306,
+};
+static struct ufsm_entry_exit s307entry = {
+  .id = "s307entry",
+  .name = "e307",
+  .f = &e307,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s307exit = {
+  .id = "s307exit",
+  .name = "x307",
+  .f = &x307,
+  .next = NULL,
+};
+static struct ufsm_transition * s306_dispatch_0[] = {
+  &t561,
+  NULL,
+};
+static struct ufsm_transition * s306_dispatch_3[] = {
+  &t562,
+  NULL,
+};
+static struct ufsm_dispatch s306_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s306_dispatch_0,
+},
+{
+  .ev = 3,
+  .transition = s306_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s306_interest[] = {
+  0x00000029,
+};
+static struct ufsm_state s306 = {
+  .id   = "s306",
+  .name = "S306",
+  .kind = 0,
+  .index = 332,
+  .parent_region = &r61,
+  .entry = &s306entry,
+  .doact = NULL,
+  .exit = &s306exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s306_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s306_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s305,
+};
+static struct ufsm_entry_exit s306entry = {
+  .id = "s306entry",
+  .name = "e306",
+  .f = &e306,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s306exit = {
+  .id = "s306exit",
+  .name = "x306",
+  .f = &x306,
+  .next = NULL,
+};
+static struct ufsm_dispatch s305_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s305_interest[] = {
+  0x00000021,
+};
+static struct ufsm_state s305 = {
+  .id   = "s305",
+  .name = "Init",
+  .kind = 1,
+  .index = 333,
+  .parent_region = &r61,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s305_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s305_interest,
+  .time_events = NULL,
+  .completion = &t61,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s38entry = {
+  .id = "s38entry",
+  .name = "e38",
+  .f = &e38,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s38exit = {
+  .id = "s38exit",
+  .name = "x38",
+  .f = &x38,
+  .next = NULL,
+};
+static struct ufsm_transition * s37_dispatch_2[] = {
+  &t131,
+  NULL,
+};
+static struct ufsm_transition * s37_dispatch_3[] = {
+  &t132,
+  NULL,
+};
+static struct ufsm_dispatch s37_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s37_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s37_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s37_interest[] = {
+  0x0000000d,
+};
+static struct ufsm_state s37 = {
+  .id   = "s37",
+  .name = "S37",
+  .kind = 0,
+  .index = 298,
+  .parent_region = &r7,
+  .entry = &s37entry,
+  .doact = NULL,
+  .exit = &s37exit,
+  .region = &r60,
+  .submachine = NULL,
+  .dispatch = s37_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s37_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s36,
+};
+static struct ufsm_region r60 = {
+  .id = "r60",
+  .name = "R60",
+  .state = &s304,
+  .has_history = false,
+  .history = NULL,
+  .index = 59,
+  .transition = &t60,
+  .parent_state = &s37,
+  .next = &r59,
+};
+static struct ufsm_transition t60 = {
+  .id = "t60",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 576,
+  .action = &t60effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s300,
+  .dest = &s303,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t553,
+};
+static struct ufsm_action t60effect = {
+  .id = "t60effect",
+  .name = "a60",
+  .f = &a60,
+  .next = NULL,
+};
+static struct ufsm_trigger t553_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t553 = {
+  .id = "t553",
+  .name = "",
+  .trigger = t553_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 577,
+  .action = &t553effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s301,
+  .dest = &s301,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t554,
+};
+static struct ufsm_action t553effect = {
+  .id = "t553effect",
+  .name = "a553",
+  .f = &a553,
+  .next = NULL,
+};
+static struct ufsm_trigger t554_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t554 = {
+  .id = "t554",
+  .name = "",
+  .trigger = t554_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 578,
+  .action = &t554effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s301,
+  .dest = &s301,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t555,
+};
+static struct ufsm_action t554effect = {
+  .id = "t554effect",
+  .name = "a554",
+  .f = &a554,
+  .next = NULL,
+};
+static struct ufsm_trigger t555_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t555 = {
+  .id = "t555",
+  .name = "",
+  .trigger = t555_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 579,
+  .action = &t555effect,
+  .defer = false,
+  .guard = &t555guard,
+  .source = &s302,
+  .dest = &s301,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t556,
+};
+static struct ufsm_action t555effect = {
+  .id = "t555effect",
+  .name = "a555",
+  .f = &a555,
+  .next = NULL,
+};
+static struct ufsm_guard t555guard = {
+  .id = "t555guard",
+  .name = "g152",
+  .f = &g152,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t556_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t556 = {
+  .id = "t556",
+  .name = "",
+  .trigger = t556_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 580,
+  .action = &t556effect,
+  .defer = false,
+  .guard = &t556guard,
+  .source = &s302,
+  .dest = &s302,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t557,
+};
+static struct ufsm_action t556effect = {
+  .id = "t556effect",
+  .name = "a556",
+  .f = &a556,
+  .next = NULL,
+};
+static struct ufsm_guard t556guard = {
+  .id = "t556guard",
+  .name = "g153",
+  .f = &g153,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t557_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t557 = {
+  .id = "t557",
+  .name = "",
+  .trigger = t557_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 581,
+  .action = &t557effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s303,
+  .dest = &s303,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t558,
+};
+static struct ufsm_action t557effect = {
+  .id = "t557effect",
+  .name = "a557",
+  .f = &a557,
+  .next = NULL,
+};
+static struct ufsm_trigger t558_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t558_exit_path[] = {
+  &r60,
+  NULL,
+};
+static struct ufsm_region * t558_enter_path[] = {
+  &r57,
+  NULL,
+};
+static struct ufsm_transition t558 = {
+  .id = "t558",
+  .name = "",
+  .trigger = t558_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 582,
+  .action = &t558effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s303,
+  .dest = &s286,
+  .lca = &r7,
+  .exit_path = t558_exit_path,
+  .enter_path = t558_enter_path,
+  .next = &t559,
+};
+static struct ufsm_action t558effect = {
+  .id = "t558effect",
+  .name = "a558",
+  .f = &a558,
+  .next = NULL,
+};
+static struct ufsm_trigger t559_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t559_exit_path[] = {
+  &r60,
+  NULL,
+};
+static struct ufsm_region * t559_enter_path[] = {
+  &r7,
+  NULL,
+};
+static struct ufsm_transition t559 = {
+  .id = "t559",
+  .name = "",
+  .trigger = t559_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 583,
+  .action = &t559effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s304,
+  .dest = &s36,
+  .lca = &r7,
+  .exit_path = t559_exit_path,
+  .enter_path = t559_enter_path,
+  .next = &t560,
+};
+static struct ufsm_action t559effect = {
+  .id = "t559effect",
+  .name = "a559",
+  .f = &a559,
+  .next = NULL,
+};
+static struct ufsm_trigger t560_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t560 = {
+  .id = "t560",
+  .name = "",
+  .trigger = t560_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 584,
+  .action = &t560effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s304,
+  .dest = &s301,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t560effect = {
+  .id = "t560effect",
+  .name = "a560",
+  .f = &a560,
+  .next = NULL,
+};
+static struct ufsm_transition * s304_dispatch_4[] = {
+  &t559,
+  NULL,
+};
+static struct ufsm_transition * s304_dispatch_5[] = {
+  &t560,
+  NULL,
+};
+static struct ufsm_dispatch s304_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s304_dispatch_4,
+},
+{
+  .ev = 5,
+  .transition = s304_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s304_interest[] = {
+  0x0000003d,
+};
+static struct ufsm_state s304 = {
+  .id   = "s304",
+  .name = "S304",
+  .kind = 0,
+  .index = 313,
+  .parent_region = &r60,
+  .entry = &s304entry,
+  .doact = NULL,
+  .exit = &s304exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s304_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s304_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s303,
+};
+static struct ufsm_entry_exit s304entry = {
+  .id = "s304entry",
+  .name = "e304",
+  .f = &e304,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s304exit = {
+  .id = "s304exit",
+  .name = "x304",
+  .f = &x304,
+  .next = NULL,
+};
+static struct ufsm_transition * s303_dispatch_0[] = {
+  &t557,
+  NULL,
+};
+static struct ufsm_transition * s303_dispatch_4[] = {
+  &t558,
+  NULL,
+};
+static struct ufsm_dispatch s303_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s303_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s303_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s303_interest[] = {
+  0x0000001d,
+};
+static struct ufsm_state s303 = {
+  .id   = "s303",
+  .name = "S303",
+  .kind = 0,
+  .index = 314,
+  .parent_region = &r60,
+  .entry = &s303entry,
+  .doact = NULL,
+  .exit = &s303exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s303_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s303_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s302,
+};
+static struct ufsm_entry_exit s303entry = {
+  .id = "s303entry",
+  .name = "e303",
+  .f = &e303,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s303exit = {
+  .id = "s303exit",
+  .name = "x303",
+  .f = &x303,
+  .next = NULL,
+};
+static struct ufsm_transition * s302_dispatch_1[] = {
+  &t556,
+  NULL,
+};
+static struct ufsm_transition * s302_dispatch_7[] = {
+  &t555,
+  NULL,
+};
+static struct ufsm_dispatch s302_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s302_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s302_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s302_interest[] = {
+  0x0000008f,
+};
+static struct ufsm_state s302 = {
+  .id   = "s302",
+  .name = "S302",
+  .kind = 0,
+  .index = 315,
+  .parent_region = &r60,
+  .entry = &s302entry,
+  .doact = NULL,
+  .exit = &s302exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s302_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s302_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s301,
+};
+static struct ufsm_entry_exit s302entry = {
+  .id = "s302entry",
+  .name = "e302",
+  .f = &e302,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s302exit = {
+  .id = "s302exit",
+  .name = "x302",
+  .f = &x302,
+  .next = NULL,
+};
+static struct ufsm_transition * s301_dispatch_3[] = {
+  &t553,
+  NULL,
+};
+static struct ufsm_transition * s301_dispatch_4[] = {
+  &t554,
+  NULL,
+};
+static struct ufsm_dispatch s301_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s301_dispatch_3,
+},
+{
+  .ev = 4,
+  .transition = s301_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s301_interest[] = {
+  0x0000001d,
+};
+static struct ufsm_state s301 = {
+  .id   = "s301",
+  .name = "S301",
+  .kind = 0,
+  .index = 316,
+  .parent_region = &r60,
+  .entry = &s301entry,
+  .doact = NULL,
+  .exit = &s301exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s301_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s301_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s300,
+};
+static struct ufsm_entry_exit s301entry = {
+  .id = "s301entry",
+  .name = "e301",
+  .f = &e301,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s301exit = {
+  .id = "s301exit",
+  .name = "x301",
+  .f = &x301,
+  .next = NULL,
+};
+static struct ufsm_dispatch s300_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s300_interest[] = {
+  0x0000000d,
+};
+static struct ufsm_state s300 = {
+  .id   = "s300",
+  .name = "Init",
+  .kind = 1,
+  .index = 317,
+  .parent_region = &r60,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s300_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s300_interest,
+  .time_events = NULL,
+  .completion = &t60,
+  .next = NULL,
+};
+static struct ufsm_region r59 = {
+  .id = "r59",
+  .name = "R59",
+  .state = &s299,
+  .has_history = false,
+  .history = NULL,
+  .index = 60,
+  .transition = &t59,
+  .parent_state = &s37,
+  .next = NULL,
+};
+static struct ufsm_transition t59 = {
+  .id = "t59",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 585,
+  .action = &t59effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s295,
+  .dest = &s297,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t545,
+};
+static struct ufsm_action t59effect = {
+  .id = "t59effect",
+  .name = "a59",
+  .f = &a59,
+  .next = NULL,
+};
+static struct ufsm_trigger t545_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t545 = {
+  .id = "t545",
+  .name = "",
+  .trigger = t545_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 586,
+  .action = &t545effect,
+  .defer = false,
+  .guard = &t545guard,
+  .source = &s296,
+  .dest = &s299,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t546,
+};
+static struct ufsm_action t545effect = {
+  .id = "t545effect",
+  .name = "a545",
+  .f = &a545,
+  .next = NULL,
+};
+static struct ufsm_guard t545guard = {
+  .id = "t545guard",
+  .name = "g148",
+  .f = &g148,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t546_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t546_exit_path[] = {
+  &r59,
+  NULL,
+};
+static struct ufsm_region * t546_enter_path[] = {
+  &r58,
+  NULL,
+};
+static struct ufsm_transition t546 = {
+  .id = "t546",
+  .name = "",
+  .trigger = t546_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 587,
+  .action = &t546effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s296,
+  .dest = &s291,
+  .lca = &r7,
+  .exit_path = t546_exit_path,
+  .enter_path = t546_enter_path,
+  .next = &t547,
+};
+static struct ufsm_action t546effect = {
+  .id = "t546effect",
+  .name = "a546",
+  .f = &a546,
+  .next = NULL,
+};
+static struct ufsm_trigger t547_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t547_exit_path[] = {
+  &r59,
+  &r7,
+  NULL,
+};
+static struct ufsm_region * t547_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t547 = {
+  .id = "t547",
+  .name = "",
+  .trigger = t547_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 588,
+  .action = &t547effect,
+  .defer = false,
+  .guard = &t547guard,
+  .source = &s297,
+  .dest = &s4,
+  .lca = &r0,
+  .exit_path = t547_exit_path,
+  .enter_path = t547_enter_path,
+  .next = &t548,
+};
+static struct ufsm_action t547effect = {
+  .id = "t547effect",
+  .name = "a547",
+  .f = &a547,
+  .next = NULL,
+};
+static struct ufsm_guard t547guard = {
+  .id = "t547guard",
+  .name = "g149",
+  .f = &g149,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t548_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t548 = {
+  .id = "t548",
+  .name = "",
+  .trigger = t548_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 589,
+  .action = &t548effect,
+  .defer = false,
+  .guard = &t548guard,
+  .source = &s297,
+  .dest = &s298,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t549,
+};
+static struct ufsm_action t548effect = {
+  .id = "t548effect",
+  .name = "a548",
+  .f = &a548,
+  .next = NULL,
+};
+static struct ufsm_guard t548guard = {
+  .id = "t548guard",
+  .name = "g150",
+  .f = &g150,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t549_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t549 = {
+  .id = "t549",
+  .name = "",
+  .trigger = t549_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 590,
+  .action = &t549effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s298,
+  .dest = &s296,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t550,
+};
+static struct ufsm_action t549effect = {
+  .id = "t549effect",
+  .name = "a549",
+  .f = &a549,
+  .next = NULL,
+};
+static struct ufsm_trigger t550_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t550 = {
+  .id = "t550",
+  .name = "",
+  .trigger = t550_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 591,
+  .action = &t550effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s298,
+  .dest = &s299,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t551,
+};
+static struct ufsm_action t550effect = {
+  .id = "t550effect",
+  .name = "a550",
+  .f = &a550,
+  .next = NULL,
+};
+static struct ufsm_trigger t551_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t551 = {
+  .id = "t551",
+  .name = "",
+  .trigger = t551_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 592,
+  .action = &t551effect,
+  .defer = false,
+  .guard = &t551guard,
+  .source = &s299,
+  .dest = &s296,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t552,
+};
+static struct ufsm_action t551effect = {
+  .id = "t551effect",
+  .name = "a551",
+  .f = &a551,
+  .next = NULL,
+};
+static struct ufsm_guard t551guard = {
+  .id = "t551guard",
+  .name = "g151",
+  .f = &g151,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t552_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t552 = {
+  .id = "t552",
+  .name = "",
+  .trigger = t552_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 593,
+  .action = &t552effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s299,
+  .dest = &s296,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t673,
+};
+static struct ufsm_action t552effect = {
+  .id = "t552effect",
+  .name = "a552",
+  .f = &a552,
+  .next = NULL,
+};
+static struct ufsm_trigger t673_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t673 = {
+  .id = "t673",
+  .name = "",
+  .trigger = t673_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 594,
+  .action = &t673effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s296,
+  .dest = &s371,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t674,
+};
+static struct ufsm_action t673effect = {
+  .id = "t673effect",
+  .name = "a673",
+  .f = &a673,
+  .next = NULL,
+};
+static struct ufsm_transition t674 = {
+  .id = "t674",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 595,
+  .action = &t674effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s371,
+  .dest = &s296,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t674effect = {
+  .id = "t674effect",
+  .name = "a674",
+  .f = &a674,
+  .next = NULL,
+};
+static struct ufsm_transition * s299_dispatch_6[] = {
+  &t551,
+  &t552,
+  NULL,
+};
+static struct ufsm_dispatch s299_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s299_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s299_interest[] = {
+  0x0000004d,
+};
+static struct ufsm_state s299 = {
+  .id   = "s299",
+  .name = "S299",
+  .kind = 0,
+  .index = 318,
+  .parent_region = &r59,
+  .entry = &s299entry,
+  .doact = NULL,
+  .exit = &s299exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s299_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s299_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s298,
+};
+static struct ufsm_entry_exit s299entry = {
+  .id = "s299entry",
+  .name = "e299",
+  .f = &e299,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s299exit = {
+  .id = "s299exit",
+  .name = "x299",
+  .f = &x299,
+  .next = NULL,
+};
+static struct ufsm_transition * s298_dispatch_2[] = {
+  &t550,
+  NULL,
+};
+static struct ufsm_transition * s298_dispatch_7[] = {
+  &t549,
+  NULL,
+};
+static struct ufsm_dispatch s298_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s298_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s298_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s298_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s298 = {
+  .id   = "s298",
+  .name = "S298",
+  .kind = 0,
+  .index = 319,
+  .parent_region = &r59,
+  .entry = &s298entry,
+  .doact = NULL,
+  .exit = &s298exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s298_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s298_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s297,
+};
+static struct ufsm_entry_exit s298entry = {
+  .id = "s298entry",
+  .name = "e298",
+  .f = &e298,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s298exit = {
+  .id = "s298exit",
+  .name = "x298",
+  .f = &x298,
+  .next = NULL,
+};
+static struct ufsm_transition * s297_dispatch_4[] = {
+  &t547,
+  NULL,
+};
+static struct ufsm_transition * s297_dispatch_6[] = {
+  &t548,
+  NULL,
+};
+static struct ufsm_dispatch s297_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s297_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s297_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s297_interest[] = {
+  0x0000005d,
+};
+static struct ufsm_state s297 = {
+  .id   = "s297",
+  .name = "S297",
+  .kind = 0,
+  .index = 320,
+  .parent_region = &r59,
+  .entry = &s297entry,
+  .doact = NULL,
+  .exit = &s297exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s297_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s297_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s296,
+};
+static struct ufsm_entry_exit s297entry = {
+  .id = "s297entry",
+  .name = "e297",
+  .f = &e297,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s297exit = {
+  .id = "s297exit",
+  .name = "x297",
+  .f = &x297,
+  .next = NULL,
+};
+static struct ufsm_transition * s296_dispatch_3[] = {
+  &t545,
+  NULL,
+};
+static struct ufsm_transition * s296_dispatch_4[] = {
+  &t546,
+  NULL,
+};
+static struct ufsm_transition * s296_dispatch_7[] = {
+  &t673,
+  NULL,
+};
+static struct ufsm_dispatch s296_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s296_dispatch_3,
+},
+{
+  .ev = 4,
+  .transition = s296_dispatch_4,
+},
+{
+  .ev = 7,
+  .transition = s296_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s296_interest[] = {
+  0x0000009d,
+};
+static struct ufsm_state s296 = {
+  .id   = "s296",
+  .name = "S296",
+  .kind = 0,
+  .index = 321,
+  .parent_region = &r59,
+  .entry = &s296entry,
+  .doact = NULL,
+  .exit = &s296exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s296_dispatch,
+  .no_of_dispatch = 3,
+  .flat_dispatch = NULL,
+  .interest = s296_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s371,
+};
+static struct ufsm_entry_exit s296entry = {
+  .id = "s296entry",
+  .name = "e296",
+  .f = &e296,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s296exit = {
+  .id = "s296exit",
+  .name = "x296",
+  .f = &x296,
+  .next = NULL,
+};
+static struct ufsm_dispatch s371_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s371_interest[] = {
+  0x0000000d,
+};
+static struct ufsm_state s371 = {
+  .id   = "s371",
+  .name = "(null)",
+  .kind = 10,
+  .index = 322,
+  .parent_region = &r59,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s371_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s371_interest,
+  .time_events = NULL,
+  .completion = &t674,
+  .next = &s295,
+};
+static struct ufsm_dispatch s295_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s295_interest[] = {
+  0x0000000d,
+};
+static struct ufsm_state s295 = {
+  .id   = "s295",
+  .name = "Init",
+  .kind = 1,
+  .index = 323,
+  .parent_region = &r59,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s295_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s295_interest,
+  .time_events = NULL,
+  .completion = &t59,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s37entry = {
+  .id = "s37entry",
+  .name = "e37",
+  .f = &e37,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s37exit = {
+  .id = "s37exit",
+  .name = "x37",
+  .f = &x37,
+  .next = NULL,
+};
+static struct ufsm_transition * s36_dispatch_3[] = {
+  &t129,
+  NULL,
+};
+static struct ufsm_transition * s36_dispatch_6[] = {
+  &t130,
+  &t677,
+  NULL,
+};
+static struct ufsm_dispatch s36_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s36_dispatch_3,
+},
+{
+  .ev = 6,
+  .transition = s36_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s36_interest[] = {
+  0x00000049,
+};
+static struct ufsm_state s36 = {
+  .id   = "s36",
+  .name = "S36",
+  .kind = 0,
+  .index = 299,
+  .parent_region = &r7,
+  .entry = &s36entry,
+  .doact = NULL,
+  .exit = &s36exit,
+  .region = &r58,
+  .submachine = NULL,
+  .dispatch = s36_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s36_interest,
+  .time_events = NULL,
+  .completion = &t686,
+  .next = &s374,
+};
+static struct ufsm_region r58 = {
+  .id = "r58",
+  .name = "R58",
+  .state = &s294,
+  .has_history = false,
+  .history = NULL,
+  .index = 57,
+  .transition = &t58,
+  .parent_state = &s36,
+  .next = &r57,
+};
+static struct ufsm_transition t58 = {
+  .id = "t58",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 558,
+  .action = &t58effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s290,
+  .dest = &s291,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t537,
+};
+static struct ufsm_action t58effect = {
+  .id = "t58effect",
+  .name = "a58",
+  .f = &a58,
+  .next = NULL,
+};
+static struct ufsm_trigger t537_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t537_exit_path[] = {
+  &r58,
+  &r7,
+  NULL,
+};
+static struct ufsm_region * t537_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t537 = {
+  .id = "t537",
+  .name = "",
+  .trigger = t537_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 559,
+  .action = &t537effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s291,
+  .dest = &s3,
+  .lca = &r0,
+  .exit_path = t537_exit_path,
+  .enter_path = t537_enter_path,
+  .next = &t538,
+};
+static struct ufsm_action t537effect = {
+  .id = "t537effect",
+  .name = "a537",
+  .f = &a537,
+  .next = NULL,
+};
+static struct ufsm_trigger t538_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t538 = {
+  .id = "t538",
+  .name = "",
+  .trigger = t538_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 560,
+  .action = &t538effect,
+  .defer = false,
+  .guard = &t538guard,
+  .source = &s291,
+  .dest = &s294,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t539,
+};
+static struct ufsm_action t538effect = {
+  .id = "t538effect",
+  .name = "a538",
+  .f = &a538,
+  .next = NULL,
+};
+static struct ufsm_guard t538guard = {
+  .id = "t538guard",
+  .name = "g146",
+  .f = &g146,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t539_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t539_exit_path[] = {
+  &r58,
+  &r7,
+  NULL,
+};
+static struct ufsm_region * t539_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t539 = {
+  .id = "t539",
+  .name = "",
+  .trigger = t539_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 561,
+  .action = &t539effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s292,
+  .dest = &s17,
+  .lca = &r0,
+  .exit_path = t539_exit_path,
+  .enter_path = t539_enter_path,
+  .next = &t540,
+};
+static struct ufsm_action t539effect = {
+  .id = "t539effect",
+  .name = "a539",
+  .f = &a539,
+  .next = NULL,
+};
+static struct ufsm_trigger t540_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t540_exit_path[] = {
+  &r58,
+  NULL,
+};
+static struct ufsm_region * t540_enter_path[] = {
+  &r7,
+  NULL,
+};
+static struct ufsm_transition t540 = {
+  .id = "t540",
+  .name = "",
+  .trigger = t540_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 562,
+  .action = &t540effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s292,
+  .dest = &s36,
+  .lca = &r7,
+  .exit_path = t540_exit_path,
+  .enter_path = t540_enter_path,
+  .next = &t541,
+};
+static struct ufsm_action t540effect = {
+  .id = "t540effect",
+  .name = "a540",
+  .f = &a540,
+  .next = NULL,
+};
+static struct ufsm_trigger t541_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t541 = {
+  .id = "t541",
+  .name = "",
+  .trigger = t541_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 563,
+  .action = &t541effect,
+  .defer = false,
+  .guard = &t541guard,
+  .source = &s293,
+  .dest = &s291,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t542,
+};
+static struct ufsm_action t541effect = {
+  .id = "t541effect",
+  .name = "a541",
+  .f = &a541,
+  .next = NULL,
+};
+static struct ufsm_guard t541guard = {
+  .id = "t541guard",
+  .name = "g147",
+  .f = &g147,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t542_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t542 = {
+  .id = "t542",
+  .name = "",
+  .trigger = t542_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 564,
+  .action = &t542effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s293,
+  .dest = &s294,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t543,
+};
+static struct ufsm_action t542effect = {
+  .id = "t542effect",
+  .name = "a542",
+  .f = &a542,
+  .next = NULL,
+};
+static struct ufsm_trigger t543_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t543 = {
+  .id = "t543",
+  .name = "",
+  .trigger = t543_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 565,
+  .action = &t543effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s294,
+  .dest = &s292,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t544,
+};
+static struct ufsm_action t543effect = {
+  .id = "t543effect",
+  .name = "a543",
+  .f = &a543,
+  .next = NULL,
+};
+static struct ufsm_trigger t544_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t544 = {
+  .id = "t544",
+  .name = "",
+  .trigger = t544_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 566,
+  .action = &t544effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s294,
+  .dest = &s292,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t544effect = {
+  .id = "t544effect",
+  .name = "a544",
+  .f = &a544,
+  .next = NULL,
+};
+static struct ufsm_transition * s294_dispatch_0[] = {
+  &t544,
+  NULL,
+};
+static struct ufsm_transition * s294_dispatch_4[] = {
+  &t543,
+  NULL,
+};
+static struct ufsm_dispatch s294_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s294_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s294_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s294_interest[] = {
+  0x00000059,
+};
+static struct ufsm_state s294 = {
+  .id   = "s294",
+  .name = "S294",
+  .kind = 0,
+  .index = 303,
+  .parent_region = &r58,
+  .entry = &s294entry,
+  .doact = NULL,
+  .exit = &s294exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s294_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s294_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s293,
+};
+static struct ufsm_entry_exit s294entry = {
+  .id = "s294entry",
+  .name = "e294",
+  .f = &e294,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s294exit = {
+  .id = "s294exit",
+  .name = "x294",
+  .f = &x294,
+  .next = NULL,
+};
+static struct ufsm_transition * s293_dispatch_6[] = {
+  &t542,
+  NULL,
+};
+static struct ufsm_transition * s293_dispatch_7[] = {
+  &t541,
+  NULL,
+};
+static struct ufsm_dispatch s293_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s293_dispatch_6,
+},
+{
+  .ev = 7,
+  .transition = s293_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s293_interest[] = {
+  0x000000c9,
+};
+static struct ufsm_state s293 = {
+  .id   = "s293",
+  .name = "S293",
+  .kind = 0,
+  .index = 304,
+  .parent_region = &r58,
+  .entry = &s293entry,
+  .doact = NULL,
+  .exit = &s293exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s293_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s293_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s292,
+};
+static struct ufsm_entry_exit s293entry = {
+  .id = "s293entry",
+  .name = "e293",
+  .f = &e293,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s293exit = {
+  .id = "s293exit",
+  .name = "x293",
+  .f = &x293,
+  .next = NULL,
+};
+static struct ufsm_transition * s292_dispatch_1[] = {
+  &t540,
+  NULL,
+};
+static struct ufsm_transition * s292_dispatch_2[] = {
+  &t539,
+  NULL,
+};
+static struct ufsm_dispatch s292_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s292_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = s292_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s292_interest[] = {
+  0x0000004f,
+};
+static struct ufsm_state s292 = {
+  .id   = "s292",
+  .name = "S292",
+  .kind = 0,
+  .index = 305,
+  .parent_region = &r58,
+  .entry = &s292entry,
+  .doact = NULL,
+  .exit = &s292exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s292_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s292_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s291,
+};
+static struct ufsm_entry_exit s292entry = {
+  .id = "s292entry",
+  .name = "e292",
+  .f = &e292,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s292exit = {
+  .id = "s292exit",
+  .name = "x292",
+  .f = &x292,
+  .next = NULL,
+};
+static struct ufsm_transition * s291_dispatch_4[] = {
+  &t537,
+  NULL,
+};
+static struct ufsm_transition * s291_dispatch_7[] = {
+  &t538,
+  NULL,
+};
+static struct ufsm_dispatch s291_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s291_dispatch_4,
+},
+{
+  .ev = 7,
+  .transition = s291_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s291_interest[] = {
+  0x000000d9,
+};
+static struct ufsm_state s291 = {
+  .id   = "s291",
+  .name = "S291",
+  .kind = 0,
+  .index = 306,
+  .parent_region = &r58,
+  .entry = &s291entry,
+  .doact = NULL,
+  .exit = &s291exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s291_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s291_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s290,
+};
+static struct ufsm_entry_exit s291entry = {
+  .id = "s291entry",
+  .name = "e291",
+  .f = &e291,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s291exit = {
+  .id = "s291exit",
+  .name = "x291",
+  .f = &x291,
+  .next = NULL,
+};
+static struct ufsm_dispatch s290_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s290_interest[] = {
+  0x00000049,
+};
+static struct ufsm_state s290 = {
+  .id   = "s290",
+  .name = "Init",
+  .kind = 1,
+  .index = 307,
+  .parent_region = &r58,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s290_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s290_interest,
+  .time_events = NULL,
+  .completion = &t58,
+  .next = NULL,
+};
+static struct ufsm_region r57 = {
+  .id = "r57",
+  .name = "R57",
+  .state = &s289,
+  .has_history = false,
+  .history = NULL,
+  .index = 58,
+  .transition = &t57,
+  .parent_state = &s36,
+  .next = NULL,
+};
+static struct ufsm_transition t57 = {
+  .id = "t57",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 567,
+  .action = &t57effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s285,
+  .dest = &s287,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t529,
+};
+static struct ufsm_action t57effect = {
+  .id = "t57effect",
+  .name = "a57",
+  .f = &a57,
+  .next = NULL,
+};
+static struct ufsm_trigger t529_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t529 = {
+  .id = "t529",
+  .name = "",
+  .trigger = t529_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 568,
+  .action = &t529effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s286,
+  .dest = &s286,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t530,
+};
+static struct ufsm_action t529effect = {
+  .id = "t529effect",
+  .name = "a529",
+  .f = &a529,
+  .next = NULL,
+};
+static struct ufsm_trigger t530_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t530_exit_path[] = {
+  &r57,
+  NULL,
+};
+static struct ufsm_region * t530_enter_path[] = {
+  &r7,
+  NULL,
+};
+static struct ufsm_transition t530 = {
+  .id = "t530",
+  .name = "",
+  .trigger = t530_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 569,
+  .action = &t530effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s286,
+  .dest = &s39,
+  .lca = &r7,
+  .exit_path = t530_exit_path,
+  .enter_path = t530_enter_path,
+  .next = &t531,
+};
+static struct ufsm_action t530effect = {
+  .id = "t530effect",
+  .name = "a530",
+  .f = &a530,
+  .next = NULL,
+};
+static struct ufsm_trigger t531_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t531 = {
+  .id = "t531",
+  .name = "",
+  .trigger = t531_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 570,
+  .action = &t531effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s287,
+  .dest = &s288,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t532,
+};
+static struct ufsm_action t531effect = {
+  .id = "t531effect",
+  .name = "a531",
+  .f = &a531,
+  .next = NULL,
+};
+static struct ufsm_trigger t532_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t532 = {
+  .id = "t532",
+  .name = "",
+  .trigger = t532_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 571,
+  .action = &t532effect,
+  .defer = false,
+  .guard = &t532guard,
+  .source = &s287,
+  .dest = &s286,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t533,
+};
+static struct ufsm_action t532effect = {
+  .id = "t532effect",
+  .name = "a532",
+  .f = &a532,
+  .next = NULL,
+};
+static struct ufsm_guard t532guard = {
+  .id = "t532guard",
+  .name = "g144",
+  .f = &g144,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t533_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t533 = {
+  .id = "t533",
+  .name = "",
+  .trigger = t533_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 572,
+  .action = &t533effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s288,
+  .dest = &s286,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t534,
+};
+static struct ufsm_action t533effect = {
+  .id = "t533effect",
+  .name = "a533",
+  .f = &a533,
+  .next = NULL,
+};
+static struct ufsm_trigger t534_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t534 = {
+  .id = "t534",
+  .name = "",
+  .trigger = t534_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 573,
+  .action = &t534effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s288,
+  .dest = &s287,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t535,
+};
+static struct ufsm_action t534effect = {
+  .id = "t534effect",
+  .name = "a534",
+  .f = &a534,
+  .next = NULL,
+};
+static struct ufsm_trigger t535_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t535 = {
+  .id = "t535",
+  .name = "",
+  .trigger = t535_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 574,
+  .action = &t535effect,
+  .defer = false,
+  .guard = &t535guard,
+  .source = &s289,
+  .dest = &s287,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t536,
+};
+static struct ufsm_action t535effect = {
+  .id = "t535effect",
+  .name = "a535",
+  .f = &a535,
+  .next = NULL,
+};
+static struct ufsm_guard t535guard = {
+  .id = "t535guard",
+  .name = "g145",
+  .f = &g145,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t536_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t536_exit_path[] = {
+  &r57,
+  NULL,
+};
+static struct ufsm_region * t536_enter_path[] = {
+  &r7,
+  NULL,
+};
+static struct ufsm_transition t536 = {
+  .id = "t536",
+  .name = "",
+  .trigger = t536_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 575,
+  .action = &t536effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s289,
+  .dest = &s36,
+  .lca = &r7,
+  .exit_path = t536_exit_path,
+  .enter_path = t536_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t536effect = {
+  .id = "t536effect",
+  .name = "a536",
+  .f = &a536,
+  .next = NULL,
+};
+static struct ufsm_transition * s289_dispatch_5[] = {
+  &t536,
+  NULL,
+};
+static struct ufsm_transition * s289_dispatch_7[] = {
+  &t535,
+  NULL,
+};
+static struct ufsm_dispatch s289_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s289_dispatch_5,
+},
+{
+  .ev = 7,
+  .transition = s289_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s289_interest[] = {
+  0x000000e9,
+};
+static struct ufsm_state s289 = {
+  .id   = "s289",
+  .name = "S289",
+  .kind = 0,
+  .index = 308,
+  .parent_region = &r57,
+  .entry = &s289entry,
+  .doact = NULL,
+  .exit = &s289exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s289_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s289_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s288,
+};
+static struct ufsm_entry_exit s289entry = {
+  .id = "s289entry",
+  .name = "e289",
+  .f = &e289,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s289exit = {
+  .id = "s289exit",
+  .name = "x289",
+  .f = &x289,
+  .next = NULL,
+};
+static struct ufsm_transition * s288_dispatch_1[] = {
+  &t533,
+  NULL,
+};
+static struct ufsm_transition * s288_dispatch_7[] = {
+  &t534,
+  NULL,
+};
+static struct ufsm_dispatch s288_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s288_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s288_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s288_interest[] = {
+  0x000000cb,
+};
+static struct ufsm_state s288 = {
+  .id   = "s288",
+  .name = "S288",
+  .kind = 0,
+  .index = 309,
+  .parent_region = &r57,
+  .entry = &s288entry,
+  .doact = NULL,
+  .exit = &s288exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s288_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s288_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s287,
+};
+static struct ufsm_entry_exit s288entry = {
+  .id = "s288entry",
+  .name = "e288",
+  .f = &e288,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s288exit = {
+  .id = "s288exit",
+  .name = "x288",
+  .f = &x288,
+  .next = NULL,
+};
+static struct ufsm_transition * s287_dispatch_5[] = {
+  &t531,
+  &t532,
+  NULL,
+};
+static struct ufsm_dispatch s287_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s287_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s287_interest[] = {
+  0x00000069,
+};
+static struct ufsm_state s287 = {
+  .id   = "s287",
+  .name = "S287",
+  .kind = 0,
+  .index = 310,
+  .parent_region = &r57,
+  .entry = &s287entry,
+  .doact = NULL,
+  .exit = &s287exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s287_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s287_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s286,
+};
+static struct ufsm_entry_exit s287entry = {
+  .id = "s287entry",
+  .name = "e287",
+  .f = &e287,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s287exit = {
+  .id = "s287exit",
+  .name = "x287",
+  .f = &x287,
+  .next = NULL,
+};
+static struct ufsm_transition * s286_dispatch_5[] = {
+  &t529,
+  &t530,
+  NULL,
+};
+static struct ufsm_dispatch s286_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s286_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s286_interest[] = {
+  0x00000069,
+};
+static struct ufsm_state s286 = {
+  .id   = "s286",
+  .name = "S286",
+  .kind = 0,
+  .index = 311,
+  .parent_region = &r57,
+  .entry = &s286entry,
+  .doact = NULL,
+  .exit = &s286exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s286_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s286_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s285,
+};
+static struct ufsm_entry_exit s286entry = {
+  .id = "s286entry",
+  .name = "e286",
+  .f = &e286,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s286exit = {
+  .id = "s286exit",
+  .name = "x286",
+  .f = &x286,
+  .next = NULL,
+};
+static struct ufsm_dispatch s285_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s285_interest[] = {
+  0x00000049,
+};
+static struct ufsm_state s285 = {
+  .id   = "s285",
+  .name = "Init",
+  .kind = 1,
+  .index = 312,
+  .parent_region = &r57,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s285_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s285_interest,
+  .time_events = NULL,
+  .completion = &t57,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s36entry = {
+  .id = "s36entry",
+  .name = "e36",
+  .f = &e36,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s36exit = {
+  .id = "s36exit",
+  .name = "x36",
+  .f = &x36,
+  .next = NULL,
+};
+static struct ufsm_dispatch s374_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s374_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state s374 = {
+  .id   = "s374",
+  .name = "(null)",
+  .kind = 7,
+  .index = 300,
+  .parent_region = &r7,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s374_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s374_interest,
+  .time_events = NULL,
+  .completion = &t682,
+  .next = &s373,
+};
+static struct ufsm_dispatch s373_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s373_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state s373 = {
+  .id   = "s373",
+  .name = "(null)",
+  .kind = 8,
+  .index = 301,
+  .parent_region = &r7,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s373_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s373_interest,
+  .time_events = NULL,
+  .completion = &t678,
+  .next = &s35,
+};
+static struct ufsm_dispatch s35_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s35_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state s35 = {
+  .id   = "s35",
+  .name = "Init",
+  .kind = 1,
+  .index = 302,
+  .parent_region = &r7,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s35_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s35_interest,
+  .time_events = NULL,
+  .completion = &t7,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s4entry = {
+  .id = "s4entry",
+  .name = "e4",
+  .f = &e4,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s4exit = {
+  .id = "s4exit",
+  .name = "x4",
+  .f = &x4,
+  .next = NULL,
+};
+static struct ufsm_transition * s3_dispatch_1[] = {
+  &t77,
+  NULL,
+};
+static struct ufsm_transition * s3_dispatch_2[] = {
+  &t78,
+  NULL,
+};
+static struct ufsm_dispatch s3_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s3_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = s3_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s3_interest[] = {
+  0x00000006,
+};
+static struct ufsm_state s3 = {
+  .id   = "s3",
+  .name = "S3",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &r0,
+  .entry = &s3entry,
+  .doact = NULL,
+  .exit = &s3exit,
+  .region = &r6,
+  .submachine = NULL,
+  .dispatch = s3_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s3_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s2,
+};
+static struct ufsm_region r6 = {
+  .id = "r6",
+  .name = "R6",
+  .state = &s34,
+  .has_history = false,
+  .history = NULL,
+  .index = 37,
+  .transition = &t6,
+  .parent_state = &s3,
+  .next = &r5,
+};
+static struct ufsm_transition t6 = {
+  .id = "t6",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 369,
+  .action = &t6effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s30,
+  .dest = &s32,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t121,
+};
+static struct ufsm_action t6effect = {
+  .id = "t6effect",
+  .name = "a6",
+  .f = &a6,
+  .next = NULL,
+};
+static struct ufsm_trigger t121_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t121_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t121_enter_path[] = {
+  &r50,
+  NULL,
+};
+static struct ufsm_transition t121 = {
+  .id = "t121",
+  .name = "",
+  .trigger = t121_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 370,
+  .action = &t121effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s31,
+  .dest = &s253,
+  .lca = &r6,
+  .exit_path = t121_exit_path,
+  .enter_path = t121_enter_path,
+  .next = &t122,
+};
+static struct ufsm_action t121effect = {
+  .id = "t121effect",
+  .name = "a121",
+  .f = &a121,
+  .next = NULL,
+};
+static struct ufsm_trigger t122_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t122_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t122_enter_path[] = {
+  &r52,
+  NULL,
+};
+static struct ufsm_transition t122 = {
+  .id = "t122",
+  .name = "",
+  .trigger = t122_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 371,
+  .action = &t122effect,
+  .defer = false,
+  .guard = &t122guard,
+  .source = &s31,
+  .dest = &s263,
+  .lca = &r6,
+  .exit_path = t122_exit_path,
+  .enter_path = t122_enter_path,
+  .next = &t123,
+};
+static struct ufsm_action t122effect = {
+  .id = "t122effect",
+  .name = "a122",
+  .f = &a122,
+  .next = NULL,
+};
+static struct ufsm_guard t122guard = {
+  .id = "t122guard",
+  .name = "g20",
+  .f = &g20,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t123_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t123_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t123_enter_path[] = {
+  &r50,
+  NULL,
+};
+static struct ufsm_transition t123 = {
+  .id = "t123",
+  .name = "",
+  .trigger = t123_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 372,
+  .action = &t123effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s32,
+  .dest = &s254,
+  .lca = &r6,
+  .exit_path = t123_exit_path,
+  .enter_path = t123_enter_path,
+  .next = &t124,
+};
+static struct ufsm_action t123effect = {
+  .id = "t123effect",
+  .name = "a123",
+  .f = &a123,
+  .next = NULL,
+};
+static struct ufsm_trigger t124_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t124_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t124_enter_path[] = {
+  &r52,
+  NULL,
+};
+static struct ufsm_transition t124 = {
+  .id = "t124",
+  .name = "",
+  .trigger = t124_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 373,
+  .action = &t124effect,
+  .defer = false,
+  .guard = &t124guard,
+  .source = &s32,
+  .dest = &s261,
+  .lca = &r6,
+  .exit_path = t124_exit_path,
+  .enter_path = t124_enter_path,
+  .next = &t125,
+};
+static struct ufsm_action t124effect = {
+  .id = "t124effect",
+  .name = "a124",
+  .f = &a124,
+  .next = NULL,
+};
+static struct ufsm_guard t124guard = {
+  .id = "t124guard",
+  .name = "g21",
+  .f = &g21,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t125_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t125_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t125_enter_path[] = {
+  &r50,
+  NULL,
+};
+static struct ufsm_transition t125 = {
+  .id = "t125",
+  .name = "",
+  .trigger = t125_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 374,
+  .action = &t125effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s33,
+  .dest = &s252,
+  .lca = &r6,
+  .exit_path = t125_exit_path,
+  .enter_path = t125_enter_path,
+  .next = &t126,
+};
+static struct ufsm_action t125effect = {
+  .id = "t125effect",
+  .name = "a125",
+  .f = &a125,
+  .next = NULL,
+};
+static struct ufsm_trigger t126_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t126_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t126_enter_path[] = {
+  &r53,
+  NULL,
+};
+static struct ufsm_transition t126 = {
+  .id = "t126",
+  .name = "",
+  .trigger = t126_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 375,
+  .action = &t126effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s33,
+  .dest = &s266,
+  .lca = &r6,
+  .exit_path = t126_exit_path,
+  .enter_path = t126_enter_path,
+  .next = &t127,
+};
+static struct ufsm_action t126effect = {
+  .id = "t126effect",
+  .name = "a126",
+  .f = &a126,
+  .next = NULL,
+};
+static struct ufsm_trigger t127_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t127_exit_path[] = {
+  &r6,
+  NULL,
+};
+static struct ufsm_region * t127_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t127 = {
+  .id = "t127",
+  .name = "",
+  .trigger = t127_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 376,
+  .action = &t127effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s34,
+  .dest = &s11,
+  .lca = &r0,
+  .exit_path = t127_exit_path,
+  .enter_path = t127_enter_path,
+  .next = &t128,
+};
+static struct ufsm_action t127effect = {
+  .id = "t127effect",
+  .name = "a127",
+  .f = &a127,
+  .next = NULL,
+};
+static struct ufsm_trigger t128_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t128 = {
+  .id = "t128",
+  .name = "",
+  .trigger = t128_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 377,
+  .action = &t128effect,
+  .defer = false,
+  .guard = &t128guard,
+  .source = &s34,
+  .dest = &s31,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t128effect = {
+  .id = "t128effect",
+  .name = "a128",
+  .f = &a128,
+  .next = NULL,
+};
+static struct ufsm_guard t128guard = {
+  .id = "t128guard",
+  .name = "g22",
+  .f = &g22,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s34_dispatch_1[] = {
+  &t127,
+  NULL,
+};
+static struct ufsm_transition * s34_dispatch_3[] = {
+  &t128,
+  NULL,
+};
+static struct ufsm_dispatch s34_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s34_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s34_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s34_interest[] = {
+  0x0000000e,
+};
+static struct ufsm_state s34 = {
+  .id   = "s34",
+  .name = "S34",
+  .kind = 0,
+  .index = 200,
+  .parent_region = &r6,
+  .entry = &s34entry,
+  .doact = NULL,
+  .exit = &s34exit,
+  .region = &r56,
+  .submachine = NULL,
+  .dispatch = s34_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s34_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s33,
+};
+static struct ufsm_region r56 = {
+  .id = "r56",
+  .name = "R56",
+  .state = &s284,
+  .has_history = false,
+  .history = NULL,
+  .index = 53,
+  .transition = &t56,
+  .parent_state = &s34,
+  .next = &r55,
+};
+static struct ufsm_transition t56 = {
+  .id = "t56",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 515,
+  .action = &t56effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s280,
+  .dest = &s283,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t521,
+};
+static struct ufsm_action t56effect = {
+  .id = "t56effect",
+  .name = "a56",
+  .f = &a56,
+  .next = NULL,
+};
+static struct ufsm_trigger t521_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t521 = {
+  .id = "t521",
+  .name = "",
+  .trigger = t521_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 516,
+  .action = &t521effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s281,
+  .dest = &s281,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t522,
+};
+static struct ufsm_action t521effect = {
+  .id = "t521effect",
+  .name = "a521",
+  .f = &a521,
+  .next = NULL,
+};
+static struct ufsm_trigger t522_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t522 = {
+  .id = "t522",
+  .name = "",
+  .trigger = t522_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 517,
+  .action = &t522effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s281,
+  .dest = &s281,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t523,
+};
+static struct ufsm_action t522effect = {
+  .id = "t522effect",
+  .name = "a522",
+  .f = &a522,
+  .next = NULL,
+};
+static struct ufsm_trigger t523_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t523 = {
+  .id = "t523",
+  .name = "",
+  .trigger = t523_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 518,
+  .action = &t523effect,
+  .defer = false,
+  .guard = &t523guard,
+  .source = &s282,
+  .dest = &s282,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t524,
+};
+static struct ufsm_action t523effect = {
+  .id = "t523effect",
+  .name = "a523",
+  .f = &a523,
+  .next = NULL,
+};
+static struct ufsm_guard t523guard = {
+  .id = "t523guard",
+  .name = "g141",
+  .f = &g141,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t524_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t524 = {
+  .id = "t524",
+  .name = "",
+  .trigger = t524_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 519,
+  .action = &t524effect,
+  .defer = false,
+  .guard = &t524guard,
+  .source = &s282,
+  .dest = &s281,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t525,
+};
+static struct ufsm_action t524effect = {
+  .id = "t524effect",
+  .name = "a524",
+  .f = &a524,
+  .next = NULL,
+};
+static struct ufsm_guard t524guard = {
+  .id = "t524guard",
+  .name = "g142",
+  .f = &g142,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t525_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t525 = {
+  .id = "t525",
+  .name = "",
+  .trigger = t525_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 520,
+  .action = &t525effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s283,
+  .dest = &s284,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t526,
+};
+static struct ufsm_action t525effect = {
+  .id = "t525effect",
+  .name = "a525",
+  .f = &a525,
+  .next = NULL,
+};
+static struct ufsm_trigger t526_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t526_exit_path[] = {
+  &r56,
+  &r6,
+  NULL,
+};
+static struct ufsm_region * t526_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t526 = {
+  .id = "t526",
+  .name = "",
+  .trigger = t526_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 521,
+  .action = &t526effect,
+  .defer = false,
+  .guard = &t526guard,
+  .source = &s283,
+  .dest = &s1,
+  .lca = &r0,
+  .exit_path = t526_exit_path,
+  .enter_path = t526_enter_path,
+  .next = &t527,
+};
+static struct ufsm_action t526effect = {
+  .id = "t526effect",
+  .name = "a526",
+  .f = &a526,
+  .next = NULL,
+};
+static struct ufsm_guard t526guard = {
+  .id = "t526guard",
+  .name = "g143",
+  .f = &g143,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t527_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t527 = {
+  .id = "t527",
+  .name = "",
+  .trigger = t527_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 522,
+  .action = &t527effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s284,
+  .dest = &s283,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t528,
+};
+static struct ufsm_action t527effect = {
+  .id = "t527effect",
+  .name = "a527",
+  .f = &a527,
+  .next = NULL,
+};
+static struct ufsm_trigger t528_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t528 = {
+  .id = "t528",
+  .name = "",
+  .trigger = t528_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 523,
+  .action = &t528effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s284,
+  .dest = &s283,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t528effect = {
+  .id = "t528effect",
+  .name = "a528",
+  .f = &a528,
+  .next = NULL,
+};
+static struct ufsm_transition * s284_dispatch_6[] = {
+  &t528,
+  NULL,
+};
+static struct ufsm_transition * s284_dispatch_7[] = {
+  &t527,
+  NULL,
+};
+static struct ufsm_dispatch s284_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s284_dispatch_6,
+},
+{
+  .ev = 7,
+  .transition = s284_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s284_interest[] = {
+  0x000000ce,
+};
+static struct ufsm_state s284 = {
+  .id   = "s284",
+  .name = "S284",
+  .kind = 0,
+  .index = 281,
+  .parent_region = &r56,
+  .entry = &s284entry,
+  .doact = NULL,
+  .exit = &s284exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s284_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s284_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s283,
+};
+static struct ufsm_entry_exit s284entry = {
+  .id = "s284entry",
+  .name = "e284",
+  .f = &e284,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s284exit = {
+  .id = "s284exit",
+  .name = "x284",
+  .f = &x284,
+  .next = NULL,
+};
+static struct ufsm_transition * s283_dispatch_5[] = {
+  &t525,
+  &t526,
+  NULL,
+};
+static struct ufsm_dispatch s283_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s283_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s283_interest[] = {
+  0x0000002e,
+};
+static struct ufsm_state s283 = {
+  .id   = "s283",
+  .name = "S283",
+  .kind = 0,
+  .index = 282,
+  .parent_region = &r56,
+  .entry = &s283entry,
+  .doact = NULL,
+  .exit = &s283exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s283_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s283_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s282,
+};
+static struct ufsm_entry_exit s283entry = {
+  .id = "s283entry",
+  .name = "e283",
+  .f = &e283,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s283exit = {
+  .id = "s283exit",
+  .name = "x283",
+  .f = &x283,
+  .next = NULL,
+};
+static struct ufsm_transition * s282_dispatch_1[] = {
+  &t524,
+  NULL,
+};
+static struct ufsm_transition * s282_dispatch_4[] = {
+  &t523,
+  NULL,
+};
+static struct ufsm_dispatch s282_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s282_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s282_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s282_interest[] = {
+  0x0000001e,
+};
+static struct ufsm_state s282 = {
+  .id   = "s282",
+  .name = "S282",
+  .kind = 0,
+  .index = 283,
+  .parent_region = &r56,
+  .entry = &s282entry,
+  .doact = NULL,
+  .exit = &s282exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s282_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s282_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s281,
+};
+static struct ufsm_entry_exit s282entry = {
+  .id = "s282entry",
+  .name = "e282",
+  .f = &e282,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s282exit = {
+  .id = "s282exit",
+  .name = "x282",
+  .f = &x282,
+  .next = NULL,
+};
+static struct ufsm_transition * s281_dispatch_0[] = {
+  &t521,
+  NULL,
+};
+static struct ufsm_transition * s281_dispatch_6[] = {
+  &t522,
+  NULL,
+};
+static struct ufsm_dispatch s281_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s281_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s281_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s281_interest[] = {
+  0x0000004f,
+};
+static struct ufsm_state s281 = {
+  .id   = "s281",
+  .name = "S281",
+  .kind = 0,
+  .index = 284,
+  .parent_region = &r56,
+  .entry = &s281entry,
+  .doact = NULL,
+  .exit = &s281exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s281_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s281_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s280,
+};
+static struct ufsm_entry_exit s281entry = {
+  .id = "s281entry",
+  .name = "e281",
+  .f = &e281,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s281exit = {
+  .id = "s281exit",
+  .name = "x281",
+  .f = &x281,
+  .next = NULL,
+};
+static struct ufsm_dispatch s280_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s280_interest[] = {
+  0x0000000e,
+};
+static struct ufsm_state s280 = {
+  .id   = "s280",
+  .name = "Init",
+  .kind = 1,
+  .index = 285,
+  .parent_region = &r56,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s280_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s280_interest,
+  .time_events = NULL,
+  .completion = &t56,
+  .next = NULL,
+};
+static struct ufsm_region r55 = {
+  .id = "r55",
+  .name = "R55",
+  .state = &s279,
+  .has_history = false,
+  .history = NULL,
+  .index = 54,
+  .transition = &t55,
+  .parent_state = &s34,
+  .next = NULL,
+};
+static struct ufsm_transition t55 = {
+  .id = "t55",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 524,
+  .action = &t55effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s275,
+  .dest = &s276,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t513,
+};
+static struct ufsm_action t55effect = {
+  .id = "t55effect",
+  .name = "a55",
+  .f = &a55,
+  .next = NULL,
+};
+static struct ufsm_trigger t513_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t513 = {
+  .id = "t513",
+  .name = "",
+  .trigger = t513_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 525,
+  .action = &t513effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s276,
+  .dest = &s279,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t514,
+};
+static struct ufsm_action t513effect = {
+  .id = "t513effect",
+  .name = "a513",
+  .f = &a513,
+  .next = NULL,
+};
+static struct ufsm_trigger t514_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t514 = {
+  .id = "t514",
+  .name = "",
+  .trigger = t514_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 526,
+  .action = &t514effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s276,
+  .dest = &s277,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t515,
+};
+static struct ufsm_action t514effect = {
+  .id = "t514effect",
+  .name = "a514",
+  .f = &a514,
+  .next = NULL,
+};
+static struct ufsm_trigger t515_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t515 = {
+  .id = "t515",
+  .name = "",
+  .trigger = t515_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 527,
+  .action = &t515effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s277,
+  .dest = &s279,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t516,
+};
+static struct ufsm_action t515effect = {
+  .id = "t515effect",
+  .name = "a515",
+  .f = &a515,
+  .next = NULL,
+};
+static struct ufsm_trigger t516_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t516 = {
+  .id = "t516",
+  .name = "",
+  .trigger = t516_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 528,
+  .action = &t516effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s277,
+  .dest = &s278,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t517,
+};
+static struct ufsm_action t516effect = {
+  .id = "t516effect",
+  .name = "a516",
+  .f = &a516,
+  .next = NULL,
+};
+static struct ufsm_trigger t517_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t517 = {
+  .id = "t517",
+  .name = "",
+  .trigger = t517_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 529,
+  .action = &t517effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s278,
+  .dest = &s279,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t518,
+};
+static struct ufsm_action t517effect = {
+  .id = "t517effect",
+  .name = "a517",
+  .f = &a517,
+  .next = NULL,
+};
+static struct ufsm_trigger t518_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t518 = {
+  .id = "t518",
+  .name = "",
+  .trigger = t518_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 530,
+  .action = &t518effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s278,
+  .dest = &s278,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t519,
+};
+static struct ufsm_action t518effect = {
+  .id = "t518effect",
+  .name = "a518",
+  .f = &a518,
+  .next = NULL,
+};
+static struct ufsm_trigger t519_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t519 = {
+  .id = "t519",
+  .name = "",
+  .trigger = t519_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 531,
+  .action = &t519effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s279,
+  .dest = &s277,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t520,
+};
+static struct ufsm_action t519effect = {
+  .id = "t519effect",
+  .name = "a519",
+  .f = &a519,
+  .next = NULL,
+};
+static struct ufsm_trigger t520_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t520_exit_path[] = {
+  &r55,
+  NULL,
+};
+static struct ufsm_region * t520_enter_path[] = {
+  &r6,
+  NULL,
+};
+static struct ufsm_transition t520 = {
+  .id = "t520",
+  .name = "",
+  .trigger = t520_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 532,
+  .action = &t520effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s279,
+  .dest = &s31,
+  .lca = &r6,
+  .exit_path = t520_exit_path,
+  .enter_path = t520_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t520effect = {
+  .id = "t520effect",
+  .name = "a520",
+  .f = &a520,
+  .next = NULL,
+};
+static struct ufsm_transition * s279_dispatch_1[] = {
+  &t519,
+  NULL,
+};
+static struct ufsm_transition * s279_dispatch_4[] = {
+  &t520,
+  NULL,
+};
+static struct ufsm_dispatch s279_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s279_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s279_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s279_interest[] = {
+  0x0000001e,
+};
+static struct ufsm_state s279 = {
+  .id   = "s279",
+  .name = "S279",
+  .kind = 0,
+  .index = 286,
+  .parent_region = &r55,
+  .entry = &s279entry,
+  .doact = NULL,
+  .exit = &s279exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s279_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s279_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s278,
+};
+static struct ufsm_entry_exit s279entry = {
+  .id = "s279entry",
+  .name = "e279",
+  .f = &e279,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s279exit = {
+  .id = "s279exit",
+  .name = "x279",
+  .f = &x279,
+  .next = NULL,
+};
+static struct ufsm_transition * s278_dispatch_1[] = {
+  &t518,
+  NULL,
+};
+static struct ufsm_transition * s278_dispatch_3[] = {
+  &t517,
+  NULL,
+};
+static struct ufsm_dispatch s278_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s278_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s278_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s278_interest[] = {
+  0x0000000e,
+};
+static struct ufsm_state s278 = {
+  .id   = "s278",
+  .name = "S278",
+  .kind = 0,
+  .index = 287,
+  .parent_region = &r55,
+  .entry = &s278entry,
+  .doact = NULL,
+  .exit = &s278exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s278_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s278_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s277,
+};
+static struct ufsm_entry_exit s278entry = {
+  .id = "s278entry",
+  .name = "e278",
+  .f = &e278,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s278exit = {
+  .id = "s278exit",
+  .name = "x278",
+  .f = &x278,
+  .next = NULL,
+};
+static struct ufsm_transition * s277_dispatch_1[] = {
+  &t516,
+  NULL,
+};
+static struct ufsm_transition * s277_dispatch_5[] = {
+  &t515,
+  NULL,
+};
+static struct ufsm_dispatch s277_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s277_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s277_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s277_interest[] = {
+  0x0000002e,
+};
+static struct ufsm_state s277 = {
+  .id   = "s277",
+  .name = "S277",
+  .kind = 0,
+  .index = 288,
+  .parent_region = &r55,
+  .entry = &s277entry,
+  .doact = NULL,
+  .exit = &s277exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s277_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s277_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s276,
+};
+static struct ufsm_entry_exit s277entry = {
+  .id = "s277entry",
+  .name = "e277",
+  .f = &e277,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s277exit = {
+  .id = "s277exit",
+  .name = "x277",
+  .f = &x277,
+  .next = NULL,
+};
+static struct ufsm_transition * s276_dispatch_6[] = {
+  &t513,
+  &t514,
+  NULL,
+};
+static struct ufsm_dispatch s276_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s276_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s276_interest[] = {
+  0x0000004e,
+};
+static struct ufsm_state s276 = {
+  .id   = "s276",
+  .name = "S276",
+  .kind = 0,
+  .index = 289,
+  .parent_region = &r55,
+  .entry = &s276entry,
+  .doact = NULL,
+  .exit = &s276exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s276_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s276_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s275,
+};
+static struct ufsm_entry_exit s276entry = {
+  .id = "s276entry",
+  .name = "e276",
+  .f = &e276,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s276exit = {
+  .id = "s276exit",
+  .name = "x276",
+  .f = &x276,
+  .next = NULL,
+};
+static struct ufsm_dispatch s275_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s275_interest[] = {
+  0x0000000e,
+};
+static struct ufsm_state s275 = {
+  .id   = "s275",
+  .name = "Init",
+  .kind = 1,
+  .index = 290,
+  .parent_region = &r55,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s275_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s275_interest,
+  .time_events = NULL,
+  .completion = &t55,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s34entry = {
+  .id = "s34entry",
+  .name = "e34",
+  .f = &e34,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s34exit = {
+  .id = "s34exit",
+  .name = "x34",
+  .f = &x34,
+  .next = NULL,
+};
+static struct ufsm_transition * s33_dispatch_0[] = {
+  &t125,
+  NULL,
+};
+static struct ufsm_transition * s33_dispatch_4[] = {
+  &t126,
+  NULL,
+};
+static struct ufsm_dispatch s33_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s33_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s33_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s33_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s33 = {
+  .id   = "s33",
+  .name = "S33",
+  .kind = 0,
+  .index = 201,
+  .parent_region = &r6,
+  .entry = &s33entry,
+  .doact = NULL,
+  .exit = &s33exit,
+  .region = &r54,
+  .submachine = NULL,
+  .dispatch = s33_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s33_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s32,
+};
+static struct ufsm_region r54 = {
+  .id = "r54",
+  .name = "R54",
+  .state = &s274,
+  .has_history = false,
+  .history = NULL,
+  .index = 51,
+  .transition = &t54,
+  .parent_state = &s33,
+  .next = &r53,
+};
+static struct ufsm_transition t54 = {
+  .id = "t54",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 497,
+  .action = &t54effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s270,
+  .dest = &s271,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t505,
+};
+static struct ufsm_action t54effect = {
+  .id = "t54effect",
+  .name = "a54",
+  .f = &a54,
+  .next = NULL,
+};
+static struct ufsm_trigger t505_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t505 = {
+  .id = "t505",
+  .name = "",
+  .trigger = t505_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 498,
+  .action = &t505effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s271,
+  .dest = &s274,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t506,
+};
+static struct ufsm_action t505effect = {
+  .id = "t505effect",
+  .name = "a505",
+  .f = &a505,
+  .next = NULL,
+};
+static struct ufsm_trigger t506_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t506_exit_path[] = {
+  &r54,
+  NULL,
+};
+static struct ufsm_region * t506_enter_path[] = {
+  &r6,
+  NULL,
+};
+static struct ufsm_transition t506 = {
+  .id = "t506",
+  .name = "",
+  .trigger = t506_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 499,
+  .action = &t506effect,
+  .defer = false,
+  .guard = &t506guard,
+  .source = &s271,
+  .dest = &s31,
+  .lca = &r6,
+  .exit_path = t506_exit_path,
+  .enter_path = t506_enter_path,
+  .next = &t507,
+};
+static struct ufsm_action t506effect = {
+  .id = "t506effect",
+  .name = "a506",
+  .f = &a506,
+  .next = NULL,
+};
+static struct ufsm_guard t506guard = {
+  .id = "t506guard",
+  .name = "g138",
+  .f = &g138,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t507_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t507_exit_path[] = {
+  &r54,
+  NULL,
+};
+static struct ufsm_region * t507_enter_path[] = {
+  &r6,
+  NULL,
+};
+static struct ufsm_transition t507 = {
+  .id = "t507",
+  .name = "",
+  .trigger = t507_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 500,
+  .action = &t507effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s272,
+  .dest = &s34,
+  .lca = &r6,
+  .exit_path = t507_exit_path,
+  .enter_path = t507_enter_path,
+  .next = &t508,
+};
+static struct ufsm_action t507effect = {
+  .id = "t507effect",
+  .name = "a507",
+  .f = &a507,
+  .next = NULL,
+};
+static struct ufsm_trigger t508_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t508 = {
+  .id = "t508",
+  .name = "",
+  .trigger = t508_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 501,
+  .action = &t508effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s272,
+  .dest = &s273,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t509,
+};
+static struct ufsm_action t508effect = {
+  .id = "t508effect",
+  .name = "a508",
+  .f = &a508,
+  .next = NULL,
+};
+static struct ufsm_trigger t509_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t509 = {
+  .id = "t509",
+  .name = "",
+  .trigger = t509_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 502,
+  .action = &t509effect,
+  .defer = false,
+  .guard = &t509guard,
+  .source = &s273,
+  .dest = &s274,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t510,
+};
+static struct ufsm_action t509effect = {
+  .id = "t509effect",
+  .name = "a509",
+  .f = &a509,
+  .next = NULL,
+};
+static struct ufsm_guard t509guard = {
+  .id = "t509guard",
+  .name = "g139",
+  .f = &g139,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t510_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t510 = {
+  .id = "t510",
+  .name = "",
+  .trigger = t510_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 503,
+  .action = &t510effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s273,
+  .dest = &s271,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t511,
+};
+static struct ufsm_action t510effect = {
+  .id = "t510effect",
+  .name = "a510",
+  .f = &a510,
+  .next = NULL,
+};
+static struct ufsm_trigger t511_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t511 = {
+  .id = "t511",
+  .name = "",
+  .trigger = t511_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 504,
+  .action = &t511effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s274,
+  .dest = &s271,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t512,
+};
+static struct ufsm_action t511effect = {
+  .id = "t511effect",
+  .name = "a511",
+  .f = &a511,
+  .next = NULL,
+};
+static struct ufsm_trigger t512_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t512_exit_path[] = {
+  &r54,
+  NULL,
+};
+static struct ufsm_region * t512_enter_path[] = {
+  &r50,
+  NULL,
+};
+static struct ufsm_transition t512 = {
+  .id = "t512",
+  .name = "",
+  .trigger = t512_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 505,
+  .action = &t512effect,
+  .defer = false,
+  .guard = &t512guard,
+  .source = &s274,
+  .dest = &s251,
+  .lca = &r6,
+  .exit_path = t512_exit_path,
+  .enter_path = t512_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t512effect = {
+  .id = "t512effect",
+  .name = "a512",
+  .f = &a512,
+  .next = NULL,
+};
+static struct ufsm_guard t512guard = {
+  .id = "t512guard",
+  .name = "g140",
+  .f = &g140,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s274_dispatch_0[] = {
+  &t512,
+  NULL,
+};
+static struct ufsm_transition * s274_dispatch_6[] = {
+  &t511,
+  NULL,
+};
+static struct ufsm_dispatch s274_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s274_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s274_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s274_interest[] = {
+  0x00000057,
+};
+static struct ufsm_state s274 = {
+  .id   = "s274",
+  .name = "S274",
+  .kind = 0,
+  .index = 271,
+  .parent_region = &r54,
+  .entry = &s274entry,
+  .doact = NULL,
+  .exit = &s274exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s274_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s274_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s273,
+};
+static struct ufsm_entry_exit s274entry = {
+  .id = "s274entry",
+  .name = "e274",
+  .f = &e274,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s274exit = {
+  .id = "s274exit",
+  .name = "x274",
+  .f = &x274,
+  .next = NULL,
+};
+static struct ufsm_transition * s273_dispatch_0[] = {
+  &t509,
+  NULL,
+};
+static struct ufsm_transition * s273_dispatch_1[] = {
+  &t510,
+  NULL,
+};
+static struct ufsm_dispatch s273_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s273_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = s273_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s273_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s273 = {
+  .id   = "s273",
+  .name = "S273",
+  .kind = 0,
+  .index = 272,
+  .parent_region = &r54,
+  .entry = &s273entry,
+  .doact = NULL,
+  .exit = &s273exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s273_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s273_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s272,
+};
+static struct ufsm_entry_exit s273entry = {
+  .id = "s273entry",
+  .name = "e273",
+  .f = &e273,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s273exit = {
+  .id = "s273exit",
+  .name = "x273",
+  .f = &x273,
+  .next = NULL,
+};
+static struct ufsm_transition * s272_dispatch_0[] = {
+  &t508,
+  NULL,
+};
+static struct ufsm_transition * s272_dispatch_5[] = {
+  &t507,
+  NULL,
+};
+static struct ufsm_dispatch s272_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s272_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s272_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s272_interest[] = {
+  0x00000037,
+};
+static struct ufsm_state s272 = {
+  .id   = "s272",
+  .name = "S272",
+  .kind = 0,
+  .index = 273,
+  .parent_region = &r54,
+  .entry = &s272entry,
+  .doact = NULL,
+  .exit = &s272exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s272_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s272_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s271,
+};
+static struct ufsm_entry_exit s272entry = {
+  .id = "s272entry",
+  .name = "e272",
+  .f = &e272,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s272exit = {
+  .id = "s272exit",
+  .name = "x272",
+  .f = &x272,
+  .next = NULL,
+};
+static struct ufsm_transition * s271_dispatch_2[] = {
+  &t506,
+  NULL,
+};
+static struct ufsm_transition * s271_dispatch_3[] = {
+  &t505,
+  NULL,
+};
+static struct ufsm_dispatch s271_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s271_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s271_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s271_interest[] = {
+  0x0000001f,
+};
+static struct ufsm_state s271 = {
+  .id   = "s271",
+  .name = "S271",
+  .kind = 0,
+  .index = 274,
+  .parent_region = &r54,
+  .entry = &s271entry,
+  .doact = NULL,
+  .exit = &s271exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s271_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s271_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s270,
+};
+static struct ufsm_entry_exit s271entry = {
+  .id = "s271entry",
+  .name = "e271",
+  .f = &e271,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s271exit = {
+  .id = "s271exit",
+  .name = "x271",
+  .f = &x271,
+  .next = NULL,
+};
+static struct ufsm_dispatch s270_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s270_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s270 = {
+  .id   = "s270",
+  .name = "Init",
+  .kind = 1,
+  .index = 275,
+  .parent_region = &r54,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s270_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s270_interest,
+  .time_events = NULL,
+  .completion = &t54,
+  .next = NULL,
+};
+static struct ufsm_region r53 = {
+  .id = "r53",
+  .name = "R53",
+  .state = &s269,
+  .has_history = false,
+  .history = NULL,
+  .index = 52,
+  .transition = &t53,
+  .parent_state = &s33,
+  .next = NULL,
+};
+static struct ufsm_transition t53 = {
+  .id = "t53",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 506,
+  .action = &t53effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s265,
+  .dest = &s266,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t497,
+};
+static struct ufsm_action t53effect = {
+  .id = "t53effect",
+  .name = "a53",
+  .f = &a53,
+  .next = NULL,
+};
+static struct ufsm_trigger t497_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t497 = {
+  .id = "t497",
+  .name = "",
+  .trigger = t497_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 507,
+  .action = &t497effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s266,
+  .dest = &s266,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t498,
+};
+static struct ufsm_action t497effect = {
+  .id = "t497effect",
+  .name = "a497",
+  .f = &a497,
+  .next = NULL,
+};
+static struct ufsm_trigger t498_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t498 = {
+  .id = "t498",
+  .name = "",
+  .trigger = t498_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 508,
+  .action = &t498effect,
+  .defer = false,
+  .guard = &t498guard,
+  .source = &s266,
+  .dest = &s269,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t499,
+};
+static struct ufsm_action t498effect = {
+  .id = "t498effect",
+  .name = "a498",
+  .f = &a498,
+  .next = NULL,
+};
+static struct ufsm_guard t498guard = {
+  .id = "t498guard",
+  .name = "g136",
+  .f = &g136,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t499_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t499_exit_path[] = {
+  &r53,
+  &r6,
+  NULL,
+};
+static struct ufsm_region * t499_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t499 = {
+  .id = "t499",
+  .name = "",
+  .trigger = t499_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 509,
+  .action = &t499effect,
+  .defer = false,
+  .guard = &t499guard,
+  .source = &s267,
+  .dest = &s9,
+  .lca = &r0,
+  .exit_path = t499_exit_path,
+  .enter_path = t499_enter_path,
+  .next = &t500,
+};
+static struct ufsm_action t499effect = {
+  .id = "t499effect",
+  .name = "a499",
+  .f = &a499,
+  .next = NULL,
+};
+static struct ufsm_guard t499guard = {
+  .id = "t499guard",
+  .name = "g137",
+  .f = &g137,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t500_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t500 = {
+  .id = "t500",
+  .name = "",
+  .trigger = t500_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 510,
+  .action = &t500effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s267,
+  .dest = &s266,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t501,
+};
+static struct ufsm_action t500effect = {
+  .id = "t500effect",
+  .name = "a500",
+  .f = &a500,
+  .next = NULL,
+};
+static struct ufsm_trigger t501_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t501_exit_path[] = {
+  &r53,
+  NULL,
+};
+static struct ufsm_region * t501_enter_path[] = {
+  &r54,
+  NULL,
+};
+static struct ufsm_transition t501 = {
+  .id = "t501",
+  .name = "",
+  .trigger = t501_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 511,
+  .action = &t501effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s268,
+  .dest = &s271,
+  .lca = &r6,
+  .exit_path = t501_exit_path,
+  .enter_path = t501_enter_path,
+  .next = &t502,
+};
+static struct ufsm_action t501effect = {
+  .id = "t501effect",
+  .name = "a501",
+  .f = &a501,
+  .next = NULL,
+};
+static struct ufsm_trigger t502_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t502 = {
+  .id = "t502",
+  .name = "",
+  .trigger = t502_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 512,
+  .action = &t502effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s268,
+  .dest = &s269,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t503,
+};
+static struct ufsm_action t502effect = {
+  .id = "t502effect",
+  .name = "a502",
+  .f = &a502,
+  .next = NULL,
+};
+static struct ufsm_trigger t503_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t503 = {
+  .id = "t503",
+  .name = "",
+  .trigger = t503_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 513,
+  .action = &t503effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s269,
+  .dest = &s268,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t504,
+};
+static struct ufsm_action t503effect = {
+  .id = "t503effect",
+  .name = "a503",
+  .f = &a503,
+  .next = NULL,
+};
+static struct ufsm_trigger t504_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t504 = {
+  .id = "t504",
+  .name = "",
+  .trigger = t504_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 514,
+  .action = &t504effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s269,
+  .dest = &s269,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t504effect = {
+  .id = "t504effect",
+  .name = "a504",
+  .f = &a504,
+  .next = NULL,
+};
+static struct ufsm_transition * s269_dispatch_0[] = {
+  &t503,
+  NULL,
+};
+static struct ufsm_transition * s269_dispatch_4[] = {
+  &t504,
+  NULL,
+};
+static struct ufsm_dispatch s269_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s269_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s269_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s269_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s269 = {
+  .id   = "s269",
+  .name = "S269",
+  .kind = 0,
+  .index = 276,
+  .parent_region = &r53,
+  .entry = &s269entry,
+  .doact = NULL,
+  .exit = &s269exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s269_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s269_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s268,
+};
+static struct ufsm_entry_exit s269entry = {
+  .id = "s269entry",
+  .name = "e269",
+  .f = &e269,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s269exit = {
+  .id = "s269exit",
+  .name = "x269",
+  .f = &x269,
+  .next = NULL,
+};
+static struct ufsm_transition * s268_dispatch_3[] = {
+  &t502,
+  NULL,
+};
+static struct ufsm_transition * s268_dispatch_5[] = {
+  &t501,
+  NULL,
+};
+static struct ufsm_dispatch s268_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s268_dispatch_3,
+},
+{
+  .ev = 5,
+  .transition = s268_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s268_interest[] = {
+  0x0000003f,
+};
+static struct ufsm_state s268 = {
+  .id   = "s268",
+  .name = "S268",
+  .kind = 0,
+  .index = 277,
+  .parent_region = &r53,
+  .entry = &s268entry,
+  .doact = NULL,
+  .exit = &s268exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s268_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s268_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s267,
+};
+static struct ufsm_entry_exit s268entry = {
+  .id = "s268entry",
+  .name = "e268",
+  .f = &e268,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s268exit = {
+  .id = "s268exit",
+  .name = "x268",
+  .f = &x268,
+  .next = NULL,
+};
+static struct ufsm_transition * s267_dispatch_0[] = {
+  &t500,
+  NULL,
+};
+static struct ufsm_transition * s267_dispatch_4[] = {
+  &t499,
+  NULL,
+};
+static struct ufsm_dispatch s267_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s267_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s267_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s267_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s267 = {
+  .id   = "s267",
+  .name = "S267",
+  .kind = 0,
+  .index = 278,
+  .parent_region = &r53,
+  .entry = &s267entry,
+  .doact = NULL,
+  .exit = &s267exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s267_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s267_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s266,
+};
+static struct ufsm_entry_exit s267entry = {
+  .id = "s267entry",
+  .name = "e267",
+  .f = &e267,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s267exit = {
+  .id = "s267exit",
+  .name = "x267",
+  .f = &x267,
+  .next = NULL,
+};
+static struct ufsm_transition * s266_dispatch_3[] = {
+  &t498,
+  NULL,
+};
+static struct ufsm_transition * s266_dispatch_7[] = {
+  &t497,
+  NULL,
+};
+static struct ufsm_dispatch s266_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s266_dispatch_3,
+},
+{
+  .ev = 7,
+  .transition = s266_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s266_interest[] = {
+  0x0000009f,
+};
+static struct ufsm_state s266 = {
+  .id   = "s266",
+  .name = "S266",
+  .kind = 0,
+  .index = 279,
+  .parent_region = &r53,
+  .entry = &s266entry,
+  .doact = NULL,
+  .exit = &s266exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s266_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s266_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s265,
+};
+static struct ufsm_entry_exit s266entry = {
+  .id = "s266entry",
+  .name = "e266",
+  .f = &e266,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s266exit = {
+  .id = "s266exit",
+  .name = "x266",
+  .f = &x266,
+  .next = NULL,
+};
+static struct ufsm_dispatch s265_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s265_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s265 = {
+  .id   = "s265",
+  .name = "Init",
+  .kind = 1,
+  .index = 280,
+  .parent_region = &r53,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s265_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s265_interest,
+  .time_events = NULL,
+  .completion = &t53,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s33entry = {
+  .id = "s33entry",
+  .name = "e33",
+  .f = &e33,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s33exit = {
+  .id = "s33exit",
+  .name = "x33",
+  .f = &x33,
+  .next = NULL,
+};
+static struct ufsm_transition * s32_dispatch_2[] = {
+  &t124,
+  NULL,
+};
+static struct ufsm_transition * s32_dispatch_5[] = {
+  &t123,
+  NULL,
+};
+static struct ufsm_dispatch s32_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s32_dispatch_2,
+},
+{
+  .ev = 5,
+  .transition = s32_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s32_interest[] = {
+  0x00000026,
+};
+static struct ufsm_state s32 = {
+  .id   = "s32",
+  .name = "S32",
+  .kind = 0,
+  .index = 202,
+  .parent_region = &r6,
+  .entry = &s32entry,
+  .doact = NULL,
+  .exit = &s32exit,
+  .region = &r52,
+  .submachine = NULL,
+  .dispatch = s32_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s32_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s31,
+};
+static struct ufsm_region r52 = {
+  .id = "r52",
+  .name = "R52",
+  .state = &s264,
+  .has_history = false,
+  .history = NULL,
+  .index = 49,
+  .transition = &t52,
+  .parent_state = &s32,
+  .next = &r51,
+};
+static struct ufsm_transition t52 = {
+  .id = "t52",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 479,
+  .action = &t52effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s260,
+  .dest = &s263,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t489,
+};
+static struct ufsm_action t52effect = {
+  .id = "t52effect",
+  .name = "a52",
+  .f = &a52,
+  .next = NULL,
+};
+static struct ufsm_trigger t489_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t489 = {
+  .id = "t489",
+  .name = "",
+  .trigger = t489_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 480,
+  .action = &t489effect,
+  .defer = false,
+  .guard = &t489guard,
+  .source = &s261,
+  .dest = &s262,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t490,
+};
+static struct ufsm_action t489effect = {
+  .id = "t489effect",
+  .name = "a489",
+  .f = &a489,
+  .next = NULL,
+};
+static struct ufsm_guard t489guard = {
+  .id = "t489guard",
+  .name = "g133",
+  .f = &g133,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t490_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t490 = {
+  .id = "t490",
+  .name = "",
+  .trigger = t490_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 481,
+  .action = &t490effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s261,
+  .dest = &s261,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t491,
+};
+static struct ufsm_action t490effect = {
+  .id = "t490effect",
+  .name = "a490",
+  .f = &a490,
+  .next = NULL,
+};
+static struct ufsm_trigger t491_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t491 = {
+  .id = "t491",
+  .name = "",
+  .trigger = t491_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 482,
+  .action = &t491effect,
+  .defer = false,
+  .guard = &t491guard,
+  .source = &s262,
+  .dest = &s261,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t492,
+};
+static struct ufsm_action t491effect = {
+  .id = "t491effect",
+  .name = "a491",
+  .f = &a491,
+  .next = NULL,
+};
+static struct ufsm_guard t491guard = {
+  .id = "t491guard",
+  .name = "g134",
+  .f = &g134,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t492_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t492_exit_path[] = {
+  &r52,
+  NULL,
+};
+static struct ufsm_region * t492_enter_path[] = {
+  &r54,
+  NULL,
+};
+static struct ufsm_transition t492 = {
+  .id = "t492",
+  .name = "",
+  .trigger = t492_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 483,
+  .action = &t492effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s262,
+  .dest = &s274,
+  .lca = &r6,
+  .exit_path = t492_exit_path,
+  .enter_path = t492_enter_path,
+  .next = &t493,
+};
+static struct ufsm_action t492effect = {
+  .id = "t492effect",
+  .name = "a492",
+  .f = &a492,
+  .next = NULL,
+};
+static struct ufsm_trigger t493_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t493 = {
+  .id = "t493",
+  .name = "",
+  .trigger = t493_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 484,
+  .action = &t493effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s263,
+  .dest = &s263,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t494,
+};
+static struct ufsm_action t493effect = {
+  .id = "t493effect",
+  .name = "a493",
+  .f = &a493,
+  .next = NULL,
+};
+static struct ufsm_trigger t494_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t494 = {
+  .id = "t494",
+  .name = "",
+  .trigger = t494_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 485,
+  .action = &t494effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s263,
+  .dest = &s262,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t495,
+};
+static struct ufsm_action t494effect = {
+  .id = "t494effect",
+  .name = "a494",
+  .f = &a494,
+  .next = NULL,
+};
+static struct ufsm_trigger t495_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t495_exit_path[] = {
+  &r52,
+  NULL,
+};
+static struct ufsm_region * t495_enter_path[] = {
+  &r53,
+  NULL,
+};
+static struct ufsm_transition t495 = {
+  .id = "t495",
+  .name = "",
+  .trigger = t495_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 486,
+  .action = &t495effect,
+  .defer = false,
+  .guard = &t495guard,
+  .source = &s264,
+  .dest = &s266,
+  .lca = &r6,
+  .exit_path = t495_exit_path,
+  .enter_path = t495_enter_path,
+  .next = &t496,
+};
+static struct ufsm_action t495effect = {
+  .id = "t495effect",
+  .name = "a495",
+  .f = &a495,
+  .next = NULL,
+};
+static struct ufsm_guard t495guard = {
+  .id = "t495guard",
+  .name = "g135",
+  .f = &g135,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t496_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t496 = {
+  .id = "t496",
+  .name = "",
+  .trigger = t496_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 487,
+  .action = &t496effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s264,
+  .dest = &s261,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t496effect = {
+  .id = "t496effect",
+  .name = "a496",
+  .f = &a496,
+  .next = NULL,
+};
+static struct ufsm_transition * s264_dispatch_2[] = {
+  &t496,
+  NULL,
+};
+static struct ufsm_transition * s264_dispatch_4[] = {
+  &t495,
+  NULL,
+};
+static struct ufsm_dispatch s264_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s264_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s264_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s264_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s264 = {
+  .id   = "s264",
+  .name = "S264",
+  .kind = 0,
+  .index = 261,
+  .parent_region = &r52,
+  .entry = &s264entry,
+  .doact = NULL,
+  .exit = &s264exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s264_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s264_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s263,
+};
+static struct ufsm_entry_exit s264entry = {
+  .id = "s264entry",
+  .name = "e264",
+  .f = &e264,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s264exit = {
+  .id = "s264exit",
+  .name = "x264",
+  .f = &x264,
+  .next = NULL,
+};
+static struct ufsm_transition * s263_dispatch_2[] = {
+  &t494,
+  NULL,
+};
+static struct ufsm_transition * s263_dispatch_4[] = {
+  &t493,
+  NULL,
+};
+static struct ufsm_dispatch s263_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s263_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s263_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s263_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s263 = {
+  .id   = "s263",
+  .name = "S263",
+  .kind = 0,
+  .index = 262,
+  .parent_region = &r52,
+  .entry = &s263entry,
+  .doact = NULL,
+  .exit = &s263exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s263_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s263_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s262,
+};
+static struct ufsm_entry_exit s263entry = {
+  .id = "s263entry",
+  .name = "e263",
+  .f = &e263,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s263exit = {
+  .id = "s263exit",
+  .name = "x263",
+  .f = &x263,
+  .next = NULL,
+};
+static struct ufsm_transition * s262_dispatch_0[] = {
+  &t492,
+  NULL,
+};
+static struct ufsm_transition * s262_dispatch_5[] = {
+  &t491,
+  NULL,
+};
+static struct ufsm_dispatch s262_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s262_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s262_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s262_interest[] = {
+  0x00000027,
+};
+static struct ufsm_state s262 = {
+  .id   = "s262",
+  .name = "S262",
+  .kind = 0,
+  .index = 263,
+  .parent_region = &r52,
+  .entry = &s262entry,
+  .doact = NULL,
+  .exit = &s262exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s262_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s262_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s261,
+};
+static struct ufsm_entry_exit s262entry = {
+  .id = "s262entry",
+  .name = "e262",
+  .f = &e262,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s262exit = {
+  .id = "s262exit",
+  .name = "x262",
+  .f = &x262,
+  .next = NULL,
+};
+static struct ufsm_transition * s261_dispatch_1[] = {
+  &t490,
+  NULL,
+};
+static struct ufsm_transition * s261_dispatch_6[] = {
+  &t489,
+  NULL,
+};
+static struct ufsm_dispatch s261_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s261_dispatch_1,
+},
+{
+  .ev = 6,
+  .transition = s261_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s261_interest[] = {
+  0x00000066,
+};
+static struct ufsm_state s261 = {
+  .id   = "s261",
+  .name = "S261",
+  .kind = 0,
+  .index = 264,
+  .parent_region = &r52,
+  .entry = &s261entry,
+  .doact = NULL,
+  .exit = &s261exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s261_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s261_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s260,
+};
+static struct ufsm_entry_exit s261entry = {
+  .id = "s261entry",
+  .name = "e261",
+  .f = &e261,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s261exit = {
+  .id = "s261exit",
+  .name = "x261",
+  .f = &x261,
+  .next = NULL,
+};
+static struct ufsm_dispatch s260_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s260_interest[] = {
+  0x00000026,
+};
+static struct ufsm_state s260 = {
+  .id   = "s260",
+  .name = "Init",
+  .kind = 1,
+  .index = 265,
+  .parent_region = &r52,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s260_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s260_interest,
+  .time_events = NULL,
+  .completion = &t52,
+  .next = NULL,
+};
+static struct ufsm_region r51 = {
+  .id = "r51",
+  .name = "R51",
+  .state = &s259,
+  .has_history = false,
+  .history = NULL,
+  .index = 50,
+  .transition = &t51,
+  .parent_state = &s32,
+  .next = NULL,
+};
+static struct ufsm_transition t51 = {
+  .id = "t51",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 488,
+  .action = &t51effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s255,
+  .dest = &s258,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t481,
+};
+static struct ufsm_action t51effect = {
+  .id = "t51effect",
+  .name = "a51",
+  .f = &a51,
+  .next = NULL,
+};
+static struct ufsm_trigger t481_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t481 = {
+  .id = "t481",
+  .name = "",
+  .trigger = t481_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 489,
+  .action = &t481effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s256,
+  .dest = &s258,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t482,
+};
+static struct ufsm_action t481effect = {
+  .id = "t481effect",
+  .name = "a481",
+  .f = &a481,
+  .next = NULL,
+};
+static struct ufsm_trigger t482_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t482 = {
+  .id = "t482",
+  .name = "",
+  .trigger = t482_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 490,
+  .action = &t482effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s256,
+  .dest = &s256,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t483,
+};
+static struct ufsm_action t482effect = {
+  .id = "t482effect",
+  .name = "a482",
+  .f = &a482,
+  .next = NULL,
+};
+static struct ufsm_trigger t483_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t483 = {
+  .id = "t483",
+  .name = "",
+  .trigger = t483_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 491,
+  .action = &t483effect,
+  .defer = false,
+  .guard = &t483guard,
+  .source = &s257,
+  .dest = &s257,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t484,
+};
+static struct ufsm_action t483effect = {
+  .id = "t483effect",
+  .name = "a483",
+  .f = &a483,
+  .next = NULL,
+};
+static struct ufsm_guard t483guard = {
+  .id = "t483guard",
+  .name = "g132",
+  .f = &g132,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t484_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t484 = {
+  .id = "t484",
+  .name = "",
+  .trigger = t484_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 492,
+  .action = &t484effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s257,
+  .dest = &s257,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t485,
+};
+static struct ufsm_action t484effect = {
+  .id = "t484effect",
+  .name = "a484",
+  .f = &a484,
+  .next = NULL,
+};
+static struct ufsm_trigger t485_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t485 = {
+  .id = "t485",
+  .name = "",
+  .trigger = t485_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 493,
+  .action = &t485effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s258,
+  .dest = &s256,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t486,
+};
+static struct ufsm_action t485effect = {
+  .id = "t485effect",
+  .name = "a485",
+  .f = &a485,
+  .next = NULL,
+};
+static struct ufsm_trigger t486_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t486_exit_path[] = {
+  &r51,
+  &r6,
+  NULL,
+};
+static struct ufsm_region * t486_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t486 = {
+  .id = "t486",
+  .name = "",
+  .trigger = t486_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 494,
+  .action = &t486effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s258,
+  .dest = &s1,
+  .lca = &r0,
+  .exit_path = t486_exit_path,
+  .enter_path = t486_enter_path,
+  .next = &t487,
+};
+static struct ufsm_action t486effect = {
+  .id = "t486effect",
+  .name = "a486",
+  .f = &a486,
+  .next = NULL,
+};
+static struct ufsm_trigger t487_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t487 = {
+  .id = "t487",
+  .name = "",
+  .trigger = t487_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 495,
+  .action = &t487effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s259,
+  .dest = &s258,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t488,
+};
+static struct ufsm_action t487effect = {
+  .id = "t487effect",
+  .name = "a487",
+  .f = &a487,
+  .next = NULL,
+};
+static struct ufsm_trigger t488_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t488 = {
+  .id = "t488",
+  .name = "",
+  .trigger = t488_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 496,
+  .action = &t488effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s259,
+  .dest = &s259,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t488effect = {
+  .id = "t488effect",
+  .name = "a488",
+  .f = &a488,
+  .next = NULL,
+};
+static struct ufsm_transition * s259_dispatch_1[] = {
+  &t488,
+  NULL,
+};
+static struct ufsm_transition * s259_dispatch_7[] = {
+  &t487,
+  NULL,
+};
+static struct ufsm_dispatch s259_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s259_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s259_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s259_interest[] = {
+  0x000000a6,
+};
+static struct ufsm_state s259 = {
+  .id   = "s259",
+  .name = "S259",
+  .kind = 0,
+  .index = 266,
+  .parent_region = &r51,
+  .entry = &s259entry,
+  .doact = NULL,
+  .exit = &s259exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s259_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s259_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s258,
+};
+static struct ufsm_entry_exit s259entry = {
+  .id = "s259entry",
+  .name = "e259",
+  .f = &e259,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s259exit = {
+  .id = "s259exit",
+  .name = "x259",
+  .f = &x259,
+  .next = NULL,
+};
+static struct ufsm_transition * s258_dispatch_2[] = {
+  &t486,
+  NULL,
+};
+static struct ufsm_transition * s258_dispatch_5[] = {
+  &t485,
+  NULL,
+};
+static struct ufsm_dispatch s258_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s258_dispatch_2,
+},
+{
+  .ev = 5,
+  .transition = s258_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s258_interest[] = {
+  0x00000026,
+};
+static struct ufsm_state s258 = {
+  .id   = "s258",
+  .name = "S258",
+  .kind = 0,
+  .index = 267,
+  .parent_region = &r51,
+  .entry = &s258entry,
+  .doact = NULL,
+  .exit = &s258exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s258_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s258_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s257,
+};
+static struct ufsm_entry_exit s258entry = {
+  .id = "s258entry",
+  .name = "e258",
+  .f = &e258,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s258exit = {
+  .id = "s258exit",
+  .name = "x258",
+  .f = &x258,
+  .next = NULL,
+};
+static struct ufsm_transition * s257_dispatch_1[] = {
+  &t483,
+  NULL,
+};
+static struct ufsm_transition * s257_dispatch_6[] = {
+  &t484,
+  NULL,
+};
+static struct ufsm_dispatch s257_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s257_dispatch_1,
+},
+{
+  .ev = 6,
+  .transition = s257_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s257_interest[] = {
+  0x00000066,
+};
+static struct ufsm_state s257 = {
+  .id   = "s257",
+  .name = "S257",
+  .kind = 0,
+  .index = 268,
+  .parent_region = &r51,
+  .entry = &s257entry,
+  .doact = NULL,
+  .exit = &s257exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s257_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s257_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s256,
+};
+static struct ufsm_entry_exit s257entry = {
+  .id = "s257entry",
+  .name = "e257",
+  .f = &e257,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s257exit = {
+  .id = "s257exit",
+  .name = "x257",
+  .f = &x257,
+  .next = NULL,
+};
+static struct ufsm_transition * s256_dispatch_4[] = {
+  &t481,
+  &t482,
+  NULL,
+};
+static struct ufsm_dispatch s256_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s256_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s256_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s256 = {
+  .id   = "s256",
+  .name = "S256",
+  .kind = 0,
+  .index = 269,
+  .parent_region = &r51,
+  .entry = &s256entry,
+  .doact = NULL,
+  .exit = &s256exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s256_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s256_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s255,
+};
+static struct ufsm_entry_exit s256entry = {
+  .id = "s256entry",
+  .name = "e256",
+  .f = &e256,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s256exit = {
+  .id = "s256exit",
+  .name = "x256",
+  .f = &x256,
+  .next = NULL,
+};
+static struct ufsm_dispatch s255_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s255_interest[] = {
+  0x00000026,
+};
+static struct ufsm_state s255 = {
+  .id   = "s255",
+  .name = "Init",
+  .kind = 1,
+  .index = 270,
+  .parent_region = &r51,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s255_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s255_interest,
+  .time_events = NULL,
+  .completion = &t51,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s32entry = {
+  .id = "s32entry",
+  .name = "e32",
+  .f = &e32,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s32exit = {
+  .id = "s32exit",
+  .name = "x32",
+  .f = &x32,
+  .next = NULL,
+};
+static struct ufsm_transition * s31_dispatch_2[] = {
+  &t122,
+  NULL,
+};
+static struct ufsm_transition * s31_dispatch_4[] = {
+  &t121,
+  NULL,
+};
+static struct ufsm_dispatch s31_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s31_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s31_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s31_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s31 = {
+  .id   = "s31",
+  .name = "S31",
+  .kind = 0,
+  .index = 203,
+  .parent_region = &r6,
+  .entry = &s31entry,
+  .doact = NULL,
+  .exit = &s31exit,
+  .region = &r50,
+  .submachine = NULL,
+  .dispatch = s31_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s31_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s30,
+};
+static struct ufsm_region r50 = {
+  .id = "r50",
+  .name = "R50",
+  .state = &s254,
+  .has_history = false,
+  .history = NULL,
+  .index = 47,
+  .transition = &t50,
+  .parent_state = &s31,
+  .next = &r49,
+};
+static struct ufsm_transition t50 = {
+  .id = "t50",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 461,
+  .action = &t50effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s250,
+  .dest = &s251,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t473,
+};
+static struct ufsm_action t50effect = {
+  .id = "t50effect",
+  .name = "a50",
+  .f = &a50,
+  .next = NULL,
+};
+static struct ufsm_trigger t473_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t473_exit_path[] = {
+  &r50,
+  &r6,
+  NULL,
+};
+static struct ufsm_region * t473_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t473 = {
+  .id = "t473",
+  .name = "",
+  .trigger = t473_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 462,
+  .action = &t473effect,
+  .defer = false,
+  .guard = &t473guard,
+  .source = &s251,
+  .dest = &s23,
+  .lca = &r0,
+  .exit_path = t473_exit_path,
+  .enter_path = t473_enter_path,
+  .next = &t474,
+};
+static struct ufsm_action t473effect = {
+  .id = "t473effect",
+  .name = "a473",
+  .f = &a473,
+  .next = NULL,
+};
+static struct ufsm_guard t473guard = {
+  .id = "t473guard",
+  .name = "g128",
+  .f = &g128,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t474_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t474 = {
+  .id = "t474",
+  .name = "",
+  .trigger = t474_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 463,
+  .action = &t474effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s251,
+  .dest = &s251,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t475,
+};
+static struct ufsm_action t474effect = {
+  .id = "t474effect",
+  .name = "a474",
+  .f = &a474,
+  .next = NULL,
+};
+static struct ufsm_trigger t475_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t475_exit_path[] = {
+  &r50,
+  NULL,
+};
+static struct ufsm_region * t475_enter_path[] = {
+  &r6,
+  NULL,
+};
+static struct ufsm_transition t475 = {
+  .id = "t475",
+  .name = "",
+  .trigger = t475_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 464,
+  .action = &t475effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s252,
+  .dest = &s32,
+  .lca = &r6,
+  .exit_path = t475_exit_path,
+  .enter_path = t475_enter_path,
+  .next = &t476,
+};
+static struct ufsm_action t475effect = {
+  .id = "t475effect",
+  .name = "a475",
+  .f = &a475,
+  .next = NULL,
+};
+static struct ufsm_trigger t476_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t476 = {
+  .id = "t476",
+  .name = "",
+  .trigger = t476_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 465,
+  .action = &t476effect,
+  .defer = false,
+  .guard = &t476guard,
+  .source = &s252,
+  .dest = &s253,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t477,
+};
+static struct ufsm_action t476effect = {
+  .id = "t476effect",
+  .name = "a476",
+  .f = &a476,
+  .next = NULL,
+};
+static struct ufsm_guard t476guard = {
+  .id = "t476guard",
+  .name = "g129",
+  .f = &g129,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t477_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t477_exit_path[] = {
+  &r50,
+  NULL,
+};
+static struct ufsm_region * t477_enter_path[] = {
+  &r6,
+  NULL,
+};
+static struct ufsm_transition t477 = {
+  .id = "t477",
+  .name = "",
+  .trigger = t477_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 466,
+  .action = &t477effect,
+  .defer = false,
+  .guard = &t477guard,
+  .source = &s253,
+  .dest = &s31,
+  .lca = &r6,
+  .exit_path = t477_exit_path,
+  .enter_path = t477_enter_path,
+  .next = &t478,
+};
+static struct ufsm_action t477effect = {
+  .id = "t477effect",
+  .name = "a477",
+  .f = &a477,
+  .next = NULL,
+};
+static struct ufsm_guard t477guard = {
+  .id = "t477guard",
+  .name = "g130",
+  .f = &g130,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t478_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t478 = {
+  .id = "t478",
+  .name = "",
+  .trigger = t478_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 467,
+  .action = &t478effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s253,
+  .dest = &s253,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t479,
+};
+static struct ufsm_action t478effect = {
+  .id = "t478effect",
+  .name = "a478",
+  .f = &a478,
+  .next = NULL,
+};
+static struct ufsm_trigger t479_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t479 = {
+  .id = "t479",
+  .name = "",
+  .trigger = t479_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 468,
+  .action = &t479effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s254,
+  .dest = &s251,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t480,
+};
+static struct ufsm_action t479effect = {
+  .id = "t479effect",
+  .name = "a479",
+  .f = &a479,
+  .next = NULL,
+};
+static struct ufsm_trigger t480_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t480 = {
+  .id = "t480",
+  .name = "",
+  .trigger = t480_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 469,
+  .action = &t480effect,
+  .defer = false,
+  .guard = &t480guard,
+  .source = &s254,
+  .dest = &s251,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t480effect = {
+  .id = "t480effect",
+  .name = "a480",
+  .f = &a480,
+  .next = NULL,
+};
+static struct ufsm_guard t480guard = {
+  .id = "t480guard",
+  .name = "g131",
+  .f = &g131,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s254_dispatch_3[] = {
+  &t479,
+  &t480,
+  NULL,
+};
+static struct ufsm_dispatch s254_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s254_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s254_interest[] = {
+  0x0000001e,
+};
+static struct ufsm_state s254 = {
+  .id   = "s254",
+  .name = "S254",
+  .kind = 0,
+  .index = 251,
+  .parent_region = &r50,
+  .entry = &s254entry,
+  .doact = NULL,
+  .exit = &s254exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s254_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s254_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s253,
+};
+static struct ufsm_entry_exit s254entry = {
+  .id = "s254entry",
+  .name = "e254",
+  .f = &e254,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s254exit = {
+  .id = "s254exit",
+  .name = "x254",
+  .f = &x254,
+  .next = NULL,
+};
+static struct ufsm_transition * s253_dispatch_0[] = {
+  &t477,
+  NULL,
+};
+static struct ufsm_transition * s253_dispatch_5[] = {
+  &t478,
+  NULL,
+};
+static struct ufsm_dispatch s253_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s253_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s253_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s253_interest[] = {
+  0x00000037,
+};
+static struct ufsm_state s253 = {
+  .id   = "s253",
+  .name = "S253",
+  .kind = 0,
+  .index = 252,
+  .parent_region = &r50,
+  .entry = &s253entry,
+  .doact = NULL,
+  .exit = &s253exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s253_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s253_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s252,
+};
+static struct ufsm_entry_exit s253entry = {
+  .id = "s253entry",
+  .name = "e253",
+  .f = &e253,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s253exit = {
+  .id = "s253exit",
+  .name = "x253",
+  .f = &x253,
+  .next = NULL,
+};
+static struct ufsm_transition * s252_dispatch_1[] = {
+  &t476,
+  NULL,
+};
+static struct ufsm_transition * s252_dispatch_5[] = {
+  &t475,
+  NULL,
+};
+static struct ufsm_dispatch s252_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s252_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s252_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s252_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s252 = {
+  .id   = "s252",
+  .name = "S252",
+  .kind = 0,
+  .index = 253,
+  .parent_region = &r50,
+  .entry = &s252entry,
+  .doact = NULL,
+  .exit = &s252exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s252_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s252_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s251,
+};
+static struct ufsm_entry_exit s252entry = {
+  .id = "s252entry",
+  .name = "e252",
+  .f = &e252,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s252exit = {
+  .id = "s252exit",
+  .name = "x252",
+  .f = &x252,
+  .next = NULL,
+};
+static struct ufsm_transition * s251_dispatch_1[] = {
+  &t473,
+  NULL,
+};
+static struct ufsm_transition * s251_dispatch_6[] = {
+  &t474,
+  NULL,
+};
+static struct ufsm_dispatch s251_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s251_dispatch_1,
+},
+{
+  .ev = 6,
+  .transition = s251_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s251_interest[] = {
+  0x00000056,
+};
+static struct ufsm_state s251 = {
+  .id   = "s251",
+  .name = "S251",
+  .kind = 0,
+  .index = 254,
+  .parent_region = &r50,
+  .entry = &s251entry,
+  .doact = NULL,
+  .exit = &s251exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s251_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s251_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s250,
+};
+static struct ufsm_entry_exit s251entry = {
+  .id = "s251entry",
+  .name = "e251",
+  .f = &e251,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s251exit = {
+  .id = "s251exit",
+  .name = "x251",
+  .f = &x251,
+  .next = NULL,
+};
+static struct ufsm_dispatch s250_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s250_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s250 = {
+  .id   = "s250",
+  .name = "Init",
+  .kind = 1,
+  .index = 255,
+  .parent_region = &r50,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s250_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s250_interest,
+  .time_events = NULL,
+  .completion = &t50,
+  .next = NULL,
+};
+static struct ufsm_region r49 = {
+  .id = "r49",
+  .name = "R49",
+  .state = &s249,
+  .has_history = false,
+  .history = NULL,
+  .index = 48,
+  .transition = &t49,
+  .parent_state = &s31,
+  .next = NULL,
+};
+static struct ufsm_transition t49 = {
+  .id = "t49",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 470,
+  .action = &t49effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s245,
+  .dest = &s248,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t465,
+};
+static struct ufsm_action t49effect = {
+  .id = "t49effect",
+  .name = "a49",
+  .f = &a49,
+  .next = NULL,
+};
+static struct ufsm_trigger t465_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t465 = {
+  .id = "t465",
+  .name = "",
+  .trigger = t465_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 471,
+  .action = &t465effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s246,
+  .dest = &s249,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t466,
+};
+static struct ufsm_action t465effect = {
+  .id = "t465effect",
+  .name = "a465",
+  .f = &a465,
+  .next = NULL,
+};
+static struct ufsm_trigger t466_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t466 = {
+  .id = "t466",
+  .name = "",
+  .trigger = t466_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 472,
+  .action = &t466effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s246,
+  .dest = &s246,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t467,
+};
+static struct ufsm_action t466effect = {
+  .id = "t466effect",
+  .name = "a466",
+  .f = &a466,
+  .next = NULL,
+};
+static struct ufsm_trigger t467_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t467 = {
+  .id = "t467",
+  .name = "",
+  .trigger = t467_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 473,
+  .action = &t467effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s247,
+  .dest = &s247,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t468,
+};
+static struct ufsm_action t467effect = {
+  .id = "t467effect",
+  .name = "a467",
+  .f = &a467,
+  .next = NULL,
+};
+static struct ufsm_trigger t468_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t468 = {
+  .id = "t468",
+  .name = "",
+  .trigger = t468_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 474,
+  .action = &t468effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s247,
+  .dest = &s246,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t469,
+};
+static struct ufsm_action t468effect = {
+  .id = "t468effect",
+  .name = "a468",
+  .f = &a468,
+  .next = NULL,
+};
+static struct ufsm_trigger t469_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t469 = {
+  .id = "t469",
+  .name = "",
+  .trigger = t469_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 475,
+  .action = &t469effect,
+  .defer = false,
+  .guard = &t469guard,
+  .source = &s248,
+  .dest = &s246,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t470,
+};
+static struct ufsm_action t469effect = {
+  .id = "t469effect",
+  .name = "a469",
+  .f = &a469,
+  .next = NULL,
+};
+static struct ufsm_guard t469guard = {
+  .id = "t469guard",
+  .name = "g127",
+  .f = &g127,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t470_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t470 = {
+  .id = "t470",
+  .name = "",
+  .trigger = t470_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 476,
+  .action = &t470effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s248,
+  .dest = &s247,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t471,
+};
+static struct ufsm_action t470effect = {
+  .id = "t470effect",
+  .name = "a470",
+  .f = &a470,
+  .next = NULL,
+};
+static struct ufsm_trigger t471_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t471 = {
+  .id = "t471",
+  .name = "",
+  .trigger = t471_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 477,
+  .action = &t471effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s249,
+  .dest = &s249,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t472,
+};
+static struct ufsm_action t471effect = {
+  .id = "t471effect",
+  .name = "a471",
+  .f = &a471,
+  .next = NULL,
+};
+static struct ufsm_trigger t472_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t472 = {
+  .id = "t472",
+  .name = "",
+  .trigger = t472_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 478,
+  .action = &t472effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s249,
+  .dest = &s246,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t472effect = {
+  .id = "t472effect",
+  .name = "a472",
+  .f = &a472,
+  .next = NULL,
+};
+static struct ufsm_transition * s249_dispatch_4[] = {
+  &t471,
+  NULL,
+};
+static struct ufsm_transition * s249_dispatch_6[] = {
+  &t472,
+  NULL,
+};
+static struct ufsm_dispatch s249_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s249_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s249_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s249_interest[] = {
+  0x00000056,
+};
+static struct ufsm_state s249 = {
+  .id   = "s249",
+  .name = "S249",
+  .kind = 0,
+  .index = 256,
+  .parent_region = &r49,
+  .entry = &s249entry,
+  .doact = NULL,
+  .exit = &s249exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s249_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s249_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s248,
+};
+static struct ufsm_entry_exit s249entry = {
+  .id = "s249entry",
+  .name = "e249",
+  .f = &e249,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s249exit = {
+  .id = "s249exit",
+  .name = "x249",
+  .f = &x249,
+  .next = NULL,
+};
+static struct ufsm_transition * s248_dispatch_0[] = {
+  &t469,
+  NULL,
+};
+static struct ufsm_transition * s248_dispatch_6[] = {
+  &t470,
+  NULL,
+};
+static struct ufsm_dispatch s248_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s248_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s248_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s248_interest[] = {
+  0x00000057,
+};
+static struct ufsm_state s248 = {
+  .id   = "s248",
+  .name = "S248",
+  .kind = 0,
+  .index = 257,
+  .parent_region = &r49,
+  .entry = &s248entry,
+  .doact = NULL,
+  .exit = &s248exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s248_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s248_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s247,
+};
+static struct ufsm_entry_exit s248entry = {
+  .id = "s248entry",
+  .name = "e248",
+  .f = &e248,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s248exit = {
+  .id = "s248exit",
+  .name = "x248",
+  .f = &x248,
+  .next = NULL,
+};
+static struct ufsm_transition * s247_dispatch_6[] = {
+  &t467,
+  NULL,
+};
+static struct ufsm_transition * s247_dispatch_7[] = {
+  &t468,
+  NULL,
+};
+static struct ufsm_dispatch s247_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s247_dispatch_6,
+},
+{
+  .ev = 7,
+  .transition = s247_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s247_interest[] = {
+  0x000000d6,
+};
+static struct ufsm_state s247 = {
+  .id   = "s247",
+  .name = "S247",
+  .kind = 0,
+  .index = 258,
+  .parent_region = &r49,
+  .entry = &s247entry,
+  .doact = NULL,
+  .exit = &s247exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s247_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s247_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s246,
+};
+static struct ufsm_entry_exit s247entry = {
+  .id = "s247entry",
+  .name = "e247",
+  .f = &e247,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s247exit = {
+  .id = "s247exit",
+  .name = "x247",
+  .f = &x247,
+  .next = NULL,
+};
+static struct ufsm_transition * s246_dispatch_3[] = {
+  &t465,
+  &t466,
+  NULL,
+};
+static struct ufsm_dispatch s246_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s246_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s246_interest[] = {
+  0x0000001e,
+};
+static struct ufsm_state s246 = {
+  .id   = "s246",
+  .name = "S246",
+  .kind = 0,
+  .index = 259,
+  .parent_region = &r49,
+  .entry = &s246entry,
+  .doact = NULL,
+  .exit = &s246exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s246_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s246_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s245,
+};
+static struct ufsm_entry_exit s246entry = {
+  .id = "s246entry",
+  .name = "e246",
+  .f = &e246,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s246exit = {
+  .id = "s246exit",
+  .name = "x246",
+  .f = &x246,
+  .next = NULL,
+};
+static struct ufsm_dispatch s245_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s245_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s245 = {
+  .id   = "s245",
+  .name = "Init",
+  .kind = 1,
+  .index = 260,
+  .parent_region = &r49,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s245_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s245_interest,
+  .time_events = NULL,
+  .completion = &t49,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s31entry = {
+  .id = "s31entry",
+  .name = "e31",
+  .f = &e31,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s31exit = {
+  .id = "s31exit",
+  .name = "x31",
+  .f = &x31,
+  .next = NULL,
+};
+static struct ufsm_dispatch s30_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s30_interest[] = {
+  0x00000006,
+};
+static struct ufsm_state s30 = {
+  .id   = "s30",
+  .name = "Init",
+  .kind = 1,
+  .index = 204,
+  .parent_region = &r6,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s30_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s30_interest,
+  .time_events = NULL,
+  .completion = &t6,
+  .next = NULL,
+};
+static struct ufsm_region r5 = {
+  .id = "r5",
+  .name = "R5",
+  .state = &s29,
+  .has_history = false,
+  .history = NULL,
+  .index = 38,
+  .transition = &t5,
+  .parent_state = &s3,
+  .next = NULL,
+};
+static struct ufsm_transition t5 = {
+  .id = "t5",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 378,
+  .action = &t5effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s25,
+  .dest = &s27,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t113,
+};
+static struct ufsm_action t5effect = {
+  .id = "t5effect",
+  .name = "a5",
+  .f = &a5,
+  .next = NULL,
+};
+static struct ufsm_trigger t113_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t113_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t113_enter_path[] = {
+  &r45,
+  NULL,
+};
+static struct ufsm_transition t113 = {
+  .id = "t113",
+  .name = "",
+  .trigger = t113_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 379,
+  .action = &t113effect,
+  .defer = false,
+  .guard = &t113guard,
+  .source = &s26,
+  .dest = &s226,
+  .lca = &r5,
+  .exit_path = t113_exit_path,
+  .enter_path = t113_enter_path,
+  .next = &t114,
+};
+static struct ufsm_action t113effect = {
+  .id = "t113effect",
+  .name = "a113",
+  .f = &a113,
+  .next = NULL,
+};
+static struct ufsm_guard t113guard = {
+  .id = "t113guard",
+  .name = "g15",
+  .f = &g15,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t114_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t114_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t114_enter_path[] = {
+  &r45,
+  NULL,
+};
+static struct ufsm_transition t114 = {
+  .id = "t114",
+  .name = "",
+  .trigger = t114_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 380,
+  .action = &t114effect,
+  .defer = false,
+  .guard = &t114guard,
+  .source = &s26,
+  .dest = &s229,
+  .lca = &r5,
+  .exit_path = t114_exit_path,
+  .enter_path = t114_enter_path,
+  .next = &t115,
+};
+static struct ufsm_action t114effect = {
+  .id = "t114effect",
+  .name = "a114",
+  .f = &a114,
+  .next = NULL,
+};
+static struct ufsm_guard t114guard = {
+  .id = "t114guard",
+  .name = "g16",
+  .f = &g16,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t115_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t115_exit_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_region * t115_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t115 = {
+  .id = "t115",
+  .name = "",
+  .trigger = t115_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 381,
+  .action = &t115effect,
+  .defer = false,
+  .guard = &t115guard,
+  .source = &s27,
+  .dest = &s3,
+  .lca = &r0,
+  .exit_path = t115_exit_path,
+  .enter_path = t115_enter_path,
+  .next = &t116,
+};
+static struct ufsm_action t115effect = {
+  .id = "t115effect",
+  .name = "a115",
+  .f = &a115,
+  .next = NULL,
+};
+static struct ufsm_guard t115guard = {
+  .id = "t115guard",
+  .name = "g17",
+  .f = &g17,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t116_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t116_exit_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_region * t116_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t116 = {
+  .id = "t116",
+  .name = "",
+  .trigger = t116_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 382,
+  .action = &t116effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s27,
+  .dest = &s1,
+  .lca = &r0,
+  .exit_path = t116_exit_path,
+  .enter_path = t116_enter_path,
+  .next = &t117,
+};
+static struct ufsm_action t116effect = {
+  .id = "t116effect",
+  .name = "a116",
+  .f = &a116,
+  .next = NULL,
+};
+static struct ufsm_trigger t117_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t117_exit_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_region * t117_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t117 = {
+  .id = "t117",
+  .name = "",
+  .trigger = t117_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 383,
+  .action = &t117effect,
+  .defer = false,
+  .guard = &t117guard,
+  .source = &s28,
+  .dest = &s11,
+  .lca = &r0,
+  .exit_path = t117_exit_path,
+  .enter_path = t117_enter_path,
+  .next = &t118,
+};
+static struct ufsm_action t117effect = {
+  .id = "t117effect",
+  .name = "a117",
+  .f = &a117,
+  .next = NULL,
+};
+static struct ufsm_guard t117guard = {
+  .id = "t117guard",
+  .name = "g18",
+  .f = &g18,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t118_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t118_exit_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_region * t118_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t118 = {
+  .id = "t118",
+  .name = "",
+  .trigger = t118_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 384,
+  .action = &t118effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s28,
+  .dest = &s6,
+  .lca = &r0,
+  .exit_path = t118_exit_path,
+  .enter_path = t118_enter_path,
+  .next = &t119,
+};
+static struct ufsm_action t118effect = {
+  .id = "t118effect",
+  .name = "a118",
+  .f = &a118,
+  .next = NULL,
+};
+static struct ufsm_trigger t119_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t119 = {
+  .id = "t119",
+  .name = "",
+  .trigger = t119_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 385,
+  .action = &t119effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s29,
+  .dest = &s26,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t120,
+};
+static struct ufsm_action t119effect = {
+  .id = "t119effect",
+  .name = "a119",
+  .f = &a119,
+  .next = NULL,
+};
+static struct ufsm_trigger t120_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t120_exit_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_region * t120_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t120 = {
+  .id = "t120",
+  .name = "",
+  .trigger = t120_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 386,
+  .action = &t120effect,
+  .defer = false,
+  .guard = &t120guard,
+  .source = &s29,
+  .dest = &s3,
+  .lca = &r0,
+  .exit_path = t120_exit_path,
+  .enter_path = t120_enter_path,
+  .next = &t706,
+};
+static struct ufsm_action t120effect = {
+  .id = "t120effect",
+  .name = "a120",
+  .f = &a120,
+  .next = NULL,
+};
+static struct ufsm_guard t120guard = {
+  .id = "t120guard",
+  .name = "g19",
+  .f = &g19,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t706_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t706_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t706_enter_path[] = {
+  &r41,
+  NULL,
+};
+static struct ufsm_transition t706 = {
+  .id = "t706",
+  .name = "",
+  .trigger = t706_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 387,
+  .action = &t706effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s28,
+  .dest = &s383,
+  .lca = &r5,
+  .exit_path = t706_exit_path,
+  .enter_path = t706_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t706effect = {
+  .id = "t706effect",
+  .name = "a706",
+  .f = &a706,
+  .next = NULL,
+};
+static struct ufsm_transition * s29_dispatch_4[] = {
+  &t119,
+  NULL,
+};
+static struct ufsm_transition * s29_dispatch_5[] = {
+  &t120,
+  NULL,
+};
+static struct ufsm_dispatch s29_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s29_dispatch_4,
+},
+{
+  .ev = 5,
+  .transition = s29_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s29_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s29 = {
+  .id   = "s29",
+  .name = "S29",
+  .kind = 0,
+  .index = 205,
+  .parent_region = &r5,
+  .entry = &s29entry,
+  .doact = NULL,
+  .exit = &s29exit,
+  .region = &r48,
+  .submachine = NULL,
+  .dispatch = s29_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s29_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s28,
+};
+static struct ufsm_region r48 = {
+  .id = "r48",
+  .name = "R48",
+  .state = &s244,
+  .has_history = false,
+  .history = NULL,
+  .index = 45,
+  .transition = &t48,
+  .parent_state = &s29,
+  .next = &r47,
+};
+static struct ufsm_transition t48 = {
+  .id = "t48",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 443,
+  .action = &t48effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s240,
+  .dest = &s241,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t457,
+};
+static struct ufsm_action t48effect = {
+  .id = "t48effect",
+  .name = "a48",
+  .f = &a48,
+  .next = NULL,
+};
+static struct ufsm_trigger t457_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t457 = {
+  .id = "t457",
+  .name = "",
+  .trigger = t457_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 444,
+  .action = &t457effect,
+  .defer = false,
+  .guard = &t457guard,
+  .source = &s241,
+  .dest = &s241,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t458,
+};
+static struct ufsm_action t457effect = {
+  .id = "t457effect",
+  .name = "a457",
+  .f = &a457,
+  .next = NULL,
+};
+static struct ufsm_guard t457guard = {
+  .id = "t457guard",
+  .name = "g125",
+  .f = &g125,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t458_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t458 = {
+  .id = "t458",
+  .name = "",
+  .trigger = t458_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 445,
+  .action = &t458effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s241,
+  .dest = &s244,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t459,
+};
+static struct ufsm_action t458effect = {
+  .id = "t458effect",
+  .name = "a458",
+  .f = &a458,
+  .next = NULL,
+};
+static struct ufsm_trigger t459_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t459 = {
+  .id = "t459",
+  .name = "",
+  .trigger = t459_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 446,
+  .action = &t459effect,
+  .defer = false,
+  .guard = &t459guard,
+  .source = &s242,
+  .dest = &s241,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t460,
+};
+static struct ufsm_action t459effect = {
+  .id = "t459effect",
+  .name = "a459",
+  .f = &a459,
+  .next = NULL,
+};
+static struct ufsm_guard t459guard = {
+  .id = "t459guard",
+  .name = "g126",
+  .f = &g126,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t460_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t460 = {
+  .id = "t460",
+  .name = "",
+  .trigger = t460_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 447,
+  .action = &t460effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s242,
+  .dest = &s241,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t461,
+};
+static struct ufsm_action t460effect = {
+  .id = "t460effect",
+  .name = "a460",
+  .f = &a460,
+  .next = NULL,
+};
+static struct ufsm_trigger t461_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t461 = {
+  .id = "t461",
+  .name = "",
+  .trigger = t461_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 448,
+  .action = &t461effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s243,
+  .dest = &s241,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t462,
+};
+static struct ufsm_action t461effect = {
+  .id = "t461effect",
+  .name = "a461",
+  .f = &a461,
+  .next = NULL,
+};
+static struct ufsm_trigger t462_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t462 = {
+  .id = "t462",
+  .name = "",
+  .trigger = t462_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 449,
+  .action = &t462effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s243,
+  .dest = &s242,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t463,
+};
+static struct ufsm_action t462effect = {
+  .id = "t462effect",
+  .name = "a462",
+  .f = &a462,
+  .next = NULL,
+};
+static struct ufsm_trigger t463_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t463 = {
+  .id = "t463",
+  .name = "",
+  .trigger = t463_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 450,
+  .action = &t463effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s244,
+  .dest = &s241,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t464,
+};
+static struct ufsm_action t463effect = {
+  .id = "t463effect",
+  .name = "a463",
+  .f = &a463,
+  .next = NULL,
+};
+static struct ufsm_trigger t464_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t464 = {
+  .id = "t464",
+  .name = "",
+  .trigger = t464_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 451,
+  .action = &t464effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s244,
+  .dest = &s244,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t464effect = {
+  .id = "t464effect",
+  .name = "a464",
+  .f = &a464,
+  .next = NULL,
+};
+static struct ufsm_transition * s244_dispatch_6[] = {
+  &t464,
+  NULL,
+};
+static struct ufsm_transition * s244_dispatch_7[] = {
+  &t463,
+  NULL,
+};
+static struct ufsm_dispatch s244_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s244_dispatch_6,
+},
+{
+  .ev = 7,
+  .transition = s244_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s244_interest[] = {
+  0x000000f6,
+};
+static struct ufsm_state s244 = {
+  .id   = "s244",
+  .name = "S244",
+  .kind = 0,
+  .index = 241,
+  .parent_region = &r48,
+  .entry = &s244entry,
+  .doact = NULL,
+  .exit = &s244exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s244_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s244_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s243,
+};
+static struct ufsm_entry_exit s244entry = {
+  .id = "s244entry",
+  .name = "e244",
+  .f = &e244,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s244exit = {
+  .id = "s244exit",
+  .name = "x244",
+  .f = &x244,
+  .next = NULL,
+};
+static struct ufsm_transition * s243_dispatch_5[] = {
+  &t462,
+  NULL,
+};
+static struct ufsm_transition * s243_dispatch_7[] = {
+  &t461,
+  NULL,
+};
+static struct ufsm_dispatch s243_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s243_dispatch_5,
+},
+{
+  .ev = 7,
+  .transition = s243_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s243_interest[] = {
+  0x000000b6,
+};
+static struct ufsm_state s243 = {
+  .id   = "s243",
+  .name = "S243",
+  .kind = 0,
+  .index = 242,
+  .parent_region = &r48,
+  .entry = &s243entry,
+  .doact = NULL,
+  .exit = &s243exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s243_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s243_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s242,
+};
+static struct ufsm_entry_exit s243entry = {
+  .id = "s243entry",
+  .name = "e243",
+  .f = &e243,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s243exit = {
+  .id = "s243exit",
+  .name = "x243",
+  .f = &x243,
+  .next = NULL,
+};
+static struct ufsm_transition * s242_dispatch_1[] = {
+  &t459,
+  NULL,
+};
+static struct ufsm_transition * s242_dispatch_6[] = {
+  &t460,
+  NULL,
+};
+static struct ufsm_dispatch s242_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s242_dispatch_1,
+},
+{
+  .ev = 6,
+  .transition = s242_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s242_interest[] = {
+  0x00000076,
+};
+static struct ufsm_state s242 = {
+  .id   = "s242",
+  .name = "S242",
+  .kind = 0,
+  .index = 243,
+  .parent_region = &r48,
+  .entry = &s242entry,
+  .doact = NULL,
+  .exit = &s242exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s242_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s242_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s241,
+};
+static struct ufsm_entry_exit s242entry = {
+  .id = "s242entry",
+  .name = "e242",
+  .f = &e242,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s242exit = {
+  .id = "s242exit",
+  .name = "x242",
+  .f = &x242,
+  .next = NULL,
+};
+static struct ufsm_transition * s241_dispatch_2[] = {
+  &t457,
+  NULL,
+};
+static struct ufsm_transition * s241_dispatch_7[] = {
+  &t458,
+  NULL,
+};
+static struct ufsm_dispatch s241_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s241_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s241_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s241_interest[] = {
+  0x000000b6,
+};
+static struct ufsm_state s241 = {
+  .id   = "s241",
+  .name = "S241",
+  .kind = 0,
+  .index = 244,
+  .parent_region = &r48,
+  .entry = &s241entry,
+  .doact = NULL,
+  .exit = &s241exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s241_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s241_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s240,
+};
+static struct ufsm_entry_exit s241entry = {
+  .id = "s241entry",
+  .name = "e241",
+  .f = &e241,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s241exit = {
+  .id = "s241exit",
+  .name = "x241",
+  .f = &x241,
+  .next = NULL,
+};
+static struct ufsm_dispatch s240_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s240_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s240 = {
+  .id   = "s240",
+  .name = "Init",
+  .kind = 1,
+  .index = 245,
+  .parent_region = &r48,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s240_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s240_interest,
+  .time_events = NULL,
+  .completion = &t48,
+  .next = NULL,
+};
+static struct ufsm_region r47 = {
+  .id = "r47",
+  .name = "R47",
+  .state = &s239,
+  .has_history = false,
+  .history = NULL,
+  .index = 46,
+  .transition = &t47,
+  .parent_state = &s29,
+  .next = NULL,
+};
+static struct ufsm_transition t47 = {
+  .id = "t47",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 452,
+  .action = &t47effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s235,
+  .dest = &s239,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t449,
+};
+static struct ufsm_action t47effect = {
+  .id = "t47effect",
+  .name = "a47",
+  .f = &a47,
+  .next = NULL,
+};
+static struct ufsm_trigger t449_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t449_exit_path[] = {
+  &r47,
+  NULL,
+};
+static struct ufsm_region * t449_enter_path[] = {
+  &r45,
+  NULL,
+};
+static struct ufsm_transition t449 = {
+  .id = "t449",
+  .name = "",
+  .trigger = t449_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 453,
+  .action = &t449effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s236,
+  .dest = &s226,
+  .lca = &r5,
+  .exit_path = t449_exit_path,
+  .enter_path = t449_enter_path,
+  .next = &t450,
+};
+static struct ufsm_action t449effect = {
+  .id = "t449effect",
+  .name = "a449",
+  .f = &a449,
+  .next = NULL,
+};
+static struct ufsm_trigger t450_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t450_exit_path[] = {
+  &r47,
+  NULL,
+};
+static struct ufsm_region * t450_enter_path[] = {
+  &r44,
+  NULL,
+};
+static struct ufsm_transition t450 = {
+  .id = "t450",
+  .name = "",
+  .trigger = t450_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 454,
+  .action = &t450effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s236,
+  .dest = &s221,
+  .lca = &r5,
+  .exit_path = t450_exit_path,
+  .enter_path = t450_enter_path,
+  .next = &t451,
+};
+static struct ufsm_action t450effect = {
+  .id = "t450effect",
+  .name = "a450",
+  .f = &a450,
+  .next = NULL,
+};
+static struct ufsm_trigger t451_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t451 = {
+  .id = "t451",
+  .name = "",
+  .trigger = t451_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 455,
+  .action = &t451effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s237,
+  .dest = &s237,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t452,
+};
+static struct ufsm_action t451effect = {
+  .id = "t451effect",
+  .name = "a451",
+  .f = &a451,
+  .next = NULL,
+};
+static struct ufsm_trigger t452_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t452 = {
+  .id = "t452",
+  .name = "",
+  .trigger = t452_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 456,
+  .action = &t452effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s237,
+  .dest = &s236,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t453,
+};
+static struct ufsm_action t452effect = {
+  .id = "t452effect",
+  .name = "a452",
+  .f = &a452,
+  .next = NULL,
+};
+static struct ufsm_trigger t453_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t453_exit_path[] = {
+  &r47,
+  NULL,
+};
+static struct ufsm_region * t453_enter_path[] = {
+  &r41,
+  NULL,
+};
+static struct ufsm_transition t453 = {
+  .id = "t453",
+  .name = "",
+  .trigger = t453_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 457,
+  .action = &t453effect,
+  .defer = false,
+  .guard = &t453guard,
+  .source = &s238,
+  .dest = &s208,
+  .lca = &r5,
+  .exit_path = t453_exit_path,
+  .enter_path = t453_enter_path,
+  .next = &t454,
+};
+static struct ufsm_action t453effect = {
+  .id = "t453effect",
+  .name = "a453",
+  .f = &a453,
+  .next = NULL,
+};
+static struct ufsm_guard t453guard = {
+  .id = "t453guard",
+  .name = "g124",
+  .f = &g124,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t454_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t454 = {
+  .id = "t454",
+  .name = "",
+  .trigger = t454_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 458,
+  .action = &t454effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s238,
+  .dest = &s237,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t455,
+};
+static struct ufsm_action t454effect = {
+  .id = "t454effect",
+  .name = "a454",
+  .f = &a454,
+  .next = NULL,
+};
+static struct ufsm_trigger t455_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t455 = {
+  .id = "t455",
+  .name = "",
+  .trigger = t455_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 459,
+  .action = &t455effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s239,
+  .dest = &s238,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t456,
+};
+static struct ufsm_action t455effect = {
+  .id = "t455effect",
+  .name = "a455",
+  .f = &a455,
+  .next = NULL,
+};
+static struct ufsm_trigger t456_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t456 = {
+  .id = "t456",
+  .name = "",
+  .trigger = t456_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 460,
+  .action = &t456effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s239,
+  .dest = &s239,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t456effect = {
+  .id = "t456effect",
+  .name = "a456",
+  .f = &a456,
+  .next = NULL,
+};
+static struct ufsm_transition * s239_dispatch_4[] = {
+  &t456,
+  NULL,
+};
+static struct ufsm_transition * s239_dispatch_7[] = {
+  &t455,
+  NULL,
+};
+static struct ufsm_dispatch s239_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s239_dispatch_4,
+},
+{
+  .ev = 7,
+  .transition = s239_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s239_interest[] = {
+  0x000000b6,
+};
+static struct ufsm_state s239 = {
+  .id   = "s239",
+  .name = "S239",
+  .kind = 0,
+  .index = 246,
+  .parent_region = &r47,
+  .entry = &s239entry,
+  .doact = NULL,
+  .exit = &s239exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s239_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s239_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s238,
+};
+static struct ufsm_entry_exit s239entry = {
+  .id = "s239entry",
+  .name = "e239",
+  .f = &e239,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s239exit = {
+  .id = "s239exit",
+  .name = "x239",
+  .f = &x239,
+  .next = NULL,
+};
+static struct ufsm_transition * s238_dispatch_2[] = {
+  &t453,
+  NULL,
+};
+static struct ufsm_transition * s238_dispatch_6[] = {
+  &t454,
+  NULL,
+};
+static struct ufsm_dispatch s238_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s238_dispatch_2,
+},
+{
+  .ev = 6,
+  .transition = s238_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s238_interest[] = {
+  0x00000076,
+};
+static struct ufsm_state s238 = {
+  .id   = "s238",
+  .name = "S238",
+  .kind = 0,
+  .index = 247,
+  .parent_region = &r47,
+  .entry = &s238entry,
+  .doact = NULL,
+  .exit = &s238exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s238_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s238_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s237,
+};
+static struct ufsm_entry_exit s238entry = {
+  .id = "s238entry",
+  .name = "e238",
+  .f = &e238,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s238exit = {
+  .id = "s238exit",
+  .name = "x238",
+  .f = &x238,
+  .next = NULL,
+};
+static struct ufsm_transition * s237_dispatch_2[] = {
+  &t451,
+  NULL,
+};
+static struct ufsm_transition * s237_dispatch_4[] = {
+  &t452,
+  NULL,
+};
+static struct ufsm_dispatch s237_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s237_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s237_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s237_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s237 = {
+  .id   = "s237",
+  .name = "S237",
+  .kind = 0,
+  .index = 248,
+  .parent_region = &r47,
+  .entry = &s237entry,
+  .doact = NULL,
+  .exit = &s237exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s237_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s237_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s236,
+};
+static struct ufsm_entry_exit s237entry = {
+  .id = "s237entry",
+  .name = "e237",
+  .f = &e237,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s237exit = {
+  .id = "s237exit",
+  .name = "x237",
+  .f = &x237,
+  .next = NULL,
+};
+static struct ufsm_transition * s236_dispatch_1[] = {
+  &t450,
+  NULL,
+};
+static struct ufsm_transition * s236_dispatch_2[] = {
+  &t449,
+  NULL,
+};
+static struct ufsm_dispatch s236_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s236_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = s236_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s236_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s236 = {
+  .id   = "s236",
+  .name = "S236",
+  .kind = 0,
+  .index = 249,
+  .parent_region = &r47,
+  .entry = &s236entry,
+  .doact = NULL,
+  .exit = &s236exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s236_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s236_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s235,
+};
+static struct ufsm_entry_exit s236entry = {
+  .id = "s236entry",
+  .name = "e236",
+  .f = &e236,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s236exit = {
+  .id = "s236exit",
+  .name = "x236",
+  .f = &x236,
+  .next = NULL,
+};
+static struct ufsm_dispatch s235_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s235_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s235 = {
+  .id   = "s235",
+  .name = "Init",
+  .kind = 1,
+  .index = 250,
+  .parent_region = &r47,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s235_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s235_interest,
+  .time_events = NULL,
+  .completion = &t47,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s29entry = {
+  .id = "s29entry",
+  .name = "e29",
+  .f = &e29,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s29exit = {
+  .id = "s29exit",
+  .name = "x29",
+  .f = &x29,
+  .next = NULL,
+};
+static struct ufsm_transition * s28_dispatch_0[] = {
+  &t118,
+  NULL,
+};
+static struct ufsm_transition * s28_dispatch_2[] = {
+  &t117,
+  NULL,
+};
+static struct ufsm_transition * s28_dispatch_4[] = {
+  &t706,
+  NULL,
+};
+static struct ufsm_dispatch s28_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s28_dispatch_0,
+},
+{
+  .ev = 2,
+  .transition = s28_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s28_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s28_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s28 = {
+  .id   = "s28",
+  .name = "S28",
+  .kind = 0,
+  .index = 206,
+  .parent_region = &r5,
+  .entry = &s28entry,
+  .doact = NULL,
+  .exit = &s28exit,
+  .region = &r46,
+  .submachine = NULL,
+  .dispatch = s28_dispatch,
+  .no_of_dispatch = 3,
+  .flat_dispatch = NULL,
+  .interest = s28_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s27,
+};
+static struct ufsm_region r46 = {
+  .id = "r46",
+  .name = "R46",
+  .state = &s234,
+  .has_history = false,
+  .history = NULL,
+  .index = 43,
+  .transition = &t46,
+  .parent_state = &s28,
+  .next = &r45,
+};
+static struct ufsm_transition t46 = {
+  .id = "t46",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 425,
+  .action = &t46effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s230,
+  .dest = &s231,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t441,
+};
+static struct ufsm_action t46effect = {
+  .id = "t46effect",
+  .name = "a46",
+  .f = &a46,
+  .next = NULL,
+};
+static struct ufsm_trigger t441_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t441 = {
+  .id = "t441",
+  .name = "",
+  .trigger = t441_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 426,
+  .action = &t441effect,
+  .defer = false,
+  .guard = &t441guard,
+  .source = &s231,
+  .dest = &s232,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t442,
+};
+static struct ufsm_action t441effect = {
+  .id = "t441effect",
+  .name = "a441",
+  .f = &a441,
+  .next = NULL,
+};
+static struct ufsm_guard t441guard = {
+  .id = "t441guard",
+  .name = "g120",
+  .f = &g120,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t442_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t442_exit_path[] = {
+  &r46,
+  NULL,
+};
+static struct ufsm_region * t442_enter_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_transition t442 = {
+  .id = "t442",
+  .name = "",
+  .trigger = t442_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 427,
+  .action = &t442effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s231,
+  .dest = &s29,
+  .lca = &r5,
+  .exit_path = t442_exit_path,
+  .enter_path = t442_enter_path,
+  .next = &t443,
+};
+static struct ufsm_action t442effect = {
+  .id = "t442effect",
+  .name = "a442",
+  .f = &a442,
+  .next = NULL,
+};
+static struct ufsm_trigger t443_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t443 = {
+  .id = "t443",
+  .name = "",
+  .trigger = t443_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 428,
+  .action = &t443effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s232,
+  .dest = &s232,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t444,
+};
+static struct ufsm_action t443effect = {
+  .id = "t443effect",
+  .name = "a443",
+  .f = &a443,
+  .next = NULL,
+};
+static struct ufsm_trigger t444_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t444_exit_path[] = {
+  &r46,
+  NULL,
+};
+static struct ufsm_region * t444_enter_path[] = {
+  &r47,
+  NULL,
+};
+static struct ufsm_transition t444 = {
+  .id = "t444",
+  .name = "",
+  .trigger = t444_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 429,
+  .action = &t444effect,
+  .defer = false,
+  .guard = &t444guard,
+  .source = &s232,
+  .dest = &s237,
+  .lca = &r5,
+  .exit_path = t444_exit_path,
+  .enter_path = t444_enter_path,
+  .next = &t445,
+};
+static struct ufsm_action t444effect = {
+  .id = "t444effect",
+  .name = "a444",
+  .f = &a444,
+  .next = NULL,
+};
+static struct ufsm_guard t444guard = {
+  .id = "t444guard",
+  .name = "g121",
+  .f = &g121,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t445_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t445_exit_path[] = {
+  &r46,
+  NULL,
+};
+static struct ufsm_region * t445_enter_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_transition t445 = {
+  .id = "t445",
+  .name = "",
+  .trigger = t445_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 430,
+  .action = &t445effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s233,
+  .dest = &s26,
+  .lca = &r5,
+  .exit_path = t445_exit_path,
+  .enter_path = t445_enter_path,
+  .next = &t446,
+};
+static struct ufsm_action t445effect = {
+  .id = "t445effect",
+  .name = "a445",
+  .f = &a445,
+  .next = NULL,
+};
+static struct ufsm_trigger t446_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t446 = {
+  .id = "t446",
+  .name = "",
+  .trigger = t446_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 431,
+  .action = &t446effect,
+  .defer = false,
+  .guard = &t446guard,
+  .source = &s233,
+  .dest = &s231,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t447,
+};
+static struct ufsm_action t446effect = {
+  .id = "t446effect",
+  .name = "a446",
+  .f = &a446,
+  .next = NULL,
+};
+static struct ufsm_guard t446guard = {
+  .id = "t446guard",
+  .name = "g122",
+  .f = &g122,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t447_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t447 = {
+  .id = "t447",
+  .name = "",
+  .trigger = t447_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 432,
+  .action = &t447effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s234,
+  .dest = &s231,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t448,
+};
+static struct ufsm_action t447effect = {
+  .id = "t447effect",
+  .name = "a447",
+  .f = &a447,
+  .next = NULL,
+};
+static struct ufsm_trigger t448_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t448 = {
+  .id = "t448",
+  .name = "",
+  .trigger = t448_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 433,
+  .action = &t448effect,
+  .defer = false,
+  .guard = &t448guard,
+  .source = &s234,
+  .dest = &s231,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t448effect = {
+  .id = "t448effect",
+  .name = "a448",
+  .f = &a448,
+  .next = NULL,
+};
+static struct ufsm_guard t448guard = {
+  .id = "t448guard",
+  .name = "g123",
+  .f = &g123,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s234_dispatch_5[] = {
+  &t448,
+  NULL,
+};
+static struct ufsm_transition * s234_dispatch_7[] = {
+  &t447,
+  NULL,
+};
+static struct ufsm_dispatch s234_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s234_dispatch_5,
+},
+{
+  .ev = 7,
+  .transition = s234_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s234_interest[] = {
+  0x000000b7,
+};
+static struct ufsm_state s234 = {
+  .id   = "s234",
+  .name = "S234",
+  .kind = 0,
+  .index = 231,
+  .parent_region = &r46,
+  .entry = &s234entry,
+  .doact = NULL,
+  .exit = &s234exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s234_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s234_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s233,
+};
+static struct ufsm_entry_exit s234entry = {
+  .id = "s234entry",
+  .name = "e234",
+  .f = &e234,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s234exit = {
+  .id = "s234exit",
+  .name = "x234",
+  .f = &x234,
+  .next = NULL,
+};
+static struct ufsm_transition * s233_dispatch_0[] = {
+  &t445,
+  NULL,
+};
+static struct ufsm_transition * s233_dispatch_3[] = {
+  &t446,
+  NULL,
+};
+static struct ufsm_dispatch s233_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s233_dispatch_0,
+},
+{
+  .ev = 3,
+  .transition = s233_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s233_interest[] = {
+  0x0000001f,
+};
+static struct ufsm_state s233 = {
+  .id   = "s233",
+  .name = "S233",
+  .kind = 0,
+  .index = 232,
+  .parent_region = &r46,
+  .entry = &s233entry,
+  .doact = NULL,
+  .exit = &s233exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s233_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s233_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s232,
+};
+static struct ufsm_entry_exit s233entry = {
+  .id = "s233entry",
+  .name = "e233",
+  .f = &e233,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s233exit = {
+  .id = "s233exit",
+  .name = "x233",
+  .f = &x233,
+  .next = NULL,
+};
+static struct ufsm_transition * s232_dispatch_2[] = {
+  &t444,
+  NULL,
+};
+static struct ufsm_transition * s232_dispatch_7[] = {
+  &t443,
+  NULL,
+};
+static struct ufsm_dispatch s232_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s232_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s232_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s232_interest[] = {
+  0x00000097,
+};
+static struct ufsm_state s232 = {
+  .id   = "s232",
+  .name = "S232",
+  .kind = 0,
+  .index = 233,
+  .parent_region = &r46,
+  .entry = &s232entry,
+  .doact = NULL,
+  .exit = &s232exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s232_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s232_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s231,
+};
+static struct ufsm_entry_exit s232entry = {
+  .id = "s232entry",
+  .name = "e232",
+  .f = &e232,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s232exit = {
+  .id = "s232exit",
+  .name = "x232",
+  .f = &x232,
+  .next = NULL,
+};
+static struct ufsm_transition * s231_dispatch_0[] = {
+  &t441,
+  NULL,
+};
+static struct ufsm_transition * s231_dispatch_2[] = {
+  &t442,
+  NULL,
+};
+static struct ufsm_dispatch s231_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s231_dispatch_0,
+},
+{
+  .ev = 2,
+  .transition = s231_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s231_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s231 = {
+  .id   = "s231",
+  .name = "S231",
+  .kind = 0,
+  .index = 234,
+  .parent_region = &r46,
+  .entry = &s231entry,
+  .doact = NULL,
+  .exit = &s231exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s231_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s231_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s230,
+};
+static struct ufsm_entry_exit s231entry = {
+  .id = "s231entry",
+  .name = "e231",
+  .f = &e231,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s231exit = {
+  .id = "s231exit",
+  .name = "x231",
+  .f = &x231,
+  .next = NULL,
+};
+static struct ufsm_dispatch s230_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s230_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s230 = {
+  .id   = "s230",
+  .name = "Init",
+  .kind = 1,
+  .index = 235,
+  .parent_region = &r46,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s230_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s230_interest,
+  .time_events = NULL,
+  .completion = &t46,
+  .next = NULL,
+};
+static struct ufsm_region r45 = {
+  .id = "r45",
+  .name = "R45",
+  .state = &s229,
+  .has_history = false,
+  .history = NULL,
+  .index = 44,
+  .transition = &t45,
+  .parent_state = &s28,
+  .next = NULL,
+};
+static struct ufsm_transition t45 = {
+  .id = "t45",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 434,
+  .action = &t45effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s225,
+  .dest = &s226,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t433,
+};
+static struct ufsm_action t45effect = {
+  .id = "t45effect",
+  .name = "a45",
+  .f = &a45,
+  .next = NULL,
+};
+static struct ufsm_trigger t433_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t433 = {
+  .id = "t433",
+  .name = "",
+  .trigger = t433_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 435,
+  .action = &t433effect,
+  .defer = false,
+  .guard = &t433guard,
+  .source = &s226,
+  .dest = &s228,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t434,
+};
+static struct ufsm_action t433effect = {
+  .id = "t433effect",
+  .name = "a433",
+  .f = &a433,
+  .next = NULL,
+};
+static struct ufsm_guard t433guard = {
+  .id = "t433guard",
+  .name = "g117",
+  .f = &g117,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t434_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t434 = {
+  .id = "t434",
+  .name = "",
+  .trigger = t434_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 436,
+  .action = &t434effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s226,
+  .dest = &s227,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t435,
+};
+static struct ufsm_action t434effect = {
+  .id = "t434effect",
+  .name = "a434",
+  .f = &a434,
+  .next = NULL,
+};
+static struct ufsm_trigger t435_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t435 = {
+  .id = "t435",
+  .name = "",
+  .trigger = t435_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 437,
+  .action = &t435effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s227,
+  .dest = &s226,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t436,
+};
+static struct ufsm_action t435effect = {
+  .id = "t435effect",
+  .name = "a435",
+  .f = &a435,
+  .next = NULL,
+};
+static struct ufsm_trigger t436_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t436_exit_path[] = {
+  &r45,
+  NULL,
+};
+static struct ufsm_region * t436_enter_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_transition t436 = {
+  .id = "t436",
+  .name = "",
+  .trigger = t436_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 438,
+  .action = &t436effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s227,
+  .dest = &s29,
+  .lca = &r5,
+  .exit_path = t436_exit_path,
+  .enter_path = t436_enter_path,
+  .next = &t437,
+};
+static struct ufsm_action t436effect = {
+  .id = "t436effect",
+  .name = "a436",
+  .f = &a436,
+  .next = NULL,
+};
+static struct ufsm_trigger t437_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t437 = {
+  .id = "t437",
+  .name = "",
+  .trigger = t437_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 439,
+  .action = &t437effect,
+  .defer = false,
+  .guard = &t437guard,
+  .source = &s228,
+  .dest = &s228,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t438,
+};
+static struct ufsm_action t437effect = {
+  .id = "t437effect",
+  .name = "a437",
+  .f = &a437,
+  .next = NULL,
+};
+static struct ufsm_guard t437guard = {
+  .id = "t437guard",
+  .name = "g118",
+  .f = &g118,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t438_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t438 = {
+  .id = "t438",
+  .name = "",
+  .trigger = t438_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 440,
+  .action = &t438effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s228,
+  .dest = &s226,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t439,
+};
+static struct ufsm_action t438effect = {
+  .id = "t438effect",
+  .name = "a438",
+  .f = &a438,
+  .next = NULL,
+};
+static struct ufsm_trigger t439_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t439 = {
+  .id = "t439",
+  .name = "",
+  .trigger = t439_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 441,
+  .action = &t439effect,
+  .defer = false,
+  .guard = &t439guard,
+  .source = &s229,
+  .dest = &s229,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t440,
+};
+static struct ufsm_action t439effect = {
+  .id = "t439effect",
+  .name = "a439",
+  .f = &a439,
+  .next = NULL,
+};
+static struct ufsm_guard t439guard = {
+  .id = "t439guard",
+  .name = "g119",
+  .f = &g119,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t440_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t440 = {
+  .id = "t440",
+  .name = "",
+  .trigger = t440_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 442,
+  .action = &t440effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s229,
+  .dest = &s226,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t440effect = {
+  .id = "t440effect",
+  .name = "a440",
+  .f = &a440,
+  .next = NULL,
+};
+static struct ufsm_transition * s229_dispatch_2[] = {
+  &t439,
+  NULL,
+};
+static struct ufsm_transition * s229_dispatch_7[] = {
+  &t440,
+  NULL,
+};
+static struct ufsm_dispatch s229_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s229_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s229_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s229_interest[] = {
+  0x00000097,
+};
+static struct ufsm_state s229 = {
+  .id   = "s229",
+  .name = "S229",
+  .kind = 0,
+  .index = 236,
+  .parent_region = &r45,
+  .entry = &s229entry,
+  .doact = NULL,
+  .exit = &s229exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s229_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s229_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s228,
+};
+static struct ufsm_entry_exit s229entry = {
+  .id = "s229entry",
+  .name = "e229",
+  .f = &e229,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s229exit = {
+  .id = "s229exit",
+  .name = "x229",
+  .f = &x229,
+  .next = NULL,
+};
+static struct ufsm_transition * s228_dispatch_0[] = {
+  &t437,
+  NULL,
+};
+static struct ufsm_transition * s228_dispatch_1[] = {
+  &t438,
+  NULL,
+};
+static struct ufsm_dispatch s228_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s228_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = s228_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s228_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s228 = {
+  .id   = "s228",
+  .name = "S228",
+  .kind = 0,
+  .index = 237,
+  .parent_region = &r45,
+  .entry = &s228entry,
+  .doact = NULL,
+  .exit = &s228exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s228_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s228_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s227,
+};
+static struct ufsm_entry_exit s228entry = {
+  .id = "s228entry",
+  .name = "e228",
+  .f = &e228,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s228exit = {
+  .id = "s228exit",
+  .name = "x228",
+  .f = &x228,
+  .next = NULL,
+};
+static struct ufsm_transition * s227_dispatch_0[] = {
+  &t436,
+  NULL,
+};
+static struct ufsm_transition * s227_dispatch_7[] = {
+  &t435,
+  NULL,
+};
+static struct ufsm_dispatch s227_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s227_dispatch_0,
+},
+{
+  .ev = 7,
+  .transition = s227_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s227_interest[] = {
+  0x00000097,
+};
+static struct ufsm_state s227 = {
+  .id   = "s227",
+  .name = "S227",
+  .kind = 0,
+  .index = 238,
+  .parent_region = &r45,
+  .entry = &s227entry,
+  .doact = NULL,
+  .exit = &s227exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s227_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s227_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s226,
+};
+static struct ufsm_entry_exit s227entry = {
+  .id = "s227entry",
+  .name = "e227",
+  .f = &e227,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s227exit = {
+  .id = "s227exit",
+  .name = "x227",
+  .f = &x227,
+  .next = NULL,
+};
+static struct ufsm_transition * s226_dispatch_3[] = {
+  &t433,
+  NULL,
+};
+static struct ufsm_transition * s226_dispatch_6[] = {
+  &t434,
+  NULL,
+};
+static struct ufsm_dispatch s226_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s226_dispatch_3,
+},
+{
+  .ev = 6,
+  .transition = s226_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s226_interest[] = {
+  0x0000005f,
+};
+static struct ufsm_state s226 = {
+  .id   = "s226",
+  .name = "S226",
+  .kind = 0,
+  .index = 239,
+  .parent_region = &r45,
+  .entry = &s226entry,
+  .doact = NULL,
+  .exit = &s226exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s226_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s226_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s225,
+};
+static struct ufsm_entry_exit s226entry = {
+  .id = "s226entry",
+  .name = "e226",
+  .f = &e226,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s226exit = {
+  .id = "s226exit",
+  .name = "x226",
+  .f = &x226,
+  .next = NULL,
+};
+static struct ufsm_dispatch s225_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s225_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s225 = {
+  .id   = "s225",
+  .name = "Init",
+  .kind = 1,
+  .index = 240,
+  .parent_region = &r45,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s225_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s225_interest,
+  .time_events = NULL,
+  .completion = &t45,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s28entry = {
+  .id = "s28entry",
+  .name = "e28",
+  .f = &e28,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s28exit = {
+  .id = "s28exit",
+  .name = "x28",
+  .f = &x28,
+  .next = NULL,
+};
+static struct ufsm_transition * s27_dispatch_0[] = {
+  &t116,
+  NULL,
+};
+static struct ufsm_transition * s27_dispatch_4[] = {
+  &t115,
+  NULL,
+};
+static struct ufsm_dispatch s27_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s27_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s27_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s27_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s27 = {
+  .id   = "s27",
+  .name = "S27",
+  .kind = 0,
+  .index = 207,
+  .parent_region = &r5,
+  .entry = &s27entry,
+  .doact = NULL,
+  .exit = &s27exit,
+  .region = &r44,
+  .submachine = NULL,
+  .dispatch = s27_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s27_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s26,
+};
+static struct ufsm_region r44 = {
+  .id = "r44",
+  .name = "R44",
+  .state = &s224,
+  .has_history = false,
+  .history = NULL,
+  .index = 41,
+  .transition = &t44,
+  .parent_state = &s27,
+  .next = &r43,
+};
+static struct ufsm_transition t44 = {
+  .id = "t44",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 407,
+  .action = &t44effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s220,
+  .dest = &s224,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t425,
+};
+static struct ufsm_action t44effect = {
+  .id = "t44effect",
+  .name = "a44",
+  .f = &a44,
+  .next = NULL,
+};
+static struct ufsm_trigger t425_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t425_exit_path[] = {
+  &r44,
+  NULL,
+};
+static struct ufsm_region * t425_enter_path[] = {
+  &r46,
+  NULL,
+};
+static struct ufsm_transition t425 = {
+  .id = "t425",
+  .name = "",
+  .trigger = t425_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 408,
+  .action = &t425effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s221,
+  .dest = &s232,
+  .lca = &r5,
+  .exit_path = t425_exit_path,
+  .enter_path = t425_enter_path,
+  .next = &t426,
+};
+static struct ufsm_action t425effect = {
+  .id = "t425effect",
+  .name = "a425",
+  .f = &a425,
+  .next = NULL,
+};
+static struct ufsm_trigger t426_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t426_exit_path[] = {
+  &r44,
+  &r5,
+  NULL,
+};
+static struct ufsm_region * t426_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t426 = {
+  .id = "t426",
+  .name = "",
+  .trigger = t426_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 409,
+  .action = &t426effect,
+  .defer = false,
+  .guard = &t426guard,
+  .source = &s221,
+  .dest = &s24,
+  .lca = &r0,
+  .exit_path = t426_exit_path,
+  .enter_path = t426_enter_path,
+  .next = &t427,
+};
+static struct ufsm_action t426effect = {
+  .id = "t426effect",
+  .name = "a426",
+  .f = &a426,
+  .next = NULL,
+};
+static struct ufsm_guard t426guard = {
+  .id = "t426guard",
+  .name = "g114",
+  .f = &g114,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t427_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t427 = {
+  .id = "t427",
+  .name = "",
+  .trigger = t427_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 410,
+  .action = &t427effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s222,
+  .dest = &s224,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t428,
+};
+static struct ufsm_action t427effect = {
+  .id = "t427effect",
+  .name = "a427",
+  .f = &a427,
+  .next = NULL,
+};
+static struct ufsm_trigger t428_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t428 = {
+  .id = "t428",
+  .name = "",
+  .trigger = t428_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 411,
+  .action = &t428effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s222,
+  .dest = &s221,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t429,
+};
+static struct ufsm_action t428effect = {
+  .id = "t428effect",
+  .name = "a428",
+  .f = &a428,
+  .next = NULL,
+};
+static struct ufsm_trigger t429_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t429 = {
+  .id = "t429",
+  .name = "",
+  .trigger = t429_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 412,
+  .action = &t429effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s223,
+  .dest = &s222,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t430,
+};
+static struct ufsm_action t429effect = {
+  .id = "t429effect",
+  .name = "a429",
+  .f = &a429,
+  .next = NULL,
+};
+static struct ufsm_trigger t430_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t430 = {
+  .id = "t430",
+  .name = "",
+  .trigger = t430_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 413,
+  .action = &t430effect,
+  .defer = false,
+  .guard = &t430guard,
+  .source = &s223,
+  .dest = &s224,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t431,
+};
+static struct ufsm_action t430effect = {
+  .id = "t430effect",
+  .name = "a430",
+  .f = &a430,
+  .next = NULL,
+};
+static struct ufsm_guard t430guard = {
+  .id = "t430guard",
+  .name = "g115",
+  .f = &g115,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t431_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t431 = {
+  .id = "t431",
+  .name = "",
+  .trigger = t431_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 414,
+  .action = &t431effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s224,
+  .dest = &s224,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t432,
+};
+static struct ufsm_action t431effect = {
+  .id = "t431effect",
+  .name = "a431",
+  .f = &a431,
+  .next = NULL,
+};
+static struct ufsm_trigger t432_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t432_exit_path[] = {
+  &r44,
+  NULL,
+};
+static struct ufsm_region * t432_enter_path[] = {
+  &r47,
+  NULL,
+};
+static struct ufsm_transition t432 = {
+  .id = "t432",
+  .name = "",
+  .trigger = t432_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 415,
+  .action = &t432effect,
+  .defer = false,
+  .guard = &t432guard,
+  .source = &s224,
+  .dest = &s238,
+  .lca = &r5,
+  .exit_path = t432_exit_path,
+  .enter_path = t432_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t432effect = {
+  .id = "t432effect",
+  .name = "a432",
+  .f = &a432,
+  .next = NULL,
+};
+static struct ufsm_guard t432guard = {
+  .id = "t432guard",
+  .name = "g116",
+  .f = &g116,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s224_dispatch_0[] = {
+  &t432,
+  NULL,
+};
+static struct ufsm_transition * s224_dispatch_6[] = {
+  &t431,
+  NULL,
+};
+static struct ufsm_dispatch s224_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s224_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s224_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s224_interest[] = {
+  0x00000057,
+};
+static struct ufsm_state s224 = {
+  .id   = "s224",
+  .name = "S224",
+  .kind = 0,
+  .index = 221,
+  .parent_region = &r44,
+  .entry = &s224entry,
+  .doact = NULL,
+  .exit = &s224exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s224_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s224_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s223,
+};
+static struct ufsm_entry_exit s224entry = {
+  .id = "s224entry",
+  .name = "e224",
+  .f = &e224,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s224exit = {
+  .id = "s224exit",
+  .name = "x224",
+  .f = &x224,
+  .next = NULL,
+};
+static struct ufsm_transition * s223_dispatch_4[] = {
+  &t430,
+  NULL,
+};
+static struct ufsm_transition * s223_dispatch_6[] = {
+  &t429,
+  NULL,
+};
+static struct ufsm_dispatch s223_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s223_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s223_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s223_interest[] = {
+  0x00000057,
+};
+static struct ufsm_state s223 = {
+  .id   = "s223",
+  .name = "S223",
+  .kind = 0,
+  .index = 222,
+  .parent_region = &r44,
+  .entry = &s223entry,
+  .doact = NULL,
+  .exit = &s223exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s223_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s223_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s222,
+};
+static struct ufsm_entry_exit s223entry = {
+  .id = "s223entry",
+  .name = "e223",
+  .f = &e223,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s223exit = {
+  .id = "s223exit",
+  .name = "x223",
+  .f = &x223,
+  .next = NULL,
+};
+static struct ufsm_transition * s222_dispatch_2[] = {
+  &t427,
+  NULL,
+};
+static struct ufsm_transition * s222_dispatch_5[] = {
+  &t428,
+  NULL,
+};
+static struct ufsm_dispatch s222_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s222_dispatch_2,
+},
+{
+  .ev = 5,
+  .transition = s222_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s222_interest[] = {
+  0x00000037,
+};
+static struct ufsm_state s222 = {
+  .id   = "s222",
+  .name = "S222",
+  .kind = 0,
+  .index = 223,
+  .parent_region = &r44,
+  .entry = &s222entry,
+  .doact = NULL,
+  .exit = &s222exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s222_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s222_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s221,
+};
+static struct ufsm_entry_exit s222entry = {
+  .id = "s222entry",
+  .name = "e222",
+  .f = &e222,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s222exit = {
+  .id = "s222exit",
+  .name = "x222",
+  .f = &x222,
+  .next = NULL,
+};
+static struct ufsm_transition * s221_dispatch_1[] = {
+  &t426,
+  NULL,
+};
+static struct ufsm_transition * s221_dispatch_3[] = {
+  &t425,
+  NULL,
+};
+static struct ufsm_dispatch s221_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s221_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s221_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s221_interest[] = {
+  0x0000001f,
+};
+static struct ufsm_state s221 = {
+  .id   = "s221",
+  .name = "S221",
+  .kind = 0,
+  .index = 224,
+  .parent_region = &r44,
+  .entry = &s221entry,
+  .doact = NULL,
+  .exit = &s221exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s221_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s221_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s220,
+};
+static struct ufsm_entry_exit s221entry = {
+  .id = "s221entry",
+  .name = "e221",
+  .f = &e221,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s221exit = {
+  .id = "s221exit",
+  .name = "x221",
+  .f = &x221,
+  .next = NULL,
+};
+static struct ufsm_dispatch s220_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s220_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s220 = {
+  .id   = "s220",
+  .name = "Init",
+  .kind = 1,
+  .index = 225,
+  .parent_region = &r44,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s220_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s220_interest,
+  .time_events = NULL,
+  .completion = &t44,
+  .next = NULL,
+};
+static struct ufsm_region r43 = {
+  .id = "r43",
+  .name = "R43",
+  .state = &s219,
+  .has_history = false,
+  .history = NULL,
+  .index = 42,
+  .transition = &t43,
+  .parent_state = &s27,
+  .next = NULL,
+};
+static struct ufsm_transition t43 = {
+  .id = "t43",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 416,
+  .action = &t43effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s215,
+  .dest = &s218,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t417,
+};
+static struct ufsm_action t43effect = {
+  .id = "t43effect",
+  .name = "a43",
+  .f = &a43,
+  .next = NULL,
+};
+static struct ufsm_trigger t417_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t417 = {
+  .id = "t417",
+  .name = "",
+  .trigger = t417_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 417,
+  .action = &t417effect,
+  .defer = false,
+  .guard = &t417guard,
+  .source = &s216,
+  .dest = &s218,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t418,
+};
+static struct ufsm_action t417effect = {
+  .id = "t417effect",
+  .name = "a417",
+  .f = &a417,
+  .next = NULL,
+};
+static struct ufsm_guard t417guard = {
+  .id = "t417guard",
+  .name = "g109",
+  .f = &g109,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t418_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t418 = {
+  .id = "t418",
+  .name = "",
+  .trigger = t418_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 418,
+  .action = &t418effect,
+  .defer = false,
+  .guard = &t418guard,
+  .source = &s216,
+  .dest = &s218,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t419,
+};
+static struct ufsm_action t418effect = {
+  .id = "t418effect",
+  .name = "a418",
+  .f = &a418,
+  .next = NULL,
+};
+static struct ufsm_guard t418guard = {
+  .id = "t418guard",
+  .name = "g110",
+  .f = &g110,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t419_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t419 = {
+  .id = "t419",
+  .name = "",
+  .trigger = t419_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 419,
+  .action = &t419effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s217,
+  .dest = &s216,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t420,
+};
+static struct ufsm_action t419effect = {
+  .id = "t419effect",
+  .name = "a419",
+  .f = &a419,
+  .next = NULL,
+};
+static struct ufsm_trigger t420_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t420 = {
+  .id = "t420",
+  .name = "",
+  .trigger = t420_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 420,
+  .action = &t420effect,
+  .defer = false,
+  .guard = &t420guard,
+  .source = &s217,
+  .dest = &s216,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t421,
+};
+static struct ufsm_action t420effect = {
+  .id = "t420effect",
+  .name = "a420",
+  .f = &a420,
+  .next = NULL,
+};
+static struct ufsm_guard t420guard = {
+  .id = "t420guard",
+  .name = "g111",
+  .f = &g111,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t421_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t421 = {
+  .id = "t421",
+  .name = "",
+  .trigger = t421_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 421,
+  .action = &t421effect,
+  .defer = false,
+  .guard = &t421guard,
+  .source = &s218,
+  .dest = &s216,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t422,
+};
+static struct ufsm_action t421effect = {
+  .id = "t421effect",
+  .name = "a421",
+  .f = &a421,
+  .next = NULL,
+};
+static struct ufsm_guard t421guard = {
+  .id = "t421guard",
+  .name = "g112",
+  .f = &g112,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t422_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t422 = {
+  .id = "t422",
+  .name = "",
+  .trigger = t422_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 422,
+  .action = &t422effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s218,
+  .dest = &s218,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t423,
+};
+static struct ufsm_action t422effect = {
+  .id = "t422effect",
+  .name = "a422",
+  .f = &a422,
+  .next = NULL,
+};
+static struct ufsm_trigger t423_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t423 = {
+  .id = "t423",
+  .name = "",
+  .trigger = t423_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 423,
+  .action = &t423effect,
+  .defer = false,
+  .guard = &t423guard,
+  .source = &s219,
+  .dest = &s219,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t424,
+};
+static struct ufsm_action t423effect = {
+  .id = "t423effect",
+  .name = "a423",
+  .f = &a423,
+  .next = NULL,
+};
+static struct ufsm_guard t423guard = {
+  .id = "t423guard",
+  .name = "g113",
+  .f = &g113,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t424_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t424 = {
+  .id = "t424",
+  .name = "",
+  .trigger = t424_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 424,
+  .action = &t424effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s219,
+  .dest = &s216,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t424effect = {
+  .id = "t424effect",
+  .name = "a424",
+  .f = &a424,
+  .next = NULL,
+};
+static struct ufsm_transition * s219_dispatch_4[] = {
+  &t424,
+  NULL,
+};
+static struct ufsm_transition * s219_dispatch_6[] = {
+  &t423,
+  NULL,
+};
+static struct ufsm_dispatch s219_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s219_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s219_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s219_interest[] = {
+  0x00000057,
+};
+static struct ufsm_state s219 = {
+  .id   = "s219",
+  .name = "S219",
+  .kind = 0,
+  .index = 226,
+  .parent_region = &r43,
+  .entry = &s219entry,
+  .doact = NULL,
+  .exit = &s219exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s219_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s219_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s218,
+};
+static struct ufsm_entry_exit s219entry = {
+  .id = "s219entry",
+  .name = "e219",
+  .f = &e219,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s219exit = {
+  .id = "s219exit",
+  .name = "x219",
+  .f = &x219,
+  .next = NULL,
+};
+static struct ufsm_transition * s218_dispatch_3[] = {
+  &t421,
+  NULL,
+};
+static struct ufsm_transition * s218_dispatch_5[] = {
+  &t422,
+  NULL,
+};
+static struct ufsm_dispatch s218_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s218_dispatch_3,
+},
+{
+  .ev = 5,
+  .transition = s218_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s218_interest[] = {
+  0x0000003f,
+};
+static struct ufsm_state s218 = {
+  .id   = "s218",
+  .name = "S218",
+  .kind = 0,
+  .index = 227,
+  .parent_region = &r43,
+  .entry = &s218entry,
+  .doact = NULL,
+  .exit = &s218exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s218_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s218_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s217,
+};
+static struct ufsm_entry_exit s218entry = {
+  .id = "s218entry",
+  .name = "e218",
+  .f = &e218,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s218exit = {
+  .id = "s218exit",
+  .name = "x218",
+  .f = &x218,
+  .next = NULL,
+};
+static struct ufsm_transition * s217_dispatch_3[] = {
+  &t419,
+  NULL,
+};
+static struct ufsm_transition * s217_dispatch_6[] = {
+  &t420,
+  NULL,
+};
+static struct ufsm_dispatch s217_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s217_dispatch_3,
+},
+{
+  .ev = 6,
+  .transition = s217_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s217_interest[] = {
+  0x0000005f,
+};
+static struct ufsm_state s217 = {
+  .id   = "s217",
+  .name = "S217",
+  .kind = 0,
+  .index = 228,
+  .parent_region = &r43,
+  .entry = &s217entry,
+  .doact = NULL,
+  .exit = &s217exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s217_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s217_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s216,
+};
+static struct ufsm_entry_exit s217entry = {
+  .id = "s217entry",
+  .name = "e217",
+  .f = &e217,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s217exit = {
+  .id = "s217exit",
+  .name = "x217",
+  .f = &x217,
+  .next = NULL,
+};
+static struct ufsm_transition * s216_dispatch_1[] = {
+  &t418,
+  NULL,
+};
+static struct ufsm_transition * s216_dispatch_4[] = {
+  &t417,
+  NULL,
+};
+static struct ufsm_dispatch s216_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s216_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s216_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s216_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s216 = {
+  .id   = "s216",
+  .name = "S216",
+  .kind = 0,
+  .index = 229,
+  .parent_region = &r43,
+  .entry = &s216entry,
+  .doact = NULL,
+  .exit = &s216exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s216_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s216_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s215,
+};
+static struct ufsm_entry_exit s216entry = {
+  .id = "s216entry",
+  .name = "e216",
+  .f = &e216,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s216exit = {
+  .id = "s216exit",
+  .name = "x216",
+  .f = &x216,
+  .next = NULL,
+};
+static struct ufsm_dispatch s215_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s215_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s215 = {
+  .id   = "s215",
+  .name = "Init",
+  .kind = 1,
+  .index = 230,
+  .parent_region = &r43,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s215_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s215_interest,
+  .time_events = NULL,
+  .completion = &t43,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s27entry = {
+  .id = "s27entry",
+  .name = "e27",
+  .f = &e27,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s27exit = {
+  .id = "s27exit",
+  .name = "x27",
+  .f = &x27,
+  .next = NULL,
+};
+static struct ufsm_transition * s26_dispatch_4[] = {
+  &t113,
+  NULL,
+};
+static struct ufsm_transition * s26_dispatch_5[] = {
+  &t114,
+  NULL,
+};
+static struct ufsm_dispatch s26_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s26_dispatch_4,
+},
+{
+  .ev = 5,
+  .transition = s26_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s26_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s26 = {
+  .id   = "s26",
+  .name = "S26",
+  .kind = 0,
+  .index = 208,
+  .parent_region = &r5,
+  .entry = &s26entry,
+  .doact = NULL,
+  .exit = &s26exit,
+  .region = &r42,
+  .submachine = NULL,
+  .dispatch = s26_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s26_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s25,
+};
+static struct ufsm_region r42 = {
+  .id = "r42",
+  .name = "R42",
+  .state = &s214,
+  .has_history = false,
+  .history = NULL,
+  .index = 39,
+  .transition = &t42,
+  .parent_state = &s26,
+  .next = &r41,
+};
+static struct ufsm_transition t42 = {
+  .id = "t42",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 388,
+  .action = &t42effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s210,
+  .dest = &s211,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t409,
+};
+static struct ufsm_action t42effect = {
+  .id = "t42effect",
+  .name = "a42",
+  .f = &a42,
+  .next = NULL,
+};
+static struct ufsm_trigger t409_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t409 = {
+  .id = "t409",
+  .name = "",
+  .trigger = t409_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 389,
+  .action = &t409effect,
+  .defer = false,
+  .guard = &t409guard,
+  .source = &s211,
+  .dest = &s213,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t410,
+};
+static struct ufsm_action t409effect = {
+  .id = "t409effect",
+  .name = "a409",
+  .f = &a409,
+  .next = NULL,
+};
+static struct ufsm_guard t409guard = {
+  .id = "t409guard",
+  .name = "g107",
+  .f = &g107,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t410_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t410 = {
+  .id = "t410",
+  .name = "",
+  .trigger = t410_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 390,
+  .action = &t410effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s211,
+  .dest = &s211,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t411,
+};
+static struct ufsm_action t410effect = {
+  .id = "t410effect",
+  .name = "a410",
+  .f = &a410,
+  .next = NULL,
+};
+static struct ufsm_trigger t411_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t411 = {
+  .id = "t411",
+  .name = "",
+  .trigger = t411_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 391,
+  .action = &t411effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s212,
+  .dest = &s214,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t412,
+};
+static struct ufsm_action t411effect = {
+  .id = "t411effect",
+  .name = "a411",
+  .f = &a411,
+  .next = NULL,
+};
+static struct ufsm_trigger t412_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t412 = {
+  .id = "t412",
+  .name = "",
+  .trigger = t412_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 392,
+  .action = &t412effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s212,
+  .dest = &s212,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t413,
+};
+static struct ufsm_action t412effect = {
+  .id = "t412effect",
+  .name = "a412",
+  .f = &a412,
+  .next = NULL,
+};
+static struct ufsm_trigger t413_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t413 = {
+  .id = "t413",
+  .name = "",
+  .trigger = t413_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 393,
+  .action = &t413effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s213,
+  .dest = &s211,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t414,
+};
+static struct ufsm_action t413effect = {
+  .id = "t413effect",
+  .name = "a413",
+  .f = &a413,
+  .next = NULL,
+};
+static struct ufsm_trigger t414_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t414 = {
+  .id = "t414",
+  .name = "",
+  .trigger = t414_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 394,
+  .action = &t414effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s213,
+  .dest = &s213,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t415,
+};
+static struct ufsm_action t414effect = {
+  .id = "t414effect",
+  .name = "a414",
+  .f = &a414,
+  .next = NULL,
+};
+static struct ufsm_trigger t415_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t415 = {
+  .id = "t415",
+  .name = "",
+  .trigger = t415_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 395,
+  .action = &t415effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s214,
+  .dest = &s214,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t416,
+};
+static struct ufsm_action t415effect = {
+  .id = "t415effect",
+  .name = "a415",
+  .f = &a415,
+  .next = NULL,
+};
+static struct ufsm_trigger t416_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t416_exit_path[] = {
+  &r42,
+  NULL,
+};
+static struct ufsm_region * t416_enter_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_transition t416 = {
+  .id = "t416",
+  .name = "",
+  .trigger = t416_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 396,
+  .action = &t416effect,
+  .defer = false,
+  .guard = &t416guard,
+  .source = &s214,
+  .dest = &s29,
+  .lca = &r5,
+  .exit_path = t416_exit_path,
+  .enter_path = t416_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t416effect = {
+  .id = "t416effect",
+  .name = "a416",
+  .f = &a416,
+  .next = NULL,
+};
+static struct ufsm_guard t416guard = {
+  .id = "t416guard",
+  .name = "g108",
+  .f = &g108,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s214_dispatch_1[] = {
+  &t416,
+  NULL,
+};
+static struct ufsm_transition * s214_dispatch_2[] = {
+  &t415,
+  NULL,
+};
+static struct ufsm_dispatch s214_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s214_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = s214_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s214_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s214 = {
+  .id   = "s214",
+  .name = "S214",
+  .kind = 0,
+  .index = 210,
+  .parent_region = &r42,
+  .entry = &s214entry,
+  .doact = NULL,
+  .exit = &s214exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s214_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s214_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s213,
+};
+static struct ufsm_entry_exit s214entry = {
+  .id = "s214entry",
+  .name = "e214",
+  .f = &e214,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s214exit = {
+  .id = "s214exit",
+  .name = "x214",
+  .f = &x214,
+  .next = NULL,
+};
+static struct ufsm_transition * s213_dispatch_3[] = {
+  &t413,
+  NULL,
+};
+static struct ufsm_transition * s213_dispatch_6[] = {
+  &t414,
+  NULL,
+};
+static struct ufsm_dispatch s213_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s213_dispatch_3,
+},
+{
+  .ev = 6,
+  .transition = s213_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s213_interest[] = {
+  0x0000007e,
+};
+static struct ufsm_state s213 = {
+  .id   = "s213",
+  .name = "S213",
+  .kind = 0,
+  .index = 211,
+  .parent_region = &r42,
+  .entry = &s213entry,
+  .doact = NULL,
+  .exit = &s213exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s213_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s213_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s212,
+};
+static struct ufsm_entry_exit s213entry = {
+  .id = "s213entry",
+  .name = "e213",
+  .f = &e213,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s213exit = {
+  .id = "s213exit",
+  .name = "x213",
+  .f = &x213,
+  .next = NULL,
+};
+static struct ufsm_transition * s212_dispatch_0[] = {
+  &t411,
+  NULL,
+};
+static struct ufsm_transition * s212_dispatch_5[] = {
+  &t412,
+  NULL,
+};
+static struct ufsm_dispatch s212_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s212_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s212_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s212_interest[] = {
+  0x00000037,
+};
+static struct ufsm_state s212 = {
+  .id   = "s212",
+  .name = "S212",
+  .kind = 0,
+  .index = 212,
+  .parent_region = &r42,
+  .entry = &s212entry,
+  .doact = NULL,
+  .exit = &s212exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s212_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s212_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s211,
+};
+static struct ufsm_entry_exit s212entry = {
+  .id = "s212entry",
+  .name = "e212",
+  .f = &e212,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s212exit = {
+  .id = "s212exit",
+  .name = "x212",
+  .f = &x212,
+  .next = NULL,
+};
+static struct ufsm_transition * s211_dispatch_0[] = {
+  &t410,
+  NULL,
+};
+static struct ufsm_transition * s211_dispatch_7[] = {
+  &t409,
+  NULL,
+};
+static struct ufsm_dispatch s211_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s211_dispatch_0,
+},
+{
+  .ev = 7,
+  .transition = s211_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s211_interest[] = {
+  0x000000b7,
+};
+static struct ufsm_state s211 = {
+  .id   = "s211",
+  .name = "S211",
+  .kind = 0,
+  .index = 213,
+  .parent_region = &r42,
+  .entry = &s211entry,
+  .doact = NULL,
+  .exit = &s211exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s211_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s211_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s210,
+};
+static struct ufsm_entry_exit s211entry = {
+  .id = "s211entry",
+  .name = "e211",
+  .f = &e211,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s211exit = {
+  .id = "s211exit",
+  .name = "x211",
+  .f = &x211,
+  .next = NULL,
+};
+static struct ufsm_dispatch s210_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s210_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s210 = {
+  .id   = "s210",
+  .name = "Init",
+  .kind = 1,
+  .index = 214,
+  .parent_region = &r42,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s210_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s210_interest,
+  .time_events = NULL,
+  .completion = &t42,
+  .next = NULL,
+};
+static struct ufsm_region r41 = {
+  .id = "r41",
+  .name = "R41",
+  .state = &s209,
+  .has_history = true,
+  .history = NULL,
+  .index = 40,
+  .transition = &t41,
+  .parent_state = &s26,
+  .next = NULL,
+};
+static struct ufsm_transition t41 = {
+  .id = "t41",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 397,
+  .action = &t41effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s205,
+  .dest = &s209,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t401,
+};
+static struct ufsm_action t41effect = {
+  .id = "t41effect",
+  .name = "a41",
+  .f = &a41,
+  .next = NULL,
+};
+static struct ufsm_trigger t401_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t401 = {
+  .id = "t401",
+  .name = "",
+  .trigger = t401_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 398,
+  .action = &t401effect,
+  .defer = false,
+  .guard = &t401guard,
+  .source = &s206,
+  .dest = &s206,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t402,
+};
+static struct ufsm_action t401effect = {
+  .id = "t401effect",
+  .name = "a401",
+  .f = &a401,
+  .next = NULL,
+};
+static struct ufsm_guard t401guard = {
+  .id = "t401guard",
+  .name = "g103",
+  .f = &g103,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t402_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t402 = {
+  .id = "t402",
+  .name = "",
+  .trigger = t402_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 399,
+  .action = &t402effect,
+  .defer = false,
+  .guard = &t402guard,
+  .source = &s206,
+  .dest = &s206,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t403,
+};
+static struct ufsm_action t402effect = {
+  .id = "t402effect",
+  .name = "a402",
+  .f = &a402,
+  .next = NULL,
+};
+static struct ufsm_guard t402guard = {
+  .id = "t402guard",
+  .name = "g104",
+  .f = &g104,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t403_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t403_exit_path[] = {
+  &r41,
+  NULL,
+};
+static struct ufsm_region * t403_enter_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_transition t403 = {
+  .id = "t403",
+  .name = "",
+  .trigger = t403_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 400,
+  .action = &t403effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s207,
+  .dest = &s26,
+  .lca = &r5,
+  .exit_path = t403_exit_path,
+  .enter_path = t403_enter_path,
+  .next = &t404,
+};
+static struct ufsm_action t403effect = {
+  .id = "t403effect",
+  .name = "a403",
+  .f = &a403,
+  .next = NULL,
+};
+static struct ufsm_trigger t404_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t404 = {
+  .id = "t404",
+  .name = "",
+  .trigger = t404_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 401,
+  .action = &t404effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s207,
+  .dest = &s208,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t405,
+};
+static struct ufsm_action t404effect = {
+  .id = "t404effect",
+  .name = "a404",
+  .f = &a404,
+  .next = NULL,
+};
+static struct ufsm_trigger t405_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t405 = {
+  .id = "t405",
+  .name = "",
+  .trigger = t405_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 402,
+  .action = &t405effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s208,
+  .dest = &s206,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t406,
+};
+static struct ufsm_action t405effect = {
+  .id = "t405effect",
+  .name = "a405",
+  .f = &a405,
+  .next = NULL,
+};
+static struct ufsm_trigger t406_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t406 = {
+  .id = "t406",
+  .name = "",
+  .trigger = t406_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 403,
+  .action = &t406effect,
+  .defer = false,
+  .guard = &t406guard,
+  .source = &s208,
+  .dest = &s208,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t407,
+};
+static struct ufsm_action t406effect = {
+  .id = "t406effect",
+  .name = "a406",
+  .f = &a406,
+  .next = NULL,
+};
+static struct ufsm_guard t406guard = {
+  .id = "t406guard",
+  .name = "g105",
+  .f = &g105,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t407_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t407 = {
+  .id = "t407",
+  .name = "",
+  .trigger = t407_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 404,
+  .action = &t407effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s209,
+  .dest = &s207,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t408,
+};
+static struct ufsm_action t407effect = {
+  .id = "t407effect",
+  .name = "a407",
+  .f = &a407,
+  .next = NULL,
+};
+static struct ufsm_trigger t408_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t408_exit_path[] = {
+  &r41,
+  NULL,
+};
+static struct ufsm_region * t408_enter_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_transition t408 = {
+  .id = "t408",
+  .name = "",
+  .trigger = t408_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 405,
+  .action = &t408effect,
+  .defer = false,
+  .guard = &t408guard,
+  .source = &s209,
+  .dest = &s27,
+  .lca = &r5,
+  .exit_path = t408_exit_path,
+  .enter_path = t408_enter_path,
+  .next = &t705,
+};
+static struct ufsm_action t408effect = {
+  .id = "t408effect",
+  .name = "a408",
+  .f = &a408,
+  .next = NULL,
+};
+static struct ufsm_guard t408guard = {
+  .id = "t408guard",
+  .name = "g106",
+  .f = &g106,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition t705 = {
+  .id = "t705",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 406,
+  .action = &t705effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s383,
+  .dest = &s209,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t705effect = {
+  .id = "t705effect",
+  .name = "a705",
+  .f = &a705,
+  .next = NULL,
+};
+static struct ufsm_transition * s209_dispatch_0[] = {
+  &t407,
+  NULL,
+};
+static struct ufsm_transition * s209_dispatch_2[] = {
+  &t408,
+  NULL,
+};
+static struct ufsm_dispatch s209_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s209_dispatch_0,
+},
+{
+  .ev = 2,
+  .transition = s209_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s209_interest[] = {
+  0x00000037,
+};
+static struct ufsm_state s209 = {
+  .id   = "s209",
+  .name = "S209",
+  .kind = 0,
+  .index = 215,
+  .parent_region = &r41,
+  .entry = &s209entry,
+  .doact = NULL,
+  .exit = &s209exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s209_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s209_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s208,
+};
+static struct ufsm_entry_exit s209entry = {
+  .id = "s209entry",
+  .name = "e209",
+  .f = &e209,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s209exit = {
+  .id = "s209exit",
+  .name = "x209",
+  .f = &x209,
+  .next = NULL,
+};
+static struct ufsm_transition * s208_dispatch_1[] = {
+  &t406,
+  NULL,
+};
+static struct ufsm_transition * s208_dispatch_7[] = {
+  &t405,
+  NULL,
+};
+static struct ufsm_dispatch s208_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s208_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s208_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s208_interest[] = {
+  0x000000b6,
+};
+static struct ufsm_state s208 = {
+  .id   = "s208",
+  .name = "S208",
+  .kind = 0,
+  .index = 216,
+  .parent_region = &r41,
+  .entry = &s208entry,
+  .doact = NULL,
+  .exit = &s208exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s208_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s208_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s207,
+};
+static struct ufsm_entry_exit s208entry = {
+  .id = "s208entry",
+  .name = "e208",
+  .f = &e208,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s208exit = {
+  .id = "s208exit",
+  .name = "x208",
+  .f = &x208,
+  .next = NULL,
+};
+static struct ufsm_transition * s207_dispatch_0[] = {
+  &t403,
+  NULL,
+};
+static struct ufsm_transition * s207_dispatch_4[] = {
+  &t404,
+  NULL,
+};
+static struct ufsm_dispatch s207_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s207_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s207_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s207_interest[] = {
+  0x00000037,
+};
+static struct ufsm_state s207 = {
+  .id   = "s207",
+  .name = "S207",
+  .kind = 0,
+  .index = 217,
+  .parent_region = &r41,
+  .entry = &s207entry,
+  .doact = NULL,
+  .exit = &s207exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s207_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s207_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s206,
+};
+static struct ufsm_entry_exit s207entry = {
+  .id = "s207entry",
+  .name = "e207",
+  .f = &e207,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s207exit = {
+  .id = "s207exit",
+  .name = "x207",
+  .f = &x207,
+  .next = NULL,
+};
+static struct ufsm_transition * s206_dispatch_0[] = {
+  &t401,
+  NULL,
+};
+static struct ufsm_transition * s206_dispatch_6[] = {
+  &t402,
+  NULL,
+};
+static struct ufsm_dispatch s206_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s206_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s206_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s206_interest[] = {
+  0x00000077,
+};
+static struct ufsm_state s206 = {
+  .id   = "s206",
+  .name = "S206",
+  .kind = 0,
+  .index = 218,
+  .parent_region = &r41,
+  .entry = &s206entry,
+  .doact = NULL,
+  .exit = &s206exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s206_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s206_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s383,
+};
+static struct ufsm_entry_exit s206entry = {
+  .id = "s206entry",
+  .name = "e206",
+  .f = &e206,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s206exit = {
+  .id = "s206exit",
+  .name = "x206",
+  .f = &x206,
+  .next = NULL,
+};
+static struct ufsm_dispatch s383_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s383_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s383 = {
+  .id   = "s383",
+  .name = "(null)",
+  .kind = 4,
+  .index = 219,
+  .parent_region = &r41,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s383_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s383_interest,
+  .time_events = NULL,
+  .completion = &t705,
+  .next = &s205,
+};
+static struct ufsm_dispatch s205_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s205_interest[] = {
+  0x00000036,
+};
+static struct ufsm_state s205 = {
+  .id   = "s205",
+  .name = "Init",
+  .kind = 1,
+  .index = 220,
+  .parent_region = &r41,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s205_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s205_interest,
+  .time_events = NULL,
+  .completion = &t41,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s26entry = {
+  .id = "s26entry",
+  .name = "e26",
+  .f = &e26,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s26exit = {
+  .id = "s26exit",
+  .name = "x26",
+  .f = &x26,
+  .next = NULL,
+};
+static struct ufsm_dispatch s25_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s25_interest[] = {
+  0x00000006,
+};
+static struct ufsm_state s25 = {
+  .id   = "s25",
+  .name = "Init",
+  .kind = 1,
+  .index = 209,
+  .parent_region = &r5,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s25_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s25_interest,
+  .time_events = NULL,
+  .completion = &t5,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s3entry = {
+  .id = "s3entry",
+  .name = "e3",
+  .f = &e3,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s3exit = {
+  .id = "s3exit",
+  .name = "x3",
+  .f = &x3,
+  .next = NULL,
+};
+static struct ufsm_transition * s2_dispatch_0[] = {
+  &t76,
+  NULL,
+};
+static struct ufsm_transition * s2_dispatch_3[] = {
+  &t75,
+  &t683,
+  NULL,
+};
+static struct ufsm_dispatch s2_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s2_dispatch_0,
+},
+{
+  .ev = 3,
+  .transition = s2_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s2_interest[] = {
+  0x00000009,
+};
+static struct ufsm_state s2 = {
+  .id   = "s2",
+  .name = "S2",
+  .kind = 0,
+  .index = 3,
+  .parent_region = &r0,
+  .entry = &s2entry,
+  .doact = NULL,
+  .exit = &s2exit,
+  .region = &r4,
+  .submachine = NULL,
+  .dispatch = s2_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s2_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s1,
+};
+static struct ufsm_region r4 = {
+  .id = "r4",
+  .name = "R4",
+  .state = &s24,
+  .has_history = false,
+  .history = NULL,
+  .index = 19,
+  .transition = &t4,
+  .parent_state = &s2,
+  .next = &r3,
+};
+static struct ufsm_transition t4 = {
+  .id = "t4",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 194,
+  .action = &t4effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s20,
+  .dest = &s24,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t105,
+};
+static struct ufsm_action t4effect = {
+  .id = "t4effect",
+  .name = "a4",
+  .f = &a4,
+  .next = NULL,
+};
+static struct ufsm_trigger t105_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t105_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t105_enter_path[] = {
+  &r39,
+  NULL,
+};
+static struct ufsm_transition t105 = {
+  .id = "t105",
+  .name = "",
+  .trigger = t105_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 195,
+  .action = &t105effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s21,
+  .dest = &s198,
+  .lca = &r4,
+  .exit_path = t105_exit_path,
+  .enter_path = t105_enter_path,
+  .next = &t106,
+};
+static struct ufsm_action t105effect = {
+  .id = "t105effect",
+  .name = "a105",
+  .f = &a105,
+  .next = NULL,
+};
+static struct ufsm_trigger t106_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t106_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t106_enter_path[] = {
+  &r39,
+  NULL,
+};
+static struct ufsm_transition t106 = {
+  .id = "t106",
+  .name = "",
+  .trigger = t106_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 196,
+  .action = &t106effect,
+  .defer = false,
+  .guard = &t106guard,
+  .source = &s21,
+  .dest = &s197,
+  .lca = &r4,
+  .exit_path = t106_exit_path,
+  .enter_path = t106_enter_path,
+  .next = &t107,
+};
+static struct ufsm_action t106effect = {
+  .id = "t106effect",
+  .name = "a106",
+  .f = &a106,
+  .next = NULL,
+};
+static struct ufsm_guard t106guard = {
+  .id = "t106guard",
+  .name = "g12",
+  .f = &g12,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t107_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t107 = {
+  .id = "t107",
+  .name = "",
+  .trigger = t107_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 197,
+  .action = &t107effect,
+  .defer = false,
+  .guard = &t107guard,
+  .source = &s22,
+  .dest = &s24,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t108,
+};
+static struct ufsm_action t107effect = {
+  .id = "t107effect",
+  .name = "a107",
+  .f = &a107,
+  .next = NULL,
+};
+static struct ufsm_guard t107guard = {
+  .id = "t107guard",
+  .name = "g13",
+  .f = &g13,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t108_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t108_exit_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_region * t108_enter_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_transition t108 = {
+  .id = "t108",
+  .name = "",
+  .trigger = t108_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 198,
+  .action = &t108effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s22,
+  .dest = &s27,
+  .lca = &r0,
+  .exit_path = t108_exit_path,
+  .enter_path = t108_enter_path,
+  .next = &t109,
+};
+static struct ufsm_action t108effect = {
+  .id = "t108effect",
+  .name = "a108",
+  .f = &a108,
+  .next = NULL,
+};
+static struct ufsm_trigger t109_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t109 = {
+  .id = "t109",
+  .name = "",
+  .trigger = t109_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 199,
+  .action = &t109effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s23,
+  .dest = &s23,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t110,
+};
+static struct ufsm_action t109effect = {
+  .id = "t109effect",
+  .name = "a109",
+  .f = &a109,
+  .next = NULL,
+};
+static struct ufsm_trigger t110_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t110_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t110_enter_path[] = {
+  &r36,
+  NULL,
+};
+static struct ufsm_transition t110 = {
+  .id = "t110",
+  .name = "",
+  .trigger = t110_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 200,
+  .action = &t110effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s23,
+  .dest = &s181,
+  .lca = &r4,
+  .exit_path = t110_exit_path,
+  .enter_path = t110_enter_path,
+  .next = &t111,
+};
+static struct ufsm_action t110effect = {
+  .id = "t110effect",
+  .name = "a110",
+  .f = &a110,
+  .next = NULL,
+};
+static struct ufsm_trigger t111_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t111_exit_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_region * t111_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t111 = {
+  .id = "t111",
+  .name = "",
+  .trigger = t111_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 201,
+  .action = &t111effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s24,
+  .dest = &s9,
+  .lca = &r0,
+  .exit_path = t111_exit_path,
+  .enter_path = t111_enter_path,
+  .next = &t112,
+};
+static struct ufsm_action t111effect = {
+  .id = "t111effect",
+  .name = "a111",
+  .f = &a111,
+  .next = NULL,
+};
+static struct ufsm_trigger t112_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t112 = {
+  .id = "t112",
+  .name = "",
+  .trigger = t112_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 202,
+  .action = &t112effect,
+  .defer = false,
+  .guard = &t112guard,
+  .source = &s24,
+  .dest = &s22,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t689,
+};
+static struct ufsm_action t112effect = {
+  .id = "t112effect",
+  .name = "a112",
+  .f = &a112,
+  .next = NULL,
+};
+static struct ufsm_guard t112guard = {
+  .id = "t112guard",
+  .name = "g14",
+  .f = &g14,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t689_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t689 = {
+  .id = "t689",
+  .name = "",
+  .trigger = t689_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 203,
+  .action = &t689effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s24,
+  .dest = &s377,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t690,
+};
+static struct ufsm_action t689effect = {
+  .id = "t689effect",
+  .name = "a689",
+  .f = &a689,
+  .next = NULL,
+};
+static struct ufsm_region * t690_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t690_enter_path[] = {
+  &r37,
+  NULL,
+};
+static struct ufsm_transition t690 = {
+  .id = "t690",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 204,
+  .action = &t690effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s377,
+  .dest = &s186,
+  .lca = &r4,
+  .exit_path = t690_exit_path,
+  .enter_path = t690_enter_path,
+  .next = &t691,
+};
+static struct ufsm_action t690effect = {
+  .id = "t690effect",
+  .name = "a690",
+  .f = &a690,
+  .next = NULL,
+};
+static struct ufsm_region * t691_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t691_enter_path[] = {
+  &r38,
+  NULL,
+};
+static struct ufsm_transition t691 = {
+  .id = "t691",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 205,
+  .action = &t691effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s377,
+  .dest = &s192,
+  .lca = &r4,
+  .exit_path = t691_exit_path,
+  .enter_path = t691_enter_path,
+  .next = &t694,
+};
+static struct ufsm_action t691effect = {
+  .id = "t691effect",
+  .name = "a691",
+  .f = &a691,
+  .next = NULL,
+};
+static struct ufsm_transition t694 = {
+  .id = "t694",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 206,
+  .action = &t694effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s378,
+  .dest = &s22,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t694effect = {
+  .id = "t694effect",
+  .name = "a694",
+  .f = &a694,
+  .next = NULL,
+};
+static struct ufsm_transition * s24_dispatch_2[] = {
+  &t111,
+  NULL,
+};
+static struct ufsm_transition * s24_dispatch_3[] = {
+  &t689,
+  NULL,
+};
+static struct ufsm_transition * s24_dispatch_5[] = {
+  &t112,
+  NULL,
+};
+static struct ufsm_dispatch s24_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s24_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s24_dispatch_3,
+},
+{
+  .ev = 5,
+  .transition = s24_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s24_interest[] = {
+  0x0000002d,
+};
+static struct ufsm_state s24 = {
+  .id   = "s24",
+  .name = "S24",
+  .kind = 0,
+  .index = 105,
+  .parent_region = &r4,
+  .entry = &s24entry,
+  .doact = NULL,
+  .exit = &s24exit,
+  .region = &r40,
+  .submachine = NULL,
+  .dispatch = s24_dispatch,
+  .no_of_dispatch = 3,
+  .flat_dispatch = NULL,
+  .interest = s24_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s23,
+};
+static struct ufsm_region r40 = {
+  .id = "r40",
+  .name = "R40",
+  .state = &s204,
+  .has_history = false,
+  .history = NULL,
+  .index = 35,
+  .transition = &t40,
+  .parent_state = &s24,
+  .next = &r39,
+};
+static struct ufsm_transition t40 = {
+  .id = "t40",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 351,
+  .action = &t40effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s200,
+  .dest = &s201,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t393,
+};
+static struct ufsm_action t40effect = {
+  .id = "t40effect",
+  .name = "a40",
+  .f = &a40,
+  .next = NULL,
+};
+static struct ufsm_trigger t393_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t393 = {
+  .id = "t393",
+  .name = "",
+  .trigger = t393_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 352,
+  .action = &t393effect,
+  .defer = false,
+  .guard = &t393guard,
+  .source = &s201,
+  .dest = &s204,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t394,
+};
+static struct ufsm_action t393effect = {
+  .id = "t393effect",
+  .name = "a393",
+  .f = &a393,
+  .next = NULL,
+};
+static struct ufsm_guard t393guard = {
+  .id = "t393guard",
+  .name = "g101",
+  .f = &g101,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t394_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t394 = {
+  .id = "t394",
+  .name = "",
+  .trigger = t394_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 353,
+  .action = &t394effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s201,
+  .dest = &s204,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t395,
+};
+static struct ufsm_action t394effect = {
+  .id = "t394effect",
+  .name = "a394",
+  .f = &a394,
+  .next = NULL,
+};
+static struct ufsm_trigger t395_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t395 = {
+  .id = "t395",
+  .name = "",
+  .trigger = t395_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 354,
+  .action = &t395effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s202,
+  .dest = &s202,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t396,
+};
+static struct ufsm_action t395effect = {
+  .id = "t395effect",
+  .name = "a395",
+  .f = &a395,
+  .next = NULL,
+};
+static struct ufsm_trigger t396_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t396 = {
+  .id = "t396",
+  .name = "",
+  .trigger = t396_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 355,
+  .action = &t396effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s202,
+  .dest = &s203,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t397,
+};
+static struct ufsm_action t396effect = {
+  .id = "t396effect",
+  .name = "a396",
+  .f = &a396,
+  .next = NULL,
+};
+static struct ufsm_trigger t397_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t397 = {
+  .id = "t397",
+  .name = "",
+  .trigger = t397_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 356,
+  .action = &t397effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s203,
+  .dest = &s203,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t398,
+};
+static struct ufsm_action t397effect = {
+  .id = "t397effect",
+  .name = "a397",
+  .f = &a397,
+  .next = NULL,
+};
+static struct ufsm_trigger t398_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t398 = {
+  .id = "t398",
+  .name = "",
+  .trigger = t398_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 357,
+  .action = &t398effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s203,
+  .dest = &s202,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t399,
+};
+static struct ufsm_action t398effect = {
+  .id = "t398effect",
+  .name = "a398",
+  .f = &a398,
+  .next = NULL,
+};
+static struct ufsm_trigger t399_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t399_exit_path[] = {
+  &r40,
+  NULL,
+};
+static struct ufsm_region * t399_enter_path[] = {
+  &r37,
+  NULL,
+};
+static struct ufsm_transition t399 = {
+  .id = "t399",
+  .name = "",
+  .trigger = t399_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 358,
+  .action = &t399effect,
+  .defer = false,
+  .guard = &t399guard,
+  .source = &s204,
+  .dest = &s188,
+  .lca = &r4,
+  .exit_path = t399_exit_path,
+  .enter_path = t399_enter_path,
+  .next = &t400,
+};
+static struct ufsm_action t399effect = {
+  .id = "t399effect",
+  .name = "a399",
+  .f = &a399,
+  .next = NULL,
+};
+static struct ufsm_guard t399guard = {
+  .id = "t399guard",
+  .name = "g102",
+  .f = &g102,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t400_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t400_exit_path[] = {
+  &r40,
+  NULL,
+};
+static struct ufsm_region * t400_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t400 = {
+  .id = "t400",
+  .name = "",
+  .trigger = t400_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 359,
+  .action = &t400effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s204,
+  .dest = &s23,
+  .lca = &r4,
+  .exit_path = t400_exit_path,
+  .enter_path = t400_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t400effect = {
+  .id = "t400effect",
+  .name = "a400",
+  .f = &a400,
+  .next = NULL,
+};
+static struct ufsm_transition * s204_dispatch_0[] = {
+  &t399,
+  NULL,
+};
+static struct ufsm_transition * s204_dispatch_7[] = {
+  &t400,
+  NULL,
+};
+static struct ufsm_dispatch s204_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s204_dispatch_0,
+},
+{
+  .ev = 7,
+  .transition = s204_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s204_interest[] = {
+  0x000000ad,
+};
+static struct ufsm_state s204 = {
+  .id   = "s204",
+  .name = "S204",
+  .kind = 0,
+  .index = 190,
+  .parent_region = &r40,
+  .entry = &s204entry,
+  .doact = NULL,
+  .exit = &s204exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s204_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s204_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s203,
+};
+static struct ufsm_entry_exit s204entry = {
+  .id = "s204entry",
+  .name = "e204",
+  .f = &e204,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s204exit = {
+  .id = "s204exit",
+  .name = "x204",
+  .f = &x204,
+  .next = NULL,
+};
+static struct ufsm_transition * s203_dispatch_2[] = {
+  &t398,
+  NULL,
+};
+static struct ufsm_transition * s203_dispatch_6[] = {
+  &t397,
+  NULL,
+};
+static struct ufsm_dispatch s203_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s203_dispatch_2,
+},
+{
+  .ev = 6,
+  .transition = s203_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s203_interest[] = {
+  0x0000006d,
+};
+static struct ufsm_state s203 = {
+  .id   = "s203",
+  .name = "S203",
+  .kind = 0,
+  .index = 191,
+  .parent_region = &r40,
+  .entry = &s203entry,
+  .doact = NULL,
+  .exit = &s203exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s203_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s203_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s202,
+};
+static struct ufsm_entry_exit s203entry = {
+  .id = "s203entry",
+  .name = "e203",
+  .f = &e203,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s203exit = {
+  .id = "s203exit",
+  .name = "x203",
+  .f = &x203,
+  .next = NULL,
+};
+static struct ufsm_transition * s202_dispatch_3[] = {
+  &t396,
+  NULL,
+};
+static struct ufsm_transition * s202_dispatch_4[] = {
+  &t395,
+  NULL,
+};
+static struct ufsm_dispatch s202_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s202_dispatch_3,
+},
+{
+  .ev = 4,
+  .transition = s202_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s202_interest[] = {
+  0x0000003d,
+};
+static struct ufsm_state s202 = {
+  .id   = "s202",
+  .name = "S202",
+  .kind = 0,
+  .index = 192,
+  .parent_region = &r40,
+  .entry = &s202entry,
+  .doact = NULL,
+  .exit = &s202exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s202_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s202_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s201,
+};
+static struct ufsm_entry_exit s202entry = {
+  .id = "s202entry",
+  .name = "e202",
+  .f = &e202,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s202exit = {
+  .id = "s202exit",
+  .name = "x202",
+  .f = &x202,
+  .next = NULL,
+};
+static struct ufsm_transition * s201_dispatch_3[] = {
+  &t393,
+  NULL,
+};
+static struct ufsm_transition * s201_dispatch_4[] = {
+  &t394,
+  NULL,
+};
+static struct ufsm_dispatch s201_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s201_dispatch_3,
+},
+{
+  .ev = 4,
+  .transition = s201_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s201_interest[] = {
+  0x0000003d,
+};
+static struct ufsm_state s201 = {
+  .id   = "s201",
+  .name = "S201",
+  .kind = 0,
+  .index = 193,
+  .parent_region = &r40,
+  .entry = &s201entry,
+  .doact = NULL,
+  .exit = &s201exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s201_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s201_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s200,
+};
+static struct ufsm_entry_exit s201entry = {
+  .id = "s201entry",
+  .name = "e201",
+  .f = &e201,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s201exit = {
+  .id = "s201exit",
+  .name = "x201",
+  .f = &x201,
+  .next = NULL,
+};
+static struct ufsm_dispatch s200_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s200_interest[] = {
+  0x0000002d,
+};
+static struct ufsm_state s200 = {
+  .id   = "s200",
+  .name = "Init",
+  .kind = 1,
+  .index = 194,
+  .parent_region = &r40,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s200_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s200_interest,
+  .time_events = NULL,
+  .completion = &t40,
+  .next = NULL,
+};
+static struct ufsm_region r39 = {
+  .id = "r39",
+  .name = "R39",
+  .state = &s199,
+  .has_history = false,
+  .history = NULL,
+  .index = 36,
+  .transition = &t39,
+  .parent_state = &s24,
+  .next = NULL,
+};
+static struct ufsm_transition t39 = {
+  .id = "t39",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 360,
+  .action = &t39effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s195,
+  .dest = &s198,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t385,
+};
+static struct ufsm_action t39effect = {
+  .id = "t39effect",
+  .name = "a39",
+  .f = &a39,
+  .next = NULL,
+};
+static struct ufsm_trigger t385_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t385 = {
+  .id = "t385",
+  .name = "",
+  .trigger = t385_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 361,
+  .action = &t385effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s196,
+  .dest = &s199,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t386,
+};
+static struct ufsm_action t385effect = {
+  .id = "t385effect",
+  .name = "a385",
+  .f = &a385,
+  .next = NULL,
+};
+static struct ufsm_trigger t386_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t386 = {
+  .id = "t386",
+  .name = "",
+  .trigger = t386_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 362,
+  .action = &t386effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s196,
+  .dest = &s198,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t387,
+};
+static struct ufsm_action t386effect = {
+  .id = "t386effect",
+  .name = "a386",
+  .f = &a386,
+  .next = NULL,
+};
+static struct ufsm_trigger t387_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t387 = {
+  .id = "t387",
+  .name = "",
+  .trigger = t387_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 363,
+  .action = &t387effect,
+  .defer = false,
+  .guard = &t387guard,
+  .source = &s197,
+  .dest = &s199,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t388,
+};
+static struct ufsm_action t387effect = {
+  .id = "t387effect",
+  .name = "a387",
+  .f = &a387,
+  .next = NULL,
+};
+static struct ufsm_guard t387guard = {
+  .id = "t387guard",
+  .name = "g98",
+  .f = &g98,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t388_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t388_exit_path[] = {
+  &r39,
+  &r4,
+  NULL,
+};
+static struct ufsm_region * t388_enter_path[] = {
+  &r7,
+  NULL,
+};
+static struct ufsm_transition t388 = {
+  .id = "t388",
+  .name = "",
+  .trigger = t388_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 364,
+  .action = &t388effect,
+  .defer = false,
+  .guard = &t388guard,
+  .source = &s197,
+  .dest = &s39,
+  .lca = &r0,
+  .exit_path = t388_exit_path,
+  .enter_path = t388_enter_path,
+  .next = &t389,
+};
+static struct ufsm_action t388effect = {
+  .id = "t388effect",
+  .name = "a388",
+  .f = &a388,
+  .next = NULL,
+};
+static struct ufsm_guard t388guard = {
+  .id = "t388guard",
+  .name = "g99",
+  .f = &g99,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t389_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t389 = {
+  .id = "t389",
+  .name = "",
+  .trigger = t389_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 365,
+  .action = &t389effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s198,
+  .dest = &s198,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t390,
+};
+static struct ufsm_action t389effect = {
+  .id = "t389effect",
+  .name = "a389",
+  .f = &a389,
+  .next = NULL,
+};
+static struct ufsm_trigger t390_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t390_exit_path[] = {
+  &r39,
+  NULL,
+};
+static struct ufsm_region * t390_enter_path[] = {
+  &r37,
+  NULL,
+};
+static struct ufsm_transition t390 = {
+  .id = "t390",
+  .name = "",
+  .trigger = t390_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 366,
+  .action = &t390effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s198,
+  .dest = &s188,
+  .lca = &r4,
+  .exit_path = t390_exit_path,
+  .enter_path = t390_enter_path,
+  .next = &t391,
+};
+static struct ufsm_action t390effect = {
+  .id = "t390effect",
+  .name = "a390",
+  .f = &a390,
+  .next = NULL,
+};
+static struct ufsm_trigger t391_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t391 = {
+  .id = "t391",
+  .name = "",
+  .trigger = t391_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 367,
+  .action = &t391effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s199,
+  .dest = &s196,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t392,
+};
+static struct ufsm_action t391effect = {
+  .id = "t391effect",
+  .name = "a391",
+  .f = &a391,
+  .next = NULL,
+};
+static struct ufsm_trigger t392_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t392 = {
+  .id = "t392",
+  .name = "",
+  .trigger = t392_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 368,
+  .action = &t392effect,
+  .defer = false,
+  .guard = &t392guard,
+  .source = &s199,
+  .dest = &s196,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t392effect = {
+  .id = "t392effect",
+  .name = "a392",
+  .f = &a392,
+  .next = NULL,
+};
+static struct ufsm_guard t392guard = {
+  .id = "t392guard",
+  .name = "g100",
+  .f = &g100,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s199_dispatch_4[] = {
+  &t392,
+  NULL,
+};
+static struct ufsm_transition * s199_dispatch_6[] = {
+  &t391,
+  NULL,
+};
+static struct ufsm_dispatch s199_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s199_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s199_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s199_interest[] = {
+  0x0000007d,
+};
+static struct ufsm_state s199 = {
+  .id   = "s199",
+  .name = "S199",
+  .kind = 0,
+  .index = 195,
+  .parent_region = &r39,
+  .entry = &s199entry,
+  .doact = NULL,
+  .exit = &s199exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s199_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s199_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s198,
+};
+static struct ufsm_entry_exit s199entry = {
+  .id = "s199entry",
+  .name = "e199",
+  .f = &e199,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s199exit = {
+  .id = "s199exit",
+  .name = "x199",
+  .f = &x199,
+  .next = NULL,
+};
+static struct ufsm_transition * s198_dispatch_5[] = {
+  &t389,
+  &t390,
+  NULL,
+};
+static struct ufsm_dispatch s198_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s198_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s198_interest[] = {
+  0x0000002d,
+};
+static struct ufsm_state s198 = {
+  .id   = "s198",
+  .name = "S198",
+  .kind = 0,
+  .index = 196,
+  .parent_region = &r39,
+  .entry = &s198entry,
+  .doact = NULL,
+  .exit = &s198exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s198_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s198_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s197,
+};
+static struct ufsm_entry_exit s198entry = {
+  .id = "s198entry",
+  .name = "e198",
+  .f = &e198,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s198exit = {
+  .id = "s198exit",
+  .name = "x198",
+  .f = &x198,
+  .next = NULL,
+};
+static struct ufsm_transition * s197_dispatch_2[] = {
+  &t388,
+  NULL,
+};
+static struct ufsm_transition * s197_dispatch_5[] = {
+  &t387,
+  NULL,
+};
+static struct ufsm_dispatch s197_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s197_dispatch_2,
+},
+{
+  .ev = 5,
+  .transition = s197_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s197_interest[] = {
+  0x0000002d,
+};
+static struct ufsm_state s197 = {
+  .id   = "s197",
+  .name = "S197",
+  .kind = 0,
+  .index = 197,
+  .parent_region = &r39,
+  .entry = &s197entry,
+  .doact = NULL,
+  .exit = &s197exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s197_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s197_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s196,
+};
+static struct ufsm_entry_exit s197entry = {
+  .id = "s197entry",
+  .name = "e197",
+  .f = &e197,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s197exit = {
+  .id = "s197exit",
+  .name = "x197",
+  .f = &x197,
+  .next = NULL,
+};
+static struct ufsm_transition * s196_dispatch_2[] = {
+  &t386,
+  NULL,
+};
+static struct ufsm_transition * s196_dispatch_3[] = {
+  &t385,
+  NULL,
+};
+static struct ufsm_dispatch s196_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s196_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s196_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s196_interest[] = {
+  0x0000002d,
+};
+static struct ufsm_state s196 = {
+  .id   = "s196",
+  .name = "S196",
+  .kind = 0,
+  .index = 198,
+  .parent_region = &r39,
+  .entry = &s196entry,
+  .doact = NULL,
+  .exit = &s196exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s196_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s196_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s195,
+};
+static struct ufsm_entry_exit s196entry = {
+  .id = "s196entry",
+  .name = "e196",
+  .f = &e196,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s196exit = {
+  .id = "s196exit",
+  .name = "x196",
+  .f = &x196,
+  .next = NULL,
+};
+static struct ufsm_dispatch s195_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s195_interest[] = {
+  0x0000002d,
+};
+static struct ufsm_state s195 = {
+  .id   = "s195",
+  .name = "Init",
+  .kind = 1,
+  .index = 199,
+  .parent_region = &r39,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s195_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s195_interest,
+  .time_events = NULL,
+  .completion = &t39,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s24entry = {
+  .id = "s24entry",
+  .name = "e24",
+  .f = &e24,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s24exit = {
+  .id = "s24exit",
+  .name = "x24",
+  .f = &x24,
+  .next = NULL,
+};
+static struct ufsm_transition * s23_dispatch_2[] = {
+  &t109,
+  NULL,
+};
+static struct ufsm_transition * s23_dispatch_7[] = {
+  &t110,
+  NULL,
+};
+static struct ufsm_dispatch s23_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s23_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s23_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s23_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s23 = {
+  .id   = "s23",
+  .name = "S23",
+  .kind = 0,
+  .index = 106,
+  .parent_region = &r4,
+  .entry = &s23entry,
+  .doact = NULL,
+  .exit = &s23exit,
+  .region = &r38,
+  .submachine = NULL,
+  .dispatch = s23_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s23_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s22,
+};
+static struct ufsm_region r38 = {
+  .id = "r38",
+  .name = "R38",
+  .state = &s194,
+  .has_history = false,
+  .history = NULL,
+  .index = 33,
+  .transition = &t38,
+  .parent_state = &s23,
+  .next = &r37,
+};
+static struct ufsm_transition t38 = {
+  .id = "t38",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 331,
+  .action = &t38effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s190,
+  .dest = &s194,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t377,
+};
+static struct ufsm_action t38effect = {
+  .id = "t38effect",
+  .name = "a38",
+  .f = &a38,
+  .next = NULL,
+};
+static struct ufsm_trigger t377_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t377 = {
+  .id = "t377",
+  .name = "",
+  .trigger = t377_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 332,
+  .action = &t377effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s191,
+  .dest = &s191,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t378,
+};
+static struct ufsm_action t377effect = {
+  .id = "t377effect",
+  .name = "a377",
+  .f = &a377,
+  .next = NULL,
+};
+static struct ufsm_trigger t378_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t378_exit_path[] = {
+  &r38,
+  NULL,
+};
+static struct ufsm_region * t378_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t378 = {
+  .id = "t378",
+  .name = "",
+  .trigger = t378_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 333,
+  .action = &t378effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s191,
+  .dest = &s21,
+  .lca = &r4,
+  .exit_path = t378_exit_path,
+  .enter_path = t378_enter_path,
+  .next = &t379,
+};
+static struct ufsm_action t378effect = {
+  .id = "t378effect",
+  .name = "a378",
+  .f = &a378,
+  .next = NULL,
+};
+static struct ufsm_trigger t379_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t379 = {
+  .id = "t379",
+  .name = "",
+  .trigger = t379_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 334,
+  .action = &t379effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s192,
+  .dest = &s191,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t380,
+};
+static struct ufsm_action t379effect = {
+  .id = "t379effect",
+  .name = "a379",
+  .f = &a379,
+  .next = NULL,
+};
+static struct ufsm_trigger t380_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t380 = {
+  .id = "t380",
+  .name = "",
+  .trigger = t380_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 335,
+  .action = &t380effect,
+  .defer = false,
+  .guard = &t380guard,
+  .source = &s192,
+  .dest = &s191,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t381,
+};
+static struct ufsm_action t380effect = {
+  .id = "t380effect",
+  .name = "a380",
+  .f = &a380,
+  .next = NULL,
+};
+static struct ufsm_guard t380guard = {
+  .id = "t380guard",
+  .name = "g96",
+  .f = &g96,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t381_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t381 = {
+  .id = "t381",
+  .name = "",
+  .trigger = t381_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 336,
+  .action = &t381effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s193,
+  .dest = &s191,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t382,
+};
+static struct ufsm_action t381effect = {
+  .id = "t381effect",
+  .name = "a381",
+  .f = &a381,
+  .next = NULL,
+};
+static struct ufsm_trigger t382_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t382_exit_path[] = {
+  &r38,
+  &r4,
+  NULL,
+};
+static struct ufsm_region * t382_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t382 = {
+  .id = "t382",
+  .name = "",
+  .trigger = t382_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 337,
+  .action = &t382effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s193,
+  .dest = &s43,
+  .lca = &r0,
+  .exit_path = t382_exit_path,
+  .enter_path = t382_enter_path,
+  .next = &t383,
+};
+static struct ufsm_action t382effect = {
+  .id = "t382effect",
+  .name = "a382",
+  .f = &a382,
+  .next = NULL,
+};
+static struct ufsm_trigger t383_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t383 = {
+  .id = "t383",
+  .name = "",
+  .trigger = t383_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 338,
+  .action = &t383effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s194,
+  .dest = &s194,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t384,
+};
+static struct ufsm_action t383effect = {
+  .id = "t383effect",
+  .name = "a383",
+  .f = &a383,
+  .next = NULL,
+};
+static struct ufsm_trigger t384_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t384 = {
+  .id = "t384",
+  .name = "",
+  .trigger = t384_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 339,
+  .action = &t384effect,
+  .defer = false,
+  .guard = &t384guard,
+  .source = &s194,
+  .dest = &s194,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t693,
+};
+static struct ufsm_action t384effect = {
+  .id = "t384effect",
+  .name = "a384",
+  .f = &a384,
+  .next = NULL,
+};
+static struct ufsm_guard t384guard = {
+  .id = "t384guard",
+  .name = "g97",
+  .f = &g97,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition t693 = {
+  .id = "t693",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 340,
+  .action = &t693effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s191,
+  .dest = &s378,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t693effect = {
+  .id = "t693effect",
+  .name = "a693",
+  .f = &a693,
+  .next = NULL,
+};
+static struct ufsm_transition * s194_dispatch_3[] = {
+  &t383,
+  NULL,
+};
+static struct ufsm_transition * s194_dispatch_6[] = {
+  &t384,
+  NULL,
+};
+static struct ufsm_dispatch s194_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s194_dispatch_3,
+},
+{
+  .ev = 6,
+  .transition = s194_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s194_interest[] = {
+  0x000000cd,
+};
+static struct ufsm_state s194 = {
+  .id   = "s194",
+  .name = "S194",
+  .kind = 0,
+  .index = 180,
+  .parent_region = &r38,
+  .entry = &s194entry,
+  .doact = NULL,
+  .exit = &s194exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s194_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s194_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s193,
+};
+static struct ufsm_entry_exit s194entry = {
+  .id = "s194entry",
+  .name = "e194",
+  .f = &e194,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s194exit = {
+  .id = "s194exit",
+  .name = "x194",
+  .f = &x194,
+  .next = NULL,
+};
+static struct ufsm_transition * s193_dispatch_1[] = {
+  &t382,
+  NULL,
+};
+static struct ufsm_transition * s193_dispatch_4[] = {
+  &t381,
+  NULL,
+};
+static struct ufsm_dispatch s193_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s193_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s193_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s193_interest[] = {
+  0x0000009f,
+};
+static struct ufsm_state s193 = {
+  .id   = "s193",
+  .name = "S193",
+  .kind = 0,
+  .index = 181,
+  .parent_region = &r38,
+  .entry = &s193entry,
+  .doact = NULL,
+  .exit = &s193exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s193_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s193_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s192,
+};
+static struct ufsm_entry_exit s193entry = {
+  .id = "s193entry",
+  .name = "e193",
+  .f = &e193,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s193exit = {
+  .id = "s193exit",
+  .name = "x193",
+  .f = &x193,
+  .next = NULL,
+};
+static struct ufsm_transition * s192_dispatch_1[] = {
+  &t379,
+  NULL,
+};
+static struct ufsm_transition * s192_dispatch_7[] = {
+  &t380,
+  NULL,
+};
+static struct ufsm_dispatch s192_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s192_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s192_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s192_interest[] = {
+  0x0000008f,
+};
+static struct ufsm_state s192 = {
+  .id   = "s192",
+  .name = "S192",
+  .kind = 0,
+  .index = 182,
+  .parent_region = &r38,
+  .entry = &s192entry,
+  .doact = NULL,
+  .exit = &s192exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s192_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s192_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s191,
+};
+static struct ufsm_entry_exit s192entry = {
+  .id = "s192entry",
+  .name = "e192",
+  .f = &e192,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s192exit = {
+  .id = "s192exit",
+  .name = "x192",
+  .f = &x192,
+  .next = NULL,
+};
+static struct ufsm_transition * s191_dispatch_4[] = {
+  &t377,
+  &t378,
+  NULL,
+};
+static struct ufsm_dispatch s191_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s191_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s191_interest[] = {
+  0x0000009d,
+};
+static struct ufsm_state s191 = {
+  .id   = "s191",
+  .name = "S191",
+  .kind = 0,
+  .index = 183,
+  .parent_region = &r38,
+  .entry = &s191entry,
+  .doact = NULL,
+  .exit = &s191exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s191_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s191_interest,
+  .time_events = NULL,
+  .completion = &t693,
+  .next = &s190,
+};
+static struct ufsm_entry_exit s191entry = {
+  .id = "s191entry",
+  .name = "e191",
+  .f = &e191,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s191exit = {
+  .id = "s191exit",
+  .name = "x191",
+  .f = &x191,
+  .next = NULL,
+};
+static struct ufsm_dispatch s190_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s190_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s190 = {
+  .id   = "s190",
+  .name = "Init",
+  .kind = 1,
+  .index = 184,
+  .parent_region = &r38,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s190_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s190_interest,
+  .time_events = NULL,
+  .completion = &t38,
+  .next = NULL,
+};
+static struct ufsm_region r37 = {
+  .id = "r37",
+  .name = "R37",
+  .state = &s189,
+  .has_history = false,
+  .history = NULL,
+  .index = 34,
+  .transition = &t37,
+  .parent_state = &s23,
+  .next = NULL,
+};
+static struct ufsm_transition t37 = {
+  .id = "t37",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 341,
+  .action = &t37effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s185,
+  .dest = &s186,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t369,
+};
+static struct ufsm_action t37effect = {
+  .id = "t37effect",
+  .name = "a37",
+  .f = &a37,
+  .next = NULL,
+};
+static struct ufsm_trigger t369_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t369 = {
+  .id = "t369",
+  .name = "",
+  .trigger = t369_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 342,
+  .action = &t369effect,
+  .defer = false,
+  .guard = &t369guard,
+  .source = &s186,
+  .dest = &s186,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t370,
+};
+static struct ufsm_action t369effect = {
+  .id = "t369effect",
+  .name = "a369",
+  .f = &a369,
+  .next = NULL,
+};
+static struct ufsm_guard t369guard = {
+  .id = "t369guard",
+  .name = "g90",
+  .f = &g90,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t370_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t370_exit_path[] = {
+  &r37,
+  NULL,
+};
+static struct ufsm_region * t370_enter_path[] = {
+  &r39,
+  NULL,
+};
+static struct ufsm_transition t370 = {
+  .id = "t370",
+  .name = "",
+  .trigger = t370_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 343,
+  .action = &t370effect,
+  .defer = false,
+  .guard = &t370guard,
+  .source = &s186,
+  .dest = &s196,
+  .lca = &r4,
+  .exit_path = t370_exit_path,
+  .enter_path = t370_enter_path,
+  .next = &t371,
+};
+static struct ufsm_action t370effect = {
+  .id = "t370effect",
+  .name = "a370",
+  .f = &a370,
+  .next = NULL,
+};
+static struct ufsm_guard t370guard = {
+  .id = "t370guard",
+  .name = "g91",
+  .f = &g91,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t371_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t371 = {
+  .id = "t371",
+  .name = "",
+  .trigger = t371_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 344,
+  .action = &t371effect,
+  .defer = false,
+  .guard = &t371guard,
+  .source = &s187,
+  .dest = &s188,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t372,
+};
+static struct ufsm_action t371effect = {
+  .id = "t371effect",
+  .name = "a371",
+  .f = &a371,
+  .next = NULL,
+};
+static struct ufsm_guard t371guard = {
+  .id = "t371guard",
+  .name = "g92",
+  .f = &g92,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t372_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t372_exit_path[] = {
+  &r37,
+  NULL,
+};
+static struct ufsm_region * t372_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t372 = {
+  .id = "t372",
+  .name = "",
+  .trigger = t372_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 345,
+  .action = &t372effect,
+  .defer = false,
+  .guard = &t372guard,
+  .source = &s187,
+  .dest = &s23,
+  .lca = &r4,
+  .exit_path = t372_exit_path,
+  .enter_path = t372_enter_path,
+  .next = &t373,
+};
+static struct ufsm_action t372effect = {
+  .id = "t372effect",
+  .name = "a372",
+  .f = &a372,
+  .next = NULL,
+};
+static struct ufsm_guard t372guard = {
+  .id = "t372guard",
+  .name = "g93",
+  .f = &g93,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t373_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t373 = {
+  .id = "t373",
+  .name = "",
+  .trigger = t373_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 346,
+  .action = &t373effect,
+  .defer = false,
+  .guard = &t373guard,
+  .source = &s188,
+  .dest = &s186,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t374,
+};
+static struct ufsm_action t373effect = {
+  .id = "t373effect",
+  .name = "a373",
+  .f = &a373,
+  .next = NULL,
+};
+static struct ufsm_guard t373guard = {
+  .id = "t373guard",
+  .name = "g94",
+  .f = &g94,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t374_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t374 = {
+  .id = "t374",
+  .name = "",
+  .trigger = t374_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 347,
+  .action = &t374effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s188,
+  .dest = &s189,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t375,
+};
+static struct ufsm_action t374effect = {
+  .id = "t374effect",
+  .name = "a374",
+  .f = &a374,
+  .next = NULL,
+};
+static struct ufsm_trigger t375_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t375_exit_path[] = {
+  &r37,
+  NULL,
+};
+static struct ufsm_region * t375_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t375 = {
+  .id = "t375",
+  .name = "",
+  .trigger = t375_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 348,
+  .action = &t375effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s189,
+  .dest = &s23,
+  .lca = &r4,
+  .exit_path = t375_exit_path,
+  .enter_path = t375_enter_path,
+  .next = &t376,
+};
+static struct ufsm_action t375effect = {
+  .id = "t375effect",
+  .name = "a375",
+  .f = &a375,
+  .next = NULL,
+};
+static struct ufsm_trigger t376_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t376 = {
+  .id = "t376",
+  .name = "",
+  .trigger = t376_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 349,
+  .action = &t376effect,
+  .defer = false,
+  .guard = &t376guard,
+  .source = &s189,
+  .dest = &s186,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t692,
+};
+static struct ufsm_action t376effect = {
+  .id = "t376effect",
+  .name = "a376",
+  .f = &a376,
+  .next = NULL,
+};
+static struct ufsm_guard t376guard = {
+  .id = "t376guard",
+  .name = "g95",
+  .f = &g95,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition t692 = {
+  .id = "t692",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 350,
+  .action = &t692effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s188,
+  .dest = &s378,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t692effect = {
+  .id = "t692effect",
+  .name = "a692",
+  .f = &a692,
+  .next = NULL,
+};
+static struct ufsm_transition * s189_dispatch_2[] = {
+  &t376,
+  NULL,
+};
+static struct ufsm_transition * s189_dispatch_7[] = {
+  &t375,
+  NULL,
+};
+static struct ufsm_dispatch s189_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s189_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s189_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s189_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s189 = {
+  .id   = "s189",
+  .name = "S189",
+  .kind = 0,
+  .index = 185,
+  .parent_region = &r37,
+  .entry = &s189entry,
+  .doact = NULL,
+  .exit = &s189exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s189_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s189_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s188,
+};
+static struct ufsm_entry_exit s189entry = {
+  .id = "s189entry",
+  .name = "e189",
+  .f = &e189,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s189exit = {
+  .id = "s189exit",
+  .name = "x189",
+  .f = &x189,
+  .next = NULL,
+};
+static struct ufsm_transition * s188_dispatch_1[] = {
+  &t373,
+  NULL,
+};
+static struct ufsm_transition * s188_dispatch_3[] = {
+  &t374,
+  NULL,
+};
+static struct ufsm_dispatch s188_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s188_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s188_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s188_interest[] = {
+  0x0000008f,
+};
+static struct ufsm_state s188 = {
+  .id   = "s188",
+  .name = "S188",
+  .kind = 0,
+  .index = 186,
+  .parent_region = &r37,
+  .entry = &s188entry,
+  .doact = NULL,
+  .exit = &s188exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s188_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s188_interest,
+  .time_events = NULL,
+  .completion = &t692,
+  .next = &s187,
+};
+static struct ufsm_entry_exit s188entry = {
+  .id = "s188entry",
+  .name = "e188",
+  .f = &e188,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s188exit = {
+  .id = "s188exit",
+  .name = "x188",
+  .f = &x188,
+  .next = NULL,
+};
+static struct ufsm_transition * s187_dispatch_6[] = {
+  &t371,
+  NULL,
+};
+static struct ufsm_transition * s187_dispatch_7[] = {
+  &t372,
+  NULL,
+};
+static struct ufsm_dispatch s187_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s187_dispatch_6,
+},
+{
+  .ev = 7,
+  .transition = s187_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s187_interest[] = {
+  0x000000cd,
+};
+static struct ufsm_state s187 = {
+  .id   = "s187",
+  .name = "S187",
+  .kind = 0,
+  .index = 187,
+  .parent_region = &r37,
+  .entry = &s187entry,
+  .doact = NULL,
+  .exit = &s187exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s187_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s187_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s186,
+};
+static struct ufsm_entry_exit s187entry = {
+  .id = "s187entry",
+  .name = "e187",
+  .f = &e187,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s187exit = {
+  .id = "s187exit",
+  .name = "x187",
+  .f = &x187,
+  .next = NULL,
+};
+static struct ufsm_transition * s186_dispatch_0[] = {
+  &t370,
+  NULL,
+};
+static struct ufsm_transition * s186_dispatch_7[] = {
+  &t369,
+  NULL,
+};
+static struct ufsm_dispatch s186_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s186_dispatch_0,
+},
+{
+  .ev = 7,
+  .transition = s186_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s186_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s186 = {
+  .id   = "s186",
+  .name = "S186",
+  .kind = 0,
+  .index = 188,
+  .parent_region = &r37,
+  .entry = &s186entry,
+  .doact = NULL,
+  .exit = &s186exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s186_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s186_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s185,
+};
+static struct ufsm_entry_exit s186entry = {
+  .id = "s186entry",
+  .name = "e186",
+  .f = &e186,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s186exit = {
+  .id = "s186exit",
+  .name = "x186",
+  .f = &x186,
+  .next = NULL,
+};
+static struct ufsm_dispatch s185_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s185_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s185 = {
+  .id   = "s185",
+  .name = "Init",
+  .kind = 1,
+  .index = 189,
+  .parent_region = &r37,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s185_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s185_interest,
+  .time_events = NULL,
+  .completion = &t37,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s23entry = {
+  .id = "s23entry",
+  .name = "e23",
+  .f = &e23,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s23exit = {
+  .id = "s23exit",
+  .name = "x23",
+  .f = &x23,
+  .next = NULL,
+};
+static struct ufsm_transition * s22_dispatch_4[] = {
+  &t107,
+  NULL,
+};
+static struct ufsm_transition * s22_dispatch_5[] = {
+  &t108,
+  NULL,
+};
+static struct ufsm_dispatch s22_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s22_dispatch_4,
+},
+{
+  .ev = 5,
+  .transition = s22_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s22_interest[] = {
+  0x00000039,
+};
+static struct ufsm_state s22 = {
+  .id   = "s22",
+  .name = "S22",
+  .kind = 0,
+  .index = 107,
+  .parent_region = &r4,
+  .entry = &s22entry,
+  .doact = NULL,
+  .exit = &s22exit,
+  .region = &r36,
+  .submachine = NULL,
+  .dispatch = s22_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s22_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s21,
+};
+static struct ufsm_region r36 = {
+  .id = "r36",
+  .name = "R36",
+  .state = &s184,
+  .has_history = false,
+  .history = NULL,
+  .index = 31,
+  .transition = &t36,
+  .parent_state = &s22,
+  .next = &r35,
+};
+static struct ufsm_transition t36 = {
+  .id = "t36",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 308,
+  .action = &t36effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s180,
+  .dest = &s181,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t361,
+};
+static struct ufsm_action t36effect = {
+  .id = "t36effect",
+  .name = "a36",
+  .f = &a36,
+  .next = NULL,
+};
+static struct ufsm_trigger t361_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t361 = {
+  .id = "t361",
+  .name = "",
+  .trigger = t361_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 309,
+  .action = &t361effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s181,
+  .dest = &s183,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t362,
+};
+static struct ufsm_action t361effect = {
+  .id = "t361effect",
+  .name = "a361",
+  .f = &a361,
+  .next = NULL,
+};
+static struct ufsm_trigger t362_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t362 = {
+  .id = "t362",
+  .name = "",
+  .trigger = t362_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 310,
+  .action = &t362effect,
+  .defer = false,
+  .guard = &t362guard,
+  .source = &s181,
+  .dest = &s182,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t363,
+};
+static struct ufsm_action t362effect = {
+  .id = "t362effect",
+  .name = "a362",
+  .f = &a362,
+  .next = NULL,
+};
+static struct ufsm_guard t362guard = {
+  .id = "t362guard",
+  .name = "g87",
+  .f = &g87,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t363_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t363_exit_path[] = {
+  &r36,
+  NULL,
+};
+static struct ufsm_region * t363_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t363 = {
+  .id = "t363",
+  .name = "",
+  .trigger = t363_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 311,
+  .action = &t363effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s182,
+  .dest = &s24,
+  .lca = &r4,
+  .exit_path = t363_exit_path,
+  .enter_path = t363_enter_path,
+  .next = &t364,
+};
+static struct ufsm_action t363effect = {
+  .id = "t363effect",
+  .name = "a363",
+  .f = &a363,
+  .next = NULL,
+};
+static struct ufsm_trigger t364_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t364 = {
+  .id = "t364",
+  .name = "",
+  .trigger = t364_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 312,
+  .action = &t364effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s182,
+  .dest = &s181,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t365,
+};
+static struct ufsm_action t364effect = {
+  .id = "t364effect",
+  .name = "a364",
+  .f = &a364,
+  .next = NULL,
+};
+static struct ufsm_trigger t365_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t365_exit_path[] = {
+  &r36,
+  NULL,
+};
+static struct ufsm_region * t365_enter_path[] = {
+  &r37,
+  NULL,
+};
+static struct ufsm_transition t365 = {
+  .id = "t365",
+  .name = "",
+  .trigger = t365_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 313,
+  .action = &t365effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s183,
+  .dest = &s189,
+  .lca = &r4,
+  .exit_path = t365_exit_path,
+  .enter_path = t365_enter_path,
+  .next = &t366,
+};
+static struct ufsm_action t365effect = {
+  .id = "t365effect",
+  .name = "a365",
+  .f = &a365,
+  .next = NULL,
+};
+static struct ufsm_trigger t366_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t366 = {
+  .id = "t366",
+  .name = "",
+  .trigger = t366_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 314,
+  .action = &t366effect,
+  .defer = false,
+  .guard = &t366guard,
+  .source = &s183,
+  .dest = &s181,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t367,
+};
+static struct ufsm_action t366effect = {
+  .id = "t366effect",
+  .name = "a366",
+  .f = &a366,
+  .next = NULL,
+};
+static struct ufsm_guard t366guard = {
+  .id = "t366guard",
+  .name = "g88",
+  .f = &g88,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t367_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t367_exit_path[] = {
+  &r36,
+  NULL,
+};
+static struct ufsm_region * t367_enter_path[] = {
+  &r34,
+  NULL,
+};
+static struct ufsm_transition t367 = {
+  .id = "t367",
+  .name = "",
+  .trigger = t367_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 315,
+  .action = &t367effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s184,
+  .dest = &s171,
+  .lca = &r4,
+  .exit_path = t367_exit_path,
+  .enter_path = t367_enter_path,
+  .next = &t368,
+};
+static struct ufsm_action t367effect = {
+  .id = "t367effect",
+  .name = "a367",
+  .f = &a367,
+  .next = NULL,
+};
+static struct ufsm_trigger t368_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t368_exit_path[] = {
+  &r36,
+  NULL,
+};
+static struct ufsm_region * t368_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t368 = {
+  .id = "t368",
+  .name = "",
+  .trigger = t368_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 316,
+  .action = &t368effect,
+  .defer = false,
+  .guard = &t368guard,
+  .source = &s184,
+  .dest = &s21,
+  .lca = &r4,
+  .exit_path = t368_exit_path,
+  .enter_path = t368_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t368effect = {
+  .id = "t368effect",
+  .name = "a368",
+  .f = &a368,
+  .next = NULL,
+};
+static struct ufsm_guard t368guard = {
+  .id = "t368guard",
+  .name = "g89",
+  .f = &g89,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s184_dispatch_6[] = {
+  &t367,
+  &t368,
+  NULL,
+};
+static struct ufsm_dispatch s184_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s184_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s184_interest[] = {
+  0x00000079,
+};
+static struct ufsm_state s184 = {
+  .id   = "s184",
+  .name = "S184",
+  .kind = 0,
+  .index = 168,
+  .parent_region = &r36,
+  .entry = &s184entry,
+  .doact = NULL,
+  .exit = &s184exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s184_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s184_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s183,
+};
+static struct ufsm_entry_exit s184entry = {
+  .id = "s184entry",
+  .name = "e184",
+  .f = &e184,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s184exit = {
+  .id = "s184exit",
+  .name = "x184",
+  .f = &x184,
+  .next = NULL,
+};
+static struct ufsm_transition * s183_dispatch_0[] = {
+  &t365,
+  NULL,
+};
+static struct ufsm_transition * s183_dispatch_6[] = {
+  &t366,
+  NULL,
+};
+static struct ufsm_dispatch s183_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s183_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s183_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s183_interest[] = {
+  0x00000079,
+};
+static struct ufsm_state s183 = {
+  .id   = "s183",
+  .name = "S183",
+  .kind = 0,
+  .index = 169,
+  .parent_region = &r36,
+  .entry = &s183entry,
+  .doact = NULL,
+  .exit = &s183exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s183_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s183_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s182,
+};
+static struct ufsm_entry_exit s183entry = {
+  .id = "s183entry",
+  .name = "e183",
+  .f = &e183,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s183exit = {
+  .id = "s183exit",
+  .name = "x183",
+  .f = &x183,
+  .next = NULL,
+};
+static struct ufsm_transition * s182_dispatch_3[] = {
+  &t363,
+  NULL,
+};
+static struct ufsm_transition * s182_dispatch_7[] = {
+  &t364,
+  NULL,
+};
+static struct ufsm_dispatch s182_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s182_dispatch_3,
+},
+{
+  .ev = 7,
+  .transition = s182_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s182_interest[] = {
+  0x000000b9,
+};
+static struct ufsm_state s182 = {
+  .id   = "s182",
+  .name = "S182",
+  .kind = 0,
+  .index = 170,
+  .parent_region = &r36,
+  .entry = &s182entry,
+  .doact = NULL,
+  .exit = &s182exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s182_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s182_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s181,
+};
+static struct ufsm_entry_exit s182entry = {
+  .id = "s182entry",
+  .name = "e182",
+  .f = &e182,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s182exit = {
+  .id = "s182exit",
+  .name = "x182",
+  .f = &x182,
+  .next = NULL,
+};
+static struct ufsm_transition * s181_dispatch_3[] = {
+  &t361,
+  NULL,
+};
+static struct ufsm_transition * s181_dispatch_5[] = {
+  &t362,
+  NULL,
+};
+static struct ufsm_dispatch s181_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s181_dispatch_3,
+},
+{
+  .ev = 5,
+  .transition = s181_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s181_interest[] = {
+  0x00000039,
+};
+static struct ufsm_state s181 = {
+  .id   = "s181",
+  .name = "S181",
+  .kind = 0,
+  .index = 171,
+  .parent_region = &r36,
+  .entry = &s181entry,
+  .doact = NULL,
+  .exit = &s181exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s181_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s181_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s180,
+};
+static struct ufsm_entry_exit s181entry = {
+  .id = "s181entry",
+  .name = "e181",
+  .f = &e181,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s181exit = {
+  .id = "s181exit",
+  .name = "x181",
+  .f = &x181,
+  .next = NULL,
+};
+static struct ufsm_dispatch s180_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s180_interest[] = {
+  0x00000039,
+};
+static struct ufsm_state s180 = {
+  .id   = "s180",
+  .name = "Init",
+  .kind = 1,
+  .index = 172,
+  .parent_region = &r36,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s180_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s180_interest,
+  .time_events = NULL,
+  .completion = &t36,
+  .next = NULL,
+};
+static struct ufsm_region r35 = {
+  .id = "r35",
+  .name = "R35",
+  .state = &s179,
+  .has_history = false,
+  .history = NULL,
+  .index = 32,
+  .transition = &t35,
+  .parent_state = &s22,
+  .next = NULL,
+};
+static struct ufsm_transition t35 = {
+  .id = "t35",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 317,
+  .action = &t35effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s175,
+  .dest = &s176,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t353,
+};
+static struct ufsm_action t35effect = {
+  .id = "t35effect",
+  .name = "a35",
+  .f = &a35,
+  .next = NULL,
+};
+static struct ufsm_trigger t353_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t353_exit_path[] = {
+  &r35,
+  NULL,
+};
+static struct ufsm_region * t353_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t353 = {
+  .id = "t353",
+  .name = "",
+  .trigger = t353_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 318,
+  .action = &t353effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s176,
+  .dest = &s22,
+  .lca = &r4,
+  .exit_path = t353_exit_path,
+  .enter_path = t353_enter_path,
+  .next = &t354,
+};
+static struct ufsm_action t353effect = {
+  .id = "t353effect",
+  .name = "a353",
+  .f = &a353,
+  .next = NULL,
+};
+static struct ufsm_trigger t354_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t354 = {
+  .id = "t354",
+  .name = "",
+  .trigger = t354_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 319,
+  .action = &t354effect,
+  .defer = false,
+  .guard = &t354guard,
+  .source = &s176,
+  .dest = &s179,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t355,
+};
+static struct ufsm_action t354effect = {
+  .id = "t354effect",
+  .name = "a354",
+  .f = &a354,
+  .next = NULL,
+};
+static struct ufsm_guard t354guard = {
+  .id = "t354guard",
+  .name = "g83",
+  .f = &g83,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t355_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t355 = {
+  .id = "t355",
+  .name = "",
+  .trigger = t355_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 320,
+  .action = &t355effect,
+  .defer = false,
+  .guard = &t355guard,
+  .source = &s177,
+  .dest = &s179,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t356,
+};
+static struct ufsm_action t355effect = {
+  .id = "t355effect",
+  .name = "a355",
+  .f = &a355,
+  .next = NULL,
+};
+static struct ufsm_guard t355guard = {
+  .id = "t355guard",
+  .name = "g84",
+  .f = &g84,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t356_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t356_exit_path[] = {
+  &r35,
+  NULL,
+};
+static struct ufsm_region * t356_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t356 = {
+  .id = "t356",
+  .name = "",
+  .trigger = t356_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 321,
+  .action = &t356effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s177,
+  .dest = &s21,
+  .lca = &r4,
+  .exit_path = t356_exit_path,
+  .enter_path = t356_enter_path,
+  .next = &t357,
+};
+static struct ufsm_action t356effect = {
+  .id = "t356effect",
+  .name = "a356",
+  .f = &a356,
+  .next = NULL,
+};
+static struct ufsm_trigger t357_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t357 = {
+  .id = "t357",
+  .name = "",
+  .trigger = t357_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 322,
+  .action = &t357effect,
+  .defer = false,
+  .guard = &t357guard,
+  .source = &s178,
+  .dest = &s177,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t358,
+};
+static struct ufsm_action t357effect = {
+  .id = "t357effect",
+  .name = "a357",
+  .f = &a357,
+  .next = NULL,
+};
+static struct ufsm_guard t357guard = {
+  .id = "t357guard",
+  .name = "g85",
+  .f = &g85,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t358_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t358 = {
+  .id = "t358",
+  .name = "",
+  .trigger = t358_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 323,
+  .action = &t358effect,
+  .defer = false,
+  .guard = &t358guard,
+  .source = &s178,
+  .dest = &s178,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t359,
+};
+static struct ufsm_action t358effect = {
+  .id = "t358effect",
+  .name = "a358",
+  .f = &a358,
+  .next = NULL,
+};
+static struct ufsm_guard t358guard = {
+  .id = "t358guard",
+  .name = "g86",
+  .f = &g86,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t359_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t359 = {
+  .id = "t359",
+  .name = "",
+  .trigger = t359_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 324,
+  .action = &t359effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s179,
+  .dest = &s177,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t360,
+};
+static struct ufsm_action t359effect = {
+  .id = "t359effect",
+  .name = "a359",
+  .f = &a359,
+  .next = NULL,
+};
+static struct ufsm_trigger t360_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t360 = {
+  .id = "t360",
+  .name = "",
+  .trigger = t360_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 325,
+  .action = &t360effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s179,
+  .dest = &s179,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t666,
+};
+static struct ufsm_action t360effect = {
+  .id = "t360effect",
+  .name = "a360",
+  .f = &a360,
+  .next = NULL,
+};
+static struct ufsm_trigger t666_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t666 = {
+  .id = "t666",
+  .name = "",
+  .trigger = t666_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 326,
+  .action = &t666effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s178,
+  .dest = &s368,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t667,
+};
+static struct ufsm_action t666effect = {
+  .id = "t666effect",
+  .name = "a666",
+  .f = &a666,
+  .next = NULL,
+};
+static struct ufsm_transition t667 = {
+  .id = "t667",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 327,
+  .action = &t667effect,
+  .defer = false,
+  .guard = &t667guard,
+  .source = &s368,
+  .dest = &s176,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t668,
+};
+static struct ufsm_action t667effect = {
+  .id = "t667effect",
+  .name = "a667",
+  .f = &a667,
+  .next = NULL,
+};
+static struct ufsm_guard t667guard = {
+  .id = "t667guard",
+  .name = "g191",
+  .f = &g191,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition t668 = {
+  .id = "t668",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 328,
+  .action = &t668effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s368,
+  .dest = &s176,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t669,
+};
+static struct ufsm_action t668effect = {
+  .id = "t668effect",
+  .name = "a668",
+  .f = &a668,
+  .next = NULL,
+};
+static struct ufsm_trigger t669_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t669 = {
+  .id = "t669",
+  .name = "",
+  .trigger = t669_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 329,
+  .action = &t669effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s178,
+  .dest = &s369,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t670,
+};
+static struct ufsm_action t669effect = {
+  .id = "t669effect",
+  .name = "a669",
+  .f = &a669,
+  .next = NULL,
+};
+static struct ufsm_transition t670 = {
+  .id = "t670",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 330,
+  .action = &t670effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s369,
+  .dest = &s176,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t670effect = {
+  .id = "t670effect",
+  .name = "a670",
+  .f = &a670,
+  .next = NULL,
+};
+static struct ufsm_transition * s179_dispatch_0[] = {
+  &t359,
+  &t360,
+  NULL,
+};
+static struct ufsm_dispatch s179_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s179_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s179_interest[] = {
+  0x00000039,
+};
+static struct ufsm_state s179 = {
+  .id   = "s179",
+  .name = "S179",
+  .kind = 0,
+  .index = 173,
+  .parent_region = &r35,
+  .entry = &s179entry,
+  .doact = NULL,
+  .exit = &s179exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s179_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s179_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s178,
+};
+static struct ufsm_entry_exit s179entry = {
+  .id = "s179entry",
+  .name = "e179",
+  .f = &e179,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s179exit = {
+  .id = "s179exit",
+  .name = "x179",
+  .f = &x179,
+  .next = NULL,
+};
+static struct ufsm_transition * s178_dispatch_2[] = {
+  &t666,
+  NULL,
+};
+static struct ufsm_transition * s178_dispatch_5[] = {
+  &t358,
+  NULL,
+};
+static struct ufsm_transition * s178_dispatch_6[] = {
+  &t357,
+  &t669,
+  NULL,
+};
+static struct ufsm_dispatch s178_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s178_dispatch_2,
+},
+{
+  .ev = 5,
+  .transition = s178_dispatch_5,
+},
+{
+  .ev = 6,
+  .transition = s178_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s178_interest[] = {
+  0x0000007d,
+};
+static struct ufsm_state s178 = {
+  .id   = "s178",
+  .name = "S178",
+  .kind = 0,
+  .index = 174,
+  .parent_region = &r35,
+  .entry = &s178entry,
+  .doact = NULL,
+  .exit = &s178exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s178_dispatch,
+  .no_of_dispatch = 3,
+  .flat_dispatch = NULL,
+  .interest = s178_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s177,
+};
+static struct ufsm_entry_exit s178entry = {
+  .id = "s178entry",
+  .name = "e178",
+  .f = &e178,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s178exit = {
+  .id = "s178exit",
+  .name = "x178",
+  .f = &x178,
+  .next = NULL,
+};
+static struct ufsm_transition * s177_dispatch_5[] = {
+  &t356,
+  NULL,
+};
+static struct ufsm_transition * s177_dispatch_7[] = {
+  &t355,
+  NULL,
+};
+static struct ufsm_dispatch s177_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s177_dispatch_5,
+},
+{
+  .ev = 7,
+  .transition = s177_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s177_interest[] = {
+  0x000000b9,
+};
+static struct ufsm_state s177 = {
+  .id   = "s177",
+  .name = "S177",
+  .kind = 0,
+  .index = 175,
+  .parent_region = &r35,
+  .entry = &s177entry,
+  .doact = NULL,
+  .exit = &s177exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s177_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s177_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s176,
+};
+static struct ufsm_entry_exit s177entry = {
+  .id = "s177entry",
+  .name = "e177",
+  .f = &e177,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s177exit = {
+  .id = "s177exit",
+  .name = "x177",
+  .f = &x177,
+  .next = NULL,
+};
+static struct ufsm_transition * s176_dispatch_1[] = {
+  &t353,
+  NULL,
+};
+static struct ufsm_transition * s176_dispatch_7[] = {
+  &t354,
+  NULL,
+};
+static struct ufsm_dispatch s176_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s176_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s176_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s176_interest[] = {
+  0x000000bb,
+};
+static struct ufsm_state s176 = {
+  .id   = "s176",
+  .name = "S176",
+  .kind = 0,
+  .index = 176,
+  .parent_region = &r35,
+  .entry = &s176entry,
+  .doact = NULL,
+  .exit = &s176exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s176_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s176_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s369,
+};
+static struct ufsm_entry_exit s176entry = {
+  .id = "s176entry",
+  .name = "e176",
+  .f = &e176,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s176exit = {
+  .id = "s176exit",
+  .name = "x176",
+  .f = &x176,
+  .next = NULL,
+};
+static struct ufsm_dispatch s369_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s369_interest[] = {
+  0x00000039,
+};
+static struct ufsm_state s369 = {
+  .id   = "s369",
+  .name = "(null)",
+  .kind = 10,
+  .index = 177,
+  .parent_region = &r35,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s369_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s369_interest,
+  .time_events = NULL,
+  .completion = &t670,
+  .next = &s368,
+};
+static struct ufsm_dispatch s368_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s368_interest[] = {
+  0x00000039,
+};
+static struct ufsm_state s368 = {
+  .id   = "s368",
+  .name = "(null)",
+  .kind = 9,
+  .index = 178,
+  .parent_region = &r35,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s368_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s368_interest,
+  .time_events = NULL,
+  .completion = &t667,
+  .next = &s175,
+};
+static struct ufsm_dispatch s175_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s175_interest[] = {
+  0x00000039,
+};
+static struct ufsm_state s175 = {
+  .id   = "s175",
+  .name = "Init",
+  .kind = 1,
+  .index = 179,
+  .parent_region = &r35,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s175_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s175_interest,
+  .time_events = NULL,
+  .completion = &t35,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s22entry = {
+  .id = "s22entry",
+  .name = "e22",
+  .f = &e22,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s22exit = {
+  .id = "s22exit",
+  .name = "x22",
+  .f = &x22,
+  .next = NULL,
+};
+static struct ufsm_transition * s21_dispatch_1[] = {
+  &t105,
+  NULL,
+};
+static struct ufsm_transition * s21_dispatch_5[] = {
+  &t106,
+  NULL,
+};
+static struct ufsm_dispatch s21_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s21_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s21_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s21_interest[] = {
+  0x0000002b,
+};
+static struct ufsm_state s21 = {
+  .id   = "s21",
+  .name = "S21",
+  .kind = 0,
+  .index = 108,
+  .parent_region = &r4,
+  .entry = &s21entry,
+  .doact = NULL,
+  .exit = &s21exit,
+  .region = &r34,
+  .submachine = NULL,
+  .dispatch = s21_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s21_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s378,
+};
+static struct ufsm_region r34 = {
+  .id = "r34",
+  .name = "R34",
+  .state = &s174,
+  .has_history = false,
+  .history = NULL,
+  .index = 29,
+  .transition = &t34,
+  .parent_state = &s21,
+  .next = &r33,
+};
+static struct ufsm_transition t34 = {
+  .id = "t34",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 290,
+  .action = &t34effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s170,
+  .dest = &s174,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t345,
+};
+static struct ufsm_action t34effect = {
+  .id = "t34effect",
+  .name = "a34",
+  .f = &a34,
+  .next = NULL,
+};
+static struct ufsm_trigger t345_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t345 = {
+  .id = "t345",
+  .name = "",
+  .trigger = t345_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 291,
+  .action = &t345effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s171,
+  .dest = &s171,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t346,
+};
+static struct ufsm_action t345effect = {
+  .id = "t345effect",
+  .name = "a345",
+  .f = &a345,
+  .next = NULL,
+};
+static struct ufsm_trigger t346_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t346 = {
+  .id = "t346",
+  .name = "",
+  .trigger = t346_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 292,
+  .action = &t346effect,
+  .defer = false,
+  .guard = &t346guard,
+  .source = &s171,
+  .dest = &s171,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t347,
+};
+static struct ufsm_action t346effect = {
+  .id = "t346effect",
+  .name = "a346",
+  .f = &a346,
+  .next = NULL,
+};
+static struct ufsm_guard t346guard = {
+  .id = "t346guard",
+  .name = "g80",
+  .f = &g80,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t347_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t347_exit_path[] = {
+  &r34,
+  &r4,
+  NULL,
+};
+static struct ufsm_region * t347_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t347 = {
+  .id = "t347",
+  .name = "",
+  .trigger = t347_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 293,
+  .action = &t347effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s172,
+  .dest = &s3,
+  .lca = &r0,
+  .exit_path = t347_exit_path,
+  .enter_path = t347_enter_path,
+  .next = &t348,
+};
+static struct ufsm_action t347effect = {
+  .id = "t347effect",
+  .name = "a347",
+  .f = &a347,
+  .next = NULL,
+};
+static struct ufsm_trigger t348_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t348_exit_path[] = {
+  &r34,
+  NULL,
+};
+static struct ufsm_region * t348_enter_path[] = {
+  &r35,
+  NULL,
+};
+static struct ufsm_transition t348 = {
+  .id = "t348",
+  .name = "",
+  .trigger = t348_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 294,
+  .action = &t348effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s172,
+  .dest = &s176,
+  .lca = &r4,
+  .exit_path = t348_exit_path,
+  .enter_path = t348_enter_path,
+  .next = &t349,
+};
+static struct ufsm_action t348effect = {
+  .id = "t348effect",
+  .name = "a348",
+  .f = &a348,
+  .next = NULL,
+};
+static struct ufsm_trigger t349_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t349_exit_path[] = {
+  &r34,
+  &r4,
+  NULL,
+};
+static struct ufsm_region * t349_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t349 = {
+  .id = "t349",
+  .name = "",
+  .trigger = t349_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 295,
+  .action = &t349effect,
+  .defer = false,
+  .guard = &t349guard,
+  .source = &s173,
+  .dest = &s1,
+  .lca = &r0,
+  .exit_path = t349_exit_path,
+  .enter_path = t349_enter_path,
+  .next = &t350,
+};
+static struct ufsm_action t349effect = {
+  .id = "t349effect",
+  .name = "a349",
+  .f = &a349,
+  .next = NULL,
+};
+static struct ufsm_guard t349guard = {
+  .id = "t349guard",
+  .name = "g81",
+  .f = &g81,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t350_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t350 = {
+  .id = "t350",
+  .name = "",
+  .trigger = t350_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 296,
+  .action = &t350effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s173,
+  .dest = &s172,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t351,
+};
+static struct ufsm_action t350effect = {
+  .id = "t350effect",
+  .name = "a350",
+  .f = &a350,
+  .next = NULL,
+};
+static struct ufsm_trigger t351_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t351 = {
+  .id = "t351",
+  .name = "",
+  .trigger = t351_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 297,
+  .action = &t351effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s174,
+  .dest = &s172,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t352,
+};
+static struct ufsm_action t351effect = {
+  .id = "t351effect",
+  .name = "a351",
+  .f = &a351,
+  .next = NULL,
+};
+static struct ufsm_trigger t352_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t352_exit_path[] = {
+  &r34,
+  &r4,
+  NULL,
+};
+static struct ufsm_region * t352_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t352 = {
+  .id = "t352",
+  .name = "",
+  .trigger = t352_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 298,
+  .action = &t352effect,
+  .defer = false,
+  .guard = &t352guard,
+  .source = &s174,
+  .dest = &s2,
+  .lca = &r0,
+  .exit_path = t352_exit_path,
+  .enter_path = t352_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t352effect = {
+  .id = "t352effect",
+  .name = "a352",
+  .f = &a352,
+  .next = NULL,
+};
+static struct ufsm_guard t352guard = {
+  .id = "t352guard",
+  .name = "g82",
+  .f = &g82,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s174_dispatch_1[] = {
+  &t352,
+  NULL,
+};
+static struct ufsm_transition * s174_dispatch_5[] = {
+  &t351,
+  NULL,
+};
+static struct ufsm_dispatch s174_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s174_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s174_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s174_interest[] = {
+  0x0000002b,
+};
+static struct ufsm_state s174 = {
+  .id   = "s174",
+  .name = "S174",
+  .kind = 0,
+  .index = 158,
+  .parent_region = &r34,
+  .entry = &s174entry,
+  .doact = NULL,
+  .exit = &s174exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s174_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s174_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s173,
+};
+static struct ufsm_entry_exit s174entry = {
+  .id = "s174entry",
+  .name = "e174",
+  .f = &e174,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s174exit = {
+  .id = "s174exit",
+  .name = "x174",
+  .f = &x174,
+  .next = NULL,
+};
+static struct ufsm_transition * s173_dispatch_3[] = {
+  &t349,
+  NULL,
+};
+static struct ufsm_transition * s173_dispatch_7[] = {
+  &t350,
+  NULL,
+};
+static struct ufsm_dispatch s173_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s173_dispatch_3,
+},
+{
+  .ev = 7,
+  .transition = s173_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s173_interest[] = {
+  0x000000ab,
+};
+static struct ufsm_state s173 = {
+  .id   = "s173",
+  .name = "S173",
+  .kind = 0,
+  .index = 159,
+  .parent_region = &r34,
+  .entry = &s173entry,
+  .doact = NULL,
+  .exit = &s173exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s173_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s173_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s172,
+};
+static struct ufsm_entry_exit s173entry = {
+  .id = "s173entry",
+  .name = "e173",
+  .f = &e173,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s173exit = {
+  .id = "s173exit",
+  .name = "x173",
+  .f = &x173,
+  .next = NULL,
+};
+static struct ufsm_transition * s172_dispatch_1[] = {
+  &t347,
+  NULL,
+};
+static struct ufsm_transition * s172_dispatch_7[] = {
+  &t348,
+  NULL,
+};
+static struct ufsm_dispatch s172_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s172_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s172_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s172_interest[] = {
+  0x000000ab,
+};
+static struct ufsm_state s172 = {
+  .id   = "s172",
+  .name = "S172",
+  .kind = 0,
+  .index = 160,
+  .parent_region = &r34,
+  .entry = &s172entry,
+  .doact = NULL,
+  .exit = &s172exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s172_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s172_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s171,
+};
+static struct ufsm_entry_exit s172entry = {
+  .id = "s172entry",
+  .name = "e172",
+  .f = &e172,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s172exit = {
+  .id = "s172exit",
+  .name = "x172",
+  .f = &x172,
+  .next = NULL,
+};
+static struct ufsm_transition * s171_dispatch_1[] = {
+  &t346,
+  NULL,
+};
+static struct ufsm_transition * s171_dispatch_4[] = {
+  &t345,
+  NULL,
+};
+static struct ufsm_dispatch s171_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s171_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s171_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s171_interest[] = {
+  0x0000003b,
+};
+static struct ufsm_state s171 = {
+  .id   = "s171",
+  .name = "S171",
+  .kind = 0,
+  .index = 161,
+  .parent_region = &r34,
+  .entry = &s171entry,
+  .doact = NULL,
+  .exit = &s171exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s171_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s171_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s170,
+};
+static struct ufsm_entry_exit s171entry = {
+  .id = "s171entry",
+  .name = "e171",
+  .f = &e171,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s171exit = {
+  .id = "s171exit",
+  .name = "x171",
+  .f = &x171,
+  .next = NULL,
+};
+static struct ufsm_dispatch s170_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s170_interest[] = {
+  0x0000002b,
+};
+static struct ufsm_state s170 = {
+  .id   = "s170",
+  .name = "Init",
+  .kind = 1,
+  .index = 162,
+  .parent_region = &r34,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s170_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s170_interest,
+  .time_events = NULL,
+  .completion = &t34,
+  .next = NULL,
+};
+static struct ufsm_region r33 = {
+  .id = "r33",
+  .name = "R33",
+  .state = &s169,
+  .has_history = false,
+  .history = NULL,
+  .index = 30,
+  .transition = &t33,
+  .parent_state = &s21,
+  .next = NULL,
+};
+static struct ufsm_transition t33 = {
+  .id = "t33",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 299,
+  .action = &t33effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s165,
+  .dest = &s166,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t337,
+};
+static struct ufsm_action t33effect = {
+  .id = "t33effect",
+  .name = "a33",
+  .f = &a33,
+  .next = NULL,
+};
+static struct ufsm_trigger t337_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t337_exit_path[] = {
+  &r33,
+  &r4,
+  NULL,
+};
+static struct ufsm_region * t337_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t337 = {
+  .id = "t337",
+  .name = "",
+  .trigger = t337_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 300,
+  .action = &t337effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s166,
+  .dest = &s1,
+  .lca = &r0,
+  .exit_path = t337_exit_path,
+  .enter_path = t337_enter_path,
+  .next = &t338,
+};
+static struct ufsm_action t337effect = {
+  .id = "t337effect",
+  .name = "a337",
+  .f = &a337,
+  .next = NULL,
+};
+static struct ufsm_trigger t338_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t338 = {
+  .id = "t338",
+  .name = "",
+  .trigger = t338_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 301,
+  .action = &t338effect,
+  .defer = false,
+  .guard = &t338guard,
+  .source = &s166,
+  .dest = &s168,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t339,
+};
+static struct ufsm_action t338effect = {
+  .id = "t338effect",
+  .name = "a338",
+  .f = &a338,
+  .next = NULL,
+};
+static struct ufsm_guard t338guard = {
+  .id = "t338guard",
+  .name = "g78",
+  .f = &g78,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t339_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t339 = {
+  .id = "t339",
+  .name = "",
+  .trigger = t339_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 302,
+  .action = &t339effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s167,
+  .dest = &s166,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t340,
+};
+static struct ufsm_action t339effect = {
+  .id = "t339effect",
+  .name = "a339",
+  .f = &a339,
+  .next = NULL,
+};
+static struct ufsm_trigger t340_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t340 = {
+  .id = "t340",
+  .name = "",
+  .trigger = t340_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 303,
+  .action = &t340effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s167,
+  .dest = &s166,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t341,
+};
+static struct ufsm_action t340effect = {
+  .id = "t340effect",
+  .name = "a340",
+  .f = &a340,
+  .next = NULL,
+};
+static struct ufsm_trigger t341_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t341 = {
+  .id = "t341",
+  .name = "",
+  .trigger = t341_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 304,
+  .action = &t341effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s168,
+  .dest = &s167,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t342,
+};
+static struct ufsm_action t341effect = {
+  .id = "t341effect",
+  .name = "a341",
+  .f = &a341,
+  .next = NULL,
+};
+static struct ufsm_trigger t342_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t342_exit_path[] = {
+  &r33,
+  NULL,
+};
+static struct ufsm_region * t342_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t342 = {
+  .id = "t342",
+  .name = "",
+  .trigger = t342_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 305,
+  .action = &t342effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s168,
+  .dest = &s21,
+  .lca = &r4,
+  .exit_path = t342_exit_path,
+  .enter_path = t342_enter_path,
+  .next = &t343,
+};
+static struct ufsm_action t342effect = {
+  .id = "t342effect",
+  .name = "a342",
+  .f = &a342,
+  .next = NULL,
+};
+static struct ufsm_trigger t343_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t343 = {
+  .id = "t343",
+  .name = "",
+  .trigger = t343_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 306,
+  .action = &t343effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s169,
+  .dest = &s168,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t344,
+};
+static struct ufsm_action t343effect = {
+  .id = "t343effect",
+  .name = "a343",
+  .f = &a343,
+  .next = NULL,
+};
+static struct ufsm_trigger t344_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t344 = {
+  .id = "t344",
+  .name = "",
+  .trigger = t344_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 307,
+  .action = &t344effect,
+  .defer = false,
+  .guard = &t344guard,
+  .source = &s169,
+  .dest = &s166,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t344effect = {
+  .id = "t344effect",
+  .name = "a344",
+  .f = &a344,
+  .next = NULL,
+};
+static struct ufsm_guard t344guard = {
+  .id = "t344guard",
+  .name = "g79",
+  .f = &g79,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s169_dispatch_2[] = {
+  &t344,
+  NULL,
+};
+static struct ufsm_transition * s169_dispatch_3[] = {
+  &t343,
+  NULL,
+};
+static struct ufsm_dispatch s169_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s169_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s169_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s169_interest[] = {
+  0x0000002f,
+};
+static struct ufsm_state s169 = {
+  .id   = "s169",
+  .name = "S169",
+  .kind = 0,
+  .index = 163,
+  .parent_region = &r33,
+  .entry = &s169entry,
+  .doact = NULL,
+  .exit = &s169exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s169_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s169_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s168,
+};
+static struct ufsm_entry_exit s169entry = {
+  .id = "s169entry",
+  .name = "e169",
+  .f = &e169,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s169exit = {
+  .id = "s169exit",
+  .name = "x169",
+  .f = &x169,
+  .next = NULL,
+};
+static struct ufsm_transition * s168_dispatch_2[] = {
+  &t342,
+  NULL,
+};
+static struct ufsm_transition * s168_dispatch_4[] = {
+  &t341,
+  NULL,
+};
+static struct ufsm_dispatch s168_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s168_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s168_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s168_interest[] = {
+  0x0000003f,
+};
+static struct ufsm_state s168 = {
+  .id   = "s168",
+  .name = "S168",
+  .kind = 0,
+  .index = 164,
+  .parent_region = &r33,
+  .entry = &s168entry,
+  .doact = NULL,
+  .exit = &s168exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s168_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s168_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s167,
+};
+static struct ufsm_entry_exit s168entry = {
+  .id = "s168entry",
+  .name = "e168",
+  .f = &e168,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s168exit = {
+  .id = "s168exit",
+  .name = "x168",
+  .f = &x168,
+  .next = NULL,
+};
+static struct ufsm_transition * s167_dispatch_2[] = {
+  &t340,
+  NULL,
+};
+static struct ufsm_transition * s167_dispatch_3[] = {
+  &t339,
+  NULL,
+};
+static struct ufsm_dispatch s167_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s167_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s167_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s167_interest[] = {
+  0x0000002f,
+};
+static struct ufsm_state s167 = {
+  .id   = "s167",
+  .name = "S167",
+  .kind = 0,
+  .index = 165,
+  .parent_region = &r33,
+  .entry = &s167entry,
+  .doact = NULL,
+  .exit = &s167exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s167_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s167_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s166,
+};
+static struct ufsm_entry_exit s167entry = {
+  .id = "s167entry",
+  .name = "e167",
+  .f = &e167,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s167exit = {
+  .id = "s167exit",
+  .name = "x167",
+  .f = &x167,
+  .next = NULL,
+};
+static struct ufsm_transition * s166_dispatch_0[] = {
+  &t338,
+  NULL,
+};
+static struct ufsm_transition * s166_dispatch_6[] = {
+  &t337,
+  NULL,
+};
+static struct ufsm_dispatch s166_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s166_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s166_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s166_interest[] = {
+  0x0000006b,
+};
+static struct ufsm_state s166 = {
+  .id   = "s166",
+  .name = "S166",
+  .kind = 0,
+  .index = 166,
+  .parent_region = &r33,
+  .entry = &s166entry,
+  .doact = NULL,
+  .exit = &s166exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s166_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s166_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s165,
+};
+static struct ufsm_entry_exit s166entry = {
+  .id = "s166entry",
+  .name = "e166",
+  .f = &e166,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s166exit = {
+  .id = "s166exit",
+  .name = "x166",
+  .f = &x166,
+  .next = NULL,
+};
+static struct ufsm_dispatch s165_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s165_interest[] = {
+  0x0000002b,
+};
+static struct ufsm_state s165 = {
+  .id   = "s165",
+  .name = "Init",
+  .kind = 1,
+  .index = 167,
+  .parent_region = &r33,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s165_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s165_interest,
+  .time_events = NULL,
+  .completion = &t33,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s21entry = {
+  .id = "s21entry",
+  .name = "e21",
+  .f = &e21,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s21exit = {
+  .id = "s21exit",
+  .name = "x21",
+  .f = &x21,
+  .next = NULL,
+};
+static struct ufsm_dispatch s378_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s378_interest[] = {
+  0x00000009,
+};
+static struct ufsm_state s378 = {
+  .id   = "s378",
+  .name = "(null)",
+  .kind = 7,
+  .index = 109,
+  .parent_region = &r4,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s378_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s378_interest,
+  .time_events = NULL,
+  .completion = &t694,
+  .next = &s377,
+};
+static struct ufsm_dispatch s377_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s377_interest[] = {
+  0x00000009,
+};
+static struct ufsm_state s377 = {
+  .id   = "s377",
+  .name = "(null)",
+  .kind = 8,
+  .index = 110,
+  .parent_region = &r4,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s377_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s377_interest,
+  .time_events = NULL,
+  .completion = &t690,
+  .next = &s20,
+};
+static struct ufsm_dispatch s20_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s20_interest[] = {
+  0x00000009,
+};
+static struct ufsm_state s20 = {
+  .id   = "s20",
+  .name = "Init",
+  .kind = 1,
+  .index = 111,
+  .parent_region = &r4,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s20_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s20_interest,
+  .time_events = NULL,
+  .completion = &t4,
+  .next = NULL,
+};
+static struct ufsm_region r3 = {
+  .id = "r3",
+  .name = "R3",
+  .state = &s19,
+  .has_history = false,
+  .history = NULL,
+  .index = 20,
+  .transition = &t3,
+  .parent_state = &s2,
+  .next = NULL,
+};
+static struct ufsm_transition t3 = {
+  .id = "t3",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 207,
+  .action = &t3effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s15,
+  .dest = &s17,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t97,
+};
+static struct ufsm_action t3effect = {
+  .id = "t3effect",
+  .name = "a3",
+  .f = &a3,
+  .next = NULL,
+};
+static struct ufsm_trigger t97_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t97_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t97_enter_path[] = {
+  &r26,
+  NULL,
+};
+static struct ufsm_transition t97 = {
+  .id = "t97",
+  .name = "",
+  .trigger = t97_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 208,
+  .action = &t97effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s16,
+  .dest = &s131,
+  .lca = &r3,
+  .exit_path = t97_exit_path,
+  .enter_path = t97_enter_path,
+  .next = &t98,
+};
+static struct ufsm_action t97effect = {
+  .id = "t97effect",
+  .name = "a97",
+  .f = &a97,
+  .next = NULL,
+};
+static struct ufsm_trigger t98_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t98_exit_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_region * t98_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t98 = {
+  .id = "t98",
+  .name = "",
+  .trigger = t98_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 209,
+  .action = &t98effect,
+  .defer = false,
+  .guard = &t98guard,
+  .source = &s16,
+  .dest = &s22,
+  .lca = &r0,
+  .exit_path = t98_exit_path,
+  .enter_path = t98_enter_path,
+  .next = &t99,
+};
+static struct ufsm_action t98effect = {
+  .id = "t98effect",
+  .name = "a98",
+  .f = &a98,
+  .next = NULL,
+};
+static struct ufsm_guard t98guard = {
+  .id = "t98guard",
+  .name = "g9",
+  .f = &g9,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t99_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t99 = {
+  .id = "t99",
+  .name = "",
+  .trigger = t99_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 210,
+  .action = &t99effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s17,
+  .dest = &s19,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t100,
+};
+static struct ufsm_action t99effect = {
+  .id = "t99effect",
+  .name = "a99",
+  .f = &a99,
+  .next = NULL,
+};
+static struct ufsm_trigger t100_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t100_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t100_enter_path[] = {
+  &r25,
+  NULL,
+};
+static struct ufsm_transition t100 = {
+  .id = "t100",
+  .name = "",
+  .trigger = t100_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 211,
+  .action = &t100effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s17,
+  .dest = &s126,
+  .lca = &r3,
+  .exit_path = t100_exit_path,
+  .enter_path = t100_enter_path,
+  .next = &t101,
+};
+static struct ufsm_action t100effect = {
+  .id = "t100effect",
+  .name = "a100",
+  .f = &a100,
+  .next = NULL,
+};
+static struct ufsm_trigger t101_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t101_exit_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_region * t101_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t101 = {
+  .id = "t101",
+  .name = "",
+  .trigger = t101_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 212,
+  .action = &t101effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s18,
+  .dest = &s1,
+  .lca = &r0,
+  .exit_path = t101_exit_path,
+  .enter_path = t101_enter_path,
+  .next = &t102,
+};
+static struct ufsm_action t101effect = {
+  .id = "t101effect",
+  .name = "a101",
+  .f = &a101,
+  .next = NULL,
+};
+static struct ufsm_trigger t102_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t102_exit_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_region * t102_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t102 = {
+  .id = "t102",
+  .name = "",
+  .trigger = t102_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 213,
+  .action = &t102effect,
+  .defer = false,
+  .guard = &t102guard,
+  .source = &s18,
+  .dest = &s4,
+  .lca = &r0,
+  .exit_path = t102_exit_path,
+  .enter_path = t102_enter_path,
+  .next = &t103,
+};
+static struct ufsm_action t102effect = {
+  .id = "t102effect",
+  .name = "a102",
+  .f = &a102,
+  .next = NULL,
+};
+static struct ufsm_guard t102guard = {
+  .id = "t102guard",
+  .name = "g10",
+  .f = &g10,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t103_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t103_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t103_enter_path[] = {
+  &r26,
+  NULL,
+};
+static struct ufsm_transition t103 = {
+  .id = "t103",
+  .name = "",
+  .trigger = t103_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 214,
+  .action = &t103effect,
+  .defer = false,
+  .guard = &t103guard,
+  .source = &s19,
+  .dest = &s131,
+  .lca = &r3,
+  .exit_path = t103_exit_path,
+  .enter_path = t103_enter_path,
+  .next = &t104,
+};
+static struct ufsm_action t103effect = {
+  .id = "t103effect",
+  .name = "a103",
+  .f = &a103,
+  .next = NULL,
+};
+static struct ufsm_guard t103guard = {
+  .id = "t103guard",
+  .name = "g11",
+  .f = &g11,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t104_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t104 = {
+  .id = "t104",
+  .name = "",
+  .trigger = t104_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 215,
+  .action = &t104effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s19,
+  .dest = &s18,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t104effect = {
+  .id = "t104effect",
+  .name = "a104",
+  .f = &a104,
+  .next = NULL,
+};
+static struct ufsm_transition * s19_dispatch_7[] = {
+  &t103,
+  &t104,
+  NULL,
+};
+static struct ufsm_dispatch s19_dispatch[] = {
+{
+  .ev = 7,
+  .transition = s19_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s19_interest[] = {
+  0x00000089,
+};
+static struct ufsm_state s19 = {
+  .id   = "s19",
+  .name = "S19",
+  .kind = 0,
+  .index = 112,
+  .parent_region = &r3,
+  .entry = &s19entry,
+  .doact = NULL,
+  .exit = &s19exit,
+  .region = &r32,
+  .submachine = NULL,
+  .dispatch = s19_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s19_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s18,
+};
+static struct ufsm_region r32 = {
+  .id = "r32",
+  .name = "R32",
+  .state = &s164,
+  .has_history = false,
+  .history = NULL,
+  .index = 27,
+  .transition = &t32,
+  .parent_state = &s19,
+  .next = &r31,
+};
+static struct ufsm_transition t32 = {
+  .id = "t32",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 270,
+  .action = &t32effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s160,
+  .dest = &s161,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t329,
+};
+static struct ufsm_action t32effect = {
+  .id = "t32effect",
+  .name = "a32",
+  .f = &a32,
+  .next = NULL,
+};
+static struct ufsm_trigger t329_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t329 = {
+  .id = "t329",
+  .name = "",
+  .trigger = t329_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 271,
+  .action = &t329effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s161,
+  .dest = &s162,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t330,
+};
+static struct ufsm_action t329effect = {
+  .id = "t329effect",
+  .name = "a329",
+  .f = &a329,
+  .next = NULL,
+};
+static struct ufsm_trigger t330_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t330 = {
+  .id = "t330",
+  .name = "",
+  .trigger = t330_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 272,
+  .action = &t330effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s161,
+  .dest = &s161,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t331,
+};
+static struct ufsm_action t330effect = {
+  .id = "t330effect",
+  .name = "a330",
+  .f = &a330,
+  .next = NULL,
+};
+static struct ufsm_trigger t331_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t331 = {
+  .id = "t331",
+  .name = "",
+  .trigger = t331_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 273,
+  .action = &t331effect,
+  .defer = false,
+  .guard = &t331guard,
+  .source = &s162,
+  .dest = &s162,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t332,
+};
+static struct ufsm_action t331effect = {
+  .id = "t331effect",
+  .name = "a331",
+  .f = &a331,
+  .next = NULL,
+};
+static struct ufsm_guard t331guard = {
+  .id = "t331guard",
+  .name = "g76",
+  .f = &g76,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t332_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t332 = {
+  .id = "t332",
+  .name = "",
+  .trigger = t332_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 274,
+  .action = &t332effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s162,
+  .dest = &s162,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t333,
+};
+static struct ufsm_action t332effect = {
+  .id = "t332effect",
+  .name = "a332",
+  .f = &a332,
+  .next = NULL,
+};
+static struct ufsm_trigger t333_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t333 = {
+  .id = "t333",
+  .name = "",
+  .trigger = t333_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 275,
+  .action = &t333effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s163,
+  .dest = &s162,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t334,
+};
+static struct ufsm_action t333effect = {
+  .id = "t333effect",
+  .name = "a333",
+  .f = &a333,
+  .next = NULL,
+};
+static struct ufsm_trigger t334_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t334_exit_path[] = {
+  &r32,
+  NULL,
+};
+static struct ufsm_region * t334_enter_path[] = {
+  &r28,
+  NULL,
+};
+static struct ufsm_transition t334 = {
+  .id = "t334",
+  .name = "",
+  .trigger = t334_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 276,
+  .action = &t334effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s163,
+  .dest = &s142,
+  .lca = &r3,
+  .exit_path = t334_exit_path,
+  .enter_path = t334_enter_path,
+  .next = &t335,
+};
+static struct ufsm_action t334effect = {
+  .id = "t334effect",
+  .name = "a334",
+  .f = &a334,
+  .next = NULL,
+};
+static struct ufsm_trigger t335_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t335 = {
+  .id = "t335",
+  .name = "",
+  .trigger = t335_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 277,
+  .action = &t335effect,
+  .defer = false,
+  .guard = &t335guard,
+  .source = &s164,
+  .dest = &s163,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t336,
+};
+static struct ufsm_action t335effect = {
+  .id = "t335effect",
+  .name = "a335",
+  .f = &a335,
+  .next = NULL,
+};
+static struct ufsm_guard t335guard = {
+  .id = "t335guard",
+  .name = "g77",
+  .f = &g77,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t336_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t336_exit_path[] = {
+  &r32,
+  NULL,
+};
+static struct ufsm_region * t336_enter_path[] = {
+  &r29,
+  NULL,
+};
+static struct ufsm_transition t336 = {
+  .id = "t336",
+  .name = "",
+  .trigger = t336_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 278,
+  .action = &t336effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s164,
+  .dest = &s147,
+  .lca = &r3,
+  .exit_path = t336_exit_path,
+  .enter_path = t336_enter_path,
+  .next = &t671,
+};
+static struct ufsm_action t336effect = {
+  .id = "t336effect",
+  .name = "a336",
+  .f = &a336,
+  .next = NULL,
+};
+static struct ufsm_trigger t671_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t671 = {
+  .id = "t671",
+  .name = "",
+  .trigger = t671_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 279,
+  .action = &t671effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s161,
+  .dest = &s370,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t672,
+};
+static struct ufsm_action t671effect = {
+  .id = "t671effect",
+  .name = "a671",
+  .f = &a671,
+  .next = NULL,
+};
+static struct ufsm_transition t672 = {
+  .id = "t672",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 280,
+  .action = &t672effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s370,
+  .dest = &s161,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t672effect = {
+  .id = "t672effect",
+  .name = "a672",
+  .f = &a672,
+  .next = NULL,
+};
+static struct ufsm_transition * s164_dispatch_1[] = {
+  &t336,
+  NULL,
+};
+static struct ufsm_transition * s164_dispatch_5[] = {
+  &t335,
+  NULL,
+};
+static struct ufsm_dispatch s164_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s164_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s164_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s164_interest[] = {
+  0x000000ab,
+};
+static struct ufsm_state s164 = {
+  .id   = "s164",
+  .name = "S164",
+  .kind = 0,
+  .index = 147,
+  .parent_region = &r32,
+  .entry = &s164entry,
+  .doact = NULL,
+  .exit = &s164exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s164_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s164_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s163,
+};
+static struct ufsm_entry_exit s164entry = {
+  .id = "s164entry",
+  .name = "e164",
+  .f = &e164,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s164exit = {
+  .id = "s164exit",
+  .name = "x164",
+  .f = &x164,
+  .next = NULL,
+};
+static struct ufsm_transition * s163_dispatch_3[] = {
+  &t333,
+  NULL,
+};
+static struct ufsm_transition * s163_dispatch_6[] = {
+  &t334,
+  NULL,
+};
+static struct ufsm_dispatch s163_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s163_dispatch_3,
+},
+{
+  .ev = 6,
+  .transition = s163_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s163_interest[] = {
+  0x000000c9,
+};
+static struct ufsm_state s163 = {
+  .id   = "s163",
+  .name = "S163",
+  .kind = 0,
+  .index = 148,
+  .parent_region = &r32,
+  .entry = &s163entry,
+  .doact = NULL,
+  .exit = &s163exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s163_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s163_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s162,
+};
+static struct ufsm_entry_exit s163entry = {
+  .id = "s163entry",
+  .name = "e163",
+  .f = &e163,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s163exit = {
+  .id = "s163exit",
+  .name = "x163",
+  .f = &x163,
+  .next = NULL,
+};
+static struct ufsm_transition * s162_dispatch_1[] = {
+  &t332,
+  NULL,
+};
+static struct ufsm_transition * s162_dispatch_3[] = {
+  &t331,
+  NULL,
+};
+static struct ufsm_dispatch s162_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s162_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s162_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s162_interest[] = {
+  0x0000008b,
+};
+static struct ufsm_state s162 = {
+  .id   = "s162",
+  .name = "S162",
+  .kind = 0,
+  .index = 149,
+  .parent_region = &r32,
+  .entry = &s162entry,
+  .doact = NULL,
+  .exit = &s162exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s162_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s162_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s161,
+};
+static struct ufsm_entry_exit s162entry = {
+  .id = "s162entry",
+  .name = "e162",
+  .f = &e162,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s162exit = {
+  .id = "s162exit",
+  .name = "x162",
+  .f = &x162,
+  .next = NULL,
+};
+static struct ufsm_transition * s161_dispatch_1[] = {
+  &t330,
+  NULL,
+};
+static struct ufsm_transition * s161_dispatch_4[] = {
+  &t671,
+  NULL,
+};
+static struct ufsm_transition * s161_dispatch_6[] = {
+  &t329,
+  NULL,
+};
+static struct ufsm_dispatch s161_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s161_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s161_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s161_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s161_interest[] = {
+  0x000000db,
+};
+static struct ufsm_state s161 = {
+  .id   = "s161",
+  .name = "S161",
+  .kind = 0,
+  .index = 150,
+  .parent_region = &r32,
+  .entry = &s161entry,
+  .doact = NULL,
+  .exit = &s161exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s161_dispatch,
+  .no_of_dispatch = 3,
+  .flat_dispatch = NULL,
+  .interest = s161_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s370,
+};
+static struct ufsm_entry_exit s161entry = {
+  .id = "s161entry",
+  .name = "e161",
+  .f = &e161,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s161exit = {
+  .id = "s161exit",
+  .name = "x161",
+  .f = &x161,
+  .next = NULL,
+};
+static struct ufsm_dispatch s370_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s370_interest[] = {
+  0x00000089,
+};
+static struct ufsm_state s370 = {
+  .id   = "s370",
+  .name = "(null)",
+  .kind = 10,
+  .index = 151,
+  .parent_region = &r32,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s370_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s370_interest,
+  .time_events = NULL,
+  .completion = &t672,
+  .next = &s160,
+};
+static struct ufsm_dispatch s160_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s160_interest[] = {
+  0x00000089,
+};
+static struct ufsm_state s160 = {
+  .id   = "s160",
+  .name = "Init",
+  .kind = 1,
+  .index = 152,
+  .parent_region = &r32,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s160_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s160_interest,
+  .time_events = NULL,
+  .completion = &t32,
+  .next = NULL,
+};
+static struct ufsm_region r31 = {
+  .id = "r31",
+  .name = "R31",
+  .state = &s159,
+  .has_history = false,
+  .history = NULL,
+  .index = 28,
+  .transition = &t31,
+  .parent_state = &s19,
+  .next = NULL,
+};
+static struct ufsm_transition t31 = {
+  .id = "t31",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 281,
+  .action = &t31effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s155,
+  .dest = &s156,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t321,
+};
+static struct ufsm_action t31effect = {
+  .id = "t31effect",
+  .name = "a31",
+  .f = &a31,
+  .next = NULL,
+};
+static struct ufsm_trigger t321_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t321_exit_path[] = {
+  &r31,
+  NULL,
+};
+static struct ufsm_region * t321_enter_path[] = {
+  &r28,
+  NULL,
+};
+static struct ufsm_transition t321 = {
+  .id = "t321",
+  .name = "",
+  .trigger = t321_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 282,
+  .action = &t321effect,
+  .defer = false,
+  .guard = &t321guard,
+  .source = &s156,
+  .dest = &s141,
+  .lca = &r3,
+  .exit_path = t321_exit_path,
+  .enter_path = t321_enter_path,
+  .next = &t322,
+};
+static struct ufsm_action t321effect = {
+  .id = "t321effect",
+  .name = "a321",
+  .f = &a321,
+  .next = NULL,
+};
+static struct ufsm_guard t321guard = {
+  .id = "t321guard",
+  .name = "g74",
+  .f = &g74,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t322_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t322 = {
+  .id = "t322",
+  .name = "",
+  .trigger = t322_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 283,
+  .action = &t322effect,
+  .defer = false,
+  .guard = &t322guard,
+  .source = &s156,
+  .dest = &s158,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t323,
+};
+static struct ufsm_action t322effect = {
+  .id = "t322effect",
+  .name = "a322",
+  .f = &a322,
+  .next = NULL,
+};
+static struct ufsm_guard t322guard = {
+  .id = "t322guard",
+  .name = "g75",
+  .f = &g75,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t323_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t323 = {
+  .id = "t323",
+  .name = "",
+  .trigger = t323_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 284,
+  .action = &t323effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s157,
+  .dest = &s158,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t324,
+};
+static struct ufsm_action t323effect = {
+  .id = "t323effect",
+  .name = "a323",
+  .f = &a323,
+  .next = NULL,
+};
+static struct ufsm_trigger t324_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t324 = {
+  .id = "t324",
+  .name = "",
+  .trigger = t324_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 285,
+  .action = &t324effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s157,
+  .dest = &s159,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t325,
+};
+static struct ufsm_action t324effect = {
+  .id = "t324effect",
+  .name = "a324",
+  .f = &a324,
+  .next = NULL,
+};
+static struct ufsm_trigger t325_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t325 = {
+  .id = "t325",
+  .name = "",
+  .trigger = t325_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 286,
+  .action = &t325effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s158,
+  .dest = &s157,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t326,
+};
+static struct ufsm_action t325effect = {
+  .id = "t325effect",
+  .name = "a325",
+  .f = &a325,
+  .next = NULL,
+};
+static struct ufsm_trigger t326_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t326 = {
+  .id = "t326",
+  .name = "",
+  .trigger = t326_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 287,
+  .action = &t326effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s158,
+  .dest = &s159,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t327,
+};
+static struct ufsm_action t326effect = {
+  .id = "t326effect",
+  .name = "a326",
+  .f = &a326,
+  .next = NULL,
+};
+static struct ufsm_trigger t327_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t327 = {
+  .id = "t327",
+  .name = "",
+  .trigger = t327_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 288,
+  .action = &t327effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s159,
+  .dest = &s156,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t328,
+};
+static struct ufsm_action t327effect = {
+  .id = "t327effect",
+  .name = "a327",
+  .f = &a327,
+  .next = NULL,
+};
+static struct ufsm_trigger t328_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t328_exit_path[] = {
+  &r31,
+  NULL,
+};
+static struct ufsm_region * t328_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t328 = {
+  .id = "t328",
+  .name = "",
+  .trigger = t328_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 289,
+  .action = &t328effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s159,
+  .dest = &s18,
+  .lca = &r3,
+  .exit_path = t328_exit_path,
+  .enter_path = t328_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t328effect = {
+  .id = "t328effect",
+  .name = "a328",
+  .f = &a328,
+  .next = NULL,
+};
+static struct ufsm_transition * s159_dispatch_3[] = {
+  &t328,
+  NULL,
+};
+static struct ufsm_transition * s159_dispatch_7[] = {
+  &t327,
+  NULL,
+};
+static struct ufsm_dispatch s159_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s159_dispatch_3,
+},
+{
+  .ev = 7,
+  .transition = s159_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s159_interest[] = {
+  0x00000089,
+};
+static struct ufsm_state s159 = {
+  .id   = "s159",
+  .name = "S159",
+  .kind = 0,
+  .index = 153,
+  .parent_region = &r31,
+  .entry = &s159entry,
+  .doact = NULL,
+  .exit = &s159exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s159_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s159_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s158,
+};
+static struct ufsm_entry_exit s159entry = {
+  .id = "s159entry",
+  .name = "e159",
+  .f = &e159,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s159exit = {
+  .id = "s159exit",
+  .name = "x159",
+  .f = &x159,
+  .next = NULL,
+};
+static struct ufsm_transition * s158_dispatch_3[] = {
+  &t325,
+  NULL,
+};
+static struct ufsm_transition * s158_dispatch_7[] = {
+  &t326,
+  NULL,
+};
+static struct ufsm_dispatch s158_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s158_dispatch_3,
+},
+{
+  .ev = 7,
+  .transition = s158_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s158_interest[] = {
+  0x00000089,
+};
+static struct ufsm_state s158 = {
+  .id   = "s158",
+  .name = "S158",
+  .kind = 0,
+  .index = 154,
+  .parent_region = &r31,
+  .entry = &s158entry,
+  .doact = NULL,
+  .exit = &s158exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s158_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s158_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s157,
+};
+static struct ufsm_entry_exit s158entry = {
+  .id = "s158entry",
+  .name = "e158",
+  .f = &e158,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s158exit = {
+  .id = "s158exit",
+  .name = "x158",
+  .f = &x158,
+  .next = NULL,
+};
+static struct ufsm_transition * s157_dispatch_1[] = {
+  &t324,
+  NULL,
+};
+static struct ufsm_transition * s157_dispatch_5[] = {
+  &t323,
+  NULL,
+};
+static struct ufsm_dispatch s157_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s157_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s157_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s157_interest[] = {
+  0x000000ab,
+};
+static struct ufsm_state s157 = {
+  .id   = "s157",
+  .name = "S157",
+  .kind = 0,
+  .index = 155,
+  .parent_region = &r31,
+  .entry = &s157entry,
+  .doact = NULL,
+  .exit = &s157exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s157_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s157_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s156,
+};
+static struct ufsm_entry_exit s157entry = {
+  .id = "s157entry",
+  .name = "e157",
+  .f = &e157,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s157exit = {
+  .id = "s157exit",
+  .name = "x157",
+  .f = &x157,
+  .next = NULL,
+};
+static struct ufsm_transition * s156_dispatch_3[] = {
+  &t322,
+  NULL,
+};
+static struct ufsm_transition * s156_dispatch_6[] = {
+  &t321,
+  NULL,
+};
+static struct ufsm_dispatch s156_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s156_dispatch_3,
+},
+{
+  .ev = 6,
+  .transition = s156_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s156_interest[] = {
+  0x000000c9,
+};
+static struct ufsm_state s156 = {
+  .id   = "s156",
+  .name = "S156",
+  .kind = 0,
+  .index = 156,
+  .parent_region = &r31,
+  .entry = &s156entry,
+  .doact = NULL,
+  .exit = &s156exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s156_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s156_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s155,
+};
+static struct ufsm_entry_exit s156entry = {
+  .id = "s156entry",
+  .name = "e156",
+  .f = &e156,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s156exit = {
+  .id = "s156exit",
+  .name = "x156",
+  .f = &x156,
+  .next = NULL,
+};
+static struct ufsm_dispatch s155_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s155_interest[] = {
+  0x00000089,
+};
+static struct ufsm_state s155 = {
+  .id   = "s155",
+  .name = "Init",
+  .kind = 1,
+  .index = 157,
+  .parent_region = &r31,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s155_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s155_interest,
+  .time_events = NULL,
+  .completion = &t31,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s19entry = {
+  .id = "s19entry",
+  .name = "e19",
+  .f = &e19,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s19exit = {
+  .id = "s19exit",
+  .name = "x19",
+  .f = &x19,
+  .next = NULL,
+};
+static struct ufsm_transition * s18_dispatch_0[] = {
+  &t101,
+  NULL,
+};
+static struct ufsm_transition * s18_dispatch_2[] = {
+  &t102,
+  NULL,
+};
+static struct ufsm_dispatch s18_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s18_dispatch_0,
+},
+{
+  .ev = 2,
+  .transition = s18_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s18_interest[] = {
+  0x0000000d,
+};
+static struct ufsm_state s18 = {
+  .id   = "s18",
+  .name = "S18",
+  .kind = 0,
+  .index = 113,
+  .parent_region = &r3,
+  .entry = &s18entry,
+  .doact = NULL,
+  .exit = &s18exit,
+  .region = &r30,
+  .submachine = NULL,
+  .dispatch = s18_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s18_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s17,
+};
+static struct ufsm_region r30 = {
+  .id = "r30",
+  .name = "R30",
+  .state = &s154,
+  .has_history = false,
+  .history = NULL,
+  .index = 25,
+  .transition = &t30,
+  .parent_state = &s18,
+  .next = &r29,
+};
+static struct ufsm_transition t30 = {
+  .id = "t30",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 252,
+  .action = &t30effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s150,
+  .dest = &s153,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t313,
+};
+static struct ufsm_action t30effect = {
+  .id = "t30effect",
+  .name = "a30",
+  .f = &a30,
+  .next = NULL,
+};
+static struct ufsm_trigger t313_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t313 = {
+  .id = "t313",
+  .name = "",
+  .trigger = t313_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 253,
+  .action = &t313effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s151,
+  .dest = &s152,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t314,
+};
+static struct ufsm_action t313effect = {
+  .id = "t313effect",
+  .name = "a313",
+  .f = &a313,
+  .next = NULL,
+};
+static struct ufsm_trigger t314_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t314_exit_path[] = {
+  &r30,
+  NULL,
+};
+static struct ufsm_region * t314_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t314 = {
+  .id = "t314",
+  .name = "",
+  .trigger = t314_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 254,
+  .action = &t314effect,
+  .defer = false,
+  .guard = &t314guard,
+  .source = &s151,
+  .dest = &s17,
+  .lca = &r3,
+  .exit_path = t314_exit_path,
+  .enter_path = t314_enter_path,
+  .next = &t315,
+};
+static struct ufsm_action t314effect = {
+  .id = "t314effect",
+  .name = "a314",
+  .f = &a314,
+  .next = NULL,
+};
+static struct ufsm_guard t314guard = {
+  .id = "t314guard",
+  .name = "g71",
+  .f = &g71,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t315_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t315 = {
+  .id = "t315",
+  .name = "",
+  .trigger = t315_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 255,
+  .action = &t315effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s152,
+  .dest = &s153,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t316,
+};
+static struct ufsm_action t315effect = {
+  .id = "t315effect",
+  .name = "a315",
+  .f = &a315,
+  .next = NULL,
+};
+static struct ufsm_trigger t316_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t316 = {
+  .id = "t316",
+  .name = "",
+  .trigger = t316_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 256,
+  .action = &t316effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s152,
+  .dest = &s151,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t317,
+};
+static struct ufsm_action t316effect = {
+  .id = "t316effect",
+  .name = "a316",
+  .f = &a316,
+  .next = NULL,
+};
+static struct ufsm_trigger t317_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t317 = {
+  .id = "t317",
+  .name = "",
+  .trigger = t317_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 257,
+  .action = &t317effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s153,
+  .dest = &s152,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t318,
+};
+static struct ufsm_action t317effect = {
+  .id = "t317effect",
+  .name = "a317",
+  .f = &a317,
+  .next = NULL,
+};
+static struct ufsm_trigger t318_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t318 = {
+  .id = "t318",
+  .name = "",
+  .trigger = t318_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 258,
+  .action = &t318effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s153,
+  .dest = &s153,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t319,
+};
+static struct ufsm_action t318effect = {
+  .id = "t318effect",
+  .name = "a318",
+  .f = &a318,
+  .next = NULL,
+};
+static struct ufsm_trigger t319_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t319 = {
+  .id = "t319",
+  .name = "",
+  .trigger = t319_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 259,
+  .action = &t319effect,
+  .defer = false,
+  .guard = &t319guard,
+  .source = &s154,
+  .dest = &s153,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t320,
+};
+static struct ufsm_action t319effect = {
+  .id = "t319effect",
+  .name = "a319",
+  .f = &a319,
+  .next = NULL,
+};
+static struct ufsm_guard t319guard = {
+  .id = "t319guard",
+  .name = "g72",
+  .f = &g72,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t320_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t320 = {
+  .id = "t320",
+  .name = "",
+  .trigger = t320_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 260,
+  .action = &t320effect,
+  .defer = false,
+  .guard = &t320guard,
+  .source = &s154,
+  .dest = &s154,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t320effect = {
+  .id = "t320effect",
+  .name = "a320",
+  .f = &a320,
+  .next = NULL,
+};
+static struct ufsm_guard t320guard = {
+  .id = "t320guard",
+  .name = "g73",
+  .f = &g73,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s154_dispatch_2[] = {
+  &t319,
+  &t320,
+  NULL,
+};
+static struct ufsm_dispatch s154_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s154_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s154_interest[] = {
+  0x0000000d,
+};
+static struct ufsm_state s154 = {
+  .id   = "s154",
+  .name = "S154",
+  .kind = 0,
+  .index = 137,
+  .parent_region = &r30,
+  .entry = &s154entry,
+  .doact = NULL,
+  .exit = &s154exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s154_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s154_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s153,
+};
+static struct ufsm_entry_exit s154entry = {
+  .id = "s154entry",
+  .name = "e154",
+  .f = &e154,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s154exit = {
+  .id = "s154exit",
+  .name = "x154",
+  .f = &x154,
+  .next = NULL,
+};
+static struct ufsm_transition * s153_dispatch_6[] = {
+  &t318,
+  NULL,
+};
+static struct ufsm_transition * s153_dispatch_7[] = {
+  &t317,
+  NULL,
+};
+static struct ufsm_dispatch s153_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s153_dispatch_6,
+},
+{
+  .ev = 7,
+  .transition = s153_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s153_interest[] = {
+  0x000000cd,
+};
+static struct ufsm_state s153 = {
+  .id   = "s153",
+  .name = "S153",
+  .kind = 0,
+  .index = 138,
+  .parent_region = &r30,
+  .entry = &s153entry,
+  .doact = NULL,
+  .exit = &s153exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s153_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s153_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s152,
+};
+static struct ufsm_entry_exit s153entry = {
+  .id = "s153entry",
+  .name = "e153",
+  .f = &e153,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s153exit = {
+  .id = "s153exit",
+  .name = "x153",
+  .f = &x153,
+  .next = NULL,
+};
+static struct ufsm_transition * s152_dispatch_0[] = {
+  &t315,
+  NULL,
+};
+static struct ufsm_transition * s152_dispatch_4[] = {
+  &t316,
+  NULL,
+};
+static struct ufsm_dispatch s152_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s152_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s152_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s152_interest[] = {
+  0x0000001d,
+};
+static struct ufsm_state s152 = {
+  .id   = "s152",
+  .name = "S152",
+  .kind = 0,
+  .index = 139,
+  .parent_region = &r30,
+  .entry = &s152entry,
+  .doact = NULL,
+  .exit = &s152exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s152_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s152_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s151,
+};
+static struct ufsm_entry_exit s152entry = {
+  .id = "s152entry",
+  .name = "e152",
+  .f = &e152,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s152exit = {
+  .id = "s152exit",
+  .name = "x152",
+  .f = &x152,
+  .next = NULL,
+};
+static struct ufsm_transition * s151_dispatch_2[] = {
+  &t314,
+  NULL,
+};
+static struct ufsm_transition * s151_dispatch_6[] = {
+  &t313,
+  NULL,
+};
+static struct ufsm_dispatch s151_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s151_dispatch_2,
+},
+{
+  .ev = 6,
+  .transition = s151_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s151_interest[] = {
+  0x0000004d,
+};
+static struct ufsm_state s151 = {
+  .id   = "s151",
+  .name = "S151",
+  .kind = 0,
+  .index = 140,
+  .parent_region = &r30,
+  .entry = &s151entry,
+  .doact = NULL,
+  .exit = &s151exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s151_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s151_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s150,
+};
+static struct ufsm_entry_exit s151entry = {
+  .id = "s151entry",
+  .name = "e151",
+  .f = &e151,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s151exit = {
+  .id = "s151exit",
+  .name = "x151",
+  .f = &x151,
+  .next = NULL,
+};
+static struct ufsm_dispatch s150_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s150_interest[] = {
+  0x0000000d,
+};
+static struct ufsm_state s150 = {
+  .id   = "s150",
+  .name = "Init",
+  .kind = 1,
+  .index = 141,
+  .parent_region = &r30,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s150_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s150_interest,
+  .time_events = NULL,
+  .completion = &t30,
+  .next = NULL,
+};
+static struct ufsm_region r29 = {
+  .id = "r29",
+  .name = "R29",
+  .state = &s149,
+  .has_history = false,
+  .history = NULL,
+  .index = 26,
+  .transition = &t29,
+  .parent_state = &s18,
+  .next = NULL,
+};
+static struct ufsm_transition t29 = {
+  .id = "t29",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 261,
+  .action = &t29effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s145,
+  .dest = &s147,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t305,
+};
+static struct ufsm_action t29effect = {
+  .id = "t29effect",
+  .name = "a29",
+  .f = &a29,
+  .next = NULL,
+};
+static struct ufsm_trigger t305_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t305 = {
+  .id = "t305",
+  .name = "",
+  .trigger = t305_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 262,
+  .action = &t305effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s146,
+  .dest = &s148,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t306,
+};
+static struct ufsm_action t305effect = {
+  .id = "t305effect",
+  .name = "a305",
+  .f = &a305,
+  .next = NULL,
+};
+static struct ufsm_trigger t306_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t306 = {
+  .id = "t306",
+  .name = "",
+  .trigger = t306_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 263,
+  .action = &t306effect,
+  .defer = false,
+  .guard = &t306guard,
+  .source = &s146,
+  .dest = &s148,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t307,
+};
+static struct ufsm_action t306effect = {
+  .id = "t306effect",
+  .name = "a306",
+  .f = &a306,
+  .next = NULL,
+};
+static struct ufsm_guard t306guard = {
+  .id = "t306guard",
+  .name = "g69",
+  .f = &g69,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t307_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t307 = {
+  .id = "t307",
+  .name = "",
+  .trigger = t307_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 264,
+  .action = &t307effect,
+  .defer = false,
+  .guard = &t307guard,
+  .source = &s147,
+  .dest = &s149,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t308,
+};
+static struct ufsm_action t307effect = {
+  .id = "t307effect",
+  .name = "a307",
+  .f = &a307,
+  .next = NULL,
+};
+static struct ufsm_guard t307guard = {
+  .id = "t307guard",
+  .name = "g70",
+  .f = &g70,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t308_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t308 = {
+  .id = "t308",
+  .name = "",
+  .trigger = t308_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 265,
+  .action = &t308effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s147,
+  .dest = &s147,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t309,
+};
+static struct ufsm_action t308effect = {
+  .id = "t308effect",
+  .name = "a308",
+  .f = &a308,
+  .next = NULL,
+};
+static struct ufsm_trigger t309_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t309_exit_path[] = {
+  &r29,
+  NULL,
+};
+static struct ufsm_region * t309_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t309 = {
+  .id = "t309",
+  .name = "",
+  .trigger = t309_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 266,
+  .action = &t309effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s148,
+  .dest = &s16,
+  .lca = &r3,
+  .exit_path = t309_exit_path,
+  .enter_path = t309_enter_path,
+  .next = &t310,
+};
+static struct ufsm_action t309effect = {
+  .id = "t309effect",
+  .name = "a309",
+  .f = &a309,
+  .next = NULL,
+};
+static struct ufsm_trigger t310_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t310_exit_path[] = {
+  &r29,
+  NULL,
+};
+static struct ufsm_region * t310_enter_path[] = {
+  &r25,
+  NULL,
+};
+static struct ufsm_transition t310 = {
+  .id = "t310",
+  .name = "",
+  .trigger = t310_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 267,
+  .action = &t310effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s148,
+  .dest = &s126,
+  .lca = &r3,
+  .exit_path = t310_exit_path,
+  .enter_path = t310_enter_path,
+  .next = &t311,
+};
+static struct ufsm_action t310effect = {
+  .id = "t310effect",
+  .name = "a310",
+  .f = &a310,
+  .next = NULL,
+};
+static struct ufsm_trigger t311_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t311 = {
+  .id = "t311",
+  .name = "",
+  .trigger = t311_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 268,
+  .action = &t311effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s149,
+  .dest = &s148,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t312,
+};
+static struct ufsm_action t311effect = {
+  .id = "t311effect",
+  .name = "a311",
+  .f = &a311,
+  .next = NULL,
+};
+static struct ufsm_trigger t312_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t312 = {
+  .id = "t312",
+  .name = "",
+  .trigger = t312_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 269,
+  .action = &t312effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s149,
+  .dest = &s146,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t312effect = {
+  .id = "t312effect",
+  .name = "a312",
+  .f = &a312,
+  .next = NULL,
+};
+static struct ufsm_transition * s149_dispatch_2[] = {
+  &t312,
+  NULL,
+};
+static struct ufsm_transition * s149_dispatch_6[] = {
+  &t311,
+  NULL,
+};
+static struct ufsm_dispatch s149_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s149_dispatch_2,
+},
+{
+  .ev = 6,
+  .transition = s149_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s149_interest[] = {
+  0x0000004d,
+};
+static struct ufsm_state s149 = {
+  .id   = "s149",
+  .name = "S149",
+  .kind = 0,
+  .index = 142,
+  .parent_region = &r29,
+  .entry = &s149entry,
+  .doact = NULL,
+  .exit = &s149exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s149_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s149_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s148,
+};
+static struct ufsm_entry_exit s149entry = {
+  .id = "s149entry",
+  .name = "e149",
+  .f = &e149,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s149exit = {
+  .id = "s149exit",
+  .name = "x149",
+  .f = &x149,
+  .next = NULL,
+};
+static struct ufsm_transition * s148_dispatch_3[] = {
+  &t309,
+  NULL,
+};
+static struct ufsm_transition * s148_dispatch_7[] = {
+  &t310,
+  NULL,
+};
+static struct ufsm_dispatch s148_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s148_dispatch_3,
+},
+{
+  .ev = 7,
+  .transition = s148_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s148_interest[] = {
+  0x0000008d,
+};
+static struct ufsm_state s148 = {
+  .id   = "s148",
+  .name = "S148",
+  .kind = 0,
+  .index = 143,
+  .parent_region = &r29,
+  .entry = &s148entry,
+  .doact = NULL,
+  .exit = &s148exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s148_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s148_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s147,
+};
+static struct ufsm_entry_exit s148entry = {
+  .id = "s148entry",
+  .name = "e148",
+  .f = &e148,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s148exit = {
+  .id = "s148exit",
+  .name = "x148",
+  .f = &x148,
+  .next = NULL,
+};
+static struct ufsm_transition * s147_dispatch_3[] = {
+  &t308,
+  NULL,
+};
+static struct ufsm_transition * s147_dispatch_5[] = {
+  &t307,
+  NULL,
+};
+static struct ufsm_dispatch s147_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s147_dispatch_3,
+},
+{
+  .ev = 5,
+  .transition = s147_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s147_interest[] = {
+  0x0000002d,
+};
+static struct ufsm_state s147 = {
+  .id   = "s147",
+  .name = "S147",
+  .kind = 0,
+  .index = 144,
+  .parent_region = &r29,
+  .entry = &s147entry,
+  .doact = NULL,
+  .exit = &s147exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s147_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s147_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s146,
+};
+static struct ufsm_entry_exit s147entry = {
+  .id = "s147entry",
+  .name = "e147",
+  .f = &e147,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s147exit = {
+  .id = "s147exit",
+  .name = "x147",
+  .f = &x147,
+  .next = NULL,
+};
+static struct ufsm_transition * s146_dispatch_0[] = {
+  &t306,
+  NULL,
+};
+static struct ufsm_transition * s146_dispatch_2[] = {
+  &t305,
+  NULL,
+};
+static struct ufsm_dispatch s146_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s146_dispatch_0,
+},
+{
+  .ev = 2,
+  .transition = s146_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s146_interest[] = {
+  0x0000000d,
+};
+static struct ufsm_state s146 = {
+  .id   = "s146",
+  .name = "S146",
+  .kind = 0,
+  .index = 145,
+  .parent_region = &r29,
+  .entry = &s146entry,
+  .doact = NULL,
+  .exit = &s146exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s146_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s146_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s145,
+};
+static struct ufsm_entry_exit s146entry = {
+  .id = "s146entry",
+  .name = "e146",
+  .f = &e146,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s146exit = {
+  .id = "s146exit",
+  .name = "x146",
+  .f = &x146,
+  .next = NULL,
+};
+static struct ufsm_dispatch s145_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s145_interest[] = {
+  0x0000000d,
+};
+static struct ufsm_state s145 = {
+  .id   = "s145",
+  .name = "Init",
+  .kind = 1,
+  .index = 146,
+  .parent_region = &r29,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s145_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s145_interest,
+  .time_events = NULL,
+  .completion = &t29,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s18entry = {
+  .id = "s18entry",
+  .name = "e18",
+  .f = &e18,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s18exit = {
+  .id = "s18exit",
+  .name = "x18",
+  .f = &x18,
+  .next = NULL,
+};
+static struct ufsm_transition * s17_dispatch_0[] = {
+  &t99,
+  NULL,
+};
+static struct ufsm_transition * s17_dispatch_3[] = {
+  &t100,
+  NULL,
+};
+static struct ufsm_dispatch s17_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s17_dispatch_0,
+},
+{
+  .ev = 3,
+  .transition = s17_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s17_interest[] = {
+  0x00000009,
+};
+static struct ufsm_state s17 = {
+  .id   = "s17",
+  .name = "S17",
+  .kind = 0,
+  .index = 114,
+  .parent_region = &r3,
+  .entry = &s17entry,
+  .doact = NULL,
+  .exit = &s17exit,
+  .region = &r28,
+  .submachine = NULL,
+  .dispatch = s17_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s17_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s16,
+};
+static struct ufsm_region r28 = {
+  .id = "r28",
+  .name = "R28",
+  .state = &s144,
+  .has_history = false,
+  .history = NULL,
+  .index = 23,
+  .transition = &t28,
+  .parent_state = &s17,
+  .next = &r27,
+};
+static struct ufsm_transition t28 = {
+  .id = "t28",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 234,
+  .action = &t28effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s140,
+  .dest = &s142,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t297,
+};
+static struct ufsm_action t28effect = {
+  .id = "t28effect",
+  .name = "a28",
+  .f = &a28,
+  .next = NULL,
+};
+static struct ufsm_trigger t297_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t297 = {
+  .id = "t297",
+  .name = "",
+  .trigger = t297_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 235,
+  .action = &t297effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s141,
+  .dest = &s141,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t298,
+};
+static struct ufsm_action t297effect = {
+  .id = "t297effect",
+  .name = "a297",
+  .f = &a297,
+  .next = NULL,
+};
+static struct ufsm_trigger t298_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t298 = {
+  .id = "t298",
+  .name = "",
+  .trigger = t298_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 236,
+  .action = &t298effect,
+  .defer = false,
+  .guard = &t298guard,
+  .source = &s141,
+  .dest = &s141,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t299,
+};
+static struct ufsm_action t298effect = {
+  .id = "t298effect",
+  .name = "a298",
+  .f = &a298,
+  .next = NULL,
+};
+static struct ufsm_guard t298guard = {
+  .id = "t298guard",
+  .name = "g67",
+  .f = &g67,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t299_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t299 = {
+  .id = "t299",
+  .name = "",
+  .trigger = t299_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 237,
+  .action = &t299effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s142,
+  .dest = &s141,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t300,
+};
+static struct ufsm_action t299effect = {
+  .id = "t299effect",
+  .name = "a299",
+  .f = &a299,
+  .next = NULL,
+};
+static struct ufsm_trigger t300_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t300 = {
+  .id = "t300",
+  .name = "",
+  .trigger = t300_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 238,
+  .action = &t300effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s142,
+  .dest = &s143,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t301,
+};
+static struct ufsm_action t300effect = {
+  .id = "t300effect",
+  .name = "a300",
+  .f = &a300,
+  .next = NULL,
+};
+static struct ufsm_trigger t301_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t301 = {
+  .id = "t301",
+  .name = "",
+  .trigger = t301_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 239,
+  .action = &t301effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s143,
+  .dest = &s141,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t302,
+};
+static struct ufsm_action t301effect = {
+  .id = "t301effect",
+  .name = "a301",
+  .f = &a301,
+  .next = NULL,
+};
+static struct ufsm_trigger t302_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t302 = {
+  .id = "t302",
+  .name = "",
+  .trigger = t302_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 240,
+  .action = &t302effect,
+  .defer = false,
+  .guard = &t302guard,
+  .source = &s143,
+  .dest = &s141,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t303,
+};
+static struct ufsm_action t302effect = {
+  .id = "t302effect",
+  .name = "a302",
+  .f = &a302,
+  .next = NULL,
+};
+static struct ufsm_guard t302guard = {
+  .id = "t302guard",
+  .name = "g68",
+  .f = &g68,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t303_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t303 = {
+  .id = "t303",
+  .name = "",
+  .trigger = t303_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 241,
+  .action = &t303effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s144,
+  .dest = &s144,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t304,
+};
+static struct ufsm_action t303effect = {
+  .id = "t303effect",
+  .name = "a303",
+  .f = &a303,
+  .next = NULL,
+};
+static struct ufsm_trigger t304_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t304 = {
+  .id = "t304",
+  .name = "",
+  .trigger = t304_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 242,
+  .action = &t304effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s144,
+  .dest = &s141,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t304effect = {
+  .id = "t304effect",
+  .name = "a304",
+  .f = &a304,
+  .next = NULL,
+};
+static struct ufsm_transition * s144_dispatch_0[] = {
+  &t304,
+  NULL,
+};
+static struct ufsm_transition * s144_dispatch_5[] = {
+  &t303,
+  NULL,
+};
+static struct ufsm_dispatch s144_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s144_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s144_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s144_interest[] = {
+  0x00000029,
+};
+static struct ufsm_state s144 = {
+  .id   = "s144",
+  .name = "S144",
+  .kind = 0,
+  .index = 127,
+  .parent_region = &r28,
+  .entry = &s144entry,
+  .doact = NULL,
+  .exit = &s144exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s144_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s144_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s143,
+};
+static struct ufsm_entry_exit s144entry = {
+  .id = "s144entry",
+  .name = "e144",
+  .f = &e144,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s144exit = {
+  .id = "s144exit",
+  .name = "x144",
+  .f = &x144,
+  .next = NULL,
+};
+static struct ufsm_transition * s143_dispatch_4[] = {
+  &t302,
+  NULL,
+};
+static struct ufsm_transition * s143_dispatch_7[] = {
+  &t301,
+  NULL,
+};
+static struct ufsm_dispatch s143_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s143_dispatch_4,
+},
+{
+  .ev = 7,
+  .transition = s143_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s143_interest[] = {
+  0x00000099,
+};
+static struct ufsm_state s143 = {
+  .id   = "s143",
+  .name = "S143",
+  .kind = 0,
+  .index = 128,
+  .parent_region = &r28,
+  .entry = &s143entry,
+  .doact = NULL,
+  .exit = &s143exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s143_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s143_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s142,
+};
+static struct ufsm_entry_exit s143entry = {
+  .id = "s143entry",
+  .name = "e143",
+  .f = &e143,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s143exit = {
+  .id = "s143exit",
+  .name = "x143",
+  .f = &x143,
+  .next = NULL,
+};
+static struct ufsm_transition * s142_dispatch_1[] = {
+  &t300,
+  NULL,
+};
+static struct ufsm_transition * s142_dispatch_4[] = {
+  &t299,
+  NULL,
+};
+static struct ufsm_dispatch s142_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s142_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s142_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s142_interest[] = {
+  0x0000001b,
+};
+static struct ufsm_state s142 = {
+  .id   = "s142",
+  .name = "S142",
+  .kind = 0,
+  .index = 129,
+  .parent_region = &r28,
+  .entry = &s142entry,
+  .doact = NULL,
+  .exit = &s142exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s142_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s142_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s141,
+};
+static struct ufsm_entry_exit s142entry = {
+  .id = "s142entry",
+  .name = "e142",
+  .f = &e142,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s142exit = {
+  .id = "s142exit",
+  .name = "x142",
+  .f = &x142,
+  .next = NULL,
+};
+static struct ufsm_transition * s141_dispatch_1[] = {
+  &t297,
+  NULL,
+};
+static struct ufsm_transition * s141_dispatch_3[] = {
+  &t298,
+  NULL,
+};
+static struct ufsm_dispatch s141_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s141_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s141_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s141_interest[] = {
+  0x0000000b,
+};
+static struct ufsm_state s141 = {
+  .id   = "s141",
+  .name = "S141",
+  .kind = 0,
+  .index = 130,
+  .parent_region = &r28,
+  .entry = &s141entry,
+  .doact = NULL,
+  .exit = &s141exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s141_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s141_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s140,
+};
+static struct ufsm_entry_exit s141entry = {
+  .id = "s141entry",
+  .name = "e141",
+  .f = &e141,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s141exit = {
+  .id = "s141exit",
+  .name = "x141",
+  .f = &x141,
+  .next = NULL,
+};
+static struct ufsm_dispatch s140_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s140_interest[] = {
+  0x00000009,
+};
+static struct ufsm_state s140 = {
+  .id   = "s140",
+  .name = "Init",
+  .kind = 1,
+  .index = 131,
+  .parent_region = &r28,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s140_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s140_interest,
+  .time_events = NULL,
+  .completion = &t28,
+  .next = NULL,
+};
+static struct ufsm_region r27 = {
+  .id = "r27",
+  .name = "R27",
+  .state = &s139,
+  .has_history = false,
+  .history = NULL,
+  .index = 24,
+  .transition = &t27,
+  .parent_state = &s17,
+  .next = NULL,
+};
+static struct ufsm_transition t27 = {
+  .id = "t27",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 243,
+  .action = &t27effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s135,
+  .dest = &s137,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t289,
+};
+static struct ufsm_action t27effect = {
+  .id = "t27effect",
+  .name = "a27",
+  .f = &a27,
+  .next = NULL,
+};
+static struct ufsm_trigger t289_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t289 = {
+  .id = "t289",
+  .name = "",
+  .trigger = t289_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 244,
+  .action = &t289effect,
+  .defer = false,
+  .guard = &t289guard,
+  .source = &s136,
+  .dest = &s138,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t290,
+};
+static struct ufsm_action t289effect = {
+  .id = "t289effect",
+  .name = "a289",
+  .f = &a289,
+  .next = NULL,
+};
+static struct ufsm_guard t289guard = {
+  .id = "t289guard",
+  .name = "g64",
+  .f = &g64,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t290_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t290 = {
+  .id = "t290",
+  .name = "",
+  .trigger = t290_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 245,
+  .action = &t290effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s136,
+  .dest = &s136,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t291,
+};
+static struct ufsm_action t290effect = {
+  .id = "t290effect",
+  .name = "a290",
+  .f = &a290,
+  .next = NULL,
+};
+static struct ufsm_trigger t291_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t291 = {
+  .id = "t291",
+  .name = "",
+  .trigger = t291_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 246,
+  .action = &t291effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s137,
+  .dest = &s137,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t292,
+};
+static struct ufsm_action t291effect = {
+  .id = "t291effect",
+  .name = "a291",
+  .f = &a291,
+  .next = NULL,
+};
+static struct ufsm_trigger t292_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t292 = {
+  .id = "t292",
+  .name = "",
+  .trigger = t292_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 247,
+  .action = &t292effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s137,
+  .dest = &s136,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t293,
+};
+static struct ufsm_action t292effect = {
+  .id = "t292effect",
+  .name = "a292",
+  .f = &a292,
+  .next = NULL,
+};
+static struct ufsm_trigger t293_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t293_exit_path[] = {
+  &r27,
+  NULL,
+};
+static struct ufsm_region * t293_enter_path[] = {
+  &r26,
+  NULL,
+};
+static struct ufsm_transition t293 = {
+  .id = "t293",
+  .name = "",
+  .trigger = t293_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 248,
+  .action = &t293effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s138,
+  .dest = &s133,
+  .lca = &r3,
+  .exit_path = t293_exit_path,
+  .enter_path = t293_enter_path,
+  .next = &t294,
+};
+static struct ufsm_action t293effect = {
+  .id = "t293effect",
+  .name = "a293",
+  .f = &a293,
+  .next = NULL,
+};
+static struct ufsm_trigger t294_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t294_exit_path[] = {
+  &r27,
+  NULL,
+};
+static struct ufsm_region * t294_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t294 = {
+  .id = "t294",
+  .name = "",
+  .trigger = t294_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 249,
+  .action = &t294effect,
+  .defer = false,
+  .guard = &t294guard,
+  .source = &s138,
+  .dest = &s16,
+  .lca = &r3,
+  .exit_path = t294_exit_path,
+  .enter_path = t294_enter_path,
+  .next = &t295,
+};
+static struct ufsm_action t294effect = {
+  .id = "t294effect",
+  .name = "a294",
+  .f = &a294,
+  .next = NULL,
+};
+static struct ufsm_guard t294guard = {
+  .id = "t294guard",
+  .name = "g65",
+  .f = &g65,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t295_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t295 = {
+  .id = "t295",
+  .name = "",
+  .trigger = t295_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 250,
+  .action = &t295effect,
+  .defer = false,
+  .guard = &t295guard,
+  .source = &s139,
+  .dest = &s136,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t296,
+};
+static struct ufsm_action t295effect = {
+  .id = "t295effect",
+  .name = "a295",
+  .f = &a295,
+  .next = NULL,
+};
+static struct ufsm_guard t295guard = {
+  .id = "t295guard",
+  .name = "g66",
+  .f = &g66,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t296_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t296 = {
+  .id = "t296",
+  .name = "",
+  .trigger = t296_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 251,
+  .action = &t296effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s139,
+  .dest = &s136,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t296effect = {
+  .id = "t296effect",
+  .name = "a296",
+  .f = &a296,
+  .next = NULL,
+};
+static struct ufsm_transition * s139_dispatch_0[] = {
+  &t296,
+  NULL,
+};
+static struct ufsm_transition * s139_dispatch_5[] = {
+  &t295,
+  NULL,
+};
+static struct ufsm_dispatch s139_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s139_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s139_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s139_interest[] = {
+  0x00000029,
+};
+static struct ufsm_state s139 = {
+  .id   = "s139",
+  .name = "S139",
+  .kind = 0,
+  .index = 132,
+  .parent_region = &r27,
+  .entry = &s139entry,
+  .doact = NULL,
+  .exit = &s139exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s139_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s139_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s138,
+};
+static struct ufsm_entry_exit s139entry = {
+  .id = "s139entry",
+  .name = "e139",
+  .f = &e139,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s139exit = {
+  .id = "s139exit",
+  .name = "x139",
+  .f = &x139,
+  .next = NULL,
+};
+static struct ufsm_transition * s138_dispatch_5[] = {
+  &t294,
+  NULL,
+};
+static struct ufsm_transition * s138_dispatch_6[] = {
+  &t293,
+  NULL,
+};
+static struct ufsm_dispatch s138_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s138_dispatch_5,
+},
+{
+  .ev = 6,
+  .transition = s138_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s138_interest[] = {
+  0x00000069,
+};
+static struct ufsm_state s138 = {
+  .id   = "s138",
+  .name = "S138",
+  .kind = 0,
+  .index = 133,
+  .parent_region = &r27,
+  .entry = &s138entry,
+  .doact = NULL,
+  .exit = &s138exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s138_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s138_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s137,
+};
+static struct ufsm_entry_exit s138entry = {
+  .id = "s138entry",
+  .name = "e138",
+  .f = &e138,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s138exit = {
+  .id = "s138exit",
+  .name = "x138",
+  .f = &x138,
+  .next = NULL,
+};
+static struct ufsm_transition * s137_dispatch_4[] = {
+  &t292,
+  NULL,
+};
+static struct ufsm_transition * s137_dispatch_6[] = {
+  &t291,
+  NULL,
+};
+static struct ufsm_dispatch s137_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s137_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s137_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s137_interest[] = {
+  0x00000059,
+};
+static struct ufsm_state s137 = {
+  .id   = "s137",
+  .name = "S137",
+  .kind = 0,
+  .index = 134,
+  .parent_region = &r27,
+  .entry = &s137entry,
+  .doact = NULL,
+  .exit = &s137exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s137_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s137_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s136,
+};
+static struct ufsm_entry_exit s137entry = {
+  .id = "s137entry",
+  .name = "e137",
+  .f = &e137,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s137exit = {
+  .id = "s137exit",
+  .name = "x137",
+  .f = &x137,
+  .next = NULL,
+};
+static struct ufsm_transition * s136_dispatch_0[] = {
+  &t289,
+  NULL,
+};
+static struct ufsm_transition * s136_dispatch_4[] = {
+  &t290,
+  NULL,
+};
+static struct ufsm_dispatch s136_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s136_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s136_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s136_interest[] = {
+  0x00000019,
+};
+static struct ufsm_state s136 = {
+  .id   = "s136",
+  .name = "S136",
+  .kind = 0,
+  .index = 135,
+  .parent_region = &r27,
+  .entry = &s136entry,
+  .doact = NULL,
+  .exit = &s136exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s136_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s136_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s135,
+};
+static struct ufsm_entry_exit s136entry = {
+  .id = "s136entry",
+  .name = "e136",
+  .f = &e136,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s136exit = {
+  .id = "s136exit",
+  .name = "x136",
+  .f = &x136,
+  .next = NULL,
+};
+static struct ufsm_dispatch s135_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s135_interest[] = {
+  0x00000009,
+};
+static struct ufsm_state s135 = {
+  .id   = "s135",
+  .name = "Init",
+  .kind = 1,
+  .index = 136,
+  .parent_region = &r27,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s135_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s135_interest,
+  .time_events = NULL,
+  .completion = &t27,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s17entry = {
+  .id = "s17entry",
+  .name = "e17",
+  .f = &e17,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s17exit = {
+  .id = "s17exit",
+  .name = "x17",
+  .f = &x17,
+  .next = NULL,
+};
+static struct ufsm_transition * s16_dispatch_0[] = {
+  &t97,
+  NULL,
+};
+static struct ufsm_transition * s16_dispatch_6[] = {
+  &t98,
+  NULL,
+};
+static struct ufsm_dispatch s16_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s16_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s16_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s16_interest[] = {
+  0x00000049,
+};
+static struct ufsm_state s16 = {
+  .id   = "s16",
+  .name = "S16",
+  .kind = 0,
+  .index = 115,
+  .parent_region = &r3,
+  .entry = &s16entry,
+  .doact = NULL,
+  .exit = &s16exit,
+  .region = &r26,
+  .submachine = NULL,
+  .dispatch = s16_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s16_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s15,
+};
+static struct ufsm_region r26 = {
+  .id = "r26",
+  .name = "R26",
+  .state = &s134,
+  .has_history = false,
+  .history = NULL,
+  .index = 21,
+  .transition = &t26,
+  .parent_state = &s16,
+  .next = &r25,
+};
+static struct ufsm_transition t26 = {
+  .id = "t26",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 216,
+  .action = &t26effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s130,
+  .dest = &s133,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t281,
+};
+static struct ufsm_action t26effect = {
+  .id = "t26effect",
+  .name = "a26",
+  .f = &a26,
+  .next = NULL,
+};
+static struct ufsm_trigger t281_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t281 = {
+  .id = "t281",
+  .name = "",
+  .trigger = t281_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 217,
+  .action = &t281effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s131,
+  .dest = &s132,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t282,
+};
+static struct ufsm_action t281effect = {
+  .id = "t281effect",
+  .name = "a281",
+  .f = &a281,
+  .next = NULL,
+};
+static struct ufsm_trigger t282_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t282_exit_path[] = {
+  &r26,
+  NULL,
+};
+static struct ufsm_region * t282_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t282 = {
+  .id = "t282",
+  .name = "",
+  .trigger = t282_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 218,
+  .action = &t282effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s131,
+  .dest = &s17,
+  .lca = &r3,
+  .exit_path = t282_exit_path,
+  .enter_path = t282_enter_path,
+  .next = &t283,
+};
+static struct ufsm_action t282effect = {
+  .id = "t282effect",
+  .name = "a282",
+  .f = &a282,
+  .next = NULL,
+};
+static struct ufsm_trigger t283_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t283 = {
+  .id = "t283",
+  .name = "",
+  .trigger = t283_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 219,
+  .action = &t283effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s132,
+  .dest = &s134,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t284,
+};
+static struct ufsm_action t283effect = {
+  .id = "t283effect",
+  .name = "a283",
+  .f = &a283,
+  .next = NULL,
+};
+static struct ufsm_trigger t284_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t284_exit_path[] = {
+  &r26,
+  NULL,
+};
+static struct ufsm_region * t284_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t284 = {
+  .id = "t284",
+  .name = "",
+  .trigger = t284_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 220,
+  .action = &t284effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s132,
+  .dest = &s18,
+  .lca = &r3,
+  .exit_path = t284_exit_path,
+  .enter_path = t284_enter_path,
+  .next = &t285,
+};
+static struct ufsm_action t284effect = {
+  .id = "t284effect",
+  .name = "a284",
+  .f = &a284,
+  .next = NULL,
+};
+static struct ufsm_trigger t285_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t285 = {
+  .id = "t285",
+  .name = "",
+  .trigger = t285_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 221,
+  .action = &t285effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s133,
+  .dest = &s131,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t286,
+};
+static struct ufsm_action t285effect = {
+  .id = "t285effect",
+  .name = "a285",
+  .f = &a285,
+  .next = NULL,
+};
+static struct ufsm_trigger t286_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t286 = {
+  .id = "t286",
+  .name = "",
+  .trigger = t286_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 222,
+  .action = &t286effect,
+  .defer = false,
+  .guard = &t286guard,
+  .source = &s133,
+  .dest = &s131,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t287,
+};
+static struct ufsm_action t286effect = {
+  .id = "t286effect",
+  .name = "a286",
+  .f = &a286,
+  .next = NULL,
+};
+static struct ufsm_guard t286guard = {
+  .id = "t286guard",
+  .name = "g61",
+  .f = &g61,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t287_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t287_exit_path[] = {
+  &r26,
+  NULL,
+};
+static struct ufsm_region * t287_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t287 = {
+  .id = "t287",
+  .name = "",
+  .trigger = t287_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 223,
+  .action = &t287effect,
+  .defer = false,
+  .guard = &t287guard,
+  .source = &s134,
+  .dest = &s17,
+  .lca = &r3,
+  .exit_path = t287_exit_path,
+  .enter_path = t287_enter_path,
+  .next = &t288,
+};
+static struct ufsm_action t287effect = {
+  .id = "t287effect",
+  .name = "a287",
+  .f = &a287,
+  .next = NULL,
+};
+static struct ufsm_guard t287guard = {
+  .id = "t287guard",
+  .name = "g62",
+  .f = &g62,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t288_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t288 = {
+  .id = "t288",
+  .name = "",
+  .trigger = t288_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 224,
+  .action = &t288effect,
+  .defer = false,
+  .guard = &t288guard,
+  .source = &s134,
+  .dest = &s131,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t288effect = {
+  .id = "t288effect",
+  .name = "a288",
+  .f = &a288,
+  .next = NULL,
+};
+static struct ufsm_guard t288guard = {
+  .id = "t288guard",
+  .name = "g63",
+  .f = &g63,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s134_dispatch_1[] = {
+  &t287,
+  NULL,
+};
+static struct ufsm_transition * s134_dispatch_3[] = {
+  &t288,
+  NULL,
+};
+static struct ufsm_dispatch s134_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s134_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s134_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s134_interest[] = {
+  0x0000004b,
+};
+static struct ufsm_state s134 = {
+  .id   = "s134",
+  .name = "S134",
+  .kind = 0,
+  .index = 117,
+  .parent_region = &r26,
+  .entry = &s134entry,
+  .doact = NULL,
+  .exit = &s134exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s134_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s134_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s133,
+};
+static struct ufsm_entry_exit s134entry = {
+  .id = "s134entry",
+  .name = "e134",
+  .f = &e134,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s134exit = {
+  .id = "s134exit",
+  .name = "x134",
+  .f = &x134,
+  .next = NULL,
+};
+static struct ufsm_transition * s133_dispatch_4[] = {
+  &t285,
+  NULL,
+};
+static struct ufsm_transition * s133_dispatch_6[] = {
+  &t286,
+  NULL,
+};
+static struct ufsm_dispatch s133_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s133_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s133_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s133_interest[] = {
+  0x00000059,
+};
+static struct ufsm_state s133 = {
+  .id   = "s133",
+  .name = "S133",
+  .kind = 0,
+  .index = 118,
+  .parent_region = &r26,
+  .entry = &s133entry,
+  .doact = NULL,
+  .exit = &s133exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s133_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s133_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s132,
+};
+static struct ufsm_entry_exit s133entry = {
+  .id = "s133entry",
+  .name = "e133",
+  .f = &e133,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s133exit = {
+  .id = "s133exit",
+  .name = "x133",
+  .f = &x133,
+  .next = NULL,
+};
+static struct ufsm_transition * s132_dispatch_2[] = {
+  &t283,
+  &t284,
+  NULL,
+};
+static struct ufsm_dispatch s132_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s132_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s132_interest[] = {
+  0x0000004d,
+};
+static struct ufsm_state s132 = {
+  .id   = "s132",
+  .name = "S132",
+  .kind = 0,
+  .index = 119,
+  .parent_region = &r26,
+  .entry = &s132entry,
+  .doact = NULL,
+  .exit = &s132exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s132_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s132_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s131,
+};
+static struct ufsm_entry_exit s132entry = {
+  .id = "s132entry",
+  .name = "e132",
+  .f = &e132,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s132exit = {
+  .id = "s132exit",
+  .name = "x132",
+  .f = &x132,
+  .next = NULL,
+};
+static struct ufsm_transition * s131_dispatch_4[] = {
+  &t282,
+  NULL,
+};
+static struct ufsm_transition * s131_dispatch_6[] = {
+  &t281,
+  NULL,
+};
+static struct ufsm_dispatch s131_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s131_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s131_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s131_interest[] = {
+  0x00000059,
+};
+static struct ufsm_state s131 = {
+  .id   = "s131",
+  .name = "S131",
+  .kind = 0,
+  .index = 120,
+  .parent_region = &r26,
+  .entry = &s131entry,
+  .doact = NULL,
+  .exit = &s131exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s131_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s131_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s130,
+};
+static struct ufsm_entry_exit s131entry = {
+  .id = "s131entry",
+  .name = "e131",
+  .f = &e131,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s131exit = {
+  .id = "s131exit",
+  .name = "x131",
+  .f = &x131,
+  .next = NULL,
+};
+static struct ufsm_dispatch s130_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s130_interest[] = {
+  0x00000049,
+};
+static struct ufsm_state s130 = {
+  .id   = "s130",
+  .name = "Init",
+  .kind = 1,
+  .index = 121,
+  .parent_region = &r26,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s130_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s130_interest,
+  .time_events = NULL,
+  .completion = &t26,
+  .next = NULL,
+};
+static struct ufsm_region r25 = {
+  .id = "r25",
+  .name = "R25",
+  .state = &s129,
+  .has_history = false,
+  .history = NULL,
+  .index = 22,
+  .transition = &t25,
+  .parent_state = &s16,
+  .next = NULL,
+};
+static struct ufsm_transition t25 = {
+  .id = "t25",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 225,
+  .action = &t25effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s125,
+  .dest = &s129,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t273,
+};
+static struct ufsm_action t25effect = {
+  .id = "t25effect",
+  .name = "a25",
+  .f = &a25,
+  .next = NULL,
+};
+static struct ufsm_trigger t273_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t273 = {
+  .id = "t273",
+  .name = "",
+  .trigger = t273_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 226,
+  .action = &t273effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s126,
+  .dest = &s129,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t274,
+};
+static struct ufsm_action t273effect = {
+  .id = "t273effect",
+  .name = "a273",
+  .f = &a273,
+  .next = NULL,
+};
+static struct ufsm_trigger t274_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t274 = {
+  .id = "t274",
+  .name = "",
+  .trigger = t274_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 227,
+  .action = &t274effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s126,
+  .dest = &s126,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t275,
+};
+static struct ufsm_action t274effect = {
+  .id = "t274effect",
+  .name = "a274",
+  .f = &a274,
+  .next = NULL,
+};
+static struct ufsm_trigger t275_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t275_exit_path[] = {
+  &r25,
+  NULL,
+};
+static struct ufsm_region * t275_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t275 = {
+  .id = "t275",
+  .name = "",
+  .trigger = t275_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 228,
+  .action = &t275effect,
+  .defer = false,
+  .guard = &t275guard,
+  .source = &s127,
+  .dest = &s16,
+  .lca = &r3,
+  .exit_path = t275_exit_path,
+  .enter_path = t275_enter_path,
+  .next = &t276,
+};
+static struct ufsm_action t275effect = {
+  .id = "t275effect",
+  .name = "a275",
+  .f = &a275,
+  .next = NULL,
+};
+static struct ufsm_guard t275guard = {
+  .id = "t275guard",
+  .name = "g58",
+  .f = &g58,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t276_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t276 = {
+  .id = "t276",
+  .name = "",
+  .trigger = t276_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 229,
+  .action = &t276effect,
+  .defer = false,
+  .guard = &t276guard,
+  .source = &s127,
+  .dest = &s128,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t277,
+};
+static struct ufsm_action t276effect = {
+  .id = "t276effect",
+  .name = "a276",
+  .f = &a276,
+  .next = NULL,
+};
+static struct ufsm_guard t276guard = {
+  .id = "t276guard",
+  .name = "g59",
+  .f = &g59,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t277_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t277_exit_path[] = {
+  &r25,
+  &r3,
+  NULL,
+};
+static struct ufsm_region * t277_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t277 = {
+  .id = "t277",
+  .name = "",
+  .trigger = t277_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 230,
+  .action = &t277effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s128,
+  .dest = &s2,
+  .lca = &r0,
+  .exit_path = t277_exit_path,
+  .enter_path = t277_enter_path,
+  .next = &t278,
+};
+static struct ufsm_action t277effect = {
+  .id = "t277effect",
+  .name = "a277",
+  .f = &a277,
+  .next = NULL,
+};
+static struct ufsm_trigger t278_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t278 = {
+  .id = "t278",
+  .name = "",
+  .trigger = t278_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 231,
+  .action = &t278effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s128,
+  .dest = &s129,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t279,
+};
+static struct ufsm_action t278effect = {
+  .id = "t278effect",
+  .name = "a278",
+  .f = &a278,
+  .next = NULL,
+};
+static struct ufsm_trigger t279_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t279_exit_path[] = {
+  &r25,
+  NULL,
+};
+static struct ufsm_region * t279_enter_path[] = {
+  &r26,
+  NULL,
+};
+static struct ufsm_transition t279 = {
+  .id = "t279",
+  .name = "",
+  .trigger = t279_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 232,
+  .action = &t279effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s129,
+  .dest = &s131,
+  .lca = &r3,
+  .exit_path = t279_exit_path,
+  .enter_path = t279_enter_path,
+  .next = &t280,
+};
+static struct ufsm_action t279effect = {
+  .id = "t279effect",
+  .name = "a279",
+  .f = &a279,
+  .next = NULL,
+};
+static struct ufsm_trigger t280_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t280_exit_path[] = {
+  &r25,
+  NULL,
+};
+static struct ufsm_region * t280_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t280 = {
+  .id = "t280",
+  .name = "",
+  .trigger = t280_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 233,
+  .action = &t280effect,
+  .defer = false,
+  .guard = &t280guard,
+  .source = &s129,
+  .dest = &s16,
+  .lca = &r3,
+  .exit_path = t280_exit_path,
+  .enter_path = t280_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t280effect = {
+  .id = "t280effect",
+  .name = "a280",
+  .f = &a280,
+  .next = NULL,
+};
+static struct ufsm_guard t280guard = {
+  .id = "t280guard",
+  .name = "g60",
+  .f = &g60,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s129_dispatch_0[] = {
+  &t279,
+  &t280,
+  NULL,
+};
+static struct ufsm_dispatch s129_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s129_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s129_interest[] = {
+  0x00000049,
+};
+static struct ufsm_state s129 = {
+  .id   = "s129",
+  .name = "S129",
+  .kind = 0,
+  .index = 122,
+  .parent_region = &r25,
+  .entry = &s129entry,
+  .doact = NULL,
+  .exit = &s129exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s129_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s129_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s128,
+};
+static struct ufsm_entry_exit s129entry = {
+  .id = "s129entry",
+  .name = "e129",
+  .f = &e129,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s129exit = {
+  .id = "s129exit",
+  .name = "x129",
+  .f = &x129,
+  .next = NULL,
+};
+static struct ufsm_transition * s128_dispatch_4[] = {
+  &t277,
+  &t278,
+  NULL,
+};
+static struct ufsm_dispatch s128_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s128_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s128_interest[] = {
+  0x00000059,
+};
+static struct ufsm_state s128 = {
+  .id   = "s128",
+  .name = "S128",
+  .kind = 0,
+  .index = 123,
+  .parent_region = &r25,
+  .entry = &s128entry,
+  .doact = NULL,
+  .exit = &s128exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s128_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s128_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s127,
+};
+static struct ufsm_entry_exit s128entry = {
+  .id = "s128entry",
+  .name = "e128",
+  .f = &e128,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s128exit = {
+  .id = "s128exit",
+  .name = "x128",
+  .f = &x128,
+  .next = NULL,
+};
+static struct ufsm_transition * s127_dispatch_2[] = {
+  &t276,
+  NULL,
+};
+static struct ufsm_transition * s127_dispatch_5[] = {
+  &t275,
+  NULL,
+};
+static struct ufsm_dispatch s127_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s127_dispatch_2,
+},
+{
+  .ev = 5,
+  .transition = s127_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s127_interest[] = {
+  0x0000006d,
+};
+static struct ufsm_state s127 = {
+  .id   = "s127",
+  .name = "S127",
+  .kind = 0,
+  .index = 124,
+  .parent_region = &r25,
+  .entry = &s127entry,
+  .doact = NULL,
+  .exit = &s127exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s127_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s127_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s126,
+};
+static struct ufsm_entry_exit s127entry = {
+  .id = "s127entry",
+  .name = "e127",
+  .f = &e127,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s127exit = {
+  .id = "s127exit",
+  .name = "x127",
+  .f = &x127,
+  .next = NULL,
+};
+static struct ufsm_transition * s126_dispatch_2[] = {
+  &t273,
+  NULL,
+};
+static struct ufsm_transition * s126_dispatch_7[] = {
+  &t274,
+  NULL,
+};
+static struct ufsm_dispatch s126_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s126_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s126_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s126_interest[] = {
+  0x000000cd,
+};
+static struct ufsm_state s126 = {
+  .id   = "s126",
+  .name = "S126",
+  .kind = 0,
+  .index = 125,
+  .parent_region = &r25,
+  .entry = &s126entry,
+  .doact = NULL,
+  .exit = &s126exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s126_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s126_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s125,
+};
+static struct ufsm_entry_exit s126entry = {
+  .id = "s126entry",
+  .name = "e126",
+  .f = &e126,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s126exit = {
+  .id = "s126exit",
+  .name = "x126",
+  .f = &x126,
+  .next = NULL,
+};
+static struct ufsm_dispatch s125_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s125_interest[] = {
+  0x00000049,
+};
+static struct ufsm_state s125 = {
+  .id   = "s125",
+  .name = "Init",
+  .kind = 1,
+  .index = 126,
+  .parent_region = &r25,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s125_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s125_interest,
+  .time_events = NULL,
+  .completion = &t25,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s16entry = {
+  .id = "s16entry",
+  .name = "e16",
+  .f = &e16,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s16exit = {
+  .id = "s16exit",
+  .name = "x16",
+  .f = &x16,
+  .next = NULL,
+};
+static struct ufsm_dispatch s15_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s15_interest[] = {
+  0x00000009,
+};
+static struct ufsm_state s15 = {
+  .id   = "s15",
+  .name = "Init",
+  .kind = 1,
+  .index = 116,
+  .parent_region = &r3,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s15_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s15_interest,
+  .time_events = NULL,
+  .completion = &t3,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s2entry = {
+  .id = "s2entry",
+  .name = "e2",
+  .f = &e2,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s2exit = {
+  .id = "s2exit",
+  .name = "x2",
+  .f = &x2,
+  .next = NULL,
+};
+static struct ufsm_transition * s1_dispatch_1[] = {
+  &t73,
+  &t74,
+  NULL,
+};
+static struct ufsm_transition * s1_dispatch_4[] = {
+  &t704,
+  NULL,
+};
+static struct ufsm_dispatch s1_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s1_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s1_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s1_interest[] = {
+  0x00000012,
+};
+static struct ufsm_state s1 = {
+  .id   = "s1",
+  .name = "S1",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &r0,
+  .entry = &s1entry,
+  .doact = NULL,
+  .exit = &s1exit,
+  .region = &r2,
+  .submachine = NULL,
+  .dispatch = s1_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s1_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s376,
+};
+static struct ufsm_region r2 = {
+  .id = "r2",
+  .name = "R2",
+  .state = &s14,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &t2,
+  .parent_state = &s1,
+  .next = &r1,
+};
+static struct ufsm_transition t2 = {
+  .id = "t2",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 15,
+  .action = &t2effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s10,
+  .dest = &s12,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t89,
+};
+static struct ufsm_action t2effect = {
+  .id = "t2effect",
+  .name = "a2",
+  .f = &a2,
+  .next = NULL,
+};
+static struct ufsm_trigger t89_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t89_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t89_enter_path[] = {
+  &r24,
+  NULL,
+};
+static struct ufsm_transition t89 = {
+  .id = "t89",
+  .name = "",
+  .trigger = t89_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 16,
+  .action = &t89effect,
+  .defer = false,
+  .guard = &t89guard,
+  .source = &s11,
+  .dest = &s121,
+  .lca = &r2,
+  .exit_path = t89_exit_path,
+  .enter_path = t89_enter_path,
+  .next = &t90,
+};
+static struct ufsm_action t89effect = {
+  .id = "t89effect",
+  .name = "a89",
+  .f = &a89,
+  .next = NULL,
+};
+static struct ufsm_guard t89guard = {
+  .id = "t89guard",
+  .name = "g6",
+  .f = &g6,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t90_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t90_exit_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_region * t90_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t90 = {
+  .id = "t90",
+  .name = "",
+  .trigger = t90_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 17,
+  .action = &t90effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s11,
+  .dest = &s3,
+  .lca = &r0,
+  .exit_path = t90_exit_path,
+  .enter_path = t90_enter_path,
+  .next = &t91,
+};
+static struct ufsm_action t90effect = {
+  .id = "t90effect",
+  .name = "a90",
+  .f = &a90,
+  .next = NULL,
+};
+static struct ufsm_trigger t91_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t91_exit_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_region * t91_enter_path[] = {
+  &r3,
+  NULL,
+};
+static struct ufsm_transition t91 = {
+  .id = "t91",
+  .name = "",
+  .trigger = t91_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 18,
+  .action = &t91effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s12,
+  .dest = &s17,
+  .lca = &r0,
+  .exit_path = t91_exit_path,
+  .enter_path = t91_enter_path,
+  .next = &t92,
+};
+static struct ufsm_action t91effect = {
+  .id = "t91effect",
+  .name = "a91",
+  .f = &a91,
+  .next = NULL,
+};
+static struct ufsm_trigger t92_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t92 = {
+  .id = "t92",
+  .name = "",
+  .trigger = t92_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 19,
+  .action = &t92effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s12,
+  .dest = &s13,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t93,
+};
+static struct ufsm_action t92effect = {
+  .id = "t92effect",
+  .name = "a92",
+  .f = &a92,
+  .next = NULL,
+};
+static struct ufsm_trigger t93_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t93 = {
+  .id = "t93",
+  .name = "",
+  .trigger = t93_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 20,
+  .action = &t93effect,
+  .defer = false,
+  .guard = &t93guard,
+  .source = &s13,
+  .dest = &s12,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t94,
+};
+static struct ufsm_action t93effect = {
+  .id = "t93effect",
+  .name = "a93",
+  .f = &a93,
+  .next = NULL,
+};
+static struct ufsm_guard t93guard = {
+  .id = "t93guard",
+  .name = "g7",
+  .f = &g7,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t94_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t94_exit_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_region * t94_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t94 = {
+  .id = "t94",
+  .name = "",
+  .trigger = t94_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 21,
+  .action = &t94effect,
+  .defer = false,
+  .guard = &t94guard,
+  .source = &s13,
+  .dest = &s2,
+  .lca = &r0,
+  .exit_path = t94_exit_path,
+  .enter_path = t94_enter_path,
+  .next = &t95,
+};
+static struct ufsm_action t94effect = {
+  .id = "t94effect",
+  .name = "a94",
+  .f = &a94,
+  .next = NULL,
+};
+static struct ufsm_guard t94guard = {
+  .id = "t94guard",
+  .name = "g8",
+  .f = &g8,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t95_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t95_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t95_enter_path[] = {
+  &r22,
+  NULL,
+};
+static struct ufsm_transition t95 = {
+  .id = "t95",
+  .name = "",
+  .trigger = t95_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 22,
+  .action = &t95effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s14,
+  .dest = &s111,
+  .lca = &r2,
+  .exit_path = t95_exit_path,
+  .enter_path = t95_enter_path,
+  .next = &t96,
+};
+static struct ufsm_action t95effect = {
+  .id = "t95effect",
+  .name = "a95",
+  .f = &a95,
+  .next = NULL,
+};
+static struct ufsm_trigger t96_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t96_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t96_enter_path[] = {
+  &r23,
+  NULL,
+};
+static struct ufsm_transition t96 = {
+  .id = "t96",
+  .name = "",
+  .trigger = t96_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 23,
+  .action = &t96effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s14,
+  .dest = &s118,
+  .lca = &r2,
+  .exit_path = t96_exit_path,
+  .enter_path = t96_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t96effect = {
+  .id = "t96effect",
+  .name = "a96",
+  .f = &a96,
+  .next = NULL,
+};
+static struct ufsm_transition * s14_dispatch_1[] = {
+  &t96,
+  NULL,
+};
+static struct ufsm_transition * s14_dispatch_2[] = {
+  &t95,
+  NULL,
+};
+static struct ufsm_dispatch s14_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s14_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = s14_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s14_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s14 = {
+  .id   = "s14",
+  .name = "S14",
+  .kind = 0,
+  .index = 8,
+  .parent_region = &r2,
+  .entry = &s14entry,
+  .doact = NULL,
+  .exit = &s14exit,
+  .region = &r24,
+  .submachine = NULL,
+  .dispatch = s14_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s14_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s13,
+};
+static struct ufsm_region r24 = {
+  .id = "r24",
+  .name = "R24",
+  .state = &s124,
+  .has_history = false,
+  .history = NULL,
+  .index = 17,
+  .transition = &t24,
+  .parent_state = &s14,
+  .next = &r23,
+};
+static struct ufsm_transition t24 = {
+  .id = "t24",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 170,
+  .action = &t24effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s120,
+  .dest = &s121,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t265,
+};
+static struct ufsm_action t24effect = {
+  .id = "t24effect",
+  .name = "a24",
+  .f = &a24,
+  .next = NULL,
+};
+static struct ufsm_trigger t265_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t265 = {
+  .id = "t265",
+  .name = "",
+  .trigger = t265_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 171,
+  .action = &t265effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s121,
+  .dest = &s122,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t266,
+};
+static struct ufsm_action t265effect = {
+  .id = "t265effect",
+  .name = "a265",
+  .f = &a265,
+  .next = NULL,
+};
+static struct ufsm_trigger t266_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t266 = {
+  .id = "t266",
+  .name = "",
+  .trigger = t266_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 172,
+  .action = &t266effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s121,
+  .dest = &s121,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t267,
+};
+static struct ufsm_action t266effect = {
+  .id = "t266effect",
+  .name = "a266",
+  .f = &a266,
+  .next = NULL,
+};
+static struct ufsm_trigger t267_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t267 = {
+  .id = "t267",
+  .name = "",
+  .trigger = t267_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 173,
+  .action = &t267effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s122,
+  .dest = &s122,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t268,
+};
+static struct ufsm_action t267effect = {
+  .id = "t267effect",
+  .name = "a267",
+  .f = &a267,
+  .next = NULL,
+};
+static struct ufsm_trigger t268_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t268 = {
+  .id = "t268",
+  .name = "",
+  .trigger = t268_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 174,
+  .action = &t268effect,
+  .defer = false,
+  .guard = &t268guard,
+  .source = &s122,
+  .dest = &s124,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t269,
+};
+static struct ufsm_action t268effect = {
+  .id = "t268effect",
+  .name = "a268",
+  .f = &a268,
+  .next = NULL,
+};
+static struct ufsm_guard t268guard = {
+  .id = "t268guard",
+  .name = "g55",
+  .f = &g55,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t269_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t269_exit_path[] = {
+  &r24,
+  NULL,
+};
+static struct ufsm_region * t269_enter_path[] = {
+  &r22,
+  NULL,
+};
+static struct ufsm_transition t269 = {
+  .id = "t269",
+  .name = "",
+  .trigger = t269_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 175,
+  .action = &t269effect,
+  .defer = false,
+  .guard = &t269guard,
+  .source = &s123,
+  .dest = &s112,
+  .lca = &r2,
+  .exit_path = t269_exit_path,
+  .enter_path = t269_enter_path,
+  .next = &t270,
+};
+static struct ufsm_action t269effect = {
+  .id = "t269effect",
+  .name = "a269",
+  .f = &a269,
+  .next = NULL,
+};
+static struct ufsm_guard t269guard = {
+  .id = "t269guard",
+  .name = "g56",
+  .f = &g56,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t270_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t270 = {
+  .id = "t270",
+  .name = "",
+  .trigger = t270_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 176,
+  .action = &t270effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s123,
+  .dest = &s122,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t271,
+};
+static struct ufsm_action t270effect = {
+  .id = "t270effect",
+  .name = "a270",
+  .f = &a270,
+  .next = NULL,
+};
+static struct ufsm_trigger t271_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t271_exit_path[] = {
+  &r24,
+  NULL,
+};
+static struct ufsm_region * t271_enter_path[] = {
+  &r22,
+  NULL,
+};
+static struct ufsm_transition t271 = {
+  .id = "t271",
+  .name = "",
+  .trigger = t271_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 177,
+  .action = &t271effect,
+  .defer = false,
+  .guard = &t271guard,
+  .source = &s124,
+  .dest = &s113,
+  .lca = &r2,
+  .exit_path = t271_exit_path,
+  .enter_path = t271_enter_path,
+  .next = &t272,
+};
+static struct ufsm_action t271effect = {
+  .id = "t271effect",
+  .name = "a271",
+  .f = &a271,
+  .next = NULL,
+};
+static struct ufsm_guard t271guard = {
+  .id = "t271guard",
+  .name = "g57",
+  .f = &g57,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t272_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t272_exit_path[] = {
+  &r24,
+  NULL,
+};
+static struct ufsm_region * t272_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t272 = {
+  .id = "t272",
+  .name = "",
+  .trigger = t272_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 178,
+  .action = &t272effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s124,
+  .dest = &s13,
+  .lca = &r2,
+  .exit_path = t272_exit_path,
+  .enter_path = t272_enter_path,
+  .next = &t663,
+};
+static struct ufsm_action t272effect = {
+  .id = "t272effect",
+  .name = "a272",
+  .f = &a272,
+  .next = NULL,
+};
+static struct ufsm_trigger t663_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t663 = {
+  .id = "t663",
+  .name = "",
+  .trigger = t663_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 179,
+  .action = &t663effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s121,
+  .dest = &s367,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t664,
+};
+static struct ufsm_action t663effect = {
+  .id = "t663effect",
+  .name = "a663",
+  .f = &a663,
+  .next = NULL,
+};
+static struct ufsm_transition t664 = {
+  .id = "t664",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 180,
+  .action = &t664effect,
+  .defer = false,
+  .guard = &t664guard,
+  .source = &s367,
+  .dest = &s122,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t665,
+};
+static struct ufsm_action t664effect = {
+  .id = "t664effect",
+  .name = "a664",
+  .f = &a664,
+  .next = NULL,
+};
+static struct ufsm_guard t664guard = {
+  .id = "t664guard",
+  .name = "g190",
+  .f = &g190,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition t665 = {
+  .id = "t665",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 181,
+  .action = &t665effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s367,
+  .dest = &s121,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t665effect = {
+  .id = "t665effect",
+  .name = "a665",
+  .f = &a665,
+  .next = NULL,
+};
+static struct ufsm_transition * s124_dispatch_1[] = {
+  &t272,
+  NULL,
+};
+static struct ufsm_transition * s124_dispatch_7[] = {
+  &t271,
+  NULL,
+};
+static struct ufsm_dispatch s124_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s124_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s124_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s124_interest[] = {
+  0x00000096,
+};
+static struct ufsm_state s124 = {
+  .id   = "s124",
+  .name = "S124",
+  .kind = 0,
+  .index = 93,
+  .parent_region = &r24,
+  .entry = &s124entry,
+  .doact = NULL,
+  .exit = &s124exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s124_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s124_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s123,
+};
+static struct ufsm_entry_exit s124entry = {
+  .id = "s124entry",
+  .name = "e124",
+  .f = &e124,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s124exit = {
+  .id = "s124exit",
+  .name = "x124",
+  .f = &x124,
+  .next = NULL,
+};
+static struct ufsm_transition * s123_dispatch_1[] = {
+  &t269,
+  NULL,
+};
+static struct ufsm_transition * s123_dispatch_6[] = {
+  &t270,
+  NULL,
+};
+static struct ufsm_dispatch s123_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s123_dispatch_1,
+},
+{
+  .ev = 6,
+  .transition = s123_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s123_interest[] = {
+  0x00000056,
+};
+static struct ufsm_state s123 = {
+  .id   = "s123",
+  .name = "S123",
+  .kind = 0,
+  .index = 94,
+  .parent_region = &r24,
+  .entry = &s123entry,
+  .doact = NULL,
+  .exit = &s123exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s123_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s123_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s122,
+};
+static struct ufsm_entry_exit s123entry = {
+  .id = "s123entry",
+  .name = "e123",
+  .f = &e123,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s123exit = {
+  .id = "s123exit",
+  .name = "x123",
+  .f = &x123,
+  .next = NULL,
+};
+static struct ufsm_transition * s122_dispatch_2[] = {
+  &t268,
+  NULL,
+};
+static struct ufsm_transition * s122_dispatch_6[] = {
+  &t267,
+  NULL,
+};
+static struct ufsm_dispatch s122_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s122_dispatch_2,
+},
+{
+  .ev = 6,
+  .transition = s122_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s122_interest[] = {
+  0x00000056,
+};
+static struct ufsm_state s122 = {
+  .id   = "s122",
+  .name = "S122",
+  .kind = 0,
+  .index = 95,
+  .parent_region = &r24,
+  .entry = &s122entry,
+  .doact = NULL,
+  .exit = &s122exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s122_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s122_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s121,
+};
+static struct ufsm_entry_exit s122entry = {
+  .id = "s122entry",
+  .name = "e122",
+  .f = &e122,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s122exit = {
+  .id = "s122exit",
+  .name = "x122",
+  .f = &x122,
+  .next = NULL,
+};
+static struct ufsm_transition * s121_dispatch_2[] = {
+  &t265,
+  &t266,
+  NULL,
+};
+static struct ufsm_transition * s121_dispatch_7[] = {
+  &t663,
+  NULL,
+};
+static struct ufsm_dispatch s121_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s121_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s121_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s121_interest[] = {
+  0x00000096,
+};
+static struct ufsm_state s121 = {
+  .id   = "s121",
+  .name = "S121",
+  .kind = 0,
+  .index = 96,
+  .parent_region = &r24,
+  .entry = &s121entry,
+  .doact = NULL,
+  .exit = &s121exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s121_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s121_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s367,
+};
+static struct ufsm_entry_exit s121entry = {
+  .id = "s121entry",
+  .name = "e121",
+  .f = &e121,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s121exit = {
+  .id = "s121exit",
+  .name = "x121",
+  .f = &x121,
+  .next = NULL,
+};
+static struct ufsm_dispatch s367_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s367_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s367 = {
+  .id   = "s367",
+  .name = "(null)",
+  .kind = 9,
+  .index = 97,
+  .parent_region = &r24,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s367_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s367_interest,
+  .time_events = NULL,
+  .completion = &t664,
+  .next = &s120,
+};
+static struct ufsm_dispatch s120_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s120_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s120 = {
+  .id   = "s120",
+  .name = "Init",
+  .kind = 1,
+  .index = 98,
+  .parent_region = &r24,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s120_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s120_interest,
+  .time_events = NULL,
+  .completion = &t24,
+  .next = NULL,
+};
+static struct ufsm_region r23 = {
+  .id = "r23",
+  .name = "R23",
+  .state = &s119,
+  .has_history = false,
+  .history = NULL,
+  .index = 18,
+  .transition = &t23,
+  .parent_state = &s14,
+  .next = NULL,
+};
+static struct ufsm_transition t23 = {
+  .id = "t23",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 182,
+  .action = &t23effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s115,
+  .dest = &s118,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t257,
+};
+static struct ufsm_action t23effect = {
+  .id = "t23effect",
+  .name = "a23",
+  .f = &a23,
+  .next = NULL,
+};
+static struct ufsm_trigger t257_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t257 = {
+  .id = "t257",
+  .name = "",
+  .trigger = t257_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 183,
+  .action = &t257effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s116,
+  .dest = &s116,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t258,
+};
+static struct ufsm_action t257effect = {
+  .id = "t257effect",
+  .name = "a257",
+  .f = &a257,
+  .next = NULL,
+};
+static struct ufsm_trigger t258_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t258 = {
+  .id = "t258",
+  .name = "",
+  .trigger = t258_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 184,
+  .action = &t258effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s116,
+  .dest = &s118,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t259,
+};
+static struct ufsm_action t258effect = {
+  .id = "t258effect",
+  .name = "a258",
+  .f = &a258,
+  .next = NULL,
+};
+static struct ufsm_trigger t259_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t259 = {
+  .id = "t259",
+  .name = "",
+  .trigger = t259_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 185,
+  .action = &t259effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s117,
+  .dest = &s117,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t260,
+};
+static struct ufsm_action t259effect = {
+  .id = "t259effect",
+  .name = "a259",
+  .f = &a259,
+  .next = NULL,
+};
+static struct ufsm_trigger t260_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t260 = {
+  .id = "t260",
+  .name = "",
+  .trigger = t260_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 186,
+  .action = &t260effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s117,
+  .dest = &s118,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t261,
+};
+static struct ufsm_action t260effect = {
+  .id = "t260effect",
+  .name = "a260",
+  .f = &a260,
+  .next = NULL,
+};
+static struct ufsm_trigger t261_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t261 = {
+  .id = "t261",
+  .name = "",
+  .trigger = t261_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 187,
+  .action = &t261effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s118,
+  .dest = &s116,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t262,
+};
+static struct ufsm_action t261effect = {
+  .id = "t261effect",
+  .name = "a261",
+  .f = &a261,
+  .next = NULL,
+};
+static struct ufsm_trigger t262_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t262_exit_path[] = {
+  &r23,
+  &r2,
+  NULL,
+};
+static struct ufsm_region * t262_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t262 = {
+  .id = "t262",
+  .name = "",
+  .trigger = t262_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 188,
+  .action = &t262effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s118,
+  .dest = &s21,
+  .lca = &r0,
+  .exit_path = t262_exit_path,
+  .enter_path = t262_enter_path,
+  .next = &t263,
+};
+static struct ufsm_action t262effect = {
+  .id = "t262effect",
+  .name = "a262",
+  .f = &a262,
+  .next = NULL,
+};
+static struct ufsm_trigger t263_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t263_exit_path[] = {
+  &r23,
+  NULL,
+};
+static struct ufsm_region * t263_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t263 = {
+  .id = "t263",
+  .name = "",
+  .trigger = t263_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 189,
+  .action = &t263effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s119,
+  .dest = &s11,
+  .lca = &r2,
+  .exit_path = t263_exit_path,
+  .enter_path = t263_enter_path,
+  .next = &t264,
+};
+static struct ufsm_action t263effect = {
+  .id = "t263effect",
+  .name = "a263",
+  .f = &a263,
+  .next = NULL,
+};
+static struct ufsm_trigger t264_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t264 = {
+  .id = "t264",
+  .name = "",
+  .trigger = t264_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 190,
+  .action = &t264effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s119,
+  .dest = &s117,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t660,
+};
+static struct ufsm_action t264effect = {
+  .id = "t264effect",
+  .name = "a264",
+  .f = &a264,
+  .next = NULL,
+};
+static struct ufsm_trigger t660_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t660 = {
+  .id = "t660",
+  .name = "",
+  .trigger = t660_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 191,
+  .action = &t660effect,
+  .defer = false,
+  .guard = &t660guard,
+  .source = &s116,
+  .dest = &s366,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t661,
+};
+static struct ufsm_action t660effect = {
+  .id = "t660effect",
+  .name = "a660",
+  .f = &a660,
+  .next = NULL,
+};
+static struct ufsm_guard t660guard = {
+  .id = "t660guard",
+  .name = "g188",
+  .f = &g188,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition t661 = {
+  .id = "t661",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 192,
+  .action = &t661effect,
+  .defer = false,
+  .guard = &t661guard,
+  .source = &s366,
+  .dest = &s119,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t662,
+};
+static struct ufsm_action t661effect = {
+  .id = "t661effect",
+  .name = "a661",
+  .f = &a661,
+  .next = NULL,
+};
+static struct ufsm_guard t661guard = {
+  .id = "t661guard",
+  .name = "g189",
+  .f = &g189,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition t662 = {
+  .id = "t662",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 193,
+  .action = &t662effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s366,
+  .dest = &s119,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t662effect = {
+  .id = "t662effect",
+  .name = "a662",
+  .f = &a662,
+  .next = NULL,
+};
+static struct ufsm_transition * s119_dispatch_1[] = {
+  &t263,
+  NULL,
+};
+static struct ufsm_transition * s119_dispatch_7[] = {
+  &t264,
+  NULL,
+};
+static struct ufsm_dispatch s119_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s119_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s119_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s119_interest[] = {
+  0x00000096,
+};
+static struct ufsm_state s119 = {
+  .id   = "s119",
+  .name = "S119",
+  .kind = 0,
+  .index = 99,
+  .parent_region = &r23,
+  .entry = &s119entry,
+  .doact = NULL,
+  .exit = &s119exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s119_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s119_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s118,
+};
+static struct ufsm_entry_exit s119entry = {
+  .id = "s119entry",
+  .name = "e119",
+  .f = &e119,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s119exit = {
+  .id = "s119exit",
+  .name = "x119",
+  .f = &x119,
+  .next = NULL,
+};
+static struct ufsm_transition * s118_dispatch_3[] = {
+  &t262,
+  NULL,
+};
+static struct ufsm_transition * s118_dispatch_4[] = {
+  &t261,
+  NULL,
+};
+static struct ufsm_dispatch s118_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s118_dispatch_3,
+},
+{
+  .ev = 4,
+  .transition = s118_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s118_interest[] = {
+  0x0000001e,
+};
+static struct ufsm_state s118 = {
+  .id   = "s118",
+  .name = "S118",
+  .kind = 0,
+  .index = 100,
+  .parent_region = &r23,
+  .entry = &s118entry,
+  .doact = NULL,
+  .exit = &s118exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s118_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s118_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s117,
+};
+static struct ufsm_entry_exit s118entry = {
+  .id = "s118entry",
+  .name = "e118",
+  .f = &e118,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s118exit = {
+  .id = "s118exit",
+  .name = "x118",
+  .f = &x118,
+  .next = NULL,
+};
+static struct ufsm_transition * s117_dispatch_2[] = {
+  &t259,
+  &t260,
+  NULL,
+};
+static struct ufsm_dispatch s117_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s117_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s117_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s117 = {
+  .id   = "s117",
+  .name = "S117",
+  .kind = 0,
+  .index = 101,
+  .parent_region = &r23,
+  .entry = &s117entry,
+  .doact = NULL,
+  .exit = &s117exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s117_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s117_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s116,
+};
+static struct ufsm_entry_exit s117entry = {
+  .id = "s117entry",
+  .name = "e117",
+  .f = &e117,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s117exit = {
+  .id = "s117exit",
+  .name = "x117",
+  .f = &x117,
+  .next = NULL,
+};
+static struct ufsm_transition * s116_dispatch_1[] = {
+  &t257,
+  NULL,
+};
+static struct ufsm_transition * s116_dispatch_2[] = {
+  &t660,
+  NULL,
+};
+static struct ufsm_transition * s116_dispatch_3[] = {
+  &t258,
+  NULL,
+};
+static struct ufsm_dispatch s116_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s116_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = s116_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s116_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s116_interest[] = {
+  0x0000001e,
+};
+static struct ufsm_state s116 = {
+  .id   = "s116",
+  .name = "S116",
+  .kind = 0,
+  .index = 102,
+  .parent_region = &r23,
+  .entry = &s116entry,
+  .doact = NULL,
+  .exit = &s116exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s116_dispatch,
+  .no_of_dispatch = 3,
+  .flat_dispatch = NULL,
+  .interest = s116_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s366,
+};
+static struct ufsm_entry_exit s116entry = {
+  .id = "s116entry",
+  .name = "e116",
+  .f = &e116,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s116exit = {
+  .id = "s116exit",
+  .name = "x116",
+  .f = &x116,
+  .next = NULL,
+};
+static struct ufsm_dispatch s366_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s366_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s366 = {
+  .id   = "s366",
+  .name = "(null)",
+  .kind = 9,
+  .index = 103,
+  .parent_region = &r23,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s366_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s366_interest,
+  .time_events = NULL,
+  .completion = &t661,
+  .next = &s115,
+};
+static struct ufsm_dispatch s115_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s115_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s115 = {
+  .id   = "s115",
+  .name = "Init",
+  .kind = 1,
+  .index = 104,
+  .parent_region = &r23,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s115_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s115_interest,
+  .time_events = NULL,
+  .completion = &t23,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s14entry = {
+  .id = "s14entry",
+  .name = "e14",
+  .f = &e14,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s14exit = {
+  .id = "s14exit",
+  .name = "x14",
+  .f = &x14,
+  .next = NULL,
+};
+static struct ufsm_transition * s13_dispatch_3[] = {
+  &t94,
+  NULL,
+};
+static struct ufsm_transition * s13_dispatch_5[] = {
+  &t93,
+  NULL,
+};
+static struct ufsm_dispatch s13_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s13_dispatch_3,
+},
+{
+  .ev = 5,
+  .transition = s13_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s13_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s13 = {
+  .id   = "s13",
+  .name = "S13",
+  .kind = 0,
+  .index = 9,
+  .parent_region = &r2,
+  .entry = &s13entry,
+  .doact = NULL,
+  .exit = &s13exit,
+  .region = &r22,
+  .submachine = NULL,
+  .dispatch = s13_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s13_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s12,
+};
+static struct ufsm_region r22 = {
+  .id = "r22",
+  .name = "R22",
+  .state = &s114,
+  .has_history = false,
+  .history = NULL,
+  .index = 15,
+  .transition = &t22,
+  .parent_state = &s13,
+  .next = &r21,
+};
+static struct ufsm_transition t22 = {
+  .id = "t22",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 150,
+  .action = &t22effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s110,
+  .dest = &s114,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t249,
+};
+static struct ufsm_action t22effect = {
+  .id = "t22effect",
+  .name = "a22",
+  .f = &a22,
+  .next = NULL,
+};
+static struct ufsm_trigger t249_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t249_exit_path[] = {
+  &r22,
+  NULL,
+};
+static struct ufsm_region * t249_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t249 = {
+  .id = "t249",
+  .name = "",
+  .trigger = t249_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 151,
+  .action = &t249effect,
+  .defer = false,
+  .guard = &t249guard,
+  .source = &s111,
+  .dest = &s12,
+  .lca = &r2,
+  .exit_path = t249_exit_path,
+  .enter_path = t249_enter_path,
+  .next = &t250,
+};
+static struct ufsm_action t249effect = {
+  .id = "t249effect",
+  .name = "a249",
+  .f = &a249,
+  .next = NULL,
+};
+static struct ufsm_guard t249guard = {
+  .id = "t249guard",
+  .name = "g54",
+  .f = &g54,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t250_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t250 = {
+  .id = "t250",
+  .name = "",
+  .trigger = t250_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 152,
+  .action = &t250effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s111,
+  .dest = &s114,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t251,
+};
+static struct ufsm_action t250effect = {
+  .id = "t250effect",
+  .name = "a250",
+  .f = &a250,
+  .next = NULL,
+};
+static struct ufsm_trigger t251_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t251 = {
+  .id = "t251",
+  .name = "",
+  .trigger = t251_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 153,
+  .action = &t251effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s112,
+  .dest = &s114,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t252,
+};
+static struct ufsm_action t251effect = {
+  .id = "t251effect",
+  .name = "a251",
+  .f = &a251,
+  .next = NULL,
+};
+static struct ufsm_trigger t252_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t252 = {
+  .id = "t252",
+  .name = "",
+  .trigger = t252_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 154,
+  .action = &t252effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s112,
+  .dest = &s114,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t253,
+};
+static struct ufsm_action t252effect = {
+  .id = "t252effect",
+  .name = "a252",
+  .f = &a252,
+  .next = NULL,
+};
+static struct ufsm_trigger t253_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t253 = {
+  .id = "t253",
+  .name = "",
+  .trigger = t253_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 155,
+  .action = &t253effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s113,
+  .dest = &s111,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t254,
+};
+static struct ufsm_action t253effect = {
+  .id = "t253effect",
+  .name = "a253",
+  .f = &a253,
+  .next = NULL,
+};
+static struct ufsm_trigger t254_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t254 = {
+  .id = "t254",
+  .name = "",
+  .trigger = t254_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 156,
+  .action = &t254effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s113,
+  .dest = &s111,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t255,
+};
+static struct ufsm_action t254effect = {
+  .id = "t254effect",
+  .name = "a254",
+  .f = &a254,
+  .next = NULL,
+};
+static struct ufsm_trigger t255_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t255_exit_path[] = {
+  &r22,
+  &r2,
+  NULL,
+};
+static struct ufsm_region * t255_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t255 = {
+  .id = "t255",
+  .name = "",
+  .trigger = t255_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 157,
+  .action = &t255effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s114,
+  .dest = &s6,
+  .lca = &r0,
+  .exit_path = t255_exit_path,
+  .enter_path = t255_enter_path,
+  .next = &t256,
+};
+static struct ufsm_action t255effect = {
+  .id = "t255effect",
+  .name = "a255",
+  .f = &a255,
+  .next = NULL,
+};
+static struct ufsm_trigger t256_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t256_exit_path[] = {
+  &r22,
+  NULL,
+};
+static struct ufsm_region * t256_enter_path[] = {
+  &r24,
+  NULL,
+};
+static struct ufsm_transition t256 = {
+  .id = "t256",
+  .name = "",
+  .trigger = t256_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 158,
+  .action = &t256effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s114,
+  .dest = &s124,
+  .lca = &r2,
+  .exit_path = t256_exit_path,
+  .enter_path = t256_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t256effect = {
+  .id = "t256effect",
+  .name = "a256",
+  .f = &a256,
+  .next = NULL,
+};
+static struct ufsm_transition * s114_dispatch_4[] = {
+  &t255,
+  &t256,
+  NULL,
+};
+static struct ufsm_dispatch s114_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s114_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s114_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s114 = {
+  .id   = "s114",
+  .name = "S114",
+  .kind = 0,
+  .index = 82,
+  .parent_region = &r22,
+  .entry = &s114entry,
+  .doact = NULL,
+  .exit = &s114exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s114_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s114_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s113,
+};
+static struct ufsm_entry_exit s114entry = {
+  .id = "s114entry",
+  .name = "e114",
+  .f = &e114,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s114exit = {
+  .id = "s114exit",
+  .name = "x114",
+  .f = &x114,
+  .next = NULL,
+};
+static struct ufsm_transition * s113_dispatch_5[] = {
+  &t254,
+  NULL,
+};
+static struct ufsm_transition * s113_dispatch_6[] = {
+  &t253,
+  NULL,
+};
+static struct ufsm_dispatch s113_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s113_dispatch_5,
+},
+{
+  .ev = 6,
+  .transition = s113_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s113_interest[] = {
+  0x0000007a,
+};
+static struct ufsm_state s113 = {
+  .id   = "s113",
+  .name = "S113",
+  .kind = 0,
+  .index = 83,
+  .parent_region = &r22,
+  .entry = &s113entry,
+  .doact = NULL,
+  .exit = &s113exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s113_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s113_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s112,
+};
+static struct ufsm_entry_exit s113entry = {
+  .id = "s113entry",
+  .name = "e113",
+  .f = &e113,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s113exit = {
+  .id = "s113exit",
+  .name = "x113",
+  .f = &x113,
+  .next = NULL,
+};
+static struct ufsm_transition * s112_dispatch_4[] = {
+  &t252,
+  NULL,
+};
+static struct ufsm_transition * s112_dispatch_5[] = {
+  &t251,
+  NULL,
+};
+static struct ufsm_dispatch s112_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s112_dispatch_4,
+},
+{
+  .ev = 5,
+  .transition = s112_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s112_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s112 = {
+  .id   = "s112",
+  .name = "S112",
+  .kind = 0,
+  .index = 84,
+  .parent_region = &r22,
+  .entry = &s112entry,
+  .doact = NULL,
+  .exit = &s112exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s112_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s112_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s111,
+};
+static struct ufsm_entry_exit s112entry = {
+  .id = "s112entry",
+  .name = "e112",
+  .f = &e112,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s112exit = {
+  .id = "s112exit",
+  .name = "x112",
+  .f = &x112,
+  .next = NULL,
+};
+static struct ufsm_transition * s111_dispatch_0[] = {
+  &t249,
+  NULL,
+};
+static struct ufsm_transition * s111_dispatch_2[] = {
+  &t250,
+  NULL,
+};
+static struct ufsm_dispatch s111_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s111_dispatch_0,
+},
+{
+  .ev = 2,
+  .transition = s111_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s111_interest[] = {
+  0x0000003f,
+};
+static struct ufsm_state s111 = {
+  .id   = "s111",
+  .name = "S111",
+  .kind = 0,
+  .index = 85,
+  .parent_region = &r22,
+  .entry = &s111entry,
+  .doact = NULL,
+  .exit = &s111exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s111_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s111_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s110,
+};
+static struct ufsm_entry_exit s111entry = {
+  .id = "s111entry",
+  .name = "e111",
+  .f = &e111,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s111exit = {
+  .id = "s111exit",
+  .name = "x111",
+  .f = &x111,
+  .next = NULL,
+};
+static struct ufsm_dispatch s110_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s110_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s110 = {
+  .id   = "s110",
+  .name = "Init",
+  .kind = 1,
+  .index = 86,
+  .parent_region = &r22,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s110_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s110_interest,
+  .time_events = NULL,
+  .completion = &t22,
+  .next = NULL,
+};
+static struct ufsm_region r21 = {
+  .id = "r21",
+  .name = "R21",
+  .state = &s109,
+  .has_history = false,
+  .history = NULL,
+  .index = 16,
+  .transition = &t21,
+  .parent_state = &s13,
+  .next = NULL,
+};
+static struct ufsm_transition t21 = {
+  .id = "t21",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 159,
+  .action = &t21effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s105,
+  .dest = &s107,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t241,
+};
+static struct ufsm_action t21effect = {
+  .id = "t21effect",
+  .name = "a21",
+  .f = &a21,
+  .next = NULL,
+};
+static struct ufsm_trigger t241_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t241 = {
+  .id = "t241",
+  .name = "",
+  .trigger = t241_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 160,
+  .action = &t241effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s106,
+  .dest = &s108,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t242,
+};
+static struct ufsm_action t241effect = {
+  .id = "t241effect",
+  .name = "a241",
+  .f = &a241,
+  .next = NULL,
+};
+static struct ufsm_trigger t242_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t242 = {
+  .id = "t242",
+  .name = "",
+  .trigger = t242_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 161,
+  .action = &t242effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s106,
+  .dest = &s106,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t243,
+};
+static struct ufsm_action t242effect = {
+  .id = "t242effect",
+  .name = "a242",
+  .f = &a242,
+  .next = NULL,
+};
+static struct ufsm_trigger t243_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t243 = {
+  .id = "t243",
+  .name = "",
+  .trigger = t243_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 162,
+  .action = &t243effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s107,
+  .dest = &s106,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t244,
+};
+static struct ufsm_action t243effect = {
+  .id = "t243effect",
+  .name = "a243",
+  .f = &a243,
+  .next = NULL,
+};
+static struct ufsm_trigger t244_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t244 = {
+  .id = "t244",
+  .name = "",
+  .trigger = t244_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 163,
+  .action = &t244effect,
+  .defer = false,
+  .guard = &t244guard,
+  .source = &s107,
+  .dest = &s109,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t245,
+};
+static struct ufsm_action t244effect = {
+  .id = "t244effect",
+  .name = "a244",
+  .f = &a244,
+  .next = NULL,
+};
+static struct ufsm_guard t244guard = {
+  .id = "t244guard",
+  .name = "g53",
+  .f = &g53,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t245_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t245 = {
+  .id = "t245",
+  .name = "",
+  .trigger = t245_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 164,
+  .action = &t245effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s108,
+  .dest = &s106,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t246,
+};
+static struct ufsm_action t245effect = {
+  .id = "t245effect",
+  .name = "a245",
+  .f = &a245,
+  .next = NULL,
+};
+static struct ufsm_trigger t246_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t246 = {
+  .id = "t246",
+  .name = "",
+  .trigger = t246_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 165,
+  .action = &t246effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s108,
+  .dest = &s106,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t247,
+};
+static struct ufsm_action t246effect = {
+  .id = "t246effect",
+  .name = "a246",
+  .f = &a246,
+  .next = NULL,
+};
+static struct ufsm_trigger t247_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t247 = {
+  .id = "t247",
+  .name = "",
+  .trigger = t247_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 166,
+  .action = &t247effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s109,
+  .dest = &s106,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t248,
+};
+static struct ufsm_action t247effect = {
+  .id = "t247effect",
+  .name = "a247",
+  .f = &a247,
+  .next = NULL,
+};
+static struct ufsm_trigger t248_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t248 = {
+  .id = "t248",
+  .name = "",
+  .trigger = t248_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 167,
+  .action = &t248effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s109,
+  .dest = &s107,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t675,
+};
+static struct ufsm_action t248effect = {
+  .id = "t248effect",
+  .name = "a248",
+  .f = &a248,
+  .next = NULL,
+};
+static struct ufsm_trigger t675_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t675 = {
+  .id = "t675",
+  .name = "",
+  .trigger = t675_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 168,
+  .action = &t675effect,
+  .defer = false,
+  .guard = &t675guard,
+  .source = &s108,
+  .dest = &s372,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t676,
+};
+static struct ufsm_action t675effect = {
+  .id = "t675effect",
+  .name = "a675",
+  .f = &a675,
+  .next = NULL,
+};
+static struct ufsm_guard t675guard = {
+  .id = "t675guard",
+  .name = "g192",
+  .f = &g192,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition t676 = {
+  .id = "t676",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 169,
+  .action = &t676effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s372,
+  .dest = &s106,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t676effect = {
+  .id = "t676effect",
+  .name = "a676",
+  .f = &a676,
+  .next = NULL,
+};
+static struct ufsm_transition * s109_dispatch_1[] = {
+  &t248,
+  NULL,
+};
+static struct ufsm_transition * s109_dispatch_4[] = {
+  &t247,
+  NULL,
+};
+static struct ufsm_dispatch s109_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s109_dispatch_1,
+},
+{
+  .ev = 4,
+  .transition = s109_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s109_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s109 = {
+  .id   = "s109",
+  .name = "S109",
+  .kind = 0,
+  .index = 87,
+  .parent_region = &r21,
+  .entry = &s109entry,
+  .doact = NULL,
+  .exit = &s109exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s109_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s109_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s108,
+};
+static struct ufsm_entry_exit s109entry = {
+  .id = "s109entry",
+  .name = "e109",
+  .f = &e109,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s109exit = {
+  .id = "s109exit",
+  .name = "x109",
+  .f = &x109,
+  .next = NULL,
+};
+static struct ufsm_transition * s108_dispatch_1[] = {
+  &t246,
+  NULL,
+};
+static struct ufsm_transition * s108_dispatch_6[] = {
+  &t245,
+  &t675,
+  NULL,
+};
+static struct ufsm_dispatch s108_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s108_dispatch_1,
+},
+{
+  .ev = 6,
+  .transition = s108_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s108_interest[] = {
+  0x0000007a,
+};
+static struct ufsm_state s108 = {
+  .id   = "s108",
+  .name = "S108",
+  .kind = 0,
+  .index = 88,
+  .parent_region = &r21,
+  .entry = &s108entry,
+  .doact = NULL,
+  .exit = &s108exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s108_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s108_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s107,
+};
+static struct ufsm_entry_exit s108entry = {
+  .id = "s108entry",
+  .name = "e108",
+  .f = &e108,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s108exit = {
+  .id = "s108exit",
+  .name = "x108",
+  .f = &x108,
+  .next = NULL,
+};
+static struct ufsm_transition * s107_dispatch_6[] = {
+  &t243,
+  &t244,
+  NULL,
+};
+static struct ufsm_dispatch s107_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s107_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s107_interest[] = {
+  0x0000007a,
+};
+static struct ufsm_state s107 = {
+  .id   = "s107",
+  .name = "S107",
+  .kind = 0,
+  .index = 89,
+  .parent_region = &r21,
+  .entry = &s107entry,
+  .doact = NULL,
+  .exit = &s107exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s107_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s107_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s106,
+};
+static struct ufsm_entry_exit s107entry = {
+  .id = "s107entry",
+  .name = "e107",
+  .f = &e107,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s107exit = {
+  .id = "s107exit",
+  .name = "x107",
+  .f = &x107,
+  .next = NULL,
+};
+static struct ufsm_transition * s106_dispatch_1[] = {
+  &t241,
+  NULL,
+};
+static struct ufsm_transition * s106_dispatch_2[] = {
+  &t242,
+  NULL,
+};
+static struct ufsm_dispatch s106_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s106_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = s106_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s106_interest[] = {
+  0x0000003e,
+};
+static struct ufsm_state s106 = {
+  .id   = "s106",
+  .name = "S106",
+  .kind = 0,
+  .index = 90,
+  .parent_region = &r21,
+  .entry = &s106entry,
+  .doact = NULL,
+  .exit = &s106exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s106_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s106_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s372,
+};
+static struct ufsm_entry_exit s106entry = {
+  .id = "s106entry",
+  .name = "e106",
+  .f = &e106,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s106exit = {
+  .id = "s106exit",
+  .name = "x106",
+  .f = &x106,
+  .next = NULL,
+};
+static struct ufsm_dispatch s372_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s372_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s372 = {
+  .id   = "s372",
+  .name = "(null)",
+  .kind = 10,
+  .index = 91,
+  .parent_region = &r21,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s372_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s372_interest,
+  .time_events = NULL,
+  .completion = &t676,
+  .next = &s105,
+};
+static struct ufsm_dispatch s105_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s105_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s105 = {
+  .id   = "s105",
+  .name = "Init",
+  .kind = 1,
+  .index = 92,
+  .parent_region = &r21,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s105_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s105_interest,
+  .time_events = NULL,
+  .completion = &t21,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s13entry = {
+  .id = "s13entry",
+  .name = "e13",
+  .f = &e13,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s13exit = {
+  .id = "s13exit",
+  .name = "x13",
+  .f = &x13,
+  .next = NULL,
+};
+static struct ufsm_transition * s12_dispatch_6[] = {
+  &t91,
+  &t92,
+  NULL,
+};
+static struct ufsm_dispatch s12_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s12_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s12_interest[] = {
+  0x00000052,
+};
+static struct ufsm_state s12 = {
+  .id   = "s12",
+  .name = "S12",
+  .kind = 0,
+  .index = 10,
+  .parent_region = &r2,
+  .entry = &s12entry,
+  .doact = NULL,
+  .exit = &s12exit,
+  .region = &r20,
+  .submachine = NULL,
+  .dispatch = s12_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s12_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s11,
+};
+static struct ufsm_region r20 = {
+  .id = "r20",
+  .name = "R20",
+  .state = &s104,
+  .has_history = false,
+  .history = NULL,
+  .index = 13,
+  .transition = &t20,
+  .parent_state = &s12,
+  .next = &r19,
+};
+static struct ufsm_transition t20 = {
+  .id = "t20",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 132,
+  .action = &t20effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s100,
+  .dest = &s104,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t233,
+};
+static struct ufsm_action t20effect = {
+  .id = "t20effect",
+  .name = "a20",
+  .f = &a20,
+  .next = NULL,
+};
+static struct ufsm_trigger t233_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t233 = {
+  .id = "t233",
+  .name = "",
+  .trigger = t233_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 133,
+  .action = &t233effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s101,
+  .dest = &s102,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t234,
+};
+static struct ufsm_action t233effect = {
+  .id = "t233effect",
+  .name = "a233",
+  .f = &a233,
+  .next = NULL,
+};
+static struct ufsm_trigger t234_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t234_exit_path[] = {
+  &r20,
+  NULL,
+};
+static struct ufsm_region * t234_enter_path[] = {
+  &r21,
+  NULL,
+};
+static struct ufsm_transition t234 = {
+  .id = "t234",
+  .name = "",
+  .trigger = t234_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 134,
+  .action = &t234effect,
+  .defer = false,
+  .guard = &t234guard,
+  .source = &s101,
+  .dest = &s106,
+  .lca = &r2,
+  .exit_path = t234_exit_path,
+  .enter_path = t234_enter_path,
+  .next = &t235,
+};
+static struct ufsm_action t234effect = {
+  .id = "t234effect",
+  .name = "a234",
+  .f = &a234,
+  .next = NULL,
+};
+static struct ufsm_guard t234guard = {
+  .id = "t234guard",
+  .name = "g49",
+  .f = &g49,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t235_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t235 = {
+  .id = "t235",
+  .name = "",
+  .trigger = t235_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 135,
+  .action = &t235effect,
+  .defer = false,
+  .guard = &t235guard,
+  .source = &s102,
+  .dest = &s103,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t236,
+};
+static struct ufsm_action t235effect = {
+  .id = "t235effect",
+  .name = "a235",
+  .f = &a235,
+  .next = NULL,
+};
+static struct ufsm_guard t235guard = {
+  .id = "t235guard",
+  .name = "g50",
+  .f = &g50,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t236_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t236 = {
+  .id = "t236",
+  .name = "",
+  .trigger = t236_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 136,
+  .action = &t236effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s102,
+  .dest = &s104,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t237,
+};
+static struct ufsm_action t236effect = {
+  .id = "t236effect",
+  .name = "a236",
+  .f = &a236,
+  .next = NULL,
+};
+static struct ufsm_trigger t237_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t237_exit_path[] = {
+  &r20,
+  NULL,
+};
+static struct ufsm_region * t237_enter_path[] = {
+  &r19,
+  NULL,
+};
+static struct ufsm_transition t237 = {
+  .id = "t237",
+  .name = "",
+  .trigger = t237_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 137,
+  .action = &t237effect,
+  .defer = false,
+  .guard = &t237guard,
+  .source = &s103,
+  .dest = &s96,
+  .lca = &r2,
+  .exit_path = t237_exit_path,
+  .enter_path = t237_enter_path,
+  .next = &t238,
+};
+static struct ufsm_action t237effect = {
+  .id = "t237effect",
+  .name = "a237",
+  .f = &a237,
+  .next = NULL,
+};
+static struct ufsm_guard t237guard = {
+  .id = "t237guard",
+  .name = "g51",
+  .f = &g51,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t238_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t238 = {
+  .id = "t238",
+  .name = "",
+  .trigger = t238_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 138,
+  .action = &t238effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s103,
+  .dest = &s101,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t239,
+};
+static struct ufsm_action t238effect = {
+  .id = "t238effect",
+  .name = "a238",
+  .f = &a238,
+  .next = NULL,
+};
+static struct ufsm_trigger t239_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t239 = {
+  .id = "t239",
+  .name = "",
+  .trigger = t239_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 139,
+  .action = &t239effect,
+  .defer = false,
+  .guard = &t239guard,
+  .source = &s104,
+  .dest = &s101,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t240,
+};
+static struct ufsm_action t239effect = {
+  .id = "t239effect",
+  .name = "a239",
+  .f = &a239,
+  .next = NULL,
+};
+static struct ufsm_guard t239guard = {
+  .id = "t239guard",
+  .name = "g52",
+  .f = &g52,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t240_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t240_exit_path[] = {
+  &r20,
+  NULL,
+};
+static struct ufsm_region * t240_enter_path[] = {
+  &r22,
+  NULL,
+};
+static struct ufsm_transition t240 = {
+  .id = "t240",
+  .name = "",
+  .trigger = t240_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 140,
+  .action = &t240effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s104,
+  .dest = &s111,
+  .lca = &r2,
+  .exit_path = t240_exit_path,
+  .enter_path = t240_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t240effect = {
+  .id = "t240effect",
+  .name = "a240",
+  .f = &a240,
+  .next = NULL,
+};
+static struct ufsm_transition * s104_dispatch_1[] = {
+  &t239,
+  NULL,
+};
+static struct ufsm_transition * s104_dispatch_7[] = {
+  &t240,
+  NULL,
+};
+static struct ufsm_dispatch s104_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s104_dispatch_1,
+},
+{
+  .ev = 7,
+  .transition = s104_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s104_interest[] = {
+  0x000000d2,
+};
+static struct ufsm_state s104 = {
+  .id   = "s104",
+  .name = "S104",
+  .kind = 0,
+  .index = 72,
+  .parent_region = &r20,
+  .entry = &s104entry,
+  .doact = NULL,
+  .exit = &s104exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s104_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s104_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s103,
+};
+static struct ufsm_entry_exit s104entry = {
+  .id = "s104entry",
+  .name = "e104",
+  .f = &e104,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s104exit = {
+  .id = "s104exit",
+  .name = "x104",
+  .f = &x104,
+  .next = NULL,
+};
+static struct ufsm_transition * s103_dispatch_5[] = {
+  &t238,
+  NULL,
+};
+static struct ufsm_transition * s103_dispatch_7[] = {
+  &t237,
+  NULL,
+};
+static struct ufsm_dispatch s103_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s103_dispatch_5,
+},
+{
+  .ev = 7,
+  .transition = s103_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s103_interest[] = {
+  0x000000f2,
+};
+static struct ufsm_state s103 = {
+  .id   = "s103",
+  .name = "S103",
+  .kind = 0,
+  .index = 73,
+  .parent_region = &r20,
+  .entry = &s103entry,
+  .doact = NULL,
+  .exit = &s103exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s103_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s103_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s102,
+};
+static struct ufsm_entry_exit s103entry = {
+  .id = "s103entry",
+  .name = "e103",
+  .f = &e103,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s103exit = {
+  .id = "s103exit",
+  .name = "x103",
+  .f = &x103,
+  .next = NULL,
+};
+static struct ufsm_transition * s102_dispatch_0[] = {
+  &t235,
+  NULL,
+};
+static struct ufsm_transition * s102_dispatch_7[] = {
+  &t236,
+  NULL,
+};
+static struct ufsm_dispatch s102_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s102_dispatch_0,
+},
+{
+  .ev = 7,
+  .transition = s102_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s102_interest[] = {
+  0x000000d3,
+};
+static struct ufsm_state s102 = {
+  .id   = "s102",
+  .name = "S102",
+  .kind = 0,
+  .index = 74,
+  .parent_region = &r20,
+  .entry = &s102entry,
+  .doact = NULL,
+  .exit = &s102exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s102_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s102_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s101,
+};
+static struct ufsm_entry_exit s102entry = {
+  .id = "s102entry",
+  .name = "e102",
+  .f = &e102,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s102exit = {
+  .id = "s102exit",
+  .name = "x102",
+  .f = &x102,
+  .next = NULL,
+};
+static struct ufsm_transition * s101_dispatch_2[] = {
+  &t234,
+  NULL,
+};
+static struct ufsm_transition * s101_dispatch_3[] = {
+  &t233,
+  NULL,
+};
+static struct ufsm_dispatch s101_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s101_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s101_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s101_interest[] = {
+  0x0000005e,
+};
+static struct ufsm_state s101 = {
+  .id   = "s101",
+  .name = "S101",
+  .kind = 0,
+  .index = 75,
+  .parent_region = &r20,
+  .entry = &s101entry,
+  .doact = NULL,
+  .exit = &s101exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s101_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s101_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s100,
+};
+static struct ufsm_entry_exit s101entry = {
+  .id = "s101entry",
+  .name = "e101",
+  .f = &e101,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s101exit = {
+  .id = "s101exit",
+  .name = "x101",
+  .f = &x101,
+  .next = NULL,
+};
+static struct ufsm_dispatch s100_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s100_interest[] = {
+  0x00000052,
+};
+static struct ufsm_state s100 = {
+  .id   = "s100",
+  .name = "Init",
+  .kind = 1,
+  .index = 76,
+  .parent_region = &r20,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s100_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s100_interest,
+  .time_events = NULL,
+  .completion = &t20,
+  .next = NULL,
+};
+static struct ufsm_region r19 = {
+  .id = "r19",
+  .name = "R19",
+  .state = &s99,
+  .has_history = false,
+  .history = NULL,
+  .index = 14,
+  .transition = &t19,
+  .parent_state = &s12,
+  .next = NULL,
+};
+static struct ufsm_transition t19 = {
+  .id = "t19",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 141,
+  .action = &t19effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s95,
+  .dest = &s96,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t225,
+};
+static struct ufsm_action t19effect = {
+  .id = "t19effect",
+  .name = "a19",
+  .f = &a19,
+  .next = NULL,
+};
+static struct ufsm_trigger t225_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t225 = {
+  .id = "t225",
+  .name = "",
+  .trigger = t225_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 142,
+  .action = &t225effect,
+  .defer = false,
+  .guard = &t225guard,
+  .source = &s96,
+  .dest = &s96,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t226,
+};
+static struct ufsm_action t225effect = {
+  .id = "t225effect",
+  .name = "a225",
+  .f = &a225,
+  .next = NULL,
+};
+static struct ufsm_guard t225guard = {
+  .id = "t225guard",
+  .name = "g45",
+  .f = &g45,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t226_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t226 = {
+  .id = "t226",
+  .name = "",
+  .trigger = t226_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 143,
+  .action = &t226effect,
+  .defer = false,
+  .guard = &t226guard,
+  .source = &s96,
+  .dest = &s98,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t227,
+};
+static struct ufsm_action t226effect = {
+  .id = "t226effect",
+  .name = "a226",
+  .f = &a226,
+  .next = NULL,
+};
+static struct ufsm_guard t226guard = {
+  .id = "t226guard",
+  .name = "g46",
+  .f = &g46,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t227_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t227 = {
+  .id = "t227",
+  .name = "",
+  .trigger = t227_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 144,
+  .action = &t227effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s97,
+  .dest = &s98,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t228,
+};
+static struct ufsm_action t227effect = {
+  .id = "t227effect",
+  .name = "a227",
+  .f = &a227,
+  .next = NULL,
+};
+static struct ufsm_trigger t228_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t228 = {
+  .id = "t228",
+  .name = "",
+  .trigger = t228_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 145,
+  .action = &t228effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s97,
+  .dest = &s96,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t229,
+};
+static struct ufsm_action t228effect = {
+  .id = "t228effect",
+  .name = "a228",
+  .f = &a228,
+  .next = NULL,
+};
+static struct ufsm_trigger t229_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t229 = {
+  .id = "t229",
+  .name = "",
+  .trigger = t229_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 146,
+  .action = &t229effect,
+  .defer = false,
+  .guard = &t229guard,
+  .source = &s98,
+  .dest = &s96,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t230,
+};
+static struct ufsm_action t229effect = {
+  .id = "t229effect",
+  .name = "a229",
+  .f = &a229,
+  .next = NULL,
+};
+static struct ufsm_guard t229guard = {
+  .id = "t229guard",
+  .name = "g47",
+  .f = &g47,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t230_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t230 = {
+  .id = "t230",
+  .name = "",
+  .trigger = t230_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 147,
+  .action = &t230effect,
+  .defer = false,
+  .guard = &t230guard,
+  .source = &s98,
+  .dest = &s97,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t231,
+};
+static struct ufsm_action t230effect = {
+  .id = "t230effect",
+  .name = "a230",
+  .f = &a230,
+  .next = NULL,
+};
+static struct ufsm_guard t230guard = {
+  .id = "t230guard",
+  .name = "g48",
+  .f = &g48,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t231_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t231 = {
+  .id = "t231",
+  .name = "",
+  .trigger = t231_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 148,
+  .action = &t231effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s99,
+  .dest = &s98,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t232,
+};
+static struct ufsm_action t231effect = {
+  .id = "t231effect",
+  .name = "a231",
+  .f = &a231,
+  .next = NULL,
+};
+static struct ufsm_trigger t232_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t232_exit_path[] = {
+  &r19,
+  NULL,
+};
+static struct ufsm_region * t232_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t232 = {
+  .id = "t232",
+  .name = "",
+  .trigger = t232_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 149,
+  .action = &t232effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s99,
+  .dest = &s11,
+  .lca = &r2,
+  .exit_path = t232_exit_path,
+  .enter_path = t232_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t232effect = {
+  .id = "t232effect",
+  .name = "a232",
+  .f = &a232,
+  .next = NULL,
+};
+static struct ufsm_transition * s99_dispatch_1[] = {
+  &t232,
+  NULL,
+};
+static struct ufsm_transition * s99_dispatch_2[] = {
+  &t231,
+  NULL,
+};
+static struct ufsm_dispatch s99_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s99_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = s99_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s99_interest[] = {
+  0x00000056,
+};
+static struct ufsm_state s99 = {
+  .id   = "s99",
+  .name = "S99",
+  .kind = 0,
+  .index = 77,
+  .parent_region = &r19,
+  .entry = &s99entry,
+  .doact = NULL,
+  .exit = &s99exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s99_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s99_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s98,
+};
+static struct ufsm_entry_exit s99entry = {
+  .id = "s99entry",
+  .name = "e99",
+  .f = &e99,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s99exit = {
+  .id = "s99exit",
+  .name = "x99",
+  .f = &x99,
+  .next = NULL,
+};
+static struct ufsm_transition * s98_dispatch_0[] = {
+  &t230,
+  NULL,
+};
+static struct ufsm_transition * s98_dispatch_5[] = {
+  &t229,
+  NULL,
+};
+static struct ufsm_dispatch s98_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s98_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s98_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s98_interest[] = {
+  0x00000073,
+};
+static struct ufsm_state s98 = {
+  .id   = "s98",
+  .name = "S98",
+  .kind = 0,
+  .index = 78,
+  .parent_region = &r19,
+  .entry = &s98entry,
+  .doact = NULL,
+  .exit = &s98exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s98_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s98_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s97,
+};
+static struct ufsm_entry_exit s98entry = {
+  .id = "s98entry",
+  .name = "e98",
+  .f = &e98,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s98exit = {
+  .id = "s98exit",
+  .name = "x98",
+  .f = &x98,
+  .next = NULL,
+};
+static struct ufsm_transition * s97_dispatch_0[] = {
+  &t227,
+  NULL,
+};
+static struct ufsm_transition * s97_dispatch_2[] = {
+  &t228,
+  NULL,
+};
+static struct ufsm_dispatch s97_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s97_dispatch_0,
+},
+{
+  .ev = 2,
+  .transition = s97_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s97_interest[] = {
+  0x00000057,
+};
+static struct ufsm_state s97 = {
+  .id   = "s97",
+  .name = "S97",
+  .kind = 0,
+  .index = 79,
+  .parent_region = &r19,
+  .entry = &s97entry,
+  .doact = NULL,
+  .exit = &s97exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s97_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s97_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s96,
+};
+static struct ufsm_entry_exit s97entry = {
+  .id = "s97entry",
+  .name = "e97",
+  .f = &e97,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s97exit = {
+  .id = "s97exit",
+  .name = "x97",
+  .f = &x97,
+  .next = NULL,
+};
+static struct ufsm_transition * s96_dispatch_0[] = {
+  &t226,
+  NULL,
+};
+static struct ufsm_transition * s96_dispatch_1[] = {
+  &t225,
+  NULL,
+};
+static struct ufsm_dispatch s96_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s96_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = s96_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s96_interest[] = {
+  0x00000053,
+};
+static struct ufsm_state s96 = {
+  .id   = "s96",
+  .name = "S96",
+  .kind = 0,
+  .index = 80,
+  .parent_region = &r19,
+  .entry = &s96entry,
+  .doact = NULL,
+  .exit = &s96exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s96_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s96_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s95,
+};
+static struct ufsm_entry_exit s96entry = {
+  .id = "s96entry",
+  .name = "e96",
+  .f = &e96,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s96exit = {
+  .id = "s96exit",
+  .name = "x96",
+  .f = &x96,
+  .next = NULL,
+};
+static struct ufsm_dispatch s95_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s95_interest[] = {
+  0x00000052,
+};
+static struct ufsm_state s95 = {
+  .id   = "s95",
+  .name = "Init",
+  .kind = 1,
+  .index = 81,
+  .parent_region = &r19,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s95_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s95_interest,
+  .time_events = NULL,
+  .completion = &t19,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s12entry = {
+  .id = "s12entry",
+  .name = "e12",
+  .f = &e12,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s12exit = {
+  .id = "s12exit",
+  .name = "x12",
+  .f = &x12,
+  .next = NULL,
+};
+static struct ufsm_transition * s11_dispatch_0[] = {
+  &t89,
+  NULL,
+};
+static struct ufsm_transition * s11_dispatch_6[] = {
+  &t90,
+  NULL,
+};
+static struct ufsm_dispatch s11_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s11_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s11_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s11_interest[] = {
+  0x00000053,
+};
+static struct ufsm_state s11 = {
+  .id   = "s11",
+  .name = "S11",
+  .kind = 0,
+  .index = 11,
+  .parent_region = &r2,
+  .entry = &s11entry,
+  .doact = NULL,
+  .exit = &s11exit,
+  .region = &r18,
+  .submachine = NULL,
+  .dispatch = s11_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s11_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s10,
+};
+static struct ufsm_region r18 = {
+  .id = "r18",
+  .name = "R18",
+  .state = &s94,
+  .has_history = false,
+  .history = NULL,
+  .index = 11,
+  .transition = &t18,
+  .parent_state = &s11,
+  .next = &r17,
+};
+static struct ufsm_transition t18 = {
+  .id = "t18",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 114,
+  .action = &t18effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s90,
+  .dest = &s91,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t217,
+};
+static struct ufsm_action t18effect = {
+  .id = "t18effect",
+  .name = "a18",
+  .f = &a18,
+  .next = NULL,
+};
+static struct ufsm_trigger t217_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t217 = {
+  .id = "t217",
+  .name = "",
+  .trigger = t217_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 115,
+  .action = &t217effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s91,
+  .dest = &s91,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t218,
+};
+static struct ufsm_action t217effect = {
+  .id = "t217effect",
+  .name = "a217",
+  .f = &a217,
+  .next = NULL,
+};
+static struct ufsm_trigger t218_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t218 = {
+  .id = "t218",
+  .name = "",
+  .trigger = t218_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 116,
+  .action = &t218effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s91,
+  .dest = &s94,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t219,
+};
+static struct ufsm_action t218effect = {
+  .id = "t218effect",
+  .name = "a218",
+  .f = &a218,
+  .next = NULL,
+};
+static struct ufsm_trigger t219_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t219 = {
+  .id = "t219",
+  .name = "",
+  .trigger = t219_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 117,
+  .action = &t219effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s92,
+  .dest = &s93,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t220,
+};
+static struct ufsm_action t219effect = {
+  .id = "t219effect",
+  .name = "a219",
+  .f = &a219,
+  .next = NULL,
+};
+static struct ufsm_trigger t220_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t220 = {
+  .id = "t220",
+  .name = "",
+  .trigger = t220_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 118,
+  .action = &t220effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s92,
+  .dest = &s92,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t221,
+};
+static struct ufsm_action t220effect = {
+  .id = "t220effect",
+  .name = "a220",
+  .f = &a220,
+  .next = NULL,
+};
+static struct ufsm_trigger t221_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t221_exit_path[] = {
+  &r18,
+  NULL,
+};
+static struct ufsm_region * t221_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t221 = {
+  .id = "t221",
+  .name = "",
+  .trigger = t221_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 119,
+  .action = &t221effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s93,
+  .dest = &s14,
+  .lca = &r2,
+  .exit_path = t221_exit_path,
+  .enter_path = t221_enter_path,
+  .next = &t222,
+};
+static struct ufsm_action t221effect = {
+  .id = "t221effect",
+  .name = "a221",
+  .f = &a221,
+  .next = NULL,
+};
+static struct ufsm_trigger t222_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t222 = {
+  .id = "t222",
+  .name = "",
+  .trigger = t222_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 120,
+  .action = &t222effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s93,
+  .dest = &s91,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t223,
+};
+static struct ufsm_action t222effect = {
+  .id = "t222effect",
+  .name = "a222",
+  .f = &a222,
+  .next = NULL,
+};
+static struct ufsm_trigger t223_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t223_exit_path[] = {
+  &r18,
+  NULL,
+};
+static struct ufsm_region * t223_enter_path[] = {
+  &r19,
+  NULL,
+};
+static struct ufsm_transition t223 = {
+  .id = "t223",
+  .name = "",
+  .trigger = t223_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 121,
+  .action = &t223effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s94,
+  .dest = &s99,
+  .lca = &r2,
+  .exit_path = t223_exit_path,
+  .enter_path = t223_enter_path,
+  .next = &t224,
+};
+static struct ufsm_action t223effect = {
+  .id = "t223effect",
+  .name = "a223",
+  .f = &a223,
+  .next = NULL,
+};
+static struct ufsm_trigger t224_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t224_exit_path[] = {
+  &r18,
+  &r2,
+  NULL,
+};
+static struct ufsm_region * t224_enter_path[] = {
+  &r5,
+  NULL,
+};
+static struct ufsm_transition t224 = {
+  .id = "t224",
+  .name = "",
+  .trigger = t224_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 122,
+  .action = &t224effect,
+  .defer = false,
+  .guard = &t224guard,
+  .source = &s94,
+  .dest = &s29,
+  .lca = &r0,
+  .exit_path = t224_exit_path,
+  .enter_path = t224_enter_path,
+  .next = NULL,
+};
+static struct ufsm_action t224effect = {
+  .id = "t224effect",
+  .name = "a224",
+  .f = &a224,
+  .next = NULL,
+};
+static struct ufsm_guard t224guard = {
+  .id = "t224guard",
+  .name = "g44",
+  .f = &g44,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s94_dispatch_3[] = {
+  &t224,
+  NULL,
+};
+static struct ufsm_transition * s94_dispatch_6[] = {
+  &t223,
+  NULL,
+};
+static struct ufsm_dispatch s94_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s94_dispatch_3,
+},
+{
+  .ev = 6,
+  .transition = s94_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s94_interest[] = {
+  0x0000005b,
+};
+static struct ufsm_state s94 = {
+  .id   = "s94",
+  .name = "S94",
+  .kind = 0,
+  .index = 62,
+  .parent_region = &r18,
+  .entry = &s94entry,
+  .doact = NULL,
+  .exit = &s94exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s94_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s94_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s93,
+};
+static struct ufsm_entry_exit s94entry = {
+  .id = "s94entry",
+  .name = "e94",
+  .f = &e94,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s94exit = {
+  .id = "s94exit",
+  .name = "x94",
+  .f = &x94,
+  .next = NULL,
+};
+static struct ufsm_transition * s93_dispatch_7[] = {
+  &t221,
+  &t222,
+  NULL,
+};
+static struct ufsm_dispatch s93_dispatch[] = {
+{
+  .ev = 7,
+  .transition = s93_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s93_interest[] = {
+  0x000000d3,
+};
+static struct ufsm_state s93 = {
+  .id   = "s93",
+  .name = "S93",
+  .kind = 0,
+  .index = 63,
+  .parent_region = &r18,
+  .entry = &s93entry,
+  .doact = NULL,
+  .exit = &s93exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s93_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s93_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s92,
+};
+static struct ufsm_entry_exit s93entry = {
+  .id = "s93entry",
+  .name = "e93",
+  .f = &e93,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s93exit = {
+  .id = "s93exit",
+  .name = "x93",
+  .f = &x93,
+  .next = NULL,
+};
+static struct ufsm_transition * s92_dispatch_1[] = {
+  &t220,
+  NULL,
+};
+static struct ufsm_transition * s92_dispatch_5[] = {
+  &t219,
+  NULL,
+};
+static struct ufsm_dispatch s92_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s92_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s92_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s92_interest[] = {
+  0x00000073,
+};
+static struct ufsm_state s92 = {
+  .id   = "s92",
+  .name = "S92",
+  .kind = 0,
+  .index = 64,
+  .parent_region = &r18,
+  .entry = &s92entry,
+  .doact = NULL,
+  .exit = &s92exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s92_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s92_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s91,
+};
+static struct ufsm_entry_exit s92entry = {
+  .id = "s92entry",
+  .name = "e92",
+  .f = &e92,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s92exit = {
+  .id = "s92exit",
+  .name = "x92",
+  .f = &x92,
+  .next = NULL,
+};
+static struct ufsm_transition * s91_dispatch_2[] = {
+  &t217,
+  NULL,
+};
+static struct ufsm_transition * s91_dispatch_4[] = {
+  &t218,
+  NULL,
+};
+static struct ufsm_dispatch s91_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s91_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s91_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s91_interest[] = {
+  0x00000057,
+};
+static struct ufsm_state s91 = {
+  .id   = "s91",
+  .name = "S91",
+  .kind = 0,
+  .index = 65,
+  .parent_region = &r18,
+  .entry = &s91entry,
+  .doact = NULL,
+  .exit = &s91exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s91_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s91_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s90,
+};
+static struct ufsm_entry_exit s91entry = {
+  .id = "s91entry",
+  .name = "e91",
+  .f = &e91,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s91exit = {
+  .id = "s91exit",
+  .name = "x91",
+  .f = &x91,
+  .next = NULL,
+};
+static struct ufsm_dispatch s90_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s90_interest[] = {
+  0x00000053,
+};
+static struct ufsm_state s90 = {
+  .id   = "s90",
+  .name = "Init",
+  .kind = 1,
+  .index = 66,
+  .parent_region = &r18,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s90_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s90_interest,
+  .time_events = NULL,
+  .completion = &t18,
+  .next = NULL,
+};
+static struct ufsm_region r17 = {
+  .id = "r17",
+  .name = "R17",
+  .state = &s89,
+  .has_history = false,
+  .history = NULL,
+  .index = 12,
+  .transition = &t17,
+  .parent_state = &s11,
+  .next = NULL,
+};
+static struct ufsm_transition t17 = {
+  .id = "t17",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 123,
+  .action = &t17effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s85,
+  .dest = &s86,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t209,
+};
+static struct ufsm_action t17effect = {
+  .id = "t17effect",
+  .name = "a17",
+  .f = &a17,
+  .next = NULL,
+};
+static struct ufsm_trigger t209_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t209_exit_path[] = {
+  &r17,
+  NULL,
+};
+static struct ufsm_region * t209_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t209 = {
+  .id = "t209",
+  .name = "",
+  .trigger = t209_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 124,
+  .action = &t209effect,
+  .defer = false,
+  .guard = &t209guard,
+  .source = &s86,
+  .dest = &s11,
+  .lca = &r2,
+  .exit_path = t209_exit_path,
+  .enter_path = t209_enter_path,
+  .next = &t210,
+};
+static struct ufsm_action t209effect = {
+  .id = "t209effect",
+  .name = "a209",
+  .f = &a209,
+  .next = NULL,
+};
+static struct ufsm_guard t209guard = {
+  .id = "t209guard",
+  .name = "g40",
+  .f = &g40,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t210_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t210 = {
+  .id = "t210",
+  .name = "",
+  .trigger = t210_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 125,
+  .action = &t210effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s86,
+  .dest = &s89,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t211,
+};
+static struct ufsm_action t210effect = {
+  .id = "t210effect",
+  .name = "a210",
+  .f = &a210,
+  .next = NULL,
+};
+static struct ufsm_trigger t211_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t211 = {
+  .id = "t211",
+  .name = "",
+  .trigger = t211_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 126,
+  .action = &t211effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s87,
+  .dest = &s87,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t212,
+};
+static struct ufsm_action t211effect = {
+  .id = "t211effect",
+  .name = "a211",
+  .f = &a211,
+  .next = NULL,
+};
+static struct ufsm_trigger t212_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t212_exit_path[] = {
+  &r17,
+  NULL,
+};
+static struct ufsm_region * t212_enter_path[] = {
+  &r20,
+  NULL,
+};
+static struct ufsm_transition t212 = {
+  .id = "t212",
+  .name = "",
+  .trigger = t212_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 127,
+  .action = &t212effect,
+  .defer = false,
+  .guard = &t212guard,
+  .source = &s87,
+  .dest = &s102,
+  .lca = &r2,
+  .exit_path = t212_exit_path,
+  .enter_path = t212_enter_path,
+  .next = &t213,
+};
+static struct ufsm_action t212effect = {
+  .id = "t212effect",
+  .name = "a212",
+  .f = &a212,
+  .next = NULL,
+};
+static struct ufsm_guard t212guard = {
+  .id = "t212guard",
+  .name = "g41",
+  .f = &g41,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t213_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t213_exit_path[] = {
+  &r17,
+  NULL,
+};
+static struct ufsm_region * t213_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t213 = {
+  .id = "t213",
+  .name = "",
+  .trigger = t213_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 128,
+  .action = &t213effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s88,
+  .dest = &s12,
+  .lca = &r2,
+  .exit_path = t213_exit_path,
+  .enter_path = t213_enter_path,
+  .next = &t214,
+};
+static struct ufsm_action t213effect = {
+  .id = "t213effect",
+  .name = "a213",
+  .f = &a213,
+  .next = NULL,
+};
+static struct ufsm_trigger t214_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t214 = {
+  .id = "t214",
+  .name = "",
+  .trigger = t214_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 129,
+  .action = &t214effect,
+  .defer = false,
+  .guard = &t214guard,
+  .source = &s88,
+  .dest = &s88,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t215,
+};
+static struct ufsm_action t214effect = {
+  .id = "t214effect",
+  .name = "a214",
+  .f = &a214,
+  .next = NULL,
+};
+static struct ufsm_guard t214guard = {
+  .id = "t214guard",
+  .name = "g42",
+  .f = &g42,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t215_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t215_exit_path[] = {
+  &r17,
+  &r2,
+  NULL,
+};
+static struct ufsm_region * t215_enter_path[] = {
+  &r8,
+  NULL,
+};
+static struct ufsm_transition t215 = {
+  .id = "t215",
+  .name = "",
+  .trigger = t215_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 130,
+  .action = &t215effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s89,
+  .dest = &s42,
+  .lca = &r0,
+  .exit_path = t215_exit_path,
+  .enter_path = t215_enter_path,
+  .next = &t216,
+};
+static struct ufsm_action t215effect = {
+  .id = "t215effect",
+  .name = "a215",
+  .f = &a215,
+  .next = NULL,
+};
+static struct ufsm_trigger t216_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t216 = {
+  .id = "t216",
+  .name = "",
+  .trigger = t216_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 131,
+  .action = &t216effect,
+  .defer = false,
+  .guard = &t216guard,
+  .source = &s89,
+  .dest = &s88,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t216effect = {
+  .id = "t216effect",
+  .name = "a216",
+  .f = &a216,
+  .next = NULL,
+};
+static struct ufsm_guard t216guard = {
+  .id = "t216guard",
+  .name = "g43",
+  .f = &g43,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s89_dispatch_4[] = {
+  &t215,
+  NULL,
+};
+static struct ufsm_transition * s89_dispatch_6[] = {
+  &t216,
+  NULL,
+};
+static struct ufsm_dispatch s89_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s89_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s89_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s89_interest[] = {
+  0x00000053,
+};
+static struct ufsm_state s89 = {
+  .id   = "s89",
+  .name = "S89",
+  .kind = 0,
+  .index = 67,
+  .parent_region = &r17,
+  .entry = &s89entry,
+  .doact = NULL,
+  .exit = &s89exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s89_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s89_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s88,
+};
+static struct ufsm_entry_exit s89entry = {
+  .id = "s89entry",
+  .name = "e89",
+  .f = &e89,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s89exit = {
+  .id = "s89exit",
+  .name = "x89",
+  .f = &x89,
+  .next = NULL,
+};
+static struct ufsm_transition * s88_dispatch_5[] = {
+  &t213,
+  NULL,
+};
+static struct ufsm_transition * s88_dispatch_7[] = {
+  &t214,
+  NULL,
+};
+static struct ufsm_dispatch s88_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s88_dispatch_5,
+},
+{
+  .ev = 7,
+  .transition = s88_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s88_interest[] = {
+  0x000000f3,
+};
+static struct ufsm_state s88 = {
+  .id   = "s88",
+  .name = "S88",
+  .kind = 0,
+  .index = 68,
+  .parent_region = &r17,
+  .entry = &s88entry,
+  .doact = NULL,
+  .exit = &s88exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s88_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s88_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s87,
+};
+static struct ufsm_entry_exit s88entry = {
+  .id = "s88entry",
+  .name = "e88",
+  .f = &e88,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s88exit = {
+  .id = "s88exit",
+  .name = "x88",
+  .f = &x88,
+  .next = NULL,
+};
+static struct ufsm_transition * s87_dispatch_2[] = {
+  &t211,
+  NULL,
+};
+static struct ufsm_transition * s87_dispatch_3[] = {
+  &t212,
+  NULL,
+};
+static struct ufsm_dispatch s87_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s87_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s87_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s87_interest[] = {
+  0x0000005f,
+};
+static struct ufsm_state s87 = {
+  .id   = "s87",
+  .name = "S87",
+  .kind = 0,
+  .index = 69,
+  .parent_region = &r17,
+  .entry = &s87entry,
+  .doact = NULL,
+  .exit = &s87exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s87_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s87_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s86,
+};
+static struct ufsm_entry_exit s87entry = {
+  .id = "s87entry",
+  .name = "e87",
+  .f = &e87,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s87exit = {
+  .id = "s87exit",
+  .name = "x87",
+  .f = &x87,
+  .next = NULL,
+};
+static struct ufsm_transition * s86_dispatch_0[] = {
+  &t209,
+  NULL,
+};
+static struct ufsm_transition * s86_dispatch_7[] = {
+  &t210,
+  NULL,
+};
+static struct ufsm_dispatch s86_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s86_dispatch_0,
+},
+{
+  .ev = 7,
+  .transition = s86_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s86_interest[] = {
+  0x000000d3,
+};
+static struct ufsm_state s86 = {
+  .id   = "s86",
+  .name = "S86",
+  .kind = 0,
+  .index = 70,
+  .parent_region = &r17,
+  .entry = &s86entry,
+  .doact = NULL,
+  .exit = &s86exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s86_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s86_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s85,
+};
+static struct ufsm_entry_exit s86entry = {
+  .id = "s86entry",
+  .name = "e86",
+  .f = &e86,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s86exit = {
+  .id = "s86exit",
+  .name = "x86",
+  .f = &x86,
+  .next = NULL,
+};
+static struct ufsm_dispatch s85_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s85_interest[] = {
+  0x00000053,
+};
+static struct ufsm_state s85 = {
+  .id   = "s85",
+  .name = "Init",
+  .kind = 1,
+  .index = 71,
+  .parent_region = &r17,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s85_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s85_interest,
+  .time_events = NULL,
+  .completion = &t17,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s11entry = {
+  .id = "s11entry",
+  .name = "e11",
+  .f = &e11,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s11exit = {
+  .id = "s11exit",
+  .name = "x11",
+  .f = &x11,
+  .next = NULL,
+};
+static struct ufsm_dispatch s10_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s10_interest[] = {
+  0x00000012,
+};
+static struct ufsm_state s10 = {
+  .id   = "s10",
+  .name = "Init",
+  .kind = 1,
+  .index = 12,
+  .parent_region = &r2,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s10_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s10_interest,
+  .time_events = NULL,
+  .completion = &t2,
+  .next = NULL,
+};
+static struct ufsm_region r1 = {
+  .id = "r1",
+  .name = "R1",
+  .state = &s9,
+  .has_history = true,
+  .history = NULL,
+  .index = 2,
+  .transition = &t1,
+  .parent_state = &s1,
+  .next = NULL,
+};
+static struct ufsm_transition t1 = {
+  .id = "t1",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 24,
+  .action = &t1effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s5,
+  .dest = &s8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t81,
+};
+static struct ufsm_action t1effect = {
+  .id = "t1effect",
+  .name = "a1",
+  .f = &a1,
+  .next = NULL,
+};
+static struct ufsm_trigger t81_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t81_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t81_enter_path[] = {
+  &r11,
+  NULL,
+};
+static struct ufsm_transition t81 = {
+  .id = "t81",
+  .name = "",
+  .trigger = t81_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 25,
+  .action = &t81effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s6,
+  .dest = &s59,
+  .lca = &r1,
+  .exit_path = t81_exit_path,
+  .enter_path = t81_enter_path,
+  .next = &t82,
+};
+static struct ufsm_action t81effect = {
+  .id = "t81effect",
+  .name = "a81",
+  .f = &a81,
+  .next = NULL,
+};
+static struct ufsm_trigger t82_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t82 = {
+  .id = "t82",
+  .name = "",
+  .trigger = t82_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 26,
+  .action = &t82effect,
+  .defer = false,
+  .guard = &t82guard,
+  .source = &s6,
+  .dest = &s8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t83,
+};
+static struct ufsm_action t82effect = {
+  .id = "t82effect",
+  .name = "a82",
+  .f = &a82,
+  .next = NULL,
+};
+static struct ufsm_guard t82guard = {
+  .id = "t82guard",
+  .name = "g4",
+  .f = &g4,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t83_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t83_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t83_enter_path[] = {
+  &r14,
+  NULL,
+};
+static struct ufsm_transition t83 = {
+  .id = "t83",
+  .name = "",
+  .trigger = t83_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 27,
+  .action = &t83effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s7,
+  .dest = &s74,
+  .lca = &r1,
+  .exit_path = t83_exit_path,
+  .enter_path = t83_enter_path,
+  .next = &t84,
+};
+static struct ufsm_action t83effect = {
+  .id = "t83effect",
+  .name = "a83",
+  .f = &a83,
+  .next = NULL,
+};
+static struct ufsm_trigger t84_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t84_exit_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_region * t84_enter_path[] = {
+  &r2,
+  NULL,
+};
+static struct ufsm_transition t84 = {
+  .id = "t84",
+  .name = "",
+  .trigger = t84_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 28,
+  .action = &t84effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s7,
+  .dest = &s12,
+  .lca = &r0,
+  .exit_path = t84_exit_path,
+  .enter_path = t84_enter_path,
+  .next = &t85,
+};
+static struct ufsm_action t84effect = {
+  .id = "t84effect",
+  .name = "a84",
+  .f = &a84,
+  .next = NULL,
+};
+static struct ufsm_trigger t85_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t85_exit_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_region * t85_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t85 = {
+  .id = "t85",
+  .name = "",
+  .trigger = t85_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 29,
+  .action = &t85effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s8,
+  .dest = &s2,
+  .lca = &r0,
+  .exit_path = t85_exit_path,
+  .enter_path = t85_enter_path,
+  .next = &t86,
+};
+static struct ufsm_action t85effect = {
+  .id = "t85effect",
+  .name = "a85",
+  .f = &a85,
+  .next = NULL,
+};
+static struct ufsm_trigger t86_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t86 = {
+  .id = "t86",
+  .name = "",
+  .trigger = t86_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 30,
+  .action = &t86effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s8,
+  .dest = &s7,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t87,
+};
+static struct ufsm_action t86effect = {
+  .id = "t86effect",
+  .name = "a86",
+  .f = &a86,
+  .next = NULL,
+};
+static struct ufsm_trigger t87_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t87_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t87_enter_path[] = {
+  &r16,
+  NULL,
+};
+static struct ufsm_transition t87 = {
+  .id = "t87",
+  .name = "",
+  .trigger = t87_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 31,
+  .action = &t87effect,
+  .defer = false,
+  .guard = &t87guard,
+  .source = &s9,
+  .dest = &s81,
+  .lca = &r1,
+  .exit_path = t87_exit_path,
+  .enter_path = t87_enter_path,
+  .next = &t88,
+};
+static struct ufsm_action t87effect = {
+  .id = "t87effect",
+  .name = "a87",
+  .f = &a87,
+  .next = NULL,
+};
+static struct ufsm_guard t87guard = {
+  .id = "t87guard",
+  .name = "g5",
+  .f = &g5,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t88_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t88 = {
+  .id = "t88",
+  .name = "",
+  .trigger = t88_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 32,
+  .action = &t88effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s9,
+  .dest = &s8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t695,
+};
+static struct ufsm_action t88effect = {
+  .id = "t88effect",
+  .name = "a88",
+  .f = &a88,
+  .next = NULL,
+};
+static struct ufsm_trigger t695_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t695 = {
+  .id = "t695",
+  .name = "",
+  .trigger = t695_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 33,
+  .action = &t695effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s6,
+  .dest = &s379,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t696,
+};
+static struct ufsm_action t695effect = {
+  .id = "t695effect",
+  .name = "a695",
+  .f = &a695,
+  .next = NULL,
+};
+static struct ufsm_region * t696_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t696_enter_path[] = {
+  &r15,
+  NULL,
+};
+static struct ufsm_transition t696 = {
+  .id = "t696",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 34,
+  .action = &t696effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s379,
+  .dest = &s79,
+  .lca = &r1,
+  .exit_path = t696_exit_path,
+  .enter_path = t696_enter_path,
+  .next = &t697,
+};
+static struct ufsm_action t696effect = {
+  .id = "t696effect",
+  .name = "a696",
+  .f = &a696,
+  .next = NULL,
+};
+static struct ufsm_region * t697_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t697_enter_path[] = {
+  &r16,
+  NULL,
+};
+static struct ufsm_transition t697 = {
+  .id = "t697",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 35,
+  .action = &t697effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s379,
+  .dest = &s82,
+  .lca = &r1,
+  .exit_path = t697_exit_path,
+  .enter_path = t697_enter_path,
+  .next = &t700,
+};
+static struct ufsm_action t697effect = {
+  .id = "t697effect",
+  .name = "a697",
+  .f = &a697,
+  .next = NULL,
+};
+static struct ufsm_transition t700 = {
+  .id = "t700",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 36,
+  .action = &t700effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s380,
+  .dest = &s6,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t702,
+};
+static struct ufsm_action t700effect = {
+  .id = "t700effect",
+  .name = "a700",
+  .f = &a700,
+  .next = NULL,
+};
+static struct ufsm_trigger t702_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t702_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * t702_enter_path[] = {
+  &r11,
+  NULL,
+};
+static struct ufsm_transition t702 = {
+  .id = "t702",
+  .name = "",
+  .trigger = t702_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 37,
+  .action = &t702effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s7,
+  .dest = &s381,
+  .lca = &r1,
+  .exit_path = t702_exit_path,
+  .enter_path = t702_enter_path,
+  .next = &t703,
+};
+static struct ufsm_action t702effect = {
+  .id = "t702effect",
+  .name = "a702",
+  .f = &a702,
+  .next = NULL,
+};
+static struct ufsm_transition t703 = {
+  .id = "t703",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 38,
+  .action = &t703effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s382,
+  .dest = &s8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t703effect = {
+  .id = "t703effect",
+  .name = "a703",
+  .f = &a703,
+  .next = NULL,
+};
+static struct ufsm_transition * s9_dispatch_2[] = {
+  &t87,
+  &t88,
+  NULL,
+};
+static struct ufsm_dispatch s9_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s9_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s9_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s9 = {
+  .id   = "s9",
+  .name = "S9",
+  .kind = 0,
+  .index = 13,
+  .parent_region = &r1,
+  .entry = &s9entry,
+  .doact = NULL,
+  .exit = &s9exit,
+  .region = &r16,
+  .submachine = NULL,
+  .dispatch = s9_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s9_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s8,
+};
+static struct ufsm_region r16 = {
+  .id = "r16",
+  .name = "R16",
+  .state = &s84,
+  .has_history = true,
+  .history = NULL,
+  .index = 9,
+  .transition = &t16,
+  .parent_state = &s9,
+  .next = &r15,
+};
+static struct ufsm_transition t16 = {
+  .id = "t16",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 94,
+  .action = &t16effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s80,
+  .dest = &s84,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t201,
+};
+static struct ufsm_action t16effect = {
+  .id = "t16effect",
+  .name = "a16",
+  .f = &a16,
+  .next = NULL,
+};
+static struct ufsm_trigger t201_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t201 = {
+  .id = "t201",
+  .name = "",
+  .trigger = t201_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 95,
+  .action = &t201effect,
+  .defer = false,
+  .guard = &t201guard,
+  .source = &s81,
+  .dest = &s83,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t202,
+};
+static struct ufsm_action t201effect = {
+  .id = "t201effect",
+  .name = "a201",
+  .f = &a201,
+  .next = NULL,
+};
+static struct ufsm_guard t201guard = {
+  .id = "t201guard",
+  .name = "g38",
+  .f = &g38,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t202_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t202 = {
+  .id = "t202",
+  .name = "",
+  .trigger = t202_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 96,
+  .action = &t202effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s81,
+  .dest = &s84,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t203,
+};
+static struct ufsm_action t202effect = {
+  .id = "t202effect",
+  .name = "a202",
+  .f = &a202,
+  .next = NULL,
+};
+static struct ufsm_trigger t203_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t203 = {
+  .id = "t203",
+  .name = "",
+  .trigger = t203_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 97,
+  .action = &t203effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s82,
+  .dest = &s81,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t204,
+};
+static struct ufsm_action t203effect = {
+  .id = "t203effect",
+  .name = "a203",
+  .f = &a203,
+  .next = NULL,
+};
+static struct ufsm_trigger t204_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t204 = {
+  .id = "t204",
+  .name = "",
+  .trigger = t204_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 98,
+  .action = &t204effect,
+  .defer = false,
+  .guard = &t204guard,
+  .source = &s82,
+  .dest = &s81,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t205,
+};
+static struct ufsm_action t204effect = {
+  .id = "t204effect",
+  .name = "a204",
+  .f = &a204,
+  .next = NULL,
+};
+static struct ufsm_guard t204guard = {
+  .id = "t204guard",
+  .name = "g39",
+  .f = &g39,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t205_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t205_exit_path[] = {
+  &r16,
+  &r1,
+  NULL,
+};
+static struct ufsm_region * t205_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t205 = {
+  .id = "t205",
+  .name = "",
+  .trigger = t205_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 99,
+  .action = &t205effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s83,
+  .dest = &s2,
+  .lca = &r0,
+  .exit_path = t205_exit_path,
+  .enter_path = t205_enter_path,
+  .next = &t206,
+};
+static struct ufsm_action t205effect = {
+  .id = "t205effect",
+  .name = "a205",
+  .f = &a205,
+  .next = NULL,
+};
+static struct ufsm_trigger t206_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t206 = {
+  .id = "t206",
+  .name = "",
+  .trigger = t206_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 100,
+  .action = &t206effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s83,
+  .dest = &s81,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t207,
+};
+static struct ufsm_action t206effect = {
+  .id = "t206effect",
+  .name = "a206",
+  .f = &a206,
+  .next = NULL,
+};
+static struct ufsm_trigger t207_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t207 = {
+  .id = "t207",
+  .name = "",
+  .trigger = t207_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 101,
+  .action = &t207effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s84,
+  .dest = &s81,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t208,
+};
+static struct ufsm_action t207effect = {
+  .id = "t207effect",
+  .name = "a207",
+  .f = &a207,
+  .next = NULL,
+};
+static struct ufsm_trigger t208_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t208 = {
+  .id = "t208",
+  .name = "",
+  .trigger = t208_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 102,
+  .action = &t208effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s84,
+  .dest = &s81,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t699,
+};
+static struct ufsm_action t208effect = {
+  .id = "t208effect",
+  .name = "a208",
+  .f = &a208,
+  .next = NULL,
+};
+static struct ufsm_transition t699 = {
+  .id = "t699",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 103,
+  .action = &t699effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s83,
+  .dest = &s380,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t699effect = {
+  .id = "t699effect",
+  .name = "a699",
+  .f = &a699,
+  .next = NULL,
+};
+static struct ufsm_transition * s84_dispatch_5[] = {
+  &t208,
+  NULL,
+};
+static struct ufsm_transition * s84_dispatch_6[] = {
+  &t207,
+  NULL,
+};
+static struct ufsm_dispatch s84_dispatch[] = {
+{
+  .ev = 5,
+  .transition = s84_dispatch_5,
+},
+{
+  .ev = 6,
+  .transition = s84_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s84_interest[] = {
+  0x00000076,
+};
+static struct ufsm_state s84 = {
+  .id   = "s84",
+  .name = "S84",
+  .kind = 0,
+  .index = 52,
+  .parent_region = &r16,
+  .entry = &s84entry,
+  .doact = NULL,
+  .exit = &s84exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s84_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s84_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s83,
+};
+static struct ufsm_entry_exit s84entry = {
+  .id = "s84entry",
+  .name = "e84",
+  .f = &e84,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s84exit = {
+  .id = "s84exit",
+  .name = "x84",
+  .f = &x84,
+  .next = NULL,
+};
+static struct ufsm_transition * s83_dispatch_0[] = {
+  &t206,
+  NULL,
+};
+static struct ufsm_transition * s83_dispatch_4[] = {
+  &t205,
+  NULL,
+};
+static struct ufsm_dispatch s83_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s83_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s83_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s83_interest[] = {
+  0x00000017,
+};
+static struct ufsm_state s83 = {
+  .id   = "s83",
+  .name = "S83",
+  .kind = 0,
+  .index = 53,
+  .parent_region = &r16,
+  .entry = &s83entry,
+  .doact = NULL,
+  .exit = &s83exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s83_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s83_interest,
+  .time_events = NULL,
+  .completion = &t699,
+  .next = &s82,
+};
+static struct ufsm_entry_exit s83entry = {
+  .id = "s83entry",
+  .name = "e83",
+  .f = &e83,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s83exit = {
+  .id = "s83exit",
+  .name = "x83",
+  .f = &x83,
+  .next = NULL,
+};
+static struct ufsm_transition * s82_dispatch_1[] = {
+  &t203,
+  NULL,
+};
+static struct ufsm_transition * s82_dispatch_3[] = {
+  &t204,
+  NULL,
+};
+static struct ufsm_dispatch s82_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s82_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s82_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s82_interest[] = {
+  0x0000001e,
+};
+static struct ufsm_state s82 = {
+  .id   = "s82",
+  .name = "S82",
+  .kind = 0,
+  .index = 54,
+  .parent_region = &r16,
+  .entry = &s82entry,
+  .doact = NULL,
+  .exit = &s82exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s82_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s82_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s81,
+};
+static struct ufsm_entry_exit s82entry = {
+  .id = "s82entry",
+  .name = "e82",
+  .f = &e82,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s82exit = {
+  .id = "s82exit",
+  .name = "x82",
+  .f = &x82,
+  .next = NULL,
+};
+static struct ufsm_transition * s81_dispatch_1[] = {
+  &t201,
+  NULL,
+};
+static struct ufsm_transition * s81_dispatch_2[] = {
+  &t202,
+  NULL,
+};
+static struct ufsm_dispatch s81_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s81_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = s81_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s81_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s81 = {
+  .id   = "s81",
+  .name = "S81",
+  .kind = 0,
+  .index = 55,
+  .parent_region = &r16,
+  .entry = &s81entry,
+  .doact = NULL,
+  .exit = &s81exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s81_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s81_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s80,
+};
+static struct ufsm_entry_exit s81entry = {
+  .id = "s81entry",
+  .name = "e81",
+  .f = &e81,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s81exit = {
+  .id = "s81exit",
+  .name = "x81",
+  .f = &x81,
+  .next = NULL,
+};
+static struct ufsm_dispatch s80_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s80_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s80 = {
+  .id   = "s80",
+  .name = "Init",
+  .kind = 1,
+  .index = 56,
+  .parent_region = &r16,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s80_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s80_interest,
+  .time_events = NULL,
+  .completion = &t16,
+  .next = NULL,
+};
+static struct ufsm_region r15 = {
+  .id = "r15",
+  .name = "R15",
+  .state = &s79,
+  .has_history = true,
+  .history = NULL,
+  .index = 10,
+  .transition = &t15,
+  .parent_state = &s9,
+  .next = NULL,
+};
+static struct ufsm_transition t15 = {
+  .id = "t15",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 104,
+  .action = &t15effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s75,
+  .dest = &s76,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t193,
+};
+static struct ufsm_action t15effect = {
+  .id = "t15effect",
+  .name = "a15",
+  .f = &a15,
+  .next = NULL,
+};
+static struct ufsm_trigger t193_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t193 = {
+  .id = "t193",
+  .name = "",
+  .trigger = t193_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 105,
+  .action = &t193effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s76,
+  .dest = &s79,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t194,
+};
+static struct ufsm_action t193effect = {
+  .id = "t193effect",
+  .name = "a193",
+  .f = &a193,
+  .next = NULL,
+};
+static struct ufsm_trigger t194_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t194 = {
+  .id = "t194",
+  .name = "",
+  .trigger = t194_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 106,
+  .action = &t194effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s76,
+  .dest = &s78,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t195,
+};
+static struct ufsm_action t194effect = {
+  .id = "t194effect",
+  .name = "a194",
+  .f = &a194,
+  .next = NULL,
+};
+static struct ufsm_trigger t195_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t195 = {
+  .id = "t195",
+  .name = "",
+  .trigger = t195_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 107,
+  .action = &t195effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s77,
+  .dest = &s79,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t196,
+};
+static struct ufsm_action t195effect = {
+  .id = "t195effect",
+  .name = "a195",
+  .f = &a195,
+  .next = NULL,
+};
+static struct ufsm_trigger t196_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t196 = {
+  .id = "t196",
+  .name = "",
+  .trigger = t196_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 108,
+  .action = &t196effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s77,
+  .dest = &s79,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t197,
+};
+static struct ufsm_action t196effect = {
+  .id = "t196effect",
+  .name = "a196",
+  .f = &a196,
+  .next = NULL,
+};
+static struct ufsm_trigger t197_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t197 = {
+  .id = "t197",
+  .name = "",
+  .trigger = t197_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 109,
+  .action = &t197effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s78,
+  .dest = &s76,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t198,
+};
+static struct ufsm_action t197effect = {
+  .id = "t197effect",
+  .name = "a197",
+  .f = &a197,
+  .next = NULL,
+};
+static struct ufsm_trigger t198_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t198 = {
+  .id = "t198",
+  .name = "",
+  .trigger = t198_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 110,
+  .action = &t198effect,
+  .defer = false,
+  .guard = &t198guard,
+  .source = &s78,
+  .dest = &s76,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t199,
+};
+static struct ufsm_action t198effect = {
+  .id = "t198effect",
+  .name = "a198",
+  .f = &a198,
+  .next = NULL,
+};
+static struct ufsm_guard t198guard = {
+  .id = "t198guard",
+  .name = "g37",
+  .f = &g37,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t199_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t199 = {
+  .id = "t199",
+  .name = "",
+  .trigger = t199_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 111,
+  .action = &t199effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s79,
+  .dest = &s76,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t200,
+};
+static struct ufsm_action t199effect = {
+  .id = "t199effect",
+  .name = "a199",
+  .f = &a199,
+  .next = NULL,
+};
+static struct ufsm_trigger t200_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t200_exit_path[] = {
+  &r15,
+  NULL,
+};
+static struct ufsm_region * t200_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t200 = {
+  .id = "t200",
+  .name = "",
+  .trigger = t200_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 112,
+  .action = &t200effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s79,
+  .dest = &s9,
+  .lca = &r1,
+  .exit_path = t200_exit_path,
+  .enter_path = t200_enter_path,
+  .next = &t698,
+};
+static struct ufsm_action t200effect = {
+  .id = "t200effect",
+  .name = "a200",
+  .f = &a200,
+  .next = NULL,
+};
+static struct ufsm_transition t698 = {
+  .id = "t698",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 113,
+  .action = &t698effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s77,
+  .dest = &s380,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t698effect = {
+  .id = "t698effect",
+  .name = "a698",
+  .f = &a698,
+  .next = NULL,
+};
+static struct ufsm_transition * s79_dispatch_3[] = {
+  &t200,
+  NULL,
+};
+static struct ufsm_transition * s79_dispatch_4[] = {
+  &t199,
+  NULL,
+};
+static struct ufsm_dispatch s79_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s79_dispatch_3,
+},
+{
+  .ev = 4,
+  .transition = s79_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s79_interest[] = {
+  0x0000001e,
+};
+static struct ufsm_state s79 = {
+  .id   = "s79",
+  .name = "S79",
+  .kind = 0,
+  .index = 57,
+  .parent_region = &r15,
+  .entry = &s79entry,
+  .doact = NULL,
+  .exit = &s79exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s79_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s79_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s78,
+};
+static struct ufsm_entry_exit s79entry = {
+  .id = "s79entry",
+  .name = "e79",
+  .f = &e79,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s79exit = {
+  .id = "s79exit",
+  .name = "x79",
+  .f = &x79,
+  .next = NULL,
+};
+static struct ufsm_transition * s78_dispatch_4[] = {
+  &t197,
+  &t198,
+  NULL,
+};
+static struct ufsm_dispatch s78_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s78_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s78_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s78 = {
+  .id   = "s78",
+  .name = "S78",
+  .kind = 0,
+  .index = 58,
+  .parent_region = &r15,
+  .entry = &s78entry,
+  .doact = NULL,
+  .exit = &s78exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s78_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s78_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s77,
+};
+static struct ufsm_entry_exit s78entry = {
+  .id = "s78entry",
+  .name = "e78",
+  .f = &e78,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s78exit = {
+  .id = "s78exit",
+  .name = "x78",
+  .f = &x78,
+  .next = NULL,
+};
+static struct ufsm_transition * s77_dispatch_1[] = {
+  &t195,
+  &t196,
+  NULL,
+};
+static struct ufsm_dispatch s77_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s77_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s77_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s77 = {
+  .id   = "s77",
+  .name = "S77",
+  .kind = 0,
+  .index = 59,
+  .parent_region = &r15,
+  .entry = &s77entry,
+  .doact = NULL,
+  .exit = &s77exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s77_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s77_interest,
+  .time_events = NULL,
+  .completion = &t698,
+  .next = &s76,
+};
+static struct ufsm_entry_exit s77entry = {
+  .id = "s77entry",
+  .name = "e77",
+  .f = &e77,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s77exit = {
+  .id = "s77exit",
+  .name = "x77",
+  .f = &x77,
+  .next = NULL,
+};
+static struct ufsm_transition * s76_dispatch_0[] = {
+  &t194,
+  NULL,
+};
+static struct ufsm_transition * s76_dispatch_5[] = {
+  &t193,
+  NULL,
+};
+static struct ufsm_dispatch s76_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s76_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s76_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s76_interest[] = {
+  0x00000037,
+};
+static struct ufsm_state s76 = {
+  .id   = "s76",
+  .name = "S76",
+  .kind = 0,
+  .index = 60,
+  .parent_region = &r15,
+  .entry = &s76entry,
+  .doact = NULL,
+  .exit = &s76exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s76_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s76_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s75,
+};
+static struct ufsm_entry_exit s76entry = {
+  .id = "s76entry",
+  .name = "e76",
+  .f = &e76,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s76exit = {
+  .id = "s76exit",
+  .name = "x76",
+  .f = &x76,
+  .next = NULL,
+};
+static struct ufsm_dispatch s75_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s75_interest[] = {
+  0x00000016,
+};
+static struct ufsm_state s75 = {
+  .id   = "s75",
+  .name = "Init",
+  .kind = 1,
+  .index = 61,
+  .parent_region = &r15,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s75_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s75_interest,
+  .time_events = NULL,
+  .completion = &t15,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s9entry = {
+  .id = "s9entry",
+  .name = "e9",
+  .f = &e9,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s9exit = {
+  .id = "s9exit",
+  .name = "x9",
+  .f = &x9,
+  .next = NULL,
+};
+static struct ufsm_transition * s8_dispatch_3[] = {
+  &t86,
+  NULL,
+};
+static struct ufsm_transition * s8_dispatch_5[] = {
+  &t85,
+  NULL,
+};
+static struct ufsm_dispatch s8_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s8_dispatch_3,
+},
+{
+  .ev = 5,
+  .transition = s8_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s8_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s8 = {
+  .id   = "s8",
+  .name = "S8",
+  .kind = 0,
+  .index = 14,
+  .parent_region = &r1,
+  .entry = &s8entry,
+  .doact = NULL,
+  .exit = &s8exit,
+  .region = &r14,
+  .submachine = NULL,
+  .dispatch = s8_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s8_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s7,
+};
+static struct ufsm_region r14 = {
+  .id = "r14",
+  .name = "R14",
+  .state = &s74,
+  .has_history = true,
+  .history = NULL,
+  .index = 7,
+  .transition = &t14,
+  .parent_state = &s8,
+  .next = &r13,
+};
+static struct ufsm_transition t14 = {
+  .id = "t14",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 76,
+  .action = &t14effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s70,
+  .dest = &s74,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t185,
+};
+static struct ufsm_action t14effect = {
+  .id = "t14effect",
+  .name = "a14",
+  .f = &a14,
+  .next = NULL,
+};
+static struct ufsm_trigger t185_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t185_exit_path[] = {
+  &r14,
+  &r1,
+  NULL,
+};
+static struct ufsm_region * t185_enter_path[] = {
+  &r4,
+  NULL,
+};
+static struct ufsm_transition t185 = {
+  .id = "t185",
+  .name = "",
+  .trigger = t185_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 77,
+  .action = &t185effect,
+  .defer = false,
+  .guard = &t185guard,
+  .source = &s71,
+  .dest = &s21,
+  .lca = &r0,
+  .exit_path = t185_exit_path,
+  .enter_path = t185_enter_path,
+  .next = &t186,
+};
+static struct ufsm_action t185effect = {
+  .id = "t185effect",
+  .name = "a185",
+  .f = &a185,
+  .next = NULL,
+};
+static struct ufsm_guard t185guard = {
+  .id = "t185guard",
+  .name = "g35",
+  .f = &g35,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t186_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t186 = {
+  .id = "t186",
+  .name = "",
+  .trigger = t186_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 78,
+  .action = &t186effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s71,
+  .dest = &s71,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t187,
+};
+static struct ufsm_action t186effect = {
+  .id = "t186effect",
+  .name = "a186",
+  .f = &a186,
+  .next = NULL,
+};
+static struct ufsm_trigger t187_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t187 = {
+  .id = "t187",
+  .name = "",
+  .trigger = t187_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 79,
+  .action = &t187effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s72,
+  .dest = &s73,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t188,
+};
+static struct ufsm_action t187effect = {
+  .id = "t187effect",
+  .name = "a187",
+  .f = &a187,
+  .next = NULL,
+};
+static struct ufsm_trigger t188_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t188 = {
+  .id = "t188",
+  .name = "",
+  .trigger = t188_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 80,
+  .action = &t188effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s72,
+  .dest = &s74,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t189,
+};
+static struct ufsm_action t188effect = {
+  .id = "t188effect",
+  .name = "a188",
+  .f = &a188,
+  .next = NULL,
+};
+static struct ufsm_trigger t189_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t189_exit_path[] = {
+  &r14,
+  NULL,
+};
+static struct ufsm_region * t189_enter_path[] = {
+  &r15,
+  NULL,
+};
+static struct ufsm_transition t189 = {
+  .id = "t189",
+  .name = "",
+  .trigger = t189_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 81,
+  .action = &t189effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s73,
+  .dest = &s78,
+  .lca = &r1,
+  .exit_path = t189_exit_path,
+  .enter_path = t189_enter_path,
+  .next = &t190,
+};
+static struct ufsm_action t189effect = {
+  .id = "t189effect",
+  .name = "a189",
+  .f = &a189,
+  .next = NULL,
+};
+static struct ufsm_trigger t190_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t190 = {
+  .id = "t190",
+  .name = "",
+  .trigger = t190_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 82,
+  .action = &t190effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s73,
+  .dest = &s71,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t191,
+};
+static struct ufsm_action t190effect = {
+  .id = "t190effect",
+  .name = "a190",
+  .f = &a190,
+  .next = NULL,
+};
+static struct ufsm_trigger t191_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t191 = {
+  .id = "t191",
+  .name = "",
+  .trigger = t191_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 83,
+  .action = &t191effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s74,
+  .dest = &s73,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t192,
+};
+static struct ufsm_action t191effect = {
+  .id = "t191effect",
+  .name = "a191",
+  .f = &a191,
+  .next = NULL,
+};
+static struct ufsm_trigger t192_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t192 = {
+  .id = "t192",
+  .name = "",
+  .trigger = t192_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 84,
+  .action = &t192effect,
+  .defer = false,
+  .guard = &t192guard,
+  .source = &s74,
+  .dest = &s73,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t192effect = {
+  .id = "t192effect",
+  .name = "a192",
+  .f = &a192,
+  .next = NULL,
+};
+static struct ufsm_guard t192guard = {
+  .id = "t192guard",
+  .name = "g36",
+  .f = &g36,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s74_dispatch_0[] = {
+  &t192,
+  NULL,
+};
+static struct ufsm_transition * s74_dispatch_4[] = {
+  &t191,
+  NULL,
+};
+static struct ufsm_dispatch s74_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s74_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s74_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s74_interest[] = {
+  0x0000003b,
+};
+static struct ufsm_state s74 = {
+  .id   = "s74",
+  .name = "S74",
+  .kind = 0,
+  .index = 42,
+  .parent_region = &r14,
+  .entry = &s74entry,
+  .doact = NULL,
+  .exit = &s74exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s74_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s74_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s73,
+};
+static struct ufsm_entry_exit s74entry = {
+  .id = "s74entry",
+  .name = "e74",
+  .f = &e74,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s74exit = {
+  .id = "s74exit",
+  .name = "x74",
+  .f = &x74,
+  .next = NULL,
+};
+static struct ufsm_transition * s73_dispatch_0[] = {
+  &t189,
+  NULL,
+};
+static struct ufsm_transition * s73_dispatch_5[] = {
+  &t190,
+  NULL,
+};
+static struct ufsm_dispatch s73_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s73_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s73_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s73_interest[] = {
+  0x0000003b,
+};
+static struct ufsm_state s73 = {
+  .id   = "s73",
+  .name = "S73",
+  .kind = 0,
+  .index = 43,
+  .parent_region = &r14,
+  .entry = &s73entry,
+  .doact = NULL,
+  .exit = &s73exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s73_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s73_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s72,
+};
+static struct ufsm_entry_exit s73entry = {
+  .id = "s73entry",
+  .name = "e73",
+  .f = &e73,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s73exit = {
+  .id = "s73exit",
+  .name = "x73",
+  .f = &x73,
+  .next = NULL,
+};
+static struct ufsm_transition * s72_dispatch_2[] = {
+  &t188,
+  NULL,
+};
+static struct ufsm_transition * s72_dispatch_3[] = {
+  &t187,
+  NULL,
+};
+static struct ufsm_dispatch s72_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s72_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = s72_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s72_interest[] = {
+  0x0000003e,
+};
+static struct ufsm_state s72 = {
+  .id   = "s72",
+  .name = "S72",
+  .kind = 0,
+  .index = 44,
+  .parent_region = &r14,
+  .entry = &s72entry,
+  .doact = NULL,
+  .exit = &s72exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s72_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s72_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s71,
+};
+static struct ufsm_entry_exit s72entry = {
+  .id = "s72entry",
+  .name = "e72",
+  .f = &e72,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s72exit = {
+  .id = "s72exit",
+  .name = "x72",
+  .f = &x72,
+  .next = NULL,
+};
+static struct ufsm_transition * s71_dispatch_4[] = {
+  &t185,
+  NULL,
+};
+static struct ufsm_transition * s71_dispatch_6[] = {
+  &t186,
+  NULL,
+};
+static struct ufsm_dispatch s71_dispatch[] = {
+{
+  .ev = 4,
+  .transition = s71_dispatch_4,
+},
+{
+  .ev = 6,
+  .transition = s71_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s71_interest[] = {
+  0x0000007a,
+};
+static struct ufsm_state s71 = {
+  .id   = "s71",
+  .name = "S71",
+  .kind = 0,
+  .index = 45,
+  .parent_region = &r14,
+  .entry = &s71entry,
+  .doact = NULL,
+  .exit = &s71exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s71_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s71_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s70,
+};
+static struct ufsm_entry_exit s71entry = {
+  .id = "s71entry",
+  .name = "e71",
+  .f = &e71,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s71exit = {
+  .id = "s71exit",
+  .name = "x71",
+  .f = &x71,
+  .next = NULL,
+};
+static struct ufsm_dispatch s70_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s70_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s70 = {
+  .id   = "s70",
+  .name = "Init",
+  .kind = 1,
+  .index = 46,
+  .parent_region = &r14,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s70_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s70_interest,
+  .time_events = NULL,
+  .completion = &t14,
+  .next = NULL,
+};
+static struct ufsm_region r13 = {
+  .id = "r13",
+  .name = "R13",
+  .state = &s69,
+  .has_history = true,
+  .history = NULL,
+  .index = 8,
+  .transition = &t13,
+  .parent_state = &s8,
+  .next = NULL,
+};
+static struct ufsm_transition t13 = {
+  .id = "t13",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 85,
+  .action = &t13effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s65,
+  .dest = &s66,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t177,
+};
+static struct ufsm_action t13effect = {
+  .id = "t13effect",
+  .name = "a13",
+  .f = &a13,
+  .next = NULL,
+};
+static struct ufsm_trigger t177_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t177 = {
+  .id = "t177",
+  .name = "",
+  .trigger = t177_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 86,
+  .action = &t177effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s66,
+  .dest = &s67,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t178,
+};
+static struct ufsm_action t177effect = {
+  .id = "t177effect",
+  .name = "a177",
+  .f = &a177,
+  .next = NULL,
+};
+static struct ufsm_trigger t178_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t178 = {
+  .id = "t178",
+  .name = "",
+  .trigger = t178_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 87,
+  .action = &t178effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s66,
+  .dest = &s66,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t179,
+};
+static struct ufsm_action t178effect = {
+  .id = "t178effect",
+  .name = "a178",
+  .f = &a178,
+  .next = NULL,
+};
+static struct ufsm_trigger t179_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t179 = {
+  .id = "t179",
+  .name = "",
+  .trigger = t179_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 88,
+  .action = &t179effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s67,
+  .dest = &s66,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t180,
+};
+static struct ufsm_action t179effect = {
+  .id = "t179effect",
+  .name = "a179",
+  .f = &a179,
+  .next = NULL,
+};
+static struct ufsm_trigger t180_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t180 = {
+  .id = "t180",
+  .name = "",
+  .trigger = t180_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 89,
+  .action = &t180effect,
+  .defer = false,
+  .guard = &t180guard,
+  .source = &s67,
+  .dest = &s66,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t181,
+};
+static struct ufsm_action t180effect = {
+  .id = "t180effect",
+  .name = "a180",
+  .f = &a180,
+  .next = NULL,
+};
+static struct ufsm_guard t180guard = {
+  .id = "t180guard",
+  .name = "g33",
+  .f = &g33,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t181_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t181 = {
+  .id = "t181",
+  .name = "",
+  .trigger = t181_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 90,
+  .action = &t181effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s68,
+  .dest = &s67,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t182,
+};
+static struct ufsm_action t181effect = {
+  .id = "t181effect",
+  .name = "a181",
+  .f = &a181,
+  .next = NULL,
+};
+static struct ufsm_trigger t182_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t182 = {
+  .id = "t182",
+  .name = "",
+  .trigger = t182_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 91,
+  .action = &t182effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s68,
+  .dest = &s69,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t183,
+};
+static struct ufsm_action t182effect = {
+  .id = "t182effect",
+  .name = "a182",
+  .f = &a182,
+  .next = NULL,
+};
+static struct ufsm_trigger t183_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t183 = {
+  .id = "t183",
+  .name = "",
+  .trigger = t183_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 92,
+  .action = &t183effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s69,
+  .dest = &s66,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t184,
+};
+static struct ufsm_action t183effect = {
+  .id = "t183effect",
+  .name = "a183",
+  .f = &a183,
+  .next = NULL,
+};
+static struct ufsm_trigger t184_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t184 = {
+  .id = "t184",
+  .name = "",
+  .trigger = t184_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 93,
+  .action = &t184effect,
+  .defer = false,
+  .guard = &t184guard,
+  .source = &s69,
+  .dest = &s68,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t184effect = {
+  .id = "t184effect",
+  .name = "a184",
+  .f = &a184,
+  .next = NULL,
+};
+static struct ufsm_guard t184guard = {
+  .id = "t184guard",
+  .name = "g34",
+  .f = &g34,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition * s69_dispatch_2[] = {
+  &t184,
+  NULL,
+};
+static struct ufsm_transition * s69_dispatch_4[] = {
+  &t183,
+  NULL,
+};
+static struct ufsm_dispatch s69_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s69_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s69_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s69_interest[] = {
+  0x0000003e,
+};
+static struct ufsm_state s69 = {
+  .id   = "s69",
+  .name = "S69",
+  .kind = 0,
+  .index = 47,
+  .parent_region = &r13,
+  .entry = &s69entry,
+  .doact = NULL,
+  .exit = &s69exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s69_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s69_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s68,
+};
+static struct ufsm_entry_exit s69entry = {
+  .id = "s69entry",
+  .name = "e69",
+  .f = &e69,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s69exit = {
+  .id = "s69exit",
+  .name = "x69",
+  .f = &x69,
+  .next = NULL,
+};
+static struct ufsm_transition * s68_dispatch_0[] = {
+  &t181,
+  NULL,
+};
+static struct ufsm_transition * s68_dispatch_7[] = {
+  &t182,
+  NULL,
+};
+static struct ufsm_dispatch s68_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s68_dispatch_0,
+},
+{
+  .ev = 7,
+  .transition = s68_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s68_interest[] = {
+  0x000000bb,
+};
+static struct ufsm_state s68 = {
+  .id   = "s68",
+  .name = "S68",
+  .kind = 0,
+  .index = 48,
+  .parent_region = &r13,
+  .entry = &s68entry,
+  .doact = NULL,
+  .exit = &s68exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s68_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s68_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s67,
+};
+static struct ufsm_entry_exit s68entry = {
+  .id = "s68entry",
+  .name = "e68",
+  .f = &e68,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s68exit = {
+  .id = "s68exit",
+  .name = "x68",
+  .f = &x68,
+  .next = NULL,
+};
+static struct ufsm_transition * s67_dispatch_1[] = {
+  &t180,
+  NULL,
+};
+static struct ufsm_transition * s67_dispatch_3[] = {
+  &t179,
+  NULL,
+};
+static struct ufsm_dispatch s67_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s67_dispatch_1,
+},
+{
+  .ev = 3,
+  .transition = s67_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s67_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s67 = {
+  .id   = "s67",
+  .name = "S67",
+  .kind = 0,
+  .index = 49,
+  .parent_region = &r13,
+  .entry = &s67entry,
+  .doact = NULL,
+  .exit = &s67exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s67_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s67_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s66,
+};
+static struct ufsm_entry_exit s67entry = {
+  .id = "s67entry",
+  .name = "e67",
+  .f = &e67,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s67exit = {
+  .id = "s67exit",
+  .name = "x67",
+  .f = &x67,
+  .next = NULL,
+};
+static struct ufsm_transition * s66_dispatch_0[] = {
+  &t177,
+  NULL,
+};
+static struct ufsm_transition * s66_dispatch_1[] = {
+  &t178,
+  NULL,
+};
+static struct ufsm_dispatch s66_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s66_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = s66_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s66_interest[] = {
+  0x0000003b,
+};
+static struct ufsm_state s66 = {
+  .id   = "s66",
+  .name = "S66",
+  .kind = 0,
+  .index = 50,
+  .parent_region = &r13,
+  .entry = &s66entry,
+  .doact = NULL,
+  .exit = &s66exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s66_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s66_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s65,
+};
+static struct ufsm_entry_exit s66entry = {
+  .id = "s66entry",
+  .name = "e66",
+  .f = &e66,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s66exit = {
+  .id = "s66exit",
+  .name = "x66",
+  .f = &x66,
+  .next = NULL,
+};
+static struct ufsm_dispatch s65_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s65_interest[] = {
+  0x0000003a,
+};
+static struct ufsm_state s65 = {
+  .id   = "s65",
+  .name = "Init",
+  .kind = 1,
+  .index = 51,
+  .parent_region = &r13,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s65_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s65_interest,
+  .time_events = NULL,
+  .completion = &t13,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s8entry = {
+  .id = "s8entry",
+  .name = "e8",
+  .f = &e8,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s8exit = {
+  .id = "s8exit",
+  .name = "x8",
+  .f = &x8,
+  .next = NULL,
+};
+static struct ufsm_transition * s7_dispatch_0[] = {
+  &t702,
+  NULL,
+};
+static struct ufsm_transition * s7_dispatch_5[] = {
+  &t83,
+  &t84,
+  NULL,
+};
+static struct ufsm_dispatch s7_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s7_dispatch_0,
+},
+{
+  .ev = 5,
+  .transition = s7_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s7_interest[] = {
+  0x00000033,
+};
+static struct ufsm_state s7 = {
+  .id   = "s7",
+  .name = "S7",
+  .kind = 0,
+  .index = 15,
+  .parent_region = &r1,
+  .entry = &s7entry,
+  .doact = NULL,
+  .exit = &s7exit,
+  .region = &r12,
+  .submachine = NULL,
+  .dispatch = s7_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s7_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s6,
+};
+static struct ufsm_region r12 = {
+  .id = "r12",
+  .name = "R12",
+  .state = &s64,
+  .has_history = true,
+  .history = NULL,
+  .index = 5,
+  .transition = &t12,
+  .parent_state = &s7,
+  .next = &r11,
+};
+static struct ufsm_transition t12 = {
+  .id = "t12",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 57,
+  .action = &t12effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s60,
+  .dest = &s62,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t169,
+};
+static struct ufsm_action t12effect = {
+  .id = "t12effect",
+  .name = "a12",
+  .f = &a12,
+  .next = NULL,
+};
+static struct ufsm_trigger t169_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t169 = {
+  .id = "t169",
+  .name = "",
+  .trigger = t169_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 58,
+  .action = &t169effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s61,
+  .dest = &s61,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t170,
+};
+static struct ufsm_action t169effect = {
+  .id = "t169effect",
+  .name = "a169",
+  .f = &a169,
+  .next = NULL,
+};
+static struct ufsm_trigger t170_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t170_exit_path[] = {
+  &r12,
+  &r1,
+  NULL,
+};
+static struct ufsm_region * t170_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t170 = {
+  .id = "t170",
+  .name = "",
+  .trigger = t170_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 59,
+  .action = &t170effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s61,
+  .dest = &s1,
+  .lca = &r0,
+  .exit_path = t170_exit_path,
+  .enter_path = t170_enter_path,
+  .next = &t171,
+};
+static struct ufsm_action t170effect = {
+  .id = "t170effect",
+  .name = "a170",
+  .f = &a170,
+  .next = NULL,
+};
+static struct ufsm_trigger t171_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t171 = {
+  .id = "t171",
+  .name = "",
+  .trigger = t171_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 60,
+  .action = &t171effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s62,
+  .dest = &s62,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t172,
+};
+static struct ufsm_action t171effect = {
+  .id = "t171effect",
+  .name = "a171",
+  .f = &a171,
+  .next = NULL,
+};
+static struct ufsm_trigger t172_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t172 = {
+  .id = "t172",
+  .name = "",
+  .trigger = t172_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 61,
+  .action = &t172effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s62,
+  .dest = &s61,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t173,
+};
+static struct ufsm_action t172effect = {
+  .id = "t172effect",
+  .name = "a172",
+  .f = &a172,
+  .next = NULL,
+};
+static struct ufsm_trigger t173_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t173_exit_path[] = {
+  &r12,
+  NULL,
+};
+static struct ufsm_region * t173_enter_path[] = {
+  &r14,
+  NULL,
+};
+static struct ufsm_transition t173 = {
+  .id = "t173",
+  .name = "",
+  .trigger = t173_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 62,
+  .action = &t173effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s63,
+  .dest = &s71,
+  .lca = &r1,
+  .exit_path = t173_exit_path,
+  .enter_path = t173_enter_path,
+  .next = &t174,
+};
+static struct ufsm_action t173effect = {
+  .id = "t173effect",
+  .name = "a173",
+  .f = &a173,
+  .next = NULL,
+};
+static struct ufsm_trigger t174_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t174 = {
+  .id = "t174",
+  .name = "",
+  .trigger = t174_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 63,
+  .action = &t174effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s63,
+  .dest = &s61,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t175,
+};
+static struct ufsm_action t174effect = {
+  .id = "t174effect",
+  .name = "a174",
+  .f = &a174,
+  .next = NULL,
+};
+static struct ufsm_trigger t175_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t175_exit_path[] = {
+  &r12,
+  NULL,
+};
+static struct ufsm_region * t175_enter_path[] = {
+  &r13,
+  NULL,
+};
+static struct ufsm_transition t175 = {
+  .id = "t175",
+  .name = "",
+  .trigger = t175_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 64,
+  .action = &t175effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s64,
+  .dest = &s69,
+  .lca = &r1,
+  .exit_path = t175_exit_path,
+  .enter_path = t175_enter_path,
+  .next = &t176,
+};
+static struct ufsm_action t175effect = {
+  .id = "t175effect",
+  .name = "a175",
+  .f = &a175,
+  .next = NULL,
+};
+static struct ufsm_trigger t176_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t176 = {
+  .id = "t176",
+  .name = "",
+  .trigger = t176_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 65,
+  .action = &t176effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s64,
+  .dest = &s62,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t176effect = {
+  .id = "t176effect",
+  .name = "a176",
+  .f = &a176,
+  .next = NULL,
+};
+static struct ufsm_transition * s64_dispatch_6[] = {
+  &t175,
+  &t176,
+  NULL,
+};
+static struct ufsm_dispatch s64_dispatch[] = {
+{
+  .ev = 6,
+  .transition = s64_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s64_interest[] = {
+  0x00000073,
+};
+static struct ufsm_state s64 = {
+  .id   = "s64",
+  .name = "S64",
+  .kind = 0,
+  .index = 31,
+  .parent_region = &r12,
+  .entry = &s64entry,
+  .doact = NULL,
+  .exit = &s64exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s64_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s64_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s63,
+};
+static struct ufsm_entry_exit s64entry = {
+  .id = "s64entry",
+  .name = "e64",
+  .f = &e64,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s64exit = {
+  .id = "s64exit",
+  .name = "x64",
+  .f = &x64,
+  .next = NULL,
+};
+static struct ufsm_transition * s63_dispatch_0[] = {
+  &t173,
+  NULL,
+};
+static struct ufsm_transition * s63_dispatch_4[] = {
+  &t174,
+  NULL,
+};
+static struct ufsm_dispatch s63_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s63_dispatch_0,
+},
+{
+  .ev = 4,
+  .transition = s63_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s63_interest[] = {
+  0x00000033,
+};
+static struct ufsm_state s63 = {
+  .id   = "s63",
+  .name = "S63",
+  .kind = 0,
+  .index = 32,
+  .parent_region = &r12,
+  .entry = &s63entry,
+  .doact = NULL,
+  .exit = &s63exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s63_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s63_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s62,
+};
+static struct ufsm_entry_exit s63entry = {
+  .id = "s63entry",
+  .name = "e63",
+  .f = &e63,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s63exit = {
+  .id = "s63exit",
+  .name = "x63",
+  .f = &x63,
+  .next = NULL,
+};
+static struct ufsm_transition * s62_dispatch_1[] = {
+  &t172,
+  NULL,
+};
+static struct ufsm_transition * s62_dispatch_5[] = {
+  &t171,
+  NULL,
+};
+static struct ufsm_dispatch s62_dispatch[] = {
+{
+  .ev = 1,
+  .transition = s62_dispatch_1,
+},
+{
+  .ev = 5,
+  .transition = s62_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s62_interest[] = {
+  0x00000033,
+};
+static struct ufsm_state s62 = {
+  .id   = "s62",
+  .name = "S62",
+  .kind = 0,
+  .index = 33,
+  .parent_region = &r12,
+  .entry = &s62entry,
+  .doact = NULL,
+  .exit = &s62exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s62_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s62_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s61,
+};
+static struct ufsm_entry_exit s62entry = {
+  .id = "s62entry",
+  .name = "e62",
+  .f = &e62,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s62exit = {
+  .id = "s62exit",
+  .name = "x62",
+  .f = &x62,
+  .next = NULL,
+};
+static struct ufsm_transition * s61_dispatch_2[] = {
+  &t169,
+  &t170,
+  NULL,
+};
+static struct ufsm_dispatch s61_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s61_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s61_interest[] = {
+  0x00000037,
+};
+static struct ufsm_state s61 = {
+  .id   = "s61",
+  .name = "S61",
+  .kind = 0,
+  .index = 34,
+  .parent_region = &r12,
+  .entry = &s61entry,
+  .doact = NULL,
+  .exit = &s61exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s61_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s61_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s60,
+};
+static struct ufsm_entry_exit s61entry = {
+  .id = "s61entry",
+  .name = "e61",
+  .f = &e61,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s61exit = {
+  .id = "s61exit",
+  .name = "x61",
+  .f = &x61,
+  .next = NULL,
+};
+static struct ufsm_dispatch s60_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s60_interest[] = {
+  0x00000033,
+};
+static struct ufsm_state s60 = {
+  .id   = "s60",
+  .name = "Init",
+  .kind = 1,
+  .index = 35,
+  .parent_region = &r12,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s60_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s60_interest,
+  .time_events = NULL,
+  .completion = &t12,
+  .next = NULL,
+};
+static struct ufsm_region r11 = {
+  .id = "r11",
+  .name = "R11",
+  .state = &s59,
+  .has_history = true,
+  .history = NULL,
+  .index = 6,
+  .transition = &t11,
+  .parent_state = &s7,
+  .next = NULL,
+};
+static struct ufsm_transition t11 = {
+  .id = "t11",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 66,
+  .action = &t11effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s55,
+  .dest = &s59,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t161,
+};
+static struct ufsm_action t11effect = {
+  .id = "t11effect",
+  .name = "a11",
+  .f = &a11,
+  .next = NULL,
+};
+static struct ufsm_trigger t161_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t161 = {
+  .id = "t161",
+  .name = "",
+  .trigger = t161_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 67,
+  .action = &t161effect,
+  .defer = false,
+  .guard = &t161guard,
+  .source = &s56,
+  .dest = &s57,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t162,
+};
+static struct ufsm_action t161effect = {
+  .id = "t161effect",
+  .name = "a161",
+  .f = &a161,
+  .next = NULL,
+};
+static struct ufsm_guard t161guard = {
+  .id = "t161guard",
+  .name = "g31",
+  .f = &g31,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t162_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t162_exit_path[] = {
+  &r11,
+  NULL,
+};
+static struct ufsm_region * t162_enter_path[] = {
+  &r9,
+  NULL,
+};
+static struct ufsm_transition t162 = {
+  .id = "t162",
+  .name = "",
+  .trigger = t162_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 68,
+  .action = &t162effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s56,
+  .dest = &s46,
+  .lca = &r1,
+  .exit_path = t162_exit_path,
+  .enter_path = t162_enter_path,
+  .next = &t163,
+};
+static struct ufsm_action t162effect = {
+  .id = "t162effect",
+  .name = "a162",
+  .f = &a162,
+  .next = NULL,
+};
+static struct ufsm_trigger t163_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t163_exit_path[] = {
+  &r11,
+  NULL,
+};
+static struct ufsm_region * t163_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t163 = {
+  .id = "t163",
+  .name = "",
+  .trigger = t163_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 69,
+  .action = &t163effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s57,
+  .dest = &s9,
+  .lca = &r1,
+  .exit_path = t163_exit_path,
+  .enter_path = t163_enter_path,
+  .next = &t164,
+};
+static struct ufsm_action t163effect = {
+  .id = "t163effect",
+  .name = "a163",
+  .f = &a163,
+  .next = NULL,
+};
+static struct ufsm_trigger t164_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_4",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t164_exit_path[] = {
+  &r11,
+  &r1,
+  NULL,
+};
+static struct ufsm_region * t164_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t164 = {
+  .id = "t164",
+  .name = "",
+  .trigger = t164_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 70,
+  .action = &t164effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s57,
+  .dest = &s1,
+  .lca = &r0,
+  .exit_path = t164_exit_path,
+  .enter_path = t164_enter_path,
+  .next = &t165,
+};
+static struct ufsm_action t164effect = {
+  .id = "t164effect",
+  .name = "a164",
+  .f = &a164,
+  .next = NULL,
+};
+static struct ufsm_trigger t165_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t165 = {
+  .id = "t165",
+  .name = "",
+  .trigger = t165_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 71,
+  .action = &t165effect,
+  .defer = false,
+  .guard = &t165guard,
+  .source = &s58,
+  .dest = &s56,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t166,
+};
+static struct ufsm_action t165effect = {
+  .id = "t165effect",
+  .name = "a165",
+  .f = &a165,
+  .next = NULL,
+};
+static struct ufsm_guard t165guard = {
+  .id = "t165guard",
+  .name = "g32",
+  .f = &g32,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t166_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t166 = {
+  .id = "t166",
+  .name = "",
+  .trigger = t166_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 72,
+  .action = &t166effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s58,
+  .dest = &s59,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t167,
+};
+static struct ufsm_action t166effect = {
+  .id = "t166effect",
+  .name = "a166",
+  .f = &a166,
+  .next = NULL,
+};
+static struct ufsm_trigger t167_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t167 = {
+  .id = "t167",
+  .name = "",
+  .trigger = t167_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 73,
+  .action = &t167effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s59,
+  .dest = &s58,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t168,
+};
+static struct ufsm_action t167effect = {
+  .id = "t167effect",
+  .name = "a167",
+  .f = &a167,
+  .next = NULL,
+};
+static struct ufsm_trigger t168_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t168 = {
+  .id = "t168",
+  .name = "",
+  .trigger = t168_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 74,
+  .action = &t168effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s59,
+  .dest = &s57,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t701,
+};
+static struct ufsm_action t168effect = {
+  .id = "t168effect",
+  .name = "a168",
+  .f = &a168,
+  .next = NULL,
+};
+static struct ufsm_transition t701 = {
+  .id = "t701",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 75,
+  .action = &t701effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s381,
+  .dest = &s59,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t701effect = {
+  .id = "t701effect",
+  .name = "a701",
+  .f = &a701,
+  .next = NULL,
+};
+static struct ufsm_transition * s59_dispatch_3[] = {
+  &t168,
+  NULL,
+};
+static struct ufsm_transition * s59_dispatch_5[] = {
+  &t167,
+  NULL,
+};
+static struct ufsm_dispatch s59_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s59_dispatch_3,
+},
+{
+  .ev = 5,
+  .transition = s59_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s59_interest[] = {
+  0x0000003b,
+};
+static struct ufsm_state s59 = {
+  .id   = "s59",
+  .name = "S59",
+  .kind = 0,
+  .index = 36,
+  .parent_region = &r11,
+  .entry = &s59entry,
+  .doact = NULL,
+  .exit = &s59exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s59_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s59_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s58,
+};
+static struct ufsm_entry_exit s59entry = {
+  .id = "s59entry",
+  .name = "e59",
+  .f = &e59,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s59exit = {
+  .id = "s59exit",
+  .name = "x59",
+  .f = &x59,
+  .next = NULL,
+};
+static struct ufsm_transition * s58_dispatch_0[] = {
+  &t166,
+  NULL,
+};
+static struct ufsm_transition * s58_dispatch_6[] = {
+  &t165,
+  NULL,
+};
+static struct ufsm_dispatch s58_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s58_dispatch_0,
+},
+{
+  .ev = 6,
+  .transition = s58_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s58_interest[] = {
+  0x00000073,
+};
+static struct ufsm_state s58 = {
+  .id   = "s58",
+  .name = "S58",
+  .kind = 0,
+  .index = 37,
+  .parent_region = &r11,
+  .entry = &s58entry,
+  .doact = NULL,
+  .exit = &s58exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s58_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s58_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s57,
+};
+static struct ufsm_entry_exit s58entry = {
+  .id = "s58entry",
+  .name = "e58",
+  .f = &e58,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s58exit = {
+  .id = "s58exit",
+  .name = "x58",
+  .f = &x58,
+  .next = NULL,
+};
+static struct ufsm_transition * s57_dispatch_3[] = {
+  &t163,
+  NULL,
+};
+static struct ufsm_transition * s57_dispatch_4[] = {
+  &t164,
+  NULL,
+};
+static struct ufsm_dispatch s57_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s57_dispatch_3,
+},
+{
+  .ev = 4,
+  .transition = s57_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s57_interest[] = {
+  0x0000003b,
+};
+static struct ufsm_state s57 = {
+  .id   = "s57",
+  .name = "S57",
+  .kind = 0,
+  .index = 38,
+  .parent_region = &r11,
+  .entry = &s57entry,
+  .doact = NULL,
+  .exit = &s57exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s57_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s57_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s56,
+};
+static struct ufsm_entry_exit s57entry = {
+  .id = "s57entry",
+  .name = "e57",
+  .f = &e57,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s57exit = {
+  .id = "s57exit",
+  .name = "x57",
+  .f = &x57,
+  .next = NULL,
+};
+static struct ufsm_transition * s56_dispatch_2[] = {
+  &t162,
+  NULL,
+};
+static struct ufsm_transition * s56_dispatch_7[] = {
+  &t161,
+  NULL,
+};
+static struct ufsm_dispatch s56_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s56_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s56_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s56_interest[] = {
+  0x000000b7,
+};
+static struct ufsm_state s56 = {
+  .id   = "s56",
+  .name = "S56",
+  .kind = 0,
+  .index = 39,
+  .parent_region = &r11,
+  .entry = &s56entry,
+  .doact = NULL,
+  .exit = &s56exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s56_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s56_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s381,
+};
+static struct ufsm_entry_exit s56entry = {
+  .id = "s56entry",
+  .name = "e56",
+  .f = &e56,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s56exit = {
+  .id = "s56exit",
+  .name = "x56",
+  .f = &x56,
+  .next = NULL,
+};
+static struct ufsm_dispatch s381_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s381_interest[] = {
+  0x00000033,
+};
+static struct ufsm_state s381 = {
+  .id   = "s381",
+  .name = "(null)",
+  .kind = 4,
+  .index = 40,
+  .parent_region = &r11,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s381_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s381_interest,
+  .time_events = NULL,
+  .completion = &t701,
+  .next = &s55,
+};
+static struct ufsm_dispatch s55_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s55_interest[] = {
+  0x00000033,
+};
+static struct ufsm_state s55 = {
+  .id   = "s55",
+  .name = "Init",
+  .kind = 1,
+  .index = 41,
+  .parent_region = &r11,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s55_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s55_interest,
+  .time_events = NULL,
+  .completion = &t11,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s7entry = {
+  .id = "s7entry",
+  .name = "e7",
+  .f = &e7,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s7exit = {
+  .id = "s7exit",
+  .name = "x7",
+  .f = &x7,
+  .next = NULL,
+};
+static struct ufsm_transition * s6_dispatch_2[] = {
+  &t695,
+  NULL,
+};
+static struct ufsm_transition * s6_dispatch_4[] = {
+  &t81,
+  NULL,
+};
+static struct ufsm_transition * s6_dispatch_7[] = {
+  &t82,
+  NULL,
+};
+static struct ufsm_dispatch s6_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s6_dispatch_2,
+},
+{
+  .ev = 4,
+  .transition = s6_dispatch_4,
+},
+{
+  .ev = 7,
+  .transition = s6_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s6_interest[] = {
+  0x00000096,
+};
+static struct ufsm_state s6 = {
+  .id   = "s6",
+  .name = "S6",
+  .kind = 0,
+  .index = 16,
+  .parent_region = &r1,
+  .entry = &s6entry,
+  .doact = NULL,
+  .exit = &s6exit,
+  .region = &r10,
+  .submachine = NULL,
+  .dispatch = s6_dispatch,
+  .no_of_dispatch = 3,
+  .flat_dispatch = NULL,
+  .interest = s6_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s382,
+};
+static struct ufsm_region r10 = {
+  .id = "r10",
+  .name = "R10",
+  .state = &s54,
+  .has_history = true,
+  .history = NULL,
+  .index = 3,
+  .transition = &t10,
+  .parent_state = &s6,
+  .next = &r9,
+};
+static struct ufsm_transition t10 = {
+  .id = "t10",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 39,
+  .action = &t10effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s50,
+  .dest = &s54,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t153,
+};
+static struct ufsm_action t10effect = {
+  .id = "t10effect",
+  .name = "a10",
+  .f = &a10,
+  .next = NULL,
+};
+static struct ufsm_trigger t153_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t153 = {
+  .id = "t153",
+  .name = "",
+  .trigger = t153_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 40,
+  .action = &t153effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s51,
+  .dest = &s53,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t154,
+};
+static struct ufsm_action t153effect = {
+  .id = "t153effect",
+  .name = "a153",
+  .f = &a153,
+  .next = NULL,
+};
+static struct ufsm_trigger t154_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_0",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t154 = {
+  .id = "t154",
+  .name = "",
+  .trigger = t154_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 41,
+  .action = &t154effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s51,
+  .dest = &s52,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t155,
+};
+static struct ufsm_action t154effect = {
+  .id = "t154effect",
+  .name = "a154",
+  .f = &a154,
+  .next = NULL,
+};
+static struct ufsm_trigger t155_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t155 = {
+  .id = "t155",
+  .name = "",
+  .trigger = t155_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 42,
+  .action = &t155effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s52,
+  .dest = &s52,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t156,
+};
+static struct ufsm_action t155effect = {
+  .id = "t155effect",
+  .name = "a155",
+  .f = &a155,
+  .next = NULL,
+};
+static struct ufsm_trigger t156_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t156_exit_path[] = {
+  &r10,
+  &r1,
+  NULL,
+};
+static struct ufsm_region * t156_enter_path[] = {
+  &r0,
+  NULL,
+};
+static struct ufsm_transition t156 = {
+  .id = "t156",
+  .name = "",
+  .trigger = t156_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 43,
+  .action = &t156effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s52,
+  .dest = &s2,
+  .lca = &r0,
+  .exit_path = t156_exit_path,
+  .enter_path = t156_enter_path,
+  .next = &t157,
+};
+static struct ufsm_action t156effect = {
+  .id = "t156effect",
+  .name = "a156",
+  .f = &a156,
+  .next = NULL,
+};
+static struct ufsm_trigger t157_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t157 = {
+  .id = "t157",
+  .name = "",
+  .trigger = t157_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 44,
+  .action = &t157effect,
+  .defer = false,
+  .guard = &t157guard,
+  .source = &s53,
+  .dest = &s53,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t158,
+};
+static struct ufsm_action t157effect = {
+  .id = "t157effect",
+  .name = "a157",
+  .f = &a157,
+  .next = NULL,
+};
+static struct ufsm_guard t157guard = {
+  .id = "t157guard",
+  .name = "g29",
+  .f = &g29,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t158_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_6",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t158 = {
+  .id = "t158",
+  .name = "",
+  .trigger = t158_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 45,
+  .action = &t158effect,
+  .defer = false,
+  .guard = &t158guard,
+  .source = &s53,
+  .dest = &s54,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t159,
+};
+static struct ufsm_action t158effect = {
+  .id = "t158effect",
+  .name = "a158",
+  .f = &a158,
+  .next = NULL,
+};
+static struct ufsm_guard t158guard = {
+  .id = "t158guard",
+  .name = "g30",
+  .f = &g30,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t159_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t159 = {
+  .id = "t159",
+  .name = "",
+  .trigger = t159_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 46,
+  .action = &t159effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s54,
+  .dest = &s54,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t160,
+};
+static struct ufsm_action t159effect = {
+  .id = "t159effect",
+  .name = "a159",
+  .f = &a159,
+  .next = NULL,
+};
+static struct ufsm_trigger t160_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t160 = {
+  .id = "t160",
+  .name = "",
+  .trigger = t160_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 47,
+  .action = &t160effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s54,
+  .dest = &s52,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t160effect = {
+  .id = "t160effect",
+  .name = "a160",
+  .f = &a160,
+  .next = NULL,
+};
+static struct ufsm_transition * s54_dispatch_2[] = {
+  &t159,
+  NULL,
+};
+static struct ufsm_transition * s54_dispatch_7[] = {
+  &t160,
+  NULL,
+};
+static struct ufsm_dispatch s54_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s54_dispatch_2,
+},
+{
+  .ev = 7,
+  .transition = s54_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s54_interest[] = {
+  0x00000096,
+};
+static struct ufsm_state s54 = {
+  .id   = "s54",
+  .name = "S54",
+  .kind = 0,
+  .index = 21,
+  .parent_region = &r10,
+  .entry = &s54entry,
+  .doact = NULL,
+  .exit = &s54exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s54_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s54_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s53,
+};
+static struct ufsm_entry_exit s54entry = {
+  .id = "s54entry",
+  .name = "e54",
+  .f = &e54,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s54exit = {
+  .id = "s54exit",
+  .name = "x54",
+  .f = &x54,
+  .next = NULL,
+};
+static struct ufsm_transition * s53_dispatch_3[] = {
+  &t158,
+  NULL,
+};
+static struct ufsm_transition * s53_dispatch_6[] = {
+  &t157,
+  NULL,
+};
+static struct ufsm_dispatch s53_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s53_dispatch_3,
+},
+{
+  .ev = 6,
+  .transition = s53_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s53_interest[] = {
+  0x000000de,
+};
+static struct ufsm_state s53 = {
+  .id   = "s53",
+  .name = "S53",
+  .kind = 0,
+  .index = 22,
+  .parent_region = &r10,
+  .entry = &s53entry,
+  .doact = NULL,
+  .exit = &s53exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s53_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s53_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s52,
+};
+static struct ufsm_entry_exit s53entry = {
+  .id = "s53entry",
+  .name = "e53",
+  .f = &e53,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s53exit = {
+  .id = "s53exit",
+  .name = "x53",
+  .f = &x53,
+  .next = NULL,
+};
+static struct ufsm_transition * s52_dispatch_0[] = {
+  &t156,
+  NULL,
+};
+static struct ufsm_transition * s52_dispatch_3[] = {
+  &t155,
+  NULL,
+};
+static struct ufsm_dispatch s52_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s52_dispatch_0,
+},
+{
+  .ev = 3,
+  .transition = s52_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s52_interest[] = {
+  0x0000009f,
+};
+static struct ufsm_state s52 = {
+  .id   = "s52",
+  .name = "S52",
+  .kind = 0,
+  .index = 23,
+  .parent_region = &r10,
+  .entry = &s52entry,
+  .doact = NULL,
+  .exit = &s52exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s52_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s52_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s51,
+};
+static struct ufsm_entry_exit s52entry = {
+  .id = "s52entry",
+  .name = "e52",
+  .f = &e52,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s52exit = {
+  .id = "s52exit",
+  .name = "x52",
+  .f = &x52,
+  .next = NULL,
+};
+static struct ufsm_transition * s51_dispatch_3[] = {
+  &t153,
+  NULL,
+};
+static struct ufsm_transition * s51_dispatch_5[] = {
+  &t154,
+  NULL,
+};
+static struct ufsm_dispatch s51_dispatch[] = {
+{
+  .ev = 3,
+  .transition = s51_dispatch_3,
+},
+{
+  .ev = 5,
+  .transition = s51_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s51_interest[] = {
+  0x000000be,
+};
+static struct ufsm_state s51 = {
+  .id   = "s51",
+  .name = "S51",
+  .kind = 0,
+  .index = 24,
+  .parent_region = &r10,
+  .entry = &s51entry,
+  .doact = NULL,
+  .exit = &s51exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s51_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s51_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s50,
+};
+static struct ufsm_entry_exit s51entry = {
+  .id = "s51entry",
+  .name = "e51",
+  .f = &e51,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s51exit = {
+  .id = "s51exit",
+  .name = "x51",
+  .f = &x51,
+  .next = NULL,
+};
+static struct ufsm_dispatch s50_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s50_interest[] = {
+  0x00000096,
+};
+static struct ufsm_state s50 = {
+  .id   = "s50",
+  .name = "Init",
+  .kind = 1,
+  .index = 25,
+  .parent_region = &r10,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s50_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s50_interest,
+  .time_events = NULL,
+  .completion = &t10,
+  .next = NULL,
+};
+static struct ufsm_region r9 = {
+  .id = "r9",
+  .name = "R9",
+  .state = &s49,
+  .has_history = true,
+  .history = NULL,
+  .index = 4,
+  .transition = &t9,
+  .parent_state = &s6,
+  .next = NULL,
+};
+static struct ufsm_transition t9 = {
+  .id = "t9",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 48,
+  .action = &t9effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s45,
+  .dest = &s46,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t145,
+};
+static struct ufsm_action t9effect = {
+  .id = "t9effect",
+  .name = "a9",
+  .f = &a9,
+  .next = NULL,
+};
+static struct ufsm_trigger t145_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t145 = {
+  .id = "t145",
+  .name = "",
+  .trigger = t145_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 49,
+  .action = &t145effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s46,
+  .dest = &s47,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t146,
+};
+static struct ufsm_action t145effect = {
+  .id = "t145effect",
+  .name = "a145",
+  .f = &a145,
+  .next = NULL,
+};
+static struct ufsm_trigger t146_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_region * t146_exit_path[] = {
+  &r9,
+  NULL,
+};
+static struct ufsm_region * t146_enter_path[] = {
+  &r1,
+  NULL,
+};
+static struct ufsm_transition t146 = {
+  .id = "t146",
+  .name = "",
+  .trigger = t146_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 50,
+  .action = &t146effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s46,
+  .dest = &s7,
+  .lca = &r1,
+  .exit_path = t146_exit_path,
+  .enter_path = t146_enter_path,
+  .next = &t147,
+};
+static struct ufsm_action t146effect = {
+  .id = "t146effect",
+  .name = "a146",
+  .f = &a146,
+  .next = NULL,
+};
+static struct ufsm_trigger t147_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t147 = {
+  .id = "t147",
+  .name = "",
+  .trigger = t147_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 51,
+  .action = &t147effect,
+  .defer = false,
+  .guard = &t147guard,
+  .source = &s47,
+  .dest = &s49,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t148,
+};
+static struct ufsm_action t147effect = {
+  .id = "t147effect",
+  .name = "a147",
+  .f = &a147,
+  .next = NULL,
+};
+static struct ufsm_guard t147guard = {
+  .id = "t147guard",
+  .name = "g27",
+  .f = &g27,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t148_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t148 = {
+  .id = "t148",
+  .name = "",
+  .trigger = t148_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 52,
+  .action = &t148effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s47,
+  .dest = &s46,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t149,
+};
+static struct ufsm_action t148effect = {
+  .id = "t148effect",
+  .name = "a148",
+  .f = &a148,
+  .next = NULL,
+};
+static struct ufsm_trigger t149_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t149 = {
+  .id = "t149",
+  .name = "",
+  .trigger = t149_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 53,
+  .action = &t149effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s48,
+  .dest = &s46,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t150,
+};
+static struct ufsm_action t149effect = {
+  .id = "t149effect",
+  .name = "a149",
+  .f = &a149,
+  .next = NULL,
+};
+static struct ufsm_trigger t150_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t150 = {
+  .id = "t150",
+  .name = "",
+  .trigger = t150_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 54,
+  .action = &t150effect,
+  .defer = false,
+  .guard = &t150guard,
+  .source = &s48,
+  .dest = &s47,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t151,
+};
+static struct ufsm_action t150effect = {
+  .id = "t150effect",
+  .name = "a150",
+  .f = &a150,
+  .next = NULL,
+};
+static struct ufsm_guard t150guard = {
+  .id = "t150guard",
+  .name = "g28",
+  .f = &g28,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger t151_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_7",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t151 = {
+  .id = "t151",
+  .name = "",
+  .trigger = t151_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 55,
+  .action = &t151effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s49,
+  .dest = &s48,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &t152,
+};
+static struct ufsm_action t151effect = {
+  .id = "t151effect",
+  .name = "a151",
+  .f = &a151,
+  .next = NULL,
+};
+static struct ufsm_trigger t152_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_5",
+  .next = NULL,
+},
+};
+static struct ufsm_transition t152 = {
+  .id = "t152",
+  .name = "",
+  .trigger = t152_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 56,
+  .action = &t152effect,
+  .defer = false,
+  .guard = NULL,
+  .source = &s49,
+  .dest = &s49,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action t152effect = {
+  .id = "t152effect",
+  .name = "a152",
+  .f = &a152,
+  .next = NULL,
+};
+static struct ufsm_transition * s49_dispatch_0[] = {
+  &t152,
+  NULL,
+};
+static struct ufsm_transition * s49_dispatch_2[] = {
+  &t151,
+  NULL,
+};
+static struct ufsm_dispatch s49_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s49_dispatch_0,
+},
+{
+  .ev = 2,
+  .transition = s49_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s49_interest[] = {
+  0x00000097,
+};
+static struct ufsm_state s49 = {
+  .id   = "s49",
+  .name = "S49",
+  .kind = 0,
+  .index = 26,
+  .parent_region = &r9,
+  .entry = &s49entry,
+  .doact = NULL,
+  .exit = &s49exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s49_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s49_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s48,
+};
+static struct ufsm_entry_exit s49entry = {
+  .id = "s49entry",
+  .name = "e49",
+  .f = &e49,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s49exit = {
+  .id = "s49exit",
+  .name = "x49",
+  .f = &x49,
+  .next = NULL,
+};
+static struct ufsm_transition * s48_dispatch_2[] = {
+  &t149,
+  &t150,
+  NULL,
+};
+static struct ufsm_dispatch s48_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s48_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s48_interest[] = {
+  0x00000096,
+};
+static struct ufsm_state s48 = {
+  .id   = "s48",
+  .name = "S48",
+  .kind = 0,
+  .index = 27,
+  .parent_region = &r9,
+  .entry = &s48entry,
+  .doact = NULL,
+  .exit = &s48exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s48_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = s48_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s47,
+};
+static struct ufsm_entry_exit s48entry = {
+  .id = "s48entry",
+  .name = "e48",
+  .f = &e48,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s48exit = {
+  .id = "s48exit",
+  .name = "x48",
+  .f = &x48,
+  .next = NULL,
+};
+static struct ufsm_transition * s47_dispatch_0[] = {
+  &t148,
+  NULL,
+};
+static struct ufsm_transition * s47_dispatch_1[] = {
+  &t147,
+  NULL,
+};
+static struct ufsm_dispatch s47_dispatch[] = {
+{
+  .ev = 0,
+  .transition = s47_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = s47_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s47_interest[] = {
+  0x00000097,
+};
+static struct ufsm_state s47 = {
+  .id   = "s47",
+  .name = "S47",
+  .kind = 0,
+  .index = 28,
+  .parent_region = &r9,
+  .entry = &s47entry,
+  .doact = NULL,
+  .exit = &s47exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s47_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s47_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s46,
+};
+static struct ufsm_entry_exit s47entry = {
+  .id = "s47entry",
+  .name = "e47",
+  .f = &e47,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s47exit = {
+  .id = "s47exit",
+  .name = "x47",
+  .f = &x47,
+  .next = NULL,
+};
+static struct ufsm_transition * s46_dispatch_2[] = {
+  &t146,
+  NULL,
+};
+static struct ufsm_transition * s46_dispatch_6[] = {
+  &t145,
+  NULL,
+};
+static struct ufsm_dispatch s46_dispatch[] = {
+{
+  .ev = 2,
+  .transition = s46_dispatch_2,
+},
+{
+  .ev = 6,
+  .transition = s46_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s46_interest[] = {
+  0x000000d6,
+};
+static struct ufsm_state s46 = {
+  .id   = "s46",
+  .name = "S46",
+  .kind = 0,
+  .index = 29,
+  .parent_region = &r9,
+  .entry = &s46entry,
+  .doact = NULL,
+  .exit = &s46exit,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s46_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = s46_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &s45,
+};
+static struct ufsm_entry_exit s46entry = {
+  .id = "s46entry",
+  .name = "e46",
+  .f = &e46,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s46exit = {
+  .id = "s46exit",
+  .name = "x46",
+  .f = &x46,
+  .next = NULL,
+};
+static struct ufsm_dispatch s45_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s45_interest[] = {
+  0x00000096,
+};
+static struct ufsm_state s45 = {
+  .id   = "s45",
+  .name = "Init",
+  .kind = 1,
+  .index = 30,
+  .parent_region = &r9,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s45_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s45_interest,
+  .time_events = NULL,
+  .completion = &t9,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s6entry = {
+  .id = "s6entry",
+  .name = "e6",
+  .f = &e6,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s6exit = {
+  .id = "s6exit",
+  .name = "x6",
+  .f = &x6,
+  .next = NULL,
+};
+static struct ufsm_dispatch s382_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s382_interest[] = {
+  0x00000012,
+};
+static struct ufsm_state s382 = {
+  .id   = "s382",
+  .name = "(null)",
+  .kind = 4,
+  .index = 17,
+  .parent_region = &r1,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s382_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s382_interest,
+  .time_events = NULL,
+  .completion = &t703,
+  .next = &s380,
+};
+static struct ufsm_dispatch s380_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s380_interest[] = {
+  0x00000012,
+};
+static struct ufsm_state s380 = {
+  .id   = "s380",
+  .name = "(null)",
+  .kind = 7,
+  .index = 18,
+  .parent_region = &r1,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s380_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s380_interest,
+  .time_events = NULL,
+  .completion = &t700,
+  .next = &s379,
+};
+static struct ufsm_dispatch s379_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s379_interest[] = {
+  0x00000012,
+};
+static struct ufsm_state s379 = {
+  .id   = "s379",
+  .name = "(null)",
+  .kind = 8,
+  .index = 19,
+  .parent_region = &r1,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s379_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s379_interest,
+  .time_events = NULL,
+  .completion = &t696,
+  .next = &s5,
+};
+static struct ufsm_dispatch s5_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t s5_interest[] = {
+  0x00000012,
+};
+static struct ufsm_state s5 = {
+  .id   = "s5",
+  .name = "Init",
+  .kind = 1,
+  .index = 20,
+  .parent_region = &r1,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s5_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = s5_interest,
+  .time_events = NULL,
+  .completion = &t1,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s1entry = {
+  .id = "s1entry",
+  .name = "e1",
+  .f = &e1,
+  .next = NULL,
+};
+static struct ufsm_entry_exit s1exit = {
+  .id = "s1exit",
+  .name = "x1",
+  .f = &x1,
+  .next = NULL,
+};
+static struct ufsm_dispatch s376_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state s376 = {
+  .id   = "s376",
+  .name = "(null)",
+  .kind = 7,
+  .index = 5,
+  .parent_region = &r0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s376_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &t688,
+  .next = &s375,
+};
+static struct ufsm_dispatch s375_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state s375 = {
+  .id   = "s375",
+  .name = "(null)",
+  .kind = 8,
+  .index = 6,
+  .parent_region = &r0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s375_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &t684,
+  .next = &s0,
+};
+static struct ufsm_dispatch s0_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state s0 = {
+  .id   = "s0",
+  .name = "Init",
+  .kind = 1,
+  .index = 7,
+  .parent_region = &r0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = s0_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &t0,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_test_gen_input(void) { return &machine; }
@@ -0,0 +1,1511 @@
+#ifndef UFSM_GEN_test_gen_input_H__
+#define UFSM_GEN_test_gen_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* test_gen_input: depth 3, active regions 7, completion states 3, stacks 234/7/3, queues 16/0 */
+#define test_gen_input_CONTEXT_DATA_SIZE 244
+void e364(void);
+void x364(void);
+void e363(void);
+void x363(void);
+void e362(void);
+void x362(void);
+void e361(void);
+void x361(void);
+void e359(void);
+void x359(void);
+void e358(void);
+void x358(void);
+void e357(void);
+void x357(void);
+void e356(void);
+void x356(void);
+void e44(void);
+void x44(void);
+void e354(void);
+void x354(void);
+void e353(void);
+void x353(void);
+void e352(void);
+void x352(void);
+void e351(void);
+void x351(void);
+void e349(void);
+void x349(void);
+void e348(void);
+void x348(void);
+void e347(void);
+void x347(void);
+void e346(void);
+void x346(void);
+void e43(void);
+void x43(void);
+void e344(void);
+void x344(void);
+void e343(void);
+void x343(void);
+void e342(void);
+void x342(void);
+void e341(void);
+void x341(void);
+void e339(void);
+void x339(void);
+void e338(void);
+void x338(void);
+void e337(void);
+void x337(void);
+void e336(void);
+void x336(void);
+void e42(void);
+void x42(void);
+void e334(void);
+void x334(void);
+void e333(void);
+void x333(void);
+void e332(void);
+void x332(void);
+void e331(void);
+void x331(void);
+void e329(void);
+void x329(void);
+void e328(void);
+void x328(void);
+void e327(void);
+void x327(void);
+void e326(void);
+void x326(void);
+void e41(void);
+void x41(void);
+void e324(void);
+void x324(void);
+void e323(void);
+void x323(void);
+void e322(void);
+void x322(void);
+void e321(void);
+void x321(void);
+void e319(void);
+void x319(void);
+void e318(void);
+void x318(void);
+void e317(void);
+void x317(void);
+void e316(void);
+void x316(void);
+void e39(void);
+void x39(void);
+void e314(void);
+void x314(void);
+void e313(void);
+void x313(void);
+void e312(void);
+void x312(void);
+void e311(void);
+void x311(void);
+void e309(void);
+void x309(void);
+void e308(void);
+void x308(void);
+void e307(void);
+void x307(void);
+void e306(void);
+void x306(void);
+void e38(void);
+void x38(void);
+void e304(void);
+void x304(void);
+void e303(void);
+void x303(void);
+void e302(void);
+void x302(void);
+void e301(void);
+void x301(void);
+void e299(void);
+void x299(void);
+void e298(void);
+void x298(void);
+void e297(void);
+void x297(void);
+void e296(void);
+void x296(void);
+void e37(void);
+void x37(void);
+void e294(void);
+void x294(void);
+void e293(void);
+void x293(void);
+void e292(void);
+void x292(void);
+void e291(void);
+void x291(void);
+void e289(void);
+void x289(void);
+void e288(void);
+void x288(void);
+void e287(void);
+void x287(void);
+void e286(void);
+void x286(void);
+void e36(void);
+void x36(void);
+void e4(void);
+void x4(void);
+void e284(void);
+void x284(void);
+void e283(void);
+void x283(void);
+void e282(void);
+void x282(void);
+void e281(void);
+void x281(void);
+void e279(void);
+void x279(void);
+void e278(void);
+void x278(void);
+void e277(void);
+void x277(void);
+void e276(void);
+void x276(void);
+void e34(void);
+void x34(void);
+void e274(void);
+void x274(void);
+void e273(void);
+void x273(void);
+void e272(void);
+void x272(void);
+void e271(void);
+void x271(void);
+void e269(void);
+void x269(void);
+void e268(void);
+void x268(void);
+void e267(void);
+void x267(void);
+void e266(void);
+void x266(void);
+void e33(void);
+void x33(void);
+void e264(void);
+void x264(void);
+void e263(void);
+void x263(void);
+void e262(void);
+void x262(void);
+void e261(void);
+void x261(void);
+void e259(void);
+void x259(void);
+void e258(void);
+void x258(void);
+void e257(void);
+void x257(void);
+void e256(void);
+void x256(void);
+void e32(void);
+void x32(void);
+void e254(void);
+void x254(void);
+void e253(void);
+void x253(void);
+void e252(void);
+void x252(void);
+void e251(void);
+void x251(void);
+void e249(void);
+void x249(void);
+void e248(void);
+void x248(void);
+void e247(void);
+void x247(void);
+void e246(void);
+void x246(void);
+void e31(void);
+void x31(void);
+void e244(void);
+void x244(void);
+void e243(void);
+void x243(void);
+void e242(void);
+void x242(void);
+void e241(void);
+void x241(void);
+void e239(void);
+void x239(void);
+void e238(void);
+void x238(void);
+void e237(void);
+void x237(void);
+void e236(void);
+void x236(void);
+void e29(void);
+void x29(void);
+void e234(void);
+void x234(void);
+void e233(void);
+void x233(void);
+void e232(void);
+void x232(void);
+void e231(void);
+void x231(void);
+void e229(void);
+void x229(void);
+void e228(void);
+void x228(void);
+void e227(void);
+void x227(void);
+void e226(void);
+void x226(void);
+void e28(void);
+void x28(void);
+void e224(void);
+void x224(void);
+void e223(void);
+void x223(void);
+void e222(void);
+void x222(void);
+void e221(void);
+void x221(void);
+void e219(void);
+void x219(void);
+void e218(void);
+void x218(void);
+void e217(void);
+void x217(void);
+void e216(void);
+void x216(void);
+void e27(void);
+void x27(void);
+void e214(void);
+void x214(void);
+void e213(void);
+void x213(void);
+void e212(void);
+void x212(void);
+void e211(void);
+void x211(void);
+void e209(void);
+void x209(void);
+void e208(void);
+void x208(void);
+void e207(void);
+void x207(void);
+void e206(void);
+void x206(void);
+void e26(void);
+void x26(void);
+void e3(void);
+void x3(void);
+void e204(void);
+void x204(void);
+void e203(void);
+void x203(void);
+void e202(void);
+void x202(void);
+void e201(void);
+void x201(void);
+void e199(void);
+void x199(void);
+void e198(void);
+void x198(void);
+void e197(void);
+void x197(void);
+void e196(void);
+void x196(void);
+void e24(void);
+void x24(void);
+void e194(void);
+void x194(void);
+void e193(void);
+void x193(void);
+void e192(void);
+void x192(void);
+void e191(void);
+void x191(void);
+void e189(void);
+void x189(void);
+void e188(void);
+void x188(void);
+void e187(void);
+void x187(void);
+void e186(void);
+void x186(void);
+void e23(void);
+void x23(void);
+void e184(void);
+void x184(void);
+void e183(void);
+void x183(void);
+void e182(void);
+void x182(void);
+void e181(void);
+void x181(void);
+void e179(void);
+void x179(void);
+void e178(void);
+void x178(void);
+void e177(void);
+void x177(void);
+void e176(void);
+void x176(void);
+void e22(void);
+void x22(void);
+void e174(void);
+void x174(void);
+void e173(void);
+void x173(void);
+void e172(void);
+void x172(void);
+void e171(void);
+void x171(void);
+void e169(void);
+void x169(void);
+void e168(void);
+void x168(void);
+void e167(void);
+void x167(void);
+void e166(void);
+void x166(void);
+void e21(void);
+void x21(void);
+void e164(void);
+void x164(void);
+void e163(void);
+void x163(void);
+void e162(void);
+void x162(void);
+void e161(void);
+void x161(void);
+void e159(void);
+void x159(void);
+void e158(void);
+void x158(void);
+void e157(void);
+void x157(void);
+void e156(void);
+void x156(void);
+void e19(void);
+void x19(void);
+void e154(void);
+void x154(void);
+void e153(void);
+void x153(void);
+void e152(void);
+void x152(void);
+void e151(void);
+void x151(void);
+void e149(void);
+void x149(void);
+void e148(void);
+void x148(void);
+void e147(void);
+void x147(void);
+void e146(void);
+void x146(void);
+void e18(void);
+void x18(void);
+void e144(void);
+void x144(void);
+void e143(void);
+void x143(void);
+void e142(void);
+void x142(void);
+void e141(void);
+void x141(void);
+void e139(void);
+void x139(void);
+void e138(void);
+void x138(void);
+void e137(void);
+void x137(void);
+void e136(void);
+void x136(void);
+void e17(void);
+void x17(void);
+void e134(void);
+void x134(void);
+void e133(void);
+void x133(void);
+void e132(void);
+void x132(void);
+void e131(void);
+void x131(void);
+void e129(void);
+void x129(void);
+void e128(void);
+void x128(void);
+void e127(void);
+void x127(void);
+void e126(void);
+void x126(void);
+void e16(void);
+void x16(void);
+void e2(void);
+void x2(void);
+void e124(void);
+void x124(void);
+void e123(void);
+void x123(void);
+void e122(void);
+void x122(void);
+void e121(void);
+void x121(void);
+void e119(void);
+void x119(void);
+void e118(void);
+void x118(void);
+void e117(void);
+void x117(void);
+void e116(void);
+void x116(void);
+void e14(void);
+void x14(void);
+void e114(void);
+void x114(void);
+void e113(void);
+void x113(void);
+void e112(void);
+void x112(void);
+void e111(void);
+void x111(void);
+void e109(void);
+void x109(void);
+void e108(void);
+void x108(void);
+void e107(void);
+void x107(void);
+void e106(void);
+void x106(void);
+void e13(void);
+void x13(void);
+void e104(void);
+void x104(void);
+void e103(void);
+void x103(void);
+void e102(void);
+void x102(void);
+void e101(void);
+void x101(void);
+void e99(void);
+void x99(void);
+void e98(void);
+void x98(void);
+void e97(void);
+void x97(void);
+void e96(void);
+void x96(void);
+void e12(void);
+void x12(void);
+void e94(void);
+void x94(void);
+void e93(void);
+void x93(void);
+void e92(void);
+void x92(void);
+void e91(void);
+void x91(void);
+void e89(void);
+void x89(void);
+void e88(void);
+void x88(void);
+void e87(void);
+void x87(void);
+void e86(void);
+void x86(void);
+void e11(void);
+void x11(void);
+void e84(void);
+void x84(void);
+void e83(void);
+void x83(void);
+void e82(void);
+void x82(void);
+void e81(void);
+void x81(void);
+void e79(void);
+void x79(void);
+void e78(void);
+void x78(void);
+void e77(void);
+void x77(void);
+void e76(void);
+void x76(void);
+void e9(void);
+void x9(void);
+void e74(void);
+void x74(void);
+void e73(void);
+void x73(void);
+void e72(void);
+void x72(void);
+void e71(void);
+void x71(void);
+void e69(void);
+void x69(void);
+void e68(void);
+void x68(void);
+void e67(void);
+void x67(void);
+void e66(void);
+void x66(void);
+void e8(void);
+void x8(void);
+void e64(void);
+void x64(void);
+void e63(void);
+void x63(void);
+void e62(void);
+void x62(void);
+void e61(void);
+void x61(void);
+void e59(void);
+void x59(void);
+void e58(void);
+void x58(void);
+void e57(void);
+void x57(void);
+void e56(void);
+void x56(void);
+void e7(void);
+void x7(void);
+void e54(void);
+void x54(void);
+void e53(void);
+void x53(void);
+void e52(void);
+void x52(void);
+void e51(void);
+void x51(void);
+void e49(void);
+void x49(void);
+void e48(void);
+void x48(void);
+void e47(void);
+void x47(void);
+void e46(void);
+void x46(void);
+void e6(void);
+void x6(void);
+void e1(void);
+void x1(void);
+bool g0(void);
+bool g1(void);
+bool g2(void);
+bool g3(void);
+bool g24(void);
+bool g25(void);
+bool g26(void);
+bool g183(void);
+bool g184(void);
+bool g185(void);
+bool g186(void);
+bool g180(void);
+bool g181(void);
+bool g182(void);
+bool g179(void);
+bool g175(void);
+bool g176(void);
+bool g177(void);
+bool g178(void);
+bool g172(void);
+bool g173(void);
+bool g174(void);
+bool g169(void);
+bool g170(void);
+bool g171(void);
+bool g187(void);
+bool g166(void);
+bool g167(void);
+bool g168(void);
+bool g23(void);
+bool g193(void);
+bool g162(void);
+bool g163(void);
+bool g164(void);
+bool g165(void);
+bool g161(void);
+bool g157(void);
+bool g158(void);
+bool g159(void);
+bool g160(void);
+bool g154(void);
+bool g155(void);
+bool g156(void);
+bool g152(void);
+bool g153(void);
+bool g148(void);
+bool g149(void);
+bool g150(void);
+bool g151(void);
+bool g146(void);
+bool g147(void);
+bool g144(void);
+bool g145(void);
+bool g20(void);
+bool g21(void);
+bool g22(void);
+bool g141(void);
+bool g142(void);
+bool g143(void);
+bool g138(void);
+bool g139(void);
+bool g140(void);
+bool g136(void);
+bool g137(void);
+bool g133(void);
+bool g134(void);
+bool g135(void);
+bool g132(void);
+bool g128(void);
+bool g129(void);
+bool g130(void);
+bool g131(void);
+bool g127(void);
+bool g15(void);
+bool g16(void);
+bool g17(void);
+bool g18(void);
+bool g19(void);
+bool g125(void);
+bool g126(void);
+bool g124(void);
+bool g120(void);
+bool g121(void);
+bool g122(void);
+bool g123(void);
+bool g117(void);
+bool g118(void);
+bool g119(void);
+bool g114(void);
+bool g115(void);
+bool g116(void);
+bool g109(void);
+bool g110(void);
+bool g111(void);
+bool g112(void);
+bool g113(void);
+bool g107(void);
+bool g108(void);
+bool g103(void);
+bool g104(void);
+bool g105(void);
+bool g106(void);
+bool g12(void);
+bool g13(void);
+bool g14(void);
+bool g101(void);
+bool g102(void);
+bool g98(void);
+bool g99(void);
+bool g100(void);
+bool g96(void);
+bool g97(void);
+bool g90(void);
+bool g91(void);
+bool g92(void);
+bool g93(void);
+bool g94(void);
+bool g95(void);
+bool g87(void);
+bool g88(void);
+bool g89(void);
+bool g83(void);
+bool g84(void);
+bool g85(void);
+bool g86(void);
+bool g191(void);
+bool g80(void);
+bool g81(void);
+bool g82(void);
+bool g78(void);
+bool g79(void);
+bool g9(void);
+bool g10(void);
+bool g11(void);
+bool g76(void);
+bool g77(void);
+bool g74(void);
+bool g75(void);
+bool g71(void);
+bool g72(void);
+bool g73(void);
+bool g69(void);
+bool g70(void);
+bool g67(void);
+bool g68(void);
+bool g64(void);
+bool g65(void);
+bool g66(void);
+bool g61(void);
+bool g62(void);
+bool g63(void);
+bool g58(void);
+bool g59(void);
+bool g60(void);
+bool g6(void);
+bool g7(void);
+bool g8(void);
+bool g55(void);
+bool g56(void);
+bool g57(void);
+bool g190(void);
+bool g188(void);
+bool g189(void);
+bool g54(void);
+bool g53(void);
+bool g192(void);
+bool g49(void);
+bool g50(void);
+bool g51(void);
+bool g52(void);
+bool g45(void);
+bool g46(void);
+bool g47(void);
+bool g48(void);
+bool g44(void);
+bool g40(void);
+bool g41(void);
+bool g42(void);
+bool g43(void);
+bool g4(void);
+bool g5(void);
+bool g38(void);
+bool g39(void);
+bool g37(void);
+bool g35(void);
+bool g36(void);
+bool g33(void);
+bool g34(void);
+bool g31(void);
+bool g32(void);
+bool g29(void);
+bool g30(void);
+bool g27(void);
+bool g28(void);
+void a0(void);
+void a73(void);
+void a74(void);
+void a75(void);
+void a76(void);
+void a77(void);
+void a78(void);
+void a79(void);
+void a80(void);
+void a683(void);
+void a684(void);
+void a685(void);
+void a688(void);
+void a704(void);
+void a8(void);
+void a137(void);
+void a138(void);
+void a139(void);
+void a140(void);
+void a141(void);
+void a142(void);
+void a143(void);
+void a144(void);
+void a687(void);
+void a708(void);
+void a72(void);
+void a649(void);
+void a650(void);
+void a651(void);
+void a652(void);
+void a653(void);
+void a654(void);
+void a655(void);
+void a656(void);
+void a71(void);
+void a641(void);
+void a642(void);
+void a643(void);
+void a644(void);
+void a645(void);
+void a646(void);
+void a647(void);
+void a648(void);
+void a70(void);
+void a633(void);
+void a634(void);
+void a635(void);
+void a636(void);
+void a637(void);
+void a638(void);
+void a639(void);
+void a640(void);
+void a69(void);
+void a625(void);
+void a626(void);
+void a627(void);
+void a628(void);
+void a629(void);
+void a630(void);
+void a631(void);
+void a632(void);
+void a707(void);
+void a68(void);
+void a617(void);
+void a618(void);
+void a619(void);
+void a620(void);
+void a621(void);
+void a622(void);
+void a623(void);
+void a624(void);
+void a67(void);
+void a609(void);
+void a610(void);
+void a611(void);
+void a612(void);
+void a613(void);
+void a614(void);
+void a615(void);
+void a616(void);
+void a66(void);
+void a601(void);
+void a602(void);
+void a603(void);
+void a604(void);
+void a605(void);
+void a606(void);
+void a607(void);
+void a608(void);
+void a657(void);
+void a658(void);
+void a659(void);
+void a65(void);
+void a593(void);
+void a594(void);
+void a595(void);
+void a596(void);
+void a597(void);
+void a598(void);
+void a599(void);
+void a600(void);
+void a7(void);
+void a129(void);
+void a130(void);
+void a131(void);
+void a132(void);
+void a133(void);
+void a134(void);
+void a135(void);
+void a136(void);
+void a677(void);
+void a678(void);
+void a679(void);
+void a682(void);
+void a686(void);
+void a64(void);
+void a585(void);
+void a586(void);
+void a587(void);
+void a588(void);
+void a589(void);
+void a590(void);
+void a591(void);
+void a592(void);
+void a681(void);
+void a63(void);
+void a577(void);
+void a578(void);
+void a579(void);
+void a580(void);
+void a581(void);
+void a582(void);
+void a583(void);
+void a584(void);
+void a680(void);
+void a62(void);
+void a569(void);
+void a570(void);
+void a571(void);
+void a572(void);
+void a573(void);
+void a574(void);
+void a575(void);
+void a576(void);
+void a61(void);
+void a561(void);
+void a562(void);
+void a563(void);
+void a564(void);
+void a565(void);
+void a566(void);
+void a567(void);
+void a568(void);
+void a60(void);
+void a553(void);
+void a554(void);
+void a555(void);
+void a556(void);
+void a557(void);
+void a558(void);
+void a559(void);
+void a560(void);
+void a59(void);
+void a545(void);
+void a546(void);
+void a547(void);
+void a548(void);
+void a549(void);
+void a550(void);
+void a551(void);
+void a552(void);
+void a673(void);
+void a674(void);
+void a58(void);
+void a537(void);
+void a538(void);
+void a539(void);
+void a540(void);
+void a541(void);
+void a542(void);
+void a543(void);
+void a544(void);
+void a57(void);
+void a529(void);
+void a530(void);
+void a531(void);
+void a532(void);
+void a533(void);
+void a534(void);
+void a535(void);
+void a536(void);
+void a6(void);
+void a121(void);
+void a122(void);
+void a123(void);
+void a124(void);
+void a125(void);
+void a126(void);
+void a127(void);
+void a128(void);
+void a56(void);
+void a521(void);
+void a522(void);
+void a523(void);
+void a524(void);
+void a525(void);
+void a526(void);
+void a527(void);
+void a528(void);
+void a55(void);
+void a513(void);
+void a514(void);
+void a515(void);
+void a516(void);
+void a517(void);
+void a518(void);
+void a519(void);
+void a520(void);
+void a54(void);
+void a505(void);
+void a506(void);
+void a507(void);
+void a508(void);
+void a509(void);
+void a510(void);
+void a511(void);
+void a512(void);
+void a53(void);
+void a497(void);
+void a498(void);
+void a499(void);
+void a500(void);
+void a501(void);
+void a502(void);
+void a503(void);
+void a504(void);
+void a52(void);
+void a489(void);
+void a490(void);
+void a491(void);
+void a492(void);
+void a493(void);
+void a494(void);
+void a495(void);
+void a496(void);
+void a51(void);
+void a481(void);
+void a482(void);
+void a483(void);
+void a484(void);
+void a485(void);
+void a486(void);
+void a487(void);
+void a488(void);
+void a50(void);
+void a473(void);
+void a474(void);
+void a475(void);
+void a476(void);
+void a477(void);
+void a478(void);
+void a479(void);
+void a480(void);
+void a49(void);
+void a465(void);
+void a466(void);
+void a467(void);
+void a468(void);
+void a469(void);
+void a470(void);
+void a471(void);
+void a472(void);
+void a5(void);
+void a113(void);
+void a114(void);
+void a115(void);
+void a116(void);
+void a117(void);
+void a118(void);
+void a119(void);
+void a120(void);
+void a706(void);
+void a48(void);
+void a457(void);
+void a458(void);
+void a459(void);
+void a460(void);
+void a461(void);
+void a462(void);
+void a463(void);
+void a464(void);
+void a47(void);
+void a449(void);
+void a450(void);
+void a451(void);
+void a452(void);
+void a453(void);
+void a454(void);
+void a455(void);
+void a456(void);
+void a46(void);
+void a441(void);
+void a442(void);
+void a443(void);
+void a444(void);
+void a445(void);
+void a446(void);
+void a447(void);
+void a448(void);
+void a45(void);
+void a433(void);
+void a434(void);
+void a435(void);
+void a436(void);
+void a437(void);
+void a438(void);
+void a439(void);
+void a440(void);
+void a44(void);
+void a425(void);
+void a426(void);
+void a427(void);
+void a428(void);
+void a429(void);
+void a430(void);
+void a431(void);
+void a432(void);
+void a43(void);
+void a417(void);
+void a418(void);
+void a419(void);
+void a420(void);
+void a421(void);
+void a422(void);
+void a423(void);
+void a424(void);
+void a42(void);
+void a409(void);
+void a410(void);
+void a411(void);
+void a412(void);
+void a413(void);
+void a414(void);
+void a415(void);
+void a416(void);
+void a41(void);
+void a401(void);
+void a402(void);
+void a403(void);
+void a404(void);
+void a405(void);
+void a406(void);
+void a407(void);
+void a408(void);
+void a705(void);
+void a4(void);
+void a105(void);
+void a106(void);
+void a107(void);
+void a108(void);
+void a109(void);
+void a110(void);
+void a111(void);
+void a112(void);
+void a689(void);
+void a690(void);
+void a691(void);
+void a694(void);
+void a40(void);
+void a393(void);
+void a394(void);
+void a395(void);
+void a396(void);
+void a397(void);
+void a398(void);
+void a399(void);
+void a400(void);
+void a39(void);
+void a385(void);
+void a386(void);
+void a387(void);
+void a388(void);
+void a389(void);
+void a390(void);
+void a391(void);
+void a392(void);
+void a38(void);
+void a377(void);
+void a378(void);
+void a379(void);
+void a380(void);
+void a381(void);
+void a382(void);
+void a383(void);
+void a384(void);
+void a693(void);
+void a37(void);
+void a369(void);
+void a370(void);
+void a371(void);
+void a372(void);
+void a373(void);
+void a374(void);
+void a375(void);
+void a376(void);
+void a692(void);
+void a36(void);
+void a361(void);
+void a362(void);
+void a363(void);
+void a364(void);
+void a365(void);
+void a366(void);
+void a367(void);
+void a368(void);
+void a35(void);
+void a353(void);
+void a354(void);
+void a355(void);
+void a356(void);
+void a357(void);
+void a358(void);
+void a359(void);
+void a360(void);
+void a666(void);
+void a667(void);
+void a668(void);
+void a669(void);
+void a670(void);
+void a34(void);
+void a345(void);
+void a346(void);
+void a347(void);
+void a348(void);
+void a349(void);
+void a350(void);
+void a351(void);
+void a352(void);
+void a33(void);
+void a337(void);
+void a338(void);
+void a339(void);
+void a340(void);
+void a341(void);
+void a342(void);
+void a343(void);
+void a344(void);
+void a3(void);
+void a97(void);
+void a98(void);
+void a99(void);
+void a100(void);
+void a101(void);
+void a102(void);
+void a103(void);
+void a104(void);
+void a32(void);
+void a329(void);
+void a330(void);
+void a331(void);
+void a332(void);
+void a333(void);
+void a334(void);
+void a335(void);
+void a336(void);
+void a671(void);
+void a672(void);
+void a31(void);
+void a321(void);
+void a322(void);
+void a323(void);
+void a324(void);
+void a325(void);
+void a326(void);
+void a327(void);
+void a328(void);
+void a30(void);
+void a313(void);
+void a314(void);
+void a315(void);
+void a316(void);
+void a317(void);
+void a318(void);
+void a319(void);
+void a320(void);
+void a29(void);
+void a305(void);
+void a306(void);
+void a307(void);
+void a308(void);
+void a309(void);
+void a310(void);
+void a311(void);
+void a312(void);
+void a28(void);
+void a297(void);
+void a298(void);
+void a299(void);
+void a300(void);
+void a301(void);
+void a302(void);
+void a303(void);
+void a304(void);
+void a27(void);
+void a289(void);
+void a290(void);
+void a291(void);
+void a292(void);
+void a293(void);
+void a294(void);
+void a295(void);
+void a296(void);
+void a26(void);
+void a281(void);
+void a282(void);
+void a283(void);
+void a284(void);
+void a285(void);
+void a286(void);
+void a287(void);
+void a288(void);
+void a25(void);
+void a273(void);
+void a274(void);
+void a275(void);
+void a276(void);
+void a277(void);
+void a278(void);
+void a279(void);
+void a280(void);
+void a2(void);
+void a89(void);
+void a90(void);
+void a91(void);
+void a92(void);
+void a93(void);
+void a94(void);
+void a95(void);
+void a96(void);
+void a24(void);
+void a265(void);
+void a266(void);
+void a267(void);
+void a268(void);
+void a269(void);
+void a270(void);
+void a271(void);
+void a272(void);
+void a663(void);
+void a664(void);
+void a665(void);
+void a23(void);
+void a257(void);
+void a258(void);
+void a259(void);
+void a260(void);
+void a261(void);
+void a262(void);
+void a263(void);
+void a264(void);
+void a660(void);
+void a661(void);
+void a662(void);
+void a22(void);
+void a249(void);
+void a250(void);
+void a251(void);
+void a252(void);
+void a253(void);
+void a254(void);
+void a255(void);
+void a256(void);
+void a21(void);
+void a241(void);
+void a242(void);
+void a243(void);
+void a244(void);
+void a245(void);
+void a246(void);
+void a247(void);
+void a248(void);
+void a675(void);
+void a676(void);
+void a20(void);
+void a233(void);
+void a234(void);
+void a235(void);
+void a236(void);
+void a237(void);
+void a238(void);
+void a239(void);
+void a240(void);
+void a19(void);
+void a225(void);
+void a226(void);
+void a227(void);
+void a228(void);
+void a229(void);
+void a230(void);
+void a231(void);
+void a232(void);
+void a18(void);
+void a217(void);
+void a218(void);
+void a219(void);
+void a220(void);
+void a221(void);
+void a222(void);
+void a223(void);
+void a224(void);
+void a17(void);
+void a209(void);
+void a210(void);
+void a211(void);
+void a212(void);
+void a213(void);
+void a214(void);
+void a215(void);
+void a216(void);
+void a1(void);
+void a81(void);
+void a82(void);
+void a83(void);
+void a84(void);
+void a85(void);
+void a86(void);
+void a87(void);
+void a88(void);
+void a695(void);
+void a696(void);
+void a697(void);
+void a700(void);
+void a702(void);
+void a703(void);
+void a16(void);
+void a201(void);
+void a202(void);
+void a203(void);
+void a204(void);
+void a205(void);
+void a206(void);
+void a207(void);
+void a208(void);
+void a699(void);
+void a15(void);
+void a193(void);
+void a194(void);
+void a195(void);
+void a196(void);
+void a197(void);
+void a198(void);
+void a199(void);
+void a200(void);
+void a698(void);
+void a14(void);
+void a185(void);
+void a186(void);
+void a187(void);
+void a188(void);
+void a189(void);
+void a190(void);
+void a191(void);
+void a192(void);
+void a13(void);
+void a177(void);
+void a178(void);
+void a179(void);
+void a180(void);
+void a181(void);
+void a182(void);
+void a183(void);
+void a184(void);
+void a12(void);
+void a169(void);
+void a170(void);
+void a171(void);
+void a172(void);
+void a173(void);
+void a174(void);
+void a175(void);
+void a176(void);
+void a11(void);
+void a161(void);
+void a162(void);
+void a163(void);
+void a164(void);
+void a165(void);
+void a166(void);
+void a167(void);
+void a168(void);
+void a701(void);
+void a10(void);
+void a153(void);
+void a154(void);
+void a155(void);
+void a156(void);
+void a157(void);
+void a158(void);
+void a159(void);
+void a160(void);
+void a9(void);
+void a145(void);
+void a146(void);
+void a147(void);
+void a148(void);
+void a149(void);
+void a150(void);
+void a151(void);
+void a152(void);
+enum {
+  EV_5,
+  EV_2,
+  EV_7,
+  EV_6,
+  EV_4,
+  EV_0,
+  EV_3,
+  EV_1,
+};
+#define test_gen_input_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(73, 385)
+#define test_gen_input_NO_OF_TIMERS 0
+#define test_gen_input_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 709, 385, 8)
+#define test_gen_input_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(385)
+struct ufsm_machine * get_test_gen_input(void);
+#endif
@@ -0,0 +1,1504 @@
+/* Generated by ufsmgen */
+
+#include <ufsm.h>
+#include "test_gen_input.h"
+
+static uint32_t ufsmgen_calls = 0;
+
+static bool ufsmgen_guard(void)
+{
+    return (++ufsmgen_calls % 3) != 0;
+}
+
+bool g0(void) { return ufsmgen_guard(); }
+bool g1(void) { return ufsmgen_guard(); }
+bool g2(void) { return ufsmgen_guard(); }
+bool g3(void) { return ufsmgen_guard(); }
+bool g4(void) { return ufsmgen_guard(); }
+bool g5(void) { return ufsmgen_guard(); }
+bool g6(void) { return ufsmgen_guard(); }
+bool g7(void) { return ufsmgen_guard(); }
+bool g8(void) { return ufsmgen_guard(); }
+bool g9(void) { return ufsmgen_guard(); }
+bool g10(void) { return ufsmgen_guard(); }
+bool g11(void) { return ufsmgen_guard(); }
+bool g12(void) { return ufsmgen_guard(); }
+bool g13(void) { return ufsmgen_guard(); }
+bool g14(void) { return ufsmgen_guard(); }
+bool g15(void) { return ufsmgen_guard(); }
+bool g16(void) { return ufsmgen_guard(); }
+bool g17(void) { return ufsmgen_guard(); }
+bool g18(void) { return ufsmgen_guard(); }
+bool g19(void) { return ufsmgen_guard(); }
+bool g20(void) { return ufsmgen_guard(); }
+bool g21(void) { return ufsmgen_guard(); }
+bool g22(void) { return ufsmgen_guard(); }
+bool g23(void) { return ufsmgen_guard(); }
+bool g24(void) { return ufsmgen_guard(); }
+bool g25(void) { return ufsmgen_guard(); }
+bool g26(void) { return ufsmgen_guard(); }
+bool g27(void) { return ufsmgen_guard(); }
+bool g28(void) { return ufsmgen_guard(); }
+bool g29(void) { return ufsmgen_guard(); }
+bool g30(void) { return ufsmgen_guard(); }
+bool g31(void) { return ufsmgen_guard(); }
+bool g32(void) { return ufsmgen_guard(); }
+bool g33(void) { return ufsmgen_guard(); }
+bool g34(void) { return ufsmgen_guard(); }
+bool g35(void) { return ufsmgen_guard(); }
+bool g36(void) { return ufsmgen_guard(); }
+bool g37(void) { return ufsmgen_guard(); }
+bool g38(void) { return ufsmgen_guard(); }
+bool g39(void) { return ufsmgen_guard(); }
+bool g40(void) { return ufsmgen_guard(); }
+bool g41(void) { return ufsmgen_guard(); }
+bool g42(void) { return ufsmgen_guard(); }
+bool g43(void) { return ufsmgen_guard(); }
+bool g44(void) { return ufsmgen_guard(); }
+bool g45(void) { return ufsmgen_guard(); }
+bool g46(void) { return ufsmgen_guard(); }
+bool g47(void) { return ufsmgen_guard(); }
+bool g48(void) { return ufsmgen_guard(); }
+bool g49(void) { return ufsmgen_guard(); }
+bool g50(void) { return ufsmgen_guard(); }
+bool g51(void) { return ufsmgen_guard(); }
+bool g52(void) { return ufsmgen_guard(); }
+bool g53(void) { return ufsmgen_guard(); }
+bool g54(void) { return ufsmgen_guard(); }
+bool g55(void) { return ufsmgen_guard(); }
+bool g56(void) { return ufsmgen_guard(); }
+bool g57(void) { return ufsmgen_guard(); }
+bool g58(void) { return ufsmgen_guard(); }
+bool g59(void) { return ufsmgen_guard(); }
+bool g60(void) { return ufsmgen_guard(); }
+bool g61(void) { return ufsmgen_guard(); }
+bool g62(void) { return ufsmgen_guard(); }
+bool g63(void) { return ufsmgen_guard(); }
+bool g64(void) { return ufsmgen_guard(); }
+bool g65(void) { return ufsmgen_guard(); }
+bool g66(void) { return ufsmgen_guard(); }
+bool g67(void) { return ufsmgen_guard(); }
+bool g68(void) { return ufsmgen_guard(); }
+bool g69(void) { return ufsmgen_guard(); }
+bool g70(void) { return ufsmgen_guard(); }
+bool g71(void) { return ufsmgen_guard(); }
+bool g72(void) { return ufsmgen_guard(); }
+bool g73(void) { return ufsmgen_guard(); }
+bool g74(void) { return ufsmgen_guard(); }
+bool g75(void) { return ufsmgen_guard(); }
+bool g76(void) { return ufsmgen_guard(); }
+bool g77(void) { return ufsmgen_guard(); }
+bool g78(void) { return ufsmgen_guard(); }
+bool g79(void) { return ufsmgen_guard(); }
+bool g80(void) { return ufsmgen_guard(); }
+bool g81(void) { return ufsmgen_guard(); }
+bool g82(void) { return ufsmgen_guard(); }
+bool g83(void) { return ufsmgen_guard(); }
+bool g84(void) { return ufsmgen_guard(); }
+bool g85(void) { return ufsmgen_guard(); }
+bool g86(void) { return ufsmgen_guard(); }
+bool g87(void) { return ufsmgen_guard(); }
+bool g88(void) { return ufsmgen_guard(); }
+bool g89(void) { return ufsmgen_guard(); }
+bool g90(void) { return ufsmgen_guard(); }
+bool g91(void) { return ufsmgen_guard(); }
+bool g92(void) { return ufsmgen_guard(); }
+bool g93(void) { return ufsmgen_guard(); }
+bool g94(void) { return ufsmgen_guard(); }
+bool g95(void) { return ufsmgen_guard(); }
+bool g96(void) { return ufsmgen_guard(); }
+bool g97(void) { return ufsmgen_guard(); }
+bool g98(void) { return ufsmgen_guard(); }
+bool g99(void) { return ufsmgen_guard(); }
+bool g100(void) { return ufsmgen_guard(); }
+bool g101(void) { return ufsmgen_guard(); }
+bool g102(void) { return ufsmgen_guard(); }
+bool g103(void) { return ufsmgen_guard(); }
+bool g104(void) { return ufsmgen_guard(); }
+bool g105(void) { return ufsmgen_guard(); }
+bool g106(void) { return ufsmgen_guard(); }
+bool g107(void) { return ufsmgen_guard(); }
+bool g108(void) { return ufsmgen_guard(); }
+bool g109(void) { return ufsmgen_guard(); }
+bool g110(void) { return ufsmgen_guard(); }
+bool g111(void) { return ufsmgen_guard(); }
+bool g112(void) { return ufsmgen_guard(); }
+bool g113(void) { return ufsmgen_guard(); }
+bool g114(void) { return ufsmgen_guard(); }
+bool g115(void) { return ufsmgen_guard(); }
+bool g116(void) { return ufsmgen_guard(); }
+bool g117(void) { return ufsmgen_guard(); }
+bool g118(void) { return ufsmgen_guard(); }
+bool g119(void) { return ufsmgen_guard(); }
+bool g120(void) { return ufsmgen_guard(); }
+bool g121(void) { return ufsmgen_guard(); }
+bool g122(void) { return ufsmgen_guard(); }
+bool g123(void) { return ufsmgen_guard(); }
+bool g124(void) { return ufsmgen_guard(); }
+bool g125(void) { return ufsmgen_guard(); }
+bool g126(void) { return ufsmgen_guard(); }
+bool g127(void) { return ufsmgen_guard(); }
+bool g128(void) { return ufsmgen_guard(); }
+bool g129(void) { return ufsmgen_guard(); }
+bool g130(void) { return ufsmgen_guard(); }
+bool g131(void) { return ufsmgen_guard(); }
+bool g132(void) { return ufsmgen_guard(); }
+bool g133(void) { return ufsmgen_guard(); }
+bool g134(void) { return ufsmgen_guard(); }
+bool g135(void) { return ufsmgen_guard(); }
+bool g136(void) { return ufsmgen_guard(); }
+bool g137(void) { return ufsmgen_guard(); }
+bool g138(void) { return ufsmgen_guard(); }
+bool g139(void) { return ufsmgen_guard(); }
+bool g140(void) { return ufsmgen_guard(); }
+bool g141(void) { return ufsmgen_guard(); }
+bool g142(void) { return ufsmgen_guard(); }
+bool g143(void) { return ufsmgen_guard(); }
+bool g144(void) { return ufsmgen_guard(); }
+bool g145(void) { return ufsmgen_guard(); }
+bool g146(void) { return ufsmgen_guard(); }
+bool g147(void) { return ufsmgen_guard(); }
+bool g148(void) { return ufsmgen_guard(); }
+bool g149(void) { return ufsmgen_guard(); }
+bool g150(void) { return ufsmgen_guard(); }
+bool g151(void) { return ufsmgen_guard(); }
+bool g152(void) { return ufsmgen_guard(); }
+bool g153(void) { return ufsmgen_guard(); }
+bool g154(void) { return ufsmgen_guard(); }
+bool g155(void) { return ufsmgen_guard(); }
+bool g156(void) { return ufsmgen_guard(); }
+bool g157(void) { return ufsmgen_guard(); }
+bool g158(void) { return ufsmgen_guard(); }
+bool g159(void) { return ufsmgen_guard(); }
+bool g160(void) { return ufsmgen_guard(); }
+bool g161(void) { return ufsmgen_guard(); }
+bool g162(void) { return ufsmgen_guard(); }
+bool g163(void) { return ufsmgen_guard(); }
+bool g164(void) { return ufsmgen_guard(); }
+bool g165(void) { return ufsmgen_guard(); }
+bool g166(void) { return ufsmgen_guard(); }
+bool g167(void) { return ufsmgen_guard(); }
+bool g168(void) { return ufsmgen_guard(); }
+bool g169(void) { return ufsmgen_guard(); }
+bool g170(void) { return ufsmgen_guard(); }
+bool g171(void) { return ufsmgen_guard(); }
+bool g172(void) { return ufsmgen_guard(); }
+bool g173(void) { return ufsmgen_guard(); }
+bool g174(void) { return ufsmgen_guard(); }
+bool g175(void) { return ufsmgen_guard(); }
+bool g176(void) { return ufsmgen_guard(); }
+bool g177(void) { return ufsmgen_guard(); }
+bool g178(void) { return ufsmgen_guard(); }
+bool g179(void) { return ufsmgen_guard(); }
+bool g180(void) { return ufsmgen_guard(); }
+bool g181(void) { return ufsmgen_guard(); }
+bool g182(void) { return ufsmgen_guard(); }
+bool g183(void) { return ufsmgen_guard(); }
+bool g184(void) { return ufsmgen_guard(); }
+bool g185(void) { return ufsmgen_guard(); }
+bool g186(void) { return ufsmgen_guard(); }
+bool g187(void) { return ufsmgen_guard(); }
+bool g188(void) { return ufsmgen_guard(); }
+bool g189(void) { return ufsmgen_guard(); }
+bool g190(void) { return ufsmgen_guard(); }
+bool g191(void) { return ufsmgen_guard(); }
+bool g192(void) { return ufsmgen_guard(); }
+bool g193(void) { return ufsmgen_guard(); }
+void a0(void) { ufsmgen_calls++; }
+void a1(void) { ufsmgen_calls++; }
+void a2(void) { ufsmgen_calls++; }
+void a3(void) { ufsmgen_calls++; }
+void a4(void) { ufsmgen_calls++; }
+void a5(void) { ufsmgen_calls++; }
+void a6(void) { ufsmgen_calls++; }
+void a7(void) { ufsmgen_calls++; }
+void a8(void) { ufsmgen_calls++; }
+void a9(void) { ufsmgen_calls++; }
+void a10(void) { ufsmgen_calls++; }
+void a11(void) { ufsmgen_calls++; }
+void a12(void) { ufsmgen_calls++; }
+void a13(void) { ufsmgen_calls++; }
+void a14(void) { ufsmgen_calls++; }
+void a15(void) { ufsmgen_calls++; }
+void a16(void) { ufsmgen_calls++; }
+void a17(void) { ufsmgen_calls++; }
+void a18(void) { ufsmgen_calls++; }
+void a19(void) { ufsmgen_calls++; }
+void a20(void) { ufsmgen_calls++; }
+void a21(void) { ufsmgen_calls++; }
+void a22(void) { ufsmgen_calls++; }
+void a23(void) { ufsmgen_calls++; }
+void a24(void) { ufsmgen_calls++; }
+void a25(void) { ufsmgen_calls++; }
+void a26(void) { ufsmgen_calls++; }
+void a27(void) { ufsmgen_calls++; }
+void a28(void) { ufsmgen_calls++; }
+void a29(void) { ufsmgen_calls++; }
+void a30(void) { ufsmgen_calls++; }
+void a31(void) { ufsmgen_calls++; }
+void a32(void) { ufsmgen_calls++; }
+void a33(void) { ufsmgen_calls++; }
+void a34(void) { ufsmgen_calls++; }
+void a35(void) { ufsmgen_calls++; }
+void a36(void) { ufsmgen_calls++; }
+void a37(void) { ufsmgen_calls++; }
+void a38(void) { ufsmgen_calls++; }
+void a39(void) { ufsmgen_calls++; }
+void a40(void) { ufsmgen_calls++; }
+void a41(void) { ufsmgen_calls++; }
+void a42(void) { ufsmgen_calls++; }
+void a43(void) { ufsmgen_calls++; }
+void a44(void) { ufsmgen_calls++; }
+void a45(void) { ufsmgen_calls++; }
+void a46(void) { ufsmgen_calls++; }
+void a47(void) { ufsmgen_calls++; }
+void a48(void) { ufsmgen_calls++; }
+void a49(void) { ufsmgen_calls++; }
+void a50(void) { ufsmgen_calls++; }
+void a51(void) { ufsmgen_calls++; }
+void a52(void) { ufsmgen_calls++; }
+void a53(void) { ufsmgen_calls++; }
+void a54(void) { ufsmgen_calls++; }
+void a55(void) { ufsmgen_calls++; }
+void a56(void) { ufsmgen_calls++; }
+void a57(void) { ufsmgen_calls++; }
+void a58(void) { ufsmgen_calls++; }
+void a59(void) { ufsmgen_calls++; }
+void a60(void) { ufsmgen_calls++; }
+void a61(void) { ufsmgen_calls++; }
+void a62(void) { ufsmgen_calls++; }
+void a63(void) { ufsmgen_calls++; }
+void a64(void) { ufsmgen_calls++; }
+void a65(void) { ufsmgen_calls++; }
+void a66(void) { ufsmgen_calls++; }
+void a67(void) { ufsmgen_calls++; }
+void a68(void) { ufsmgen_calls++; }
+void a69(void) { ufsmgen_calls++; }
+void a70(void) { ufsmgen_calls++; }
+void a71(void) { ufsmgen_calls++; }
+void a72(void) { ufsmgen_calls++; }
+void a73(void) { ufsmgen_calls++; }
+void a74(void) { ufsmgen_calls++; }
+void a75(void) { ufsmgen_calls++; }
+void a76(void) { ufsmgen_calls++; }
+void a77(void) { ufsmgen_calls++; }
+void a78(void) { ufsmgen_calls++; }
+void a79(void) { ufsmgen_calls++; }
+void a80(void) { ufsmgen_calls++; }
+void a81(void) { ufsmgen_calls++; }
+void a82(void) { ufsmgen_calls++; }
+void a83(void) { ufsmgen_calls++; }
+void a84(void) { ufsmgen_calls++; }
+void a85(void) { ufsmgen_calls++; }
+void a86(void) { ufsmgen_calls++; }
+void a87(void) { ufsmgen_calls++; }
+void a88(void) { ufsmgen_calls++; }
+void a89(void) { ufsmgen_calls++; }
+void a90(void) { ufsmgen_calls++; }
+void a91(void) { ufsmgen_calls++; }
+void a92(void) { ufsmgen_calls++; }
+void a93(void) { ufsmgen_calls++; }
+void a94(void) { ufsmgen_calls++; }
+void a95(void) { ufsmgen_calls++; }
+void a96(void) { ufsmgen_calls++; }
+void a97(void) { ufsmgen_calls++; }
+void a98(void) { ufsmgen_calls++; }
+void a99(void) { ufsmgen_calls++; }
+void a100(void) { ufsmgen_calls++; }
+void a101(void) { ufsmgen_calls++; }
+void a102(void) { ufsmgen_calls++; }
+void a103(void) { ufsmgen_calls++; }
+void a104(void) { ufsmgen_calls++; }
+void a105(void) { ufsmgen_calls++; }
+void a106(void) { ufsmgen_calls++; }
+void a107(void) { ufsmgen_calls++; }
+void a108(void) { ufsmgen_calls++; }
+void a109(void) { ufsmgen_calls++; }
+void a110(void) { ufsmgen_calls++; }
+void a111(void) { ufsmgen_calls++; }
+void a112(void) { ufsmgen_calls++; }
+void a113(void) { ufsmgen_calls++; }
+void a114(void) { ufsmgen_calls++; }
+void a115(void) { ufsmgen_calls++; }
+void a116(void) { ufsmgen_calls++; }
+void a117(void) { ufsmgen_calls++; }
+void a118(void) { ufsmgen_calls++; }
+void a119(void) { ufsmgen_calls++; }
+void a120(void) { ufsmgen_calls++; }
+void a121(void) { ufsmgen_calls++; }
+void a122(void) { ufsmgen_calls++; }
+void a123(void) { ufsmgen_calls++; }
+void a124(void) { ufsmgen_calls++; }
+void a125(void) { ufsmgen_calls++; }
+void a126(void) { ufsmgen_calls++; }
+void a127(void) { ufsmgen_calls++; }
+void a128(void) { ufsmgen_calls++; }
+void a129(void) { ufsmgen_calls++; }
+void a130(void) { ufsmgen_calls++; }
+void a131(void) { ufsmgen_calls++; }
+void a132(void) { ufsmgen_calls++; }
+void a133(void) { ufsmgen_calls++; }
+void a134(void) { ufsmgen_calls++; }
+void a135(void) { ufsmgen_calls++; }
+void a136(void) { ufsmgen_calls++; }
+void a137(void) { ufsmgen_calls++; }
+void a138(void) { ufsmgen_calls++; }
+void a139(void) { ufsmgen_calls++; }
+void a140(void) { ufsmgen_calls++; }
+void a141(void) { ufsmgen_calls++; }
+void a142(void) { ufsmgen_calls++; }
+void a143(void) { ufsmgen_calls++; }
+void a144(void) { ufsmgen_calls++; }
+void a145(void) { ufsmgen_calls++; }
+void a146(void) { ufsmgen_calls++; }
+void a147(void) { ufsmgen_calls++; }
+void a148(void) { ufsmgen_calls++; }
+void a149(void) { ufsmgen_calls++; }
+void a150(void) { ufsmgen_calls++; }
+void a151(void) { ufsmgen_calls++; }
+void a152(void) { ufsmgen_calls++; }
+void a153(void) { ufsmgen_calls++; }
+void a154(void) { ufsmgen_calls++; }
+void a155(void) { ufsmgen_calls++; }
+void a156(void) { ufsmgen_calls++; }
+void a157(void) { ufsmgen_calls++; }
+void a158(void) { ufsmgen_calls++; }
+void a159(void) { ufsmgen_calls++; }
+void a160(void) { ufsmgen_calls++; }
+void a161(void) { ufsmgen_calls++; }
+void a162(void) { ufsmgen_calls++; }
+void a163(void) { ufsmgen_calls++; }
+void a164(void) { ufsmgen_calls++; }
+void a165(void) { ufsmgen_calls++; }
+void a166(void) { ufsmgen_calls++; }
+void a167(void) { ufsmgen_calls++; }
+void a168(void) { ufsmgen_calls++; }
+void a169(void) { ufsmgen_calls++; }
+void a170(void) { ufsmgen_calls++; }
+void a171(void) { ufsmgen_calls++; }
+void a172(void) { ufsmgen_calls++; }
+void a173(void) { ufsmgen_calls++; }
+void a174(void) { ufsmgen_calls++; }
+void a175(void) { ufsmgen_calls++; }
+void a176(void) { ufsmgen_calls++; }
+void a177(void) { ufsmgen_calls++; }
+void a178(void) { ufsmgen_calls++; }
+void a179(void) { ufsmgen_calls++; }
+void a180(void) { ufsmgen_calls++; }
+void a181(void) { ufsmgen_calls++; }
+void a182(void) { ufsmgen_calls++; }
+void a183(void) { ufsmgen_calls++; }
+void a184(void) { ufsmgen_calls++; }
+void a185(void) { ufsmgen_calls++; }
+void a186(void) { ufsmgen_calls++; }
+void a187(void) { ufsmgen_calls++; }
+void a188(void) { ufsmgen_calls++; }
+void a189(void) { ufsmgen_calls++; }
+void a190(void) { ufsmgen_calls++; }
+void a191(void) { ufsmgen_calls++; }
+void a192(void) { ufsmgen_calls++; }
+void a193(void) { ufsmgen_calls++; }
+void a194(void) { ufsmgen_calls++; }
+void a195(void) { ufsmgen_calls++; }
+void a196(void) { ufsmgen_calls++; }
+void a197(void) { ufsmgen_calls++; }
+void a198(void) { ufsmgen_calls++; }
+void a199(void) { ufsmgen_calls++; }
+void a200(void) { ufsmgen_calls++; }
+void a201(void) { ufsmgen_calls++; }
+void a202(void) { ufsmgen_calls++; }
+void a203(void) { ufsmgen_calls++; }
+void a204(void) { ufsmgen_calls++; }
+void a205(void) { ufsmgen_calls++; }
+void a206(void) { ufsmgen_calls++; }
+void a207(void) { ufsmgen_calls++; }
+void a208(void) { ufsmgen_calls++; }
+void a209(void) { ufsmgen_calls++; }
+void a210(void) { ufsmgen_calls++; }
+void a211(void) { ufsmgen_calls++; }
+void a212(void) { ufsmgen_calls++; }
+void a213(void) { ufsmgen_calls++; }
+void a214(void) { ufsmgen_calls++; }
+void a215(void) { ufsmgen_calls++; }
+void a216(void) { ufsmgen_calls++; }
+void a217(void) { ufsmgen_calls++; }
+void a218(void) { ufsmgen_calls++; }
+void a219(void) { ufsmgen_calls++; }
+void a220(void) { ufsmgen_calls++; }
+void a221(void) { ufsmgen_calls++; }
+void a222(void) { ufsmgen_calls++; }
+void a223(void) { ufsmgen_calls++; }
+void a224(void) { ufsmgen_calls++; }
+void a225(void) { ufsmgen_calls++; }
+void a226(void) { ufsmgen_calls++; }
+void a227(void) { ufsmgen_calls++; }
+void a228(void) { ufsmgen_calls++; }
+void a229(void) { ufsmgen_calls++; }
+void a230(void) { ufsmgen_calls++; }
+void a231(void) { ufsmgen_calls++; }
+void a232(void) { ufsmgen_calls++; }
+void a233(void) { ufsmgen_calls++; }
+void a234(void) { ufsmgen_calls++; }
+void a235(void) { ufsmgen_calls++; }
+void a236(void) { ufsmgen_calls++; }
+void a237(void) { ufsmgen_calls++; }
+void a238(void) { ufsmgen_calls++; }
+void a239(void) { ufsmgen_calls++; }
+void a240(void) { ufsmgen_calls++; }
+void a241(void) { ufsmgen_calls++; }
+void a242(void) { ufsmgen_calls++; }
+void a243(void) { ufsmgen_calls++; }
+void a244(void) { ufsmgen_calls++; }
+void a245(void) { ufsmgen_calls++; }
+void a246(void) { ufsmgen_calls++; }
+void a247(void) { ufsmgen_calls++; }
+void a248(void) { ufsmgen_calls++; }
+void a249(void) { ufsmgen_calls++; }
+void a250(void) { ufsmgen_calls++; }
+void a251(void) { ufsmgen_calls++; }
+void a252(void) { ufsmgen_calls++; }
+void a253(void) { ufsmgen_calls++; }
+void a254(void) { ufsmgen_calls++; }
+void a255(void) { ufsmgen_calls++; }
+void a256(void) { ufsmgen_calls++; }
+void a257(void) { ufsmgen_calls++; }
+void a258(void) { ufsmgen_calls++; }
+void a259(void) { ufsmgen_calls++; }
+void a260(void) { ufsmgen_calls++; }
+void a261(void) { ufsmgen_calls++; }
+void a262(void) { ufsmgen_calls++; }
+void a263(void) { ufsmgen_calls++; }
+void a264(void) { ufsmgen_calls++; }
+void a265(void) { ufsmgen_calls++; }
+void a266(void) { ufsmgen_calls++; }
+void a267(void) { ufsmgen_calls++; }
+void a268(void) { ufsmgen_calls++; }
+void a269(void) { ufsmgen_calls++; }
+void a270(void) { ufsmgen_calls++; }
+void a271(void) { ufsmgen_calls++; }
+void a272(void) { ufsmgen_calls++; }
+void a273(void) { ufsmgen_calls++; }
+void a274(void) { ufsmgen_calls++; }
+void a275(void) { ufsmgen_calls++; }
+void a276(void) { ufsmgen_calls++; }
+void a277(void) { ufsmgen_calls++; }
+void a278(void) { ufsmgen_calls++; }
+void a279(void) { ufsmgen_calls++; }
+void a280(void) { ufsmgen_calls++; }
+void a281(void) { ufsmgen_calls++; }
+void a282(void) { ufsmgen_calls++; }
+void a283(void) { ufsmgen_calls++; }
+void a284(void) { ufsmgen_calls++; }
+void a285(void) { ufsmgen_calls++; }
+void a286(void) { ufsmgen_calls++; }
+void a287(void) { ufsmgen_calls++; }
+void a288(void) { ufsmgen_calls++; }
+void a289(void) { ufsmgen_calls++; }
+void a290(void) { ufsmgen_calls++; }
+void a291(void) { ufsmgen_calls++; }
+void a292(void) { ufsmgen_calls++; }
+void a293(void) { ufsmgen_calls++; }
+void a294(void) { ufsmgen_calls++; }
+void a295(void) { ufsmgen_calls++; }
+void a296(void) { ufsmgen_calls++; }
+void a297(void) { ufsmgen_calls++; }
+void a298(void) { ufsmgen_calls++; }
+void a299(void) { ufsmgen_calls++; }
+void a300(void) { ufsmgen_calls++; }
+void a301(void) { ufsmgen_calls++; }
+void a302(void) { ufsmgen_calls++; }
+void a303(void) { ufsmgen_calls++; }
+void a304(void) { ufsmgen_calls++; }
+void a305(void) { ufsmgen_calls++; }
+void a306(void) { ufsmgen_calls++; }
+void a307(void) { ufsmgen_calls++; }
+void a308(void) { ufsmgen_calls++; }
+void a309(void) { ufsmgen_calls++; }
+void a310(void) { ufsmgen_calls++; }
+void a311(void) { ufsmgen_calls++; }
+void a312(void) { ufsmgen_calls++; }
+void a313(void) { ufsmgen_calls++; }
+void a314(void) { ufsmgen_calls++; }
+void a315(void) { ufsmgen_calls++; }
+void a316(void) { ufsmgen_calls++; }
+void a317(void) { ufsmgen_calls++; }
+void a318(void) { ufsmgen_calls++; }
+void a319(void) { ufsmgen_calls++; }
+void a320(void) { ufsmgen_calls++; }
+void a321(void) { ufsmgen_calls++; }
+void a322(void) { ufsmgen_calls++; }
+void a323(void) { ufsmgen_calls++; }
+void a324(void) { ufsmgen_calls++; }
+void a325(void) { ufsmgen_calls++; }
+void a326(void) { ufsmgen_calls++; }
+void a327(void) { ufsmgen_calls++; }
+void a328(void) { ufsmgen_calls++; }
+void a329(void) { ufsmgen_calls++; }
+void a330(void) { ufsmgen_calls++; }
+void a331(void) { ufsmgen_calls++; }
+void a332(void) { ufsmgen_calls++; }
+void a333(void) { ufsmgen_calls++; }
+void a334(void) { ufsmgen_calls++; }
+void a335(void) { ufsmgen_calls++; }
+void a336(void) { ufsmgen_calls++; }
+void a337(void) { ufsmgen_calls++; }
+void a338(void) { ufsmgen_calls++; }
+void a339(void) { ufsmgen_calls++; }
+void a340(void) { ufsmgen_calls++; }
+void a341(void) { ufsmgen_calls++; }
+void a342(void) { ufsmgen_calls++; }
+void a343(void) { ufsmgen_calls++; }
+void a344(void) { ufsmgen_calls++; }
+void a345(void) { ufsmgen_calls++; }
+void a346(void) { ufsmgen_calls++; }
+void a347(void) { ufsmgen_calls++; }
+void a348(void) { ufsmgen_calls++; }
+void a349(void) { ufsmgen_calls++; }
+void a350(void) { ufsmgen_calls++; }
+void a351(void) { ufsmgen_calls++; }
+void a352(void) { ufsmgen_calls++; }
+void a353(void) { ufsmgen_calls++; }
+void a354(void) { ufsmgen_calls++; }
+void a355(void) { ufsmgen_calls++; }
+void a356(void) { ufsmgen_calls++; }
+void a357(void) { ufsmgen_calls++; }
+void a358(void) { ufsmgen_calls++; }
+void a359(void) { ufsmgen_calls++; }
+void a360(void) { ufsmgen_calls++; }
+void a361(void) { ufsmgen_calls++; }
+void a362(void) { ufsmgen_calls++; }
+void a363(void) { ufsmgen_calls++; }
+void a364(void) { ufsmgen_calls++; }
+void a365(void) { ufsmgen_calls++; }
+void a366(void) { ufsmgen_calls++; }
+void a367(void) { ufsmgen_calls++; }
+void a368(void) { ufsmgen_calls++; }
+void a369(void) { ufsmgen_calls++; }
+void a370(void) { ufsmgen_calls++; }
+void a371(void) { ufsmgen_calls++; }
+void a372(void) { ufsmgen_calls++; }
+void a373(void) { ufsmgen_calls++; }
+void a374(void) { ufsmgen_calls++; }
+void a375(void) { ufsmgen_calls++; }
+void a376(void) { ufsmgen_calls++; }
+void a377(void) { ufsmgen_calls++; }
+void a378(void) { ufsmgen_calls++; }
+void a379(void) { ufsmgen_calls++; }
+void a380(void) { ufsmgen_calls++; }
+void a381(void) { ufsmgen_calls++; }
+void a382(void) { ufsmgen_calls++; }
+void a383(void) { ufsmgen_calls++; }
+void a384(void) { ufsmgen_calls++; }
+void a385(void) { ufsmgen_calls++; }
+void a386(void) { ufsmgen_calls++; }
+void a387(void) { ufsmgen_calls++; }
+void a388(void) { ufsmgen_calls++; }
+void a389(void) { ufsmgen_calls++; }
+void a390(void) { ufsmgen_calls++; }
+void a391(void) { ufsmgen_calls++; }
+void a392(void) { ufsmgen_calls++; }
+void a393(void) { ufsmgen_calls++; }
+void a394(void) { ufsmgen_calls++; }
+void a395(void) { ufsmgen_calls++; }
+void a396(void) { ufsmgen_calls++; }
+void a397(void) { ufsmgen_calls++; }
+void a398(void) { ufsmgen_calls++; }
+void a399(void) { ufsmgen_calls++; }
+void a400(void) { ufsmgen_calls++; }
+void a401(void) { ufsmgen_calls++; }
+void a402(void) { ufsmgen_calls++; }
+void a403(void) { ufsmgen_calls++; }
+void a404(void) { ufsmgen_calls++; }
+void a405(void) { ufsmgen_calls++; }
+void a406(void) { ufsmgen_calls++; }
+void a407(void) { ufsmgen_calls++; }
+void a408(void) { ufsmgen_calls++; }
+void a409(void) { ufsmgen_calls++; }
+void a410(void) { ufsmgen_calls++; }
+void a411(void) { ufsmgen_calls++; }
+void a412(void) { ufsmgen_calls++; }
+void a413(void) { ufsmgen_calls++; }
+void a414(void) { ufsmgen_calls++; }
+void a415(void) { ufsmgen_calls++; }
+void a416(void) { ufsmgen_calls++; }
+void a417(void) { ufsmgen_calls++; }
+void a418(void) { ufsmgen_calls++; }
+void a419(void) { ufsmgen_calls++; }
+void a420(void) { ufsmgen_calls++; }
+void a421(void) { ufsmgen_calls++; }
+void a422(void) { ufsmgen_calls++; }
+void a423(void) { ufsmgen_calls++; }
+void a424(void) { ufsmgen_calls++; }
+void a425(void) { ufsmgen_calls++; }
+void a426(void) { ufsmgen_calls++; }
+void a427(void) { ufsmgen_calls++; }
+void a428(void) { ufsmgen_calls++; }
+void a429(void) { ufsmgen_calls++; }
+void a430(void) { ufsmgen_calls++; }
+void a431(void) { ufsmgen_calls++; }
+void a432(void) { ufsmgen_calls++; }
+void a433(void) { ufsmgen_calls++; }
+void a434(void) { ufsmgen_calls++; }
+void a435(void) { ufsmgen_calls++; }
+void a436(void) { ufsmgen_calls++; }
+void a437(void) { ufsmgen_calls++; }
+void a438(void) { ufsmgen_calls++; }
+void a439(void) { ufsmgen_calls++; }
+void a440(void) { ufsmgen_calls++; }
+void a441(void) { ufsmgen_calls++; }
+void a442(void) { ufsmgen_calls++; }
+void a443(void) { ufsmgen_calls++; }
+void a444(void) { ufsmgen_calls++; }
+void a445(void) { ufsmgen_calls++; }
+void a446(void) { ufsmgen_calls++; }
+void a447(void) { ufsmgen_calls++; }
+void a448(void) { ufsmgen_calls++; }
+void a449(void) { ufsmgen_calls++; }
+void a450(void) { ufsmgen_calls++; }
+void a451(void) { ufsmgen_calls++; }
+void a452(void) { ufsmgen_calls++; }
+void a453(void) { ufsmgen_calls++; }
+void a454(void) { ufsmgen_calls++; }
+void a455(void) { ufsmgen_calls++; }
+void a456(void) { ufsmgen_calls++; }
+void a457(void) { ufsmgen_calls++; }
+void a458(void) { ufsmgen_calls++; }
+void a459(void) { ufsmgen_calls++; }
+void a460(void) { ufsmgen_calls++; }
+void a461(void) { ufsmgen_calls++; }
+void a462(void) { ufsmgen_calls++; }
+void a463(void) { ufsmgen_calls++; }
+void a464(void) { ufsmgen_calls++; }
+void a465(void) { ufsmgen_calls++; }
+void a466(void) { ufsmgen_calls++; }
+void a467(void) { ufsmgen_calls++; }
+void a468(void) { ufsmgen_calls++; }
+void a469(void) { ufsmgen_calls++; }
+void a470(void) { ufsmgen_calls++; }
+void a471(void) { ufsmgen_calls++; }
+void a472(void) { ufsmgen_calls++; }
+void a473(void) { ufsmgen_calls++; }
+void a474(void) { ufsmgen_calls++; }
+void a475(void) { ufsmgen_calls++; }
+void a476(void) { ufsmgen_calls++; }
+void a477(void) { ufsmgen_calls++; }
+void a478(void) { ufsmgen_calls++; }
+void a479(void) { ufsmgen_calls++; }
+void a480(void) { ufsmgen_calls++; }
+void a481(void) { ufsmgen_calls++; }
+void a482(void) { ufsmgen_calls++; }
+void a483(void) { ufsmgen_calls++; }
+void a484(void) { ufsmgen_calls++; }
+void a485(void) { ufsmgen_calls++; }
+void a486(void) { ufsmgen_calls++; }
+void a487(void) { ufsmgen_calls++; }
+void a488(void) { ufsmgen_calls++; }
+void a489(void) { ufsmgen_calls++; }
+void a490(void) { ufsmgen_calls++; }
+void a491(void) { ufsmgen_calls++; }
+void a492(void) { ufsmgen_calls++; }
+void a493(void) { ufsmgen_calls++; }
+void a494(void) { ufsmgen_calls++; }
+void a495(void) { ufsmgen_calls++; }
+void a496(void) { ufsmgen_calls++; }
+void a497(void) { ufsmgen_calls++; }
+void a498(void) { ufsmgen_calls++; }
+void a499(void) { ufsmgen_calls++; }
+void a500(void) { ufsmgen_calls++; }
+void a501(void) { ufsmgen_calls++; }
+void a502(void) { ufsmgen_calls++; }
+void a503(void) { ufsmgen_calls++; }
+void a504(void) { ufsmgen_calls++; }
+void a505(void) { ufsmgen_calls++; }
+void a506(void) { ufsmgen_calls++; }
+void a507(void) { ufsmgen_calls++; }
+void a508(void) { ufsmgen_calls++; }
+void a509(void) { ufsmgen_calls++; }
+void a510(void) { ufsmgen_calls++; }
+void a511(void) { ufsmgen_calls++; }
+void a512(void) { ufsmgen_calls++; }
+void a513(void) { ufsmgen_calls++; }
+void a514(void) { ufsmgen_calls++; }
+void a515(void) { ufsmgen_calls++; }
+void a516(void) { ufsmgen_calls++; }
+void a517(void) { ufsmgen_calls++; }
+void a518(void) { ufsmgen_calls++; }
+void a519(void) { ufsmgen_calls++; }
+void a520(void) { ufsmgen_calls++; }
+void a521(void) { ufsmgen_calls++; }
+void a522(void) { ufsmgen_calls++; }
+void a523(void) { ufsmgen_calls++; }
+void a524(void) { ufsmgen_calls++; }
+void a525(void) { ufsmgen_calls++; }
+void a526(void) { ufsmgen_calls++; }
+void a527(void) { ufsmgen_calls++; }
+void a528(void) { ufsmgen_calls++; }
+void a529(void) { ufsmgen_calls++; }
+void a530(void) { ufsmgen_calls++; }
+void a531(void) { ufsmgen_calls++; }
+void a532(void) { ufsmgen_calls++; }
+void a533(void) { ufsmgen_calls++; }
+void a534(void) { ufsmgen_calls++; }
+void a535(void) { ufsmgen_calls++; }
+void a536(void) { ufsmgen_calls++; }
+void a537(void) { ufsmgen_calls++; }
+void a538(void) { ufsmgen_calls++; }
+void a539(void) { ufsmgen_calls++; }
+void a540(void) { ufsmgen_calls++; }
+void a541(void) { ufsmgen_calls++; }
+void a542(void) { ufsmgen_calls++; }
+void a543(void) { ufsmgen_calls++; }
+void a544(void) { ufsmgen_calls++; }
+void a545(void) { ufsmgen_calls++; }
+void a546(void) { ufsmgen_calls++; }
+void a547(void) { ufsmgen_calls++; }
+void a548(void) { ufsmgen_calls++; }
+void a549(void) { ufsmgen_calls++; }
+void a550(void) { ufsmgen_calls++; }
+void a551(void) { ufsmgen_calls++; }
+void a552(void) { ufsmgen_calls++; }
+void a553(void) { ufsmgen_calls++; }
+void a554(void) { ufsmgen_calls++; }
+void a555(void) { ufsmgen_calls++; }
+void a556(void) { ufsmgen_calls++; }
+void a557(void) { ufsmgen_calls++; }
+void a558(void) { ufsmgen_calls++; }
+void a559(void) { ufsmgen_calls++; }
+void a560(void) { ufsmgen_calls++; }
+void a561(void) { ufsmgen_calls++; }
+void a562(void) { ufsmgen_calls++; }
+void a563(void) { ufsmgen_calls++; }
+void a564(void) { ufsmgen_calls++; }
+void a565(void) { ufsmgen_calls++; }
+void a566(void) { ufsmgen_calls++; }
+void a567(void) { ufsmgen_calls++; }
+void a568(void) { ufsmgen_calls++; }
+void a569(void) { ufsmgen_calls++; }
+void a570(void) { ufsmgen_calls++; }
+void a571(void) { ufsmgen_calls++; }
+void a572(void) { ufsmgen_calls++; }
+void a573(void) { ufsmgen_calls++; }
+void a574(void) { ufsmgen_calls++; }
+void a575(void) { ufsmgen_calls++; }
+void a576(void) { ufsmgen_calls++; }
+void a577(void) { ufsmgen_calls++; }
+void a578(void) { ufsmgen_calls++; }
+void a579(void) { ufsmgen_calls++; }
+void a580(void) { ufsmgen_calls++; }
+void a581(void) { ufsmgen_calls++; }
+void a582(void) { ufsmgen_calls++; }
+void a583(void) { ufsmgen_calls++; }
+void a584(void) { ufsmgen_calls++; }
+void a585(void) { ufsmgen_calls++; }
+void a586(void) { ufsmgen_calls++; }
+void a587(void) { ufsmgen_calls++; }
+void a588(void) { ufsmgen_calls++; }
+void a589(void) { ufsmgen_calls++; }
+void a590(void) { ufsmgen_calls++; }
+void a591(void) { ufsmgen_calls++; }
+void a592(void) { ufsmgen_calls++; }
+void a593(void) { ufsmgen_calls++; }
+void a594(void) { ufsmgen_calls++; }
+void a595(void) { ufsmgen_calls++; }
+void a596(void) { ufsmgen_calls++; }
+void a597(void) { ufsmgen_calls++; }
+void a598(void) { ufsmgen_calls++; }
+void a599(void) { ufsmgen_calls++; }
+void a600(void) { ufsmgen_calls++; }
+void a601(void) { ufsmgen_calls++; }
+void a602(void) { ufsmgen_calls++; }
+void a603(void) { ufsmgen_calls++; }
+void a604(void) { ufsmgen_calls++; }
+void a605(void) { ufsmgen_calls++; }
+void a606(void) { ufsmgen_calls++; }
+void a607(void) { ufsmgen_calls++; }
+void a608(void) { ufsmgen_calls++; }
+void a609(void) { ufsmgen_calls++; }
+void a610(void) { ufsmgen_calls++; }
+void a611(void) { ufsmgen_calls++; }
+void a612(void) { ufsmgen_calls++; }
+void a613(void) { ufsmgen_calls++; }
+void a614(void) { ufsmgen_calls++; }
+void a615(void) { ufsmgen_calls++; }
+void a616(void) { ufsmgen_calls++; }
+void a617(void) { ufsmgen_calls++; }
+void a618(void) { ufsmgen_calls++; }
+void a619(void) { ufsmgen_calls++; }
+void a620(void) { ufsmgen_calls++; }
+void a621(void) { ufsmgen_calls++; }
+void a622(void) { ufsmgen_calls++; }
+void a623(void) { ufsmgen_calls++; }
+void a624(void) { ufsmgen_calls++; }
+void a625(void) { ufsmgen_calls++; }
+void a626(void) { ufsmgen_calls++; }
+void a627(void) { ufsmgen_calls++; }
+void a628(void) { ufsmgen_calls++; }
+void a629(void) { ufsmgen_calls++; }
+void a630(void) { ufsmgen_calls++; }
+void a631(void) { ufsmgen_calls++; }
+void a632(void) { ufsmgen_calls++; }
+void a633(void) { ufsmgen_calls++; }
+void a634(void) { ufsmgen_calls++; }
+void a635(void) { ufsmgen_calls++; }
+void a636(void) { ufsmgen_calls++; }
+void a637(void) { ufsmgen_calls++; }
+void a638(void) { ufsmgen_calls++; }
+void a639(void) { ufsmgen_calls++; }
+void a640(void) { ufsmgen_calls++; }
+void a641(void) { ufsmgen_calls++; }
+void a642(void) { ufsmgen_calls++; }
+void a643(void) { ufsmgen_calls++; }
+void a644(void) { ufsmgen_calls++; }
+void a645(void) { ufsmgen_calls++; }
+void a646(void) { ufsmgen_calls++; }
+void a647(void) { ufsmgen_calls++; }
+void a648(void) { ufsmgen_calls++; }
+void a649(void) { ufsmgen_calls++; }
+void a650(void) { ufsmgen_calls++; }
+void a651(void) { ufsmgen_calls++; }
+void a652(void) { ufsmgen_calls++; }
+void a653(void) { ufsmgen_calls++; }
+void a654(void) { ufsmgen_calls++; }
+void a655(void) { ufsmgen_calls++; }
+void a656(void) { ufsmgen_calls++; }
+void a657(void) { ufsmgen_calls++; }
+void a658(void) { ufsmgen_calls++; }
+void a659(void) { ufsmgen_calls++; }
+void a660(void) { ufsmgen_calls++; }
+void a661(void) { ufsmgen_calls++; }
+void a662(void) { ufsmgen_calls++; }
+void a663(void) { ufsmgen_calls++; }
+void a664(void) { ufsmgen_calls++; }
+void a665(void) { ufsmgen_calls++; }
+void a666(void) { ufsmgen_calls++; }
+void a667(void) { ufsmgen_calls++; }
+void a668(void) { ufsmgen_calls++; }
+void a669(void) { ufsmgen_calls++; }
+void a670(void) { ufsmgen_calls++; }
+void a671(void) { ufsmgen_calls++; }
+void a672(void) { ufsmgen_calls++; }
+void a673(void) { ufsmgen_calls++; }
+void a674(void) { ufsmgen_calls++; }
+void a675(void) { ufsmgen_calls++; }
+void a676(void) { ufsmgen_calls++; }
+void a677(void) { ufsmgen_calls++; }
+void a678(void) { ufsmgen_calls++; }
+void a679(void) { ufsmgen_calls++; }
+void a680(void) { ufsmgen_calls++; }
+void a681(void) { ufsmgen_calls++; }
+void a682(void) { ufsmgen_calls++; }
+void a683(void) { ufsmgen_calls++; }
+void a684(void) { ufsmgen_calls++; }
+void a685(void) { ufsmgen_calls++; }
+void a686(void) { ufsmgen_calls++; }
+void a687(void) { ufsmgen_calls++; }
+void a688(void) { ufsmgen_calls++; }
+void a689(void) { ufsmgen_calls++; }
+void a690(void) { ufsmgen_calls++; }
+void a691(void) { ufsmgen_calls++; }
+void a692(void) { ufsmgen_calls++; }
+void a693(void) { ufsmgen_calls++; }
+void a694(void) { ufsmgen_calls++; }
+void a695(void) { ufsmgen_calls++; }
+void a696(void) { ufsmgen_calls++; }
+void a697(void) { ufsmgen_calls++; }
+void a698(void) { ufsmgen_calls++; }
+void a699(void) { ufsmgen_calls++; }
+void a700(void) { ufsmgen_calls++; }
+void a701(void) { ufsmgen_calls++; }
+void a702(void) { ufsmgen_calls++; }
+void a703(void) { ufsmgen_calls++; }
+void a704(void) { ufsmgen_calls++; }
+void a705(void) { ufsmgen_calls++; }
+void a706(void) { ufsmgen_calls++; }
+void a707(void) { ufsmgen_calls++; }
+void a708(void) { ufsmgen_calls++; }
+void e1(void) { ufsmgen_calls++; }
+void x1(void) { ufsmgen_calls++; }
+void e2(void) { ufsmgen_calls++; }
+void x2(void) { ufsmgen_calls++; }
+void e3(void) { ufsmgen_calls++; }
+void x3(void) { ufsmgen_calls++; }
+void e4(void) { ufsmgen_calls++; }
+void x4(void) { ufsmgen_calls++; }
+void e6(void) { ufsmgen_calls++; }
+void x6(void) { ufsmgen_calls++; }
+void e7(void) { ufsmgen_calls++; }
+void x7(void) { ufsmgen_calls++; }
+void e8(void) { ufsmgen_calls++; }
+void x8(void) { ufsmgen_calls++; }
+void e9(void) { ufsmgen_calls++; }
+void x9(void) { ufsmgen_calls++; }
+void e11(void) { ufsmgen_calls++; }
+void x11(void) { ufsmgen_calls++; }
+void e12(void) { ufsmgen_calls++; }
+void x12(void) { ufsmgen_calls++; }
+void e13(void) { ufsmgen_calls++; }
+void x13(void) { ufsmgen_calls++; }
+void e14(void) { ufsmgen_calls++; }
+void x14(void) { ufsmgen_calls++; }
+void e16(void) { ufsmgen_calls++; }
+void x16(void) { ufsmgen_calls++; }
+void e17(void) { ufsmgen_calls++; }
+void x17(void) { ufsmgen_calls++; }
+void e18(void) { ufsmgen_calls++; }
+void x18(void) { ufsmgen_calls++; }
+void e19(void) { ufsmgen_calls++; }
+void x19(void) { ufsmgen_calls++; }
+void e21(void) { ufsmgen_calls++; }
+void x21(void) { ufsmgen_calls++; }
+void e22(void) { ufsmgen_calls++; }
+void x22(void) { ufsmgen_calls++; }
+void e23(void) { ufsmgen_calls++; }
+void x23(void) { ufsmgen_calls++; }
+void e24(void) { ufsmgen_calls++; }
+void x24(void) { ufsmgen_calls++; }
+void e26(void) { ufsmgen_calls++; }
+void x26(void) { ufsmgen_calls++; }
+void e27(void) { ufsmgen_calls++; }
+void x27(void) { ufsmgen_calls++; }
+void e28(void) { ufsmgen_calls++; }
+void x28(void) { ufsmgen_calls++; }
+void e29(void) { ufsmgen_calls++; }
+void x29(void) { ufsmgen_calls++; }
+void e31(void) { ufsmgen_calls++; }
+void x31(void) { ufsmgen_calls++; }
+void e32(void) { ufsmgen_calls++; }
+void x32(void) { ufsmgen_calls++; }
+void e33(void) { ufsmgen_calls++; }
+void x33(void) { ufsmgen_calls++; }
+void e34(void) { ufsmgen_calls++; }
+void x34(void) { ufsmgen_calls++; }
+void e36(void) { ufsmgen_calls++; }
+void x36(void) { ufsmgen_calls++; }
+void e37(void) { ufsmgen_calls++; }
+void x37(void) { ufsmgen_calls++; }
+void e38(void) { ufsmgen_calls++; }
+void x38(void) { ufsmgen_calls++; }
+void e39(void) { ufsmgen_calls++; }
+void x39(void) { ufsmgen_calls++; }
+void e41(void) { ufsmgen_calls++; }
+void x41(void) { ufsmgen_calls++; }
+void e42(void) { ufsmgen_calls++; }
+void x42(void) { ufsmgen_calls++; }
+void e43(void) { ufsmgen_calls++; }
+void x43(void) { ufsmgen_calls++; }
+void e44(void) { ufsmgen_calls++; }
+void x44(void) { ufsmgen_calls++; }
+void e46(void) { ufsmgen_calls++; }
+void x46(void) { ufsmgen_calls++; }
+void e47(void) { ufsmgen_calls++; }
+void x47(void) { ufsmgen_calls++; }
+void e48(void) { ufsmgen_calls++; }
+void x48(void) { ufsmgen_calls++; }
+void e49(void) { ufsmgen_calls++; }
+void x49(void) { ufsmgen_calls++; }
+void e51(void) { ufsmgen_calls++; }
+void x51(void) { ufsmgen_calls++; }
+void e52(void) { ufsmgen_calls++; }
+void x52(void) { ufsmgen_calls++; }
+void e53(void) { ufsmgen_calls++; }
+void x53(void) { ufsmgen_calls++; }
+void e54(void) { ufsmgen_calls++; }
+void x54(void) { ufsmgen_calls++; }
+void e56(void) { ufsmgen_calls++; }
+void x56(void) { ufsmgen_calls++; }
+void e57(void) { ufsmgen_calls++; }
+void x57(void) { ufsmgen_calls++; }
+void e58(void) { ufsmgen_calls++; }
+void x58(void) { ufsmgen_calls++; }
+void e59(void) { ufsmgen_calls++; }
+void x59(void) { ufsmgen_calls++; }
+void e61(void) { ufsmgen_calls++; }
+void x61(void) { ufsmgen_calls++; }
+void e62(void) { ufsmgen_calls++; }
+void x62(void) { ufsmgen_calls++; }
+void e63(void) { ufsmgen_calls++; }
+void x63(void) { ufsmgen_calls++; }
+void e64(void) { ufsmgen_calls++; }
+void x64(void) { ufsmgen_calls++; }
+void e66(void) { ufsmgen_calls++; }
+void x66(void) { ufsmgen_calls++; }
+void e67(void) { ufsmgen_calls++; }
+void x67(void) { ufsmgen_calls++; }
+void e68(void) { ufsmgen_calls++; }
+void x68(void) { ufsmgen_calls++; }
+void e69(void) { ufsmgen_calls++; }
+void x69(void) { ufsmgen_calls++; }
+void e71(void) { ufsmgen_calls++; }
+void x71(void) { ufsmgen_calls++; }
+void e72(void) { ufsmgen_calls++; }
+void x72(void) { ufsmgen_calls++; }
+void e73(void) { ufsmgen_calls++; }
+void x73(void) { ufsmgen_calls++; }
+void e74(void) { ufsmgen_calls++; }
+void x74(void) { ufsmgen_calls++; }
+void e76(void) { ufsmgen_calls++; }
+void x76(void) { ufsmgen_calls++; }
+void e77(void) { ufsmgen_calls++; }
+void x77(void) { ufsmgen_calls++; }
+void e78(void) { ufsmgen_calls++; }
+void x78(void) { ufsmgen_calls++; }
+void e79(void) { ufsmgen_calls++; }
+void x79(void) { ufsmgen_calls++; }
+void e81(void) { ufsmgen_calls++; }
+void x81(void) { ufsmgen_calls++; }
+void e82(void) { ufsmgen_calls++; }
+void x82(void) { ufsmgen_calls++; }
+void e83(void) { ufsmgen_calls++; }
+void x83(void) { ufsmgen_calls++; }
+void e84(void) { ufsmgen_calls++; }
+void x84(void) { ufsmgen_calls++; }
+void e86(void) { ufsmgen_calls++; }
+void x86(void) { ufsmgen_calls++; }
+void e87(void) { ufsmgen_calls++; }
+void x87(void) { ufsmgen_calls++; }
+void e88(void) { ufsmgen_calls++; }
+void x88(void) { ufsmgen_calls++; }
+void e89(void) { ufsmgen_calls++; }
+void x89(void) { ufsmgen_calls++; }
+void e91(void) { ufsmgen_calls++; }
+void x91(void) { ufsmgen_calls++; }
+void e92(void) { ufsmgen_calls++; }
+void x92(void) { ufsmgen_calls++; }
+void e93(void) { ufsmgen_calls++; }
+void x93(void) { ufsmgen_calls++; }
+void e94(void) { ufsmgen_calls++; }
+void x94(void) { ufsmgen_calls++; }
+void e96(void) { ufsmgen_calls++; }
+void x96(void) { ufsmgen_calls++; }
+void e97(void) { ufsmgen_calls++; }
+void x97(void) { ufsmgen_calls++; }
+void e98(void) { ufsmgen_calls++; }
+void x98(void) { ufsmgen_calls++; }
+void e99(void) { ufsmgen_calls++; }
+void x99(void) { ufsmgen_calls++; }
+void e101(void) { ufsmgen_calls++; }
+void x101(void) { ufsmgen_calls++; }
+void e102(void) { ufsmgen_calls++; }
+void x102(void) { ufsmgen_calls++; }
+void e103(void) { ufsmgen_calls++; }
+void x103(void) { ufsmgen_calls++; }
+void e104(void) { ufsmgen_calls++; }
+void x104(void) { ufsmgen_calls++; }
+void e106(void) { ufsmgen_calls++; }
+void x106(void) { ufsmgen_calls++; }
+void e107(void) { ufsmgen_calls++; }
+void x107(void) { ufsmgen_calls++; }
+void e108(void) { ufsmgen_calls++; }
+void x108(void) { ufsmgen_calls++; }
+void e109(void) { ufsmgen_calls++; }
+void x109(void) { ufsmgen_calls++; }
+void e111(void) { ufsmgen_calls++; }
+void x111(void) { ufsmgen_calls++; }
+void e112(void) { ufsmgen_calls++; }
+void x112(void) { ufsmgen_calls++; }
+void e113(void) { ufsmgen_calls++; }
+void x113(void) { ufsmgen_calls++; }
+void e114(void) { ufsmgen_calls++; }
+void x114(void) { ufsmgen_calls++; }
+void e116(void) { ufsmgen_calls++; }
+void x116(void) { ufsmgen_calls++; }
+void e117(void) { ufsmgen_calls++; }
+void x117(void) { ufsmgen_calls++; }
+void e118(void) { ufsmgen_calls++; }
+void x118(void) { ufsmgen_calls++; }
+void e119(void) { ufsmgen_calls++; }
+void x119(void) { ufsmgen_calls++; }
+void e121(void) { ufsmgen_calls++; }
+void x121(void) { ufsmgen_calls++; }
+void e122(void) { ufsmgen_calls++; }
+void x122(void) { ufsmgen_calls++; }
+void e123(void) { ufsmgen_calls++; }
+void x123(void) { ufsmgen_calls++; }
+void e124(void) { ufsmgen_calls++; }
+void x124(void) { ufsmgen_calls++; }
+void e126(void) { ufsmgen_calls++; }
+void x126(void) { ufsmgen_calls++; }
+void e127(void) { ufsmgen_calls++; }
+void x127(void) { ufsmgen_calls++; }
+void e128(void) { ufsmgen_calls++; }
+void x128(void) { ufsmgen_calls++; }
+void e129(void) { ufsmgen_calls++; }
+void x129(void) { ufsmgen_calls++; }
+void e131(void) { ufsmgen_calls++; }
+void x131(void) { ufsmgen_calls++; }
+void e132(void) { ufsmgen_calls++; }
+void x132(void) { ufsmgen_calls++; }
+void e133(void) { ufsmgen_calls++; }
+void x133(void) { ufsmgen_calls++; }
+void e134(void) { ufsmgen_calls++; }
+void x134(void) { ufsmgen_calls++; }
+void e136(void) { ufsmgen_calls++; }
+void x136(void) { ufsmgen_calls++; }
+void e137(void) { ufsmgen_calls++; }
+void x137(void) { ufsmgen_calls++; }
+void e138(void) { ufsmgen_calls++; }
+void x138(void) { ufsmgen_calls++; }
+void e139(void) { ufsmgen_calls++; }
+void x139(void) { ufsmgen_calls++; }
+void e141(void) { ufsmgen_calls++; }
+void x141(void) { ufsmgen_calls++; }
+void e142(void) { ufsmgen_calls++; }
+void x142(void) { ufsmgen_calls++; }
+void e143(void) { ufsmgen_calls++; }
+void x143(void) { ufsmgen_calls++; }
+void e144(void) { ufsmgen_calls++; }
+void x144(void) { ufsmgen_calls++; }
+void e146(void) { ufsmgen_calls++; }
+void x146(void) { ufsmgen_calls++; }
+void e147(void) { ufsmgen_calls++; }
+void x147(void) { ufsmgen_calls++; }
+void e148(void) { ufsmgen_calls++; }
+void x148(void) { ufsmgen_calls++; }
+void e149(void) { ufsmgen_calls++; }
+void x149(void) { ufsmgen_calls++; }
+void e151(void) { ufsmgen_calls++; }
+void x151(void) { ufsmgen_calls++; }
+void e152(void) { ufsmgen_calls++; }
+void x152(void) { ufsmgen_calls++; }
+void e153(void) { ufsmgen_calls++; }
+void x153(void) { ufsmgen_calls++; }
+void e154(void) { ufsmgen_calls++; }
+void x154(void) { ufsmgen_calls++; }
+void e156(void) { ufsmgen_calls++; }
+void x156(void) { ufsmgen_calls++; }
+void e157(void) { ufsmgen_calls++; }
+void x157(void) { ufsmgen_calls++; }
+void e158(void) { ufsmgen_calls++; }
+void x158(void) { ufsmgen_calls++; }
+void e159(void) { ufsmgen_calls++; }
+void x159(void) { ufsmgen_calls++; }
+void e161(void) { ufsmgen_calls++; }
+void x161(void) { ufsmgen_calls++; }
+void e162(void) { ufsmgen_calls++; }
+void x162(void) { ufsmgen_calls++; }
+void e163(void) { ufsmgen_calls++; }
+void x163(void) { ufsmgen_calls++; }
+void e164(void) { ufsmgen_calls++; }
+void x164(void) { ufsmgen_calls++; }
+void e166(void) { ufsmgen_calls++; }
+void x166(void) { ufsmgen_calls++; }
+void e167(void) { ufsmgen_calls++; }
+void x167(void) { ufsmgen_calls++; }
+void e168(void) { ufsmgen_calls++; }
+void x168(void) { ufsmgen_calls++; }
+void e169(void) { ufsmgen_calls++; }
+void x169(void) { ufsmgen_calls++; }
+void e171(void) { ufsmgen_calls++; }
+void x171(void) { ufsmgen_calls++; }
+void e172(void) { ufsmgen_calls++; }
+void x172(void) { ufsmgen_calls++; }
+void e173(void) { ufsmgen_calls++; }
+void x173(void) { ufsmgen_calls++; }
+void e174(void) { ufsmgen_calls++; }
+void x174(void) { ufsmgen_calls++; }
+void e176(void) { ufsmgen_calls++; }
+void x176(void) { ufsmgen_calls++; }
+void e177(void) { ufsmgen_calls++; }
+void x177(void) { ufsmgen_calls++; }
+void e178(void) { ufsmgen_calls++; }
+void x178(void) { ufsmgen_calls++; }
+void e179(void) { ufsmgen_calls++; }
+void x179(void) { ufsmgen_calls++; }
+void e181(void) { ufsmgen_calls++; }
+void x181(void) { ufsmgen_calls++; }
+void e182(void) { ufsmgen_calls++; }
+void x182(void) { ufsmgen_calls++; }
+void e183(void) { ufsmgen_calls++; }
+void x183(void) { ufsmgen_calls++; }
+void e184(void) { ufsmgen_calls++; }
+void x184(void) { ufsmgen_calls++; }
+void e186(void) { ufsmgen_calls++; }
+void x186(void) { ufsmgen_calls++; }
+void e187(void) { ufsmgen_calls++; }
+void x187(void) { ufsmgen_calls++; }
+void e188(void) { ufsmgen_calls++; }
+void x188(void) { ufsmgen_calls++; }
+void e189(void) { ufsmgen_calls++; }
+void x189(void) { ufsmgen_calls++; }
+void e191(void) { ufsmgen_calls++; }
+void x191(void) { ufsmgen_calls++; }
+void e192(void) { ufsmgen_calls++; }
+void x192(void) { ufsmgen_calls++; }
+void e193(void) { ufsmgen_calls++; }
+void x193(void) { ufsmgen_calls++; }
+void e194(void) { ufsmgen_calls++; }
+void x194(void) { ufsmgen_calls++; }
+void e196(void) { ufsmgen_calls++; }
+void x196(void) { ufsmgen_calls++; }
+void e197(void) { ufsmgen_calls++; }
+void x197(void) { ufsmgen_calls++; }
+void e198(void) { ufsmgen_calls++; }
+void x198(void) { ufsmgen_calls++; }
+void e199(void) { ufsmgen_calls++; }
+void x199(void) { ufsmgen_calls++; }
+void e201(void) { ufsmgen_calls++; }
+void x201(void) { ufsmgen_calls++; }
+void e202(void) { ufsmgen_calls++; }
+void x202(void) { ufsmgen_calls++; }
+void e203(void) { ufsmgen_calls++; }
+void x203(void) { ufsmgen_calls++; }
+void e204(void) { ufsmgen_calls++; }
+void x204(void) { ufsmgen_calls++; }
+void e206(void) { ufsmgen_calls++; }
+void x206(void) { ufsmgen_calls++; }
+void e207(void) { ufsmgen_calls++; }
+void x207(void) { ufsmgen_calls++; }
+void e208(void) { ufsmgen_calls++; }
+void x208(void) { ufsmgen_calls++; }
+void e209(void) { ufsmgen_calls++; }
+void x209(void) { ufsmgen_calls++; }
+void e211(void) { ufsmgen_calls++; }
+void x211(void) { ufsmgen_calls++; }
+void e212(void) { ufsmgen_calls++; }
+void x212(void) { ufsmgen_calls++; }
+void e213(void) { ufsmgen_calls++; }
+void x213(void) { ufsmgen_calls++; }
+void e214(void) { ufsmgen_calls++; }
+void x214(void) { ufsmgen_calls++; }
+void e216(void) { ufsmgen_calls++; }
+void x216(void) { ufsmgen_calls++; }
+void e217(void) { ufsmgen_calls++; }
+void x217(void) { ufsmgen_calls++; }
+void e218(void) { ufsmgen_calls++; }
+void x218(void) { ufsmgen_calls++; }
+void e219(void) { ufsmgen_calls++; }
+void x219(void) { ufsmgen_calls++; }
+void e221(void) { ufsmgen_calls++; }
+void x221(void) { ufsmgen_calls++; }
+void e222(void) { ufsmgen_calls++; }
+void x222(void) { ufsmgen_calls++; }
+void e223(void) { ufsmgen_calls++; }
+void x223(void) { ufsmgen_calls++; }
+void e224(void) { ufsmgen_calls++; }
+void x224(void) { ufsmgen_calls++; }
+void e226(void) { ufsmgen_calls++; }
+void x226(void) { ufsmgen_calls++; }
+void e227(void) { ufsmgen_calls++; }
+void x227(void) { ufsmgen_calls++; }
+void e228(void) { ufsmgen_calls++; }
+void x228(void) { ufsmgen_calls++; }
+void e229(void) { ufsmgen_calls++; }
+void x229(void) { ufsmgen_calls++; }
+void e231(void) { ufsmgen_calls++; }
+void x231(void) { ufsmgen_calls++; }
+void e232(void) { ufsmgen_calls++; }
+void x232(void) { ufsmgen_calls++; }
+void e233(void) { ufsmgen_calls++; }
+void x233(void) { ufsmgen_calls++; }
+void e234(void) { ufsmgen_calls++; }
+void x234(void) { ufsmgen_calls++; }
+void e236(void) { ufsmgen_calls++; }
+void x236(void) { ufsmgen_calls++; }
+void e237(void) { ufsmgen_calls++; }
+void x237(void) { ufsmgen_calls++; }
+void e238(void) { ufsmgen_calls++; }
+void x238(void) { ufsmgen_calls++; }
+void e239(void) { ufsmgen_calls++; }
+void x239(void) { ufsmgen_calls++; }
+void e241(void) { ufsmgen_calls++; }
+void x241(void) { ufsmgen_calls++; }
+void e242(void) { ufsmgen_calls++; }
+void x242(void) { ufsmgen_calls++; }
+void e243(void) { ufsmgen_calls++; }
+void x243(void) { ufsmgen_calls++; }
+void e244(void) { ufsmgen_calls++; }
+void x244(void) { ufsmgen_calls++; }
+void e246(void) { ufsmgen_calls++; }
+void x246(void) { ufsmgen_calls++; }
+void e247(void) { ufsmgen_calls++; }
+void x247(void) { ufsmgen_calls++; }
+void e248(void) { ufsmgen_calls++; }
+void x248(void) { ufsmgen_calls++; }
+void e249(void) { ufsmgen_calls++; }
+void x249(void) { ufsmgen_calls++; }
+void e251(void) { ufsmgen_calls++; }
+void x251(void) { ufsmgen_calls++; }
+void e252(void) { ufsmgen_calls++; }
+void x252(void) { ufsmgen_calls++; }
+void e253(void) { ufsmgen_calls++; }
+void x253(void) { ufsmgen_calls++; }
+void e254(void) { ufsmgen_calls++; }
+void x254(void) { ufsmgen_calls++; }
+void e256(void) { ufsmgen_calls++; }
+void x256(void) { ufsmgen_calls++; }
+void e257(void) { ufsmgen_calls++; }
+void x257(void) { ufsmgen_calls++; }
+void e258(void) { ufsmgen_calls++; }
+void x258(void) { ufsmgen_calls++; }
+void e259(void) { ufsmgen_calls++; }
+void x259(void) { ufsmgen_calls++; }
+void e261(void) { ufsmgen_calls++; }
+void x261(void) { ufsmgen_calls++; }
+void e262(void) { ufsmgen_calls++; }
+void x262(void) { ufsmgen_calls++; }
+void e263(void) { ufsmgen_calls++; }
+void x263(void) { ufsmgen_calls++; }
+void e264(void) { ufsmgen_calls++; }
+void x264(void) { ufsmgen_calls++; }
+void e266(void) { ufsmgen_calls++; }
+void x266(void) { ufsmgen_calls++; }
+void e267(void) { ufsmgen_calls++; }
+void x267(void) { ufsmgen_calls++; }
+void e268(void) { ufsmgen_calls++; }
+void x268(void) { ufsmgen_calls++; }
+void e269(void) { ufsmgen_calls++; }
+void x269(void) { ufsmgen_calls++; }
+void e271(void) { ufsmgen_calls++; }
+void x271(void) { ufsmgen_calls++; }
+void e272(void) { ufsmgen_calls++; }
+void x272(void) { ufsmgen_calls++; }
+void e273(void) { ufsmgen_calls++; }
+void x273(void) { ufsmgen_calls++; }
+void e274(void) { ufsmgen_calls++; }
+void x274(void) { ufsmgen_calls++; }
+void e276(void) { ufsmgen_calls++; }
+void x276(void) { ufsmgen_calls++; }
+void e277(void) { ufsmgen_calls++; }
+void x277(void) { ufsmgen_calls++; }
+void e278(void) { ufsmgen_calls++; }
+void x278(void) { ufsmgen_calls++; }
+void e279(void) { ufsmgen_calls++; }
+void x279(void) { ufsmgen_calls++; }
+void e281(void) { ufsmgen_calls++; }
+void x281(void) { ufsmgen_calls++; }
+void e282(void) { ufsmgen_calls++; }
+void x282(void) { ufsmgen_calls++; }
+void e283(void) { ufsmgen_calls++; }
+void x283(void) { ufsmgen_calls++; }
+void e284(void) { ufsmgen_calls++; }
+void x284(void) { ufsmgen_calls++; }
+void e286(void) { ufsmgen_calls++; }
+void x286(void) { ufsmgen_calls++; }
+void e287(void) { ufsmgen_calls++; }
+void x287(void) { ufsmgen_calls++; }
+void e288(void) { ufsmgen_calls++; }
+void x288(void) { ufsmgen_calls++; }
+void e289(void) { ufsmgen_calls++; }
+void x289(void) { ufsmgen_calls++; }
+void e291(void) { ufsmgen_calls++; }
+void x291(void) { ufsmgen_calls++; }
+void e292(void) { ufsmgen_calls++; }
+void x292(void) { ufsmgen_calls++; }
+void e293(void) { ufsmgen_calls++; }
+void x293(void) { ufsmgen_calls++; }
+void e294(void) { ufsmgen_calls++; }
+void x294(void) { ufsmgen_calls++; }
+void e296(void) { ufsmgen_calls++; }
+void x296(void) { ufsmgen_calls++; }
+void e297(void) { ufsmgen_calls++; }
+void x297(void) { ufsmgen_calls++; }
+void e298(void) { ufsmgen_calls++; }
+void x298(void) { ufsmgen_calls++; }
+void e299(void) { ufsmgen_calls++; }
+void x299(void) { ufsmgen_calls++; }
+void e301(void) { ufsmgen_calls++; }
+void x301(void) { ufsmgen_calls++; }
+void e302(void) { ufsmgen_calls++; }
+void x302(void) { ufsmgen_calls++; }
+void e303(void) { ufsmgen_calls++; }
+void x303(void) { ufsmgen_calls++; }
+void e304(void) { ufsmgen_calls++; }
+void x304(void) { ufsmgen_calls++; }
+void e306(void) { ufsmgen_calls++; }
+void x306(void) { ufsmgen_calls++; }
+void e307(void) { ufsmgen_calls++; }
+void x307(void) { ufsmgen_calls++; }
+void e308(void) { ufsmgen_calls++; }
+void x308(void) { ufsmgen_calls++; }
+void e309(void) { ufsmgen_calls++; }
+void x309(void) { ufsmgen_calls++; }
+void e311(void) { ufsmgen_calls++; }
+void x311(void) { ufsmgen_calls++; }
+void e312(void) { ufsmgen_calls++; }
+void x312(void) { ufsmgen_calls++; }
+void e313(void) { ufsmgen_calls++; }
+void x313(void) { ufsmgen_calls++; }
+void e314(void) { ufsmgen_calls++; }
+void x314(void) { ufsmgen_calls++; }
+void e316(void) { ufsmgen_calls++; }
+void x316(void) { ufsmgen_calls++; }
+void e317(void) { ufsmgen_calls++; }
+void x317(void) { ufsmgen_calls++; }
+void e318(void) { ufsmgen_calls++; }
+void x318(void) { ufsmgen_calls++; }
+void e319(void) { ufsmgen_calls++; }
+void x319(void) { ufsmgen_calls++; }
+void e321(void) { ufsmgen_calls++; }
+void x321(void) { ufsmgen_calls++; }
+void e322(void) { ufsmgen_calls++; }
+void x322(void) { ufsmgen_calls++; }
+void e323(void) { ufsmgen_calls++; }
+void x323(void) { ufsmgen_calls++; }
+void e324(void) { ufsmgen_calls++; }
+void x324(void) { ufsmgen_calls++; }
+void e326(void) { ufsmgen_calls++; }
+void x326(void) { ufsmgen_calls++; }
+void e327(void) { ufsmgen_calls++; }
+void x327(void) { ufsmgen_calls++; }
+void e328(void) { ufsmgen_calls++; }
+void x328(void) { ufsmgen_calls++; }
+void e329(void) { ufsmgen_calls++; }
+void x329(void) { ufsmgen_calls++; }
+void e331(void) { ufsmgen_calls++; }
+void x331(void) { ufsmgen_calls++; }
+void e332(void) { ufsmgen_calls++; }
+void x332(void) { ufsmgen_calls++; }
+void e333(void) { ufsmgen_calls++; }
+void x333(void) { ufsmgen_calls++; }
+void e334(void) { ufsmgen_calls++; }
+void x334(void) { ufsmgen_calls++; }
+void e336(void) { ufsmgen_calls++; }
+void x336(void) { ufsmgen_calls++; }
+void e337(void) { ufsmgen_calls++; }
+void x337(void) { ufsmgen_calls++; }
+void e338(void) { ufsmgen_calls++; }
+void x338(void) { ufsmgen_calls++; }
+void e339(void) { ufsmgen_calls++; }
+void x339(void) { ufsmgen_calls++; }
+void e341(void) { ufsmgen_calls++; }
+void x341(void) { ufsmgen_calls++; }
+void e342(void) { ufsmgen_calls++; }
+void x342(void) { ufsmgen_calls++; }
+void e343(void) { ufsmgen_calls++; }
+void x343(void) { ufsmgen_calls++; }
+void e344(void) { ufsmgen_calls++; }
+void x344(void) { ufsmgen_calls++; }
+void e346(void) { ufsmgen_calls++; }
+void x346(void) { ufsmgen_calls++; }
+void e347(void) { ufsmgen_calls++; }
+void x347(void) { ufsmgen_calls++; }
+void e348(void) { ufsmgen_calls++; }
+void x348(void) { ufsmgen_calls++; }
+void e349(void) { ufsmgen_calls++; }
+void x349(void) { ufsmgen_calls++; }
+void e351(void) { ufsmgen_calls++; }
+void x351(void) { ufsmgen_calls++; }
+void e352(void) { ufsmgen_calls++; }
+void x352(void) { ufsmgen_calls++; }
+void e353(void) { ufsmgen_calls++; }
+void x353(void) { ufsmgen_calls++; }
+void e354(void) { ufsmgen_calls++; }
+void x354(void) { ufsmgen_calls++; }
+void e356(void) { ufsmgen_calls++; }
+void x356(void) { ufsmgen_calls++; }
+void e357(void) { ufsmgen_calls++; }
+void x357(void) { ufsmgen_calls++; }
+void e358(void) { ufsmgen_calls++; }
+void x358(void) { ufsmgen_calls++; }
+void e359(void) { ufsmgen_calls++; }
+void x359(void) { ufsmgen_calls++; }
+void e361(void) { ufsmgen_calls++; }
+void x361(void) { ufsmgen_calls++; }
+void e362(void) { ufsmgen_calls++; }
+void x362(void) { ufsmgen_calls++; }
+void e363(void) { ufsmgen_calls++; }
+void x363(void) { ufsmgen_calls++; }
+void e364(void) { ufsmgen_calls++; }
+void x364(void) { ufsmgen_calls++; }
+
+struct ufsm_machine * ufsmgen_machine(void)
+{
+    return get_test_gen_input();
+}
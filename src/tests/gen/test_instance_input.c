@@ -0,0 +1,993 @@
+#include "gen/test_instance_input.h"
+static struct ufsm_machine AAAAAAFjiQL7txnCfYk;
+static const struct ufsm_region AAAAAAFjiQL7txnDxOA;
+static const struct ufsm_transition AAAAAAFjiQcPIxpfwp8;
+static const struct ufsm_transition AAAAAAFjiQdE_xpxqis;
+static const struct ufsm_transition AAAAAAFjiQdrqxqG0SU;
+static const struct ufsm_transition AAAAAAFjiQ2LxBslNRg;
+static const struct ufsm_action AAAAAAFjo1xkcyRA_X0;
+static const struct ufsm_state AAAAAAFjiQNjjRnvFNs;
+static const struct ufsm_entry_exit AAAAAAFjo19FECR_PR8;
+static const struct ufsm_state AAAAAAFjiQNFFRnJb0M;
+static const struct ufsm_region AAAAAAFjiQO4Axo9x_c;
+static const struct ufsm_transition AAAAAAFjiQ9Q8xuzlHE;
+static const struct ufsm_transition AAAAAAFjiQ_PfhvH0Zw;
+static const struct ufsm_transition AAAAAAFjnf9aRh9QTo0;
+static const struct ufsm_transition AAAAAAFjngA1Mx9niNU;
+static const struct ufsm_state AAAAAAFjiQ5yHxtg3rM;
+static const struct ufsm_entry_exit AAAAAAFjo172syRwunE;
+static const struct ufsm_entry_exit AAAAAAFjo18TqCR3pog;
+static const struct ufsm_state AAAAAAFjiQ5LHxs4qJM;
+static const struct ufsm_entry_exit AAAAAAFjo17KICRih18;
+static const struct ufsm_entry_exit AAAAAAFjo17gNSRpBtU;
+static const struct ufsm_state AAAAAAFjiQOGihoVkqY;
+static const struct ufsm_region AAAAAAFjiQudMRrBS_w;
+static const struct ufsm_transition AAAAAAFjiQ_uARvbql4;
+static const struct ufsm_transition AAAAAAFjiQ_9DxvvIuI;
+static const struct ufsm_state AAAAAAFjiQzfSRr3H1A;
+static const struct ufsm_entry_exit AAAAAAFjo1zuNyRU97U;
+static const struct ufsm_entry_exit AAAAAAFjo10IQSRbFW8;
+static const struct ufsm_state AAAAAAFjiQv_vxrOc3w;
+static const struct ufsm_entry_exit AAAAAAFjo1yYaCRGW6U;
+static const struct ufsm_entry_exit AAAAAAFjo1zUhSRNyOk;
+static const struct ufsm_entry_exit AAAAAAFjo1_gtySHm_s;
+static const struct ufsm_entry_exit AAAAAAFjo1_5pySOMSg;
+static const struct ufsm_state AAAAAAFjnf9aFh9L81w;
+static const struct ufsm_state AAAAAAFjiQsFqRqqaLU;
+static const struct ufsm_entry_exit AAAAAAFjiQf6ehqdN0c;
+static const struct ufsm_entry_exit AAAAAAFjiQgq9xqjbo0;
+static const struct ufsm_state AAAAAAFjiQ133Rsg_hM;
+static const struct ufsm_state AAAAAAFjiQcO9xpOx_k;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  (struct ufsm_state *) &AAAAAAFjiQNjjRnvFNs,
+  (struct ufsm_state *) &AAAAAAFjiQNFFRnJb0M,
+  (struct ufsm_state *) &AAAAAAFjiQ133Rsg_hM,
+  (struct ufsm_state *) &AAAAAAFjiQcO9xpOx_k,
+  (struct ufsm_state *) &AAAAAAFjiQ5yHxtg3rM,
+  (struct ufsm_state *) &AAAAAAFjiQ5LHxs4qJM,
+  (struct ufsm_state *) &AAAAAAFjiQOGihoVkqY,
+  (struct ufsm_state *) &AAAAAAFjnf9aFh9L81w,
+  (struct ufsm_state *) &AAAAAAFjiQsFqRqqaLU,
+  (struct ufsm_state *) &AAAAAAFjiQzfSRr3H1A,
+  (struct ufsm_state *) &AAAAAAFjiQv_vxrOc3w,
+};
+
+
+
+static void *AAAAAAFjiQL7txnCfYk_stack[14];
+static void *AAAAAAFjiQL7txnCfYk_stack2[3];
+static void *AAAAAAFjiQL7txnCfYk_completion_stack[1];
+static uint32_t AAAAAAFjiQL7txnCfYk_data[UFSM_MACHINE_DATA_SIZE(11)];
+static struct ufsm_event AAAAAAFjiQL7txnCfYk_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjiQL7txnCfYk = {
+  .id     = "AAAAAAFjiQL7txnCfYk=", 
+  .name   = "StateMachine1", 
+  .region = (struct ufsm_region *) &AAAAAAFjiQL7txnDxOA,    
+  .no_of_regions = 3,
+  .no_of_states = 11,
+  .states = ufsm_states,
+  .flat = true,
+  .read_only = true,
+  .no_of_events = 4,
+  .no_of_transitions = 10,
+  .context = {
+    .m = &AAAAAAFjiQL7txnCfYk,
+    .stack = {
+      .no_of_elements = 14,
+      .data = AAAAAAFjiQL7txnCfYk_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 3,
+      .data = AAAAAAFjiQL7txnCfYk_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjiQL7txnCfYk_completion_stack,
+    },
+  },
+  .data = AAAAAAFjiQL7txnCfYk_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjiQL7txnCfYk_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static const struct ufsm_region AAAAAAFjiQL7txnDxOA = {
+  .id = "AAAAAAFjiQL7txnDxOA=",
+  .name = "StateMachine1region0",
+  .state = (struct ufsm_state *) &AAAAAAFjiQNjjRnvFNs,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = (struct ufsm_transition *) &AAAAAAFjiQcPIxpfwp8,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static const struct ufsm_transition AAAAAAFjiQcPIxpfwp8 = {
+  .id = "AAAAAAFjiQcPIxpfwp8=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = (struct ufsm_state *) &AAAAAAFjiQcO9xpOx_k,
+  .dest = (struct ufsm_state *) &AAAAAAFjiQNjjRnvFNs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = (struct ufsm_transition *) &AAAAAAFjiQdE_xpxqis,
+};
+static const struct ufsm_trigger AAAAAAFjiQdE_xpxqis_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_A",
+  .next = NULL,
+},
+};
+static const struct ufsm_transition AAAAAAFjiQdE_xpxqis = {
+  .id = "AAAAAAFjiQdE+xpxqis=",
+  .name = "",
+  .trigger = (struct ufsm_trigger *) AAAAAAFjiQdE_xpxqis_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = (struct ufsm_state *) &AAAAAAFjiQNjjRnvFNs,
+  .dest = (struct ufsm_state *) &AAAAAAFjiQNFFRnJb0M,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = (struct ufsm_transition *) &AAAAAAFjiQdrqxqG0SU,
+};
+static const struct ufsm_trigger AAAAAAFjiQdrqxqG0SU_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_B",
+  .next = NULL,
+},
+};
+static const struct ufsm_transition AAAAAAFjiQdrqxqG0SU = {
+  .id = "AAAAAAFjiQdrqxqG0SU=",
+  .name = "",
+  .trigger = (struct ufsm_trigger *) AAAAAAFjiQdrqxqG0SU_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = (struct ufsm_state *) &AAAAAAFjiQNFFRnJb0M,
+  .dest = (struct ufsm_state *) &AAAAAAFjiQNjjRnvFNs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = (struct ufsm_transition *) &AAAAAAFjiQ2LxBslNRg,
+};
+static const struct ufsm_transition AAAAAAFjiQ2LxBslNRg = {
+  .id = "AAAAAAFjiQ2LxBslNRg=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 4,
+  .action = (struct ufsm_action *) &AAAAAAFjo1xkcyRA_X0,
+  .defer = false,
+  .guard = NULL,
+  .source = (struct ufsm_state *) &AAAAAAFjiQNFFRnJb0M,
+  .dest = (struct ufsm_state *) &AAAAAAFjiQ133Rsg_hM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static const struct ufsm_action AAAAAAFjo1xkcyRA_X0 = {
+  .id = "AAAAAAFjo1xkcyRA+X0=",
+  .name = "final",
+  .f = &final,
+  .next = NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQNjjRnvFNs_dispatch_0[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdE_xpxqis,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQNjjRnvFNs_dispatch[] = {
+{
+  .ev = 0,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQNjjRnvFNs_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQNjjRnvFNs_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * const AAAAAAFjiQNjjRnvFNs_flat_dispatch_0[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdE_xpxqis,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQNjjRnvFNs_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQNjjRnvFNs_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjiQNjjRnvFNs = {
+  .id   = "AAAAAAFjiQNjjRnvFNs=",
+  .name = "B",
+  .kind = 0,
+  .index = 1,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQL7txnDxOA,
+  .entry = (struct ufsm_entry_exit *) &AAAAAAFjo19FECR_PR8,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjiQNjjRnvFNs_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjiQNjjRnvFNs_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjiQNjjRnvFNs_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = (struct ufsm_state *) &AAAAAAFjiQNFFRnJb0M,
+};
+static const struct ufsm_entry_exit AAAAAAFjo19FECR_PR8 = {
+  .id = "AAAAAAFjo19FECR+PR8=",
+  .name = "eB",
+  .f = &eB,
+  .next = NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQNFFRnJb0M_dispatch_1[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQNFFRnJb0M_dispatch[] = {
+{
+  .ev = 1,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQNFFRnJb0M_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQNFFRnJb0M_interest[] = {
+  0x00000002,
+};
+static struct ufsm_transition * const AAAAAAFjiQNFFRnJb0M_flat_dispatch_1[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQNFFRnJb0M_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQNFFRnJb0M_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjiQNFFRnJb0M = {
+  .id   = "AAAAAAFjiQNFFRnJb0M=",
+  .name = "A",
+  .kind = 0,
+  .index = 2,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQL7txnDxOA,
+  .entry = (struct ufsm_entry_exit *) &AAAAAAFjiQf6ehqdN0c,
+  .doact = NULL,
+  .exit = (struct ufsm_entry_exit *) &AAAAAAFjiQgq9xqjbo0,
+  .region = (struct ufsm_region *) &AAAAAAFjiQO4Axo9x_c,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjiQNFFRnJb0M_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjiQNFFRnJb0M_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjiQNFFRnJb0M_interest,
+  .time_events = NULL,
+  .completion = (struct ufsm_transition *) &AAAAAAFjiQ2LxBslNRg,
+  .next = (struct ufsm_state *) &AAAAAAFjiQ133Rsg_hM,
+};
+static const struct ufsm_region AAAAAAFjiQO4Axo9x_c = {
+  .id = "AAAAAAFjiQO4Axo9x+c=",
+  .name = "RegionA",
+  .state = (struct ufsm_state *) &AAAAAAFjiQ5yHxtg3rM,
+  .has_history = true,
+  .history = NULL,
+  .index = 1,
+  .transition = (struct ufsm_transition *) &AAAAAAFjiQ9Q8xuzlHE,
+  .parent_state = (struct ufsm_state *) &AAAAAAFjiQNFFRnJb0M,
+  .next = NULL,
+};
+static const struct ufsm_trigger AAAAAAFjiQ9Q8xuzlHE_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static const struct ufsm_transition AAAAAAFjiQ9Q8xuzlHE = {
+  .id = "AAAAAAFjiQ9Q8xuzlHE=",
+  .name = "",
+  .trigger = (struct ufsm_trigger *) AAAAAAFjiQ9Q8xuzlHE_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = (struct ufsm_state *) &AAAAAAFjiQ5LHxs4qJM,
+  .dest = (struct ufsm_state *) &AAAAAAFjiQ5yHxtg3rM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = (struct ufsm_transition *) &AAAAAAFjiQ_PfhvH0Zw,
+};
+static const struct ufsm_trigger AAAAAAFjiQ_PfhvH0Zw_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * const AAAAAAFjiQ_PfhvH0Zw_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * const AAAAAAFjiQ_PfhvH0Zw_enter_path[] = {
+  (struct ufsm_region *) &AAAAAAFjiQudMRrBS_w,
+  NULL,
+};
+static const struct ufsm_transition AAAAAAFjiQ_PfhvH0Zw = {
+  .id = "AAAAAAFjiQ+PfhvH0Zw=",
+  .name = "",
+  .trigger = (struct ufsm_trigger *) AAAAAAFjiQ_PfhvH0Zw_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 6,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = (struct ufsm_state *) &AAAAAAFjiQ5yHxtg3rM,
+  .dest = (struct ufsm_state *) &AAAAAAFjiQzfSRr3H1A,
+  .lca = (struct ufsm_region *) &AAAAAAFjiQO4Axo9x_c,
+  .exit_path = (struct ufsm_region **) AAAAAAFjiQ_PfhvH0Zw_exit_path,
+  .enter_path = (struct ufsm_region **) AAAAAAFjiQ_PfhvH0Zw_enter_path,
+  .next = (struct ufsm_transition *) &AAAAAAFjnf9aRh9QTo0,
+};
+static const struct ufsm_trigger AAAAAAFjnf9aRh9QTo0_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_EXIT",
+  .next = NULL,
+},
+};
+static const struct ufsm_transition AAAAAAFjnf9aRh9QTo0 = {
+  .id = "AAAAAAFjnf9aRh9QTo0=",
+  .name = "",
+  .trigger = (struct ufsm_trigger *) AAAAAAFjnf9aRh9QTo0_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 7,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = (struct ufsm_state *) &AAAAAAFjiQ5yHxtg3rM,
+  .dest = (struct ufsm_state *) &AAAAAAFjnf9aFh9L81w,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = (struct ufsm_transition *) &AAAAAAFjngA1Mx9niNU,
+};
+static const struct ufsm_transition AAAAAAFjngA1Mx9niNU = {
+  .id = "AAAAAAFjngA1Mx9niNU=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 8,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = (struct ufsm_state *) &AAAAAAFjiQsFqRqqaLU,
+  .dest = (struct ufsm_state *) &AAAAAAFjiQ5LHxs4qJM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQ5yHxtg3rM_dispatch_2[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQ_PfhvH0Zw,
+  NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQ5yHxtg3rM_dispatch_3[] = {
+  (struct ufsm_transition *) &AAAAAAFjnf9aRh9QTo0,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQ5yHxtg3rM_dispatch[] = {
+{
+  .ev = 2,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQ5yHxtg3rM_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQ5yHxtg3rM_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQ5yHxtg3rM_interest[] = {
+  0x0000000e,
+};
+static struct ufsm_transition * const AAAAAAFjiQ5yHxtg3rM_flat_dispatch_1[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQ5yHxtg3rM_flat_dispatch_2[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQ_PfhvH0Zw,
+  NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQ5yHxtg3rM_flat_dispatch_3[] = {
+  (struct ufsm_transition *) &AAAAAAFjnf9aRh9QTo0,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQ5yHxtg3rM_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQ5yHxtg3rM_flat_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQ5yHxtg3rM_flat_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQ5yHxtg3rM_flat_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjiQ5yHxtg3rM = {
+  .id   = "AAAAAAFjiQ5yHxtg3rM=",
+  .name = "A2",
+  .kind = 0,
+  .index = 5,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQO4Axo9x_c,
+  .entry = (struct ufsm_entry_exit *) &AAAAAAFjo172syRwunE,
+  .doact = NULL,
+  .exit = (struct ufsm_entry_exit *) &AAAAAAFjo18TqCR3pog,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjiQ5yHxtg3rM_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjiQ5yHxtg3rM_flat_dispatch,
+  .no_of_flat_dispatch = 3,
+  .interest = AAAAAAFjiQ5yHxtg3rM_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = (struct ufsm_state *) &AAAAAAFjiQ5LHxs4qJM,
+};
+static const struct ufsm_entry_exit AAAAAAFjo172syRwunE = {
+  .id = "AAAAAAFjo172syRwunE=",
+  .name = "eA2",
+  .f = &eA2,
+  .next = NULL,
+};
+static const struct ufsm_entry_exit AAAAAAFjo18TqCR3pog = {
+  .id = "AAAAAAFjo18TqCR3pog=",
+  .name = "xA2",
+  .f = &xA2,
+  .next = NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQ5LHxs4qJM_dispatch_2[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQ9Q8xuzlHE,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQ5LHxs4qJM_dispatch[] = {
+{
+  .ev = 2,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQ5LHxs4qJM_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQ5LHxs4qJM_interest[] = {
+  0x00000006,
+};
+static struct ufsm_transition * const AAAAAAFjiQ5LHxs4qJM_flat_dispatch_1[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQ5LHxs4qJM_flat_dispatch_2[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQ9Q8xuzlHE,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQ5LHxs4qJM_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQ5LHxs4qJM_flat_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQ5LHxs4qJM_flat_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjiQ5LHxs4qJM = {
+  .id   = "AAAAAAFjiQ5LHxs4qJM=",
+  .name = "A1",
+  .kind = 0,
+  .index = 6,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQO4Axo9x_c,
+  .entry = (struct ufsm_entry_exit *) &AAAAAAFjo17KICRih18,
+  .doact = NULL,
+  .exit = (struct ufsm_entry_exit *) &AAAAAAFjo17gNSRpBtU,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjiQ5LHxs4qJM_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjiQ5LHxs4qJM_flat_dispatch,
+  .no_of_flat_dispatch = 2,
+  .interest = AAAAAAFjiQ5LHxs4qJM_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = (struct ufsm_state *) &AAAAAAFjiQOGihoVkqY,
+};
+static const struct ufsm_entry_exit AAAAAAFjo17KICRih18 = {
+  .id = "AAAAAAFjo17KICRih18=",
+  .name = "eA1",
+  .f = &eA1,
+  .next = NULL,
+};
+static const struct ufsm_entry_exit AAAAAAFjo17gNSRpBtU = {
+  .id = "AAAAAAFjo17gNSRpBtU=",
+  .name = "xA1",
+  .f = &xA1,
+  .next = NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQOGihoVkqY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQOGihoVkqY_interest[] = {
+  0x00000002,
+};
+static struct ufsm_transition * const AAAAAAFjiQOGihoVkqY_flat_dispatch_1[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQOGihoVkqY_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQOGihoVkqY_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjiQOGihoVkqY = {
+  .id   = "AAAAAAFjiQOGihoVkqY=",
+  .name = "C",
+  .kind = 0,
+  .index = 7,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQO4Axo9x_c,
+  .entry = (struct ufsm_entry_exit *) &AAAAAAFjo1_gtySHm_s,
+  .doact = NULL,
+  .exit = (struct ufsm_entry_exit *) &AAAAAAFjo1_5pySOMSg,
+  .region = (struct ufsm_region *) &AAAAAAFjiQudMRrBS_w,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjiQOGihoVkqY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjiQOGihoVkqY_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjiQOGihoVkqY_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = (struct ufsm_state *) &AAAAAAFjnf9aFh9L81w,
+};
+static const struct ufsm_region AAAAAAFjiQudMRrBS_w = {
+  .id = "AAAAAAFjiQudMRrBS+w=",
+  .name = "RegionC",
+  .state = (struct ufsm_state *) &AAAAAAFjiQzfSRr3H1A,
+  .has_history = true,
+  .history = NULL,
+  .index = 2,
+  .transition = (struct ufsm_transition *) &AAAAAAFjiQ_uARvbql4,
+  .parent_state = (struct ufsm_state *) &AAAAAAFjiQOGihoVkqY,
+  .next = NULL,
+};
+static const struct ufsm_trigger AAAAAAFjiQ_uARvbql4_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static const struct ufsm_transition AAAAAAFjiQ_uARvbql4 = {
+  .id = "AAAAAAFjiQ+uARvbql4=",
+  .name = "",
+  .trigger = (struct ufsm_trigger *) AAAAAAFjiQ_uARvbql4_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 9,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = (struct ufsm_state *) &AAAAAAFjiQzfSRr3H1A,
+  .dest = (struct ufsm_state *) &AAAAAAFjiQv_vxrOc3w,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = (struct ufsm_transition *) &AAAAAAFjiQ_9DxvvIuI,
+};
+static const struct ufsm_trigger AAAAAAFjiQ_9DxvvIuI_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * const AAAAAAFjiQ_9DxvvIuI_exit_path[] = {
+  (struct ufsm_region *) &AAAAAAFjiQudMRrBS_w,
+  NULL,
+};
+static struct ufsm_region * const AAAAAAFjiQ_9DxvvIuI_enter_path[] = {
+  (struct ufsm_region *) &AAAAAAFjiQO4Axo9x_c,
+  NULL,
+};
+static const struct ufsm_transition AAAAAAFjiQ_9DxvvIuI = {
+  .id = "AAAAAAFjiQ/9DxvvIuI=",
+  .name = "",
+  .trigger = (struct ufsm_trigger *) AAAAAAFjiQ_9DxvvIuI_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 10,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = (struct ufsm_state *) &AAAAAAFjiQv_vxrOc3w,
+  .dest = (struct ufsm_state *) &AAAAAAFjiQ5LHxs4qJM,
+  .lca = (struct ufsm_region *) &AAAAAAFjiQO4Axo9x_c,
+  .exit_path = (struct ufsm_region **) AAAAAAFjiQ_9DxvvIuI_exit_path,
+  .enter_path = (struct ufsm_region **) AAAAAAFjiQ_9DxvvIuI_enter_path,
+  .next = NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQzfSRr3H1A_dispatch_2[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQ_uARvbql4,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQzfSRr3H1A_dispatch[] = {
+{
+  .ev = 2,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQzfSRr3H1A_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQzfSRr3H1A_interest[] = {
+  0x00000006,
+};
+static struct ufsm_transition * const AAAAAAFjiQzfSRr3H1A_flat_dispatch_1[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQzfSRr3H1A_flat_dispatch_2[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQ_uARvbql4,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQzfSRr3H1A_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQzfSRr3H1A_flat_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQzfSRr3H1A_flat_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjiQzfSRr3H1A = {
+  .id   = "AAAAAAFjiQzfSRr3H1A=",
+  .name = "E",
+  .kind = 0,
+  .index = 10,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQudMRrBS_w,
+  .entry = (struct ufsm_entry_exit *) &AAAAAAFjo1zuNyRU97U,
+  .doact = NULL,
+  .exit = (struct ufsm_entry_exit *) &AAAAAAFjo10IQSRbFW8,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjiQzfSRr3H1A_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjiQzfSRr3H1A_flat_dispatch,
+  .no_of_flat_dispatch = 2,
+  .interest = AAAAAAFjiQzfSRr3H1A_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = (struct ufsm_state *) &AAAAAAFjiQv_vxrOc3w,
+};
+static const struct ufsm_entry_exit AAAAAAFjo1zuNyRU97U = {
+  .id = "AAAAAAFjo1zuNyRU97U=",
+  .name = "eE",
+  .f = &eE,
+  .next = NULL,
+};
+static const struct ufsm_entry_exit AAAAAAFjo10IQSRbFW8 = {
+  .id = "AAAAAAFjo10IQSRbFW8=",
+  .name = "xE",
+  .f = &xE,
+  .next = NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQv_vxrOc3w_dispatch_2[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQ_9DxvvIuI,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQv_vxrOc3w_dispatch[] = {
+{
+  .ev = 2,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQv_vxrOc3w_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQv_vxrOc3w_interest[] = {
+  0x00000006,
+};
+static struct ufsm_transition * const AAAAAAFjiQv_vxrOc3w_flat_dispatch_1[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_transition * const AAAAAAFjiQv_vxrOc3w_flat_dispatch_2[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQ_9DxvvIuI,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQv_vxrOc3w_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQv_vxrOc3w_flat_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQv_vxrOc3w_flat_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjiQv_vxrOc3w = {
+  .id   = "AAAAAAFjiQv+vxrOc3w=",
+  .name = "D",
+  .kind = 0,
+  .index = 11,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQudMRrBS_w,
+  .entry = (struct ufsm_entry_exit *) &AAAAAAFjo1yYaCRGW6U,
+  .doact = NULL,
+  .exit = (struct ufsm_entry_exit *) &AAAAAAFjo1zUhSRNyOk,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjiQv_vxrOc3w_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjiQv_vxrOc3w_flat_dispatch,
+  .no_of_flat_dispatch = 2,
+  .interest = AAAAAAFjiQv_vxrOc3w_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = NULL,
+};
+static const struct ufsm_entry_exit AAAAAAFjo1yYaCRGW6U = {
+  .id = "AAAAAAFjo1yYaCRGW6U=",
+  .name = "eD",
+  .f = &eD,
+  .next = NULL,
+};
+static const struct ufsm_entry_exit AAAAAAFjo1zUhSRNyOk = {
+  .id = "AAAAAAFjo1zUhSRNyOk=",
+  .name = "xD",
+  .f = &xD,
+  .next = NULL,
+};
+static const struct ufsm_entry_exit AAAAAAFjo1_gtySHm_s = {
+  .id = "AAAAAAFjo1+gtySHm+s=",
+  .name = "eC",
+  .f = &eC,
+  .next = NULL,
+};
+static const struct ufsm_entry_exit AAAAAAFjo1_5pySOMSg = {
+  .id = "AAAAAAFjo1+5pySOMSg=",
+  .name = "xC",
+  .f = &xC,
+  .next = NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjnf9aFh9L81w_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjnf9aFh9L81w_interest[] = {
+  0x00000002,
+};
+static struct ufsm_transition * const AAAAAAFjnf9aFh9L81w_flat_dispatch_1[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjnf9aFh9L81w_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = (struct ufsm_transition **) AAAAAAFjnf9aFh9L81w_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjnf9aFh9L81w = {
+  .id   = "AAAAAAFjnf9aFh9L81w=",
+  .name = "Final",
+  .kind = 2,
+  .index = 8,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQO4Axo9x_c,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjnf9aFh9L81w_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjnf9aFh9L81w_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjnf9aFh9L81w_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = (struct ufsm_state *) &AAAAAAFjiQsFqRqqaLU,
+};
+static const struct ufsm_dispatch AAAAAAFjiQsFqRqqaLU_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQsFqRqqaLU_interest[] = {
+  0x00000002,
+};
+static struct ufsm_transition * const AAAAAAFjiQsFqRqqaLU_flat_dispatch_1[] = {
+  (struct ufsm_transition *) &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQsFqRqqaLU_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = (struct ufsm_transition **) AAAAAAFjiQsFqRqqaLU_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjiQsFqRqqaLU = {
+  .id   = "AAAAAAFjiQsFqRqqaLU=",
+  .name = "(null)",
+  .kind = 4,
+  .index = 9,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQO4Axo9x_c,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjiQsFqRqqaLU_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjiQsFqRqqaLU_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjiQsFqRqqaLU_interest,
+  .time_events = NULL,
+  .completion = (struct ufsm_transition *) &AAAAAAFjngA1Mx9niNU,
+  .next = NULL,
+};
+static const struct ufsm_entry_exit AAAAAAFjiQf6ehqdN0c = {
+  .id = "AAAAAAFjiQf6ehqdN0c=",
+  .name = "eA",
+  .f = &eA,
+  .next = NULL,
+};
+static const struct ufsm_entry_exit AAAAAAFjiQgq9xqjbo0 = {
+  .id = "AAAAAAFjiQgq9xqjbo0=",
+  .name = "xA",
+  .f = &xA,
+  .next = NULL,
+};
+static const struct ufsm_dispatch AAAAAAFjiQ133Rsg_hM_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_dispatch AAAAAAFjiQ133Rsg_hM_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjiQ133Rsg_hM = {
+  .id   = "AAAAAAFjiQ133Rsg/hM=",
+  .name = "Final",
+  .kind = 2,
+  .index = 3,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQL7txnDxOA,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjiQ133Rsg_hM_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjiQ133Rsg_hM_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = (struct ufsm_state *) &AAAAAAFjiQcO9xpOx_k,
+};
+static const struct ufsm_dispatch AAAAAAFjiQcO9xpOx_k_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_dispatch AAAAAAFjiQcO9xpOx_k_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const struct ufsm_state AAAAAAFjiQcO9xpOx_k = {
+  .id   = "AAAAAAFjiQcO9xpOx+k=",
+  .name = "Init",
+  .kind = 1,
+  .index = 4,
+  .parent_region = (struct ufsm_region *) &AAAAAAFjiQL7txnDxOA,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = (struct ufsm_dispatch *) AAAAAAFjiQcO9xpOx_k_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = (struct ufsm_dispatch *) AAAAAAFjiQcO9xpOx_k_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = (struct ufsm_transition *) &AAAAAAFjiQcPIxpfwp8,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFjiQL7txnCfYk; }
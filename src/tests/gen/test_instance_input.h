@@ -0,0 +1,34 @@
+#ifndef UFSM_GEN_test_instance_input_H__
+#define UFSM_GEN_test_instance_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 3, active regions 3, completion states 1, stacks 14/3/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 18
+void eB(void);
+void eA2(void);
+void xA2(void);
+void eA1(void);
+void xA1(void);
+void eE(void);
+void xE(void);
+void eD(void);
+void xD(void);
+void eC(void);
+void xC(void);
+void eA(void);
+void xA(void);
+void final(void);
+enum {
+  EV_A,
+  EV_B,
+  EV_1,
+  EV_EXIT,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(3, 11)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 10, 11, 4)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(11)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
@@ -0,0 +1,992 @@
+#include "gen/test_interest_input.h"
+static struct ufsm_machine AAAAAAFjiQL7txnCfYk;
+static struct ufsm_region AAAAAAFjiQL7txnDxOA;
+static struct ufsm_transition AAAAAAFjiQcPIxpfwp8;
+static struct ufsm_transition AAAAAAFjiQdE_xpxqis;
+static struct ufsm_transition AAAAAAFjiQdrqxqG0SU;
+static struct ufsm_transition AAAAAAFjiQ2LxBslNRg;
+static struct ufsm_action AAAAAAFjo1xkcyRA_X0;
+static struct ufsm_state AAAAAAFjiQNjjRnvFNs;
+static struct ufsm_entry_exit AAAAAAFjo19FECR_PR8;
+static struct ufsm_state AAAAAAFjiQNFFRnJb0M;
+static struct ufsm_region AAAAAAFjiQO4Axo9x_c;
+static struct ufsm_transition AAAAAAFjiQ9Q8xuzlHE;
+static struct ufsm_transition AAAAAAFjiQ_PfhvH0Zw;
+static struct ufsm_transition AAAAAAFjnf9aRh9QTo0;
+static struct ufsm_transition AAAAAAFjngA1Mx9niNU;
+static struct ufsm_state AAAAAAFjiQ5yHxtg3rM;
+static struct ufsm_entry_exit AAAAAAFjo172syRwunE;
+static struct ufsm_entry_exit AAAAAAFjo18TqCR3pog;
+static struct ufsm_state AAAAAAFjiQ5LHxs4qJM;
+static struct ufsm_entry_exit AAAAAAFjo17KICRih18;
+static struct ufsm_entry_exit AAAAAAFjo17gNSRpBtU;
+static struct ufsm_state AAAAAAFjiQOGihoVkqY;
+static struct ufsm_region AAAAAAFjiQudMRrBS_w;
+static struct ufsm_transition AAAAAAFjiQ_uARvbql4;
+static struct ufsm_transition AAAAAAFjiQ_9DxvvIuI;
+static struct ufsm_state AAAAAAFjiQzfSRr3H1A;
+static struct ufsm_entry_exit AAAAAAFjo1zuNyRU97U;
+static struct ufsm_entry_exit AAAAAAFjo10IQSRbFW8;
+static struct ufsm_state AAAAAAFjiQv_vxrOc3w;
+static struct ufsm_entry_exit AAAAAAFjo1yYaCRGW6U;
+static struct ufsm_entry_exit AAAAAAFjo1zUhSRNyOk;
+static struct ufsm_entry_exit AAAAAAFjo1_gtySHm_s;
+static struct ufsm_entry_exit AAAAAAFjo1_5pySOMSg;
+static struct ufsm_state AAAAAAFjnf9aFh9L81w;
+static struct ufsm_state AAAAAAFjiQsFqRqqaLU;
+static struct ufsm_entry_exit AAAAAAFjiQf6ehqdN0c;
+static struct ufsm_entry_exit AAAAAAFjiQgq9xqjbo0;
+static struct ufsm_state AAAAAAFjiQ133Rsg_hM;
+static struct ufsm_state AAAAAAFjiQcO9xpOx_k;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjiQNjjRnvFNs,
+  &AAAAAAFjiQNFFRnJb0M,
+  &AAAAAAFjiQ133Rsg_hM,
+  &AAAAAAFjiQcO9xpOx_k,
+  &AAAAAAFjiQ5yHxtg3rM,
+  &AAAAAAFjiQ5LHxs4qJM,
+  &AAAAAAFjiQOGihoVkqY,
+  &AAAAAAFjnf9aFh9L81w,
+  &AAAAAAFjiQsFqRqqaLU,
+  &AAAAAAFjiQzfSRr3H1A,
+  &AAAAAAFjiQv_vxrOc3w,
+};
+
+
+
+static void *AAAAAAFjiQL7txnCfYk_stack[14];
+static void *AAAAAAFjiQL7txnCfYk_stack2[3];
+static void *AAAAAAFjiQL7txnCfYk_completion_stack[1];
+static uint32_t AAAAAAFjiQL7txnCfYk_data[UFSM_MACHINE_DATA_SIZE(11)];
+static struct ufsm_event AAAAAAFjiQL7txnCfYk_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjiQL7txnCfYk = {
+  .id     = "AAAAAAFjiQL7txnCfYk=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFjiQL7txnDxOA,    
+  .no_of_regions = 3,
+  .no_of_states = 11,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 4,
+  .no_of_transitions = 10,
+  .context = {
+    .m = &AAAAAAFjiQL7txnCfYk,
+    .stack = {
+      .no_of_elements = 14,
+      .data = AAAAAAFjiQL7txnCfYk_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 3,
+      .data = AAAAAAFjiQL7txnCfYk_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjiQL7txnCfYk_completion_stack,
+    },
+  },
+  .data = AAAAAAFjiQL7txnCfYk_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjiQL7txnCfYk_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjiQL7txnDxOA = {
+  .id = "AAAAAAFjiQL7txnDxOA=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFjiQNjjRnvFNs,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjiQcPIxpfwp8,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjiQcPIxpfwp8 = {
+  .id = "AAAAAAFjiQcPIxpfwp8=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjiQcO9xpOx_k,
+  .dest = &AAAAAAFjiQNjjRnvFNs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjiQdE_xpxqis,
+};
+static struct ufsm_trigger AAAAAAFjiQdE_xpxqis_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_A",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjiQdE_xpxqis = {
+  .id = "AAAAAAFjiQdE+xpxqis=",
+  .name = "",
+  .trigger = AAAAAAFjiQdE_xpxqis_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjiQNjjRnvFNs,
+  .dest = &AAAAAAFjiQNFFRnJb0M,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjiQdrqxqG0SU,
+};
+static struct ufsm_trigger AAAAAAFjiQdrqxqG0SU_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_B",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjiQdrqxqG0SU = {
+  .id = "AAAAAAFjiQdrqxqG0SU=",
+  .name = "",
+  .trigger = AAAAAAFjiQdrqxqG0SU_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjiQNFFRnJb0M,
+  .dest = &AAAAAAFjiQNjjRnvFNs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjiQ2LxBslNRg,
+};
+static struct ufsm_transition AAAAAAFjiQ2LxBslNRg = {
+  .id = "AAAAAAFjiQ2LxBslNRg=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 4,
+  .action = &AAAAAAFjo1xkcyRA_X0,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjiQNFFRnJb0M,
+  .dest = &AAAAAAFjiQ133Rsg_hM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFjo1xkcyRA_X0 = {
+  .id = "AAAAAAFjo1xkcyRA+X0=",
+  .name = "final",
+  .f = &final,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQNjjRnvFNs_dispatch_0[] = {
+  &AAAAAAFjiQdE_xpxqis,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQNjjRnvFNs_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjiQNjjRnvFNs_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQNjjRnvFNs_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjiQNjjRnvFNs_flat_dispatch_0[] = {
+  &AAAAAAFjiQdE_xpxqis,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQNjjRnvFNs_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjiQNjjRnvFNs_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjiQNjjRnvFNs = {
+  .id   = "AAAAAAFjiQNjjRnvFNs=",
+  .name = "B",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjiQL7txnDxOA,
+  .entry = &AAAAAAFjo19FECR_PR8,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjiQNjjRnvFNs_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjiQNjjRnvFNs_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjiQNjjRnvFNs_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjiQNFFRnJb0M,
+};
+static struct ufsm_entry_exit AAAAAAFjo19FECR_PR8 = {
+  .id = "AAAAAAFjo19FECR+PR8=",
+  .name = "eB",
+  .f = &eB,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQNFFRnJb0M_dispatch_1[] = {
+  &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQNFFRnJb0M_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFjiQNFFRnJb0M_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQNFFRnJb0M_interest[] = {
+  0x00000002,
+};
+static struct ufsm_transition * AAAAAAFjiQNFFRnJb0M_flat_dispatch_1[] = {
+  &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQNFFRnJb0M_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFjiQNFFRnJb0M_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjiQNFFRnJb0M = {
+  .id   = "AAAAAAFjiQNFFRnJb0M=",
+  .name = "A",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFjiQL7txnDxOA,
+  .entry = &AAAAAAFjiQf6ehqdN0c,
+  .doact = NULL,
+  .exit = &AAAAAAFjiQgq9xqjbo0,
+  .region = &AAAAAAFjiQO4Axo9x_c,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjiQNFFRnJb0M_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjiQNFFRnJb0M_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjiQNFFRnJb0M_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFjiQ2LxBslNRg,
+  .next = &AAAAAAFjiQ133Rsg_hM,
+};
+static struct ufsm_region AAAAAAFjiQO4Axo9x_c = {
+  .id = "AAAAAAFjiQO4Axo9x+c=",
+  .name = "RegionA",
+  .state = &AAAAAAFjiQ5yHxtg3rM,
+  .has_history = true,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFjiQ9Q8xuzlHE,
+  .parent_state = &AAAAAAFjiQNFFRnJb0M,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjiQ9Q8xuzlHE_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjiQ9Q8xuzlHE = {
+  .id = "AAAAAAFjiQ9Q8xuzlHE=",
+  .name = "",
+  .trigger = AAAAAAFjiQ9Q8xuzlHE_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjiQ5LHxs4qJM,
+  .dest = &AAAAAAFjiQ5yHxtg3rM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjiQ_PfhvH0Zw,
+};
+static struct ufsm_trigger AAAAAAFjiQ_PfhvH0Zw_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * AAAAAAFjiQ_PfhvH0Zw_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * AAAAAAFjiQ_PfhvH0Zw_enter_path[] = {
+  &AAAAAAFjiQudMRrBS_w,
+  NULL,
+};
+static struct ufsm_transition AAAAAAFjiQ_PfhvH0Zw = {
+  .id = "AAAAAAFjiQ+PfhvH0Zw=",
+  .name = "",
+  .trigger = AAAAAAFjiQ_PfhvH0Zw_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 6,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjiQ5yHxtg3rM,
+  .dest = &AAAAAAFjiQzfSRr3H1A,
+  .lca = &AAAAAAFjiQO4Axo9x_c,
+  .exit_path = AAAAAAFjiQ_PfhvH0Zw_exit_path,
+  .enter_path = AAAAAAFjiQ_PfhvH0Zw_enter_path,
+  .next = &AAAAAAFjnf9aRh9QTo0,
+};
+static struct ufsm_trigger AAAAAAFjnf9aRh9QTo0_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_EXIT",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjnf9aRh9QTo0 = {
+  .id = "AAAAAAFjnf9aRh9QTo0=",
+  .name = "",
+  .trigger = AAAAAAFjnf9aRh9QTo0_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 7,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjiQ5yHxtg3rM,
+  .dest = &AAAAAAFjnf9aFh9L81w,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjngA1Mx9niNU,
+};
+static struct ufsm_transition AAAAAAFjngA1Mx9niNU = {
+  .id = "AAAAAAFjngA1Mx9niNU=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 8,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjiQsFqRqqaLU,
+  .dest = &AAAAAAFjiQ5LHxs4qJM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQ5yHxtg3rM_dispatch_2[] = {
+  &AAAAAAFjiQ_PfhvH0Zw,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQ5yHxtg3rM_dispatch_3[] = {
+  &AAAAAAFjnf9aRh9QTo0,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQ5yHxtg3rM_dispatch[] = {
+{
+  .ev = 2,
+  .transition = AAAAAAFjiQ5yHxtg3rM_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = AAAAAAFjiQ5yHxtg3rM_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQ5yHxtg3rM_interest[] = {
+  0x0000000e,
+};
+static struct ufsm_transition * AAAAAAFjiQ5yHxtg3rM_flat_dispatch_1[] = {
+  &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQ5yHxtg3rM_flat_dispatch_2[] = {
+  &AAAAAAFjiQ_PfhvH0Zw,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQ5yHxtg3rM_flat_dispatch_3[] = {
+  &AAAAAAFjnf9aRh9QTo0,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQ5yHxtg3rM_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFjiQ5yHxtg3rM_flat_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = AAAAAAFjiQ5yHxtg3rM_flat_dispatch_2,
+},
+{
+  .ev = 3,
+  .transition = AAAAAAFjiQ5yHxtg3rM_flat_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjiQ5yHxtg3rM = {
+  .id   = "AAAAAAFjiQ5yHxtg3rM=",
+  .name = "A2",
+  .kind = 0,
+  .index = 5,
+  .parent_region = &AAAAAAFjiQO4Axo9x_c,
+  .entry = &AAAAAAFjo172syRwunE,
+  .doact = NULL,
+  .exit = &AAAAAAFjo18TqCR3pog,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjiQ5yHxtg3rM_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = AAAAAAFjiQ5yHxtg3rM_flat_dispatch,
+  .no_of_flat_dispatch = 3,
+  .interest = AAAAAAFjiQ5yHxtg3rM_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjiQ5LHxs4qJM,
+};
+static struct ufsm_entry_exit AAAAAAFjo172syRwunE = {
+  .id = "AAAAAAFjo172syRwunE=",
+  .name = "eA2",
+  .f = &eA2,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjo18TqCR3pog = {
+  .id = "AAAAAAFjo18TqCR3pog=",
+  .name = "xA2",
+  .f = &xA2,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQ5LHxs4qJM_dispatch_2[] = {
+  &AAAAAAFjiQ9Q8xuzlHE,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQ5LHxs4qJM_dispatch[] = {
+{
+  .ev = 2,
+  .transition = AAAAAAFjiQ5LHxs4qJM_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQ5LHxs4qJM_interest[] = {
+  0x00000006,
+};
+static struct ufsm_transition * AAAAAAFjiQ5LHxs4qJM_flat_dispatch_1[] = {
+  &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQ5LHxs4qJM_flat_dispatch_2[] = {
+  &AAAAAAFjiQ9Q8xuzlHE,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQ5LHxs4qJM_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFjiQ5LHxs4qJM_flat_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = AAAAAAFjiQ5LHxs4qJM_flat_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjiQ5LHxs4qJM = {
+  .id   = "AAAAAAFjiQ5LHxs4qJM=",
+  .name = "A1",
+  .kind = 0,
+  .index = 6,
+  .parent_region = &AAAAAAFjiQO4Axo9x_c,
+  .entry = &AAAAAAFjo17KICRih18,
+  .doact = NULL,
+  .exit = &AAAAAAFjo17gNSRpBtU,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjiQ5LHxs4qJM_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjiQ5LHxs4qJM_flat_dispatch,
+  .no_of_flat_dispatch = 2,
+  .interest = AAAAAAFjiQ5LHxs4qJM_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjiQOGihoVkqY,
+};
+static struct ufsm_entry_exit AAAAAAFjo17KICRih18 = {
+  .id = "AAAAAAFjo17KICRih18=",
+  .name = "eA1",
+  .f = &eA1,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjo17gNSRpBtU = {
+  .id = "AAAAAAFjo17gNSRpBtU=",
+  .name = "xA1",
+  .f = &xA1,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQOGihoVkqY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQOGihoVkqY_interest[] = {
+  0x00000002,
+};
+static struct ufsm_transition * AAAAAAFjiQOGihoVkqY_flat_dispatch_1[] = {
+  &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQOGihoVkqY_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFjiQOGihoVkqY_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjiQOGihoVkqY = {
+  .id   = "AAAAAAFjiQOGihoVkqY=",
+  .name = "C",
+  .kind = 0,
+  .index = 7,
+  .parent_region = &AAAAAAFjiQO4Axo9x_c,
+  .entry = &AAAAAAFjo1_gtySHm_s,
+  .doact = NULL,
+  .exit = &AAAAAAFjo1_5pySOMSg,
+  .region = &AAAAAAFjiQudMRrBS_w,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjiQOGihoVkqY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjiQOGihoVkqY_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjiQOGihoVkqY_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjnf9aFh9L81w,
+};
+static struct ufsm_region AAAAAAFjiQudMRrBS_w = {
+  .id = "AAAAAAFjiQudMRrBS+w=",
+  .name = "RegionC",
+  .state = &AAAAAAFjiQzfSRr3H1A,
+  .has_history = true,
+  .history = NULL,
+  .index = 2,
+  .transition = &AAAAAAFjiQ_uARvbql4,
+  .parent_state = &AAAAAAFjiQOGihoVkqY,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjiQ_uARvbql4_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjiQ_uARvbql4 = {
+  .id = "AAAAAAFjiQ+uARvbql4=",
+  .name = "",
+  .trigger = AAAAAAFjiQ_uARvbql4_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 9,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjiQzfSRr3H1A,
+  .dest = &AAAAAAFjiQv_vxrOc3w,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjiQ_9DxvvIuI,
+};
+static struct ufsm_trigger AAAAAAFjiQ_9DxvvIuI_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_1",
+  .next = NULL,
+},
+};
+static struct ufsm_region * AAAAAAFjiQ_9DxvvIuI_exit_path[] = {
+  &AAAAAAFjiQudMRrBS_w,
+  NULL,
+};
+static struct ufsm_region * AAAAAAFjiQ_9DxvvIuI_enter_path[] = {
+  &AAAAAAFjiQO4Axo9x_c,
+  NULL,
+};
+static struct ufsm_transition AAAAAAFjiQ_9DxvvIuI = {
+  .id = "AAAAAAFjiQ/9DxvvIuI=",
+  .name = "",
+  .trigger = AAAAAAFjiQ_9DxvvIuI_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 10,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjiQv_vxrOc3w,
+  .dest = &AAAAAAFjiQ5LHxs4qJM,
+  .lca = &AAAAAAFjiQO4Axo9x_c,
+  .exit_path = AAAAAAFjiQ_9DxvvIuI_exit_path,
+  .enter_path = AAAAAAFjiQ_9DxvvIuI_enter_path,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQzfSRr3H1A_dispatch_2[] = {
+  &AAAAAAFjiQ_uARvbql4,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQzfSRr3H1A_dispatch[] = {
+{
+  .ev = 2,
+  .transition = AAAAAAFjiQzfSRr3H1A_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQzfSRr3H1A_interest[] = {
+  0x00000006,
+};
+static struct ufsm_transition * AAAAAAFjiQzfSRr3H1A_flat_dispatch_1[] = {
+  &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQzfSRr3H1A_flat_dispatch_2[] = {
+  &AAAAAAFjiQ_uARvbql4,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQzfSRr3H1A_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFjiQzfSRr3H1A_flat_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = AAAAAAFjiQzfSRr3H1A_flat_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjiQzfSRr3H1A = {
+  .id   = "AAAAAAFjiQzfSRr3H1A=",
+  .name = "E",
+  .kind = 0,
+  .index = 10,
+  .parent_region = &AAAAAAFjiQudMRrBS_w,
+  .entry = &AAAAAAFjo1zuNyRU97U,
+  .doact = NULL,
+  .exit = &AAAAAAFjo10IQSRbFW8,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjiQzfSRr3H1A_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjiQzfSRr3H1A_flat_dispatch,
+  .no_of_flat_dispatch = 2,
+  .interest = AAAAAAFjiQzfSRr3H1A_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjiQv_vxrOc3w,
+};
+static struct ufsm_entry_exit AAAAAAFjo1zuNyRU97U = {
+  .id = "AAAAAAFjo1zuNyRU97U=",
+  .name = "eE",
+  .f = &eE,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjo10IQSRbFW8 = {
+  .id = "AAAAAAFjo10IQSRbFW8=",
+  .name = "xE",
+  .f = &xE,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQv_vxrOc3w_dispatch_2[] = {
+  &AAAAAAFjiQ_9DxvvIuI,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQv_vxrOc3w_dispatch[] = {
+{
+  .ev = 2,
+  .transition = AAAAAAFjiQv_vxrOc3w_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQv_vxrOc3w_interest[] = {
+  0x00000006,
+};
+static struct ufsm_transition * AAAAAAFjiQv_vxrOc3w_flat_dispatch_1[] = {
+  &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjiQv_vxrOc3w_flat_dispatch_2[] = {
+  &AAAAAAFjiQ_9DxvvIuI,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQv_vxrOc3w_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFjiQv_vxrOc3w_flat_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = AAAAAAFjiQv_vxrOc3w_flat_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjiQv_vxrOc3w = {
+  .id   = "AAAAAAFjiQv+vxrOc3w=",
+  .name = "D",
+  .kind = 0,
+  .index = 11,
+  .parent_region = &AAAAAAFjiQudMRrBS_w,
+  .entry = &AAAAAAFjo1yYaCRGW6U,
+  .doact = NULL,
+  .exit = &AAAAAAFjo1zUhSRNyOk,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjiQv_vxrOc3w_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjiQv_vxrOc3w_flat_dispatch,
+  .no_of_flat_dispatch = 2,
+  .interest = AAAAAAFjiQv_vxrOc3w_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjo1yYaCRGW6U = {
+  .id = "AAAAAAFjo1yYaCRGW6U=",
+  .name = "eD",
+  .f = &eD,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjo1zUhSRNyOk = {
+  .id = "AAAAAAFjo1zUhSRNyOk=",
+  .name = "xD",
+  .f = &xD,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjo1_gtySHm_s = {
+  .id = "AAAAAAFjo1+gtySHm+s=",
+  .name = "eC",
+  .f = &eC,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjo1_5pySOMSg = {
+  .id = "AAAAAAFjo1+5pySOMSg=",
+  .name = "xC",
+  .f = &xC,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjnf9aFh9L81w_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjnf9aFh9L81w_interest[] = {
+  0x00000002,
+};
+static struct ufsm_transition * AAAAAAFjnf9aFh9L81w_flat_dispatch_1[] = {
+  &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjnf9aFh9L81w_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFjnf9aFh9L81w_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjnf9aFh9L81w = {
+  .id   = "AAAAAAFjnf9aFh9L81w=",
+  .name = "Final",
+  .kind = 2,
+  .index = 8,
+  .parent_region = &AAAAAAFjiQO4Axo9x_c,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjnf9aFh9L81w_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjnf9aFh9L81w_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjnf9aFh9L81w_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjiQsFqRqqaLU,
+};
+static struct ufsm_dispatch AAAAAAFjiQsFqRqqaLU_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjiQsFqRqqaLU_interest[] = {
+  0x00000002,
+};
+static struct ufsm_transition * AAAAAAFjiQsFqRqqaLU_flat_dispatch_1[] = {
+  &AAAAAAFjiQdrqxqG0SU,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQsFqRqqaLU_flat_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFjiQsFqRqqaLU_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjiQsFqRqqaLU = {
+  .id   = "AAAAAAFjiQsFqRqqaLU=",
+  .name = "(null)",
+  .kind = 4,
+  .index = 9,
+  .parent_region = &AAAAAAFjiQO4Axo9x_c,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjiQsFqRqqaLU_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjiQsFqRqqaLU_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjiQsFqRqqaLU_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFjngA1Mx9niNU,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjiQf6ehqdN0c = {
+  .id = "AAAAAAFjiQf6ehqdN0c=",
+  .name = "eA",
+  .f = &eA,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjiQgq9xqjbo0 = {
+  .id = "AAAAAAFjiQgq9xqjbo0=",
+  .name = "xA",
+  .f = &xA,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjiQ133Rsg_hM_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjiQ133Rsg_hM_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjiQ133Rsg_hM = {
+  .id   = "AAAAAAFjiQ133Rsg/hM=",
+  .name = "Final",
+  .kind = 2,
+  .index = 3,
+  .parent_region = &AAAAAAFjiQL7txnDxOA,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjiQ133Rsg_hM_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjiQ133Rsg_hM_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjiQcO9xpOx_k,
+};
+static struct ufsm_dispatch AAAAAAFjiQcO9xpOx_k_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjiQcO9xpOx_k_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjiQcO9xpOx_k = {
+  .id   = "AAAAAAFjiQcO9xpOx+k=",
+  .name = "Init",
+  .kind = 1,
+  .index = 4,
+  .parent_region = &AAAAAAFjiQL7txnDxOA,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjiQcO9xpOx_k_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjiQcO9xpOx_k_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjiQcPIxpfwp8,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFjiQL7txnCfYk; }
@@ -0,0 +1,885 @@
+#include "gen/test_interest_orth_input.h"
+static struct ufsm_machine AAAAAAFjq_rPhZ22kjA;
+static struct ufsm_region AAAAAAFjq_rPhZ23wS8;
+static struct ufsm_transition AAAAAAFjsCtx3J_2y_c;
+static struct ufsm_transition AAAAAAFjsCutmZ_JXSk;
+static struct ufsm_transition AAAAAAFjsCwseqAWML4;
+static struct ufsm_transition AAAAAAFjsCxX4qAqUvg;
+static struct ufsm_guard AAAAAAFjsZkg7qI_Fpg;
+static struct ufsm_transition AAAAAAFjsC32hKBBV08;
+static struct ufsm_guard AAAAAAFjsZkg7qJBCVE;
+static struct ufsm_transition AAAAAAFjsOrMMKHou8Q;
+static struct ufsm_action AAAAAAFjsOxw2qIqTj0;
+static struct ufsm_state AAAAAAFjsCwVSp_fN0g;
+static struct ufsm_state AAAAAAFjrFsxjp295aQ;
+static struct ufsm_region AAAAAAFjsCb0Ip3p_es;
+static struct ufsm_transition AAAAAAFjsCnYmZ8w1SA;
+static struct ufsm_transition AAAAAAFjsCn2P59VWNs;
+static struct ufsm_transition AAAAAAFjsCoWpZ9tREw;
+static struct ufsm_state AAAAAAFjsCmqQp8Ji_s;
+static struct ufsm_entry_exit AAAAAAFjsDKQi6EdkBM;
+static struct ufsm_entry_exit AAAAAAFjsDKlaaEkZq8;
+static struct ufsm_state AAAAAAFjsCl_qJ7iN0w;
+static struct ufsm_state AAAAAAFjsCoWaZ9oMrw;
+static struct ufsm_state AAAAAAFjsCn2AZ9Ezto;
+static struct ufsm_region AAAAAAFjsCbvGJ3jJdo;
+static struct ufsm_transition AAAAAAFjsCh7GZ6IzDw;
+static struct ufsm_transition AAAAAAFjsCiTI56aQL0;
+static struct ufsm_transition AAAAAAFjsCi1dJ6u2TM;
+static struct ufsm_transition AAAAAAFjsCkDqp7M4tM;
+static struct ufsm_state AAAAAAFjsChKjp5Pu0c;
+static struct ufsm_entry_exit AAAAAAFjsDJ8PaEW5Iw;
+static struct ufsm_entry_exit AAAAAAFjsDK8h6ErSXw;
+static struct ufsm_state AAAAAAFjsCgRF54nHUA;
+static struct ufsm_state AAAAAAFjsCeyhp39yNc;
+static struct ufsm_state AAAAAAFjsCkDaZ7H2vY;
+static struct ufsm_state AAAAAAFjsCh64J53U30;
+static struct ufsm_entry_exit AAAAAAFjsDMciqE6Uc4;
+static struct ufsm_entry_exit AAAAAAFjsDLr46EyhA4;
+static struct ufsm_state AAAAAAFjsCwsQqAFzHk;
+static struct ufsm_state AAAAAAFjsCtB85_i39Q;
+static struct ufsm_state AAAAAAFjsCqU1J_DLsM;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjsCwVSp_fN0g,
+  &AAAAAAFjrFsxjp295aQ,
+  &AAAAAAFjsCwsQqAFzHk,
+  &AAAAAAFjsCtB85_i39Q,
+  &AAAAAAFjsCqU1J_DLsM,
+  &AAAAAAFjsCmqQp8Ji_s,
+  &AAAAAAFjsCl_qJ7iN0w,
+  &AAAAAAFjsCoWaZ9oMrw,
+  &AAAAAAFjsCn2AZ9Ezto,
+  &AAAAAAFjsChKjp5Pu0c,
+  &AAAAAAFjsCgRF54nHUA,
+  &AAAAAAFjsCeyhp39yNc,
+  &AAAAAAFjsCkDaZ7H2vY,
+  &AAAAAAFjsCh64J53U30,
+};
+
+
+
+static void *AAAAAAFjq_rPhZ22kjA_stack[20];
+static void *AAAAAAFjq_rPhZ22kjA_stack2[3];
+static void *AAAAAAFjq_rPhZ22kjA_completion_stack[1];
+static uint32_t AAAAAAFjq_rPhZ22kjA_data[UFSM_MACHINE_DATA_SIZE(14)];
+static struct ufsm_event AAAAAAFjq_rPhZ22kjA_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjq_rPhZ22kjA = {
+  .id     = "AAAAAAFjq/rPhZ22kjA=", 
+  .name   = "OrthMachine", 
+  .region = &AAAAAAFjq_rPhZ23wS8,    
+  .no_of_regions = 3,
+  .no_of_states = 14,
+  .states = ufsm_states,
+  .flat = false,
+  .no_of_events = 1,
+  .no_of_transitions = 13,
+  .context = {
+    .m = &AAAAAAFjq_rPhZ22kjA,
+    .stack = {
+      .no_of_elements = 20,
+      .data = AAAAAAFjq_rPhZ22kjA_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 3,
+      .data = AAAAAAFjq_rPhZ22kjA_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjq_rPhZ22kjA_completion_stack,
+    },
+  },
+  .data = AAAAAAFjq_rPhZ22kjA_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjq_rPhZ22kjA_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjq_rPhZ23wS8 = {
+  .id = "AAAAAAFjq/rPhZ23wS8=",
+  .name = "OrthMachineregion0",
+  .state = &AAAAAAFjsCwVSp_fN0g,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjsCtx3J_2y_c,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_region * AAAAAAFjsCtx3J_2y_c_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * AAAAAAFjsCtx3J_2y_c_enter_path[] = {
+  &AAAAAAFjsCb0Ip3p_es,
+  NULL,
+};
+static struct ufsm_transition AAAAAAFjsCtx3J_2y_c = {
+  .id = "AAAAAAFjsCtx3J+2y+c=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjsCtB85_i39Q,
+  .dest = &AAAAAAFjsCmqQp8Ji_s,
+  .lca = &AAAAAAFjq_rPhZ23wS8,
+  .exit_path = AAAAAAFjsCtx3J_2y_c_exit_path,
+  .enter_path = AAAAAAFjsCtx3J_2y_c_enter_path,
+  .next = &AAAAAAFjsCutmZ_JXSk,
+};
+static struct ufsm_region * AAAAAAFjsCutmZ_JXSk_exit_path[] = {
+  NULL,
+};
+static struct ufsm_region * AAAAAAFjsCutmZ_JXSk_enter_path[] = {
+  &AAAAAAFjsCbvGJ3jJdo,
+  NULL,
+};
+static struct ufsm_transition AAAAAAFjsCutmZ_JXSk = {
+  .id = "AAAAAAFjsCutmZ/JXSk=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjsCtB85_i39Q,
+  .dest = &AAAAAAFjsChKjp5Pu0c,
+  .lca = &AAAAAAFjq_rPhZ23wS8,
+  .exit_path = AAAAAAFjsCutmZ_JXSk_exit_path,
+  .enter_path = AAAAAAFjsCutmZ_JXSk_enter_path,
+  .next = &AAAAAAFjsCwseqAWML4,
+};
+static struct ufsm_transition AAAAAAFjsCwseqAWML4 = {
+  .id = "AAAAAAFjsCwseqAWML4=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjsCwsQqAFzHk,
+  .dest = &AAAAAAFjsCwVSp_fN0g,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjsCxX4qAqUvg,
+};
+static struct ufsm_trigger AAAAAAFjsCxX4qAqUvg_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjsCxX4qAqUvg = {
+  .id = "AAAAAAFjsCxX4qAqUvg=",
+  .name = "",
+  .trigger = AAAAAAFjsCxX4qAqUvg_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = &AAAAAAFjsZkg7qI_Fpg,
+  .source = &AAAAAAFjsCwVSp_fN0g,
+  .dest = &AAAAAAFjrFsxjp295aQ,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjsC32hKBBV08,
+};
+static struct ufsm_guard AAAAAAFjsZkg7qI_Fpg = {
+  .id = "AAAAAAFjsZkg7qI/Fpg=",
+  .name = "gA",
+  .f = &gA,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjsC32hKBBV08_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjsC32hKBBV08 = {
+  .id = "AAAAAAFjsC32hKBBV08=",
+  .name = "",
+  .trigger = AAAAAAFjsC32hKBBV08_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = &AAAAAAFjsZkg7qJBCVE,
+  .source = &AAAAAAFjsCwVSp_fN0g,
+  .dest = &AAAAAAFjsCtB85_i39Q,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjsOrMMKHou8Q,
+};
+static struct ufsm_guard AAAAAAFjsZkg7qJBCVE = {
+  .id = "AAAAAAFjsZkg7qJBCVE=",
+  .name = "g2",
+  .f = &g2,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjsOrMMKHou8Q = {
+  .id = "AAAAAAFjsOrMMKHou8Q=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 6,
+  .action = &AAAAAAFjsOxw2qIqTj0,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjrFsxjp295aQ,
+  .dest = &AAAAAAFjsCqU1J_DLsM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFjsOxw2qIqTj0 = {
+  .id = "AAAAAAFjsOxw2qIqTj0=",
+  .name = "finalC",
+  .f = &finalC,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjsCwVSp_fN0g_dispatch_0[] = {
+  &AAAAAAFjsCxX4qAqUvg,
+  &AAAAAAFjsC32hKBBV08,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjsCwVSp_fN0g_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjsCwVSp_fN0g_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjsCwVSp_fN0g_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjsCwVSp_fN0g = {
+  .id   = "AAAAAAFjsCwVSp/fN0g=",
+  .name = "A0",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjq_rPhZ23wS8,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCwVSp_fN0g_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjsCwVSp_fN0g_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjrFsxjp295aQ,
+};
+static struct ufsm_dispatch AAAAAAFjrFsxjp295aQ_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjrFsxjp295aQ = {
+  .id   = "AAAAAAFjrFsxjp295aQ=",
+  .name = "AB",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFjq_rPhZ23wS8,
+  .entry = &AAAAAAFjsDMciqE6Uc4,
+  .doact = NULL,
+  .exit = &AAAAAAFjsDLr46EyhA4,
+  .region = &AAAAAAFjsCb0Ip3p_es,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjrFsxjp295aQ_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjsOrMMKHou8Q,
+  .next = &AAAAAAFjsCwsQqAFzHk,
+};
+static struct ufsm_region AAAAAAFjsCb0Ip3p_es = {
+  .id = "AAAAAAFjsCb0Ip3p/es=",
+  .name = "RegionAB2",
+  .state = &AAAAAAFjsCmqQp8Ji_s,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFjsCnYmZ8w1SA,
+  .parent_state = &AAAAAAFjrFsxjp295aQ,
+  .next = &AAAAAAFjsCbvGJ3jJdo,
+};
+static struct ufsm_trigger AAAAAAFjsCnYmZ8w1SA_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjsCnYmZ8w1SA = {
+  .id = "AAAAAAFjsCnYmZ8w1SA=",
+  .name = "",
+  .trigger = AAAAAAFjsCnYmZ8w1SA_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 7,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjsCl_qJ7iN0w,
+  .dest = &AAAAAAFjsCmqQp8Ji_s,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjsCn2P59VWNs,
+};
+static struct ufsm_transition AAAAAAFjsCn2P59VWNs = {
+  .id = "AAAAAAFjsCn2P59VWNs=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 8,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjsCn2AZ9Ezto,
+  .dest = &AAAAAAFjsCl_qJ7iN0w,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjsCoWpZ9tREw,
+};
+static struct ufsm_trigger AAAAAAFjsCoWpZ9tREw_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjsCoWpZ9tREw = {
+  .id = "AAAAAAFjsCoWpZ9tREw=",
+  .name = "",
+  .trigger = AAAAAAFjsCoWpZ9tREw_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 9,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjsCmqQp8Ji_s,
+  .dest = &AAAAAAFjsCoWaZ9oMrw,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjsCmqQp8Ji_s_dispatch_0[] = {
+  &AAAAAAFjsCoWpZ9tREw,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjsCmqQp8Ji_s_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjsCmqQp8Ji_s_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjsCmqQp8Ji_s_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjsCmqQp8Ji_s = {
+  .id   = "AAAAAAFjsCmqQp8Ji/s=",
+  .name = "B2",
+  .kind = 0,
+  .index = 6,
+  .parent_region = &AAAAAAFjsCb0Ip3p_es,
+  .entry = &AAAAAAFjsDKQi6EdkBM,
+  .doact = NULL,
+  .exit = &AAAAAAFjsDKlaaEkZq8,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCmqQp8Ji_s_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjsCmqQp8Ji_s_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjsCl_qJ7iN0w,
+};
+static struct ufsm_entry_exit AAAAAAFjsDKQi6EdkBM = {
+  .id = "AAAAAAFjsDKQi6EdkBM=",
+  .name = "eB2",
+  .f = &eB2,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjsDKlaaEkZq8 = {
+  .id = "AAAAAAFjsDKlaaEkZq8=",
+  .name = "xB2",
+  .f = &xB2,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjsCl_qJ7iN0w_dispatch_0[] = {
+  &AAAAAAFjsCnYmZ8w1SA,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjsCl_qJ7iN0w_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjsCl_qJ7iN0w_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjsCl_qJ7iN0w_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjsCl_qJ7iN0w = {
+  .id   = "AAAAAAFjsCl+qJ7iN0w=",
+  .name = "B",
+  .kind = 0,
+  .index = 7,
+  .parent_region = &AAAAAAFjsCb0Ip3p_es,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCl_qJ7iN0w_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjsCl_qJ7iN0w_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjsCoWaZ9oMrw,
+};
+static struct ufsm_dispatch AAAAAAFjsCoWaZ9oMrw_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjsCoWaZ9oMrw = {
+  .id   = "AAAAAAFjsCoWaZ9oMrw=",
+  .name = "Final",
+  .kind = 2,
+  .index = 8,
+  .parent_region = &AAAAAAFjsCb0Ip3p_es,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCoWaZ9oMrw_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjsCn2AZ9Ezto,
+};
+static struct ufsm_dispatch AAAAAAFjsCn2AZ9Ezto_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjsCn2AZ9Ezto = {
+  .id   = "AAAAAAFjsCn2AZ9Ezto=",
+  .name = "Init",
+  .kind = 1,
+  .index = 9,
+  .parent_region = &AAAAAAFjsCb0Ip3p_es,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCn2AZ9Ezto_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjsCn2P59VWNs,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFjsCbvGJ3jJdo = {
+  .id = "AAAAAAFjsCbvGJ3jJdo=",
+  .name = "RegionAB1",
+  .state = &AAAAAAFjsChKjp5Pu0c,
+  .has_history = false,
+  .history = NULL,
+  .index = 2,
+  .transition = &AAAAAAFjsCh7GZ6IzDw,
+  .parent_state = &AAAAAAFjrFsxjp295aQ,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjsCh7GZ6IzDw = {
+  .id = "AAAAAAFjsCh7GZ6IzDw=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 10,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjsCh64J53U30,
+  .dest = &AAAAAAFjsCeyhp39yNc,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjsCiTI56aQL0,
+};
+static struct ufsm_trigger AAAAAAFjsCiTI56aQL0_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjsCiTI56aQL0 = {
+  .id = "AAAAAAFjsCiTI56aQL0=",
+  .name = "",
+  .trigger = AAAAAAFjsCiTI56aQL0_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 11,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjsCeyhp39yNc,
+  .dest = &AAAAAAFjsCgRF54nHUA,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjsCi1dJ6u2TM,
+};
+static struct ufsm_trigger AAAAAAFjsCi1dJ6u2TM_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjsCi1dJ6u2TM = {
+  .id = "AAAAAAFjsCi1dJ6u2TM=",
+  .name = "",
+  .trigger = AAAAAAFjsCi1dJ6u2TM_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 12,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjsCgRF54nHUA,
+  .dest = &AAAAAAFjsChKjp5Pu0c,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjsCkDqp7M4tM,
+};
+static struct ufsm_trigger AAAAAAFjsCkDqp7M4tM_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjsCkDqp7M4tM = {
+  .id = "AAAAAAFjsCkDqp7M4tM=",
+  .name = "",
+  .trigger = AAAAAAFjsCkDqp7M4tM_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 13,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjsChKjp5Pu0c,
+  .dest = &AAAAAAFjsCkDaZ7H2vY,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjsChKjp5Pu0c_dispatch_0[] = {
+  &AAAAAAFjsCkDqp7M4tM,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjsChKjp5Pu0c_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjsChKjp5Pu0c_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjsChKjp5Pu0c_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjsChKjp5Pu0c = {
+  .id   = "AAAAAAFjsChKjp5Pu0c=",
+  .name = "A2",
+  .kind = 0,
+  .index = 10,
+  .parent_region = &AAAAAAFjsCbvGJ3jJdo,
+  .entry = &AAAAAAFjsDJ8PaEW5Iw,
+  .doact = NULL,
+  .exit = &AAAAAAFjsDK8h6ErSXw,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsChKjp5Pu0c_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjsChKjp5Pu0c_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjsCgRF54nHUA,
+};
+static struct ufsm_entry_exit AAAAAAFjsDJ8PaEW5Iw = {
+  .id = "AAAAAAFjsDJ8PaEW5Iw=",
+  .name = "eA2",
+  .f = &eA2,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjsDK8h6ErSXw = {
+  .id = "AAAAAAFjsDK8h6ErSXw=",
+  .name = "xA2",
+  .f = &xA2,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjsCgRF54nHUA_dispatch_0[] = {
+  &AAAAAAFjsCi1dJ6u2TM,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjsCgRF54nHUA_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjsCgRF54nHUA_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjsCgRF54nHUA_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjsCgRF54nHUA = {
+  .id   = "AAAAAAFjsCgRF54nHUA=",
+  .name = "A1",
+  .kind = 0,
+  .index = 11,
+  .parent_region = &AAAAAAFjsCbvGJ3jJdo,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCgRF54nHUA_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjsCgRF54nHUA_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjsCeyhp39yNc,
+};
+static struct ufsm_transition * AAAAAAFjsCeyhp39yNc_dispatch_0[] = {
+  &AAAAAAFjsCiTI56aQL0,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjsCeyhp39yNc_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjsCeyhp39yNc_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjsCeyhp39yNc_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjsCeyhp39yNc = {
+  .id   = "AAAAAAFjsCeyhp39yNc=",
+  .name = "A",
+  .kind = 0,
+  .index = 12,
+  .parent_region = &AAAAAAFjsCbvGJ3jJdo,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCeyhp39yNc_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjsCeyhp39yNc_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjsCkDaZ7H2vY,
+};
+static struct ufsm_dispatch AAAAAAFjsCkDaZ7H2vY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjsCkDaZ7H2vY = {
+  .id   = "AAAAAAFjsCkDaZ7H2vY=",
+  .name = "Final",
+  .kind = 2,
+  .index = 13,
+  .parent_region = &AAAAAAFjsCbvGJ3jJdo,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCkDaZ7H2vY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjsCh64J53U30,
+};
+static struct ufsm_dispatch AAAAAAFjsCh64J53U30_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjsCh64J53U30 = {
+  .id   = "AAAAAAFjsCh64J53U30=",
+  .name = "Init",
+  .kind = 1,
+  .index = 14,
+  .parent_region = &AAAAAAFjsCbvGJ3jJdo,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCh64J53U30_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjsCh7GZ6IzDw,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjsDMciqE6Uc4 = {
+  .id = "AAAAAAFjsDMciqE6Uc4=",
+  .name = "eAB",
+  .f = &eAB,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjsDLr46EyhA4 = {
+  .id = "AAAAAAFjsDLr46EyhA4=",
+  .name = "xAB",
+  .f = &xAB,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjsCwsQqAFzHk_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjsCwsQqAFzHk = {
+  .id   = "AAAAAAFjsCwsQqAFzHk=",
+  .name = "Init",
+  .kind = 1,
+  .index = 3,
+  .parent_region = &AAAAAAFjq_rPhZ23wS8,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCwsQqAFzHk_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjsCwseqAWML4,
+  .next = &AAAAAAFjsCtB85_i39Q,
+};
+static struct ufsm_dispatch AAAAAAFjsCtB85_i39Q_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjsCtB85_i39Q = {
+  .id   = "AAAAAAFjsCtB85+i39Q=",
+  .name = "(null)",
+  .kind = 8,
+  .index = 4,
+  .parent_region = &AAAAAAFjq_rPhZ23wS8,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCtB85_i39Q_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjsCtx3J_2y_c,
+  .next = &AAAAAAFjsCqU1J_DLsM,
+};
+static struct ufsm_dispatch AAAAAAFjsCqU1J_DLsM_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjsCqU1J_DLsM = {
+  .id   = "AAAAAAFjsCqU1J+DLsM=",
+  .name = "Final",
+  .kind = 2,
+  .index = 5,
+  .parent_region = &AAAAAAFjq_rPhZ23wS8,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjsCqU1J_DLsM_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_OrthMachine(void) { return &AAAAAAFjq_rPhZ22kjA; }
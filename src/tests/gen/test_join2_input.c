@@ -0,0 +1,620 @@
+#include "gen/test_join2_input.h"
+static struct ufsm_machine AAAAAAFpTPqy7Y9RZ4A;
+static struct ufsm_region AAAAAAFpTPqy7Y9Squw;
+static struct ufsm_transition AAAAAAFpTPtVoY_INuE;
+static struct ufsm_transition AAAAAAFpdkenxMSYtek;
+static struct ufsm_state AAAAAAFpdkdqisRyoiA;
+static struct ufsm_entry_exit AAAAAAFpdkfRhMStdPk;
+static struct ufsm_state AAAAAAFpTPrA4I9Y9cs;
+static struct ufsm_region AAAAAAFpTPrXYo9_1ow;
+static struct ufsm_transition AAAAAAFpTP5GdpD1dUU;
+static struct ufsm_transition AAAAAAFpn_HUBMV_1XI;
+static struct ufsm_transition AAAAAAFpn_KyK8X3fuY;
+static struct ufsm_state AAAAAAFpTP4GrpDOP6k;
+static struct ufsm_state AAAAAAFpTPsIT4_MkbI;
+static struct ufsm_region AAAAAAFpTPvGdI_qbUc;
+static struct ufsm_transition AAAAAAFpTQGk45Ix1OU;
+static struct ufsm_transition AAAAAAFpTQHwYpJSOfQ;
+static struct ufsm_state AAAAAAFpTQFntJH3ybk;
+static struct ufsm_state AAAAAAFpTQGka5IgCTg;
+static struct ufsm_region AAAAAAFpTPu5vY_e6J4;
+static struct ufsm_transition AAAAAAFpTP0gwpCQh_o;
+static struct ufsm_transition AAAAAAFpTP1yRZC1IgI;
+static struct ufsm_state AAAAAAFpTPzsRZBWJsg;
+static struct ufsm_state AAAAAAFpTP0gYpB_eGY;
+static struct ufsm_state AAAAAAFpTPyx8pAggOg;
+static struct ufsm_state AAAAAAFpTP07FJCirJk;
+static struct ufsm_state AAAAAAFpTPtVSo_3XaI;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFpdkdqisRyoiA,
+  &AAAAAAFpTPrA4I9Y9cs,
+  &AAAAAAFpTPtVSo_3XaI,
+  &AAAAAAFpTP4GrpDOP6k,
+  &AAAAAAFpTPsIT4_MkbI,
+  &AAAAAAFpTPyx8pAggOg,
+  &AAAAAAFpTP07FJCirJk,
+  &AAAAAAFpTQFntJH3ybk,
+  &AAAAAAFpTQGka5IgCTg,
+  &AAAAAAFpTPzsRZBWJsg,
+  &AAAAAAFpTP0gYpB_eGY,
+};
+
+
+
+static void *AAAAAAFpTPqy7Y9RZ4A_stack[24];
+static void *AAAAAAFpTPqy7Y9RZ4A_stack2[4];
+static void *AAAAAAFpTPqy7Y9RZ4A_completion_stack[2];
+static uint32_t AAAAAAFpTPqy7Y9RZ4A_data[UFSM_MACHINE_DATA_SIZE(11)];
+static struct ufsm_event AAAAAAFpTPqy7Y9RZ4A_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFpTPqy7Y9RZ4A = {
+  .id     = "AAAAAAFpTPqy7Y9RZ4A=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFpTPqy7Y9Squw,    
+  .no_of_regions = 4,
+  .no_of_states = 11,
+  .states = ufsm_states,
+  .flat = false,
+  .no_of_events = 2,
+  .no_of_transitions = 9,
+  .context = {
+    .m = &AAAAAAFpTPqy7Y9RZ4A,
+    .stack = {
+      .no_of_elements = 24,
+      .data = AAAAAAFpTPqy7Y9RZ4A_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 4,
+      .data = AAAAAAFpTPqy7Y9RZ4A_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 2,
+      .data = AAAAAAFpTPqy7Y9RZ4A_completion_stack,
+    },
+  },
+  .data = AAAAAAFpTPqy7Y9RZ4A_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFpTPqy7Y9RZ4A_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFpTPqy7Y9Squw = {
+  .id = "AAAAAAFpTPqy7Y9Squw=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFpdkdqisRyoiA,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFpTPtVoY_INuE,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpTPtVoY_INuE = {
+  .id = "AAAAAAFpTPtVoY/INuE=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTPtVSo_3XaI,
+  .dest = &AAAAAAFpTPrA4I9Y9cs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpdkenxMSYtek,
+};
+static struct ufsm_trigger AAAAAAFpdkenxMSYtek_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_B",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpdkenxMSYtek = {
+  .id = "AAAAAAFpdkenxMSYtek=",
+  .name = "",
+  .trigger = AAAAAAFpdkenxMSYtek_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTPrA4I9Y9cs,
+  .dest = &AAAAAAFpdkdqisRyoiA,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpdkdqisRyoiA_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpdkdqisRyoiA = {
+  .id   = "AAAAAAFpdkdqisRyoiA=",
+  .name = "B",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFpTPqy7Y9Squw,
+  .entry = &AAAAAAFpdkfRhMStdPk,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpdkdqisRyoiA_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTPrA4I9Y9cs,
+};
+static struct ufsm_entry_exit AAAAAAFpdkfRhMStdPk = {
+  .id = "AAAAAAFpdkfRhMStdPk=",
+  .name = "eB",
+  .f = &eB,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpTPrA4I9Y9cs_dispatch_0[] = {
+  &AAAAAAFpdkenxMSYtek,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTPrA4I9Y9cs_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFpTPrA4I9Y9cs_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTPrA4I9Y9cs_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpTPrA4I9Y9cs = {
+  .id   = "AAAAAAFpTPrA4I9Y9cs=",
+  .name = "A",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFpTPqy7Y9Squw,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFpTPrXYo9_1ow,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPrA4I9Y9cs_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTPrA4I9Y9cs_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTPtVSo_3XaI,
+};
+static struct ufsm_region AAAAAAFpTPrXYo9_1ow = {
+  .id = "AAAAAAFpTPrXYo9+1ow=",
+  .name = "Region1",
+  .state = &AAAAAAFpTP4GrpDOP6k,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFpTP5GdpD1dUU,
+  .parent_state = &AAAAAAFpTPrA4I9Y9cs,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpTP5GdpD1dUU = {
+  .id = "AAAAAAFpTP5GdpD1dUU=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTP07FJCirJk,
+  .dest = &AAAAAAFpTP4GrpDOP6k,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpn_HUBMV_1XI,
+};
+static struct ufsm_transition AAAAAAFpn_HUBMV_1XI = {
+  .id = "AAAAAAFpn/HUBMV+1XI=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTPyx8pAggOg,
+  .dest = &AAAAAAFpTPsIT4_MkbI,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpn_KyK8X3fuY,
+};
+static struct ufsm_trigger AAAAAAFpn_KyK8X3fuY_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_region * AAAAAAFpn_KyK8X3fuY_exit_path[] = {
+  &AAAAAAFpTPrXYo9_1ow,
+  NULL,
+};
+static struct ufsm_region * AAAAAAFpn_KyK8X3fuY_enter_path[] = {
+  &AAAAAAFpTPqy7Y9Squw,
+  NULL,
+};
+static struct ufsm_transition AAAAAAFpn_KyK8X3fuY = {
+  .id = "AAAAAAFpn/KyK8X3fuY=",
+  .name = "",
+  .trigger = AAAAAAFpn_KyK8X3fuY_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTP4GrpDOP6k,
+  .dest = &AAAAAAFpdkdqisRyoiA,
+  .lca = &AAAAAAFpTPqy7Y9Squw,
+  .exit_path = AAAAAAFpn_KyK8X3fuY_exit_path,
+  .enter_path = AAAAAAFpn_KyK8X3fuY_enter_path,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpTP4GrpDOP6k_dispatch_1[] = {
+  &AAAAAAFpn_KyK8X3fuY,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTP4GrpDOP6k_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFpTP4GrpDOP6k_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTP4GrpDOP6k_interest[] = {
+  0x00000003,
+};
+static struct ufsm_state AAAAAAFpTP4GrpDOP6k = {
+  .id   = "AAAAAAFpTP4GrpDOP6k=",
+  .name = "AEnd",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &AAAAAAFpTPrXYo9_1ow,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTP4GrpDOP6k_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTP4GrpDOP6k_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTPsIT4_MkbI,
+};
+static struct ufsm_dispatch AAAAAAFpTPsIT4_MkbI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTPsIT4_MkbI_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpTPsIT4_MkbI = {
+  .id   = "AAAAAAFpTPsIT4+MkbI=",
+  .name = "A1",
+  .kind = 0,
+  .index = 5,
+  .parent_region = &AAAAAAFpTPrXYo9_1ow,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFpTPvGdI_qbUc,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPsIT4_MkbI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTPsIT4_MkbI_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTPyx8pAggOg,
+};
+static struct ufsm_region AAAAAAFpTPvGdI_qbUc = {
+  .id = "AAAAAAFpTPvGdI/qbUc=",
+  .name = "Region3",
+  .state = &AAAAAAFpTQFntJH3ybk,
+  .has_history = false,
+  .history = NULL,
+  .index = 2,
+  .transition = &AAAAAAFpTQGk45Ix1OU,
+  .parent_state = &AAAAAAFpTPsIT4_MkbI,
+  .next = &AAAAAAFpTPu5vY_e6J4,
+};
+static struct ufsm_transition AAAAAAFpTQGk45Ix1OU = {
+  .id = "AAAAAAFpTQGk45Ix1OU=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 6,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTQGka5IgCTg,
+  .dest = &AAAAAAFpTQFntJH3ybk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpTQHwYpJSOfQ,
+};
+static struct ufsm_transition AAAAAAFpTQHwYpJSOfQ = {
+  .id = "AAAAAAFpTQHwYpJSOfQ=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 7,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTQFntJH3ybk,
+  .dest = &AAAAAAFpTP07FJCirJk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTQFntJH3ybk_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTQFntJH3ybk_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpTQFntJH3ybk = {
+  .id   = "AAAAAAFpTQFntJH3ybk=",
+  .name = "A13",
+  .kind = 0,
+  .index = 8,
+  .parent_region = &AAAAAAFpTPvGdI_qbUc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTQFntJH3ybk_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTQFntJH3ybk_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTQHwYpJSOfQ,
+  .next = &AAAAAAFpTQGka5IgCTg,
+};
+static struct ufsm_dispatch AAAAAAFpTQGka5IgCTg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTQGka5IgCTg_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpTQGka5IgCTg = {
+  .id   = "AAAAAAFpTQGka5IgCTg=",
+  .name = "Init",
+  .kind = 1,
+  .index = 9,
+  .parent_region = &AAAAAAFpTPvGdI_qbUc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTQGka5IgCTg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTQGka5IgCTg_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTQGk45Ix1OU,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFpTPu5vY_e6J4 = {
+  .id = "AAAAAAFpTPu5vY/e6J4=",
+  .name = "Region1",
+  .state = &AAAAAAFpTPzsRZBWJsg,
+  .has_history = false,
+  .history = NULL,
+  .index = 3,
+  .transition = &AAAAAAFpTP0gwpCQh_o,
+  .parent_state = &AAAAAAFpTPsIT4_MkbI,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpTP0gwpCQh_o = {
+  .id = "AAAAAAFpTP0gwpCQh+o=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 8,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTP0gYpB_eGY,
+  .dest = &AAAAAAFpTPzsRZBWJsg,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpTP1yRZC1IgI,
+};
+static struct ufsm_transition AAAAAAFpTP1yRZC1IgI = {
+  .id = "AAAAAAFpTP1yRZC1IgI=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 9,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTPzsRZBWJsg,
+  .dest = &AAAAAAFpTP07FJCirJk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTPzsRZBWJsg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTPzsRZBWJsg_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpTPzsRZBWJsg = {
+  .id   = "AAAAAAFpTPzsRZBWJsg=",
+  .name = "A11",
+  .kind = 0,
+  .index = 10,
+  .parent_region = &AAAAAAFpTPu5vY_e6J4,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPzsRZBWJsg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTPzsRZBWJsg_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTP1yRZC1IgI,
+  .next = &AAAAAAFpTP0gYpB_eGY,
+};
+static struct ufsm_dispatch AAAAAAFpTP0gYpB_eGY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTP0gYpB_eGY_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpTP0gYpB_eGY = {
+  .id   = "AAAAAAFpTP0gYpB/eGY=",
+  .name = "Init",
+  .kind = 1,
+  .index = 11,
+  .parent_region = &AAAAAAFpTPu5vY_e6J4,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTP0gYpB_eGY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTP0gYpB_eGY_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTP0gwpCQh_o,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTPyx8pAggOg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTPyx8pAggOg_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpTPyx8pAggOg = {
+  .id   = "AAAAAAFpTPyx8pAggOg=",
+  .name = "Init",
+  .kind = 1,
+  .index = 6,
+  .parent_region = &AAAAAAFpTPrXYo9_1ow,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPyx8pAggOg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTPyx8pAggOg_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpn_HUBMV_1XI,
+  .next = &AAAAAAFpTP07FJCirJk,
+};
+static struct ufsm_dispatch AAAAAAFpTP07FJCirJk_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTP07FJCirJk_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpTP07FJCirJk = {
+  .id   = "AAAAAAFpTP07FJCirJk=",
+  .name = "(null)",
+  .kind = 7,
+  .index = 7,
+  .parent_region = &AAAAAAFpTPrXYo9_1ow,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTP07FJCirJk_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTP07FJCirJk_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTP5GdpD1dUU,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTPtVSo_3XaI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTPtVSo_3XaI = {
+  .id   = "AAAAAAFpTPtVSo+3XaI=",
+  .name = "Init",
+  .kind = 1,
+  .index = 3,
+  .parent_region = &AAAAAAFpTPqy7Y9Squw,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPtVSo_3XaI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTPtVoY_INuE,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFpTPqy7Y9RZ4A; }
@@ -0,0 +1,19 @@
+#ifndef UFSM_GEN_test_join2_input_H__
+#define UFSM_GEN_test_join2_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 3, active regions 4, completion states 2, stacks 24/4/2, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 30
+void eB(void);
+enum {
+  EV_B,
+  EV,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(4, 11)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 9, 11, 2)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(11)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
@@ -0,0 +1,712 @@
+#include "gen/test_join_input.h"
+static struct ufsm_machine AAAAAAFjso8L4yh1Cc4;
+static struct ufsm_region AAAAAAFjso8L4yh2BwU;
+static struct ufsm_transition AAAAAAFjspE6fylpHGw;
+static struct ufsm_transition AAAAAAFjspOUxiqE8YI;
+static struct ufsm_action AAAAAAFjspOi_SqWoUc;
+static struct ufsm_state AAAAAAFjso8xEih8XaI;
+static struct ufsm_region AAAAAAFjxz6lDocU0Dc;
+static struct ufsm_transition AAAAAAFjxz77hIdT5Ec;
+static struct ufsm_transition AAAAAAFjxz88TIdnOT0;
+static struct ufsm_state AAAAAAFjxz7kn4cc9Xw;
+static struct ufsm_state AAAAAAFjxz77XIdCXE0;
+static struct ufsm_region AAAAAAFjso_oqCi4vcU;
+static struct ufsm_transition AAAAAAFjspIF1Snwcqs;
+static struct ufsm_transition AAAAAAFjspJJ2Sop9H8;
+static struct ufsm_transition AAAAAAFjspL_mipkzV4;
+static struct ufsm_state AAAAAAFjspIknioCQYs;
+static struct ufsm_state AAAAAAFjspHjECm3IIo;
+static struct ufsm_state AAAAAAFjspIFiSnfNuY;
+static struct ufsm_region AAAAAAFjso8xEih9c3k;
+static struct ufsm_transition AAAAAAFjspDVZykKJBY;
+static struct ufsm_transition AAAAAAFjspEd1ClEu_U;
+static struct ufsm_transition AAAAAAFjspGa5Smj_D8;
+static struct ufsm_transition AAAAAAFjspLgpSpTwe8;
+static struct ufsm_state AAAAAAFjspF1Yil7yUA;
+static struct ufsm_state AAAAAAFjspD1OSkcY08;
+static struct ufsm_state AAAAAAFjspCnySjRGo0;
+static struct ufsm_state AAAAAAFjspDVKSj5ECQ;
+static struct ufsm_entry_exit AAAAAAFjso9eKiioTTw;
+static struct ufsm_entry_exit AAAAAAFjso_KwyiwmS8;
+static struct ufsm_state AAAAAAFjspNoISp_Pw8;
+static struct ufsm_state AAAAAAFjspKa4So_F_8;
+static struct ufsm_state AAAAAAFjspE6JClYmuI;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjso8xEih8XaI,
+  &AAAAAAFjspNoISp_Pw8,
+  &AAAAAAFjspKa4So_F_8,
+  &AAAAAAFjspE6JClYmuI,
+  &AAAAAAFjxz7kn4cc9Xw,
+  &AAAAAAFjxz77XIdCXE0,
+  &AAAAAAFjspIknioCQYs,
+  &AAAAAAFjspHjECm3IIo,
+  &AAAAAAFjspIFiSnfNuY,
+  &AAAAAAFjspF1Yil7yUA,
+  &AAAAAAFjspD1OSkcY08,
+  &AAAAAAFjspCnySjRGo0,
+  &AAAAAAFjspDVKSj5ECQ,
+};
+
+
+
+static void *AAAAAAFjso8L4yh1Cc4_stack[26];
+static void *AAAAAAFjso8L4yh1Cc4_stack2[4];
+static void *AAAAAAFjso8L4yh1Cc4_completion_stack[3];
+static uint32_t AAAAAAFjso8L4yh1Cc4_data[UFSM_MACHINE_DATA_SIZE(13)];
+static struct ufsm_event AAAAAAFjso8L4yh1Cc4_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjso8L4yh1Cc4 = {
+  .id     = "AAAAAAFjso8L4yh1Cc4=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFjso8L4yh2BwU,    
+  .no_of_regions = 4,
+  .no_of_states = 13,
+  .states = ufsm_states,
+  .flat = false,
+  .no_of_events = 1,
+  .no_of_transitions = 11,
+  .context = {
+    .m = &AAAAAAFjso8L4yh1Cc4,
+    .stack = {
+      .no_of_elements = 26,
+      .data = AAAAAAFjso8L4yh1Cc4_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 4,
+      .data = AAAAAAFjso8L4yh1Cc4_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 3,
+      .data = AAAAAAFjso8L4yh1Cc4_completion_stack,
+    },
+  },
+  .data = AAAAAAFjso8L4yh1Cc4_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjso8L4yh1Cc4_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjso8L4yh2BwU = {
+  .id = "AAAAAAFjso8L4yh2BwU=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFjso8xEih8XaI,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjspE6fylpHGw,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjspE6fylpHGw = {
+  .id = "AAAAAAFjspE6fylpHGw=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjspE6JClYmuI,
+  .dest = &AAAAAAFjso8xEih8XaI,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjspOUxiqE8YI,
+};
+static struct ufsm_transition AAAAAAFjspOUxiqE8YI = {
+  .id = "AAAAAAFjspOUxiqE8YI=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 2,
+  .action = &AAAAAAFjspOi_SqWoUc,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjspKa4So_F_8,
+  .dest = &AAAAAAFjspNoISp_Pw8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFjspOi_SqWoUc = {
+  .id = "AAAAAAFjspOi/SqWoUc=",
+  .name = "final",
+  .f = &final,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjso8xEih8XaI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjso8xEih8XaI = {
+  .id   = "AAAAAAFjso8xEih8XaI=",
+  .name = "AB",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjso8L4yh2BwU,
+  .entry = &AAAAAAFjso9eKiioTTw,
+  .doact = NULL,
+  .exit = &AAAAAAFjso_KwyiwmS8,
+  .region = &AAAAAAFjxz6lDocU0Dc,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjso8xEih8XaI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjspNoISp_Pw8,
+};
+static struct ufsm_region AAAAAAFjxz6lDocU0Dc = {
+  .id = "AAAAAAFjxz6lDocU0Dc=",
+  .name = "Region2",
+  .state = &AAAAAAFjxz7kn4cc9Xw,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFjxz77hIdT5Ec,
+  .parent_state = &AAAAAAFjso8xEih8XaI,
+  .next = &AAAAAAFjso_oqCi4vcU,
+};
+static struct ufsm_transition AAAAAAFjxz77hIdT5Ec = {
+  .id = "AAAAAAFjxz77hIdT5Ec=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjxz77XIdCXE0,
+  .dest = &AAAAAAFjxz7kn4cc9Xw,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjxz88TIdnOT0,
+};
+static struct ufsm_transition AAAAAAFjxz88TIdnOT0 = {
+  .id = "AAAAAAFjxz88TIdnOT0=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjxz7kn4cc9Xw,
+  .dest = &AAAAAAFjspKa4So_F_8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjxz7kn4cc9Xw_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjxz7kn4cc9Xw = {
+  .id   = "AAAAAAFjxz7kn4cc9Xw=",
+  .name = "C1",
+  .kind = 0,
+  .index = 5,
+  .parent_region = &AAAAAAFjxz6lDocU0Dc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjxz7kn4cc9Xw_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjxz88TIdnOT0,
+  .next = &AAAAAAFjxz77XIdCXE0,
+};
+static struct ufsm_dispatch AAAAAAFjxz77XIdCXE0_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjxz77XIdCXE0 = {
+  .id   = "AAAAAAFjxz77XIdCXE0=",
+  .name = "Init",
+  .kind = 1,
+  .index = 6,
+  .parent_region = &AAAAAAFjxz6lDocU0Dc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjxz77XIdCXE0_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjxz77hIdT5Ec,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFjso_oqCi4vcU = {
+  .id = "AAAAAAFjso+oqCi4vcU=",
+  .name = "Region1",
+  .state = &AAAAAAFjspIknioCQYs,
+  .has_history = false,
+  .history = NULL,
+  .index = 2,
+  .transition = &AAAAAAFjspIF1Snwcqs,
+  .parent_state = &AAAAAAFjso8xEih8XaI,
+  .next = &AAAAAAFjso8xEih9c3k,
+};
+static struct ufsm_transition AAAAAAFjspIF1Snwcqs = {
+  .id = "AAAAAAFjspIF1Snwcqs=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjspIFiSnfNuY,
+  .dest = &AAAAAAFjspHjECm3IIo,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjspJJ2Sop9H8,
+};
+static struct ufsm_trigger AAAAAAFjspJJ2Sop9H8_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjspJJ2Sop9H8 = {
+  .id = "AAAAAAFjspJJ2Sop9H8=",
+  .name = "",
+  .trigger = AAAAAAFjspJJ2Sop9H8_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 6,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjspHjECm3IIo,
+  .dest = &AAAAAAFjspIknioCQYs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjspL_mipkzV4,
+};
+static struct ufsm_transition AAAAAAFjspL_mipkzV4 = {
+  .id = "AAAAAAFjspL/mipkzV4=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 7,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjspIknioCQYs,
+  .dest = &AAAAAAFjspKa4So_F_8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjspIknioCQYs_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjspIknioCQYs = {
+  .id   = "AAAAAAFjspIknioCQYs=",
+  .name = "B2",
+  .kind = 0,
+  .index = 7,
+  .parent_region = &AAAAAAFjso_oqCi4vcU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjspIknioCQYs_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjspL_mipkzV4,
+  .next = &AAAAAAFjspHjECm3IIo,
+};
+static struct ufsm_transition * AAAAAAFjspHjECm3IIo_dispatch_0[] = {
+  &AAAAAAFjspJJ2Sop9H8,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjspHjECm3IIo_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjspHjECm3IIo_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjspHjECm3IIo_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjspHjECm3IIo = {
+  .id   = "AAAAAAFjspHjECm3IIo=",
+  .name = "B1",
+  .kind = 0,
+  .index = 8,
+  .parent_region = &AAAAAAFjso_oqCi4vcU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjspHjECm3IIo_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjspHjECm3IIo_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjspIFiSnfNuY,
+};
+static struct ufsm_dispatch AAAAAAFjspIFiSnfNuY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjspIFiSnfNuY = {
+  .id   = "AAAAAAFjspIFiSnfNuY=",
+  .name = "Init",
+  .kind = 1,
+  .index = 9,
+  .parent_region = &AAAAAAFjso_oqCi4vcU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjspIFiSnfNuY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjspIF1Snwcqs,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFjso8xEih9c3k = {
+  .id = "AAAAAAFjso8xEih9c3k=",
+  .name = "ABregion0",
+  .state = &AAAAAAFjspF1Yil7yUA,
+  .has_history = false,
+  .history = NULL,
+  .index = 3,
+  .transition = &AAAAAAFjspDVZykKJBY,
+  .parent_state = &AAAAAAFjso8xEih8XaI,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjspDVZykKJBY = {
+  .id = "AAAAAAFjspDVZykKJBY=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 8,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjspDVKSj5ECQ,
+  .dest = &AAAAAAFjspCnySjRGo0,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjspEd1ClEu_U,
+};
+static struct ufsm_trigger AAAAAAFjspEd1ClEu_U_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjspEd1ClEu_U = {
+  .id = "AAAAAAFjspEd1ClEu+U=",
+  .name = "",
+  .trigger = AAAAAAFjspEd1ClEu_U_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 9,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjspCnySjRGo0,
+  .dest = &AAAAAAFjspD1OSkcY08,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjspGa5Smj_D8,
+};
+static struct ufsm_trigger AAAAAAFjspGa5Smj_D8_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjspGa5Smj_D8 = {
+  .id = "AAAAAAFjspGa5Smj+D8=",
+  .name = "",
+  .trigger = AAAAAAFjspGa5Smj_D8_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 10,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjspD1OSkcY08,
+  .dest = &AAAAAAFjspF1Yil7yUA,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjspLgpSpTwe8,
+};
+static struct ufsm_transition AAAAAAFjspLgpSpTwe8 = {
+  .id = "AAAAAAFjspLgpSpTwe8=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 11,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjspF1Yil7yUA,
+  .dest = &AAAAAAFjspKa4So_F_8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjspF1Yil7yUA_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjspF1Yil7yUA = {
+  .id   = "AAAAAAFjspF1Yil7yUA=",
+  .name = "A3",
+  .kind = 0,
+  .index = 10,
+  .parent_region = &AAAAAAFjso8xEih9c3k,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjspF1Yil7yUA_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjspLgpSpTwe8,
+  .next = &AAAAAAFjspD1OSkcY08,
+};
+static struct ufsm_transition * AAAAAAFjspD1OSkcY08_dispatch_0[] = {
+  &AAAAAAFjspGa5Smj_D8,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjspD1OSkcY08_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjspD1OSkcY08_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjspD1OSkcY08_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjspD1OSkcY08 = {
+  .id   = "AAAAAAFjspD1OSkcY08=",
+  .name = "A2",
+  .kind = 0,
+  .index = 11,
+  .parent_region = &AAAAAAFjso8xEih9c3k,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjspD1OSkcY08_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjspD1OSkcY08_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjspCnySjRGo0,
+};
+static struct ufsm_transition * AAAAAAFjspCnySjRGo0_dispatch_0[] = {
+  &AAAAAAFjspEd1ClEu_U,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjspCnySjRGo0_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjspCnySjRGo0_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjspCnySjRGo0_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjspCnySjRGo0 = {
+  .id   = "AAAAAAFjspCnySjRGo0=",
+  .name = "A1",
+  .kind = 0,
+  .index = 12,
+  .parent_region = &AAAAAAFjso8xEih9c3k,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjspCnySjRGo0_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjspCnySjRGo0_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjspDVKSj5ECQ,
+};
+static struct ufsm_dispatch AAAAAAFjspDVKSj5ECQ_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjspDVKSj5ECQ = {
+  .id   = "AAAAAAFjspDVKSj5ECQ=",
+  .name = "Init",
+  .kind = 1,
+  .index = 13,
+  .parent_region = &AAAAAAFjso8xEih9c3k,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjspDVKSj5ECQ_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjspDVZykKJBY,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjso9eKiioTTw = {
+  .id = "AAAAAAFjso9eKiioTTw=",
+  .name = "eAB",
+  .f = &eAB,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjso_KwyiwmS8 = {
+  .id = "AAAAAAFjso+KwyiwmS8=",
+  .name = "xAB",
+  .f = &xAB,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjspNoISp_Pw8_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjspNoISp_Pw8 = {
+  .id   = "AAAAAAFjspNoISp+Pw8=",
+  .name = "Final",
+  .kind = 2,
+  .index = 2,
+  .parent_region = &AAAAAAFjso8L4yh2BwU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjspNoISp_Pw8_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjspKa4So_F_8,
+};
+static struct ufsm_dispatch AAAAAAFjspKa4So_F_8_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjspKa4So_F_8 = {
+  .id   = "AAAAAAFjspKa4So+F+8=",
+  .name = "(null)",
+  .kind = 7,
+  .index = 3,
+  .parent_region = &AAAAAAFjso8L4yh2BwU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjspKa4So_F_8_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjspOUxiqE8YI,
+  .next = &AAAAAAFjspE6JClYmuI,
+};
+static struct ufsm_dispatch AAAAAAFjspE6JClYmuI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjspE6JClYmuI = {
+  .id   = "AAAAAAFjspE6JClYmuI=",
+  .name = "Init",
+  .kind = 1,
+  .index = 4,
+  .parent_region = &AAAAAAFjso8L4yh2BwU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjspE6JClYmuI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjspE6fylpHGw,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFjso8L4yh1Cc4; }
@@ -0,0 +1,20 @@
+#ifndef UFSM_GEN_test_join_input_H__
+#define UFSM_GEN_test_join_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 2, active regions 4, completion states 3, stacks 26/4/3, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 33
+void eAB(void);
+void xAB(void);
+void final(void);
+enum {
+  EV,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(4, 13)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 11, 13, 1)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(13)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
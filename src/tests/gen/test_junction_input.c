@@ -0,0 +1,547 @@
+#include "gen/test_junction_input.h"
+static struct ufsm_machine AAAAAAFjwckw4yz3vbE;
+static struct ufsm_region AAAAAAFjwckw5Cz4ORo;
+static struct ufsm_transition AAAAAAFjwclfLC017tc;
+static struct ufsm_transition AAAAAAFjwcmyGS2T61M;
+static struct ufsm_transition AAAAAAFjwcnFsS2nAwk;
+static struct ufsm_transition AAAAAAFjwcoiNC3yiGs;
+static struct ufsm_transition AAAAAAFjwcpE7C4GGsM;
+static struct ufsm_transition AAAAAAFjwcpcjy4aNX0;
+static struct ufsm_transition AAAAAAFjwcqbAi4uY2g;
+static struct ufsm_action AAAAAAFjwcrKPS5AkDQ;
+static struct ufsm_state AAAAAAFjwcnhkS27DQQ;
+static struct ufsm_entry_exit AAAAAAFjwcre5C5CAKQ;
+static struct ufsm_state AAAAAAFjwcmZHy1tVRc;
+static struct ufsm_entry_exit AAAAAAFjwcseWC5XitM;
+static struct ufsm_state AAAAAAFjwcl4TC1GXHY;
+static struct ufsm_entry_exit AAAAAAFjwcsKFy5QyGk;
+static struct ufsm_state AAAAAAFjwclEYCz_ypA;
+static struct ufsm_entry_exit AAAAAAFjwcr5ei5JuQo;
+static struct ufsm_state AAAAAAFjwcoMwC3h_DU;
+static struct ufsm_state AAAAAAFjwcle3y0k9n8;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjwcnhkS27DQQ,
+  &AAAAAAFjwcmZHy1tVRc,
+  &AAAAAAFjwcl4TC1GXHY,
+  &AAAAAAFjwclEYCz_ypA,
+  &AAAAAAFjwcoMwC3h_DU,
+  &AAAAAAFjwcle3y0k9n8,
+};
+
+
+
+static void *AAAAAAFjwckw4yz3vbE_stack[8];
+static void *AAAAAAFjwckw4yz3vbE_stack2[1];
+static void *AAAAAAFjwckw4yz3vbE_completion_stack[1];
+static uint32_t AAAAAAFjwckw4yz3vbE_data[UFSM_MACHINE_DATA_SIZE(6)];
+static struct ufsm_event AAAAAAFjwckw4yz3vbE_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjwckw4yz3vbE = {
+  .id     = "AAAAAAFjwckw4yz3vbE=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFjwckw5Cz4ORo,    
+  .no_of_regions = 1,
+  .no_of_states = 6,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 2,
+  .no_of_transitions = 7,
+  .context = {
+    .m = &AAAAAAFjwckw4yz3vbE,
+    .stack = {
+      .no_of_elements = 8,
+      .data = AAAAAAFjwckw4yz3vbE_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjwckw4yz3vbE_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjwckw4yz3vbE_completion_stack,
+    },
+  },
+  .data = AAAAAAFjwckw4yz3vbE_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjwckw4yz3vbE_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjwckw5Cz4ORo = {
+  .id = "AAAAAAFjwckw5Cz4ORo=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFjwcnhkS27DQQ,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjwclfLC017tc,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjwclfLC017tc = {
+  .id = "AAAAAAFjwclfLC017tc=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwcle3y0k9n8,
+  .dest = &AAAAAAFjwclEYCz_ypA,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwcmyGS2T61M,
+};
+static struct ufsm_trigger AAAAAAFjwcmyGS2T61M_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjwcmyGS2T61M = {
+  .id = "AAAAAAFjwcmyGS2T61M=",
+  .name = "",
+  .trigger = AAAAAAFjwcmyGS2T61M_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwclEYCz_ypA,
+  .dest = &AAAAAAFjwcl4TC1GXHY,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwcnFsS2nAwk,
+};
+static struct ufsm_trigger AAAAAAFjwcnFsS2nAwk_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjwcnFsS2nAwk = {
+  .id = "AAAAAAFjwcnFsS2nAwk=",
+  .name = "",
+  .trigger = AAAAAAFjwcnFsS2nAwk_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwcl4TC1GXHY,
+  .dest = &AAAAAAFjwcmZHy1tVRc,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwcoiNC3yiGs,
+};
+static struct ufsm_trigger AAAAAAFjwcoiNC3yiGs_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_J",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjwcoiNC3yiGs = {
+  .id = "AAAAAAFjwcoiNC3yiGs=",
+  .name = "",
+  .trigger = AAAAAAFjwcoiNC3yiGs_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwclEYCz_ypA,
+  .dest = &AAAAAAFjwcoMwC3h_DU,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwcpE7C4GGsM,
+};
+static struct ufsm_trigger AAAAAAFjwcpE7C4GGsM_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_J",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjwcpE7C4GGsM = {
+  .id = "AAAAAAFjwcpE7C4GGsM=",
+  .name = "",
+  .trigger = AAAAAAFjwcpE7C4GGsM_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwcl4TC1GXHY,
+  .dest = &AAAAAAFjwcoMwC3h_DU,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwcpcjy4aNX0,
+};
+static struct ufsm_trigger AAAAAAFjwcpcjy4aNX0_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_J",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjwcpcjy4aNX0 = {
+  .id = "AAAAAAFjwcpcjy4aNX0=",
+  .name = "",
+  .trigger = AAAAAAFjwcpcjy4aNX0_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 6,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwcmZHy1tVRc,
+  .dest = &AAAAAAFjwcoMwC3h_DU,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwcqbAi4uY2g,
+};
+static struct ufsm_transition AAAAAAFjwcqbAi4uY2g = {
+  .id = "AAAAAAFjwcqbAi4uY2g=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 7,
+  .action = &AAAAAAFjwcrKPS5AkDQ,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwcoMwC3h_DU,
+  .dest = &AAAAAAFjwcnhkS27DQQ,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFjwcrKPS5AkDQ = {
+  .id = "AAAAAAFjwcrKPS5AkDQ=",
+  .name = "t1",
+  .f = &t1,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwcnhkS27DQQ_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjwcnhkS27DQQ_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwcnhkS27DQQ = {
+  .id   = "AAAAAAFjwcnhkS27DQQ=",
+  .name = "D",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjwckw5Cz4ORo,
+  .entry = &AAAAAAFjwcre5C5CAKQ,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwcnhkS27DQQ_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjwcnhkS27DQQ_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwcmZHy1tVRc,
+};
+static struct ufsm_entry_exit AAAAAAFjwcre5C5CAKQ = {
+  .id = "AAAAAAFjwcre5C5CAKQ=",
+  .name = "eD",
+  .f = &eD,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjwcmZHy1tVRc_dispatch_0[] = {
+  &AAAAAAFjwcpcjy4aNX0,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwcmZHy1tVRc_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwcmZHy1tVRc_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjwcmZHy1tVRc_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjwcmZHy1tVRc_flat_dispatch_0[] = {
+  &AAAAAAFjwcpcjy4aNX0,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwcmZHy1tVRc_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwcmZHy1tVRc_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwcmZHy1tVRc = {
+  .id   = "AAAAAAFjwcmZHy1tVRc=",
+  .name = "C",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFjwckw5Cz4ORo,
+  .entry = &AAAAAAFjwcseWC5XitM,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwcmZHy1tVRc_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjwcmZHy1tVRc_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjwcmZHy1tVRc_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwcl4TC1GXHY,
+};
+static struct ufsm_entry_exit AAAAAAFjwcseWC5XitM = {
+  .id = "AAAAAAFjwcseWC5XitM=",
+  .name = "eC",
+  .f = &eC,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjwcl4TC1GXHY_dispatch_0[] = {
+  &AAAAAAFjwcpE7C4GGsM,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjwcl4TC1GXHY_dispatch_1[] = {
+  &AAAAAAFjwcnFsS2nAwk,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwcl4TC1GXHY_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwcl4TC1GXHY_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = AAAAAAFjwcl4TC1GXHY_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjwcl4TC1GXHY_interest[] = {
+  0x00000003,
+};
+static struct ufsm_transition * AAAAAAFjwcl4TC1GXHY_flat_dispatch_0[] = {
+  &AAAAAAFjwcpE7C4GGsM,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjwcl4TC1GXHY_flat_dispatch_1[] = {
+  &AAAAAAFjwcnFsS2nAwk,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwcl4TC1GXHY_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwcl4TC1GXHY_flat_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = AAAAAAFjwcl4TC1GXHY_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwcl4TC1GXHY = {
+  .id   = "AAAAAAFjwcl4TC1GXHY=",
+  .name = "B",
+  .kind = 0,
+  .index = 3,
+  .parent_region = &AAAAAAFjwckw5Cz4ORo,
+  .entry = &AAAAAAFjwcsKFy5QyGk,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwcl4TC1GXHY_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = AAAAAAFjwcl4TC1GXHY_flat_dispatch,
+  .no_of_flat_dispatch = 2,
+  .interest = AAAAAAFjwcl4TC1GXHY_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwclEYCz_ypA,
+};
+static struct ufsm_entry_exit AAAAAAFjwcsKFy5QyGk = {
+  .id = "AAAAAAFjwcsKFy5QyGk=",
+  .name = "eB",
+  .f = &eB,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjwclEYCz_ypA_dispatch_0[] = {
+  &AAAAAAFjwcoiNC3yiGs,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjwclEYCz_ypA_dispatch_1[] = {
+  &AAAAAAFjwcmyGS2T61M,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwclEYCz_ypA_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwclEYCz_ypA_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = AAAAAAFjwclEYCz_ypA_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjwclEYCz_ypA_interest[] = {
+  0x00000003,
+};
+static struct ufsm_transition * AAAAAAFjwclEYCz_ypA_flat_dispatch_0[] = {
+  &AAAAAAFjwcoiNC3yiGs,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjwclEYCz_ypA_flat_dispatch_1[] = {
+  &AAAAAAFjwcmyGS2T61M,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwclEYCz_ypA_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwclEYCz_ypA_flat_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = AAAAAAFjwclEYCz_ypA_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwclEYCz_ypA = {
+  .id   = "AAAAAAFjwclEYCz+ypA=",
+  .name = "A",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &AAAAAAFjwckw5Cz4ORo,
+  .entry = &AAAAAAFjwcr5ei5JuQo,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwclEYCz_ypA_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = AAAAAAFjwclEYCz_ypA_flat_dispatch,
+  .no_of_flat_dispatch = 2,
+  .interest = AAAAAAFjwclEYCz_ypA_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwcoMwC3h_DU,
+};
+static struct ufsm_entry_exit AAAAAAFjwcr5ei5JuQo = {
+  .id = "AAAAAAFjwcr5ei5JuQo=",
+  .name = "eA",
+  .f = &eA,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwcoMwC3h_DU_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjwcoMwC3h_DU_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwcoMwC3h_DU = {
+  .id   = "AAAAAAFjwcoMwC3h+DU=",
+  .name = "(null)",
+  .kind = 10,
+  .index = 5,
+  .parent_region = &AAAAAAFjwckw5Cz4ORo,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwcoMwC3h_DU_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjwcoMwC3h_DU_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjwcqbAi4uY2g,
+  .next = &AAAAAAFjwcle3y0k9n8,
+};
+static struct ufsm_dispatch AAAAAAFjwcle3y0k9n8_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjwcle3y0k9n8_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwcle3y0k9n8 = {
+  .id   = "AAAAAAFjwcle3y0k9n8=",
+  .name = "Init",
+  .kind = 1,
+  .index = 6,
+  .parent_region = &AAAAAAFjwckw5Cz4ORo,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwcle3y0k9n8_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjwcle3y0k9n8_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjwclfLC017tc,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFjwckw4yz3vbE; }
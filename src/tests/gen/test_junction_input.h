@@ -0,0 +1,23 @@
+#ifndef UFSM_GEN_test_junction_input_H__
+#define UFSM_GEN_test_junction_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 1, active regions 1, completion states 0, stacks 8/1/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 10
+void eD(void);
+void eC(void);
+void eB(void);
+void eA(void);
+void t1(void);
+enum {
+  EV_J,
+  EV,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(1, 6)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 7, 6, 2)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(6)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
@@ -0,0 +1,36 @@
+#ifndef UFSM_GEN_test_nested_composits2_input_H__
+#define UFSM_GEN_test_nested_composits2_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 3, active regions 6, completion states 3, stacks 34/6/3, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 43
+void eB(void);
+void eA22(void);
+void xA22(void);
+void eA21(void);
+void xA21(void);
+void eAEnd(void);
+void eInitA(void);
+void xInitA(void);
+void eA13(void);
+void xA13(void);
+void eA12Dummy(void);
+void xA12Dummy(void);
+void eA12(void);
+void xA12(void);
+void eA11(void);
+void xA11(void);
+enum {
+  EV_B,
+  EV3,
+  EV,
+  EV2,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(6, 18)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 15, 18, 4)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(18)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
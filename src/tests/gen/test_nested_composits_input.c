@@ -0,0 +1,998 @@
+#include "gen/test_nested_composits_input.h"
+static struct ufsm_machine AAAAAAFpTPqy7Y9RZ4A;
+static struct ufsm_region AAAAAAFpTPqy7Y9Squw;
+static struct ufsm_transition AAAAAAFpTPtVoY_INuE;
+static struct ufsm_state AAAAAAFpTPrA4I9Y9cs;
+static struct ufsm_region AAAAAAFpTPrq0o_Fq5g;
+static struct ufsm_transition AAAAAAFpTQK4p5K3hPQ;
+static struct ufsm_transition AAAAAAFpTQLsbpLNbY4;
+static struct ufsm_transition AAAAAAFpTQMatJL09hA;
+static struct ufsm_state AAAAAAFpTQKar5KQwcM;
+static struct ufsm_entry_exit AAAAAAFpTQN9XJMUDvA;
+static struct ufsm_entry_exit AAAAAAFpTQOR25MbFHM;
+static struct ufsm_state AAAAAAFpTQJN_JJlFNs;
+static struct ufsm_entry_exit AAAAAAFpTQNRAJMG0b8;
+static struct ufsm_entry_exit AAAAAAFpTQNnW5MN4MM;
+static struct ufsm_state AAAAAAFpTQMaTpLjOb4;
+static struct ufsm_region AAAAAAFpTPrXYo9_1ow;
+static struct ufsm_transition AAAAAAFpTPyyVJAxDW0;
+static struct ufsm_transition AAAAAAFpTPzJHJBCacg;
+static struct ufsm_transition AAAAAAFpTP5GdpD1dUU;
+static struct ufsm_state AAAAAAFpTP4GrpDOP6k;
+static struct ufsm_entry_exit AAAAAAFpTQAjh5HAyTY;
+static struct ufsm_state AAAAAAFpTPyQV4_532A;
+static struct ufsm_entry_exit AAAAAAFpTRBqWJMyf1Y;
+static struct ufsm_entry_exit AAAAAAFpTRCFNpM5FJ4;
+static struct ufsm_state AAAAAAFpTPsIT4_MkbI;
+static struct ufsm_region AAAAAAFpTPvGdI_qbUc;
+static struct ufsm_transition AAAAAAFpTQGk45Ix1OU;
+static struct ufsm_transition AAAAAAFpTQHwYpJSOfQ;
+static struct ufsm_state AAAAAAFpTQFntJH3ybk;
+static struct ufsm_entry_exit AAAAAAFpTQHHM5JEvcw;
+static struct ufsm_entry_exit AAAAAAFpTQHaPpJL5wc;
+static struct ufsm_state AAAAAAFpTQGka5IgCTg;
+static struct ufsm_region AAAAAAFpTPvAAo_k8PQ;
+static struct ufsm_transition AAAAAAFpTP8CgZFYB9M;
+static struct ufsm_transition AAAAAAFpTP9mvZGSA_8;
+static struct ufsm_transition AAAAAAFpTP_QeJGmLMg;
+static struct ufsm_state AAAAAAFpTP8ycJFrL3I;
+static struct ufsm_entry_exit AAAAAAFpTQEIJpHoBng;
+static struct ufsm_entry_exit AAAAAAFpTQE_2ZHw3nA;
+static struct ufsm_state AAAAAAFpTP6ByZEGRSg;
+static struct ufsm_entry_exit AAAAAAFpTQDbt5Ha0BQ;
+static struct ufsm_entry_exit AAAAAAFpTQDyz5Hh_uw;
+static struct ufsm_state AAAAAAFpTP8CG5FHYbg;
+static struct ufsm_region AAAAAAFpTPu5vY_e6J4;
+static struct ufsm_transition AAAAAAFpTP0gwpCQh_o;
+static struct ufsm_transition AAAAAAFpTP1yRZC1IgI;
+static struct ufsm_state AAAAAAFpTPzsRZBWJsg;
+static struct ufsm_entry_exit AAAAAAFpTQBelpHIto8;
+static struct ufsm_entry_exit AAAAAAFpTQCLfpHPCDY;
+static struct ufsm_state AAAAAAFpTP0gYpB_eGY;
+static struct ufsm_state AAAAAAFpTPyx8pAggOg;
+static struct ufsm_state AAAAAAFpTP07FJCirJk;
+static struct ufsm_state AAAAAAFpTPtVSo_3XaI;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFpTPrA4I9Y9cs,
+  &AAAAAAFpTPtVSo_3XaI,
+  &AAAAAAFpTQKar5KQwcM,
+  &AAAAAAFpTQJN_JJlFNs,
+  &AAAAAAFpTQMaTpLjOb4,
+  &AAAAAAFpTP4GrpDOP6k,
+  &AAAAAAFpTPyQV4_532A,
+  &AAAAAAFpTPsIT4_MkbI,
+  &AAAAAAFpTPyx8pAggOg,
+  &AAAAAAFpTP07FJCirJk,
+  &AAAAAAFpTQFntJH3ybk,
+  &AAAAAAFpTQGka5IgCTg,
+  &AAAAAAFpTP8ycJFrL3I,
+  &AAAAAAFpTP6ByZEGRSg,
+  &AAAAAAFpTP8CG5FHYbg,
+  &AAAAAAFpTPzsRZBWJsg,
+  &AAAAAAFpTP0gYpB_eGY,
+};
+
+
+
+static void *AAAAAAFpTPqy7Y9RZ4A_stack[34];
+static void *AAAAAAFpTPqy7Y9RZ4A_stack2[6];
+static void *AAAAAAFpTPqy7Y9RZ4A_completion_stack[3];
+static uint32_t AAAAAAFpTPqy7Y9RZ4A_data[UFSM_MACHINE_DATA_SIZE(17)];
+static struct ufsm_event AAAAAAFpTPqy7Y9RZ4A_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFpTPqy7Y9RZ4A = {
+  .id     = "AAAAAAFpTPqy7Y9RZ4A=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFpTPqy7Y9Squw,    
+  .no_of_regions = 6,
+  .no_of_states = 17,
+  .states = ufsm_states,
+  .flat = false,
+  .no_of_events = 3,
+  .no_of_transitions = 14,
+  .context = {
+    .m = &AAAAAAFpTPqy7Y9RZ4A,
+    .stack = {
+      .no_of_elements = 34,
+      .data = AAAAAAFpTPqy7Y9RZ4A_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 6,
+      .data = AAAAAAFpTPqy7Y9RZ4A_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 3,
+      .data = AAAAAAFpTPqy7Y9RZ4A_completion_stack,
+    },
+  },
+  .data = AAAAAAFpTPqy7Y9RZ4A_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFpTPqy7Y9RZ4A_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFpTPqy7Y9Squw = {
+  .id = "AAAAAAFpTPqy7Y9Squw=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFpTPrA4I9Y9cs,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFpTPtVoY_INuE,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpTPtVoY_INuE = {
+  .id = "AAAAAAFpTPtVoY/INuE=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTPtVSo_3XaI,
+  .dest = &AAAAAAFpTPrA4I9Y9cs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTPrA4I9Y9cs_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTPrA4I9Y9cs = {
+  .id   = "AAAAAAFpTPrA4I9Y9cs=",
+  .name = "A",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFpTPqy7Y9Squw,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFpTPrq0o_Fq5g,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPrA4I9Y9cs_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTPtVSo_3XaI,
+};
+static struct ufsm_region AAAAAAFpTPrq0o_Fq5g = {
+  .id = "AAAAAAFpTPrq0o+Fq5g=",
+  .name = "Region2",
+  .state = &AAAAAAFpTQKar5KQwcM,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFpTQK4p5K3hPQ,
+  .parent_state = &AAAAAAFpTPrA4I9Y9cs,
+  .next = &AAAAAAFpTPrXYo9_1ow,
+};
+static struct ufsm_trigger AAAAAAFpTQK4p5K3hPQ_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpTQK4p5K3hPQ = {
+  .id = "AAAAAAFpTQK4p5K3hPQ=",
+  .name = "",
+  .trigger = AAAAAAFpTQK4p5K3hPQ_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTQJN_JJlFNs,
+  .dest = &AAAAAAFpTQKar5KQwcM,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpTQLsbpLNbY4,
+};
+static struct ufsm_trigger AAAAAAFpTQLsbpLNbY4_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpTQLsbpLNbY4 = {
+  .id = "AAAAAAFpTQLsbpLNbY4=",
+  .name = "",
+  .trigger = AAAAAAFpTQLsbpLNbY4_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTQKar5KQwcM,
+  .dest = &AAAAAAFpTQJN_JJlFNs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpTQMatJL09hA,
+};
+static struct ufsm_transition AAAAAAFpTQMatJL09hA = {
+  .id = "AAAAAAFpTQMatJL09hA=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTQMaTpLjOb4,
+  .dest = &AAAAAAFpTQJN_JJlFNs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpTQKar5KQwcM_dispatch_0[] = {
+  &AAAAAAFpTQLsbpLNbY4,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTQKar5KQwcM_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFpTQKar5KQwcM_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTQKar5KQwcM_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpTQKar5KQwcM = {
+  .id   = "AAAAAAFpTQKar5KQwcM=",
+  .name = "A22",
+  .kind = 0,
+  .index = 3,
+  .parent_region = &AAAAAAFpTPrq0o_Fq5g,
+  .entry = &AAAAAAFpTQN9XJMUDvA,
+  .doact = NULL,
+  .exit = &AAAAAAFpTQOR25MbFHM,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTQKar5KQwcM_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTQKar5KQwcM_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTQJN_JJlFNs,
+};
+static struct ufsm_entry_exit AAAAAAFpTQN9XJMUDvA = {
+  .id = "AAAAAAFpTQN9XJMUDvA=",
+  .name = "eA22",
+  .f = &eA22,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpTQOR25MbFHM = {
+  .id = "AAAAAAFpTQOR25MbFHM=",
+  .name = "xA22",
+  .f = &xA22,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpTQJN_JJlFNs_dispatch_0[] = {
+  &AAAAAAFpTQK4p5K3hPQ,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTQJN_JJlFNs_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFpTQJN_JJlFNs_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTQJN_JJlFNs_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpTQJN_JJlFNs = {
+  .id   = "AAAAAAFpTQJN+JJlFNs=",
+  .name = "A21",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &AAAAAAFpTPrq0o_Fq5g,
+  .entry = &AAAAAAFpTQNRAJMG0b8,
+  .doact = NULL,
+  .exit = &AAAAAAFpTQNnW5MN4MM,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTQJN_JJlFNs_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTQJN_JJlFNs_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTQMaTpLjOb4,
+};
+static struct ufsm_entry_exit AAAAAAFpTQNRAJMG0b8 = {
+  .id = "AAAAAAFpTQNRAJMG0b8=",
+  .name = "eA21",
+  .f = &eA21,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpTQNnW5MN4MM = {
+  .id = "AAAAAAFpTQNnW5MN4MM=",
+  .name = "xA21",
+  .f = &xA21,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTQMaTpLjOb4_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTQMaTpLjOb4 = {
+  .id   = "AAAAAAFpTQMaTpLjOb4=",
+  .name = "Init",
+  .kind = 1,
+  .index = 5,
+  .parent_region = &AAAAAAFpTPrq0o_Fq5g,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTQMaTpLjOb4_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTQMatJL09hA,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFpTPrXYo9_1ow = {
+  .id = "AAAAAAFpTPrXYo9+1ow=",
+  .name = "Region1",
+  .state = &AAAAAAFpTP4GrpDOP6k,
+  .has_history = false,
+  .history = NULL,
+  .index = 2,
+  .transition = &AAAAAAFpTPyyVJAxDW0,
+  .parent_state = &AAAAAAFpTPrA4I9Y9cs,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpTPyyVJAxDW0 = {
+  .id = "AAAAAAFpTPyyVJAxDW0=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTPyx8pAggOg,
+  .dest = &AAAAAAFpTPyQV4_532A,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpTPzJHJBCacg,
+};
+static struct ufsm_trigger AAAAAAFpTPzJHJBCacg_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpTPzJHJBCacg = {
+  .id = "AAAAAAFpTPzJHJBCacg=",
+  .name = "",
+  .trigger = AAAAAAFpTPzJHJBCacg_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 6,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTPyQV4_532A,
+  .dest = &AAAAAAFpTPsIT4_MkbI,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpTP5GdpD1dUU,
+};
+static struct ufsm_transition AAAAAAFpTP5GdpD1dUU = {
+  .id = "AAAAAAFpTP5GdpD1dUU=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 7,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTP07FJCirJk,
+  .dest = &AAAAAAFpTP4GrpDOP6k,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTP4GrpDOP6k_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTP4GrpDOP6k = {
+  .id   = "AAAAAAFpTP4GrpDOP6k=",
+  .name = "AEnd",
+  .kind = 0,
+  .index = 6,
+  .parent_region = &AAAAAAFpTPrXYo9_1ow,
+  .entry = &AAAAAAFpTQAjh5HAyTY,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTP4GrpDOP6k_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTPyQV4_532A,
+};
+static struct ufsm_entry_exit AAAAAAFpTQAjh5HAyTY = {
+  .id = "AAAAAAFpTQAjh5HAyTY=",
+  .name = "eAEnd",
+  .f = &eAEnd,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpTPyQV4_532A_dispatch_1[] = {
+  &AAAAAAFpTPzJHJBCacg,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTPyQV4_532A_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFpTPyQV4_532A_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTPyQV4_532A_interest[] = {
+  0x00000002,
+};
+static struct ufsm_state AAAAAAFpTPyQV4_532A = {
+  .id   = "AAAAAAFpTPyQV4/532A=",
+  .name = "InitA",
+  .kind = 0,
+  .index = 7,
+  .parent_region = &AAAAAAFpTPrXYo9_1ow,
+  .entry = &AAAAAAFpTRBqWJMyf1Y,
+  .doact = NULL,
+  .exit = &AAAAAAFpTRCFNpM5FJ4,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPyQV4_532A_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTPyQV4_532A_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTPsIT4_MkbI,
+};
+static struct ufsm_entry_exit AAAAAAFpTRBqWJMyf1Y = {
+  .id = "AAAAAAFpTRBqWJMyf1Y=",
+  .name = "eInitA",
+  .f = &eInitA,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpTRCFNpM5FJ4 = {
+  .id = "AAAAAAFpTRCFNpM5FJ4=",
+  .name = "xInitA",
+  .f = &xInitA,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTPsIT4_MkbI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTPsIT4_MkbI = {
+  .id   = "AAAAAAFpTPsIT4+MkbI=",
+  .name = "A1",
+  .kind = 0,
+  .index = 8,
+  .parent_region = &AAAAAAFpTPrXYo9_1ow,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFpTPvGdI_qbUc,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPsIT4_MkbI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTPyx8pAggOg,
+};
+static struct ufsm_region AAAAAAFpTPvGdI_qbUc = {
+  .id = "AAAAAAFpTPvGdI/qbUc=",
+  .name = "Region3",
+  .state = &AAAAAAFpTQFntJH3ybk,
+  .has_history = false,
+  .history = NULL,
+  .index = 3,
+  .transition = &AAAAAAFpTQGk45Ix1OU,
+  .parent_state = &AAAAAAFpTPsIT4_MkbI,
+  .next = &AAAAAAFpTPvAAo_k8PQ,
+};
+static struct ufsm_transition AAAAAAFpTQGk45Ix1OU = {
+  .id = "AAAAAAFpTQGk45Ix1OU=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 8,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTQGka5IgCTg,
+  .dest = &AAAAAAFpTQFntJH3ybk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpTQHwYpJSOfQ,
+};
+static struct ufsm_transition AAAAAAFpTQHwYpJSOfQ = {
+  .id = "AAAAAAFpTQHwYpJSOfQ=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 9,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTQFntJH3ybk,
+  .dest = &AAAAAAFpTP07FJCirJk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTQFntJH3ybk_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTQFntJH3ybk = {
+  .id   = "AAAAAAFpTQFntJH3ybk=",
+  .name = "A13",
+  .kind = 0,
+  .index = 11,
+  .parent_region = &AAAAAAFpTPvGdI_qbUc,
+  .entry = &AAAAAAFpTQHHM5JEvcw,
+  .doact = NULL,
+  .exit = &AAAAAAFpTQHaPpJL5wc,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTQFntJH3ybk_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTQHwYpJSOfQ,
+  .next = &AAAAAAFpTQGka5IgCTg,
+};
+static struct ufsm_entry_exit AAAAAAFpTQHHM5JEvcw = {
+  .id = "AAAAAAFpTQHHM5JEvcw=",
+  .name = "eA13",
+  .f = &eA13,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpTQHaPpJL5wc = {
+  .id = "AAAAAAFpTQHaPpJL5wc=",
+  .name = "xA13",
+  .f = &xA13,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTQGka5IgCTg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTQGka5IgCTg = {
+  .id   = "AAAAAAFpTQGka5IgCTg=",
+  .name = "Init",
+  .kind = 1,
+  .index = 12,
+  .parent_region = &AAAAAAFpTPvGdI_qbUc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTQGka5IgCTg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTQGk45Ix1OU,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFpTPvAAo_k8PQ = {
+  .id = "AAAAAAFpTPvAAo/k8PQ=",
+  .name = "Region2",
+  .state = &AAAAAAFpTP8ycJFrL3I,
+  .has_history = false,
+  .history = NULL,
+  .index = 4,
+  .transition = &AAAAAAFpTP8CgZFYB9M,
+  .parent_state = &AAAAAAFpTPsIT4_MkbI,
+  .next = &AAAAAAFpTPu5vY_e6J4,
+};
+static struct ufsm_transition AAAAAAFpTP8CgZFYB9M = {
+  .id = "AAAAAAFpTP8CgZFYB9M=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 10,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTP8CG5FHYbg,
+  .dest = &AAAAAAFpTP6ByZEGRSg,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpTP9mvZGSA_8,
+};
+static struct ufsm_trigger AAAAAAFpTP9mvZGSA_8_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpTP9mvZGSA_8 = {
+  .id = "AAAAAAFpTP9mvZGSA+8=",
+  .name = "",
+  .trigger = AAAAAAFpTP9mvZGSA_8_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 11,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTP6ByZEGRSg,
+  .dest = &AAAAAAFpTP8ycJFrL3I,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpTP_QeJGmLMg,
+};
+static struct ufsm_transition AAAAAAFpTP_QeJGmLMg = {
+  .id = "AAAAAAFpTP+QeJGmLMg=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 12,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTP8ycJFrL3I,
+  .dest = &AAAAAAFpTP07FJCirJk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTP8ycJFrL3I_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTP8ycJFrL3I = {
+  .id   = "AAAAAAFpTP8ycJFrL3I=",
+  .name = "A12Dummy",
+  .kind = 0,
+  .index = 13,
+  .parent_region = &AAAAAAFpTPvAAo_k8PQ,
+  .entry = &AAAAAAFpTQEIJpHoBng,
+  .doact = NULL,
+  .exit = &AAAAAAFpTQE_2ZHw3nA,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTP8ycJFrL3I_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTP_QeJGmLMg,
+  .next = &AAAAAAFpTP6ByZEGRSg,
+};
+static struct ufsm_entry_exit AAAAAAFpTQEIJpHoBng = {
+  .id = "AAAAAAFpTQEIJpHoBng=",
+  .name = "eA12Dummy",
+  .f = &eA12Dummy,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpTQE_2ZHw3nA = {
+  .id = "AAAAAAFpTQE+2ZHw3nA=",
+  .name = "xA12Dummy",
+  .f = &xA12Dummy,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpTP6ByZEGRSg_dispatch_2[] = {
+  &AAAAAAFpTP9mvZGSA_8,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTP6ByZEGRSg_dispatch[] = {
+{
+  .ev = 2,
+  .transition = AAAAAAFpTP6ByZEGRSg_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpTP6ByZEGRSg_interest[] = {
+  0x00000004,
+};
+static struct ufsm_state AAAAAAFpTP6ByZEGRSg = {
+  .id   = "AAAAAAFpTP6ByZEGRSg=",
+  .name = "A12",
+  .kind = 0,
+  .index = 14,
+  .parent_region = &AAAAAAFpTPvAAo_k8PQ,
+  .entry = &AAAAAAFpTQDbt5Ha0BQ,
+  .doact = NULL,
+  .exit = &AAAAAAFpTQDyz5Hh_uw,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTP6ByZEGRSg_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpTP6ByZEGRSg_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpTP8CG5FHYbg,
+};
+static struct ufsm_entry_exit AAAAAAFpTQDbt5Ha0BQ = {
+  .id = "AAAAAAFpTQDbt5Ha0BQ=",
+  .name = "eA12",
+  .f = &eA12,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpTQDyz5Hh_uw = {
+  .id = "AAAAAAFpTQDyz5Hh+uw=",
+  .name = "xA12",
+  .f = &xA12,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTP8CG5FHYbg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTP8CG5FHYbg = {
+  .id   = "AAAAAAFpTP8CG5FHYbg=",
+  .name = "Init",
+  .kind = 1,
+  .index = 15,
+  .parent_region = &AAAAAAFpTPvAAo_k8PQ,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTP8CG5FHYbg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTP8CgZFYB9M,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFpTPu5vY_e6J4 = {
+  .id = "AAAAAAFpTPu5vY/e6J4=",
+  .name = "Region1",
+  .state = &AAAAAAFpTPzsRZBWJsg,
+  .has_history = false,
+  .history = NULL,
+  .index = 5,
+  .transition = &AAAAAAFpTP0gwpCQh_o,
+  .parent_state = &AAAAAAFpTPsIT4_MkbI,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpTP0gwpCQh_o = {
+  .id = "AAAAAAFpTP0gwpCQh+o=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 13,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTP0gYpB_eGY,
+  .dest = &AAAAAAFpTPzsRZBWJsg,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpTP1yRZC1IgI,
+};
+static struct ufsm_transition AAAAAAFpTP1yRZC1IgI = {
+  .id = "AAAAAAFpTP1yRZC1IgI=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 14,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpTPzsRZBWJsg,
+  .dest = &AAAAAAFpTP07FJCirJk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTPzsRZBWJsg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTPzsRZBWJsg = {
+  .id   = "AAAAAAFpTPzsRZBWJsg=",
+  .name = "A11",
+  .kind = 0,
+  .index = 16,
+  .parent_region = &AAAAAAFpTPu5vY_e6J4,
+  .entry = &AAAAAAFpTQBelpHIto8,
+  .doact = NULL,
+  .exit = &AAAAAAFpTQCLfpHPCDY,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPzsRZBWJsg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTP1yRZC1IgI,
+  .next = &AAAAAAFpTP0gYpB_eGY,
+};
+static struct ufsm_entry_exit AAAAAAFpTQBelpHIto8 = {
+  .id = "AAAAAAFpTQBelpHIto8=",
+  .name = "eA11",
+  .f = &eA11,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpTQCLfpHPCDY = {
+  .id = "AAAAAAFpTQCLfpHPCDY=",
+  .name = "xA11",
+  .f = &xA11,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTP0gYpB_eGY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTP0gYpB_eGY = {
+  .id   = "AAAAAAFpTP0gYpB/eGY=",
+  .name = "Init",
+  .kind = 1,
+  .index = 17,
+  .parent_region = &AAAAAAFpTPu5vY_e6J4,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTP0gYpB_eGY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTP0gwpCQh_o,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTPyx8pAggOg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTPyx8pAggOg = {
+  .id   = "AAAAAAFpTPyx8pAggOg=",
+  .name = "Init",
+  .kind = 1,
+  .index = 9,
+  .parent_region = &AAAAAAFpTPrXYo9_1ow,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPyx8pAggOg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTPyyVJAxDW0,
+  .next = &AAAAAAFpTP07FJCirJk,
+};
+static struct ufsm_dispatch AAAAAAFpTP07FJCirJk_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTP07FJCirJk = {
+  .id   = "AAAAAAFpTP07FJCirJk=",
+  .name = "(null)",
+  .kind = 7,
+  .index = 10,
+  .parent_region = &AAAAAAFpTPrXYo9_1ow,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTP07FJCirJk_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTP5GdpD1dUU,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpTPtVSo_3XaI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpTPtVSo_3XaI = {
+  .id   = "AAAAAAFpTPtVSo+3XaI=",
+  .name = "Init",
+  .kind = 1,
+  .index = 2,
+  .parent_region = &AAAAAAFpTPqy7Y9Squw,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpTPtVSo_3XaI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpTPtVoY_INuE,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFpTPqy7Y9RZ4A; }
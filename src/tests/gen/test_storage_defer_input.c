@@ -0,0 +1,523 @@
+#include "gen/test_storage_defer_input.h"
+static struct ufsm_machine AAAAAAFjwlx6IS9AFU4;
+static struct ufsm_region AAAAAAFjwlx6Ii9BwAc;
+static struct ufsm_transition AAAAAAFjzIfCto8Ykvo;
+static struct ufsm_transition AAAAAAFjwlzTeS9_Z5A;
+static struct ufsm_transition AAAAAAFjwl3VDS_OqWs;
+static struct ufsm_transition AAAAAAFjwl4xEDAIt1g;
+static struct ufsm_transition AAAAAAFjwl52wzBEBiQ;
+static struct ufsm_transition AAAAAAFjwl6ZUjBe6eI;
+static struct ufsm_action AAAAAAFjwl_QxjB0kRA;
+static struct ufsm_state AAAAAAFjwl5dPjAe43A;
+static struct ufsm_state AAAAAAFjwl4cHS_iJm8;
+static struct ufsm_state AAAAAAFjwl3BeC_opjQ;
+static struct ufsm_state AAAAAAFjwly_pC9HPiI;
+static struct ufsm_region AAAAAAFjzIevKo8Sx8Y;
+static struct ufsm_state AAAAAAFjwl6Y7DBZZy8;
+static struct ufsm_state AAAAAAFjwlzTJy9tjJk;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjwl5dPjAe43A,
+  &AAAAAAFjwl4cHS_iJm8,
+  &AAAAAAFjwl3BeC_opjQ,
+  &AAAAAAFjwly_pC9HPiI,
+  &AAAAAAFjwl6Y7DBZZy8,
+  &AAAAAAFjwlzTJy9tjJk,
+};
+
+
+
+static void *AAAAAAFjwlx6IS9AFU4_stack[8];
+static void *AAAAAAFjwlx6IS9AFU4_stack2[2];
+static void *AAAAAAFjwlx6IS9AFU4_completion_stack[1];
+static uint32_t AAAAAAFjwlx6IS9AFU4_data[UFSM_MACHINE_DATA_SIZE(6)];
+static struct ufsm_event AAAAAAFjwlx6IS9AFU4_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_event AAAAAAFjwlx6IS9AFU4_defer_queue[UFSM_DEFER_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjwlx6IS9AFU4 = {
+  .id     = "AAAAAAFjwlx6IS9AFU4=", 
+  .name   = "DeferMachine", 
+  .region = &AAAAAAFjwlx6Ii9BwAc,    
+  .no_of_regions = 2,
+  .no_of_states = 6,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 2,
+  .no_of_transitions = 6,
+  .context = {
+    .m = &AAAAAAFjwlx6IS9AFU4,
+    .stack = {
+      .no_of_elements = 8,
+      .data = AAAAAAFjwlx6IS9AFU4_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 2,
+      .data = AAAAAAFjwlx6IS9AFU4_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjwlx6IS9AFU4_completion_stack,
+    },
+  },
+  .data = AAAAAAFjwlx6IS9AFU4_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjwlx6IS9AFU4_queue,
+  },
+  .defer_queue = {
+    .no_of_elements = UFSM_DEFER_QUEUE_SIZE,
+    .events = AAAAAAFjwlx6IS9AFU4_defer_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjwlx6Ii9BwAc = {
+  .id = "AAAAAAFjwlx6Ii9BwAc=",
+  .name = "DeferMachineregion0",
+  .state = &AAAAAAFjwl5dPjAe43A,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjzIfCto8Ykvo,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjzIfCto8Ykvo_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_D",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjzIfCto8Ykvo = {
+  .id = "AAAAAAFjzIfCto8Ykvo=",
+  .name = "",
+  .trigger = AAAAAAFjzIfCto8Ykvo_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 1,
+  .index = 1,
+  .action = NULL,
+  .defer = true,
+  .guard = NULL,
+  .source = &AAAAAAFjwly_pC9HPiI,
+  .dest = &AAAAAAFjwly_pC9HPiI,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwlzTeS9_Z5A,
+};
+static struct ufsm_transition AAAAAAFjwlzTeS9_Z5A = {
+  .id = "AAAAAAFjwlzTeS9+Z5A=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwlzTJy9tjJk,
+  .dest = &AAAAAAFjwly_pC9HPiI,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwl3VDS_OqWs,
+};
+static struct ufsm_trigger AAAAAAFjwl3VDS_OqWs_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjwl3VDS_OqWs = {
+  .id = "AAAAAAFjwl3VDS/OqWs=",
+  .name = "",
+  .trigger = AAAAAAFjwl3VDS_OqWs_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwly_pC9HPiI,
+  .dest = &AAAAAAFjwl3BeC_opjQ,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwl4xEDAIt1g,
+};
+static struct ufsm_trigger AAAAAAFjwl4xEDAIt1g_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_D",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjwl4xEDAIt1g = {
+  .id = "AAAAAAFjwl4xEDAIt1g=",
+  .name = "",
+  .trigger = AAAAAAFjwl4xEDAIt1g_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwl3BeC_opjQ,
+  .dest = &AAAAAAFjwl4cHS_iJm8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwl52wzBEBiQ,
+};
+static struct ufsm_trigger AAAAAAFjwl52wzBEBiQ_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_D",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjwl52wzBEBiQ = {
+  .id = "AAAAAAFjwl52wzBEBiQ=",
+  .name = "",
+  .trigger = AAAAAAFjwl52wzBEBiQ_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwl4cHS_iJm8,
+  .dest = &AAAAAAFjwl5dPjAe43A,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwl6ZUjBe6eI,
+};
+static struct ufsm_trigger AAAAAAFjwl6ZUjBe6eI_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_D",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjwl6ZUjBe6eI = {
+  .id = "AAAAAAFjwl6ZUjBe6eI=",
+  .name = "",
+  .trigger = AAAAAAFjwl6ZUjBe6eI_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 6,
+  .action = &AAAAAAFjwl_QxjB0kRA,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwl5dPjAe43A,
+  .dest = &AAAAAAFjwl6Y7DBZZy8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFjwl_QxjB0kRA = {
+  .id = "AAAAAAFjwl+QxjB0kRA=",
+  .name = "final",
+  .f = &final,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjwl5dPjAe43A_dispatch_0[] = {
+  &AAAAAAFjwl6ZUjBe6eI,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwl5dPjAe43A_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwl5dPjAe43A_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjwl5dPjAe43A_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjwl5dPjAe43A_flat_dispatch_0[] = {
+  &AAAAAAFjwl6ZUjBe6eI,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwl5dPjAe43A_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwl5dPjAe43A_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwl5dPjAe43A = {
+  .id   = "AAAAAAFjwl5dPjAe43A=",
+  .name = "E",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjwlx6Ii9BwAc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwl5dPjAe43A_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjwl5dPjAe43A_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjwl5dPjAe43A_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwl4cHS_iJm8,
+};
+static struct ufsm_transition * AAAAAAFjwl4cHS_iJm8_dispatch_0[] = {
+  &AAAAAAFjwl52wzBEBiQ,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwl4cHS_iJm8_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwl4cHS_iJm8_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjwl4cHS_iJm8_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjwl4cHS_iJm8_flat_dispatch_0[] = {
+  &AAAAAAFjwl52wzBEBiQ,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwl4cHS_iJm8_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwl4cHS_iJm8_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwl4cHS_iJm8 = {
+  .id   = "AAAAAAFjwl4cHS/iJm8=",
+  .name = "C",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFjwlx6Ii9BwAc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwl4cHS_iJm8_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjwl4cHS_iJm8_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjwl4cHS_iJm8_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwl3BeC_opjQ,
+};
+static struct ufsm_transition * AAAAAAFjwl3BeC_opjQ_dispatch_0[] = {
+  &AAAAAAFjwl4xEDAIt1g,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwl3BeC_opjQ_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwl3BeC_opjQ_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjwl3BeC_opjQ_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjwl3BeC_opjQ_flat_dispatch_0[] = {
+  &AAAAAAFjwl4xEDAIt1g,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwl3BeC_opjQ_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwl3BeC_opjQ_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwl3BeC_opjQ = {
+  .id   = "AAAAAAFjwl3BeC+opjQ=",
+  .name = "B",
+  .kind = 0,
+  .index = 3,
+  .parent_region = &AAAAAAFjwlx6Ii9BwAc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwl3BeC_opjQ_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjwl3BeC_opjQ_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjwl3BeC_opjQ_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwly_pC9HPiI,
+};
+static struct ufsm_transition * AAAAAAFjwly_pC9HPiI_dispatch_0[] = {
+  &AAAAAAFjzIfCto8Ykvo,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjwly_pC9HPiI_dispatch_1[] = {
+  &AAAAAAFjwl3VDS_OqWs,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwly_pC9HPiI_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwly_pC9HPiI_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = AAAAAAFjwly_pC9HPiI_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjwly_pC9HPiI_interest[] = {
+  0x00000003,
+};
+static struct ufsm_transition * AAAAAAFjwly_pC9HPiI_flat_dispatch_0[] = {
+  &AAAAAAFjzIfCto8Ykvo,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjwly_pC9HPiI_flat_dispatch_1[] = {
+  &AAAAAAFjwl3VDS_OqWs,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwly_pC9HPiI_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwly_pC9HPiI_flat_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = AAAAAAFjwly_pC9HPiI_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwly_pC9HPiI = {
+  .id   = "AAAAAAFjwly/pC9HPiI=",
+  .name = "A",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &AAAAAAFjwlx6Ii9BwAc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFjzIevKo8Sx8Y,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwly_pC9HPiI_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = AAAAAAFjwly_pC9HPiI_flat_dispatch,
+  .no_of_flat_dispatch = 2,
+  .interest = AAAAAAFjwly_pC9HPiI_interest,
+  .defer_mask = 0x00000001UL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwl6Y7DBZZy8,
+};
+static struct ufsm_region AAAAAAFjzIevKo8Sx8Y = {
+  .id = "AAAAAAFjzIevKo8Sx8Y=",
+  .name = "Region1",
+  .state = NULL,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = NULL,
+  .parent_state = &AAAAAAFjwly_pC9HPiI,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwl6Y7DBZZy8_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjwl6Y7DBZZy8_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwl6Y7DBZZy8 = {
+  .id   = "AAAAAAFjwl6Y7DBZZy8=",
+  .name = "Final",
+  .kind = 2,
+  .index = 5,
+  .parent_region = &AAAAAAFjwlx6Ii9BwAc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwl6Y7DBZZy8_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjwl6Y7DBZZy8_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwlzTJy9tjJk,
+};
+static struct ufsm_dispatch AAAAAAFjwlzTJy9tjJk_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjwlzTJy9tjJk_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwlzTJy9tjJk = {
+  .id   = "AAAAAAFjwlzTJy9tjJk=",
+  .name = "Init",
+  .kind = 1,
+  .index = 6,
+  .parent_region = &AAAAAAFjwlx6Ii9BwAc,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwlzTJy9tjJk_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjwlzTJy9tjJk_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjwlzTeS9_Z5A,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_DeferMachine(void) { return &AAAAAAFjwlx6IS9AFU4; }
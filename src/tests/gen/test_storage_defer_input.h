@@ -0,0 +1,19 @@
+#ifndef UFSM_GEN_test_storage_defer_input_H__
+#define UFSM_GEN_test_storage_defer_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* DeferMachine: depth 2, active regions 2, completion states 0, stacks 8/2/1, queues 16/16 */
+#define DeferMachine_CONTEXT_DATA_SIZE 11
+void final(void);
+enum {
+  EV_D,
+  EV,
+};
+#define DeferMachine_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(2, 6)
+#define DeferMachine_NO_OF_TIMERS 0
+#define DeferMachine_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 6, 6, 2)
+#define DeferMachine_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(6)
+struct ufsm_machine * get_DeferMachine(void);
+#endif
@@ -0,0 +1,334 @@
+#include "gen/test_terminate_input.h"
+static struct ufsm_machine AAAAAAFjwfYKcy5n9t0;
+static struct ufsm_region AAAAAAFjwfYKdC5oBn8;
+static struct ufsm_transition AAAAAAFjwfZkuS6rQUU;
+static struct ufsm_state AAAAAAFjwfYr4S5ubE0;
+static struct ufsm_region AAAAAAFjwfYr4S5vZ44;
+static struct ufsm_transition AAAAAAFjwfb43i8E62w;
+static struct ufsm_transition AAAAAAFjwfc8iS8oYe0;
+static struct ufsm_state AAAAAAFjwfa_Xi7KIfg;
+static struct ufsm_state AAAAAAFjwfcUzy8W_Fc;
+static struct ufsm_state AAAAAAFjwfb4ii7zwCI;
+static struct ufsm_entry_exit AAAAAAFjwfZ_FC68SxA;
+static struct ufsm_entry_exit AAAAAAFjwfaZby7DENk;
+static struct ufsm_state AAAAAAFjwfZkai6awuM;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjwfYr4S5ubE0,
+  &AAAAAAFjwfZkai6awuM,
+  &AAAAAAFjwfa_Xi7KIfg,
+  &AAAAAAFjwfcUzy8W_Fc,
+  &AAAAAAFjwfb4ii7zwCI,
+};
+
+
+
+static void *AAAAAAFjwfYKcy5n9t0_stack[10];
+static void *AAAAAAFjwfYKcy5n9t0_stack2[2];
+static void *AAAAAAFjwfYKcy5n9t0_completion_stack[1];
+static uint32_t AAAAAAFjwfYKcy5n9t0_data[UFSM_MACHINE_DATA_SIZE(5)];
+static struct ufsm_event AAAAAAFjwfYKcy5n9t0_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjwfYKcy5n9t0 = {
+  .id     = "AAAAAAFjwfYKcy5n9t0=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFjwfYKdC5oBn8,    
+  .no_of_regions = 2,
+  .no_of_states = 5,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 1,
+  .no_of_transitions = 3,
+  .context = {
+    .m = &AAAAAAFjwfYKcy5n9t0,
+    .stack = {
+      .no_of_elements = 10,
+      .data = AAAAAAFjwfYKcy5n9t0_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 2,
+      .data = AAAAAAFjwfYKcy5n9t0_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjwfYKcy5n9t0_completion_stack,
+    },
+  },
+  .data = AAAAAAFjwfYKcy5n9t0_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjwfYKcy5n9t0_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjwfYKdC5oBn8 = {
+  .id = "AAAAAAFjwfYKdC5oBn8=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFjwfYr4S5ubE0,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjwfZkuS6rQUU,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjwfZkuS6rQUU = {
+  .id = "AAAAAAFjwfZkuS6rQUU=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwfZkai6awuM,
+  .dest = &AAAAAAFjwfYr4S5ubE0,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwfYr4S5ubE0_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjwfYr4S5ubE0_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwfYr4S5ubE0 = {
+  .id   = "AAAAAAFjwfYr4S5ubE0=",
+  .name = "A",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjwfYKdC5oBn8,
+  .entry = &AAAAAAFjwfZ_FC68SxA,
+  .doact = NULL,
+  .exit = &AAAAAAFjwfaZby7DENk,
+  .region = &AAAAAAFjwfYr4S5vZ44,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwfYr4S5ubE0_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjwfYr4S5ubE0_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwfZkai6awuM,
+};
+static struct ufsm_region AAAAAAFjwfYr4S5vZ44 = {
+  .id = "AAAAAAFjwfYr4S5vZ44=",
+  .name = "Aregion0",
+  .state = &AAAAAAFjwfa_Xi7KIfg,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFjwfb43i8E62w,
+  .parent_state = &AAAAAAFjwfYr4S5ubE0,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjwfb43i8E62w = {
+  .id = "AAAAAAFjwfb43i8E62w=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwfb4ii7zwCI,
+  .dest = &AAAAAAFjwfa_Xi7KIfg,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjwfc8iS8oYe0,
+};
+static struct ufsm_trigger AAAAAAFjwfc8iS8oYe0_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjwfc8iS8oYe0 = {
+  .id = "AAAAAAFjwfc8iS8oYe0=",
+  .name = "",
+  .trigger = AAAAAAFjwfc8iS8oYe0_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjwfa_Xi7KIfg,
+  .dest = &AAAAAAFjwfcUzy8W_Fc,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjwfa_Xi7KIfg_dispatch_0[] = {
+  &AAAAAAFjwfc8iS8oYe0,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwfa_Xi7KIfg_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwfa_Xi7KIfg_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjwfa_Xi7KIfg_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFjwfa_Xi7KIfg_flat_dispatch_0[] = {
+  &AAAAAAFjwfc8iS8oYe0,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwfa_Xi7KIfg_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjwfa_Xi7KIfg_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwfa_Xi7KIfg = {
+  .id   = "AAAAAAFjwfa/Xi7KIfg=",
+  .name = "A1",
+  .kind = 0,
+  .index = 3,
+  .parent_region = &AAAAAAFjwfYr4S5vZ44,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwfa_Xi7KIfg_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFjwfa_Xi7KIfg_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFjwfa_Xi7KIfg_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwfcUzy8W_Fc,
+};
+static struct ufsm_dispatch AAAAAAFjwfcUzy8W_Fc_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjwfcUzy8W_Fc_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwfcUzy8W_Fc = {
+  .id   = "AAAAAAFjwfcUzy8W+Fc=",
+  .name = "(null)",
+  .kind = 11,
+  .index = 4,
+  .parent_region = &AAAAAAFjwfYr4S5vZ44,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwfcUzy8W_Fc_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjwfcUzy8W_Fc_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjwfb4ii7zwCI,
+};
+static struct ufsm_dispatch AAAAAAFjwfb4ii7zwCI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjwfb4ii7zwCI_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwfb4ii7zwCI = {
+  .id   = "AAAAAAFjwfb4ii7zwCI=",
+  .name = "Init",
+  .kind = 1,
+  .index = 5,
+  .parent_region = &AAAAAAFjwfYr4S5vZ44,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwfb4ii7zwCI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjwfb4ii7zwCI_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjwfb43i8E62w,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjwfZ_FC68SxA = {
+  .id = "AAAAAAFjwfZ+FC68SxA=",
+  .name = "eA",
+  .f = &eA,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFjwfaZby7DENk = {
+  .id = "AAAAAAFjwfaZby7DENk=",
+  .name = "xA",
+  .f = &xA,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjwfZkai6awuM_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFjwfZkai6awuM_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjwfZkai6awuM = {
+  .id   = "AAAAAAFjwfZkai6awuM=",
+  .name = "Init",
+  .kind = 1,
+  .index = 2,
+  .parent_region = &AAAAAAFjwfYKdC5oBn8,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjwfZkai6awuM_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFjwfZkai6awuM_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjwfZkuS6rQUU,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFjwfYKcy5n9t0; }
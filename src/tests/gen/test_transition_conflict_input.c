@@ -0,0 +1,490 @@
+#include "gen/test_transition_conflict_input.h"
+static struct ufsm_machine AAAAAAFppCyyascXdTs;
+static struct ufsm_region AAAAAAFppCyyascYEyk;
+static struct ufsm_transition AAAAAAFppCzQtsdV4XM;
+static struct ufsm_transition AAAAAAFppC3R08jnT64;
+static struct ufsm_state AAAAAAFppC1ZiciWozs;
+static struct ufsm_entry_exit AAAAAAFppC6smckzWf0;
+static struct ufsm_state AAAAAAFppCy_A8cecCk;
+static struct ufsm_region AAAAAAFppCzr_cdmww0;
+static struct ufsm_transition AAAAAAFppC21jMjUlYI;
+static struct ufsm_transition AAAAAAFppC3hJ8j4J9c;
+static struct ufsm_transition AAAAAAFppC4d7skPtlE;
+static struct ufsm_state AAAAAAFppC058shv31Q;
+static struct ufsm_entry_exit AAAAAAFppC6QIckseQ0;
+static struct ufsm_state AAAAAAFppC0Hy8dts6E;
+static struct ufsm_entry_exit AAAAAAFppC7Lgsk6S9w;
+static struct ufsm_entry_exit AAAAAAFppC7xI8lBkko;
+static struct ufsm_state AAAAAAFppC21UcjD6wY;
+static struct ufsm_state AAAAAAFppCzQgcdEVHY;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFppC1ZiciWozs,
+  &AAAAAAFppCy_A8cecCk,
+  &AAAAAAFppCzQgcdEVHY,
+  &AAAAAAFppC058shv31Q,
+  &AAAAAAFppC0Hy8dts6E,
+  &AAAAAAFppC21UcjD6wY,
+};
+
+
+
+static void *AAAAAAFppCyyascXdTs_stack[10];
+static void *AAAAAAFppCyyascXdTs_stack2[2];
+static void *AAAAAAFppCyyascXdTs_completion_stack[1];
+static uint32_t AAAAAAFppCyyascXdTs_data[UFSM_MACHINE_DATA_SIZE(6)];
+static struct ufsm_event AAAAAAFppCyyascXdTs_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFppCyyascXdTs = {
+  .id     = "AAAAAAFppCyyascXdTs=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFppCyyascYEyk,    
+  .no_of_regions = 2,
+  .no_of_states = 6,
+  .states = ufsm_states,
+  .flat = true,
+  .no_of_events = 2,
+  .no_of_transitions = 5,
+  .context = {
+    .m = &AAAAAAFppCyyascXdTs,
+    .stack = {
+      .no_of_elements = 10,
+      .data = AAAAAAFppCyyascXdTs_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 2,
+      .data = AAAAAAFppCyyascXdTs_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFppCyyascXdTs_completion_stack,
+    },
+  },
+  .data = AAAAAAFppCyyascXdTs_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFppCyyascXdTs_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFppCyyascYEyk = {
+  .id = "AAAAAAFppCyyascYEyk=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFppC1ZiciWozs,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFppCzQtsdV4XM,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFppCzQtsdV4XM = {
+  .id = "AAAAAAFppCzQtsdV4XM=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFppCzQgcdEVHY,
+  .dest = &AAAAAAFppCy_A8cecCk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFppC3R08jnT64,
+};
+static struct ufsm_trigger AAAAAAFppC3R08jnT64_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFppC3R08jnT64 = {
+  .id = "AAAAAAFppC3R08jnT64=",
+  .name = "",
+  .trigger = AAAAAAFppC3R08jnT64_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFppCy_A8cecCk,
+  .dest = &AAAAAAFppC1ZiciWozs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFppC1ZiciWozs_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFppC1ZiciWozs_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFppC1ZiciWozs = {
+  .id   = "AAAAAAFppC1ZiciWozs=",
+  .name = "C",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFppCyyascYEyk,
+  .entry = &AAAAAAFppC6smckzWf0,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFppC1ZiciWozs_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFppC1ZiciWozs_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFppCy_A8cecCk,
+};
+static struct ufsm_entry_exit AAAAAAFppC6smckzWf0 = {
+  .id = "AAAAAAFppC6smckzWf0=",
+  .name = "eC",
+  .f = &eC,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFppCy_A8cecCk_dispatch_0[] = {
+  &AAAAAAFppC3R08jnT64,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFppCy_A8cecCk_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFppCy_A8cecCk_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFppCy_A8cecCk_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFppCy_A8cecCk_flat_dispatch_0[] = {
+  &AAAAAAFppC3R08jnT64,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFppCy_A8cecCk_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFppCy_A8cecCk_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFppCy_A8cecCk = {
+  .id   = "AAAAAAFppCy+A8cecCk=",
+  .name = "Top",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFppCyyascYEyk,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFppCzr_cdmww0,
+  .submachine = NULL,
+  .dispatch = AAAAAAFppCy_A8cecCk_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFppCy_A8cecCk_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFppCy_A8cecCk_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFppCzQgcdEVHY,
+};
+static struct ufsm_region AAAAAAFppCzr_cdmww0 = {
+  .id = "AAAAAAFppCzr/cdmww0=",
+  .name = "Region1",
+  .state = &AAAAAAFppC058shv31Q,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFppC21jMjUlYI,
+  .parent_state = &AAAAAAFppCy_A8cecCk,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFppC21jMjUlYI = {
+  .id = "AAAAAAFppC21jMjUlYI=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFppC21UcjD6wY,
+  .dest = &AAAAAAFppC0Hy8dts6E,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFppC3hJ8j4J9c,
+};
+static struct ufsm_trigger AAAAAAFppC3hJ8j4J9c_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFppC3hJ8j4J9c = {
+  .id = "AAAAAAFppC3hJ8j4J9c=",
+  .name = "",
+  .trigger = AAAAAAFppC3hJ8j4J9c_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFppC0Hy8dts6E,
+  .dest = &AAAAAAFppC058shv31Q,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFppC4d7skPtlE,
+};
+static struct ufsm_trigger AAAAAAFppC4d7skPtlE_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFppC4d7skPtlE = {
+  .id = "AAAAAAFppC4d7skPtlE=",
+  .name = "",
+  .trigger = AAAAAAFppC4d7skPtlE_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFppC058shv31Q,
+  .dest = &AAAAAAFppC0Hy8dts6E,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFppC058shv31Q_dispatch_0[] = {
+  &AAAAAAFppC4d7skPtlE,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFppC058shv31Q_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFppC058shv31Q_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFppC058shv31Q_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFppC058shv31Q_flat_dispatch_0[] = {
+  &AAAAAAFppC4d7skPtlE,
+  &AAAAAAFppC3R08jnT64,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFppC058shv31Q_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFppC058shv31Q_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFppC058shv31Q = {
+  .id   = "AAAAAAFppC058shv31Q=",
+  .name = "B",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &AAAAAAFppCzr_cdmww0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = &AAAAAAFppC6QIckseQ0,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFppC058shv31Q_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFppC058shv31Q_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFppC058shv31Q_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFppC0Hy8dts6E,
+};
+static struct ufsm_entry_exit AAAAAAFppC6QIckseQ0 = {
+  .id = "AAAAAAFppC6QIckseQ0=",
+  .name = "xB",
+  .f = &xB,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFppC0Hy8dts6E_dispatch_1[] = {
+  &AAAAAAFppC3hJ8j4J9c,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFppC0Hy8dts6E_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFppC0Hy8dts6E_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFppC0Hy8dts6E_interest[] = {
+  0x00000003,
+};
+static struct ufsm_transition * AAAAAAFppC0Hy8dts6E_flat_dispatch_0[] = {
+  &AAAAAAFppC3R08jnT64,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFppC0Hy8dts6E_flat_dispatch_1[] = {
+  &AAAAAAFppC3hJ8j4J9c,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFppC0Hy8dts6E_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFppC0Hy8dts6E_flat_dispatch_0,
+},
+{
+  .ev = 1,
+  .transition = AAAAAAFppC0Hy8dts6E_flat_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFppC0Hy8dts6E = {
+  .id   = "AAAAAAFppC0Hy8dts6E=",
+  .name = "A",
+  .kind = 0,
+  .index = 5,
+  .parent_region = &AAAAAAFppCzr_cdmww0,
+  .entry = &AAAAAAFppC7Lgsk6S9w,
+  .doact = NULL,
+  .exit = &AAAAAAFppC7xI8lBkko,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFppC0Hy8dts6E_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = AAAAAAFppC0Hy8dts6E_flat_dispatch,
+  .no_of_flat_dispatch = 2,
+  .interest = AAAAAAFppC0Hy8dts6E_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFppC21UcjD6wY,
+};
+static struct ufsm_entry_exit AAAAAAFppC7Lgsk6S9w = {
+  .id = "AAAAAAFppC7Lgsk6S9w=",
+  .name = "eA",
+  .f = &eA,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFppC7xI8lBkko = {
+  .id = "AAAAAAFppC7xI8lBkko=",
+  .name = "xA",
+  .f = &xA,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFppC21UcjD6wY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFppC21UcjD6wY_interest[] = {
+  0x00000001,
+};
+static struct ufsm_transition * AAAAAAFppC21UcjD6wY_flat_dispatch_0[] = {
+  &AAAAAAFppC3R08jnT64,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFppC21UcjD6wY_flat_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFppC21UcjD6wY_flat_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFppC21UcjD6wY = {
+  .id   = "AAAAAAFppC21UcjD6wY=",
+  .name = "Init",
+  .kind = 1,
+  .index = 6,
+  .parent_region = &AAAAAAFppCzr_cdmww0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFppC21UcjD6wY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFppC21UcjD6wY_flat_dispatch,
+  .no_of_flat_dispatch = 1,
+  .interest = AAAAAAFppC21UcjD6wY_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFppC21jMjUlYI,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFppCzQgcdEVHY_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_dispatch AAAAAAFppCzQgcdEVHY_flat_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFppCzQgcdEVHY = {
+  .id   = "AAAAAAFppCzQgcdEVHY=",
+  .name = "Init",
+  .kind = 1,
+  .index = 3,
+  .parent_region = &AAAAAAFppCyyascYEyk,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFppCzQgcdEVHY_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = AAAAAAFppCzQgcdEVHY_flat_dispatch,
+  .no_of_flat_dispatch = 0,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFppCzQtsdV4XM,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFppCyyascXdTs; }
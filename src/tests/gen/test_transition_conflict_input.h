@@ -0,0 +1,22 @@
+#ifndef UFSM_GEN_test_transition_conflict_input_H__
+#define UFSM_GEN_test_transition_conflict_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 2, active regions 2, completion states 0, stacks 10/2/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 13
+void eC(void);
+void xB(void);
+void eA(void);
+void xA(void);
+enum {
+  EV2,
+  EV1,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(2, 6)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 5, 6, 2)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(6)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
@@ -0,0 +1,936 @@
+#include "gen/test_transition_prio_input.h"
+static struct ufsm_machine AAAAAAFpmgRsZ3AT0WU;
+static struct ufsm_region AAAAAAFpmgRsaHAUVlY;
+static struct ufsm_transition AAAAAAFpmgZomHEpAsg;
+static struct ufsm_transition AAAAAAFpml8JC3PMRuA;
+static struct ufsm_state AAAAAAFpml7t2nOmcW0;
+static struct ufsm_state AAAAAAFpmgR_ynAaheA;
+static struct ufsm_region AAAAAAFpmgSfQHBGlKM;
+static struct ufsm_transition AAAAAAFpmiKdLHFVlv8;
+static struct ufsm_state AAAAAAFpmgWo_nDXhAk;
+static struct ufsm_region AAAAAAFpmgYWTnENBCM;
+static struct ufsm_transition AAAAAAFpmiNKFXHFECU;
+static struct ufsm_state AAAAAAFpmiMRAXGLlAg;
+static struct ufsm_region AAAAAAFpmiOD2HH_UYk;
+static struct ufsm_transition AAAAAAFpmiPNMHIu9kA;
+static struct ufsm_transition AAAAAAFpmiQKMHJF4DA;
+static struct ufsm_transition AAAAAAFpmiXgZXKpYRs;
+static struct ufsm_state AAAAAAFpmiOklXIGkGY;
+static struct ufsm_entry_exit AAAAAAFpmiRNeHJi0qs;
+static struct ufsm_entry_exit AAAAAAFpmmCrOHPmj1c;
+static struct ufsm_state AAAAAAFpmiNxXnHYvhQ;
+static struct ufsm_entry_exit AAAAAAFpmiQ8unJb43A;
+static struct ufsm_state AAAAAAFpmiXgJnKY_Mc;
+static struct ufsm_entry_exit AAAAAAFpmiUi0HJ8dcI;
+static struct ufsm_entry_exit AAAAAAFpmiU8X3KDB40;
+static struct ufsm_state AAAAAAFpmiNJ3HG0wr8;
+static struct ufsm_entry_exit AAAAAAFpmiSnIHJpglA;
+static struct ufsm_entry_exit AAAAAAFpmiTGU3JwIZA;
+static struct ufsm_state AAAAAAFpmiKc9HFE928;
+static struct ufsm_region AAAAAAFpmgSOjnA_Bdg;
+static struct ufsm_transition AAAAAAFpmiK3pnF4cTw;
+static struct ufsm_state AAAAAAFpmgUYYHBdr_s;
+static struct ufsm_region AAAAAAFpmgU46XCE94U;
+static struct ufsm_transition AAAAAAFpmibINXMmx_M;
+static struct ufsm_transition AAAAAAFpmibulXM8RD4;
+static struct ufsm_transition AAAAAAFpmic5hHNj7WI;
+static struct ufsm_state AAAAAAFpmiZCfnLhA6I;
+static struct ufsm_entry_exit AAAAAAFpmiaiSHMYdaE;
+static struct ufsm_entry_exit AAAAAAFpmia1p3MfXis;
+static struct ufsm_state AAAAAAFpmiYsZnK76WU;
+static struct ufsm_entry_exit AAAAAAFpmiZ9O3MKfkc;
+static struct ufsm_entry_exit AAAAAAFpmiaRx3MRmdM;
+static struct ufsm_state AAAAAAFpmic5Q3NSUvk;
+static struct ufsm_entry_exit AAAAAAFpmiVTcnKKFgk;
+static struct ufsm_entry_exit AAAAAAFpmiVn_HKRHOA;
+static struct ufsm_state AAAAAAFpmiK3cnFn_Hg;
+static struct ufsm_entry_exit AAAAAAFpmgTnL3BPZKc;
+static struct ufsm_entry_exit AAAAAAFpmgT_wHBW_90;
+static struct ufsm_state AAAAAAFpmgZoZXEYVHQ;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFpml7t2nOmcW0,
+  &AAAAAAFpmgR_ynAaheA,
+  &AAAAAAFpmgZoZXEYVHQ,
+  &AAAAAAFpmgWo_nDXhAk,
+  &AAAAAAFpmiKc9HFE928,
+  &AAAAAAFpmgUYYHBdr_s,
+  &AAAAAAFpmiK3cnFn_Hg,
+  &AAAAAAFpmiZCfnLhA6I,
+  &AAAAAAFpmiYsZnK76WU,
+  &AAAAAAFpmic5Q3NSUvk,
+  &AAAAAAFpmiMRAXGLlAg,
+  &AAAAAAFpmiNJ3HG0wr8,
+  &AAAAAAFpmiOklXIGkGY,
+  &AAAAAAFpmiNxXnHYvhQ,
+  &AAAAAAFpmiXgJnKY_Mc,
+};
+
+
+
+static void *AAAAAAFpmgRsZ3AT0WU_stack[26];
+static void *AAAAAAFpmgRsZ3AT0WU_stack2[6];
+static void *AAAAAAFpmgRsZ3AT0WU_completion_stack[1];
+static uint32_t AAAAAAFpmgRsZ3AT0WU_data[UFSM_MACHINE_DATA_SIZE(15)];
+static struct ufsm_event AAAAAAFpmgRsZ3AT0WU_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFpmgRsZ3AT0WU = {
+  .id     = "AAAAAAFpmgRsZ3AT0WU=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFpmgRsaHAUVlY,    
+  .no_of_regions = 6,
+  .no_of_states = 15,
+  .states = ufsm_states,
+  .flat = false,
+  .no_of_events = 2,
+  .no_of_transitions = 11,
+  .context = {
+    .m = &AAAAAAFpmgRsZ3AT0WU,
+    .stack = {
+      .no_of_elements = 26,
+      .data = AAAAAAFpmgRsZ3AT0WU_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 6,
+      .data = AAAAAAFpmgRsZ3AT0WU_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFpmgRsZ3AT0WU_completion_stack,
+    },
+  },
+  .data = AAAAAAFpmgRsZ3AT0WU_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFpmgRsZ3AT0WU_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFpmgRsaHAUVlY = {
+  .id = "AAAAAAFpmgRsaHAUVlY=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFpml7t2nOmcW0,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFpmgZomHEpAsg,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpmgZomHEpAsg = {
+  .id = "AAAAAAFpmgZomHEpAsg=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmgZoZXEYVHQ,
+  .dest = &AAAAAAFpmgR_ynAaheA,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpml8JC3PMRuA,
+};
+static struct ufsm_trigger AAAAAAFpml8JC3PMRuA_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpml8JC3PMRuA = {
+  .id = "AAAAAAFpml8JC3PMRuA=",
+  .name = "",
+  .trigger = AAAAAAFpml8JC3PMRuA_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmgR_ynAaheA,
+  .dest = &AAAAAAFpml7t2nOmcW0,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpml7t2nOmcW0_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpml7t2nOmcW0 = {
+  .id   = "AAAAAAFpml7t2nOmcW0=",
+  .name = "END",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFpmgRsaHAUVlY,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpml7t2nOmcW0_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpmgR_ynAaheA,
+};
+static struct ufsm_transition * AAAAAAFpmgR_ynAaheA_dispatch_0[] = {
+  &AAAAAAFpml8JC3PMRuA,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmgR_ynAaheA_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFpmgR_ynAaheA_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmgR_ynAaheA_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpmgR_ynAaheA = {
+  .id   = "AAAAAAFpmgR+ynAaheA=",
+  .name = "A",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFpmgRsaHAUVlY,
+  .entry = &AAAAAAFpmgTnL3BPZKc,
+  .doact = NULL,
+  .exit = &AAAAAAFpmgT_wHBW_90,
+  .region = &AAAAAAFpmgSfQHBGlKM,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmgR_ynAaheA_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmgR_ynAaheA_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpmgZoZXEYVHQ,
+};
+static struct ufsm_region AAAAAAFpmgSfQHBGlKM = {
+  .id = "AAAAAAFpmgSfQHBGlKM=",
+  .name = "Region2",
+  .state = &AAAAAAFpmgWo_nDXhAk,
+  .has_history = false,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFpmiKdLHFVlv8,
+  .parent_state = &AAAAAAFpmgR_ynAaheA,
+  .next = &AAAAAAFpmgSOjnA_Bdg,
+};
+static struct ufsm_transition AAAAAAFpmiKdLHFVlv8 = {
+  .id = "AAAAAAFpmiKdLHFVlv8=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmiKc9HFE928,
+  .dest = &AAAAAAFpmgWo_nDXhAk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmgWo_nDXhAk_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmgWo_nDXhAk_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpmgWo_nDXhAk = {
+  .id   = "AAAAAAFpmgWo/nDXhAk=",
+  .name = "C",
+  .kind = 0,
+  .index = 4,
+  .parent_region = &AAAAAAFpmgSfQHBGlKM,
+  .entry = &AAAAAAFpmiSnIHJpglA,
+  .doact = NULL,
+  .exit = &AAAAAAFpmiTGU3JwIZA,
+  .region = &AAAAAAFpmgYWTnENBCM,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmgWo_nDXhAk_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmgWo_nDXhAk_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpmiKc9HFE928,
+};
+static struct ufsm_region AAAAAAFpmgYWTnENBCM = {
+  .id = "AAAAAAFpmgYWTnENBCM=",
+  .name = "Region2",
+  .state = &AAAAAAFpmiMRAXGLlAg,
+  .has_history = false,
+  .history = NULL,
+  .index = 4,
+  .transition = &AAAAAAFpmiNKFXHFECU,
+  .parent_state = &AAAAAAFpmgWo_nDXhAk,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpmiNKFXHFECU = {
+  .id = "AAAAAAFpmiNKFXHFECU=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 8,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmiNJ3HG0wr8,
+  .dest = &AAAAAAFpmiMRAXGLlAg,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmiMRAXGLlAg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmiMRAXGLlAg_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpmiMRAXGLlAg = {
+  .id   = "AAAAAAFpmiMRAXGLlAg=",
+  .name = "D",
+  .kind = 0,
+  .index = 11,
+  .parent_region = &AAAAAAFpmgYWTnENBCM,
+  .entry = &AAAAAAFpmiUi0HJ8dcI,
+  .doact = NULL,
+  .exit = &AAAAAAFpmiU8X3KDB40,
+  .region = &AAAAAAFpmiOD2HH_UYk,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmiMRAXGLlAg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmiMRAXGLlAg_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpmiNJ3HG0wr8,
+};
+static struct ufsm_region AAAAAAFpmiOD2HH_UYk = {
+  .id = "AAAAAAFpmiOD2HH+UYk=",
+  .name = "Region1",
+  .state = &AAAAAAFpmiOklXIGkGY,
+  .has_history = false,
+  .history = NULL,
+  .index = 5,
+  .transition = &AAAAAAFpmiPNMHIu9kA,
+  .parent_state = &AAAAAAFpmiMRAXGLlAg,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFpmiPNMHIu9kA_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpmiPNMHIu9kA = {
+  .id = "AAAAAAFpmiPNMHIu9kA=",
+  .name = "",
+  .trigger = AAAAAAFpmiPNMHIu9kA_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 9,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmiNxXnHYvhQ,
+  .dest = &AAAAAAFpmiOklXIGkGY,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpmiQKMHJF4DA,
+};
+static struct ufsm_trigger AAAAAAFpmiQKMHJF4DA_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpmiQKMHJF4DA = {
+  .id = "AAAAAAFpmiQKMHJF4DA=",
+  .name = "",
+  .trigger = AAAAAAFpmiQKMHJF4DA_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 10,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmiOklXIGkGY,
+  .dest = &AAAAAAFpmiNxXnHYvhQ,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpmiXgZXKpYRs,
+};
+static struct ufsm_transition AAAAAAFpmiXgZXKpYRs = {
+  .id = "AAAAAAFpmiXgZXKpYRs=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 11,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmiXgJnKY_Mc,
+  .dest = &AAAAAAFpmiNxXnHYvhQ,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpmiOklXIGkGY_dispatch_1[] = {
+  &AAAAAAFpmiQKMHJF4DA,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmiOklXIGkGY_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFpmiOklXIGkGY_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmiOklXIGkGY_interest[] = {
+  0x00000003,
+};
+static struct ufsm_state AAAAAAFpmiOklXIGkGY = {
+  .id   = "AAAAAAFpmiOklXIGkGY=",
+  .name = "F",
+  .kind = 0,
+  .index = 13,
+  .parent_region = &AAAAAAFpmiOD2HH_UYk,
+  .entry = &AAAAAAFpmiRNeHJi0qs,
+  .doact = NULL,
+  .exit = &AAAAAAFpmmCrOHPmj1c,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmiOklXIGkGY_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmiOklXIGkGY_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpmiNxXnHYvhQ,
+};
+static struct ufsm_entry_exit AAAAAAFpmiRNeHJi0qs = {
+  .id = "AAAAAAFpmiRNeHJi0qs=",
+  .name = "eF",
+  .f = &eF,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmmCrOHPmj1c = {
+  .id = "AAAAAAFpmmCrOHPmj1c=",
+  .name = "xF",
+  .f = &xF,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpmiNxXnHYvhQ_dispatch_1[] = {
+  &AAAAAAFpmiPNMHIu9kA,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmiNxXnHYvhQ_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFpmiNxXnHYvhQ_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmiNxXnHYvhQ_interest[] = {
+  0x00000003,
+};
+static struct ufsm_state AAAAAAFpmiNxXnHYvhQ = {
+  .id   = "AAAAAAFpmiNxXnHYvhQ=",
+  .name = "E",
+  .kind = 0,
+  .index = 14,
+  .parent_region = &AAAAAAFpmiOD2HH_UYk,
+  .entry = &AAAAAAFpmiQ8unJb43A,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmiNxXnHYvhQ_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmiNxXnHYvhQ_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpmiXgJnKY_Mc,
+};
+static struct ufsm_entry_exit AAAAAAFpmiQ8unJb43A = {
+  .id = "AAAAAAFpmiQ8unJb43A=",
+  .name = "eE",
+  .f = &eE,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmiXgJnKY_Mc_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmiXgJnKY_Mc_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpmiXgJnKY_Mc = {
+  .id   = "AAAAAAFpmiXgJnKY+Mc=",
+  .name = "Init",
+  .kind = 1,
+  .index = 15,
+  .parent_region = &AAAAAAFpmiOD2HH_UYk,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmiXgJnKY_Mc_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmiXgJnKY_Mc_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpmiXgZXKpYRs,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmiUi0HJ8dcI = {
+  .id = "AAAAAAFpmiUi0HJ8dcI=",
+  .name = "eD",
+  .f = &eD,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmiU8X3KDB40 = {
+  .id = "AAAAAAFpmiU8X3KDB40=",
+  .name = "xD",
+  .f = &xD,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmiNJ3HG0wr8_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmiNJ3HG0wr8_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpmiNJ3HG0wr8 = {
+  .id   = "AAAAAAFpmiNJ3HG0wr8=",
+  .name = "Init",
+  .kind = 1,
+  .index = 12,
+  .parent_region = &AAAAAAFpmgYWTnENBCM,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmiNJ3HG0wr8_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmiNJ3HG0wr8_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpmiNKFXHFECU,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmiSnIHJpglA = {
+  .id = "AAAAAAFpmiSnIHJpglA=",
+  .name = "eC",
+  .f = &eC,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmiTGU3JwIZA = {
+  .id = "AAAAAAFpmiTGU3JwIZA=",
+  .name = "xC",
+  .f = &xC,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmiKc9HFE928_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmiKc9HFE928_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpmiKc9HFE928 = {
+  .id   = "AAAAAAFpmiKc9HFE928=",
+  .name = "Init",
+  .kind = 1,
+  .index = 5,
+  .parent_region = &AAAAAAFpmgSfQHBGlKM,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmiKc9HFE928_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmiKc9HFE928_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpmiKdLHFVlv8,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFpmgSOjnA_Bdg = {
+  .id = "AAAAAAFpmgSOjnA/Bdg=",
+  .name = "Region1",
+  .state = &AAAAAAFpmgUYYHBdr_s,
+  .has_history = false,
+  .history = NULL,
+  .index = 2,
+  .transition = &AAAAAAFpmiK3pnF4cTw,
+  .parent_state = &AAAAAAFpmgR_ynAaheA,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFpmiK3pnF4cTw = {
+  .id = "AAAAAAFpmiK3pnF4cTw=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmiK3cnFn_Hg,
+  .dest = &AAAAAAFpmgUYYHBdr_s,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmgUYYHBdr_s_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmgUYYHBdr_s_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpmgUYYHBdr_s = {
+  .id   = "AAAAAAFpmgUYYHBdr+s=",
+  .name = "B",
+  .kind = 0,
+  .index = 6,
+  .parent_region = &AAAAAAFpmgSOjnA_Bdg,
+  .entry = &AAAAAAFpmiVTcnKKFgk,
+  .doact = NULL,
+  .exit = &AAAAAAFpmiVn_HKRHOA,
+  .region = &AAAAAAFpmgU46XCE94U,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmgUYYHBdr_s_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmgUYYHBdr_s_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpmiK3cnFn_Hg,
+};
+static struct ufsm_region AAAAAAFpmgU46XCE94U = {
+  .id = "AAAAAAFpmgU46XCE94U=",
+  .name = "Region1",
+  .state = &AAAAAAFpmiZCfnLhA6I,
+  .has_history = false,
+  .history = NULL,
+  .index = 3,
+  .transition = &AAAAAAFpmibINXMmx_M,
+  .parent_state = &AAAAAAFpmgUYYHBdr_s,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFpmibINXMmx_M_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpmibINXMmx_M = {
+  .id = "AAAAAAFpmibINXMmx+M=",
+  .name = "",
+  .trigger = AAAAAAFpmibINXMmx_M_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 5,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmiYsZnK76WU,
+  .dest = &AAAAAAFpmiZCfnLhA6I,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpmibulXM8RD4,
+};
+static struct ufsm_trigger AAAAAAFpmibulXM8RD4_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFpmibulXM8RD4 = {
+  .id = "AAAAAAFpmibulXM8RD4=",
+  .name = "",
+  .trigger = AAAAAAFpmibulXM8RD4_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 6,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmiZCfnLhA6I,
+  .dest = &AAAAAAFpmiYsZnK76WU,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFpmic5hHNj7WI,
+};
+static struct ufsm_transition AAAAAAFpmic5hHNj7WI = {
+  .id = "AAAAAAFpmic5hHNj7WI=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 7,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFpmic5Q3NSUvk,
+  .dest = &AAAAAAFpmiYsZnK76WU,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpmiZCfnLhA6I_dispatch_1[] = {
+  &AAAAAAFpmibulXM8RD4,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmiZCfnLhA6I_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFpmiZCfnLhA6I_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmiZCfnLhA6I_interest[] = {
+  0x00000003,
+};
+static struct ufsm_state AAAAAAFpmiZCfnLhA6I = {
+  .id   = "AAAAAAFpmiZCfnLhA6I=",
+  .name = "H",
+  .kind = 0,
+  .index = 8,
+  .parent_region = &AAAAAAFpmgU46XCE94U,
+  .entry = &AAAAAAFpmiaiSHMYdaE,
+  .doact = NULL,
+  .exit = &AAAAAAFpmia1p3MfXis,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmiZCfnLhA6I_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmiZCfnLhA6I_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpmiYsZnK76WU,
+};
+static struct ufsm_entry_exit AAAAAAFpmiaiSHMYdaE = {
+  .id = "AAAAAAFpmiaiSHMYdaE=",
+  .name = "eH",
+  .f = &eH,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmia1p3MfXis = {
+  .id = "AAAAAAFpmia1p3MfXis=",
+  .name = "xH",
+  .f = &xH,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFpmiYsZnK76WU_dispatch_1[] = {
+  &AAAAAAFpmibINXMmx_M,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmiYsZnK76WU_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFpmiYsZnK76WU_dispatch_1,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmiYsZnK76WU_interest[] = {
+  0x00000003,
+};
+static struct ufsm_state AAAAAAFpmiYsZnK76WU = {
+  .id   = "AAAAAAFpmiYsZnK76WU=",
+  .name = "G",
+  .kind = 0,
+  .index = 9,
+  .parent_region = &AAAAAAFpmgU46XCE94U,
+  .entry = &AAAAAAFpmiZ9O3MKfkc,
+  .doact = NULL,
+  .exit = &AAAAAAFpmiaRx3MRmdM,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmiYsZnK76WU_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmiYsZnK76WU_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFpmic5Q3NSUvk,
+};
+static struct ufsm_entry_exit AAAAAAFpmiZ9O3MKfkc = {
+  .id = "AAAAAAFpmiZ9O3MKfkc=",
+  .name = "eG",
+  .f = &eG,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmiaRx3MRmdM = {
+  .id = "AAAAAAFpmiaRx3MRmdM=",
+  .name = "xG",
+  .f = &xG,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmic5Q3NSUvk_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmic5Q3NSUvk_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpmic5Q3NSUvk = {
+  .id   = "AAAAAAFpmic5Q3NSUvk=",
+  .name = "Init",
+  .kind = 1,
+  .index = 10,
+  .parent_region = &AAAAAAFpmgU46XCE94U,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmic5Q3NSUvk_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmic5Q3NSUvk_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpmic5hHNj7WI,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmiVTcnKKFgk = {
+  .id = "AAAAAAFpmiVTcnKKFgk=",
+  .name = "eB",
+  .f = &eB,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmiVn_HKRHOA = {
+  .id = "AAAAAAFpmiVn+HKRHOA=",
+  .name = "xB",
+  .f = &xB,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmiK3cnFn_Hg_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFpmiK3cnFn_Hg_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFpmiK3cnFn_Hg = {
+  .id   = "AAAAAAFpmiK3cnFn/Hg=",
+  .name = "Init",
+  .kind = 1,
+  .index = 7,
+  .parent_region = &AAAAAAFpmgSOjnA_Bdg,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmiK3cnFn_Hg_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFpmiK3cnFn_Hg_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFpmiK3pnF4cTw,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmgTnL3BPZKc = {
+  .id = "AAAAAAFpmgTnL3BPZKc=",
+  .name = "eA",
+  .f = &eA,
+  .next = NULL,
+};
+static struct ufsm_entry_exit AAAAAAFpmgT_wHBW_90 = {
+  .id = "AAAAAAFpmgT+wHBW/90=",
+  .name = "xA",
+  .f = &xA,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFpmgZoZXEYVHQ_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFpmgZoZXEYVHQ = {
+  .id   = "AAAAAAFpmgZoZXEYVHQ=",
+  .name = "Init",
+  .kind = 1,
+  .index = 3,
+  .parent_region = &AAAAAAFpmgRsaHAUVlY,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFpmgZoZXEYVHQ_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFpmgZomHEpAsg,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFpmgRsZ3AT0WU; }
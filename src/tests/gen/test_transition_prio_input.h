@@ -0,0 +1,33 @@
+#ifndef UFSM_GEN_test_transition_prio_input_H__
+#define UFSM_GEN_test_transition_prio_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 4, active regions 6, completion states 0, stacks 26/6/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 33
+void eF(void);
+void xF(void);
+void eE(void);
+void eD(void);
+void xD(void);
+void eC(void);
+void xC(void);
+void eH(void);
+void xH(void);
+void eG(void);
+void xG(void);
+void eB(void);
+void xB(void);
+void eA(void);
+void xA(void);
+enum {
+  EV2,
+  EV,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(6, 15)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 11, 15, 2)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(15)
+struct ufsm_machine * get_StateMachine1(void);
+#endif
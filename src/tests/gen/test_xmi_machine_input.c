@@ -0,0 +1,1108 @@
+#include "gen/test_xmi_machine_input.h"
+static struct ufsm_machine AAAAAAFjb05fZ_ckF3A;
+static struct ufsm_region AAAAAAFjb05faOcl_JU;
+static struct ufsm_transition AAAAAAFjb06wl_d3KuU;
+static struct ufsm_transition AAAAAAFjb07M1_eL8D4;
+static struct ufsm_transition AAAAAAFjb1ILLuiaguM;
+static struct ufsm_transition AAAAAAFjb_iSlyG_OaQ;
+static struct ufsm_transition AAAAAAFjb_jQOCHWzpc;
+static struct ufsm_action AAAAAAFjb_nHuSHzaLc;
+static struct ufsm_guard AAAAAAFjoyqgKyMiLCw;
+static struct ufsm_transition AAAAAAFjoyitMCL_aE0;
+static struct ufsm_action AAAAAAFjoyprHyMcDaE;
+static struct ufsm_state AAAAAAFjb_hgySGZsW0;
+static struct ufsm_region AAAAAAFjb_p5nyIEt9w;
+static struct ufsm_transition AAAAAAFjb_yZFCL3INQ;
+static struct ufsm_transition AAAAAAFjb_zGGSMjQ2k;
+static struct ufsm_action AAAAAAFjopMTniLaqlE;
+static struct ufsm_state AAAAAAFjb_wu5SKe34I;
+static struct ufsm_state AAAAAAFjb_yGVSLmnaI;
+static struct ufsm_state AAAAAAFjb_yuVyMNgMQ;
+static struct ufsm_region AAAAAAFjb_ph7SH_kns;
+static struct ufsm_transition AAAAAAFjb_x0CyLVmgI;
+static struct ufsm_transition AAAAAAFjb_y8myMS6Ak;
+static struct ufsm_action AAAAAAFjopMAWCLX_9s;
+static struct ufsm_state AAAAAAFjb_wVyCJ4V40;
+static struct ufsm_state AAAAAAFjb_xkzCLEaHE;
+static struct ufsm_state AAAAAAFjb_ymrCMITIw;
+static struct ufsm_region AAAAAAFjb_pC_iH4Ji0;
+static struct ufsm_transition AAAAAAFjb_ugliJOoaI;
+static struct ufsm_transition AAAAAAFjmN_xCh2jV5Q;
+static struct ufsm_action AAAAAAFjopLvpyLTYvw;
+static struct ufsm_state AAAAAAFjb_uAYSIoKcE;
+static struct ufsm_state AAAAAAFjb_tq_iIX0ew;
+static struct ufsm_state AAAAAAFjb_vZeiJfbqI;
+static struct ufsm_state AAAAAAFjb06YEedR8mk;
+static struct ufsm_state AAAAAAFjb05vkucrQU8;
+static struct ufsm_state AAAAAAFjoyitBCL5Rg4;
+static struct ufsm_state AAAAAAFjb1ILBeiJ8EU;
+static struct ufsm_machine AAAAAAFjb09Cleem1fY;
+static struct ufsm_region AAAAAAFjb09CleenhBw;
+static struct ufsm_transition AAAAAAFjb0_oQef6SCg;
+static struct ufsm_transition AAAAAAFjb0_hq_gRZOw;
+static struct ufsm_transition AAAAAAFjb9xW5yFzpXs;
+static struct ufsm_state AAAAAAFjb0_StefUBfs;
+static struct ufsm_entry_exit AAAAAAFjopIOUCLEZeY;
+static struct ufsm_state AAAAAAFjb0990_euvP4;
+static struct ufsm_entry_exit AAAAAAFjopJSQSLLiRQ;
+static struct ufsm_state AAAAAAFjb1V2JOlh_Ck;
+static struct ufsm_state * const ufsm_states[] = {
+  NULL,
+  &AAAAAAFjb_hgySGZsW0,
+  &AAAAAAFjb06YEedR8mk,
+  &AAAAAAFjb05vkucrQU8,
+  &AAAAAAFjoyitBCL5Rg4,
+  &AAAAAAFjb1ILBeiJ8EU,
+  &AAAAAAFjb0_StefUBfs,
+  &AAAAAAFjb0990_euvP4,
+  &AAAAAAFjb1V2JOlh_Ck,
+  &AAAAAAFjb_wu5SKe34I,
+  &AAAAAAFjb_yGVSLmnaI,
+  &AAAAAAFjb_yuVyMNgMQ,
+  &AAAAAAFjb_wVyCJ4V40,
+  &AAAAAAFjb_xkzCLEaHE,
+  &AAAAAAFjb_ymrCMITIw,
+  &AAAAAAFjb_uAYSIoKcE,
+  &AAAAAAFjb_tq_iIX0ew,
+  &AAAAAAFjb_vZeiJfbqI,
+};
+
+
+
+static void *AAAAAAFjb05fZ_ckF3A_stack[22];
+static void *AAAAAAFjb05fZ_ckF3A_stack2[4];
+static void *AAAAAAFjb05fZ_ckF3A_completion_stack[1];
+static uint32_t AAAAAAFjb05fZ_ckF3A_data[UFSM_MACHINE_DATA_SIZE(17)];
+static struct ufsm_event AAAAAAFjb05fZ_ckF3A_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjb05fZ_ckF3A = {
+  .id     = "AAAAAAFjb05fZ+ckF3A=", 
+  .name   = "StateMachine1", 
+  .region = &AAAAAAFjb05faOcl_JU,    
+  .no_of_regions = 5,
+  .no_of_states = 17,
+  .states = ufsm_states,
+  .flat = false,
+  .no_of_events = 8,
+  .no_of_transitions = 15,
+  .context = {
+    .m = &AAAAAAFjb05fZ_ckF3A,
+    .stack = {
+      .no_of_elements = 22,
+      .data = AAAAAAFjb05fZ_ckF3A_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 4,
+      .data = AAAAAAFjb05fZ_ckF3A_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjb05fZ_ckF3A_completion_stack,
+    },
+  },
+  .data = AAAAAAFjb05fZ_ckF3A_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjb05fZ_ckF3A_queue,
+  },
+  .next = &AAAAAAFjb09Cleem1fY, 
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjb05faOcl_JU = {
+  .id = "AAAAAAFjb05faOcl+JU=",
+  .name = "StateMachine1region0",
+  .state = &AAAAAAFjb_hgySGZsW0,
+  .has_history = false,
+  .history = NULL,
+  .index = 0,
+  .transition = &AAAAAAFjb06wl_d3KuU,
+  .parent_state = NULL,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjb06wl_d3KuU_triggers[] = {
+{
+  .trigger = 1,
+  .name = "EV_A",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjb06wl_d3KuU = {
+  .id = "AAAAAAFjb06wl+d3KuU=",
+  .name = "",
+  .trigger = AAAAAAFjb06wl_d3KuU_triggers,
+  .trigger_mask = 0x00000002UL,
+  .kind = 0,
+  .index = 1,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb05vkucrQU8,
+  .dest = &AAAAAAFjb06YEedR8mk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjb07M1_eL8D4,
+};
+static struct ufsm_trigger AAAAAAFjb07M1_eL8D4_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_B",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjb07M1_eL8D4 = {
+  .id = "AAAAAAFjb07M1+eL8D4=",
+  .name = "",
+  .trigger = AAAAAAFjb07M1_eL8D4_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 2,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb06YEedR8mk,
+  .dest = &AAAAAAFjb05vkucrQU8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjb1ILLuiaguM,
+};
+static struct ufsm_transition AAAAAAFjb1ILLuiaguM = {
+  .id = "AAAAAAFjb1ILLuiaguM=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 3,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb1ILBeiJ8EU,
+  .dest = &AAAAAAFjb06YEedR8mk,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjb_iSlyG_OaQ,
+};
+static struct ufsm_trigger AAAAAAFjb_iSlyG_OaQ_triggers[] = {
+{
+  .trigger = 2,
+  .name = "EV_E",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjb_iSlyG_OaQ = {
+  .id = "AAAAAAFjb/iSlyG/OaQ=",
+  .name = "",
+  .trigger = AAAAAAFjb_iSlyG_OaQ_triggers,
+  .trigger_mask = 0x00000004UL,
+  .kind = 0,
+  .index = 4,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb05vkucrQU8,
+  .dest = &AAAAAAFjb_hgySGZsW0,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjb_jQOCHWzpc,
+};
+static struct ufsm_trigger AAAAAAFjb_jQOCHWzpc_triggers[] = {
+{
+  .trigger = 0,
+  .name = "EV_B",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjb_jQOCHWzpc = {
+  .id = "AAAAAAFjb/jQOCHWzpc=",
+  .name = "",
+  .trigger = AAAAAAFjb_jQOCHWzpc_triggers,
+  .trigger_mask = 0x00000001UL,
+  .kind = 0,
+  .index = 5,
+  .action = &AAAAAAFjb_nHuSHzaLc,
+  .defer = false,
+  .guard = &AAAAAAFjoyqgKyMiLCw,
+  .source = &AAAAAAFjb_hgySGZsW0,
+  .dest = &AAAAAAFjb05vkucrQU8,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjoyitMCL_aE0,
+};
+static struct ufsm_action AAAAAAFjb_nHuSHzaLc = {
+  .id = "AAAAAAFjb/nHuSHzaLc=",
+  .name = "DoAction",
+  .f = &DoAction,
+  .next = NULL,
+};
+static struct ufsm_guard AAAAAAFjoyqgKyMiLCw = {
+  .id = "AAAAAAFjoyqgKyMiLCw=",
+  .name = "Guard",
+  .f = &Guard,
+  .pure = false,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjoyitMCL_aE0 = {
+  .id = "AAAAAAFjoyitMCL+aE0=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 6,
+  .action = &AAAAAAFjoyprHyMcDaE,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb_hgySGZsW0,
+  .dest = &AAAAAAFjoyitBCL5Rg4,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFjoyprHyMcDaE = {
+  .id = "AAAAAAFjoyprHyMcDaE=",
+  .name = "final",
+  .f = &final,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjb_hgySGZsW0_dispatch_0[] = {
+  &AAAAAAFjb_jQOCHWzpc,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjb_hgySGZsW0_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjb_hgySGZsW0_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb_hgySGZsW0_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjb_hgySGZsW0 = {
+  .id   = "AAAAAAFjb/hgySGZsW0=",
+  .name = "E",
+  .kind = 0,
+  .index = 1,
+  .parent_region = &AAAAAAFjb05faOcl_JU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFjb_p5nyIEt9w,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb_hgySGZsW0_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb_hgySGZsW0_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFjoyitMCL_aE0,
+  .next = &AAAAAAFjb06YEedR8mk,
+};
+static struct ufsm_region AAAAAAFjb_p5nyIEt9w = {
+  .id = "AAAAAAFjb/p5nyIEt9w=",
+  .name = "Region3",
+  .state = &AAAAAAFjb_wu5SKe34I,
+  .has_history = false,
+  .history = NULL,
+  .index = 2,
+  .transition = &AAAAAAFjb_yZFCL3INQ,
+  .parent_state = &AAAAAAFjb_hgySGZsW0,
+  .next = &AAAAAAFjb_ph7SH_kns,
+};
+static struct ufsm_transition AAAAAAFjb_yZFCL3INQ = {
+  .id = "AAAAAAFjb/yZFCL3INQ=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 10,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb_yGVSLmnaI,
+  .dest = &AAAAAAFjb_wu5SKe34I,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjb_zGGSMjQ2k,
+};
+static struct ufsm_trigger AAAAAAFjb_zGGSMjQ2k_triggers[] = {
+{
+  .trigger = 5,
+  .name = "EV_E3",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjb_zGGSMjQ2k = {
+  .id = "AAAAAAFjb/zGGSMjQ2k=",
+  .name = "",
+  .trigger = AAAAAAFjb_zGGSMjQ2k_triggers,
+  .trigger_mask = 0x00000020UL,
+  .kind = 0,
+  .index = 11,
+  .action = &AAAAAAFjopMTniLaqlE,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb_wu5SKe34I,
+  .dest = &AAAAAAFjb_yuVyMNgMQ,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFjopMTniLaqlE = {
+  .id = "AAAAAAFjopMTniLaqlE=",
+  .name = "t3",
+  .f = &t3,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjb_wu5SKe34I_dispatch_5[] = {
+  &AAAAAAFjb_zGGSMjQ2k,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjb_wu5SKe34I_dispatch[] = {
+{
+  .ev = 5,
+  .transition = AAAAAAFjb_wu5SKe34I_dispatch_5,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb_wu5SKe34I_interest[] = {
+  0x00000021,
+};
+static struct ufsm_state AAAAAAFjb_wu5SKe34I = {
+  .id   = "AAAAAAFjb/wu5SKe34I=",
+  .name = "E13",
+  .kind = 0,
+  .index = 9,
+  .parent_region = &AAAAAAFjb_p5nyIEt9w,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb_wu5SKe34I_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb_wu5SKe34I_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjb_yGVSLmnaI,
+};
+static struct ufsm_dispatch AAAAAAFjb_yGVSLmnaI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb_yGVSLmnaI_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjb_yGVSLmnaI = {
+  .id   = "AAAAAAFjb/yGVSLmnaI=",
+  .name = "Init",
+  .kind = 1,
+  .index = 10,
+  .parent_region = &AAAAAAFjb_p5nyIEt9w,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb_yGVSLmnaI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb_yGVSLmnaI_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFjb_yZFCL3INQ,
+  .next = &AAAAAAFjb_yuVyMNgMQ,
+};
+static struct ufsm_dispatch AAAAAAFjb_yuVyMNgMQ_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb_yuVyMNgMQ_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjb_yuVyMNgMQ = {
+  .id   = "AAAAAAFjb/yuVyMNgMQ=",
+  .name = "Final",
+  .kind = 2,
+  .index = 11,
+  .parent_region = &AAAAAAFjb_p5nyIEt9w,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb_yuVyMNgMQ_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb_yuVyMNgMQ_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFjb_ph7SH_kns = {
+  .id = "AAAAAAFjb/ph7SH+kns=",
+  .name = "Region2",
+  .state = &AAAAAAFjb_wVyCJ4V40,
+  .has_history = false,
+  .history = NULL,
+  .index = 3,
+  .transition = &AAAAAAFjb_x0CyLVmgI,
+  .parent_state = &AAAAAAFjb_hgySGZsW0,
+  .next = &AAAAAAFjb_pC_iH4Ji0,
+};
+static struct ufsm_transition AAAAAAFjb_x0CyLVmgI = {
+  .id = "AAAAAAFjb/x0CyLVmgI=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 12,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb_xkzCLEaHE,
+  .dest = &AAAAAAFjb_wVyCJ4V40,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjb_y8myMS6Ak,
+};
+static struct ufsm_trigger AAAAAAFjb_y8myMS6Ak_triggers[] = {
+{
+  .trigger = 6,
+  .name = "EV_E2",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjb_y8myMS6Ak = {
+  .id = "AAAAAAFjb/y8myMS6Ak=",
+  .name = "",
+  .trigger = AAAAAAFjb_y8myMS6Ak_triggers,
+  .trigger_mask = 0x00000040UL,
+  .kind = 0,
+  .index = 13,
+  .action = &AAAAAAFjopMAWCLX_9s,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb_wVyCJ4V40,
+  .dest = &AAAAAAFjb_ymrCMITIw,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFjopMAWCLX_9s = {
+  .id = "AAAAAAFjopMAWCLX+9s=",
+  .name = "t2",
+  .f = &t2,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjb_wVyCJ4V40_dispatch_6[] = {
+  &AAAAAAFjb_y8myMS6Ak,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjb_wVyCJ4V40_dispatch[] = {
+{
+  .ev = 6,
+  .transition = AAAAAAFjb_wVyCJ4V40_dispatch_6,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb_wVyCJ4V40_interest[] = {
+  0x00000041,
+};
+static struct ufsm_state AAAAAAFjb_wVyCJ4V40 = {
+  .id   = "AAAAAAFjb/wVyCJ4V40=",
+  .name = "E12",
+  .kind = 0,
+  .index = 12,
+  .parent_region = &AAAAAAFjb_ph7SH_kns,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb_wVyCJ4V40_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb_wVyCJ4V40_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjb_xkzCLEaHE,
+};
+static struct ufsm_dispatch AAAAAAFjb_xkzCLEaHE_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb_xkzCLEaHE_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjb_xkzCLEaHE = {
+  .id   = "AAAAAAFjb/xkzCLEaHE=",
+  .name = "Init",
+  .kind = 1,
+  .index = 13,
+  .parent_region = &AAAAAAFjb_ph7SH_kns,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb_xkzCLEaHE_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb_xkzCLEaHE_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFjb_x0CyLVmgI,
+  .next = &AAAAAAFjb_ymrCMITIw,
+};
+static struct ufsm_dispatch AAAAAAFjb_ymrCMITIw_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb_ymrCMITIw_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjb_ymrCMITIw = {
+  .id   = "AAAAAAFjb/ymrCMITIw=",
+  .name = "Final",
+  .kind = 2,
+  .index = 14,
+  .parent_region = &AAAAAAFjb_ph7SH_kns,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb_ymrCMITIw_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb_ymrCMITIw_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = NULL,
+};
+static struct ufsm_region AAAAAAFjb_pC_iH4Ji0 = {
+  .id = "AAAAAAFjb/pC+iH4Ji0=",
+  .name = "Region1",
+  .state = &AAAAAAFjb_uAYSIoKcE,
+  .has_history = false,
+  .history = NULL,
+  .index = 4,
+  .transition = &AAAAAAFjb_ugliJOoaI,
+  .parent_state = &AAAAAAFjb_hgySGZsW0,
+  .next = NULL,
+};
+static struct ufsm_transition AAAAAAFjb_ugliJOoaI = {
+  .id = "AAAAAAFjb/ugliJOoaI=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 14,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb_tq_iIX0ew,
+  .dest = &AAAAAAFjb_uAYSIoKcE,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjmN_xCh2jV5Q,
+};
+static struct ufsm_trigger AAAAAAFjmN_xCh2jV5Q_triggers[] = {
+{
+  .trigger = 7,
+  .name = "EV_E1",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjmN_xCh2jV5Q = {
+  .id = "AAAAAAFjmN+xCh2jV5Q=",
+  .name = "",
+  .trigger = AAAAAAFjmN_xCh2jV5Q_triggers,
+  .trigger_mask = 0x00000080UL,
+  .kind = 0,
+  .index = 15,
+  .action = &AAAAAAFjopLvpyLTYvw,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb_uAYSIoKcE,
+  .dest = &AAAAAAFjb_vZeiJfbqI,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_action AAAAAAFjopLvpyLTYvw = {
+  .id = "AAAAAAFjopLvpyLTYvw=",
+  .name = "t1",
+  .f = &t1,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjb_uAYSIoKcE_dispatch_7[] = {
+  &AAAAAAFjmN_xCh2jV5Q,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjb_uAYSIoKcE_dispatch[] = {
+{
+  .ev = 7,
+  .transition = AAAAAAFjb_uAYSIoKcE_dispatch_7,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb_uAYSIoKcE_interest[] = {
+  0x00000081,
+};
+static struct ufsm_state AAAAAAFjb_uAYSIoKcE = {
+  .id   = "AAAAAAFjb/uAYSIoKcE=",
+  .name = "E11",
+  .kind = 0,
+  .index = 15,
+  .parent_region = &AAAAAAFjb_pC_iH4Ji0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb_uAYSIoKcE_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb_uAYSIoKcE_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjb_tq_iIX0ew,
+};
+static struct ufsm_dispatch AAAAAAFjb_tq_iIX0ew_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb_tq_iIX0ew_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjb_tq_iIX0ew = {
+  .id   = "AAAAAAFjb/tq/iIX0ew=",
+  .name = "Init",
+  .kind = 1,
+  .index = 16,
+  .parent_region = &AAAAAAFjb_pC_iH4Ji0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb_tq_iIX0ew_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb_tq_iIX0ew_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFjb_ugliJOoaI,
+  .next = &AAAAAAFjb_vZeiJfbqI,
+};
+static struct ufsm_dispatch AAAAAAFjb_vZeiJfbqI_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb_vZeiJfbqI_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjb_vZeiJfbqI = {
+  .id   = "AAAAAAFjb/vZeiJfbqI=",
+  .name = "Final",
+  .kind = 2,
+  .index = 17,
+  .parent_region = &AAAAAAFjb_pC_iH4Ji0,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb_vZeiJfbqI_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb_vZeiJfbqI_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjb06YEedR8mk_dispatch_0[] = {
+  &AAAAAAFjb07M1_eL8D4,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjb06YEedR8mk_dispatch[] = {
+{
+  .ev = 0,
+  .transition = AAAAAAFjb06YEedR8mk_dispatch_0,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb06YEedR8mk_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjb06YEedR8mk = {
+  .id   = "AAAAAAFjb06YEedR8mk=",
+  .name = "A",
+  .kind = 0,
+  .index = 2,
+  .parent_region = &AAAAAAFjb05faOcl_JU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = &AAAAAAFjb09CleenhBw,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb06YEedR8mk_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb06YEedR8mk_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjb05vkucrQU8,
+};
+static struct ufsm_transition * AAAAAAFjb05vkucrQU8_dispatch_1[] = {
+  &AAAAAAFjb06wl_d3KuU,
+  NULL,
+};
+static struct ufsm_transition * AAAAAAFjb05vkucrQU8_dispatch_2[] = {
+  &AAAAAAFjb_iSlyG_OaQ,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjb05vkucrQU8_dispatch[] = {
+{
+  .ev = 1,
+  .transition = AAAAAAFjb05vkucrQU8_dispatch_1,
+},
+{
+  .ev = 2,
+  .transition = AAAAAAFjb05vkucrQU8_dispatch_2,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb05vkucrQU8_interest[] = {
+  0x00000006,
+};
+static struct ufsm_state AAAAAAFjb05vkucrQU8 = {
+  .id   = "AAAAAAFjb05vkucrQU8=",
+  .name = "B",
+  .kind = 0,
+  .index = 3,
+  .parent_region = &AAAAAAFjb05faOcl_JU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb05vkucrQU8_dispatch,
+  .no_of_dispatch = 2,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb05vkucrQU8_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjoyitBCL5Rg4,
+};
+static struct ufsm_dispatch AAAAAAFjoyitBCL5Rg4_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjoyitBCL5Rg4 = {
+  .id   = "AAAAAAFjoyitBCL5Rg4=",
+  .name = "Final",
+  .kind = 2,
+  .index = 4,
+  .parent_region = &AAAAAAFjb05faOcl_JU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjoyitBCL5Rg4_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjb1ILBeiJ8EU,
+};
+static struct ufsm_dispatch AAAAAAFjb1ILBeiJ8EU_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static struct ufsm_state AAAAAAFjb1ILBeiJ8EU = {
+  .id   = "AAAAAAFjb1ILBeiJ8EU=",
+  .name = "Init",
+  .kind = 1,
+  .index = 5,
+  .parent_region = &AAAAAAFjb05faOcl_JU,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb1ILBeiJ8EU_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = NULL,
+  .time_events = NULL,
+  .completion = &AAAAAAFjb1ILLuiaguM,
+  .next = NULL,
+};
+static void *AAAAAAFjb09Cleem1fY_stack[6];
+static void *AAAAAAFjb09Cleem1fY_stack2[1];
+static void *AAAAAAFjb09Cleem1fY_completion_stack[1];
+static uint32_t AAAAAAFjb09Cleem1fY_data[UFSM_MACHINE_DATA_SIZE(17)];
+static struct ufsm_event AAAAAAFjb09Cleem1fY_queue[UFSM_QUEUE_SIZE];
+static struct ufsm_machine AAAAAAFjb09Cleem1fY = {
+  .id     = "AAAAAAFjb09Cleem1fY=", 
+  .name   = "StateMachine2", 
+  .region = &AAAAAAFjb09CleenhBw,    
+  .no_of_regions = 5,
+  .no_of_states = 17,
+  .states = ufsm_states,
+  .flat = false,
+  .no_of_events = 8,
+  .no_of_transitions = 15,
+  .context = {
+    .m = &AAAAAAFjb09Cleem1fY,
+    .stack = {
+      .no_of_elements = 6,
+      .data = AAAAAAFjb09Cleem1fY_stack,
+    },
+    .stack2 = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjb09Cleem1fY_stack2,
+    },
+    .completion_stack = {
+      .no_of_elements = 1,
+      .data = AAAAAAFjb09Cleem1fY_completion_stack,
+    },
+  },
+  .data = AAAAAAFjb09Cleem1fY_data,
+  .queue = {
+    .no_of_elements = UFSM_QUEUE_SIZE,
+    .events = AAAAAAFjb09Cleem1fY_queue,
+  },
+  .next = NULL,
+  .parent_state = NULL, 
+};
+static struct ufsm_region AAAAAAFjb09CleenhBw = {
+  .id = "AAAAAAFjb09CleenhBw=",
+  .name = "StateMachine2region0",
+  .state = &AAAAAAFjb0_StefUBfs,
+  .has_history = true,
+  .history = NULL,
+  .index = 1,
+  .transition = &AAAAAAFjb0_oQef6SCg,
+  .parent_state = &AAAAAAFjb06YEedR8mk,
+  .next = NULL,
+};
+static struct ufsm_trigger AAAAAAFjb0_oQef6SCg_triggers[] = {
+{
+  .trigger = 4,
+  .name = "EV_D",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjb0_oQef6SCg = {
+  .id = "AAAAAAFjb0+oQef6SCg=",
+  .name = "",
+  .trigger = AAAAAAFjb0_oQef6SCg_triggers,
+  .trigger_mask = 0x00000010UL,
+  .kind = 0,
+  .index = 7,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb0990_euvP4,
+  .dest = &AAAAAAFjb0_StefUBfs,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjb0_hq_gRZOw,
+};
+static struct ufsm_trigger AAAAAAFjb0_hq_gRZOw_triggers[] = {
+{
+  .trigger = 3,
+  .name = "EV_C",
+  .next = NULL,
+},
+};
+static struct ufsm_transition AAAAAAFjb0_hq_gRZOw = {
+  .id = "AAAAAAFjb0/hq+gRZOw=",
+  .name = "",
+  .trigger = AAAAAAFjb0_hq_gRZOw_triggers,
+  .trigger_mask = 0x00000008UL,
+  .kind = 0,
+  .index = 8,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb0_StefUBfs,
+  .dest = &AAAAAAFjb0990_euvP4,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = &AAAAAAFjb9xW5yFzpXs,
+};
+static struct ufsm_transition AAAAAAFjb9xW5yFzpXs = {
+  .id = "AAAAAAFjb9xW5yFzpXs=",
+  .name = "",
+  .trigger = NULL,
+  .kind = 0,
+  .index = 9,
+  .action = NULL,
+  .defer = false,
+  .guard = NULL,
+  .source = &AAAAAAFjb1V2JOlh_Ck,
+  .dest = &AAAAAAFjb0990_euvP4,
+  .lca = NULL,
+  .exit_path = NULL,
+  .enter_path = NULL,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjb0_StefUBfs_dispatch_3[] = {
+  &AAAAAAFjb0_hq_gRZOw,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjb0_StefUBfs_dispatch[] = {
+{
+  .ev = 3,
+  .transition = AAAAAAFjb0_StefUBfs_dispatch_3,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb0_StefUBfs_interest[] = {
+  0x00000009,
+};
+static struct ufsm_state AAAAAAFjb0_StefUBfs = {
+  .id   = "AAAAAAFjb0+StefUBfs=",
+  .name = "D",
+  .kind = 0,
+  .index = 6,
+  .parent_region = &AAAAAAFjb09CleenhBw,
+  .entry = &AAAAAAFjopIOUCLEZeY,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb0_StefUBfs_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb0_StefUBfs_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjb0990_euvP4,
+};
+static struct ufsm_entry_exit AAAAAAFjopIOUCLEZeY = {
+  .id = "AAAAAAFjopIOUCLEZeY=",
+  .name = "eD",
+  .f = &eD,
+  .next = NULL,
+};
+static struct ufsm_transition * AAAAAAFjb0990_euvP4_dispatch_4[] = {
+  &AAAAAAFjb0_oQef6SCg,
+  NULL,
+};
+static struct ufsm_dispatch AAAAAAFjb0990_euvP4_dispatch[] = {
+{
+  .ev = 4,
+  .transition = AAAAAAFjb0990_euvP4_dispatch_4,
+},
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb0990_euvP4_interest[] = {
+  0x00000011,
+};
+static struct ufsm_state AAAAAAFjb0990_euvP4 = {
+  .id   = "AAAAAAFjb0990+euvP4=",
+  .name = "C",
+  .kind = 0,
+  .index = 7,
+  .parent_region = &AAAAAAFjb09CleenhBw,
+  .entry = &AAAAAAFjopJSQSLLiRQ,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb0990_euvP4_dispatch,
+  .no_of_dispatch = 1,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb0990_euvP4_interest,
+  .time_events = NULL,
+  .completion = NULL,
+  .next = &AAAAAAFjb1V2JOlh_Ck,
+};
+static struct ufsm_entry_exit AAAAAAFjopJSQSLLiRQ = {
+  .id = "AAAAAAFjopJSQSLLiRQ=",
+  .name = "eC",
+  .f = &eC,
+  .next = NULL,
+};
+static struct ufsm_dispatch AAAAAAFjb1V2JOlh_Ck_dispatch[] = {
+ {
+  .ev = -1,
+  .transition = NULL,
+},
+};
+static const uint32_t AAAAAAFjb1V2JOlh_Ck_interest[] = {
+  0x00000001,
+};
+static struct ufsm_state AAAAAAFjb1V2JOlh_Ck = {
+  .id   = "AAAAAAFjb1V2JOlh/Ck=",
+  .name = "H",
+  .kind = 3,
+  .index = 8,
+  .parent_region = &AAAAAAFjb09CleenhBw,
+  .entry = NULL,
+  .doact = NULL,
+  .exit = NULL,
+  .region = NULL,
+  .submachine = NULL,
+  .dispatch = AAAAAAFjb1V2JOlh_Ck_dispatch,
+  .no_of_dispatch = 0,
+  .flat_dispatch = NULL,
+  .interest = AAAAAAFjb1V2JOlh_Ck_interest,
+  .time_events = NULL,
+  .completion = &AAAAAAFjb9xW5yFzpXs,
+  .next = NULL,
+};
+
+struct ufsm_machine * get_StateMachine1(void) { return &AAAAAAFjb05fZ_ckF3A; }
+struct ufsm_machine * get_StateMachine2(void) { return &AAAAAAFjb09Cleem1fY; }
@@ -0,0 +1,39 @@
+#ifndef UFSM_GEN_test_xmi_machine_input_H__
+#define UFSM_GEN_test_xmi_machine_input_H__
+#include <ufsm.h>
+#ifndef NULL
+ #define NULL (void *) 0
+#endif
+/* StateMachine1: depth 2, active regions 4, completion states 1, stacks 22/4/1, queues 16/0 */
+#define StateMachine1_CONTEXT_DATA_SIZE 27
+/* StateMachine2: depth 1, active regions 1, completion states 0, stacks 6/1/1, queues 16/0 */
+#define StateMachine2_CONTEXT_DATA_SIZE 8
+void eD(void);
+void eC(void);
+bool Guard(void);
+void DoAction(void);
+void final(void);
+void t3(void);
+void t2(void);
+void t1(void);
+enum {
+  EV_B,
+  EV_A,
+  EV_E,
+  EV_C,
+  EV_D,
+  EV_E3,
+  EV_E2,
+  EV_E1,
+};
+#define StateMachine1_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(5, 17)
+#define StateMachine1_NO_OF_TIMERS 0
+#define StateMachine1_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 15, 17, 8)
+#define StateMachine1_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(17)
+struct ufsm_machine * get_StateMachine1(void);
+#define StateMachine2_INSTANCE_DATA_SIZE UFSM_INSTANCE_DATA_SIZE(5, 17)
+#define StateMachine2_NO_OF_TIMERS 0
+#define StateMachine2_METRICS_DATA_SIZE(no_of_shards) UFSM_METRICS_DATA_SIZE(no_of_shards, 15, 17, 8)
+#define StateMachine2_METRICS_ENTERED_SIZE UFSM_METRICS_ENTERED_SIZE(17)
+struct ufsm_machine * get_StateMachine2(void);
+#endif
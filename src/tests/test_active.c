@@ -0,0 +1,236 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+enum events {
+    EV_A,
+    EV_B,
+};
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_state A1;
+static struct ufsm_state A2;
+static struct ufsm_state C1;
+static struct ufsm_region region1;
+static struct ufsm_region sub_region1;
+static struct ufsm_region sub_region2;
+static struct ufsm_transition transition_A;
+static struct ufsm_transition transition_B;
+static struct ufsm_transition transition_INIT;
+static struct ufsm_transition transition_A2;
+static struct ufsm_transition transition_sub1_INIT;
+static struct ufsm_transition transition_sub2_INIT;
+
+static struct ufsm_trigger a_trigger =
+{
+    .name = "EV_A",
+    .trigger = EV_A,
+    .next = NULL,
+};
+
+static struct ufsm_trigger b_trigger =
+{
+    .name = "EV_B",
+    .trigger = EV_B,
+    .next = NULL,
+};
+
+static struct ufsm_state simple_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "State A",
+    .kind = UFSM_STATE_SIMPLE,
+    .region = &sub_region1,
+    .parent_region = &region1,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "State B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_B =
+{
+    .name = "A to B",
+    .trigger = &a_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_A,
+};
+
+static struct ufsm_transition transition_A =
+{
+    .name = "B to A",
+    .trigger = &a_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B,
+    .dest = &A,
+    .next = &transition_INIT,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &simple_INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .state = &simple_INIT,
+    .transition = &transition_B,
+    .next = NULL,
+};
+
+/* First orthogonal region in A */
+
+static struct ufsm_state sub1_INIT =
+{
+    .name = "Sub 1 Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &sub_region1,
+    .next = &A1,
+};
+
+static struct ufsm_state A1 =
+{
+    .name = "State A1",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &sub_region1,
+    .next = &A2,
+};
+
+static struct ufsm_state A2 =
+{
+    .name = "State A2",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &sub_region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_A2 =
+{
+    .name = "A1 to A2",
+    .trigger = &b_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A1,
+    .dest = &A2,
+    .next = &transition_sub1_INIT,
+};
+
+static struct ufsm_transition transition_sub1_INIT =
+{
+    .name = "Init sub 1",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &sub1_INIT,
+    .dest = &A1,
+    .next = NULL,
+};
+
+static struct ufsm_region sub_region1 =
+{
+    .name = "Sub region 1",
+    .state = &sub1_INIT,
+    .transition = &transition_A2,
+    .next = &sub_region2,
+};
+
+/* Second orthogonal region in A */
+
+static struct ufsm_state sub2_INIT =
+{
+    .name = "Sub 2 Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &sub_region2,
+    .next = &C1,
+};
+
+static struct ufsm_state C1 =
+{
+    .name = "State C1",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &sub_region2,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_sub2_INIT =
+{
+    .name = "Init sub 2",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &sub2_INIT,
+    .dest = &C1,
+    .next = NULL,
+};
+
+static struct ufsm_region sub_region2 =
+{
+    .name = "Sub region 2",
+    .state = &sub2_INIT,
+    .transition = &transition_sub2_INIT,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Active Configuration Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+int main(void)
+{
+    uint32_t err;
+
+    test_init(&m);
+
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK && "Initializing");
+    assert (m.no_of_regions == 3 && m.no_of_states == 8);
+    assert (sub_region1.parent_state == &A && sub_region2.parent_state == &A);
+
+    assert (ufsm_is_active(&m, &A));
+    assert (ufsm_is_active(&m, &A1) && ufsm_is_active(&m, &C1));
+    assert (!ufsm_is_active(&m, &B) && !ufsm_is_active(&m, &A2));
+    assert (!ufsm_is_active(&m, &simple_INIT));
+    assert (!ufsm_is_active(&m, &sub1_INIT) && !ufsm_is_active(&m, &sub2_INIT));
+
+    test_process(&m, EV_B);
+    assert (ufsm_is_active(&m, &A2) && !ufsm_is_active(&m, &A1));
+    assert (ufsm_is_active(&m, &A) && ufsm_is_active(&m, &C1));
+
+    /* Leaving A deactivates both orthogonal regions */
+    test_process(&m, EV_A);
+    assert (ufsm_is_active(&m, &B));
+    assert (!ufsm_is_active(&m, &A) && !ufsm_is_active(&m, &A2));
+    assert (!ufsm_is_active(&m, &C1));
+
+    test_process(&m, EV_A);
+    assert (ufsm_is_active(&m, &A));
+    assert (ufsm_is_active(&m, &A1) && ufsm_is_active(&m, &C1));
+    assert (!ufsm_is_active(&m, &A2) && !ufsm_is_active(&m, &B));
+
+    /* Reset leaves an empty configuration */
+    err = ufsm_reset_machine(&m);
+    assert (err == UFSM_OK);
+    assert (!ufsm_is_active(&m, &A) && !ufsm_is_active(&m, &A1));
+    assert (!ufsm_is_active(&m, &C1) && !ufsm_is_active(&m, &B));
+
+    return 0;
+}
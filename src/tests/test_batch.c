@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+enum events {
+    EV_A,
+    EV_B,
+    EV_C,
+    EV_D,
+};
+
+static uint32_t no_of_releases = 0;
+
+static void release_f(struct ufsm_event *e)
+{
+    no_of_releases++;
+}
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_state C;
+static struct ufsm_state T;
+static struct ufsm_region region1;
+static struct ufsm_transition transition_B;
+static struct ufsm_transition transition_C;
+static struct ufsm_transition transition_A;
+static struct ufsm_transition transition_T;
+static struct ufsm_transition transition_INIT;
+
+static struct ufsm_trigger a_trigger =
+{
+    .name = "EV_A",
+    .trigger = EV_A,
+    .next = NULL,
+};
+
+static struct ufsm_trigger b_trigger =
+{
+    .name = "EV_B",
+    .trigger = EV_B,
+    .next = NULL,
+};
+
+static struct ufsm_trigger c_trigger =
+{
+    .name = "EV_C",
+    .trigger = EV_C,
+    .next = NULL,
+};
+
+static struct ufsm_state simple_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "State A",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "State B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &C,
+};
+
+static struct ufsm_state C =
+{
+    .name = "State C",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &T,
+};
+
+static struct ufsm_state T =
+{
+    .name = "Terminate",
+    .kind = UFSM_STATE_TERMINATE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_B =
+{
+    .name = "A to B",
+    .trigger = &a_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_C,
+};
+
+/* Completion transition */
+static struct ufsm_transition transition_C =
+{
+    .name = "B to C",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B,
+    .dest = &C,
+    .next = &transition_A,
+};
+
+static struct ufsm_transition transition_A =
+{
+    .name = "C to A",
+    .trigger = &b_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &C,
+    .dest = &A,
+    .next = &transition_T,
+};
+
+static struct ufsm_transition transition_T =
+{
+    .name = "C to Terminate",
+    .trigger = &c_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &C,
+    .dest = &T,
+    .next = &transition_INIT,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &simple_INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .state = &simple_INIT,
+    .transition = &transition_B,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Batch Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+int main(void)
+{
+    uint32_t err;
+    uint32_t processed = 0;
+    ufsm_status_t status[4];
+    struct ufsm_event burst[4] =
+    {
+        { .id = EV_A },
+        { .id = EV_B },
+        { .id = EV_D, .release = &release_f },
+        { .id = EV_A },
+    };
+
+    test_init(&m);
+
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK && "Initializing");
+    assert (m.region->current == &A);
+
+    /* The completion event from B runs before EV_B is dispatched */
+    err = ufsm_process_batch(&m, burst, 4, status, &processed);
+    assert (err == UFSM_OK);
+    assert (processed == 4);
+    assert (status[0] == UFSM_OK);
+    assert (status[1] == UFSM_OK);
+    assert (status[2] == UFSM_ERROR_EVENT_NOT_PROCESSED);
+    assert (status[3] == UFSM_OK);
+    assert (no_of_releases == 1);
+    assert (m.region->current == &C);
+
+    /* Events after termination are left to the caller */
+    burst[0].id = EV_C;
+    burst[1].id = EV_D;
+    burst[1].release = &release_f;
+
+    err = ufsm_process_batch(&m, burst, 2, NULL, &processed);
+    assert (err == UFSM_ERROR_MACHINE_TERMINATED);
+    assert (processed == 1);
+    assert (no_of_releases == 1);
+
+    err = ufsm_process_batch(&m, burst, 2, status, &processed);
+    assert (err == UFSM_ERROR_MACHINE_TERMINATED);
+    assert (processed == 0);
+
+    /* Both result arguments are optional */
+    err = ufsm_process_batch(&m, burst, 2, NULL, NULL);
+    assert (err == UFSM_ERROR_MACHINE_TERMINATED);
+
+    return 0;
+}
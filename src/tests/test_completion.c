@@ -0,0 +1,381 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+/* Completion transitions chained across regions. A completes when both of
+ * its orthogonal regions have reached their final states, which starts a
+ * chain through B and the composite C to D within the same step.
+ * */
+
+enum events {
+    EV_1,
+    EV_2,
+    EV_3,
+};
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_state C;
+static struct ufsm_state D;
+static struct ufsm_state A1;
+static struct ufsm_state A2;
+static struct ufsm_state F1;
+static struct ufsm_state F2;
+static struct ufsm_state C1;
+static struct ufsm_state FC;
+static struct ufsm_region region1;
+static struct ufsm_region region_a1;
+static struct ufsm_region region_a2;
+static struct ufsm_region region_c;
+static struct ufsm_transition transition_A_B;
+static struct ufsm_transition transition_B_A;
+static struct ufsm_transition transition_B_C;
+static struct ufsm_transition transition_C_D;
+static struct ufsm_transition transition_D_A;
+
+static void log_transition(struct ufsm_transition *t)
+{
+    test_log(", ", "%s", t->name);
+}
+
+static void step(struct ufsm_machine *m, uint32_t ev, const char *expected)
+{
+    test_step(m, ev, expected);
+
+    /* Completion events use their own lane, which is empty after a step */
+    assert (m->context.completion_stack.pos == 0);
+    assert (ufsm_get_queue(m)->s == 0);
+}
+
+static struct ufsm_trigger trigger_1 =
+{
+    .name = "EV_1",
+    .trigger = EV_1,
+};
+
+static struct ufsm_trigger trigger_2 =
+{
+    .name = "EV_2",
+    .trigger = EV_2,
+};
+
+static struct ufsm_trigger trigger_3 =
+{
+    .name = "EV_3",
+    .trigger = EV_3,
+};
+
+/* Top region */
+
+static struct ufsm_state INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "A",
+    .kind = UFSM_STATE_SIMPLE,
+    .region = &region_a1,
+    .parent_region = &region1,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &C,
+};
+
+static struct ufsm_state C =
+{
+    .name = "C",
+    .kind = UFSM_STATE_SIMPLE,
+    .region = &region_c,
+    .parent_region = &region1,
+    .next = &D,
+};
+
+static struct ufsm_state D =
+{
+    .name = "D",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &INIT,
+    .dest = &A,
+    .next = &transition_A_B,
+};
+
+static struct ufsm_transition transition_A_B =
+{
+    .name = "A to B",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_B_A,
+};
+
+/* Listed before the completion transition of B, which must still be found */
+static struct ufsm_transition transition_B_A =
+{
+    .name = "B to A",
+    .trigger = &trigger_3,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B,
+    .dest = &A,
+    .next = &transition_B_C,
+};
+
+static struct ufsm_transition transition_B_C =
+{
+    .name = "B to C",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B,
+    .dest = &C,
+    .next = &transition_C_D,
+};
+
+static struct ufsm_transition transition_C_D =
+{
+    .name = "C to D",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &C,
+    .dest = &D,
+    .next = &transition_D_A,
+};
+
+static struct ufsm_transition transition_D_A =
+{
+    .name = "D to A",
+    .trigger = &trigger_3,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &D,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .name = "Region 1",
+    .state = &INIT,
+    .transition = &transition_INIT,
+    .next = NULL,
+};
+
+/* First orthogonal region in A */
+
+static struct ufsm_state A1_INIT =
+{
+    .name = "A1 Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region_a1,
+    .next = &A1,
+};
+
+static struct ufsm_state A1 =
+{
+    .name = "A1",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region_a1,
+    .next = &F1,
+};
+
+static struct ufsm_state F1 =
+{
+    .name = "F1",
+    .kind = UFSM_STATE_FINAL,
+    .parent_region = &region_a1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_A1_F1 =
+{
+    .name = "A1 to F1",
+    .trigger = &trigger_1,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A1,
+    .dest = &F1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_A1_INIT =
+{
+    .name = "A1 Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A1_INIT,
+    .dest = &A1,
+    .next = &transition_A1_F1,
+};
+
+static struct ufsm_region region_a1 =
+{
+    .name = "Region A1",
+    .state = &A1_INIT,
+    .transition = &transition_A1_INIT,
+    .next = &region_a2,
+};
+
+/* Second orthogonal region in A */
+
+static struct ufsm_state A2_INIT =
+{
+    .name = "A2 Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region_a2,
+    .next = &A2,
+};
+
+static struct ufsm_state A2 =
+{
+    .name = "A2",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region_a2,
+    .next = &F2,
+};
+
+static struct ufsm_state F2 =
+{
+    .name = "F2",
+    .kind = UFSM_STATE_FINAL,
+    .parent_region = &region_a2,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_A2_F2 =
+{
+    .name = "A2 to F2",
+    .trigger = &trigger_2,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A2,
+    .dest = &F2,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_A2_INIT =
+{
+    .name = "A2 Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A2_INIT,
+    .dest = &A2,
+    .next = &transition_A2_F2,
+};
+
+static struct ufsm_region region_a2 =
+{
+    .name = "Region A2",
+    .state = &A2_INIT,
+    .transition = &transition_A2_INIT,
+    .next = NULL,
+};
+
+/* Region in C, which completes as soon as it is entered */
+
+static struct ufsm_state C_INIT =
+{
+    .name = "C Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region_c,
+    .next = &C1,
+};
+
+static struct ufsm_state C1 =
+{
+    .name = "C1",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region_c,
+    .next = &FC,
+};
+
+static struct ufsm_state FC =
+{
+    .name = "FC",
+    .kind = UFSM_STATE_FINAL,
+    .parent_region = &region_c,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_C1_FC =
+{
+    .name = "C1 to FC",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &C1,
+    .dest = &FC,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_C_INIT =
+{
+    .name = "C Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &C_INIT,
+    .dest = &C1,
+    .next = &transition_C1_FC,
+};
+
+static struct ufsm_region region_c =
+{
+    .name = "Region C",
+    .state = &C_INIT,
+    .transition = &transition_C_INIT,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Completion Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+int main(void)
+{
+    test_init(&m);
+    m.debug_transition = &log_transition;
+
+    test_log_clear();
+    assert (ufsm_init_machine(&m) == UFSM_OK);
+    test_log_expect("Init, A2 Init, A1 Init");
+
+    /* Each state points to its first transition without a trigger */
+    assert (A.completion == &transition_A_B);
+    assert (B.completion == &transition_B_C);
+    assert (C.completion == &transition_C_D);
+    assert (C1.completion == &transition_C1_FC);
+    assert (D.completion == NULL);
+    assert (A1.completion == NULL);
+
+    /* One region done is not enough */
+    step(&m, EV_1, "A1 to F1");
+    assert (region1.current == &A);
+    assert (region_a1.current == &F1 && region_a2.current == &A2);
+
+    /* The whole chain runs before ufsm_process returns */
+    step(&m, EV_2, "A2 to F2, A to B, B to C, C Init, C1 to FC, C to D");
+    assert (region1.current == &D);
+    assert (ufsm_is_active(&m, &D) && !ufsm_is_active(&m, &C));
+
+    /* D has no completion transition and waits for EV_3 */
+    assert (ufsm_process(&m, EV_1) == UFSM_ERROR_EVENT_NOT_PROCESSED);
+
+    /* The regions complete in the other order */
+    step(&m, EV_3, "D to A, A2 Init, A1 Init");
+    step(&m, EV_2, "A2 to F2");
+    step(&m, EV_1, "A1 to F1, A to B, B to C, C Init, C1 to FC, C to D");
+    assert (region1.current == &D);
+
+    return 0;
+}
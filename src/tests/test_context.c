@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <pthread.h>
+#include <ufsm.h>
+#include <test_context_input.h>
+#include "common.h"
+
+/* Instances of one machine processed on two threads at once, each on a
+ * context of its own. The machine is only read while they run.
+ * */
+
+#define NO_OF_THREADS 2
+#define NO_OF_ROUNDS 10000
+
+void final(void) {}
+void eB(void) {}
+void eA2(void) {}
+void xA2(void) {}
+void eA1(void) {}
+void xA1(void) {}
+void eE(void) {}
+void xE(void) {}
+void eD(void) {}
+void xD(void) {}
+void eC(void) {}
+void xC(void) {}
+void eA(void) {}
+void xA(void) {}
+
+struct worker
+{
+    struct ufsm_machine *m;
+    struct ufsm_instance i;
+    struct ufsm_context c;
+    uint32_t data[StateMachine1_INSTANCE_DATA_SIZE];
+    void *stacks[StateMachine1_CONTEXT_DATA_SIZE];
+    struct ufsm_state *D;
+    uint32_t rounds;
+};
+
+static struct ufsm_state *find_state(struct ufsm_machine *m,
+                                     const char *name)
+{
+    for (uint32_t n = 1; n <= m->no_of_states; n++)
+    {
+        if (m->states[n]->name && strcmp(m->states[n]->name, name) == 0)
+            return m->states[n];
+    }
+
+    return NULL;
+}
+
+static void process(struct worker *w, int32_t ev)
+{
+    assert (ufsm_process_instance(w->m, &w->i, ev) == UFSM_OK);
+    assert (w->c.stack.pos == 0 && w->c.completion_stack.pos == 0);
+    assert (ufsm_get_context_event(&w->c) == NULL);
+}
+
+static void * worker_thread(void *arg)
+{
+    struct worker *w = (struct worker *) arg;
+
+    for (; w->rounds < NO_OF_ROUNDS; w->rounds++)
+    {
+        assert (ufsm_reset_machine_instance(w->m, &w->i) == UFSM_OK);
+        assert (ufsm_init_machine_instance(w->m, &w->i) == UFSM_OK);
+
+        /* Into D, out to B and back through the deep history */
+        process(w, EV_A);
+        process(w, EV_1);
+        process(w, EV_1);
+        process(w, EV_1);
+        process(w, EV_B);
+        assert (!ufsm_is_active_instance(w->m, &w->i, w->D));
+        process(w, EV_A);
+        assert (ufsm_is_active_instance(w->m, &w->i, w->D));
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    struct ufsm_machine *m = get_StateMachine1();
+    struct ufsm_machine before;
+    static struct worker workers[NO_OF_THREADS];
+    pthread_t threads[NO_OF_THREADS];
+    void *too_small[1];
+
+    assert (ufsm_context_init(&workers[0].c, m, 1, too_small) == UFSM_ERROR);
+
+    for (uint32_t n = 0; n < NO_OF_THREADS; n++)
+    {
+        struct worker *w = &workers[n];
+
+        w->m = m;
+        w->D = find_state(m, "D");
+        assert (w->D != NULL);
+        assert (ufsm_instance_init(&w->i, m, StateMachine1_INSTANCE_DATA_SIZE,
+                                                        w->data) == UFSM_OK);
+        assert (ufsm_context_init(&w->c, m, StateMachine1_CONTEXT_DATA_SIZE,
+                                                        w->stacks) == UFSM_OK);
+        w->i.context = &w->c;
+    }
+
+    memcpy(&before, m, sizeof(before));
+
+    for (uint32_t n = 0; n < NO_OF_THREADS; n++)
+        assert (pthread_create(&threads[n], NULL, &worker_thread,
+                                                    &workers[n]) == 0);
+
+    for (uint32_t n = 0; n < NO_OF_THREADS; n++)
+        assert (pthread_join(threads[n], NULL) == 0);
+
+    for (uint32_t n = 0; n < NO_OF_THREADS; n++)
+        assert (workers[n].rounds == NO_OF_ROUNDS);
+
+    /* Nothing of the step was left in the shared definition */
+    assert (memcmp(&before, m, sizeof(before)) == 0);
+    assert (m->region->current == NULL);
+
+    return 0;
+}
@@ -0,0 +1,247 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+enum events {
+    EV_X,
+    EV_Y,
+    EV_NEXT,
+};
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_state C;
+static struct ufsm_region region1;
+static struct ufsm_transition transition_defer_AX;
+static struct ufsm_transition transition_defer_AY;
+static struct ufsm_transition transition_defer_BX;
+static struct ufsm_transition transition_B;
+static struct ufsm_transition transition_C;
+static struct ufsm_transition transition_INIT;
+
+static struct ufsm_trigger x_trigger =
+{
+    .name = "EV_X",
+    .trigger = EV_X,
+    .next = NULL,
+};
+
+static struct ufsm_trigger y_trigger =
+{
+    .name = "EV_Y",
+    .trigger = EV_Y,
+    .next = NULL,
+};
+
+static struct ufsm_trigger next_trigger =
+{
+    .name = "EV_NEXT",
+    .trigger = EV_NEXT,
+    .next = NULL,
+};
+
+static struct ufsm_state simple_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "State A",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "State B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &C,
+};
+
+static struct ufsm_state C =
+{
+    .name = "State C",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+/* A defers EV_X and EV_Y, B only EV_X */
+static struct ufsm_transition transition_defer_AX =
+{
+    .name = "A defers EV_X",
+    .defer = true,
+    .trigger = &x_trigger,
+    .kind = UFSM_TRANSITION_INTERNAL,
+    .source = &A,
+    .dest = &A,
+    .next = &transition_defer_AY,
+};
+
+static struct ufsm_transition transition_defer_AY =
+{
+    .name = "A defers EV_Y",
+    .defer = true,
+    .trigger = &y_trigger,
+    .kind = UFSM_TRANSITION_INTERNAL,
+    .source = &A,
+    .dest = &A,
+    .next = &transition_defer_BX,
+};
+
+static struct ufsm_transition transition_defer_BX =
+{
+    .name = "B defers EV_X",
+    .defer = true,
+    .trigger = &x_trigger,
+    .kind = UFSM_TRANSITION_INTERNAL,
+    .source = &B,
+    .dest = &B,
+    .next = &transition_B,
+};
+
+static struct ufsm_transition transition_B =
+{
+    .name = "A to B",
+    .trigger = &next_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_C,
+};
+
+static struct ufsm_transition transition_C =
+{
+    .name = "B to C",
+    .trigger = &next_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B,
+    .dest = &C,
+    .next = &transition_INIT,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &simple_INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .state = &simple_INIT,
+    .transition = &transition_defer_AX,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Defer Release Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+static struct ufsm_event spsc_data[4];
+
+static void post(uint32_t ev, uint8_t tag)
+{
+    struct ufsm_event e =
+    {
+        .id = ev,
+        .size = 1,
+        .data = { tag },
+    };
+
+    ufsm_process_event(&m, &e);
+}
+
+static uint32_t count(struct ufsm_queue *q)
+{
+    struct ufsm_event e;
+    uint32_t n = 0;
+
+    while (ufsm_queue_peek_event(q, n, &e) == UFSM_OK)
+        n++;
+
+    return n;
+}
+
+int main(void)
+{
+    uint32_t err;
+    struct ufsm_event e;
+    const uint8_t tags[] = {1, 3, 4};
+
+    test_init(&m);
+
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK && "Initializing");
+
+    post(EV_X, 1);
+    post(EV_Y, 2);
+    post(EV_X, 3);
+    assert (m.defer_queue.s == 3);
+    assert (m.queue.s == 0);
+
+    /* Only EV_Y is released, the EV_X events stay deferred in order */
+    err = ufsm_process(&m, EV_NEXT);
+    assert (err == UFSM_OK);
+    assert (m.region->current == &B);
+    assert (m.queue.s == 1);
+    assert (m.defer_queue.s == 2);
+
+    assert (ufsm_queue_get_event(&m.queue, &e) == UFSM_OK);
+    assert (e.id == EV_Y && e.data[0] == 2);
+
+    /* Deferring in B doesn't touch the event queue */
+    post(EV_X, 4);
+    assert (m.queue.s == 0);
+    assert (m.defer_queue.s == 3);
+
+    err = ufsm_process(&m, EV_NEXT);
+    assert (err == UFSM_OK);
+    assert (m.region->current == &C);
+    assert (m.defer_queue.s == 0);
+    assert (m.queue.s == 3);
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        assert (ufsm_queue_get_event(&m.queue, &e) == UFSM_OK);
+        assert (e.id == EV_X && e.data[0] == tags[i]);
+    }
+
+    /* Lock-free defer queues don't keep a count, the events are released
+     * all the same.
+     * */
+    assert (ufsm_reset_machine(&m) == UFSM_OK);
+    assert (ufsm_init_machine(&m) == UFSM_OK);
+    assert (ufsm_queue_init_spsc(&m.defer_queue, 4, spsc_data) == UFSM_OK);
+
+    post(EV_X, 1);
+    post(EV_Y, 2);
+    assert (count(&m.defer_queue) == 2);
+
+    err = ufsm_process(&m, EV_NEXT);
+    assert (err == UFSM_OK);
+    assert (count(&m.defer_queue) == 1);
+    assert (ufsm_queue_get_event(&m.queue, &e) == UFSM_OK);
+    assert (e.id == EV_Y && e.data[0] == 2);
+
+    err = ufsm_process(&m, EV_NEXT);
+    assert (err == UFSM_OK);
+    assert (count(&m.defer_queue) == 0);
+    assert (ufsm_queue_get_event(&m.queue, &e) == UFSM_OK);
+    assert (e.id == EV_X && e.data[0] == 1);
+
+    return 0;
+}
@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+
+enum events {
+    EV_A,
+    EV_B,
+    EV_C,
+    EV_D,
+};
+
+static bool flag_guard_ret = false;
+static bool flag_action_called = false;
+
+static bool guard_f(void) {
+    return flag_guard_ret;
+}
+
+static void action_f(void) {
+    flag_action_called = true;
+}
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_region region1;
+static struct ufsm_transition simple_transition_A;
+static struct ufsm_transition simple_transition_B1;
+static struct ufsm_transition simple_transition_B2;
+
+static struct ufsm_transition *A_dispatch_EV_B[] =
+{
+    &simple_transition_B1,
+    &simple_transition_B2,
+    NULL,
+};
+
+static struct ufsm_dispatch A_dispatch[] =
+{
+    {
+        .ev = EV_B,
+        .transition = A_dispatch_EV_B,
+    },
+};
+
+static struct ufsm_transition *B_dispatch_EV_A[] =
+{
+    &simple_transition_A,
+    NULL,
+};
+
+static struct ufsm_dispatch B_dispatch[] =
+{
+    {
+        .ev = EV_A,
+        .transition = B_dispatch_EV_A,
+    },
+    {
+        .ev = EV_C,
+        .transition = B_dispatch_EV_A,
+    },
+};
+
+static struct ufsm_state simple_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A
+};
+
+static struct ufsm_state B =
+{
+    .name = "State B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .dispatch = B_dispatch,
+    .no_of_dispatch = 2,
+    .next = NULL,
+};
+
+static struct ufsm_state A =
+{
+    .name = "State A",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .dispatch = A_dispatch,
+    .no_of_dispatch = 1,
+    .next = &B,
+};
+
+static struct ufsm_guard guard =
+{
+    .name = "guard",
+    .f = &guard_f,
+    .next = NULL,
+};
+
+static struct ufsm_action action =
+{
+    .name = "action",
+    .f = &action_f,
+    .next = NULL,
+};
+
+static struct ufsm_trigger b_trigger =
+{
+    .name = "EV_B",
+    .trigger = EV_B,
+    .next = NULL,
+};
+
+static struct ufsm_trigger c_trigger =
+{
+    .name = "EV_C",
+    .trigger = EV_C,
+    .next = NULL,
+};
+
+static struct ufsm_trigger a_trigger =
+{
+    .name = "EV_A",
+    .trigger = EV_A,
+    .next = &c_trigger,
+};
+
+static struct ufsm_transition simple_transition_B2 =
+{
+    .trigger = &b_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = NULL
+};
+
+static struct ufsm_transition simple_transition_B1 =
+{
+    .trigger = &b_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .guard = &guard,
+    .action = &action,
+    .source = &A,
+    .dest = &B,
+    .next = &simple_transition_B2,
+};
+
+static struct ufsm_transition simple_transition_A =
+{
+    .trigger = &a_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B,
+    .dest = &A,
+    .next = &simple_transition_B1,
+};
+
+static struct ufsm_transition simple_transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &simple_INIT,
+    .trigger = NULL,
+    .dest = &A,
+    .next = &simple_transition_A,
+};
+
+static struct ufsm_region region1 =
+{
+    .state = &simple_INIT,
+    .transition = &simple_transition_INIT,
+    .next = NULL
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Dispatch Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+int main(void) {
+    uint32_t err;
+
+    test_init(&m);
+
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK && "Initializing");
+    assert (m.region->current == &A);
+
+    /* No dispatch entry for EV_A or EV_D in state A */
+    err = ufsm_process(&m, EV_A);
+    assert (m.region->current == &A && err == UFSM_ERROR_EVENT_NOT_PROCESSED);
+    err = ufsm_process(&m, EV_D);
+    assert (m.region->current == &A && err == UFSM_ERROR_EVENT_NOT_PROCESSED);
+
+    /* First candidate is guarded, the second one is taken */
+    err = ufsm_process(&m, EV_B);
+    assert (m.region->current == &B && err == UFSM_OK);
+    assert (!flag_action_called);
+
+    /* Second trigger of a transition */
+    err = ufsm_process(&m, EV_C);
+    assert (m.region->current == &A && err == UFSM_OK);
+
+    flag_guard_ret = true;
+    err = ufsm_process(&m, EV_B);
+    assert (m.region->current == &B && err == UFSM_OK);
+    assert (flag_action_called);
+
+    err = ufsm_process(&m, EV_A);
+    assert (m.region->current == &A && err == UFSM_OK);
+
+    return 0;
+}
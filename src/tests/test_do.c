@@ -18,12 +18,12 @@ void eA(void)
     assert (!flag_dA_stop);
 }
 
-void dA_start(struct ufsm_machine *m,
+void dA_start(struct ufsm_context *c,
         struct ufsm_state *s,
         ufsm_doact_cb_t cb)
 {
     if (call_cb)
-        cb(m,s);
+        cb(c,s);
 }
 
 void dA_stop(void)
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <ufsm.h>
+#include <test_do_context_input.h>
+#include "common.h"
+
+/* The chart of test_do run as instances with contexts of their own. The
+ * do-activity completes on the context that entered its state, both from
+ * within its start function and later between steps.
+ * */
+
+static bool flag_final = false;
+static bool call_cb = true;
+static struct ufsm_context *started_c = NULL;
+static struct ufsm_state *started_s = NULL;
+static ufsm_doact_cb_t started_cb = NULL;
+
+void eA(void) {}
+void xA(void) {}
+void dA_stop(void) {}
+
+void dA_start(struct ufsm_context *c,
+              struct ufsm_state *s,
+              ufsm_doact_cb_t cb)
+{
+    started_c = c;
+    started_s = s;
+    started_cb = cb;
+
+    if (call_cb)
+        cb(c, s);
+}
+
+void final(void)
+{
+    flag_final = true;
+}
+
+struct session
+{
+    struct ufsm_instance i;
+    struct ufsm_context c;
+    uint32_t data[StateMachine1_INSTANCE_DATA_SIZE];
+    void *stacks[StateMachine1_CONTEXT_DATA_SIZE];
+};
+
+static void session_init(struct ufsm_machine *m, struct session *s)
+{
+    assert (ufsm_instance_init(&s->i, m, StateMachine1_INSTANCE_DATA_SIZE,
+                                                    s->data) == UFSM_OK);
+    assert (ufsm_context_init(&s->c, m, StateMachine1_CONTEXT_DATA_SIZE,
+                                                    s->stacks) == UFSM_OK);
+    s->i.context = &s->c;
+}
+
+int main(void)
+{
+    struct ufsm_machine *m = get_StateMachine1();
+    struct ufsm_machine before;
+    struct session s1;
+    struct session s2;
+
+    session_init(m, &s1);
+    session_init(m, &s2);
+    memcpy(&before, m, sizeof(before));
+
+    /* Completes within the start function */
+    assert (ufsm_init_machine_instance(m, &s1.i) == UFSM_OK);
+    assert (started_c == &s1.c && flag_final);
+    assert (s1.c.completion_stack.pos == 0);
+
+    /* Completes after the step that entered A */
+    call_cb = false;
+    flag_final = false;
+    assert (ufsm_init_machine_instance(m, &s2.i) == UFSM_OK);
+    assert (started_c == &s2.c && !flag_final);
+
+    /* The completion waits on the context of s2, s1 is not affected */
+    assert (started_cb(started_c, started_s) == UFSM_OK);
+    assert (s2.c.completion_stack.pos == 1);
+    assert (ufsm_process_instance(m, &s1.i, EV) ==
+                                    UFSM_ERROR_EVENT_NOT_PROCESSED);
+    assert (!flag_final && s2.c.completion_stack.pos == 1);
+
+    /* and is taken at the next step of s2 */
+    ufsm_process_instance(m, &s2.i, EV);
+    assert (flag_final);
+    assert (s2.c.completion_stack.pos == 0);
+
+    /* Nothing was written to the shared definition */
+    assert (memcmp(&before, m, sizeof(before)) == 0);
+
+    return 0;
+}
@@ -0,0 +1,272 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+enum events {
+    EV_A,
+    EV_B,
+    EV_C,
+};
+
+static struct ufsm_machine m;
+static uint8_t rx_buffer[64];
+static uint32_t no_of_releases = 0;
+static const void *action_payload = NULL;
+static uint32_t inline_value = 0;
+static uint32_t id_queue_data[2];
+static struct ufsm_queue id_queue;
+
+static void release_f(struct ufsm_event *e)
+{
+    assert (e->ptr == rx_buffer);
+    no_of_releases++;
+}
+
+static bool guard_f(void)
+{
+    const struct ufsm_event *e = ufsm_get_event(&m);
+
+    return (e && e->size == sizeof(rx_buffer));
+}
+
+static void action_f(void)
+{
+    action_payload = ufsm_event_data(ufsm_get_event(&m));
+}
+
+static void inline_action_f(void)
+{
+    memcpy(&inline_value, ufsm_event_data(ufsm_get_event(&m)),
+                                            sizeof(inline_value));
+}
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_state C;
+static struct ufsm_region region1;
+static struct ufsm_transition transition_defer;
+static struct ufsm_transition transition_B;
+static struct ufsm_transition transition_C;
+static struct ufsm_transition transition_C2;
+static struct ufsm_transition transition_INIT;
+
+static struct ufsm_trigger a_trigger =
+{
+    .name = "EV_A",
+    .trigger = EV_A,
+    .next = NULL,
+};
+
+static struct ufsm_trigger b_trigger =
+{
+    .name = "EV_B",
+    .trigger = EV_B,
+    .next = NULL,
+};
+
+static struct ufsm_trigger c_trigger =
+{
+    .name = "EV_C",
+    .trigger = EV_C,
+    .next = NULL,
+};
+
+static struct ufsm_guard guard =
+{
+    .name = "guard",
+    .f = &guard_f,
+    .next = NULL,
+};
+
+static struct ufsm_action action =
+{
+    .name = "action",
+    .f = &action_f,
+    .next = NULL,
+};
+
+static struct ufsm_action inline_action =
+{
+    .name = "inline_action",
+    .f = &inline_action_f,
+    .next = NULL,
+};
+
+static struct ufsm_state simple_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "State A",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "State B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &C,
+};
+
+static struct ufsm_state C =
+{
+    .name = "State C",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+/* EV_C is deferred in A */
+static struct ufsm_transition transition_defer =
+{
+    .name = "Defer EV_C",
+    .defer = true,
+    .trigger = &c_trigger,
+    .kind = UFSM_TRANSITION_INTERNAL,
+    .source = &A,
+    .dest = &A,
+    .next = &transition_B,
+};
+
+static struct ufsm_transition transition_B =
+{
+    .name = "A to B",
+    .trigger = &a_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_C,
+};
+
+static struct ufsm_transition transition_C =
+{
+    .name = "B to C",
+    .trigger = &c_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .guard = &guard,
+    .action = &action,
+    .source = &B,
+    .dest = &C,
+    .next = &transition_C2,
+};
+
+static struct ufsm_transition transition_C2 =
+{
+    .name = "C to B",
+    .trigger = &b_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .action = &inline_action,
+    .source = &C,
+    .dest = &B,
+    .next = &transition_INIT,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &simple_INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .state = &simple_INIT,
+    .transition = &transition_defer,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Event Record Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+int main(void)
+{
+    uint32_t err;
+    uint32_t value = 0x12345678;
+    struct ufsm_event e;
+    struct ufsm_event rx =
+    {
+        .id = EV_C,
+        .size = sizeof(rx_buffer),
+        .ptr = rx_buffer,
+        .release = &release_f,
+    };
+    struct ufsm_event small =
+    {
+        .id = EV_B,
+        .size = sizeof(value),
+    };
+
+    memcpy(small.data, &value, sizeof(value));
+
+    test_init(&m);
+
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK && "Initializing");
+    assert (ufsm_get_event(&m) == NULL);
+
+    /* Deferring keeps the buffer alive */
+    ufsm_process_event(&m, &rx);
+    assert (m.region->current == &A);
+    assert (no_of_releases == 0);
+
+    /* Leaving A moves the deferred record back to the event queue */
+    err = ufsm_process(&m, EV_A);
+    assert (err == UFSM_OK);
+    assert (m.region->current == &B);
+    assert (no_of_releases == 0);
+
+    err = ufsm_queue_get_event(&m.queue, &e);
+    assert (err == UFSM_OK);
+    assert (e.id == EV_C && e.ptr == rx_buffer);
+
+    /* The action sees the original buffer, which is released afterwards */
+    err = ufsm_process_event(&m, &e);
+    assert (err == UFSM_OK);
+    assert (m.region->current == &C);
+    assert (action_payload == rx_buffer);
+    assert (no_of_releases == 1);
+    assert (ufsm_get_event(&m) == NULL);
+
+    /* Inline payload */
+    err = ufsm_process_event(&m, &small);
+    assert (err == UFSM_OK);
+    assert (m.region->current == &B);
+    assert (inline_value == value);
+
+    /* Unhandled events are released too */
+    rx.id = EV_A;
+    err = ufsm_process_event(&m, &rx);
+    assert (err == UFSM_ERROR_EVENT_NOT_PROCESSED);
+    assert (no_of_releases == 2);
+
+    /* Plain id queues can't take a payload */
+    ufsm_queue_init(&id_queue, 2, id_queue_data);
+    assert (ufsm_queue_put_event(&id_queue, &rx) == UFSM_ERROR);
+    assert (ufsm_queue_put(&id_queue, EV_A) == UFSM_OK);
+    assert (ufsm_queue_get_event(&id_queue, &e) == UFSM_OK);
+    assert (e.id == EV_A && e.ptr == NULL && e.release == NULL);
+
+    /* Reading only the id from an event queue releases the payload */
+    assert (ufsm_queue_put_event(&m.queue, &rx) == UFSM_OK);
+    assert (ufsm_queue_get(&m.queue, &value) == UFSM_OK);
+    assert (value == EV_A && no_of_releases == 3);
+
+    return 0;
+}
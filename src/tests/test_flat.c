@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <ufsm.h>
+#include <test_flat_input.h>
+#include "common.h"
+
+#define NO_OF_ROUNDS 20
+#define NO_OF_STEPS 40
+#define MAX_TRANSITIONS 8
+
+/* What one step did: the transitions that fired, in order, the result and
+ * the active configuration afterwards.
+ * */
+struct step
+{
+    uint32_t transitions[MAX_TRANSITIONS];
+    uint32_t no_of_transitions;
+    ufsm_status_t err;
+    uint32_t active;
+};
+
+static struct step flat_steps[NO_OF_ROUNDS][NO_OF_STEPS];
+static struct step state_steps[NO_OF_ROUNDS][NO_OF_STEPS];
+static struct step *current_step = NULL;
+static struct ufsm_transition *first_transition = NULL;
+
+void final(void) {}
+void eB(void) {}
+void eA2(void) {}
+void xA2(void) {}
+void eA1(void) {}
+void xA1(void) {}
+void eE(void) {}
+void xE(void) {}
+void eD(void) {}
+void xD(void) {}
+void eC(void) {}
+void xC(void) {}
+void eA(void) {}
+void xA(void) {}
+
+static void record_transition(struct ufsm_transition *t)
+{
+    if (!first_transition)
+        first_transition = t;
+
+    if (!current_step)
+        return;
+
+    assert (current_step->no_of_transitions < MAX_TRANSITIONS);
+    current_step->transitions[current_step->no_of_transitions++] = t->index;
+}
+
+static uint32_t active_states(struct ufsm_machine *m)
+{
+    uint32_t active = 0;
+
+    for (uint32_t n = 1; n <= m->no_of_states; n++)
+    {
+        if (ufsm_is_active(m, m->states[n]))
+            active |= (1u << n);
+    }
+
+    return active;
+}
+
+static void step(struct ufsm_machine *m, uint32_t ev)
+{
+    first_transition = NULL;
+    test_process(m, ev);
+}
+
+static struct ufsm_state * active_leaf(struct ufsm_machine *m)
+{
+    struct ufsm_state *leaf = NULL;
+
+    for (uint32_t n = 1; n <= m->no_of_states; n++)
+    {
+        if (ufsm_is_active(m, m->states[n]))
+            leaf = m->states[n];
+    }
+
+    return leaf;
+}
+
+/* Runs the same pseudo random event sequences with the dispatch selected
+ * by 'flat' and records each step.
+ * */
+static void run(struct ufsm_machine *m, bool flat,
+                struct step steps[NO_OF_ROUNDS][NO_OF_STEPS])
+{
+    uint32_t seed = 2018;
+
+    for (uint32_t r = 0; r < NO_OF_ROUNDS; r++)
+    {
+        assert (ufsm_reset_machine(m) == UFSM_OK);
+        m->flat = flat;
+        assert (ufsm_init_machine(m) == UFSM_OK);
+
+        for (uint32_t n = 0; n < NO_OF_STEPS; n++)
+        {
+            seed = seed * 1103515245 + 12345;
+            current_step = &steps[r][n];
+            current_step->err = ufsm_process(m, (seed >> 16) % 4);
+            current_step->active = active_states(m);
+            current_step = NULL;
+        }
+    }
+}
+
+int main(void)
+{
+    struct ufsm_machine *m = get_StateMachine1();
+    uint32_t no_of_transitions = 0;
+
+    test_init(m);
+    m->debug_transition = &record_transition;
+    assert (m->flat);
+
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    assert (strcmp(active_leaf(m)->name, "B") == 0);
+
+    /* The leaf's own transition */
+    step(m, EV_A);
+    assert (strcmp(first_transition->source->name, "B") == 0);
+    assert (strcmp(active_leaf(m)->name, "A1") == 0);
+
+    /* A1 has no EV_B transition, the flattened table finds the one of A */
+    step(m, EV_B);
+    assert (strcmp(first_transition->source->name, "A") == 0);
+    assert (strcmp(active_leaf(m)->name, "B") == 0);
+
+    /* Ancestors are not blocked, the next step starts from the new leaf */
+    step(m, EV_A);
+    step(m, EV_1);
+    assert (strcmp(first_transition->source->name, "A1") == 0);
+    assert (strcmp(active_leaf(m)->name, "A2") == 0);
+
+    /* Events that no state on the path handles */
+    assert (ufsm_process(m, EV_A) == UFSM_ERROR_EVENT_NOT_PROCESSED);
+    assert (strcmp(active_leaf(m)->name, "A2") == 0);
+
+    /* Flat dispatch fires the same transitions as per-state dispatch */
+    run(m, true, flat_steps);
+    run(m, false, state_steps);
+
+    for (uint32_t r = 0; r < NO_OF_ROUNDS; r++)
+    {
+        for (uint32_t n = 0; n < NO_OF_STEPS; n++)
+        {
+            struct step *f = &flat_steps[r][n];
+            struct step *s = &state_steps[r][n];
+
+            assert (f->err == s->err);
+            assert (f->active == s->active);
+            assert (f->no_of_transitions == s->no_of_transitions);
+
+            for (uint32_t i = 0; i < f->no_of_transitions; i++)
+                assert (f->transitions[i] == s->transitions[i]);
+
+            no_of_transitions += f->no_of_transitions;
+        }
+    }
+
+    /* The sequences get well past the initial configuration */
+    assert (no_of_transitions > NO_OF_ROUNDS * 4);
+    printf ("%u transitions compared\n", no_of_transitions);
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include <test_gen_input.h>
+#include "common.h"
+
+/* A chart from ufsmgen with every kind of pseudostate, see the Makefile */
+
+static uint32_t instance_data[test_gen_input_INSTANCE_DATA_SIZE];
+static struct ufsm_event queue_data[16];
+static struct ufsm_event defer_queue_data[16];
+
+static ufsm_status_t process(struct ufsm_machine *m,
+                             struct ufsm_instance *i,
+                             uint32_t ev)
+{
+    if (i)
+        return ufsm_process_instance(m, i, ev);
+
+    return ufsm_process(m, ev);
+}
+
+/* Runs the machine, or the instance 'i' of it when given */
+static uint32_t run(struct ufsm_machine *m, struct ufsm_instance *i)
+{
+    struct ufsm_queue *q = i ? i->queue : ufsm_get_queue(m);
+    uint32_t processed = 0;
+    uint32_t ev;
+
+    for (uint32_t n = 0; n < 64 * m->no_of_events; n++)
+    {
+        ufsm_status_t err = process(m, i, (n * 7) % m->no_of_events);
+
+        /* Events without a transition in the active states are dropped */
+        assert (err == UFSM_OK || err == UFSM_ERROR_EVENT_NOT_PROCESSED);
+        assert (m->context.stack.pos == 0);
+
+        if (err == UFSM_OK)
+            processed++;
+
+        while (ufsm_queue_get(q, &ev) == UFSM_OK)
+        {
+            err = process(m, i, ev);
+            assert (err == UFSM_OK || err == UFSM_ERROR_EVENT_NOT_PROCESSED);
+        }
+    }
+
+    return processed;
+}
+
+int main(void)
+{
+    struct ufsm_machine *m = get_test_gen_input();
+    struct ufsm_queue q;
+    struct ufsm_queue dq;
+    struct ufsm_instance i;
+
+    /* Larger than the built-in bitsets of hand written machines */
+    assert (m->no_of_states > UFSM_MAX_STATES);
+    assert (m->no_of_events > 1);
+
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    assert (run(m, NULL) > 0);
+
+    assert (ufsm_reset_machine(m) == UFSM_OK);
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    assert (run(m, NULL) > 0);
+
+    /* The instance data is sized for the chart as well */
+    assert (ufsm_instance_init(&i, m, test_gen_input_INSTANCE_DATA_SIZE,
+                                            instance_data) == UFSM_OK);
+    ufsm_queue_init_events(&q, 16, queue_data);
+    ufsm_queue_init_events(&dq, 16, defer_queue_data);
+    i.queue = &q;
+    i.defer_queue = &dq;
+
+    assert (ufsm_init_machine_instance(m, &i) == UFSM_OK);
+    assert (run(m, &i) > 0);
+
+    return 0;
+}
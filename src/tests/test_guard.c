@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+enum events {
+    EV,
+};
+
+static uint32_t no_of_false_calls = 0;
+static uint32_t no_of_count_calls = 0;
+static uint32_t no_of_choice_calls = 0;
+static uint32_t no_of_cache_hits = 0;
+
+static bool false_f(void)
+{
+    no_of_false_calls++;
+    return false;
+}
+
+static bool count_f(void)
+{
+    no_of_count_calls++;
+    return true;
+}
+
+static bool choice_f(void)
+{
+    no_of_choice_calls++;
+    return true;
+}
+
+static void debug_guard_cached(struct ufsm_guard *g, bool result)
+{
+    assert (g->f == &false_f && !result);
+    no_of_cache_hits++;
+}
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_state C;
+static struct ufsm_state CHOICE;
+static struct ufsm_region region1;
+static struct ufsm_transition transition_B1;
+static struct ufsm_transition transition_B2;
+static struct ufsm_transition transition_CHOICE;
+static struct ufsm_transition transition_C;
+static struct ufsm_transition transition_default;
+static struct ufsm_transition transition_INIT;
+
+static struct ufsm_trigger ev_trigger =
+{
+    .name = "EV",
+    .trigger = EV,
+    .next = NULL,
+};
+
+/* Never called, the first guard fails */
+static struct ufsm_guard count_guard =
+{
+    .name = "count",
+    .f = &count_f,
+    .next = NULL,
+};
+
+static struct ufsm_guard false_guard1 =
+{
+    .name = "false1",
+    .f = &false_f,
+    .pure = true,
+    .next = &count_guard,
+};
+
+/* Same function as false_guard1, answered from the cache */
+static struct ufsm_guard false_guard2 =
+{
+    .name = "false2",
+    .f = &false_f,
+    .pure = true,
+    .next = NULL,
+};
+
+static struct ufsm_guard choice_guard =
+{
+    .name = "choice",
+    .f = &choice_f,
+    .next = NULL,
+};
+
+static struct ufsm_state simple_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "State A",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "State B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &C,
+};
+
+static struct ufsm_state C =
+{
+    .name = "State C",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &CHOICE,
+};
+
+static struct ufsm_state CHOICE =
+{
+    .name = "Choice",
+    .kind = UFSM_STATE_CHOICE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_B1 =
+{
+    .name = "A to B, first",
+    .trigger = &ev_trigger,
+    .guard = &false_guard1,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_B2,
+};
+
+static struct ufsm_transition transition_B2 =
+{
+    .name = "A to B, second",
+    .trigger = &ev_trigger,
+    .guard = &false_guard2,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_CHOICE,
+};
+
+static struct ufsm_transition transition_CHOICE =
+{
+    .name = "A to Choice",
+    .trigger = &ev_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &CHOICE,
+    .next = &transition_C,
+};
+
+static struct ufsm_transition transition_C =
+{
+    .name = "Choice to C",
+    .guard = &choice_guard,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &CHOICE,
+    .dest = &C,
+    .next = &transition_default,
+};
+
+static struct ufsm_transition transition_default =
+{
+    .name = "Choice to B",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &CHOICE,
+    .dest = &B,
+    .next = &transition_INIT,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &simple_INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .state = &simple_INIT,
+    .transition = &transition_B1,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Guard Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+int main(void)
+{
+    uint32_t err;
+
+    test_init(&m);
+    m.debug_guard_cached = &debug_guard_cached;
+
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK && "Initializing");
+
+    test_process(&m, EV);
+    assert (m.region->current == &C);
+    assert (no_of_false_calls == 1);
+    assert (no_of_count_calls == 0);
+    assert (no_of_cache_hits == 1);
+    assert (no_of_choice_calls == 1);
+
+    /* The cache only lasts for one step */
+    ufsm_reset_machine(&m);
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK);
+
+    test_process(&m, EV);
+    assert (m.region->current == &C);
+    assert (no_of_false_calls == 2);
+    assert (no_of_cache_hits == 2);
+    assert (no_of_choice_calls == 2);
+
+    return 0;
+}
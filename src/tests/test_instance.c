@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <ufsm.h>
+#include <test_instance_input.h>
+#include "common.h"
+
+static bool flag_eB = false;
+static bool flag_eA1 = false;
+static bool flag_eD = false;
+static bool flag_eC = false;
+
+static void reset_flags(void)
+{
+    flag_eB = false;
+    flag_eA1 = false;
+    flag_eD = false;
+    flag_eC = false;
+}
+
+void final(void) {}
+void eA2(void) {}
+void xA2(void) {}
+void xA1(void) {}
+void eE(void) {}
+void xE(void) {}
+void xD(void) {}
+void xC(void) {}
+void eA(void) {}
+void xA(void) {}
+
+void eB(void)
+{
+    flag_eB = true;
+}
+
+void eA1(void)
+{
+    flag_eA1 = true;
+}
+
+void eD(void)
+{
+    flag_eD = true;
+}
+
+void eC(void)
+{
+    flag_eC = true;
+}
+
+static struct ufsm_state *find_state(struct ufsm_machine *m,
+                                     const char *name)
+{
+    for (uint32_t n = 1; n <= m->no_of_states; n++)
+    {
+        if (m->states[n]->name && strcmp(m->states[n]->name, name) == 0)
+            return m->states[n];
+    }
+
+    return NULL;
+}
+
+static void process(struct ufsm_machine *m, struct ufsm_instance *i,
+                    int32_t ev)
+{
+    uint32_t err = ufsm_process_instance(m, i, ev);
+
+    if (err != UFSM_OK)
+        printf ("ERROR: %s\n", ufsm_errors[err]);
+    assert (err == UFSM_OK);
+    assert (m->context.stack.pos == 0);
+}
+
+int main(void)
+{
+    struct ufsm_machine *m = get_StateMachine1();
+    uint32_t data1[StateMachine1_INSTANCE_DATA_SIZE];
+    uint32_t data2[StateMachine1_INSTANCE_DATA_SIZE];
+    struct ufsm_instance i1;
+    struct ufsm_instance i2;
+
+    test_init(m);
+
+    assert (ufsm_instance_init(&i1, m, 1, data1) == UFSM_ERROR);
+    assert (ufsm_instance_init(&i1, m, StateMachine1_INSTANCE_DATA_SIZE,
+                                                        data1) == UFSM_OK);
+    assert (ufsm_instance_init(&i2, m, StateMachine1_INSTANCE_DATA_SIZE,
+                                                        data2) == UFSM_OK);
+
+    assert (ufsm_init_machine_instance(m, &i1) == UFSM_OK);
+    assert (flag_eB);
+    reset_flags();
+    assert (ufsm_init_machine_instance(m, &i2) == UFSM_OK);
+    assert (flag_eB);
+
+    /* Enter the deepest state in the first instance */
+    reset_flags();
+    process(m, &i1, EV_A);
+    assert (flag_eA1);
+    process(m, &i1, EV_1);
+    process(m, &i1, EV_1);
+    process(m, &i1, EV_1);
+    assert (flag_eD && flag_eC);
+
+    /* The second instance is still in B */
+    assert (ufsm_process_instance(m, &i2, EV_1) ==
+                                    UFSM_ERROR_EVENT_NOT_PROCESSED);
+
+    /* Store deep history in the first instance */
+    reset_flags();
+    process(m, &i1, EV_B);
+    assert (flag_eB);
+
+    /* History is not shared between instances */
+    reset_flags();
+    process(m, &i2, EV_A);
+    assert (flag_eA1 && !flag_eD && !flag_eC);
+
+    /* The active configuration is kept per instance */
+    assert (ufsm_is_active_instance(m, &i1, find_state(m, "B")));
+    assert (!ufsm_is_active_instance(m, &i1, find_state(m, "A")));
+    assert (!ufsm_is_active_instance(m, &i2, find_state(m, "B")));
+    assert (ufsm_is_active_instance(m, &i2, find_state(m, "A")));
+    assert (ufsm_is_active_instance(m, &i2, find_state(m, "A1")));
+
+    reset_flags();
+    process(m, &i1, EV_A);
+    assert (!flag_eA1 && flag_eD && flag_eC);
+
+    /* The definition itself is never written */
+    assert (m->region->current == NULL);
+    assert (m->context.instance == NULL);
+
+    /* and lives in read-only memory, so it can't run as a machine */
+    assert (m->read_only);
+    assert (ufsm_init_machine(m) == UFSM_ERROR);
+    assert (ufsm_process(m, EV_A) == UFSM_ERROR);
+    assert (ufsm_reset_machine(m) == UFSM_ERROR);
+    assert (ufsm_restore(m, NULL, 0) == UFSM_ERROR);
+    assert (m->region->current == NULL);
+
+    /* Reset recycles the instance */
+    reset_flags();
+    assert (ufsm_reset_machine_instance(m, &i1) == UFSM_OK);
+    assert (ufsm_init_machine_instance(m, &i1) == UFSM_OK);
+    assert (flag_eB);
+    reset_flags();
+    process(m, &i1, EV_A);
+    assert (flag_eA1 && !flag_eD);
+
+    return 0;
+}
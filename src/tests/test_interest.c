@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include <test_interest_input.h>
+#include <test_interest_orth_input.h>
+#include "common.h"
+
+static uint32_t no_of_eB = 0;
+
+void final(void) {}
+void eA2(void) {}
+void xA2(void) {}
+void eA1(void) {}
+void xA1(void) {}
+void eE(void) {}
+void xE(void) {}
+void eD(void) {}
+void xD(void) {}
+void eC(void) {}
+void xC(void) {}
+void eA(void) {}
+void xA(void) {}
+
+void eB(void)
+{
+    no_of_eB++;
+}
+
+void eB2(void) {}
+void xB2(void) {}
+void eAB(void) {}
+void xAB(void) {}
+void finalC(void) {}
+bool gA(void) { return false; }
+bool g2(void) { return false; }
+
+int main(void)
+{
+    struct ufsm_machine *m = get_StateMachine1();
+
+    test_init(m);
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    assert (no_of_eB == 1);
+
+    /* B only handles EV_A */
+    assert (ufsm_event_of_interest(m, EV_A));
+    assert (!ufsm_event_of_interest(m, EV_B));
+    assert (!ufsm_event_of_interest(m, EV_1));
+    assert (!ufsm_event_of_interest(m, EV_EXIT));
+    assert (!ufsm_event_of_interest(m, EV_EXIT + 1));
+    assert (!ufsm_event_of_interest(m, -1));
+
+    /* Rejected without running a step */
+    assert (ufsm_process(m, EV_B) == UFSM_ERROR_EVENT_NOT_PROCESSED);
+    assert (ufsm_process(m, 1000) == UFSM_ERROR_EVENT_NOT_PROCESSED);
+    assert (no_of_eB == 1);
+
+    /* A1 handles EV_1 and inherits EV_B from A */
+    test_process(m, EV_A);
+    assert (!ufsm_event_of_interest(m, EV_A));
+    assert (ufsm_event_of_interest(m, EV_B));
+    assert (ufsm_event_of_interest(m, EV_1));
+    assert (!ufsm_event_of_interest(m, EV_EXIT));
+
+    /* A2 adds EV_EXIT */
+    test_process(m, EV_1);
+    assert (ufsm_event_of_interest(m, EV_EXIT));
+    assert (ufsm_event_of_interest(m, EV_B));
+
+    test_process(m, EV_B);
+    assert (no_of_eB == 2);
+    assert (ufsm_event_of_interest(m, EV_A));
+    assert (!ufsm_event_of_interest(m, EV_1));
+
+    /* Machines with orthogonal regions test every active state */
+    m = get_OrthMachine();
+    test_init(m);
+    assert (!m->flat);
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    assert (ufsm_event_of_interest(m, EV));
+    assert (!ufsm_event_of_interest(m, EV + 1));
+    assert (ufsm_process(m, EV + 1) == UFSM_ERROR_EVENT_NOT_PROCESSED);
+
+    return 0;
+}
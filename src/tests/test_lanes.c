@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+#define NO_OF_LANES 3
+
+enum events {
+    EV_DATA,
+    EV_ABORT,
+    EV_NEXT,
+};
+
+enum lanes {
+    LANE_ROUTINE,
+    LANE_CONTROL,
+    LANE_URGENT,
+};
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_region region1;
+static struct ufsm_transition transition_defer_data;
+static struct ufsm_transition transition_defer_abort;
+static struct ufsm_transition transition_B;
+static struct ufsm_transition transition_INIT;
+
+static struct ufsm_queue lanes[NO_OF_LANES];
+static struct ufsm_event lane_data[NO_OF_LANES][8];
+
+static struct ufsm_trigger data_trigger =
+{
+    .name = "EV_DATA",
+    .trigger = EV_DATA,
+    .next = NULL,
+};
+
+static struct ufsm_trigger abort_trigger =
+{
+    .name = "EV_ABORT",
+    .trigger = EV_ABORT,
+    .next = NULL,
+};
+
+static struct ufsm_trigger next_trigger =
+{
+    .name = "EV_NEXT",
+    .trigger = EV_NEXT,
+    .next = NULL,
+};
+
+static struct ufsm_state simple_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "State A",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "State B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_defer_data =
+{
+    .name = "A defers EV_DATA",
+    .defer = true,
+    .trigger = &data_trigger,
+    .kind = UFSM_TRANSITION_INTERNAL,
+    .source = &A,
+    .dest = &A,
+    .next = &transition_defer_abort,
+};
+
+static struct ufsm_transition transition_defer_abort =
+{
+    .name = "A defers EV_ABORT",
+    .defer = true,
+    .trigger = &abort_trigger,
+    .kind = UFSM_TRANSITION_INTERNAL,
+    .source = &A,
+    .dest = &A,
+    .next = &transition_B,
+};
+
+static struct ufsm_transition transition_B =
+{
+    .name = "A to B",
+    .trigger = &next_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_INIT,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &simple_INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .state = &simple_INIT,
+    .transition = &transition_defer_data,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Lanes Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+static void post(uint32_t ev, uint32_t lane, uint8_t tag)
+{
+    struct ufsm_event e =
+    {
+        .id = ev,
+        .lane = lane,
+        .size = 1,
+        .data = { tag },
+    };
+
+    assert (ufsm_queue_put_event(&m.queue, &e) == UFSM_OK);
+}
+
+static void expect(uint32_t ev, uint32_t lane, uint8_t tag)
+{
+    struct ufsm_event e;
+
+    assert (ufsm_queue_get_event(&m.queue, &e) == UFSM_OK);
+    assert (e.id == ev && e.lane == lane && e.data[0] == tag);
+}
+
+int main(void)
+{
+    uint32_t err;
+    uint32_t count = 0;
+    struct ufsm_event e;
+    struct ufsm_event batch[8];
+
+    for (uint32_t l = 0; l < NO_OF_LANES; l++)
+        ufsm_queue_init_events(&lanes[l], 8, lane_data[l]);
+
+    assert (ufsm_queue_init_lanes(&m.queue, 0, lanes) == UFSM_ERROR);
+    assert (ufsm_queue_init_lanes(&m.queue, NO_OF_LANES, lanes) == UFSM_OK);
+
+    test_init(&m);
+
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK && "Initializing");
+    assert (m.queue.kind == UFSM_QUEUE_LANES);
+
+    /* The highest non-empty lane is always served first */
+    post(EV_DATA, LANE_ROUTINE, 1);
+    post(EV_DATA, LANE_ROUTINE, 2);
+    post(EV_ABORT, LANE_URGENT, 3);
+    post(EV_DATA, LANE_CONTROL, 4);
+    assert (ufsm_queue_put_lane(&m.queue, EV_ABORT, NO_OF_LANES) ==
+                                                            UFSM_ERROR);
+    assert (ufsm_queue_put_lane(&m.queue, EV_ABORT, LANE_URGENT) ==
+                                                            UFSM_OK);
+
+    assert (ufsm_queue_peek_event(&m.queue, 2, &e) == UFSM_OK);
+    assert (e.id == EV_DATA && e.data[0] == 4);
+    assert (ufsm_queue_peek_event(&m.queue, 4, &e) == UFSM_OK);
+    assert (e.data[0] == 2);
+    assert (ufsm_queue_peek_event(&m.queue, 5, &e) == UFSM_ERROR_QUEUE_EMPTY);
+
+    expect(EV_ABORT, LANE_URGENT, 3);
+    expect(EV_ABORT, LANE_URGENT, 0);
+
+    /* A batch drains the lanes in priority order */
+    post(EV_ABORT, LANE_URGENT, 5);
+    assert (ufsm_queue_get_batch(&m.queue, batch, 8, &count) == UFSM_OK);
+    assert (count == 4);
+    assert (batch[0].data[0] == 5 && batch[1].data[0] == 4);
+    assert (batch[2].data[0] == 1 && batch[3].data[0] == 2);
+    assert (ufsm_queue_get_event(&m.queue, &e) == UFSM_ERROR_QUEUE_EMPTY);
+
+    /* Deferred events go back to their own lane, in order */
+    assert (ufsm_process_batch(&m, batch, count, NULL, &count) == UFSM_OK);
+    assert (m.defer_queue.s == 4);
+
+    err = ufsm_process(&m, EV_NEXT);
+    assert (err == UFSM_OK);
+    assert (m.region->current == &B);
+    assert (m.defer_queue.s == 0);
+
+    expect(EV_ABORT, LANE_URGENT, 5);
+    expect(EV_DATA, LANE_CONTROL, 4);
+    expect(EV_DATA, LANE_ROUTINE, 1);
+    expect(EV_DATA, LANE_ROUTINE, 2);
+    assert (ufsm_queue_get_event(&m.queue, &e) == UFSM_ERROR_QUEUE_EMPTY);
+
+    return 0;
+}
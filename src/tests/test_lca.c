@@ -0,0 +1,445 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+/* Transitions between regions with precomputed least common ancestors and
+ * exit and entry paths. The same steps are then run with the paths removed
+ * and must leave and enter the same states in the same order.
+ * */
+
+enum events {
+    EV_1,
+    EV_2,
+    EV_3,
+    EV_4,
+};
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_state A1;
+static struct ufsm_state A2;
+static struct ufsm_state A11;
+static struct ufsm_state A12;
+static struct ufsm_state B1;
+static struct ufsm_state B11;
+static struct ufsm_region region1;
+static struct ufsm_region region_a;
+static struct ufsm_region region_a1;
+static struct ufsm_region region_b;
+static struct ufsm_region region_b1;
+static struct ufsm_transition transition_A11_B11;
+static struct ufsm_transition transition_B11_B;
+static struct ufsm_transition transition_B1_A2;
+static struct ufsm_transition transition_A2_A12;
+
+static void log_state(char prefix, struct ufsm_state *s)
+{
+    if (!s || s->kind != UFSM_STATE_SIMPLE)
+        return;
+
+    test_log(" ", "%c%s", prefix, s->name);
+}
+
+static void enter_f(struct ufsm_state *s)
+{
+    log_state('+', s);
+}
+
+static void exit_f(struct ufsm_state *s)
+{
+    log_state('-', s);
+}
+
+static struct ufsm_trigger trigger_1 =
+{
+    .name = "EV_1",
+    .trigger = EV_1,
+};
+
+static struct ufsm_trigger trigger_2 =
+{
+    .name = "EV_2",
+    .trigger = EV_2,
+};
+
+static struct ufsm_trigger trigger_3 =
+{
+    .name = "EV_3",
+    .trigger = EV_3,
+};
+
+static struct ufsm_trigger trigger_4 =
+{
+    .name = "EV_4",
+    .trigger = EV_4,
+};
+
+/* Top region */
+
+static struct ufsm_state INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "A",
+    .kind = UFSM_STATE_SIMPLE,
+    .region = &region_a,
+    .parent_region = &region1,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "B",
+    .kind = UFSM_STATE_SIMPLE,
+    .region = &region_b,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .name = "Region 1",
+    .state = &INIT,
+    .transition = &transition_INIT,
+    .next = NULL,
+};
+
+/* Region of A */
+
+static struct ufsm_state A_INIT =
+{
+    .name = "A Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region_a,
+    .next = &A1,
+};
+
+static struct ufsm_state A1 =
+{
+    .name = "A1",
+    .kind = UFSM_STATE_SIMPLE,
+    .region = &region_a1,
+    .parent_region = &region_a,
+    .next = &A2,
+};
+
+static struct ufsm_state A2 =
+{
+    .name = "A2",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region_a,
+    .next = NULL,
+};
+
+static struct ufsm_region *A2_A12_exit_path[] =
+{
+    NULL,
+};
+
+static struct ufsm_region *A2_A12_enter_path[] =
+{
+    &region_a1,
+    NULL,
+};
+
+/* Into a nested region of a sibling, the LCA is the source region */
+static struct ufsm_transition transition_A2_A12 =
+{
+    .name = "A2 to A12",
+    .trigger = &trigger_4,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A2,
+    .dest = &A12,
+    .lca = &region_a,
+    .exit_path = A2_A12_exit_path,
+    .enter_path = A2_A12_enter_path,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_A_INIT =
+{
+    .name = "A Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A_INIT,
+    .dest = &A1,
+    .next = &transition_A2_A12,
+};
+
+static struct ufsm_region region_a =
+{
+    .name = "Region A",
+    .state = &A_INIT,
+    .transition = &transition_A_INIT,
+    .next = NULL,
+};
+
+/* Region of A1 */
+
+static struct ufsm_state A1_INIT =
+{
+    .name = "A1 Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region_a1,
+    .next = &A11,
+};
+
+static struct ufsm_state A11 =
+{
+    .name = "A11",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region_a1,
+    .next = &A12,
+};
+
+static struct ufsm_state A12 =
+{
+    .name = "A12",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region_a1,
+    .next = NULL,
+};
+
+static struct ufsm_region *A11_B11_exit_path[] =
+{
+    &region_a1,
+    &region_a,
+    NULL,
+};
+
+static struct ufsm_region *A11_B11_enter_path[] =
+{
+    &region_b,
+    &region_b1,
+    NULL,
+};
+
+/* Two levels up and two levels down */
+static struct ufsm_transition transition_A11_B11 =
+{
+    .name = "A11 to B11",
+    .trigger = &trigger_1,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A11,
+    .dest = &B11,
+    .lca = &region1,
+    .exit_path = A11_B11_exit_path,
+    .enter_path = A11_B11_enter_path,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_A1_INIT =
+{
+    .name = "A1 Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A1_INIT,
+    .dest = &A11,
+    .next = &transition_A11_B11,
+};
+
+static struct ufsm_region region_a1 =
+{
+    .name = "Region A1",
+    .state = &A1_INIT,
+    .transition = &transition_A1_INIT,
+    .next = NULL,
+};
+
+/* Region of B */
+
+static struct ufsm_state B_INIT =
+{
+    .name = "B Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region_b,
+    .next = &B1,
+};
+
+static struct ufsm_state B1 =
+{
+    .name = "B1",
+    .kind = UFSM_STATE_SIMPLE,
+    .region = &region_b1,
+    .parent_region = &region_b,
+    .next = NULL,
+};
+
+static struct ufsm_region *B1_A2_exit_path[] =
+{
+    &region_b,
+    NULL,
+};
+
+static struct ufsm_region *B1_A2_enter_path[] =
+{
+    &region_a,
+    NULL,
+};
+
+/* Leaves the nested states of the composite source first */
+static struct ufsm_transition transition_B1_A2 =
+{
+    .name = "B1 to A2",
+    .trigger = &trigger_3,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B1,
+    .dest = &A2,
+    .lca = &region1,
+    .exit_path = B1_A2_exit_path,
+    .enter_path = B1_A2_enter_path,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_B_INIT =
+{
+    .name = "B Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B_INIT,
+    .dest = &B1,
+    .next = &transition_B1_A2,
+};
+
+static struct ufsm_region region_b =
+{
+    .name = "Region B",
+    .state = &B_INIT,
+    .transition = &transition_B_INIT,
+    .next = NULL,
+};
+
+/* Region of B1 */
+
+static struct ufsm_state B1_INIT =
+{
+    .name = "B1 Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region_b1,
+    .next = &B11,
+};
+
+static struct ufsm_state B11 =
+{
+    .name = "B11",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region_b1,
+    .next = NULL,
+};
+
+static struct ufsm_region *B11_B_exit_path[] =
+{
+    &region_b1,
+    &region_b,
+    NULL,
+};
+
+static struct ufsm_region *B11_B_enter_path[] =
+{
+    &region1,
+    NULL,
+};
+
+/* Out to an enclosing state, which is left and entered again */
+static struct ufsm_transition transition_B11_B =
+{
+    .name = "B11 to B",
+    .trigger = &trigger_2,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B11,
+    .dest = &B,
+    .lca = &region1,
+    .exit_path = B11_B_exit_path,
+    .enter_path = B11_B_enter_path,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_B1_INIT =
+{
+    .name = "B1 Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B1_INIT,
+    .dest = &B11,
+    .next = &transition_B11_B,
+};
+
+static struct ufsm_region region_b1 =
+{
+    .name = "Region B1",
+    .state = &B1_INIT,
+    .transition = &transition_B1_INIT,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "LCA Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+static void run_steps(struct ufsm_machine *m)
+{
+    test_log_clear();
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    test_log_expect("+A +A1 +A11");
+
+    test_step(m, EV_1, "-A11 -A1 -A +B +B1 +B11");
+    assert (ufsm_is_active(m, &B11) && !ufsm_is_active(m, &A));
+    assert (region_a.current == NULL && region_a1.current == NULL);
+
+    test_step(m, EV_2, "-B11 -B1 -B +B +B1 +B11");
+    assert (ufsm_is_active(m, &B) && ufsm_is_active(m, &B11));
+
+    test_step(m, EV_3, "-B11 -B1 -B +A +A2");
+    assert (ufsm_is_active(m, &A2) && !ufsm_is_active(m, &B));
+    assert (region_b.current == NULL && region_b1.current == NULL);
+
+    test_step(m, EV_4, "-A2 +A1 +A12");
+    assert (ufsm_is_active(m, &A) && ufsm_is_active(m, &A1));
+    assert (ufsm_is_active(m, &A12) && !ufsm_is_active(m, &A2));
+}
+
+int main(void)
+{
+    struct ufsm_transition *paths[] =
+    {
+        &transition_A11_B11,
+        &transition_B11_B,
+        &transition_B1_A2,
+        &transition_A2_A12,
+    };
+
+    test_init(&m);
+    m.debug_enter_state = &enter_f;
+    m.debug_exit_state = &exit_f;
+
+    run_steps(&m);
+
+    /* The runtime search must agree with the precomputed paths */
+    for (uint32_t n = 0; n < sizeof(paths) / sizeof(paths[0]); n++)
+    {
+        paths[n]->lca = NULL;
+        paths[n]->exit_path = NULL;
+        paths[n]->enter_path = NULL;
+    }
+
+    assert (ufsm_reset_machine(&m) == UFSM_OK);
+    run_steps(&m);
+
+    return 0;
+}
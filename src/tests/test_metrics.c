@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <ufsm.h>
+#include <test_metrics_input.h>
+#include "common.h"
+
+#define NO_OF_SHARDS 2
+
+static struct ufsm_metrics metrics;
+static uint64_t data[StateMachine1_METRICS_DATA_SIZE(NO_OF_SHARDS)];
+static uint64_t snapshot_data[StateMachine1_METRICS_DATA_SIZE(1)];
+static uint64_t now = 0;
+static uint32_t instance_data[StateMachine1_INSTANCE_DATA_SIZE];
+static uint64_t entered[StateMachine1_METRICS_ENTERED_SIZE];
+
+void final(void) {}
+void eA2(void) {}
+void xA2(void) {}
+void eA1(void) {}
+void xA1(void) {}
+void eE(void) {}
+void xE(void) {}
+void eD(void) {}
+void xD(void) {}
+void eC(void) {}
+void xC(void) {}
+void eA(void) {}
+void xA(void) {}
+void eB(void) {}
+
+static uint64_t clock_f(void)
+{
+    return ++now;
+}
+
+static struct ufsm_state * find_state(struct ufsm_machine *m,
+                                      const char *name)
+{
+    for (uint32_t n = 1; n <= m->no_of_states; n++)
+        if (strcmp(m->states[n]->name, name) == 0)
+            return m->states[n];
+
+    assert (false);
+    return NULL;
+}
+
+static uint64_t latency_count(struct ufsm_metrics_snapshot *s, uint32_t ev)
+{
+    uint64_t count = 0;
+
+    for (uint32_t b = 0; b < UFSM_METRICS_BUCKETS; b++)
+        count += s->latency[ev * UFSM_METRICS_BUCKETS + b];
+
+    return count;
+}
+
+int main(void)
+{
+    struct ufsm_machine *m = get_StateMachine1();
+    struct ufsm_metrics_snapshot s;
+    struct ufsm_state *A = NULL;
+    struct ufsm_state *B = NULL;
+    struct ufsm_transition *B_to_A = NULL;
+    struct ufsm_instance i;
+    uint64_t seen = 0;
+
+    test_init(m);
+
+    assert (ufsm_metrics_snapshot(m, snapshot_data, &s) == UFSM_ERROR);
+    assert (ufsm_metrics_init(&metrics, m, 0, data, &clock_f) == UFSM_ERROR);
+    assert (ufsm_metrics_init(&metrics, m, NO_OF_SHARDS, data, &clock_f) ==
+                                                                    UFSM_OK);
+    assert (m->metrics == &metrics);
+    assert (metrics.no_of_transitions > 0);
+
+    A = find_state(m, "A");
+    B = find_state(m, "B");
+
+    /* Every transition of the root region has its own index */
+    for (struct ufsm_transition *t = m->region->transition; t; t = t->next)
+    {
+        assert (t->index > 0 && t->index <= m->no_of_transitions);
+        assert (t->index < 64 && !(seen & (1ULL << t->index)));
+        seen |= (1ULL << t->index);
+
+        if (t->source == B && t->trigger && t->trigger->trigger == EV_A)
+            B_to_A = t;
+    }
+
+    assert (B_to_A);
+
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    test_process(m, EV_A);
+    test_process(m, EV_1);
+    test_process(m, EV_B);
+
+    /* Events processed on another thread's shard are added up */
+    ufsm_metrics_thread(1);
+    test_process(m, EV_A);
+    assert (ufsm_process(m, EV_A) == UFSM_ERROR_EVENT_NOT_PROCESSED);
+    ufsm_metrics_thread(0);
+
+    assert (ufsm_metrics_snapshot(m, snapshot_data, &s) == UFSM_OK);
+    assert (s.events == 5);
+    assert (s.not_processed == 1);
+    assert (s.transitions[B_to_A->index] == 2);
+    assert (s.visits[B->index] == 2);
+    assert (s.dwell[B->index] >= 2);
+    assert (s.visits[A->index] == 1);
+    assert (latency_count(&s, EV_A) == 3);
+    assert (latency_count(&s, EV_1) == 1);
+    assert (latency_count(&s, m->no_of_events) == 0);
+    assert (s.queue_full == 0 && s.defer_queue_full == 0);
+
+    /* Nothing is recorded for a shard out of range */
+    ufsm_metrics_thread(NO_OF_SHARDS);
+    test_process(m, EV_B);
+    ufsm_metrics_thread(0);
+
+    assert (ufsm_metrics_snapshot(m, snapshot_data, &s) == UFSM_OK);
+    assert (s.events == 5);
+    assert (s.visits[A->index] == 1);
+
+    /* Nothing is recorded for an instance without entry times */
+    assert (ufsm_instance_init(&i, m, StateMachine1_INSTANCE_DATA_SIZE,
+                                                instance_data) == UFSM_OK);
+    assert (ufsm_init_machine_instance(m, &i) == UFSM_OK);
+    assert (ufsm_process_instance(m, &i, EV_A) == UFSM_OK);
+    assert (ufsm_metrics_snapshot(m, snapshot_data, &s) == UFSM_OK);
+    assert (s.events == 5);
+    assert (s.transitions[B_to_A->index] == 2);
+    assert (s.visits[B->index] == 2);
+
+    /* and everything for one with its own, timed from its own entries */
+    i.entered = entered;
+    assert (ufsm_reset_machine_instance(m, &i) == UFSM_OK);
+    assert (ufsm_init_machine_instance(m, &i) == UFSM_OK);
+    assert (entered[B->index] != 0);
+    assert (ufsm_process_instance(m, &i, EV_A) == UFSM_OK);
+    assert (entered[B->index] == 0 && entered[A->index] != 0);
+    assert (ufsm_metrics_snapshot(m, snapshot_data, &s) == UFSM_OK);
+    assert (s.events == 6);
+    assert (s.transitions[B_to_A->index] == 3);
+    assert (s.visits[B->index] == 3);
+    assert (latency_count(&s, EV_A) == 4);
+
+    /* Events that don't fit in the queue are counted */
+    while (ufsm_queue_put(&m->queue, EV_1) == UFSM_OK)
+        ;
+
+    assert (ufsm_queue_put(&m->queue, EV_1) == UFSM_ERROR_QUEUE_FULL);
+    assert (ufsm_metrics_snapshot(m, snapshot_data, &s) == UFSM_OK);
+    assert (s.queue_full == 2);
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include <pthread.h>
+#include <ufsm.h>
+
+#define NO_OF_PRODUCERS 4
+#define NO_OF_EVENTS 100000
+#define QUEUE_SIZE 64
+#define BATCH_SIZE 16
+
+static struct ufsm_queue q;
+static struct ufsm_event q_data[QUEUE_SIZE];
+static uint32_t q_seq[QUEUE_SIZE];
+
+/* Event ids encode the producer in the top byte and a sequence number */
+static void * producer(void *arg)
+{
+    uint32_t id = (uint32_t) (uintptr_t) arg;
+
+    for (uint32_t n = 0; n < NO_OF_EVENTS; n++)
+    {
+        struct ufsm_event e =
+        {
+            .id = (id << 24) | n,
+        };
+
+        while (ufsm_queue_put_event(&q, &e) == UFSM_ERROR_QUEUE_FULL)
+            ;
+    }
+
+    return NULL;
+}
+
+static void consume(uint32_t no_of_producers)
+{
+    struct ufsm_event batch[BATCH_SIZE];
+    uint32_t next[NO_OF_PRODUCERS] = {0};
+    uint32_t total = 0;
+    uint32_t count = 0;
+
+    while (total < no_of_producers * NO_OF_EVENTS)
+    {
+        if (ufsm_queue_get_batch(&q, batch, BATCH_SIZE, &count) != UFSM_OK)
+            continue;
+
+        assert (count > 0 && count <= BATCH_SIZE);
+
+        /* Events from one producer arrive in order */
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t id = batch[i].id >> 24;
+
+            assert (id < no_of_producers);
+            assert ((batch[i].id & 0xffffff) == next[id]);
+            next[id]++;
+        }
+
+        total += count;
+    }
+
+    assert (ufsm_queue_get_batch(&q, batch, BATCH_SIZE, &count) ==
+                                        UFSM_ERROR_QUEUE_EMPTY);
+    assert (count == 0);
+}
+
+int main(void)
+{
+    pthread_t threads[NO_OF_PRODUCERS];
+    struct ufsm_event e = { .id = 1 };
+    uint32_t ev;
+
+    /* Sizes must be a power of two */
+    assert (ufsm_queue_init_spsc(&q, 3, q_data) == UFSM_ERROR);
+    assert (ufsm_queue_init_mpsc(&q, 3, q_data, q_seq) == UFSM_ERROR);
+
+    /* The plain API works on top of the lock-free queues */
+    assert (ufsm_queue_init_spsc(&q, 2, q_data) == UFSM_OK);
+    assert (ufsm_queue_put(&q, 1) == UFSM_OK);
+    assert (ufsm_queue_put_event(&q, &e) == UFSM_OK);
+    assert (ufsm_queue_put(&q, 3) == UFSM_ERROR_QUEUE_FULL);
+    assert (ufsm_queue_get(&q, &ev) == UFSM_OK && ev == 1);
+    assert (ufsm_queue_put(&q, 3) == UFSM_OK);
+    assert (ufsm_queue_get(&q, &ev) == UFSM_OK && ev == 1);
+    assert (ufsm_queue_get(&q, &ev) == UFSM_OK && ev == 3);
+    assert (ufsm_queue_get(&q, &ev) == UFSM_ERROR_QUEUE_EMPTY);
+
+    assert (ufsm_queue_init_mpsc(&q, 2, q_data, q_seq) == UFSM_OK);
+    assert (ufsm_queue_put(&q, 1) == UFSM_OK);
+    assert (ufsm_queue_put(&q, 2) == UFSM_OK);
+    assert (ufsm_queue_put(&q, 3) == UFSM_ERROR_QUEUE_FULL);
+    assert (ufsm_queue_get(&q, &ev) == UFSM_OK && ev == 1);
+    assert (ufsm_queue_get(&q, &ev) == UFSM_OK && ev == 2);
+    assert (ufsm_queue_get(&q, &ev) == UFSM_ERROR_QUEUE_EMPTY);
+
+    /* One producer thread */
+    assert (ufsm_queue_init_spsc(&q, QUEUE_SIZE, q_data) == UFSM_OK);
+    pthread_create(&threads[0], NULL, &producer, (void *) 0);
+    consume(1);
+    pthread_join(threads[0], NULL);
+
+    /* Several producer threads */
+    assert (ufsm_queue_init_mpsc(&q, QUEUE_SIZE, q_data, q_seq) == UFSM_OK);
+
+    for (uintptr_t i = 0; i < NO_OF_PRODUCERS; i++)
+        pthread_create(&threads[i], NULL, &producer, (void *) i);
+
+    consume(NO_OF_PRODUCERS);
+
+    for (uint32_t i = 0; i < NO_OF_PRODUCERS; i++)
+        pthread_join(threads[i], NULL);
+
+    printf ("%u events from %u producers\n", NO_OF_EVENTS * NO_OF_PRODUCERS,
+                                            NO_OF_PRODUCERS);
+
+    return 0;
+}
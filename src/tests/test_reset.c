@@ -0,0 +1,291 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <ufsm.h>
+#include <test_reset_input.h>
+#include "common.h"
+
+/* Reset after visiting nested and history states. Generated machines clear
+ * the regions of the touched states through the state table, hand written
+ * machines walk down from the top regions through the touched states only.
+ * */
+
+void final(void) {}
+void eB(void) {}
+void eA2(void) {}
+void xA2(void) {}
+void eA1(void) {}
+void xA1(void) {}
+void eE(void) {}
+void xE(void) {}
+void eD(void) {}
+void xD(void) {}
+void eC(void) {}
+void xC(void) {}
+void eA(void) {}
+void xA(void) {}
+
+enum events {
+    EV_X,
+};
+
+static struct ufsm_state X;
+static struct ufsm_state Y;
+static struct ufsm_state X1;
+static struct ufsm_state X11;
+static struct ufsm_state Y1;
+static struct ufsm_region region1;
+static struct ufsm_region region_x;
+static struct ufsm_region region_x1;
+static struct ufsm_region region_y;
+
+static struct ufsm_trigger x_trigger =
+{
+    .name = "EV_X",
+    .trigger = EV_X,
+};
+
+static struct ufsm_state INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &X,
+};
+
+static struct ufsm_state X =
+{
+    .name = "X",
+    .kind = UFSM_STATE_SIMPLE,
+    .region = &region_x,
+    .parent_region = &region1,
+    .next = &Y,
+};
+
+/* Never entered */
+static struct ufsm_state Y =
+{
+    .name = "Y",
+    .kind = UFSM_STATE_SIMPLE,
+    .region = &region_y,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &INIT,
+    .dest = &X,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .name = "Region 1",
+    .state = &INIT,
+    .transition = &transition_INIT,
+    .next = NULL,
+};
+
+static struct ufsm_state X_INIT =
+{
+    .name = "X Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region_x,
+    .next = &X1,
+};
+
+static struct ufsm_state X1 =
+{
+    .name = "X1",
+    .kind = UFSM_STATE_SIMPLE,
+    .region = &region_x1,
+    .parent_region = &region_x,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_X_INIT =
+{
+    .name = "X Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &X_INIT,
+    .dest = &X1,
+    .next = NULL,
+};
+
+static struct ufsm_region region_x =
+{
+    .name = "Region X",
+    .state = &X_INIT,
+    .transition = &transition_X_INIT,
+    .has_history = true,
+    .next = NULL,
+};
+
+static struct ufsm_state X1_INIT =
+{
+    .name = "X1 Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region_x1,
+    .next = &X11,
+};
+
+static struct ufsm_state X11 =
+{
+    .name = "X11",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region_x1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_X11_X11 =
+{
+    .name = "X11 to X11",
+    .trigger = &x_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &X11,
+    .dest = &X11,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_X1_INIT =
+{
+    .name = "X1 Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &X1_INIT,
+    .dest = &X11,
+    .next = &transition_X11_X11,
+};
+
+static struct ufsm_region region_x1 =
+{
+    .name = "Region X1",
+    .state = &X1_INIT,
+    .transition = &transition_X1_INIT,
+    .has_history = true,
+    .next = NULL,
+};
+
+static struct ufsm_state Y1 =
+{
+    .name = "Y1",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region_y,
+    .next = NULL,
+};
+
+static struct ufsm_region region_y =
+{
+    .name = "Region Y",
+    .state = &Y1,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine hand_written =
+{
+    .name = "Reset Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+static struct ufsm_state * find_state(struct ufsm_machine *m,
+                                      const char *name)
+{
+    for (uint32_t n = 1; n <= m->no_of_states; n++)
+    {
+        if (strcmp(m->states[n]->name, name) == 0)
+            return m->states[n];
+    }
+
+    assert (false && "No such state");
+
+    return NULL;
+}
+
+static void assert_cleared(struct ufsm_machine *m)
+{
+    for (uint32_t n = 1; n <= m->no_of_states; n++)
+    {
+        struct ufsm_region *r = m->states[n]->parent_region;
+
+        assert (r->current == NULL && r->history == NULL);
+        assert (!ufsm_is_active(m, m->states[n]));
+    }
+}
+
+static void test_generated(void)
+{
+    struct ufsm_machine *m = get_StateMachine1();
+    struct ufsm_state *A1 = find_state(m, "A1");
+    struct ufsm_state *D = find_state(m, "D");
+
+    test_init(m);
+    assert (ufsm_init_machine(m) == UFSM_OK);
+
+    /* Down into C and out again, A keeps a deep history of D */
+    test_process(m, EV_A);
+    test_process(m, EV_1);
+    test_process(m, EV_1);
+    test_process(m, EV_1);
+    assert (ufsm_is_active(m, D));
+
+    test_process(m, EV_B);
+    assert (!ufsm_is_active(m, D));
+    assert (find_state(m, "A")->region->history != NULL);
+
+    assert (ufsm_reset_machine(m) == UFSM_OK);
+    assert_cleared(m);
+    assert (m->context.stack.pos == 0);
+
+    /* The history is gone, A starts over in A1 */
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    test_process(m, EV_A);
+    assert (ufsm_is_active(m, A1) && !ufsm_is_active(m, D));
+
+    assert (ufsm_reset_machine(m) == UFSM_OK);
+    assert_cleared(m);
+
+    /* Nothing has been touched since */
+    assert (ufsm_reset_machine(m) == UFSM_OK);
+    assert_cleared(m);
+}
+
+static void test_hand_written(void)
+{
+    struct ufsm_machine *m = &hand_written;
+
+    test_init(m);
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    test_process(m, EV_X);
+
+    assert (ufsm_is_active(m, &X11));
+    assert (region_x.history == &X1 && region_x1.history == &X11);
+
+    /* Y was never entered, so its region is not visited by the reset. A
+     * marker left there shows that the walk skips it.
+     * */
+    region_y.history = &Y1;
+
+    assert (ufsm_reset_machine(m) == UFSM_OK);
+    assert (m->context.stack.pos == 0);
+    assert (!region1.current && !region_x.current && !region_x1.current);
+    assert (!region_x.history && !region_x1.history);
+    assert (!ufsm_is_active(m, &X) && !ufsm_is_active(m, &X11));
+    assert (region_y.history == &Y1);
+
+    region_y.history = NULL;
+
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    assert (ufsm_is_active(m, &X) && ufsm_is_active(m, &X11));
+}
+
+int main(void)
+{
+    test_generated();
+    test_hand_written();
+
+    return 0;
+}
@@ -0,0 +1,279 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <assert.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <ufsm.h>
+#include "common.h"
+
+#define NO_OF_EVENTS 1000
+#define MSEC 1000000ULL
+
+enum events {
+    EV_A,
+    EV_B,
+    EV_STOP,
+    EV_TERMINATE,
+};
+
+static struct ufsm_machine m;
+static uint32_t no_of_transitions = 0;
+
+static void count_f(void)
+{
+    no_of_transitions++;
+}
+
+static void stop_f(void)
+{
+    ufsm_stop(&m);
+}
+
+static uint32_t no_of_wakes = 0;
+
+static void wake_f(struct ufsm_queue *q)
+{
+    __atomic_add_fetch(&no_of_wakes, 1, __ATOMIC_SEQ_CST);
+}
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_state T;
+static struct ufsm_region region1;
+static struct ufsm_transition transition_B;
+static struct ufsm_transition transition_A;
+static struct ufsm_transition transition_stop;
+static struct ufsm_transition transition_T;
+static struct ufsm_transition transition_INIT;
+
+static struct ufsm_trigger a_trigger =
+{
+    .name = "EV_A",
+    .trigger = EV_A,
+    .next = NULL,
+};
+
+static struct ufsm_trigger b_trigger =
+{
+    .name = "EV_B",
+    .trigger = EV_B,
+    .next = NULL,
+};
+
+static struct ufsm_trigger stop_trigger =
+{
+    .name = "EV_STOP",
+    .trigger = EV_STOP,
+    .next = NULL,
+};
+
+static struct ufsm_trigger terminate_trigger =
+{
+    .name = "EV_TERMINATE",
+    .trigger = EV_TERMINATE,
+    .next = NULL,
+};
+
+static struct ufsm_action count =
+{
+    .name = "count",
+    .f = &count_f,
+    .next = NULL,
+};
+
+static struct ufsm_action stop =
+{
+    .name = "stop",
+    .f = &stop_f,
+    .next = NULL,
+};
+
+static struct ufsm_state simple_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "State A",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "State B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &T,
+};
+
+static struct ufsm_state T =
+{
+    .name = "Terminate",
+    .kind = UFSM_STATE_TERMINATE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_B =
+{
+    .name = "A to B",
+    .trigger = &a_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .action = &count,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_A,
+};
+
+static struct ufsm_transition transition_A =
+{
+    .name = "B to A",
+    .trigger = &b_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .action = &count,
+    .source = &B,
+    .dest = &A,
+    .next = &transition_stop,
+};
+
+static struct ufsm_transition transition_stop =
+{
+    .name = "Stop",
+    .trigger = &stop_trigger,
+    .kind = UFSM_TRANSITION_INTERNAL,
+    .action = &stop,
+    .source = &A,
+    .dest = &A,
+    .next = &transition_T,
+};
+
+static struct ufsm_transition transition_T =
+{
+    .name = "A to Terminate",
+    .trigger = &terminate_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &T,
+    .next = &transition_INIT,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &simple_INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .state = &simple_INIT,
+    .transition = &transition_B,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Run Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+static void put(uint32_t ev)
+{
+    while (ufsm_queue_put(ufsm_get_queue(&m), ev) == UFSM_ERROR_QUEUE_FULL)
+        usleep(100);
+}
+
+static void * producer(void *arg)
+{
+    for (uint32_t n = 0; n < NO_OF_EVENTS; n++)
+    {
+        put((n % 2) ? EV_B : EV_A);
+
+        if (n % 100 == 0)
+            usleep(1000);
+    }
+
+    put(EV_STOP);
+
+    return NULL;
+}
+
+static void * stopper(void *arg)
+{
+    usleep(10000);
+    ufsm_stop(&m);
+
+    return NULL;
+}
+
+int main(void)
+{
+    uint32_t err;
+    uint64_t t0;
+    pthread_t t;
+
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK && "Initializing");
+
+    /* Queued events are processed even if the deadline has passed */
+    put(EV_A);
+    put(EV_B);
+    put(EV_A);
+    err = ufsm_run_until(&m, 1);
+    assert (err == UFSM_OK);
+    assert (no_of_transitions == 3);
+    assert (m.region->current == &B);
+
+    put(EV_B);
+    err = ufsm_run_until(&m, 1);
+    assert (err == UFSM_OK && m.region->current == &A);
+
+    /* Sleeps until the deadline when there is nothing to do */
+    t0 = ufsm_run_time();
+    err = ufsm_run_until(&m, t0 + 20 * MSEC);
+    assert (err == UFSM_OK);
+    assert (ufsm_run_time() - t0 >= 20 * MSEC);
+
+    /* Woken by producers, stopped from an action. A wake hook set by the
+     * application keeps being called and is put back on return.
+     * */
+    no_of_transitions = 0;
+    ufsm_get_queue(&m)->wake = &wake_f;
+    pthread_create(&t, NULL, &producer, NULL);
+    err = ufsm_run(&m);
+    pthread_join(t, NULL);
+    assert (err == UFSM_OK);
+    assert (no_of_transitions == NO_OF_EVENTS);
+    assert (m.region->current == &A);
+    assert (no_of_wakes == NO_OF_EVENTS + 1);
+    assert (ufsm_get_queue(&m)->wake == &wake_f);
+    assert (ufsm_get_queue(&m)->next_wake == NULL);
+    ufsm_get_queue(&m)->wake = NULL;
+
+    /* Stopped from another thread while sleeping */
+    pthread_create(&t, NULL, &stopper, NULL);
+    err = ufsm_run(&m);
+    pthread_join(t, NULL);
+    assert (err == UFSM_OK);
+
+    put(EV_TERMINATE);
+    put(EV_A);
+    err = ufsm_run(&m);
+    assert (err == UFSM_ERROR_MACHINE_TERMINATED);
+    assert (no_of_transitions == NO_OF_EVENTS);
+
+    printf ("%u events processed\n", NO_OF_EVENTS);
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <ufsm.h>
+#include "common.h"
+
+#define NO_OF_MACHINES 64
+#define NO_OF_WORKERS 4
+#define NO_OF_PRODUCERS 4
+#define NO_OF_EVENTS 2048
+#define RUN_QUEUE_SIZE 32
+
+enum events {
+    EV_TOGGLE,
+};
+
+/* Per-machine context, carried as the event payload */
+struct context
+{
+    uint32_t inside;
+    uint32_t processed;
+};
+
+static struct ufsm_state A[NO_OF_MACHINES];
+static struct ufsm_state B[NO_OF_MACHINES];
+static struct ufsm_state INIT[NO_OF_MACHINES];
+static struct ufsm_region region[NO_OF_MACHINES];
+static struct ufsm_transition transition_A[NO_OF_MACHINES];
+static struct ufsm_transition transition_B[NO_OF_MACHINES];
+static struct ufsm_transition transition_INIT[NO_OF_MACHINES];
+static struct ufsm_machine m[NO_OF_MACHINES];
+static struct ufsm_storage storage[NO_OF_MACHINES];
+static struct ufsm_event queue_data[NO_OF_MACHINES][16];
+static uint32_t queue_seq[NO_OF_MACHINES][16];
+static struct context context[NO_OF_MACHINES];
+
+static struct ufsm_sched sched;
+static struct ufsm_sched_worker workers[NO_OF_WORKERS];
+static struct ufsm_machine *run_data[NO_OF_WORKERS * RUN_QUEUE_SIZE];
+static uint32_t run_seq[NO_OF_WORKERS * RUN_QUEUE_SIZE];
+
+static uint32_t total = 0;
+
+static struct ufsm_trigger toggle_trigger =
+{
+    .name = "EV_TOGGLE",
+    .trigger = EV_TOGGLE,
+    .next = NULL,
+};
+
+static void release_f(struct ufsm_event *e)
+{
+    struct context *c = e->ptr;
+
+    /* A machine is never processed on two workers at once */
+    assert (__atomic_fetch_add(&c->inside, 1, __ATOMIC_SEQ_CST) == 0);
+    c->processed++;
+    __atomic_fetch_sub(&c->inside, 1, __ATOMIC_SEQ_CST);
+
+    __atomic_fetch_add(&total, 1, __ATOMIC_SEQ_CST);
+}
+
+static void build_machine(uint32_t i)
+{
+    INIT[i] = (struct ufsm_state)
+    {
+        .name = "Init",
+        .kind = UFSM_STATE_INIT,
+        .parent_region = &region[i],
+        .next = &A[i],
+    };
+
+    A[i] = (struct ufsm_state)
+    {
+        .name = "State A",
+        .kind = UFSM_STATE_SIMPLE,
+        .parent_region = &region[i],
+        .next = &B[i],
+    };
+
+    B[i] = (struct ufsm_state)
+    {
+        .name = "State B",
+        .kind = UFSM_STATE_SIMPLE,
+        .parent_region = &region[i],
+        .next = NULL,
+    };
+
+    transition_B[i] = (struct ufsm_transition)
+    {
+        .name = "A to B",
+        .trigger = &toggle_trigger,
+        .kind = UFSM_TRANSITION_EXTERNAL,
+        .source = &A[i],
+        .dest = &B[i],
+        .next = &transition_A[i],
+    };
+
+    transition_A[i] = (struct ufsm_transition)
+    {
+        .name = "B to A",
+        .trigger = &toggle_trigger,
+        .kind = UFSM_TRANSITION_EXTERNAL,
+        .source = &B[i],
+        .dest = &A[i],
+        .next = &transition_INIT[i],
+    };
+
+    transition_INIT[i] = (struct ufsm_transition)
+    {
+        .name = "Init",
+        .kind = UFSM_TRANSITION_EXTERNAL,
+        .source = &INIT[i],
+        .dest = &A[i],
+        .next = NULL,
+    };
+
+    region[i] = (struct ufsm_region)
+    {
+        .state = &INIT[i],
+        .transition = &transition_B[i],
+        .next = NULL,
+    };
+
+    m[i] = (struct ufsm_machine)
+    {
+        .name = "Scheduler Test Machine",
+        .region = &region[i],
+        .storage = &storage[i],
+    };
+
+    assert (ufsm_queue_init_mpsc(&m[i].queue, 16, queue_data[i],
+                                                  queue_seq[i]) == UFSM_OK);
+    assert (ufsm_init_machine(&m[i]) == UFSM_OK);
+}
+
+static void * worker(void *arg)
+{
+    assert (ufsm_sched_run(&sched, (uint32_t) (uintptr_t) arg) == UFSM_OK);
+
+    return NULL;
+}
+
+static void * producer(void *arg)
+{
+    for (uint32_t n = 0; n < NO_OF_EVENTS; n++)
+    {
+        uint32_t i = (n + (uint32_t) (uintptr_t) arg) % NO_OF_MACHINES;
+        struct ufsm_event e =
+        {
+            .id = EV_TOGGLE,
+            .ptr = &context[i],
+            .release = &release_f,
+        };
+
+        while (ufsm_sched_post_event(&sched, &m[i], &e) ==
+                                        UFSM_ERROR_QUEUE_FULL)
+            sched_yield();
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    pthread_t worker_threads[NO_OF_WORKERS];
+    pthread_t producer_threads[NO_OF_PRODUCERS];
+
+    assert (ufsm_sched_init(&sched, workers, NO_OF_WORKERS, 3,
+                            run_data, run_seq) == UFSM_ERROR);
+    assert (ufsm_sched_init(&sched, workers, NO_OF_WORKERS, RUN_QUEUE_SIZE,
+                            run_data, run_seq) == UFSM_OK);
+
+    for (uint32_t i = 0; i < NO_OF_MACHINES; i++)
+        build_machine(i);
+
+    for (uintptr_t i = 0; i < NO_OF_WORKERS; i++)
+        pthread_create(&worker_threads[i], NULL, &worker, (void *) i);
+
+    for (uintptr_t i = 0; i < NO_OF_PRODUCERS; i++)
+        pthread_create(&producer_threads[i], NULL, &producer, (void *) i);
+
+    for (uint32_t i = 0; i < NO_OF_PRODUCERS; i++)
+        pthread_join(producer_threads[i], NULL);
+
+    while (__atomic_load_n(&total, __ATOMIC_SEQ_CST) <
+                            NO_OF_PRODUCERS * NO_OF_EVENTS)
+        sched_yield();
+
+    ufsm_sched_stop(&sched);
+
+    for (uint32_t i = 0; i < NO_OF_WORKERS; i++)
+        pthread_join(worker_threads[i], NULL);
+
+    /* Every machine got an even number of toggles */
+    for (uint32_t i = 0; i < NO_OF_MACHINES; i++)
+    {
+        assert (context[i].processed ==
+                        NO_OF_PRODUCERS * NO_OF_EVENTS / NO_OF_MACHINES);
+        assert (m[i].region->current == &A[i]);
+    }
+
+    printf ("%u events on %u machines, %u workers\n",
+                NO_OF_PRODUCERS * NO_OF_EVENTS, NO_OF_MACHINES,
+                NO_OF_WORKERS);
+
+    return 0;
+}
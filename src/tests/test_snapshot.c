@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <ufsm.h>
+#include <test_snapshot_input.h>
+#include "common.h"
+
+static bool flag_eA1 = false;
+static bool flag_eD = false;
+static bool flag_eC = false;
+
+void final(void) {}
+void eA2(void) {}
+void xA2(void) {}
+void xA1(void) {}
+void eE(void) {}
+void xE(void) {}
+void xD(void) {}
+void xC(void) {}
+void eA(void) {}
+void xA(void) {}
+void eB(void) {}
+
+void eA1(void)
+{
+    flag_eA1 = true;
+}
+
+void eD(void)
+{
+    flag_eD = true;
+}
+
+void eC(void)
+{
+    flag_eC = true;
+}
+
+static void process(struct ufsm_machine *m, struct ufsm_instance *i,
+                    int32_t ev)
+{
+    uint32_t err = ufsm_process_instance(m, i, ev);
+
+    if (err != UFSM_OK)
+        printf ("ERROR: %s\n", ufsm_errors[err]);
+    assert (err == UFSM_OK);
+}
+
+int main(void)
+{
+    struct ufsm_machine *m = get_StateMachine1();
+    uint32_t data1[StateMachine1_INSTANCE_DATA_SIZE];
+    uint32_t data2[StateMachine1_INSTANCE_DATA_SIZE];
+    struct ufsm_event queue_data1[4];
+    struct ufsm_event queue_data2[4];
+    struct ufsm_queue q1 = { 0 };
+    struct ufsm_queue q2 = { 0 };
+    uint32_t id_data[4];
+    struct ufsm_queue id_queue = { 0 };
+    struct ufsm_event lane_data[2][4];
+    struct ufsm_queue lanes[2] = { { 0 } };
+    struct ufsm_queue lane_queue = { 0 };
+    struct ufsm_instance i1;
+    struct ufsm_instance i2;
+    struct ufsm_event e =
+    {
+        .id = EV_A,
+        .size = 2,
+        .data = { 0xab, 0xcd },
+    };
+    uint8_t buf[64];
+    uint32_t used = 0;
+    uint32_t size = 0;
+
+    test_init(m);
+
+    assert (ufsm_instance_init(&i1, m, StateMachine1_INSTANCE_DATA_SIZE,
+                                                        data1) == UFSM_OK);
+    assert (ufsm_instance_init(&i2, m, StateMachine1_INSTANCE_DATA_SIZE,
+                                                        data2) == UFSM_OK);
+    ufsm_queue_init_events(&q1, 4, queue_data1);
+    ufsm_queue_init_events(&q2, 4, queue_data2);
+    i1.queue = &q1;
+    i2.queue = &q2;
+
+    assert (ufsm_init_machine_instance(m, &i1) == UFSM_OK);
+    assert (ufsm_init_machine_instance(m, &i2) == UFSM_OK);
+
+    /* Leave the deepest state so it is stored as history */
+    process(m, &i1, EV_A);
+    process(m, &i1, EV_1);
+    process(m, &i1, EV_1);
+    process(m, &i1, EV_1);
+    process(m, &i1, EV_B);
+    assert (ufsm_queue_put_event(&q1, &e) == UFSM_OK);
+
+    /* The needed size is reported when the buffer is too small */
+    assert (ufsm_snapshot_instance(m, &i1, buf, 4, &size) ==
+                                        UFSM_ERROR_BUFFER_TOO_SMALL);
+    assert (ufsm_snapshot_instance(m, &i1, buf, sizeof(buf), &used) ==
+                                        UFSM_OK);
+    assert (used == size);
+    printf ("Snapshot is %u bytes\n", used);
+
+    /* Taking a snapshot doesn't consume queued events */
+    assert (q1.s == 1);
+
+    assert (ufsm_restore_instance(m, &i2, buf, used - 1) == UFSM_ERROR);
+    assert (ufsm_restore_instance(m, &i2, buf, used) == UFSM_OK);
+    assert (memcmp(data1, data2, sizeof(data1)) == 0);
+
+    assert (ufsm_queue_get_event(&q2, &e) == UFSM_OK);
+    assert (e.id == EV_A && e.size == 2);
+    assert (e.data[0] == 0xab && e.data[1] == 0xcd);
+
+    /* The restored instance resumes from its deep history */
+    flag_eA1 = false;
+    process(m, &i2, EV_A);
+    assert (!flag_eA1 && flag_eD && flag_eC);
+
+    /* Events referring to memory can't be stored */
+    e.ptr = buf;
+    assert (ufsm_queue_put_event(&q1, &e) == UFSM_OK);
+    assert (ufsm_snapshot_instance(m, &i1, buf, sizeof(buf), &used) ==
+                                        UFSM_ERROR);
+
+    /* Id only queues hand out whole records, lane zero included */
+    ufsm_queue_init(&id_queue, 4, id_data);
+    assert (ufsm_queue_put(&id_queue, EV_B) == UFSM_OK);
+    memset(&e, 0xff, sizeof(e));
+    assert (ufsm_queue_peek_event(&id_queue, 0, &e) == UFSM_OK);
+    assert (e.id == EV_B && e.lane == 0 && e.size == 0);
+    assert (!e.ptr && !e.release);
+
+    /* and such a snapshot restores into a queue with lanes */
+    i1.queue = &id_queue;
+    assert (ufsm_snapshot_instance(m, &i1, buf, sizeof(buf), &used) ==
+                                        UFSM_OK);
+
+    ufsm_queue_init_events(&lanes[0], 4, lane_data[0]);
+    ufsm_queue_init_events(&lanes[1], 4, lane_data[1]);
+    ufsm_queue_init_lanes(&lane_queue, 2, lanes);
+    i2.queue = &lane_queue;
+    assert (ufsm_restore_instance(m, &i2, buf, used) == UFSM_OK);
+    assert (ufsm_queue_get_event(&lane_queue, &e) == UFSM_OK);
+    assert (e.id == EV_B && e.lane == 0);
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include <test_storage_input.h>
+#include <test_storage_defer_input.h>
+#include "common.h"
+
+/* Generated machines carry stacks, queues and bitsets sized for their
+ * chart and nothing of the default sizes. Hand written machines take them
+ * from a 'struct ufsm_storage', their own or one of the library's.
+ * */
+
+void final(void) {}
+void eB(void) {}
+void eA2(void) {}
+void xA2(void) {}
+void eA1(void) {}
+void xA1(void) {}
+void eE(void) {}
+void xE(void) {}
+void eD(void) {}
+void xD(void) {}
+void eC(void) {}
+void xC(void) {}
+void eA(void) {}
+void xA(void) {}
+
+static struct ufsm_state A;
+static struct ufsm_region region1;
+
+static struct ufsm_state INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "A",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .name = "Region 1",
+    .state = &INIT,
+    .transition = &transition_INIT,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine hand_written =
+{
+    .name = "Storage Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+static struct ufsm_machine defaults[UFSM_DEFAULT_STORAGES + 1];
+
+static void test_generated(void)
+{
+    struct ufsm_machine *m = get_StateMachine1();
+    struct ufsm_machine *d = get_DeferMachine();
+
+    /* The machine itself holds no event or stack storage */
+    assert (sizeof(struct ufsm_machine) < sizeof(struct ufsm_storage));
+
+    test_init(m);
+    assert (m->storage == NULL);
+    assert (m->context.stack.data);
+    assert (m->context.stack.no_of_elements < UFSM_STACK_SIZE);
+    assert (m->context.stack2.data && m->context.completion_stack.data);
+    assert (m->queue.events && m->queue.no_of_elements == UFSM_QUEUE_SIZE);
+    assert (m->data != NULL);
+
+    /* No deferring transitions, no defer queue */
+    assert (!m->defer_queue.events && m->defer_queue.no_of_elements == 0);
+
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    test_process(m, EV_A);
+    test_process(m, EV_B);
+    assert (m->context.stack.pos == 0);
+
+    test_init(d);
+    assert (d->storage == NULL);
+    assert (d->defer_queue.events);
+    assert (d->defer_queue.no_of_elements == UFSM_DEFER_QUEUE_SIZE);
+
+    /* Deferred events end up in the generated defer queue */
+    ufsm_init_machine(d);
+    ufsm_process(d, EV_D);
+    assert (d->defer_queue.s == 1);
+}
+
+static void test_hand_written(void)
+{
+    struct ufsm_machine *m = &hand_written;
+
+    test_init(m);
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    assert (m->context.stack.data == storage.stack_data);
+    assert (m->context.stack.no_of_elements == UFSM_STACK_SIZE);
+    assert (m->context.stack2.data == storage.stack_data2);
+    assert (m->context.completion_stack.data == storage.completion_stack_data);
+    assert (m->queue.events == storage.queue_data);
+    assert (m->defer_queue.events == storage.defer_queue_data);
+    assert (m->data == storage.data);
+    assert (ufsm_is_active(m, &A));
+}
+
+static void test_default(void)
+{
+    /* Machines without storage share the definition here, each takes one
+     * of the library's storages until they are gone.
+     * */
+    for (uint32_t n = 0; n < UFSM_DEFAULT_STORAGES; n++)
+    {
+        struct ufsm_machine *m = &defaults[n];
+
+        m->name = "Default Storage Test Machine";
+        m->region = &region1;
+        assert (ufsm_init_machine(m) == UFSM_OK);
+        assert (m->storage && (m->storage != &storage));
+        assert (m->context.stack.data == m->storage->stack_data);
+        assert (n == 0 || m->storage != defaults[n - 1].storage);
+
+        /* and keeps it */
+        assert (ufsm_reset_machine(m) == UFSM_OK);
+        assert (ufsm_init_machine(m) == UFSM_OK);
+    }
+
+    defaults[UFSM_DEFAULT_STORAGES].region = &region1;
+    assert (ufsm_init_machine(&defaults[UFSM_DEFAULT_STORAGES]) ==
+                                            UFSM_ERROR_NO_STORAGE);
+}
+
+int main(void)
+{
+    test_generated();
+    test_hand_written();
+    test_default();
+
+    return 0;
+}
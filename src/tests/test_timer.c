@@ -0,0 +1,323 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+enum events {
+    EV_TIMEOUT,
+    EV_SKIP,
+    EV_BACK,
+    EV_OTHER,
+};
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_region region1;
+static struct ufsm_transition transition_skip;
+static struct ufsm_transition transition_back;
+static struct ufsm_transition transition_INIT;
+
+static struct ufsm_timer_wheel wheel;
+static struct ufsm_timer timers[1];
+
+static struct ufsm_trigger timeout_trigger =
+{
+    .name = "after(10)",
+    .trigger = EV_TIMEOUT,
+    .next = NULL,
+};
+
+static struct ufsm_trigger skip_trigger =
+{
+    .name = "EV_SKIP",
+    .trigger = EV_SKIP,
+    .next = &timeout_trigger,
+};
+
+static struct ufsm_trigger back_trigger =
+{
+    .name = "EV_BACK",
+    .trigger = EV_BACK,
+    .next = NULL,
+};
+
+static struct ufsm_time_event A_time_events[] =
+{
+    {
+        .index = 0,
+        .ticks = 10,
+        .absolute = false,
+        .ev = EV_TIMEOUT,
+        .next = NULL,
+    },
+};
+
+static struct ufsm_state simple_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "State A",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .time_events = A_time_events,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "State B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_skip =
+{
+    .name = "A to B",
+    .trigger = &skip_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_back,
+};
+
+static struct ufsm_transition transition_back =
+{
+    .name = "B to A",
+    .trigger = &back_trigger,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B,
+    .dest = &A,
+    .next = &transition_INIT,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &simple_INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .state = &simple_INIT,
+    .transition = &transition_skip,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Timer Test Machine",
+    .region = &region1,
+    .storage = &storage,
+    .wheel = &wheel,
+    .timers = timers,
+    .no_of_timers = 1,
+};
+
+static bool wheel_locked = false;
+static struct ufsm_timer *cancel_on_put = NULL;
+
+static void wheel_lock(void)
+{
+    assert (!wheel_locked);
+    wheel_locked = true;
+}
+
+static void wheel_unlock(void)
+{
+    assert (wheel_locked);
+    wheel_locked = false;
+}
+
+static void queue_lock(void)
+{
+    assert (!wheel_locked);
+
+    if (cancel_on_put)
+        ufsm_timer_cancel(&wheel, cancel_on_put);
+}
+
+static void queue_unlock(void)
+{
+    assert (!wheel_locked);
+}
+
+static void process_queue(void)
+{
+    uint32_t ev;
+
+    while (ufsm_queue_get(&m.queue, &ev) == UFSM_OK)
+        test_process(&m, ev);
+}
+
+static void test_wheel(void)
+{
+    struct ufsm_timer t[3] = {0};
+    uint32_t ev;
+
+    /* Arm, expire and cancel */
+    t[0].queue = &m.queue;
+    t[0].ev = EV_OTHER;
+    ufsm_timer_arm(&wheel, &t[0], 5);
+    assert (ufsm_timer_tick(&wheel, 4) == UFSM_OK);
+    assert (m.queue.s == 0);
+    assert (ufsm_timer_tick(&wheel, 1) == UFSM_OK);
+    assert (ufsm_queue_get(&m.queue, &ev) == UFSM_OK && ev == EV_OTHER);
+
+    ufsm_timer_arm(&wheel, &t[0], 3);
+    ufsm_timer_cancel(&wheel, &t[0]);
+    ufsm_timer_cancel(&wheel, &t[0]);
+    assert (ufsm_timer_tick(&wheel, 10) == UFSM_OK);
+    assert (m.queue.s == 0);
+
+    /* Timers on higher levels are cascaded and expire on time, also
+     * beyond the range of the wheel.
+     * */
+    t[1].queue = &m.queue;
+    t[1].ev = EV_OTHER;
+    t[2].queue = &m.queue;
+    t[2].ev = EV_OTHER;
+    ufsm_timer_arm(&wheel, &t[1], 100000);
+    ufsm_timer_arm_at(&wheel, &t[2], wheel.now + (1ULL << 24) + 7);
+    assert (ufsm_timer_tick(&wheel, 99999) == UFSM_OK);
+    assert (m.queue.s == 0);
+    assert (ufsm_timer_tick(&wheel, 1) == UFSM_OK);
+    assert (m.queue.s == 1);
+    assert (ufsm_queue_get(&m.queue, &ev) == UFSM_OK);
+
+    assert (ufsm_timer_tick(&wheel, (1ULL << 24) + 7 - 100001) == UFSM_OK);
+    assert (m.queue.s == 0);
+    assert (ufsm_timer_tick(&wheel, 1) == UFSM_OK);
+    assert (ufsm_queue_get(&m.queue, &ev) == UFSM_OK);
+
+    /* A time in the past expires on the next tick */
+    ufsm_timer_arm_at(&wheel, &t[0], 0);
+    assert (ufsm_timer_tick(&wheel, 1) == UFSM_OK);
+    assert (ufsm_queue_get(&m.queue, &ev) == UFSM_OK);
+
+    /* An event that doesn't fit is retried on the next tick */
+    while (ufsm_queue_put(&m.queue, EV_OTHER) == UFSM_OK)
+        ;
+
+    ufsm_timer_arm(&wheel, &t[0], 0);
+    assert (ufsm_timer_tick(&wheel, 1) == UFSM_ERROR_QUEUE_FULL);
+    assert (ufsm_queue_get(&m.queue, &ev) == UFSM_OK);
+    assert (ufsm_timer_tick(&wheel, 1) == UFSM_OK);
+
+    while (ufsm_queue_get(&m.queue, &ev) == UFSM_OK)
+        ;
+}
+
+/* The events are posted with the wheel unlocked, also when more timers
+ * expire on one tick than fit in a batch.
+ * */
+static void test_unlocked(void)
+{
+    struct ufsm_timer t[UFSM_TIMER_BATCH * 2 + 1] = {0};
+    uint32_t data[UFSM_TIMER_BATCH * 4];
+    struct ufsm_queue q = {0};
+    uint32_t no_of_timers = sizeof(t) / sizeof(t[0]);
+    uint32_t ev;
+
+    assert (ufsm_queue_init(&q, UFSM_TIMER_BATCH * 4, data) == UFSM_OK);
+    q.lock = queue_lock;
+    q.unlock = queue_unlock;
+    wheel.lock = wheel_lock;
+    wheel.unlock = wheel_unlock;
+
+    for (uint32_t n = 0; n < no_of_timers; n++)
+    {
+        t[n].queue = &q;
+        t[n].ev = n;
+        ufsm_timer_arm(&wheel, &t[n], 70);
+    }
+
+    assert (ufsm_timer_tick(&wheel, 69) == UFSM_OK);
+    assert (q.s == 0);
+    assert (ufsm_timer_tick(&wheel, 1) == UFSM_OK);
+    assert (q.s == no_of_timers);
+
+    for (uint32_t n = 0; n < no_of_timers; n++)
+        assert (ufsm_queue_get(&q, &ev) == UFSM_OK && ev == n);
+
+    /* A timer canceled while its event is posted is not retried */
+    while (ufsm_queue_put(&q, EV_OTHER) == UFSM_OK)
+        ;
+
+    ufsm_timer_arm(&wheel, &t[0], 1);
+    cancel_on_put = &t[0];
+    assert (ufsm_timer_tick(&wheel, 1) == UFSM_ERROR_QUEUE_FULL);
+    cancel_on_put = NULL;
+    assert (ufsm_queue_get(&q, &ev) == UFSM_OK);
+    assert (ufsm_timer_tick(&wheel, 10) == UFSM_OK);
+    assert (q.s == UFSM_TIMER_BATCH * 4 - 1);
+
+    assert (!wheel_locked);
+    wheel.lock = NULL;
+    wheel.unlock = NULL;
+}
+
+int main(void)
+{
+    uint32_t err;
+
+    test_init(&m);
+    ufsm_timer_init(&wheel);
+
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK && "Initializing");
+
+    /* The wheel on its own, with A's timer out of the way */
+    ufsm_timer_cancel(&wheel, &timers[0]);
+    test_wheel();
+    test_unlocked();
+
+    assert (ufsm_reset_machine(&m) == UFSM_OK);
+    assert (ufsm_init_machine(&m) == UFSM_OK);
+    assert (m.region->current == &A);
+
+    assert (ufsm_timer_tick(&wheel, 9) == UFSM_OK);
+    process_queue();
+    assert (m.region->current == &A);
+
+    assert (ufsm_timer_tick(&wheel, 1) == UFSM_OK);
+    process_queue();
+    assert (m.region->current == &B);
+
+    /* Leaving A cancels the timer */
+    test_process(&m, EV_BACK);
+    assert (m.region->current == &A);
+    test_process(&m, EV_SKIP);
+    assert (m.region->current == &B);
+    assert (ufsm_timer_tick(&wheel, 100) == UFSM_OK);
+    assert (m.queue.s == 0);
+
+    /* Re-entering A restarts it */
+    test_process(&m, EV_BACK);
+    assert (ufsm_timer_tick(&wheel, 5) == UFSM_OK);
+    test_process(&m, EV_SKIP);
+    test_process(&m, EV_BACK);
+    assert (ufsm_timer_tick(&wheel, 9) == UFSM_OK);
+    assert (m.queue.s == 0);
+    assert (ufsm_timer_tick(&wheel, 1) == UFSM_OK);
+    process_queue();
+    assert (m.region->current == &B);
+
+    /* Reset cancels every timer */
+    test_process(&m, EV_BACK);
+    assert (ufsm_reset_machine(&m) == UFSM_OK);
+    assert (ufsm_timer_tick(&wheel, 100) == UFSM_OK);
+    assert (m.queue.s == 0);
+
+    return 0;
+}
@@ -0,0 +1,234 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <ufsm.h>
+#include <test_trace_input.h>
+#include "common.h"
+
+#define NO_OF_RECORDS 256
+#define NO_OF_LINES 512
+
+static struct ufsm_trace trace;
+static struct ufsm_trace_record records[NO_OF_RECORDS];
+static struct ufsm_trace instance_trace;
+static struct ufsm_trace_record instance_records[NO_OF_RECORDS];
+static uint8_t dump[32768];
+static uint8_t action_dump[32768];
+static uint32_t action_used = 0;
+static struct ufsm_machine *machine = NULL;
+
+static char debug_lines[NO_OF_LINES][256];
+static uint32_t no_of_debug_lines = 0;
+static char trace_lines[NO_OF_LINES][256];
+static uint32_t no_of_trace_lines = 0;
+static uint64_t now = 0;
+
+void final(void) {}
+void eA2(void) {}
+void xA2(void) {}
+void xA1(void) {}
+void eE(void) {}
+void xE(void) {}
+void eD(void) {}
+void xD(void) {}
+void eC(void) {}
+void xC(void) {}
+void eA(void) {}
+void xA(void) {}
+void eB(void) {}
+
+/* Dumps while the machine is in the middle of a transition */
+void eA1(void)
+{
+    uint32_t pos = machine->context.stack.pos;
+    uint32_t pos2 = machine->context.stack2.pos;
+
+    if (!trace.head || action_used)
+        return;
+
+    assert (ufsm_trace_dump(&trace, machine, action_dump,
+                    sizeof(action_dump), &action_used) == UFSM_OK);
+    assert (machine->context.stack.pos == pos);
+    assert (machine->context.stack2.pos == pos2);
+}
+
+static uint64_t clock_f(void)
+{
+    return ++now;
+}
+
+static void run(struct ufsm_machine *m)
+{
+    const uint32_t events[] = {EV_A, EV_1, EV_1, EV_B, EV_A, EV_EXIT};
+
+    assert (ufsm_init_machine(m) == UFSM_OK);
+
+    for (uint32_t n = 0; n < sizeof(events) / sizeof(events[0]); n++)
+        ufsm_process(m, events[n]);
+
+    assert (ufsm_reset_machine(m) == UFSM_OK);
+}
+
+static void collect(const char *line, void *ctx)
+{
+    assert (no_of_trace_lines < NO_OF_LINES);
+    strcpy(trace_lines[no_of_trace_lines++], line);
+}
+
+/* Runs the machine with the printf hooks and keeps what they print */
+static void run_debug(struct ufsm_machine *m)
+{
+    FILE *fp = tmpfile();
+    int saved = dup(STDOUT_FILENO);
+    struct ufsm_machine without_hooks = *m;
+
+    fflush(stdout);
+    dup2(fileno(fp), STDOUT_FILENO);
+
+    ufsm_debug_machine(m);
+    run(m);
+    *m = without_hooks;
+
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+
+    rewind(fp);
+
+    while ((no_of_debug_lines < NO_OF_LINES) &&
+           fgets(debug_lines[no_of_debug_lines], 256, fp))
+    {
+        debug_lines[no_of_debug_lines][
+                    strcspn(debug_lines[no_of_debug_lines], "\n")] = 0;
+        no_of_debug_lines++;
+    }
+
+    fclose(fp);
+}
+
+/* An instance on a context of its own records to the ring of that context
+ * and reads like the machine processed on its own.
+ * */
+static void test_instance(struct ufsm_machine *m)
+{
+    static uint32_t data[StateMachine1_INSTANCE_DATA_SIZE];
+    static void *stacks[StateMachine1_CONTEXT_DATA_SIZE];
+    const uint32_t events[] = {EV_A, EV_1, EV_1, EV_B, EV_A, EV_EXIT};
+    struct ufsm_instance i;
+    struct ufsm_context c;
+    uint32_t head = trace.head;
+    uint32_t used = 0;
+
+    assert (ufsm_trace_init(&instance_trace, NO_OF_RECORDS, instance_records,
+                                                        NULL) == UFSM_OK);
+    assert (ufsm_instance_init(&i, m, StateMachine1_INSTANCE_DATA_SIZE,
+                                                        data) == UFSM_OK);
+    assert (ufsm_context_init(&c, m, StateMachine1_CONTEXT_DATA_SIZE,
+                                                        stacks) == UFSM_OK);
+    assert (c.trace == NULL);
+    ufsm_trace_context(&c, &instance_trace);
+    i.context = &c;
+
+    assert (ufsm_init_machine_instance(m, &i) == UFSM_OK);
+
+    for (uint32_t n = 0; n < sizeof(events) / sizeof(events[0]); n++)
+        ufsm_process_instance(m, &i, events[n]);
+
+    assert (ufsm_reset_machine_instance(m, &i) == UFSM_OK);
+    assert (trace.head == head);
+
+    assert (ufsm_trace_dump(&instance_trace, m, dump, sizeof(dump),
+                                                        &used) == UFSM_OK);
+    no_of_trace_lines = 0;
+    assert (ufsm_trace_decode(dump, used, false, &collect, NULL) == UFSM_OK);
+    assert (no_of_trace_lines == no_of_debug_lines);
+
+    for (uint32_t n = 0; n < no_of_trace_lines; n++)
+        assert (strcmp(trace_lines[n], debug_lines[n]) == 0);
+}
+
+int main(void)
+{
+    struct ufsm_machine *m = get_StateMachine1();
+    uint32_t used = 0;
+
+    machine = m;
+
+    assert (ufsm_trace_init(&trace, 3, records, NULL) == UFSM_ERROR);
+    assert (ufsm_trace_init(&trace, NO_OF_RECORDS, records, &clock_f) ==
+                                                                UFSM_OK);
+
+    run_debug(m);
+    assert (no_of_debug_lines > 10);
+
+    /* Nothing is recorded without a ring */
+    assert (ufsm_init_machine(m) == UFSM_OK);
+    assert (ufsm_reset_machine(m) == UFSM_OK);
+    assert (trace.head == 0);
+
+    ufsm_trace_machine(m, &trace);
+    run(m);
+    ufsm_trace_machine(m, NULL);
+    assert (trace.head > 0 && trace.head < NO_OF_RECORDS);
+
+    assert (ufsm_trace_dump(&trace, m, dump, 16, &used) ==
+                                        UFSM_ERROR_BUFFER_TOO_SMALL);
+    assert (used > 16 && used <= sizeof(dump));
+    assert (ufsm_trace_dump(&trace, m, dump, sizeof(dump), &used) == UFSM_OK);
+
+    /* The decoded dump reads exactly like the printf output */
+    assert (ufsm_trace_decode(dump, used, false, &collect, NULL) == UFSM_OK);
+    assert (no_of_trace_lines == no_of_debug_lines);
+
+    for (uint32_t n = 0; n < no_of_trace_lines; n++)
+    {
+        if (strcmp(trace_lines[n], debug_lines[n]) != 0)
+            printf ("'%s' != '%s'\n", trace_lines[n], debug_lines[n]);
+
+        assert (strcmp(trace_lines[n], debug_lines[n]) == 0);
+    }
+
+    no_of_trace_lines = 0;
+    assert (ufsm_trace_decode(dump, used, true, &collect, NULL) == UFSM_OK);
+    assert (strncmp(trace_lines[1], "                1 ", 18) == 0);
+    assert (strcmp(&trace_lines[1][18], debug_lines[1]) == 0);
+
+    assert (ufsm_trace_decode(dump, used - 1, false, &collect, NULL) ==
+                                                                UFSM_ERROR);
+
+    /* The dump taken from the entry action of A1 names every reference */
+    assert (action_used > 0);
+    no_of_trace_lines = 0;
+    assert (ufsm_trace_decode(action_dump, action_used, false, &collect,
+                                                        NULL) == UFSM_OK);
+    assert (no_of_trace_lines > 1);
+
+    for (uint32_t n = 1; n < no_of_trace_lines; n++)
+        assert (strchr(trace_lines[n], '?') == NULL);
+
+    dump[0] = 'X';
+    assert (ufsm_trace_decode(dump, used, false, &collect, NULL) ==
+                                                                UFSM_ERROR);
+
+    /* A full ring keeps the latest records */
+    ufsm_trace_machine(m, &trace);
+
+    while (trace.head < 2 * NO_OF_RECORDS)
+        run(m);
+
+    ufsm_trace_machine(m, NULL);
+
+    assert (ufsm_trace_dump(&trace, m, dump, sizeof(dump), &used) == UFSM_OK);
+    no_of_trace_lines = 0;
+    assert (ufsm_trace_decode(dump, used, false, &collect, NULL) == UFSM_OK);
+    assert (no_of_trace_lines == NO_OF_RECORDS + 1);
+    assert (strcmp(trace_lines[NO_OF_RECORDS], " -- | RESET      | StateMachine1")
+                                                                        == 0);
+
+    test_instance(m);
+
+    return 0;
+}
@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <assert.h>
+#include <ufsm.h>
+#include "common.h"
+
+enum events {
+    EV_A = 1,
+    EV_B = 3,
+    EV_C = 2,
+    EV_BIG = 40,
+    EV_BIGGER = 70,
+    EV_NONE = 31,
+};
+
+static struct ufsm_state A;
+static struct ufsm_state B;
+static struct ufsm_state C;
+static struct ufsm_region region1;
+static struct ufsm_transition transition_B;
+static struct ufsm_transition transition_C;
+static struct ufsm_transition transition_A;
+static struct ufsm_transition transition_INIT;
+
+/* A to B on EV_A or EV_B, fits in the trigger mask */
+static struct ufsm_trigger ab_triggers[] =
+{
+    {
+        .name = "EV_A",
+        .trigger = EV_A,
+        .next = &ab_triggers[1],
+    },
+    {
+        .name = "EV_B",
+        .trigger = EV_B,
+        .next = NULL,
+    },
+};
+
+/* B to C on EV_C or EV_BIG, matched on the list */
+static struct ufsm_trigger big_triggers[] =
+{
+    {
+        .name = "EV_C",
+        .trigger = EV_C,
+        .next = &big_triggers[1],
+    },
+    {
+        .name = "EV_BIG",
+        .trigger = EV_BIG,
+        .next = NULL,
+    },
+};
+
+/* C to A on EV_BIGGER, EV_BIG or EV_C, matched on the sorted ids */
+static struct ufsm_trigger c_triggers[] =
+{
+    {
+        .name = "EV_BIGGER",
+        .trigger = EV_BIGGER,
+        .next = &c_triggers[1],
+    },
+    {
+        .name = "EV_BIG",
+        .trigger = EV_BIG,
+        .next = &c_triggers[2],
+    },
+    {
+        .name = "EV_C",
+        .trigger = EV_C,
+        .next = NULL,
+    },
+};
+
+static const uint32_t c_trigger_ids[] =
+{
+    EV_C,
+    EV_BIG,
+    EV_BIGGER,
+};
+
+static struct ufsm_state simple_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_STATE_INIT,
+    .parent_region = &region1,
+    .next = &A,
+};
+
+static struct ufsm_state A =
+{
+    .name = "State A",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &B,
+};
+
+static struct ufsm_state B =
+{
+    .name = "State B",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = &C,
+};
+
+static struct ufsm_state C =
+{
+    .name = "State C",
+    .kind = UFSM_STATE_SIMPLE,
+    .parent_region = &region1,
+    .next = NULL,
+};
+
+static struct ufsm_transition transition_B =
+{
+    .name = "A to B",
+    .trigger = ab_triggers,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &A,
+    .dest = &B,
+    .next = &transition_C,
+};
+
+static struct ufsm_transition transition_C =
+{
+    .name = "B to C",
+    .trigger = big_triggers,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &B,
+    .dest = &C,
+    .next = &transition_A,
+};
+
+static struct ufsm_transition transition_A =
+{
+    .name = "C to A",
+    .trigger = c_triggers,
+    .trigger_ids = c_trigger_ids,
+    .no_of_triggers = 3,
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &C,
+    .dest = &A,
+    .next = &transition_INIT,
+};
+
+static struct ufsm_transition transition_INIT =
+{
+    .name = "Init",
+    .kind = UFSM_TRANSITION_EXTERNAL,
+    .source = &simple_INIT,
+    .dest = &A,
+    .next = NULL,
+};
+
+static struct ufsm_region region1 =
+{
+    .state = &simple_INIT,
+    .transition = &transition_B,
+    .next = NULL,
+};
+
+static struct ufsm_storage storage;
+static struct ufsm_machine m =
+{
+    .name = "Trigger Test Machine",
+    .region = &region1,
+    .storage = &storage,
+};
+
+int main(void)
+{
+    uint32_t err;
+
+    test_init(&m);
+
+    err = ufsm_init_machine(&m);
+    assert (err == UFSM_OK && "Initializing");
+
+    assert (transition_B.trigger_mask == ((1 << EV_A) | (1 << EV_B)));
+    assert (transition_C.trigger_mask == 0);
+    assert (transition_INIT.trigger_mask == 0);
+
+    for (uint32_t n = 0; n < 2; n++)
+    {
+        assert (ufsm_process(&m, EV_NONE) ==
+                                    UFSM_ERROR_EVENT_NOT_PROCESSED);
+        assert (ufsm_process(&m, EV_BIGGER) ==
+                                    UFSM_ERROR_EVENT_NOT_PROCESSED);
+        assert (m.region->current == &A);
+
+        assert (ufsm_process(&m, n ? EV_B : EV_A) == UFSM_OK);
+        assert (m.region->current == &B);
+
+        assert (ufsm_process(&m, EV_BIGGER) ==
+                                    UFSM_ERROR_EVENT_NOT_PROCESSED);
+        assert (m.region->current == &B);
+        assert (ufsm_process(&m, n ? EV_C : EV_BIG) == UFSM_OK);
+        assert (m.region->current == &C);
+
+        assert (ufsm_process(&m, EV_A) ==
+                                    UFSM_ERROR_EVENT_NOT_PROCESSED);
+        assert (ufsm_process(&m, 41) ==
+                                    UFSM_ERROR_EVENT_NOT_PROCESSED);
+        assert (m.region->current == &C);
+        assert (ufsm_process(&m, n ? EV_BIGGER : EV_BIG) == UFSM_OK);
+        assert (m.region->current == &A);
+    }
+
+    return 0;
+}
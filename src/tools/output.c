@@ -15,12 +15,25 @@
 #include <ufsm.h>
 
 #include "output.h"
+#include "symbols.h"
 
 static FILE *fp_c = NULL;
 static FILE *fp_h = NULL;
 
 static uint32_t v = 0;
 static bool flag_strip = false;
+static bool flag_rodata = false;
+static bool flag_pure_guards = false;
+static bool flag_flat = false;
+
+/* Qualifier for the definition objects, "const " for read-only output */
+static const char *rodata = "";
+
+static uint32_t no_of_regions = 0;
+static uint32_t no_of_states = 0;
+static uint32_t no_of_events = 0;
+static uint32_t no_of_transitions = 0;
+static struct ufsm_state **state_table = NULL;
 
 struct event_list
 {
@@ -30,6 +43,22 @@ struct event_list
 };
 
 static struct event_list *evlist;
+static struct event_list *evlist_last;
+static struct symbol_table events_by_name;
+
+/* Time events, one timer per state and after()/at() trigger */
+struct time_event_list
+{
+    struct ufsm_state *state;
+    char *name;
+    unsigned long long ticks;
+    bool absolute;
+    uint32_t index;
+    struct time_event_list *next;
+};
+
+static struct time_event_list *telist;
+static uint32_t no_of_timers = 0;
 
 static struct ufsm_entry_exit *eelist_first;
 static struct ufsm_entry_exit **eelist = &eelist_first;
@@ -40,6 +69,12 @@ static struct ufsm_action **action_list = &action_first;
 static struct ufsm_doact *doact_first;
 static struct ufsm_doact **doact_list = &doact_first;
 
+/* The names already in the lists above, guards are listed by id */
+static struct symbol_table entry_exit_names;
+static struct symbol_table guard_ids;
+static struct symbol_table action_names;
+static struct symbol_table doact_names;
+
 static char * id_to_decl(const char *id)
 {
     char * decl = malloc (strlen(id)+1);
@@ -61,42 +96,489 @@ static char * id_to_decl(const char *id)
     return decl;
 }
 
+/* Read-only definitions are emitted as const objects. The pointers in the
+ * uFSM structs are not const qualified so references are cast.
+ */
+static char * ref(const char *type, const char *id)
+{
+    char *decl = id_to_decl(id);
+    char *result = malloc(strlen(type) + strlen(decl) + 16);
+
+    if (flag_rodata)
+        sprintf(result, "(struct %s *) &%s", type, decl);
+    else
+        sprintf(result, "&%s", decl);
+
+    free(decl);
+
+    return result;
+}
+
+/* Events are numbered in the order they are first seen */
 static uint32_t ev_name_to_index(const char *name)
 {
-    struct event_list *last_entry = evlist;
+    struct event_list *e = symbol_get(&events_by_name, name);
+
+    if (e)
+        return e->index;
+
+    e = malloc(sizeof(struct event_list));
+    bzero(e, sizeof(struct event_list));
+    e->name = malloc(strlen(name)+1);
+    strcpy(e->name, name);
+    e->index = evlist_last ? (evlist_last->index + 1) : 0;
+
+    if (evlist_last)
+        evlist_last->next = e;
+    else
+        evlist = e;
+
+    evlist_last = e;
+    symbol_add(&events_by_name, e->name, e);
+
+    return e->index;
+}
+
+static void ufsm_gen_regions(struct ufsm_region *region);
+
+static bool transition_has_trigger(struct ufsm_transition *t, uint32_t ev)
+{
+    for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next)
+    {
+        if (ev_name_to_index(tt->name) == ev)
+            return true;
+    }
+
+    return false;
+}
+
+static int ev_compare(const void *a, const void *b)
+{
+    uint32_t ev_a = *(const uint32_t *) a;
+    uint32_t ev_b = *(const uint32_t *) b;
 
-    if (evlist == NULL)
+    return (ev_a > ev_b) - (ev_a < ev_b);
+}
+
+/* Collects the distinct trigger ids of 't', sorted ascending. The caller
+ * frees the returned array.
+ */
+static uint32_t * ufsm_gen_trigger_ids(struct ufsm_transition *t,
+                                       uint32_t *no_of_ids)
+{
+    uint32_t *ids = NULL;
+    uint32_t n = 0;
+
+    for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next)
     {
-        evlist = malloc(sizeof(struct event_list));
-        bzero(evlist, sizeof(struct event_list));
-        evlist->name = malloc(strlen(name)+1);
-        strcpy(evlist->name, name);
-        evlist->index = 0;
-        evlist->next = NULL;
+        uint32_t ev = ev_name_to_index(tt->name);
+        bool found_duplicate = false;
+
+        for (uint32_t i = 0; i < n; i++)
+        {
+            if (ids[i] == ev)
+            {
+                found_duplicate = true;
+                break;
+            }
+        }
+
+        if (!found_duplicate)
+        {
+            ids = realloc(ids, sizeof(uint32_t) * (n + 1));
+            ids[n++] = ev;
+        }
+    }
+
+    qsort(ids, n, sizeof(uint32_t), ev_compare);
+    *no_of_ids = n;
+
+    return ids;
+}
+
+/* Emits the trigger list of 't' and either returns its trigger mask or,
+ * when an id doesn't fit in the mask, emits the sorted id array and
+ * returns zero. 'no_of_ids' is set to the number of distinct triggers.
+ */
+static uint32_t ufsm_gen_triggers(struct ufsm_transition *t,
+                                  uint32_t *no_of_ids)
+{
+    uint32_t n = 0;
+    uint32_t mask = 0;
+    uint32_t *ids = NULL;
+    uint32_t i = 0;
+
+    *no_of_ids = 0;
+
+    if (!t->trigger)
         return 0;
+
+    fprintf(fp_c, "static %sstruct ufsm_trigger %s_triggers[] = {\n",
+                rodata, id_to_decl(t->id));
+
+    for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next, i++)
+    {
+        fprintf(fp_c, "{\n");
+        fprintf(fp_c, "  .trigger = %i,\n", ev_name_to_index(tt->name));
+        fprintf(fp_c, "  .name = \"%s\",\n", tt->name);
+
+        if (tt->next)
+            fprintf(fp_c, "  .next = %s&%s_triggers[%u],\n",
+                            flag_rodata ? "(struct ufsm_trigger *) " : "",
+                            id_to_decl(t->id), i + 1);
+        else
+            fprintf(fp_c, "  .next = NULL,\n");
+
+        fprintf(fp_c, "},\n");
     }
 
-    for (struct event_list *e = evlist; e; e = e->next) {
-        if (strcmp(name, e->name) == 0) {
-            return e->index;
+    fprintf(fp_c, "};\n");
+
+    ids = ufsm_gen_trigger_ids(t, &n);
+
+    for (i = 0; i < n; i++)
+    {
+        if (ids[i] >= UFSM_TRIGGER_MASK_BITS)
+        {
+            mask = 0;
+            break;
         }
-        last_entry = e;
+
+        mask |= (1UL << ids[i]);
     }
 
-    last_entry->next = malloc(sizeof(struct event_list));
-    bzero(last_entry->next, sizeof(struct event_list));
-    struct event_list *e = last_entry->next;
-    e->name = malloc(strlen(name)+1);
-    strcpy(e->name, name);
-    e->index = last_entry->index+1;
-    return e->index;
+    if (!mask)
+    {
+        fprintf(fp_c, "static const uint32_t %s_trigger_ids[] = {\n",
+                    id_to_decl(t->id));
+
+        for (i = 0; i < n; i++)
+            fprintf(fp_c, "  %u,\n", ids[i]);
+
+        fprintf(fp_c, "};\n");
+    }
+
+    free(ids);
+    *no_of_ids = n;
+
+    return mask;
 }
 
-static void ufsm_gen_regions(struct ufsm_region *region);
+/* Parent of 'state' across region and submachine boundaries, the regions
+ * are linked to their parent states by ufsm_index_regions.
+ */
+static struct ufsm_state * parent_state_of(struct ufsm_state *state)
+{
+    return state->parent_region->parent_state;
+}
+
+/* Emits the per-state dispatch index, a table sorted on event id that maps
+ * each event to the transitions from 'state' it can trigger. Returns the
+ * number of entries in the table.
+ *
+ * With 'flat' set the table is emitted as '<state>_flat_dispatch' and also
+ * lists the transitions inherited from the ancestors of 'state', innermost
+ * first, which is the order the runtime would try them in.
+ */
+static uint32_t ufsm_gen_dispatch(struct ufsm_state *state, bool flat)
+{
+    uint32_t no_of_evs = 0;
+    uint32_t *evs = NULL;
+    const char *name = flat ? "flat_dispatch" : "dispatch";
+
+    for (struct ufsm_state *s = state; s; s = flat ? parent_state_of(s) : NULL)
+    {
+        for (struct ufsm_transition *t = s->parent_region->transition;
+                                                        t; t = t->next)
+        {
+            if (t->source != s)
+                continue;
+
+            for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next)
+            {
+                uint32_t ev = ev_name_to_index(tt->name);
+                bool found_duplicate = false;
+
+                for (uint32_t i = 0; i < no_of_evs; i++)
+                {
+                    if (evs[i] == ev)
+                    {
+                        found_duplicate = true;
+                        break;
+                    }
+                }
+
+                if (!found_duplicate)
+                {
+                    evs = realloc(evs, sizeof(uint32_t) * (no_of_evs + 1));
+                    evs[no_of_evs++] = ev;
+                }
+            }
+        }
+    }
+
+    qsort(evs, no_of_evs, sizeof(uint32_t), ev_compare);
+
+    for (uint32_t i = 0; i < no_of_evs; i++)
+    {
+        fprintf(fp_c, "static struct ufsm_transition * %s%s_%s_%u[] = {\n",
+                        rodata, id_to_decl(state->id), name, evs[i]);
+
+        for (struct ufsm_state *s = state; s;
+                                s = flat ? parent_state_of(s) : NULL)
+        {
+            for (struct ufsm_transition *t = s->parent_region->transition;
+                                                            t; t = t->next)
+            {
+                if (t->source == s && transition_has_trigger(t, evs[i]))
+                    fprintf(fp_c, "  %s,\n", ref("ufsm_transition", t->id));
+            }
+        }
+
+        fprintf(fp_c, "  NULL,\n");
+        fprintf(fp_c, "};\n");
+    }
+
+    fprintf(fp_c, "static %sstruct ufsm_dispatch %s_%s[] = {\n",
+                    rodata, id_to_decl(state->id), name);
+
+    for (uint32_t i = 0; i < no_of_evs; i++)
+    {
+        fprintf(fp_c, "{\n");
+        fprintf(fp_c, "  .ev = %u,\n", evs[i]);
+        fprintf(fp_c, "  .transition = %s%s_%s_%u,\n",
+                        flag_rodata ? "(struct ufsm_transition **) " : "",
+                        id_to_decl(state->id), name, evs[i]);
+        fprintf(fp_c, "},\n");
+    }
+
+    fprintf(fp_c, " {\n");
+    fprintf(fp_c, "  .ev = -1,\n");
+    fprintf(fp_c, "  .transition = NULL,\n");
+    fprintf(fp_c, "},\n");
+    fprintf(fp_c, "};\n");
+
+    free(evs);
+
+    return no_of_evs;
+}
+
+static struct ufsm_region *least_common_ancestor(struct ufsm_region *r1,
+                                                 struct ufsm_region *r2)
+{
+    for (struct ufsm_region *a = r1; a;
+            a = a->parent_state ? a->parent_state->parent_region : NULL) {
+        for (struct ufsm_region *b = r2; b;
+                b = b->parent_state ? b->parent_state->parent_region : NULL) {
+            if (a == b)
+                return a;
+        }
+    }
+
+    return NULL;
+}
+
+/* Emits the exit and entry paths of a transition between regions, the same
+ * walks ufsm_leave_parent_states and ufsm_enter_parent_states would make at
+ * runtime. Returns the least common ancestor or NULL when the paths are left
+ * to the runtime.
+ */
+static struct ufsm_region *ufsm_gen_paths(struct ufsm_transition *t)
+{
+    struct ufsm_region *src = t->source->parent_region;
+    struct ufsm_region *dest = t->dest->parent_region;
+    struct ufsm_region *lca = NULL;
+    struct ufsm_region **enter = NULL;
+    uint32_t no_of_enter = 0;
+
+    if (src == dest || t->dest->kind == UFSM_STATE_JOIN)
+        return NULL;
+
+    lca = least_common_ancestor(src, dest);
+
+    if (lca == NULL)
+        return NULL;
+
+    fprintf(fp_c, "static struct ufsm_region * %s%s_exit_path[] = {\n",
+                    rodata, id_to_decl(t->id));
+
+    for (struct ufsm_region *r = src; r != lca;
+                                r = r->parent_state->parent_region)
+        fprintf(fp_c, "  %s,\n", ref("ufsm_region", r->id));
+
+    fprintf(fp_c, "  NULL,\n");
+    fprintf(fp_c, "};\n");
+
+    enter = malloc(sizeof(struct ufsm_region *));
+    enter[no_of_enter++] = dest;
+
+    for (struct ufsm_region *r = dest; r != lca && r->parent_state;) {
+        r = r->parent_state->parent_region;
+
+        if (r == lca || r == NULL)
+            break;
+
+        enter = realloc(enter, sizeof(struct ufsm_region *) *
+                                                (no_of_enter + 1));
+        enter[no_of_enter++] = r;
+    }
+
+    fprintf(fp_c, "static struct ufsm_region * %s%s_enter_path[] = {\n",
+                    rodata, id_to_decl(t->id));
+
+    while (no_of_enter--)
+        fprintf(fp_c, "  %s,\n", ref("ufsm_region", enter[no_of_enter]->id));
+
+    fprintf(fp_c, "  NULL,\n");
+    fprintf(fp_c, "};\n");
+
+    free(enter);
+
+    return lca;
+}
+
+/* The first transition from 'state' without a trigger, taken when the
+ * state completes.
+ */
+static struct ufsm_transition * ufsm_gen_completion(struct ufsm_state *state)
+{
+    for (struct ufsm_transition *t = state->parent_region->transition;
+                                                        t; t = t->next)
+    {
+        if (t->source == state && !t->trigger)
+            return t;
+    }
+
+    return NULL;
+}
+
+/* Emits the event-of-interest bitmap of 'state', one bit per event id
+ * that triggers or is deferred by a transition from the state or one of
+ * its ancestors. Returns false, and emits nothing, when the bitmap is empty.
+ */
+static bool ufsm_gen_interest(struct ufsm_state *state)
+{
+    uint32_t no_of_words = (no_of_events + 31) / 32;
+    uint32_t *words = calloc(no_of_words + 1, sizeof(uint32_t));
+    bool empty = true;
+
+    for (struct ufsm_state *s = state; s; s = parent_state_of(s))
+    {
+        for (struct ufsm_transition *t = s->parent_region->transition;
+                                                        t; t = t->next)
+        {
+            if (t->source != s)
+                continue;
+
+            for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next)
+            {
+                uint32_t ev = ev_name_to_index(tt->name);
+
+                words[ev / 32] |= 1u << (ev % 32);
+                empty = false;
+            }
+        }
+    }
+
+    if (!empty)
+    {
+        fprintf(fp_c, "static const uint32_t %s_interest[] = {\n",
+                        id_to_decl(state->id));
+
+        for (uint32_t i = 0; i < no_of_words; i++)
+            fprintf(fp_c, "  0x%08x,\n", words[i]);
+
+        fprintf(fp_c, "};\n");
+    }
+
+    free(words);
+
+    return !empty;
+}
+
+/* Deferring transitions are modelled with a 'ufsm_defer' action */
+static bool is_defer(struct ufsm_transition *t)
+{
+    return t->action && (strcmp(t->action->name, "ufsm_defer") == 0);
+}
+
+/* The events below UFSM_TRIGGER_MASK_BITS that a transition from 'state'
+ * defers.
+ */
+static uint32_t ufsm_gen_defer_mask(struct ufsm_state *state)
+{
+    uint32_t mask = 0;
+
+    for (struct ufsm_transition *t = state->parent_region->transition;
+                                                        t; t = t->next)
+    {
+        if (t->source != state || !is_defer(t))
+            continue;
+
+        for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next)
+        {
+            uint32_t ev = ev_name_to_index(tt->name);
+
+            if (ev < UFSM_TRIGGER_MASK_BITS)
+                mask |= 1u << ev;
+        }
+    }
+
+    return mask;
+}
+
+/* Emits the time events of 'state' as a chained array. Returns false, and
+ * emits nothing, when the state has none.
+ */
+static bool ufsm_gen_time_events(struct ufsm_state *state)
+{
+    char *decl = id_to_decl(state->id);
+    uint32_t n = 0;
+
+    for (struct time_event_list *te = telist; te; te = te->next) {
+        if (te->state != state)
+            continue;
+
+        if (n == 0)
+            fprintf(fp_c, "static %sstruct ufsm_time_event "
+                          "%s_time_events[] = {\n", rodata, decl);
+
+        if (n > 0)
+            fprintf(fp_c, "    .next = %s&%s_time_events[%u],\n  },\n",
+                        flag_rodata ? "(struct ufsm_time_event *) " : "",
+                        decl, n);
+
+        fprintf(fp_c, "  {\n");
+        fprintf(fp_c, "    .index = %u,\n", te->index);
+        fprintf(fp_c, "    .ticks = %lluULL,\n", te->ticks);
+        fprintf(fp_c, "    .absolute = %s,\n",
+                                    te->absolute ? "true" : "false");
+        fprintf(fp_c, "    .ev = %u,\n", ev_name_to_index(te->name));
+        n++;
+    }
+
+    if (n > 0)
+        fprintf(fp_c, "    .next = NULL,\n  },\n};\n");
+
+    free(decl);
+
+    return n > 0;
+}
 
 static void ufsm_gen_states(struct ufsm_state *state)
 {
-    fprintf(fp_c,"static struct ufsm_state %s = {\n",id_to_decl(state->id));
+    uint32_t no_of_dispatch = ufsm_gen_dispatch(state, false);
+    uint32_t no_of_flat_dispatch = 0;
+    struct ufsm_transition *completion = ufsm_gen_completion(state);
+    bool has_interest = ufsm_gen_interest(state);
+    bool has_time_events = ufsm_gen_time_events(state);
+    uint32_t defer_mask = ufsm_gen_defer_mask(state);
+
+    if (flag_flat)
+        no_of_flat_dispatch = ufsm_gen_dispatch(state, true);
+
+    fprintf(fp_c,"static %sstruct ufsm_state %s = {\n",rodata,
+                                                id_to_decl(state->id));
 
     if (flag_strip) {
          fprintf (fp_c,"  .id     = \"\", \n");
@@ -106,38 +588,74 @@ static void ufsm_gen_states(struct ufsm_state *state)
         fprintf(fp_c,"  .name = \"%s\",\n",state->name);
     }
     fprintf(fp_c,"  .kind = %i,\n",state->kind);
-    fprintf(fp_c,"  .parent_region = &%s,\n",
-                            id_to_decl(state->parent_region->id));
+    fprintf(fp_c,"  .index = %u,\n",state->index);
+    fprintf(fp_c,"  .parent_region = %s,\n",
+                            ref("ufsm_region", state->parent_region->id));
     if (state->entry)
-        fprintf(fp_c,"  .entry = &%s,\n",id_to_decl(state->entry->id));
+        fprintf(fp_c,"  .entry = %s,\n",ref("ufsm_entry_exit", state->entry->id));
     else
         fprintf(fp_c,"  .entry = NULL,\n");
 
 
     if (state->doact)
-        fprintf(fp_c,"  .doact = &%s,\n",id_to_decl(state->doact->id));
+        fprintf(fp_c,"  .doact = %s,\n",ref("ufsm_doact", state->doact->id));
     else
         fprintf(fp_c,"  .doact = NULL,\n");
 
 
     if (state->exit)
-        fprintf(fp_c,"  .exit = &%s,\n",id_to_decl(state->exit->id));
+        fprintf(fp_c,"  .exit = %s,\n",ref("ufsm_entry_exit", state->exit->id));
     else
         fprintf(fp_c,"  .exit = NULL,\n");
 
     if (state->region) {
-        fprintf(fp_c,"  .region = &%s,\n",id_to_decl(state->region->id));
+        fprintf(fp_c,"  .region = %s,\n",ref("ufsm_region", state->region->id));
     } else if (state->submachine) {
         state->submachine->region->parent_state = state;
-        fprintf(fp_c,"  .region = &%s,\n",id_to_decl(state->submachine->region->id));
+        fprintf(fp_c,"  .region = %s,\n",
+                            ref("ufsm_region", state->submachine->region->id));
     } else {
         fprintf(fp_c,"  .region = NULL,\n");
     }
 
     fprintf(fp_c,"  .submachine = NULL,\n");
+    fprintf(fp_c,"  .dispatch = %s%s_dispatch,\n",
+                        flag_rodata ? "(struct ufsm_dispatch *) " : "",
+                        id_to_decl(state->id));
+    fprintf(fp_c,"  .no_of_dispatch = %u,\n",no_of_dispatch);
+
+    if (flag_flat) {
+        fprintf(fp_c,"  .flat_dispatch = %s%s_flat_dispatch,\n",
+                            flag_rodata ? "(struct ufsm_dispatch *) " : "",
+                            id_to_decl(state->id));
+        fprintf(fp_c,"  .no_of_flat_dispatch = %u,\n",no_of_flat_dispatch);
+    } else {
+        fprintf(fp_c,"  .flat_dispatch = NULL,\n");
+    }
+
+    if (has_interest)
+        fprintf(fp_c,"  .interest = %s_interest,\n", id_to_decl(state->id));
+    else
+        fprintf(fp_c,"  .interest = NULL,\n");
+
+    if (defer_mask)
+        fprintf(fp_c,"  .defer_mask = 0x%08xUL,\n", defer_mask);
+
+    if (has_time_events)
+        fprintf(fp_c,"  .time_events = %s%s_time_events,\n",
+                            flag_rodata ? "(struct ufsm_time_event *) " : "",
+                            id_to_decl(state->id));
+    else
+        fprintf(fp_c,"  .time_events = NULL,\n");
+
+    if (completion)
+        fprintf(fp_c,"  .completion = %s,\n",
+                                ref("ufsm_transition", completion->id));
+    else
+        fprintf(fp_c,"  .completion = NULL,\n");
 
     if (state->next)
-        fprintf(fp_c,"  .next = &%s,\n",id_to_decl(state->next->id));
+        fprintf(fp_c,"  .next = %s,\n",ref("ufsm_state", state->next->id));
     else
         fprintf(fp_c,"  .next = NULL,\n");
 
@@ -146,8 +664,8 @@ static void ufsm_gen_states(struct ufsm_state *state)
         ufsm_gen_regions(state->region);
 
     for (struct ufsm_entry_exit *e = state->entry; e; e = e->next) {
-        fprintf(fp_c, "static struct ufsm_entry_exit %s = {\n",
-                        id_to_decl(e->id));
+        fprintf(fp_c, "static %sstruct ufsm_entry_exit %s = {\n",
+                        rodata, id_to_decl(e->id));
         if (flag_strip) {
              fprintf (fp_c,"  .id     = \"\", \n");
              fprintf (fp_c,"  .name   = \"\", \n");
@@ -157,25 +675,15 @@ static void ufsm_gen_states(struct ufsm_state *state)
         }
         fprintf(fp_c, "  .f = &%s,\n", e->name);
         if (e->next)
-            fprintf (fp_c, "  .next = &%s,\n", id_to_decl(e->next->id));
+            fprintf (fp_c, "  .next = %s,\n", ref("ufsm_entry_exit", e->next->id));
         else
             fprintf (fp_c, "  .next = NULL,\n");
 
         fprintf(fp_c, "};\n");
 
-        bool found_duplicate = false;
-
-        for (struct ufsm_entry_exit *ee = eelist_first; ee; ee = ee->next)
-        {
-            if (strcmp(ee->name,e->name) == 0)
-            {
-                found_duplicate = true;
-                break;
-            }
-        }
-
-        if (!found_duplicate)
+        if (!symbol_get(&entry_exit_names, e->name))
         {
+            symbol_add(&entry_exit_names, e->name, e);
             (*eelist) = malloc(sizeof(struct ufsm_entry_exit));
             memcpy ((*eelist), e, sizeof(struct ufsm_entry_exit));
             eelist = &(*eelist)->next;
@@ -186,8 +694,8 @@ static void ufsm_gen_states(struct ufsm_state *state)
 
 
     for (struct ufsm_doact *d = state->doact; d; d = d->next) {
-        fprintf(fp_c, "static struct ufsm_doact %s = {\n",
-                        id_to_decl(d->id));
+        fprintf(fp_c, "static %sstruct ufsm_doact %s = {\n",
+                        rodata, id_to_decl(d->id));
         if (flag_strip) {
              fprintf (fp_c,"  .id     = \"\", \n");
              fprintf (fp_c,"  .name   = \"\", \n");
@@ -201,26 +709,16 @@ static void ufsm_gen_states(struct ufsm_state *state)
 
 
         if (d->next)
-            fprintf (fp_c, "  .next = &%s,\n", id_to_decl(d->next->id));
+            fprintf (fp_c, "  .next = %s,\n", ref("ufsm_doact", d->next->id));
         else
             fprintf (fp_c, "  .next = NULL,\n");
 
 
         fprintf(fp_c, "};\n");
 
-        bool found_duplicate = false;
-
-        for (struct ufsm_doact *da = doact_first; da; da = da->next)
-        {
-            if (strcmp(da->name,d->name) == 0)
-            {
-                found_duplicate = true;
-                break;
-            }
-        }
-
-        if (!found_duplicate)
+        if (!symbol_get(&doact_names, d->name))
         {
+            symbol_add(&doact_names, d->name, d);
             (*doact_list) = malloc(sizeof(struct ufsm_doact));
             memcpy ((*doact_list), d, sizeof(struct ufsm_doact));
             doact_list = &(*doact_list)->next;
@@ -229,8 +727,8 @@ static void ufsm_gen_states(struct ufsm_state *state)
     }
 
     for (struct ufsm_entry_exit *e = state->exit; e; e = e->next) {
-        fprintf(fp_c, "static struct ufsm_entry_exit %s = {\n",
-                        id_to_decl(e->id));
+        fprintf(fp_c, "static %sstruct ufsm_entry_exit %s = {\n",
+                        rodata, id_to_decl(e->id));
         if (flag_strip) {
              fprintf (fp_c,"  .id     = \"\", \n");
              fprintf (fp_c,"  .name   = \"\", \n");
@@ -241,26 +739,16 @@ static void ufsm_gen_states(struct ufsm_state *state)
 
         fprintf(fp_c, "  .f = &%s,\n", e->name);
         if (e->next)
-            fprintf (fp_c, "  .next = &%s,\n", id_to_decl(e->next->id));
+            fprintf (fp_c, "  .next = %s,\n", ref("ufsm_entry_exit", e->next->id));
         else
             fprintf (fp_c, "  .next = NULL,\n");
 
 
         fprintf(fp_c, "};\n");
 
-        bool found_duplicate = false;
-
-        for (struct ufsm_entry_exit *ee = eelist_first; ee; ee = ee->next)
-        {
-            if (strcmp(ee->name,e->name) == 0)
-            {
-                found_duplicate = true;
-                break;
-            }
-        }
-
-        if (!found_duplicate)
+        if (!symbol_get(&entry_exit_names, e->name))
         {
+            symbol_add(&entry_exit_names, e->name, e);
             (*eelist) = malloc(sizeof(struct ufsm_entry_exit));
             memcpy ((*eelist), e, sizeof(struct ufsm_entry_exit));
             eelist = &(*eelist)->next;
@@ -271,7 +759,8 @@ static void ufsm_gen_states(struct ufsm_state *state)
 static void ufsm_gen_regions(struct ufsm_region *region)
 {
     for (struct ufsm_region *r = region; r; r = r->next) {
-        fprintf (fp_c,"static struct ufsm_region %s = {\n",id_to_decl(r->id));
+        fprintf (fp_c,"static %sstruct ufsm_region %s = {\n",rodata,
+                                                    id_to_decl(r->id));
         if (flag_strip) {
              fprintf (fp_c,"  .id     = \"\", \n");
              fprintf (fp_c,"  .name   = \"\", \n");
@@ -280,53 +769,39 @@ static void ufsm_gen_regions(struct ufsm_region *region)
             fprintf (fp_c,"  .name = \"%s\",\n", r->name);
         }
         if (r->state)
-            fprintf (fp_c,"  .state = &%s,\n", id_to_decl(r->state->id));
+            fprintf (fp_c,"  .state = %s,\n", ref("ufsm_state", r->state->id));
         else
             fprintf (fp_c,"  .state = NULL,\n");
 
         fprintf (fp_c,"  .has_history = %s,\n", r->has_history ? "true" : "false");
         fprintf (fp_c,"  .history = NULL,\n");
+        fprintf (fp_c,"  .index = %u,\n", r->index);
         if (r->transition)
-            fprintf (fp_c,"  .transition = &%s,\n",
-                                            id_to_decl(r->transition->id));
+            fprintf (fp_c,"  .transition = %s,\n",
+                                    ref("ufsm_transition", r->transition->id));
         else
             fprintf (fp_c,"  .transition = NULL,\n");
 
         if (r->parent_state)
-            fprintf (fp_c,"  .parent_state = &%s,\n",
-                                id_to_decl(r->parent_state->id));
+            fprintf (fp_c,"  .parent_state = %s,\n",
+                                ref("ufsm_state", r->parent_state->id));
         else
             fprintf (fp_c,"  .parent_state = NULL,\n");
         if (r->next)
-            fprintf (fp_c,"  .next = &%s,\n",id_to_decl(r->next->id));
+            fprintf (fp_c,"  .next = %s,\n",ref("ufsm_region", r->next->id));
         else
             fprintf (fp_c,"  .next = NULL,\n");
         fprintf (fp_c,"};\n");
 
         for (struct ufsm_transition *t = r->transition; t; t = t->next) {
 
-            if (t->trigger)
-            {
-                fprintf(fp_c, "static struct ufsm_trigger %s_triggers[] = {\n",
-                            id_to_decl(t->id));
+            uint32_t no_of_triggers = 0;
+            uint32_t trigger_mask = ufsm_gen_triggers(t, &no_of_triggers);
 
-                for (struct ufsm_trigger *tt = t->trigger;tt;tt=tt->next)
-                {
-                    fprintf(fp_c, "{\n");
-                    fprintf(fp_c, "  .trigger = %i,\n",
-                                ev_name_to_index(tt->name));
-                    fprintf(fp_c, "  .name = \"%s\",\n", tt->name);
-                    fprintf(fp_c, "},\n");
-                }
-                    fprintf(fp_c, " {\n");
-                    fprintf(fp_c, "  .trigger = -1,\n");
-                    fprintf(fp_c, "  .name = NULL,\n");
-                    fprintf(fp_c, "},\n");
-                fprintf(fp_c,"};\n");
-            }
+            struct ufsm_region *lca = ufsm_gen_paths(t);
 
-            fprintf(fp_c, "static struct ufsm_transition %s = {\n",
-                               id_to_decl(t->id));
+            fprintf(fp_c, "static %sstruct ufsm_transition %s = {\n",
+                               rodata, id_to_decl(t->id));
             if (flag_strip) {
                  fprintf (fp_c,"  .id     = \"\", \n");
                  fprintf (fp_c,"  .name   = \"\", \n");
@@ -337,7 +812,8 @@ static void ufsm_gen_regions(struct ufsm_region *region)
 
             if (t->trigger != NULL)
             {
-                fprintf(fp_c, "  .trigger = %s_triggers,\n",
+                fprintf(fp_c, "  .trigger = %s%s_triggers,\n",
+                                flag_rodata ? "(struct ufsm_trigger *) " : "",
                                 id_to_decl(t->id));
             }
             else
@@ -345,31 +821,34 @@ static void ufsm_gen_regions(struct ufsm_region *region)
                 fprintf(fp_c, "  .trigger = NULL,\n");
             }
 
+            if (trigger_mask)
+            {
+                fprintf(fp_c, "  .trigger_mask = 0x%08xUL,\n", trigger_mask);
+            }
+            else if (t->trigger != NULL)
+            {
+                fprintf(fp_c, "  .trigger_ids = %s_trigger_ids,\n",
+                                id_to_decl(t->id));
+                fprintf(fp_c, "  .no_of_triggers = %u,\n", no_of_triggers);
+            }
+
             fprintf(fp_c, "  .kind = %i,\n",t->kind);
+            fprintf(fp_c, "  .index = %u,\n", t->index);
             if (t->action) {
-                if (strcmp(t->action->name, "ufsm_defer") == 0)
+                if (is_defer(t))
                 {
                     fprintf(fp_c, "  .action = NULL,\n");
                     fprintf(fp_c, "  .defer = true,\n");
                 }
                 else
                 {
-                    fprintf(fp_c, "  .action = &%s,\n", id_to_decl(t->action->id));
+                    fprintf(fp_c, "  .action = %s,\n",
+                                    ref("ufsm_action", t->action->id));
                     fprintf(fp_c, "  .defer = false,\n");
 
-                    bool found_duplicate = false;
-
-                    for (struct ufsm_action *aa = action_first; aa; aa = aa->next)
-                    {
-                        if (strcmp(aa->name,t->action->name) == 0)
-                        {
-                            found_duplicate = true;
-                            break;
-                        }
-                    }
-
-                    if (!found_duplicate)
+                    if (!symbol_get(&action_names, t->action->name))
                     {
+                        symbol_add(&action_names, t->action->name, t->action);
                         (*action_list) = malloc(sizeof(struct ufsm_action));
                         memcpy ((*action_list), t->action, sizeof(struct ufsm_action));
                         action_list = &(*action_list)->next;
@@ -382,21 +861,11 @@ static void ufsm_gen_regions(struct ufsm_region *region)
             }
             if (t->guard)
             {
-                fprintf(fp_c, "  .guard = &%s,\n", id_to_decl(t->guard->id));
-
-                bool found_duplicate = false;
-
-                for (struct ufsm_guard *gg = guard_first; gg; gg = gg->next)
-                {
-                    if (strcmp(gg->id,t->guard->id) == 0)
-                    {
-                        found_duplicate = true;
-                        break;
-                    }
-                }
+                fprintf(fp_c, "  .guard = %s,\n", ref("ufsm_guard", t->guard->id));
 
-                if (!found_duplicate)
+                if (!symbol_get(&guard_ids, t->guard->id))
                 {
+                    symbol_add(&guard_ids, t->guard->id, t->guard);
                     (*guard_list) = malloc(sizeof(struct ufsm_guard));
                     memcpy ((*guard_list), t->guard, sizeof(struct ufsm_guard));
                     guard_list = &(*guard_list)->next;
@@ -407,18 +876,31 @@ static void ufsm_gen_regions(struct ufsm_region *region)
                 fprintf(fp_c, "  .guard = NULL,\n");
             }
 
-            fprintf(fp_c, "  .source = &%s,\n",id_to_decl(t->source->id));
-            fprintf(fp_c, "  .dest = &%s,\n",id_to_decl(t->dest->id));
+            fprintf(fp_c, "  .source = %s,\n",ref("ufsm_state", t->source->id));
+            fprintf(fp_c, "  .dest = %s,\n",ref("ufsm_state", t->dest->id));
+            if (lca) {
+                fprintf(fp_c, "  .lca = %s,\n", ref("ufsm_region", lca->id));
+                fprintf(fp_c, "  .exit_path = %s%s_exit_path,\n",
+                                flag_rodata ? "(struct ufsm_region **) " : "",
+                                id_to_decl(t->id));
+                fprintf(fp_c, "  .enter_path = %s%s_enter_path,\n",
+                                flag_rodata ? "(struct ufsm_region **) " : "",
+                                id_to_decl(t->id));
+            } else {
+                fprintf(fp_c, "  .lca = NULL,\n");
+                fprintf(fp_c, "  .exit_path = NULL,\n");
+                fprintf(fp_c, "  .enter_path = NULL,\n");
+            }
             if (t->next)
-                fprintf(fp_c, "  .next = &%s,\n",id_to_decl(t->next->id));
+                fprintf(fp_c, "  .next = %s,\n",ref("ufsm_transition", t->next->id));
             else
                fprintf(fp_c, "  .next = NULL,\n");
             fprintf(fp_c, "};\n");
             for (struct ufsm_action *a = t->action; a; a = a->next) {
                 if (strcmp(a->name, "ufsm_defer") == 0)
                     continue;
-                fprintf(fp_c, "static struct ufsm_action %s = {\n",
-                            id_to_decl(a->id));
+                fprintf(fp_c, "static %sstruct ufsm_action %s = {\n",
+                            rodata, id_to_decl(a->id));
                 if (flag_strip) {
                      fprintf (fp_c,"  .id     = \"\", \n");
                      fprintf (fp_c,"  .name   = \"\", \n");
@@ -428,19 +910,21 @@ static void ufsm_gen_regions(struct ufsm_region *region)
                 }
                 fprintf(fp_c, "  .f = &%s,\n", a->name);
                 if (a->next)
-                    fprintf(fp_c, "  .next = &%s,\n", id_to_decl(a->next->id));
+                    fprintf(fp_c, "  .next = %s,\n", ref("ufsm_action", a->next->id));
                 else
                     fprintf(fp_c, "  .next = NULL,\n");
                 fprintf(fp_c, "};\n");
             }
             for (struct ufsm_guard *g = t->guard; g; g = g->next) {
-                fprintf(fp_c, "static struct ufsm_guard %s = {\n",
-                            id_to_decl(g->id));
+                fprintf(fp_c, "static %sstruct ufsm_guard %s = {\n",
+                            rodata, id_to_decl(g->id));
                 fprintf(fp_c, "  .id = \"%s\",\n", g->id);
                 fprintf(fp_c, "  .name = \"%s\",\n", g->name);
                 fprintf(fp_c, "  .f = &%s,\n", g->name);
+                fprintf(fp_c, "  .pure = %s,\n",
+                                flag_pure_guards ? "true" : "false");
                 if (g->next)
-                    fprintf(fp_c, "  .next = &%s,\n", id_to_decl(g->next->id));
+                    fprintf(fp_c, "  .next = %s,\n", ref("ufsm_guard", g->next->id));
                 else
                     fprintf(fp_c, "  .next = NULL,\n");
 
@@ -452,9 +936,160 @@ static void ufsm_gen_regions(struct ufsm_region *region)
     }
 }
 
+/* Structural bounds of a machine, submachines included */
+struct machine_bounds
+{
+    uint32_t depth;
+    uint32_t active_regions;
+    uint32_t completions;
+    uint32_t regions;
+    uint32_t untriggered;
+    uint32_t defers;
+};
+
+/* Walks 'regions' and the regions nested below them. Returns the bounds of
+ * the subtree, 'regions' and 'untriggered' count every region and every
+ * transition that can be pushed while a step is in progress, 'defers' the
+ * deferring transitions.
+ */
+static struct machine_bounds ufsm_bound_regions(struct ufsm_region *regions)
+{
+    struct machine_bounds b = {0};
+
+    for (struct ufsm_region *r = regions; r; r = r->next) {
+        uint32_t active_regions = 0;
+        uint32_t completions = 0;
+
+        b.regions++;
+
+        for (struct ufsm_transition *t = r->transition; t; t = t->next) {
+            if (!t->trigger || (t->source->kind != UFSM_STATE_SIMPLE))
+                b.untriggered++;
+            if (is_defer(t))
+                b.defers++;
+        }
+
+        for (struct ufsm_state *s = r->state; s; s = s->next) {
+            struct ufsm_region *sr = s->region;
+            struct machine_bounds sb = {0};
+
+            if (!sr && s->submachine)
+                sr = s->submachine->region;
+
+            if (sr)
+                sb = ufsm_bound_regions(sr);
+
+            if ((s->kind == UFSM_STATE_SIMPLE) && ufsm_gen_completion(s))
+                sb.completions++;
+
+            if (sb.active_regions > active_regions)
+                active_regions = sb.active_regions;
+            if (sb.completions > completions)
+                completions = sb.completions;
+            if (sb.depth > b.depth)
+                b.depth = sb.depth;
+
+            b.regions += sb.regions;
+            b.untriggered += sb.untriggered;
+            b.defers += sb.defers;
+        }
+
+        b.active_regions += 1 + active_regions;
+        b.completions += completions;
+    }
+
+    b.depth++;
+
+    return b;
+}
+
+/* Emits stacks that can't overflow for 'm' and returns their sizes:
+ *
+ *  stack             One region/transition pair for the triggering
+ *                    transition and every transition without a trigger,
+ *                    plus the larger of one region/state pair per active
+ *                    region and one entry per nesting level. Walks over
+ *                    every region need one entry per region.
+ *  stack2            One entry per active region.
+ *  completion_stack  One entry per state with a completion transition
+ *                    that can be active at the same time.
+ *
+ * and the state bitsets for the number of states. The event queue gets
+ * UFSM_QUEUE_SIZE events, the defer queue UFSM_DEFER_QUEUE_SIZE events if
+ * the chart defers any and none otherwise, see sizes[3]. The stacks of a
+ * context of its own take the sum of the three, <Machine>_CONTEXT_DATA_SIZE.
+ */
+static void ufsm_gen_storage(struct ufsm_machine *m, uint32_t sizes[4])
+{
+    struct machine_bounds b = ufsm_bound_regions(m->region);
+    uint32_t step = 2 * b.active_regions;
+    char *decl = id_to_decl(m->id);
+
+    if (b.depth > step)
+        step = b.depth;
+
+    sizes[0] = 2 * (1 + b.untriggered) + step;
+
+    if (b.regions > sizes[0])
+        sizes[0] = b.regions;
+
+    sizes[1] = b.active_regions;
+    sizes[2] = b.completions ? b.completions : 1;
+    sizes[3] = b.defers ? UFSM_DEFER_QUEUE_SIZE : 0;
+
+    if (v) printf ("o %s: depth %u, active regions %u, completion states %u,"
+                   " stacks %u/%u/%u, queues %u/%u\n", m->name, b.depth,
+                   b.active_regions, b.completions, sizes[0], sizes[1],
+                   sizes[2], UFSM_QUEUE_SIZE, sizes[3]);
+
+    fprintf(fp_h, "/* %s: depth %u, active regions %u, completion states %u,"
+                  " stacks %u/%u/%u, queues %u/%u */\n", m->name, b.depth,
+                  b.active_regions, b.completions,
+                  sizes[0], sizes[1], sizes[2], UFSM_QUEUE_SIZE, sizes[3]);
+    fprintf(fp_h, "#define %s_CONTEXT_DATA_SIZE %u\n", m->name,
+                                        sizes[0] + sizes[1] + sizes[2]);
+
+    fprintf(fp_c, "static void *%s_stack[%u];\n", decl, sizes[0]);
+    fprintf(fp_c, "static void *%s_stack2[%u];\n", decl, sizes[1]);
+    fprintf(fp_c, "static void *%s_completion_stack[%u];\n", decl, sizes[2]);
+    fprintf(fp_c, "static uint32_t %s_data[UFSM_MACHINE_DATA_SIZE(%u)];\n",
+                                                    decl, no_of_states);
+    fprintf(fp_c, "static struct ufsm_event %s_queue[UFSM_QUEUE_SIZE];\n",
+                                                    decl);
+    if (sizes[3])
+        fprintf(fp_c, "static struct ufsm_event"
+                      " %s_defer_queue[UFSM_DEFER_QUEUE_SIZE];\n", decl);
+
+    free(decl);
+}
+
+static void ufsm_gen_stack(const char *field, const char *decl,
+                           uint32_t no_of_elements)
+{
+    fprintf(fp_c, "    .%s = {\n", field);
+    fprintf(fp_c, "      .no_of_elements = %u,\n", no_of_elements);
+    fprintf(fp_c, "      .data = %s_%s,\n", decl, field);
+    fprintf(fp_c, "    },\n");
+}
+
+/* The size is left to the macro, so that it follows the build of ufsm.c */
+static void ufsm_gen_queue(const char *field, const char *decl,
+                           const char *size)
+{
+    fprintf(fp_c, "  .%s = {\n", field);
+    fprintf(fp_c, "    .no_of_elements = %s,\n", size);
+    fprintf(fp_c, "    .events = %s_%s,\n", decl, field);
+    fprintf(fp_c, "  },\n");
+}
+
 bool ufsm_gen_machine (struct ufsm_machine *m)
 {
-    fprintf (fp_c,"static struct ufsm_machine %s = {\n",id_to_decl(m->id));
+    char *decl = id_to_decl(m->id);
+    uint32_t sizes[4];
+
+    ufsm_gen_storage(m, sizes);
+
+    fprintf (fp_c,"static struct ufsm_machine %s = {\n",decl);
     if (flag_strip) {
          fprintf (fp_c,"  .id     = \"\", \n");
          fprintf (fp_c,"  .name   = \"\", \n");
@@ -462,7 +1097,29 @@ bool ufsm_gen_machine (struct ufsm_machine *m)
         fprintf (fp_c,"  .id     = \"%s\", \n", m->id);
         fprintf (fp_c,"  .name   = \"%s\", \n", m->name);
     }
-    fprintf (fp_c,"  .region = &%s,    \n",id_to_decl(m->region->id));
+    fprintf (fp_c,"  .region = %s,    \n",ref("ufsm_region", m->region->id));
+    fprintf (fp_c,"  .no_of_regions = %u,\n", no_of_regions);
+    fprintf (fp_c,"  .no_of_states = %u,\n", no_of_states);
+    fprintf (fp_c,"  .states = ufsm_states,\n");
+    fprintf (fp_c,"  .flat = %s,\n", flag_flat ? "true" : "false");
+    if (flag_rodata)
+        fprintf (fp_c,"  .read_only = true,\n");
+    fprintf (fp_c,"  .no_of_events = %u,\n", no_of_events);
+    fprintf (fp_c,"  .no_of_transitions = %u,\n", no_of_transitions);
+    if (no_of_timers) {
+        fprintf (fp_c,"  .timers = ufsm_timers,\n");
+        fprintf (fp_c,"  .no_of_timers = %u,\n", no_of_timers);
+    }
+    fprintf (fp_c,"  .context = {\n");
+    fprintf (fp_c,"    .m = &%s,\n", decl);
+    ufsm_gen_stack("stack", decl, sizes[0]);
+    ufsm_gen_stack("stack2", decl, sizes[1]);
+    ufsm_gen_stack("completion_stack", decl, sizes[2]);
+    fprintf (fp_c,"  },\n");
+    fprintf (fp_c,"  .data = %s_data,\n", decl);
+    ufsm_gen_queue("queue", decl, "UFSM_QUEUE_SIZE");
+    if (sizes[3])
+        ufsm_gen_queue("defer_queue", decl, "UFSM_DEFER_QUEUE_SIZE");
     if (m->next)
         fprintf (fp_c,"  .next = &%s, \n", id_to_decl(m->next->id));
     else
@@ -470,11 +1127,13 @@ bool ufsm_gen_machine (struct ufsm_machine *m)
 
 
     if (m->parent_state)
-        fprintf (fp_c,"  .parent_state = &%s, \n", id_to_decl(m->parent_state->id));
+        fprintf (fp_c,"  .parent_state = %s, \n",
+                                ref("ufsm_state", m->parent_state->id));
     else
         fprintf (fp_c,"  .parent_state = NULL, \n");
 
     fprintf (fp_c,"};\n");
+    free(decl);
 
     if (m->region)
         ufsm_gen_regions(m->region);
@@ -487,23 +1146,23 @@ static void ufsm_gen_regions_decl(struct ufsm_region *region);
 
 static void ufsm_gen_states_decl(struct ufsm_state *state)
 {
-    fprintf(fp_c,"static struct ufsm_state %s;\n",id_to_decl(state->id));
+    fprintf(fp_c,"static %sstruct ufsm_state %s;\n",rodata,id_to_decl(state->id));
     if (state->region)
         ufsm_gen_regions_decl(state->region);
 
 
 
     for (struct ufsm_entry_exit *e = state->entry; e; e = e->next)
-        fprintf(fp_c, "static struct ufsm_entry_exit %s;\n",
-                        id_to_decl(e->id));
+        fprintf(fp_c, "static %sstruct ufsm_entry_exit %s;\n",
+                        rodata, id_to_decl(e->id));
 
     for (struct ufsm_doact *e = state->doact; e; e = e->next)
-        fprintf(fp_c, "static struct ufsm_doact %s;\n",
-                        id_to_decl(e->id));
+        fprintf(fp_c, "static %sstruct ufsm_doact %s;\n",
+                        rodata, id_to_decl(e->id));
 
     for (struct ufsm_entry_exit *e = state->exit; e; e = e->next)
-        fprintf(fp_c, "static struct ufsm_entry_exit %s;\n",
-                        id_to_decl(e->id));
+        fprintf(fp_c, "static %sstruct ufsm_entry_exit %s;\n",
+                        rodata, id_to_decl(e->id));
 
 
 }
@@ -511,22 +1170,23 @@ static void ufsm_gen_states_decl(struct ufsm_state *state)
 static void ufsm_gen_regions_decl(struct ufsm_region *region)
 {
     for (struct ufsm_region *r = region; r; r = r->next) {
-        fprintf (fp_c,"static struct ufsm_region %s;\n",id_to_decl(r->id));
+        fprintf (fp_c,"static %sstruct ufsm_region %s;\n",rodata,
+                                                    id_to_decl(r->id));
 
         for (struct ufsm_transition *t = r->transition; t; t = t->next) {
-            fprintf(fp_c, "static struct ufsm_transition %s;\n",
-                               id_to_decl(t->id));
+            fprintf(fp_c, "static %sstruct ufsm_transition %s;\n",
+                               rodata, id_to_decl(t->id));
 
             for (struct ufsm_action *a = t->action; a; a = a->next)
             {
                 if (! (strcmp(a->name, "ufsm_defer") == 0))
-                    fprintf(fp_c, "static struct ufsm_action %s;\n",
-                            id_to_decl(a->id));
+                    fprintf(fp_c, "static %sstruct ufsm_action %s;\n",
+                            rodata, id_to_decl(a->id));
             }
 
             for (struct ufsm_guard *g = t->guard; g; g = g->next)
-                fprintf(fp_c, "static struct ufsm_guard %s;\n",
-                            id_to_decl(g->id));
+                fprintf(fp_c, "static %sstruct ufsm_guard %s;\n",
+                            rodata, id_to_decl(g->id));
 
         }
 
@@ -543,10 +1203,284 @@ bool ufsm_gen_machine_decl (struct ufsm_machine *m)
     return true;
 }
 
+static bool _uses_submachine(struct ufsm_region *region,
+                             struct ufsm_machine *m)
+{
+    for (struct ufsm_region *r = region; r; r = r->next) {
+        for (struct ufsm_state *s = r->state; s; s = s->next) {
+            if (s->submachine == m)
+                return true;
+            if (s->region && _uses_submachine(s->region, m))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+static bool is_submachine(struct ufsm_machine *root, struct ufsm_machine *m)
+{
+    for (struct ufsm_machine *mm = root; mm; mm = mm->next) {
+        if (mm->region && _uses_submachine(mm->region, m))
+            return true;
+    }
+
+    return false;
+}
+
+static struct ufsm_machine **indexed_machines = NULL;
+static uint32_t no_of_indexed_machines = 0;
+
+static bool machine_is_indexed(struct ufsm_machine *m)
+{
+    for (uint32_t i = 0; i < no_of_indexed_machines; i++) {
+        if (indexed_machines[i] == m)
+            return true;
+    }
+
+    return false;
+}
+
+/* Regions are numbered so that a nested region always has a higher index
+ * than the region of its parent state. State index zero is reserved for
+ * 'no state'.
+ *
+ * Nested regions are visited last-first, the same order in which the runtime
+ * used to discover active regions, so that walking the active states from
+ * the highest index down visits them in the legacy dispatch order.
+ */
+static void ufsm_index_regions(struct ufsm_region *region)
+{
+    struct ufsm_region **nested = NULL;
+    uint32_t no_of_nested = 0;
+
+    for (struct ufsm_region *r = region; r; r = r->next) {
+        r->index = no_of_regions++;
+
+        for (struct ufsm_transition *t = r->transition; t; t = t->next)
+            t->index = ++no_of_transitions;
+    }
+
+    for (struct ufsm_region *r = region; r; r = r->next) {
+        for (struct ufsm_state *s = r->state; s; s = s->next) {
+            struct ufsm_region *sr = s->region;
+
+            s->index = ++no_of_states;
+            state_table = realloc(state_table, sizeof(struct ufsm_state *) *
+                                                    (no_of_states + 1));
+            state_table[no_of_states] = s;
+
+            /* Paths are computed across submachine boundaries */
+            if (!sr && s->submachine && s->submachine->region)
+                s->submachine->region->parent_state = s;
+
+            if (!sr && s->submachine && !machine_is_indexed(s->submachine)) {
+                indexed_machines = realloc(indexed_machines,
+                                sizeof(struct ufsm_machine *) *
+                                (no_of_indexed_machines + 1));
+                indexed_machines[no_of_indexed_machines++] = s->submachine;
+                sr = s->submachine->region;
+            }
+
+            if (sr) {
+                nested = realloc(nested, sizeof(struct ufsm_region *) *
+                                                    (no_of_nested + 1));
+                nested[no_of_nested++] = sr;
+            }
+        }
+    }
+
+    while (no_of_nested--)
+        ufsm_index_regions(nested[no_of_nested]);
+
+    free(nested);
+}
+
+static void ufsm_index_machine(struct ufsm_machine *m)
+{
+    indexed_machines = realloc(indexed_machines,
+                    sizeof(struct ufsm_machine *) * (no_of_indexed_machines + 1));
+    indexed_machines[no_of_indexed_machines++] = m;
+
+    if (m->region)
+        ufsm_index_regions(m->region);
+}
+
+/* Without orthogonal regions at most one leaf state is active, and the
+ * states get flattened dispatch tables that include inherited transitions.
+ * A submachine used by several states has no single parent to inherit
+ * from, so it also keeps the per-state tables.
+ */
+static bool can_flatten(struct ufsm_machine *root)
+{
+    for (struct ufsm_machine *m = root; m; m = m->next) {
+        if (m->region && m->region->next)
+            return false;
+    }
+
+    for (uint32_t i = 1; i <= no_of_states; i++) {
+        struct ufsm_state *s = state_table[i];
+        struct ufsm_region *r = s->region;
+
+        if (!r && s->submachine)
+            r = s->submachine->region;
+
+        if (r && r->next)
+            return false;
+
+        for (uint32_t n = i + 1; s->submachine && n <= no_of_states; n++) {
+            if (state_table[n]->submachine == s->submachine)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/* Numbers every event up front, the interest bitmaps are sized by the
+ * total number of events.
+ */
+static void ufsm_index_events(void)
+{
+    for (uint32_t i = 1; i <= no_of_states; i++) {
+        struct ufsm_state *s = state_table[i];
+
+        for (struct ufsm_transition *t = s->parent_region->transition;
+                                                        t; t = t->next) {
+            if (t->source != s)
+                continue;
+
+            for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next) {
+                uint32_t ev = ev_name_to_index(tt->name);
+
+                if (ev >= no_of_events)
+                    no_of_events = ev + 1;
+            }
+        }
+    }
+}
+
+/* Parses a time event trigger, 'after(ticks)' or 'at(ticks)' */
+static bool parse_time_event(const char *name, unsigned long long *ticks,
+                             bool *absolute)
+{
+    int n = 0;
+
+    if (!name)
+        return false;
+
+    *absolute = false;
+
+    if ((sscanf(name, " after ( %llu ) %n", ticks, &n) == 1) && !name[n])
+        return true;
+
+    n = 0;
+    *absolute = true;
+
+    return (sscanf(name, " at ( %llu ) %n", ticks, &n) == 1) && !name[n];
+}
+
+static bool time_event_name_taken(const char *name)
+{
+    for (struct time_event_list *te = telist; te; te = te->next) {
+        if (strcmp(te->name, name) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+/* Gives every after()/at() trigger a timer and renames it to an event
+ * name that can be emitted, '<state>_after_<ticks>'. Triggers of the same
+ * state with the same time share the timer.
+ */
+static void ufsm_index_time_events(void)
+{
+    struct time_event_list **last = &telist;
+
+    for (uint32_t i = 1; i <= no_of_states; i++) {
+        struct ufsm_state *s = state_table[i];
+
+        for (struct ufsm_transition *t = s->parent_region->transition;
+                                                        t; t = t->next) {
+            if (t->source != s)
+                continue;
+
+            for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next) {
+                struct time_event_list *found = NULL;
+                unsigned long long ticks = 0;
+                bool absolute = false;
+
+                if (!parse_time_event(tt->name, &ticks, &absolute))
+                    continue;
+
+                for (struct time_event_list *te = telist; te; te = te->next) {
+                    if ((te->state == s) && (te->ticks == ticks) &&
+                        (te->absolute == absolute))
+                        found = te;
+                }
+
+                if (!found) {
+                    const char *name = s->name ? s->name : s->id;
+                    char *p = NULL;
+
+                    found = calloc(1, sizeof(struct time_event_list));
+                    found->state = s;
+                    found->ticks = ticks;
+                    found->absolute = absolute;
+                    found->index = no_of_timers++;
+                    found->name = malloc(strlen(name) + 64);
+                    sprintf(found->name, "%s_%s_%llu", name,
+                                    absolute ? "at" : "after", ticks);
+
+                    for (p = found->name; *p; p++) {
+                        if (!((*p >= 'a' && *p <= 'z') ||
+                              (*p >= 'A' && *p <= 'Z') ||
+                              (*p >= '0' && *p <= '9')))
+                            *p = '_';
+                    }
+
+                    if (time_event_name_taken(found->name))
+                        sprintf(p, "_%u", found->index);
+
+                    *last = found;
+                    last = &found->next;
+
+                    if (v) printf ("o Time event %s, timer %u\n",
+                                            found->name, found->index);
+                }
+
+                tt->name = found->name;
+            }
+        }
+    }
+}
+
+static void ufsm_gen_state_table(void)
+{
+    fprintf(fp_c, "static struct ufsm_state * const ufsm_states[] = {\n");
+    fprintf(fp_c, "  NULL,\n");
+
+    for (uint32_t i = 1; i <= no_of_states; i++)
+        fprintf(fp_c, "  %s,\n", ref("ufsm_state", state_table[i]->id));
+
+    fprintf(fp_c, "};\n");
+
+    if (no_of_timers)
+        fprintf(fp_c, "static struct ufsm_timer ufsm_timers[%u];\n",
+                                                        no_of_timers);
+}
+
 bool ufsm_gen_output(struct ufsm_machine *root, char *output_name,
-                    char *output_prefix, uint32_t verbose, bool strip)
+                    char *output_prefix, uint32_t verbose, bool strip,
+                    bool read_only, bool pure_guards)
 {
     v = verbose;
+    flag_rodata = read_only;
+    flag_pure_guards = pure_guards;
+
+    if (flag_rodata)
+        rodata = "const ";
 
     if (v) printf ("o Generating output %s\n", output_name);
 
@@ -582,9 +1516,29 @@ bool ufsm_gen_output(struct ufsm_machine *root, char *output_name,
 
     fprintf(fp_c,"#include \"%s\"\n", fn_h);
 
+    for (struct ufsm_machine *m = root; m; m = m->next) {
+        if (!is_submachine(root, m))
+            ufsm_index_machine(m);
+    }
+
+    for (struct ufsm_machine *m = root; m; m = m->next) {
+        if (!machine_is_indexed(m))
+            ufsm_index_machine(m);
+    }
+
+    if (v) printf ("o %u regions, %u states\n", no_of_regions, no_of_states);
+
+    flag_flat = can_flatten(root);
+    ufsm_index_time_events();
+    ufsm_index_events();
+
+    if (v && flag_flat) printf ("o Flattening dispatch tables\n");
+
     for (struct ufsm_machine *m = root; m; m = m->next)
         ufsm_gen_machine_decl(m);
 
+    ufsm_gen_state_table();
+
     fprintf(fp_c,"\n\n\n");
     for (struct ufsm_machine *m = root; m; m = m->next)
         ufsm_gen_machine(m);
@@ -601,7 +1555,7 @@ bool ufsm_gen_output(struct ufsm_machine *root, char *output_name,
         fprintf(fp_h, "bool %s(void);\n",gg->name);
     for (struct ufsm_doact *da = doact_first; da; da = da->next)
     {
-        fprintf(fp_h, "void %s_start(struct ufsm_machine *m, struct ufsm_state *s, ufsm_doact_cb_t cb);\n", da->name);
+        fprintf(fp_h, "void %s_start(struct ufsm_context *c, struct ufsm_state *s, ufsm_doact_cb_t cb);\n", da->name);
         fprintf(fp_h, "void %s_stop(void);\n", da->name);
     }
 
@@ -615,6 +1569,16 @@ bool ufsm_gen_output(struct ufsm_machine *root, char *output_name,
     fprintf(fp_h,"};\n");
 
     for (struct ufsm_machine *m = root; m; m = m->next) {
+        fprintf(fp_h,"#define %s_INSTANCE_DATA_SIZE "
+                     "UFSM_INSTANCE_DATA_SIZE(%u, %u)\n",
+                     m->name, no_of_regions, no_of_states);
+        fprintf(fp_h,"#define %s_NO_OF_TIMERS %u\n", m->name, no_of_timers);
+        fprintf(fp_h,"#define %s_METRICS_DATA_SIZE(no_of_shards) "
+                     "UFSM_METRICS_DATA_SIZE(no_of_shards, %u, %u, %u)\n",
+                     m->name, no_of_transitions, no_of_states, no_of_events);
+        fprintf(fp_h,"#define %s_METRICS_ENTERED_SIZE "
+                     "UFSM_METRICS_ENTERED_SIZE(%u)\n",
+                     m->name, no_of_states);
         fprintf(fp_h,"struct ufsm_machine * get_%s(void);\n",m->name);
     }
     fprintf(fp_h,"#endif\n");
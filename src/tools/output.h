@@ -15,7 +15,8 @@
 
 
 bool ufsm_gen_output(struct ufsm_machine *root, char *output_name,
-                    char *output_prefix, uint32_t verbose, bool strip);
+                    char *output_prefix, uint32_t verbose, bool strip,
+                    bool read_only, bool pure_guards);
 
 
 
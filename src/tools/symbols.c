@@ -0,0 +1,100 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "symbols.h"
+
+/* FNV-1a */
+static uint32_t symbol_hash(const char *id)
+{
+    uint32_t h = 2166136261u;
+
+    for (; *id; id++) {
+        h ^= (uint8_t) *id;
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+/* Open addressing, the size is a power of two and at most half used */
+static struct symbol * symbol_find(struct symbol_table *t, const char *id)
+{
+    uint32_t n = symbol_hash(id) & (t->size - 1);
+
+    while (t->table[n].id && strcmp(t->table[n].id, id) != 0)
+        n = (n + 1) & (t->size - 1);
+
+    return &t->table[n];
+}
+
+static void symbol_grow(struct symbol_table *t)
+{
+    struct symbol_table old = *t;
+
+    t->size = old.size ? (old.size * 2) : 64;
+    t->table = calloc(t->size, sizeof(struct symbol));
+
+    if (t->table == NULL) {
+        printf ("Error: Out of memory\n");
+        exit(-1);
+    }
+
+    for (uint32_t n = 0; n < old.size; n++) {
+        if (old.table[n].id)
+            *symbol_find(t, old.table[n].id) = old.table[n];
+    }
+
+    free(old.table);
+}
+
+/* Returns the entry for 'id', which is added without a value if it's new.
+ * The entry is valid until the next one is added.
+ */
+struct symbol * symbol_entry(struct symbol_table *t, const char *id)
+{
+    struct symbol *sym = NULL;
+
+    if (2 * (t->count + 1) > t->size)
+        symbol_grow(t);
+
+    sym = symbol_find(t, id);
+
+    if (sym->id == NULL) {
+        sym->id = id;
+        t->count++;
+    }
+
+    return sym;
+}
+
+/* Keeps the value of the first 'id' added */
+void symbol_add(struct symbol_table *t, const char *id, void *value)
+{
+    struct symbol *sym = NULL;
+
+    if (id == NULL)
+        return;
+
+    sym = symbol_entry(t, id);
+
+    if (sym->value == NULL)
+        sym->value = value;
+}
+
+void * symbol_get(struct symbol_table *t, const char *id)
+{
+    if (id == NULL || t->size == 0)
+        return NULL;
+
+    return symbol_find(t, id)->value;
+}
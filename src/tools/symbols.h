@@ -0,0 +1,35 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef UFSM_SYMBOLS_H
+#define UFSM_SYMBOLS_H
+
+#include <stdint.h>
+
+/* A string keyed hash table for the tools. Keys are not copied, a zeroed
+ * table is empty.
+ */
+struct symbol
+{
+    const char *id;
+    void *value;
+};
+
+struct symbol_table
+{
+    struct symbol *table;
+    uint32_t size;
+    uint32_t count;
+};
+
+struct symbol * symbol_entry(struct symbol_table *t, const char *id);
+void symbol_add(struct symbol_table *t, const char *id, void *value);
+void * symbol_get(struct symbol_table *t, const char *id);
+
+#endif
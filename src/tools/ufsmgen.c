@@ -0,0 +1,629 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* Synthetic chart generator. Writes a random but reproducible state
+ * machine as XMI in the dialect read by ufsmimport, and a C file with the
+ * guards and actions it refers to, for scale testing the importer and the
+ * runtime.
+ *
+ * Regions are filled breadth first with up to 'width' states each until
+ * the state budget is spent, states above 'depth' become composite with
+ * 'regions' orthogonal regions. Every state gets 'transitions' triggered
+ * transitions to states in its own region, an enclosing region or one
+ * level into a composite of those.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define NONE UINT32_MAX
+
+enum gen_kind
+{
+    GEN_STATE,
+    GEN_INITIAL,
+    GEN_CHOICE,
+    GEN_JUNCTION,
+    GEN_FORK,
+    GEN_JOIN,
+    GEN_DEEP_HISTORY,
+};
+
+static const char *gen_kind_names[] =
+{
+    [GEN_INITIAL] = "initial",
+    [GEN_CHOICE] = "choice",
+    [GEN_JUNCTION] = "junction",
+    [GEN_FORK] = "fork",
+    [GEN_JOIN] = "join",
+    [GEN_DEEP_HISTORY] = "deepHistory",
+};
+
+struct gen_state
+{
+    enum gen_kind kind;
+    uint32_t region;
+    uint32_t first_region;
+    uint32_t no_of_regions;
+};
+
+struct gen_region
+{
+    uint32_t parent;
+    uint32_t depth;
+    uint32_t *states;
+    uint32_t no_of_states;
+    uint32_t *transitions;
+    uint32_t no_of_transitions;
+    uint32_t init_target;
+    bool has_history;
+};
+
+struct gen_transition
+{
+    uint32_t source;
+    uint32_t dest;
+    uint32_t trigger;
+    uint32_t guard;
+    uint32_t action;
+};
+
+static struct gen_state *states = NULL;
+static uint32_t no_of_states = 0;
+static uint32_t no_of_simple = 0;
+static struct gen_region *regions = NULL;
+static uint32_t no_of_regions = 0;
+static struct gen_transition *transitions = NULL;
+static uint32_t no_of_transitions = 0;
+static uint32_t no_of_guards = 0;
+static uint32_t no_of_actions = 0;
+static uint32_t *composites = NULL;
+static uint32_t no_of_composites = 0;
+
+static uint32_t rand_state = 1;
+static uint32_t opt_events = 8;
+static uint32_t opt_guards = 0;
+static bool opt_actions = false;
+
+static void * gen_grow(void *p, size_t size, uint32_t n)
+{
+    p = realloc(p, size * (n + 1));
+
+    if (p == NULL) {
+        printf ("Error: Out of memory\n");
+        exit(-1);
+    }
+
+    return p;
+}
+
+/* xorshift32, the same chart for the same seed on every platform */
+static uint32_t gen_rand(uint32_t n)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+
+    return n ? (rand_state % n) : 0;
+}
+
+static uint32_t new_region(uint32_t parent, uint32_t depth)
+{
+    regions = gen_grow(regions, sizeof(struct gen_region), no_of_regions);
+    memset(&regions[no_of_regions], 0, sizeof(struct gen_region));
+    regions[no_of_regions].parent = parent;
+    regions[no_of_regions].depth = depth;
+    regions[no_of_regions].init_target = NONE;
+
+    return no_of_regions++;
+}
+
+static uint32_t new_state(uint32_t r, enum gen_kind kind)
+{
+    struct gen_region *region = &regions[r];
+
+    states = gen_grow(states, sizeof(struct gen_state), no_of_states);
+    states[no_of_states].kind = kind;
+    states[no_of_states].region = r;
+    states[no_of_states].first_region = NONE;
+    states[no_of_states].no_of_regions = 0;
+
+    region->states = gen_grow(region->states, sizeof(uint32_t),
+                                                region->no_of_states);
+    region->states[region->no_of_states++] = no_of_states;
+
+    if (kind == GEN_STATE)
+        no_of_simple++;
+
+    return no_of_states++;
+}
+
+static uint32_t new_transition(uint32_t source, uint32_t dest,
+                               uint32_t trigger)
+{
+    struct gen_region *region = &regions[states[source].region];
+    struct gen_transition *t = NULL;
+
+    /* A transition is written in the region of its source */
+    region->transitions = gen_grow(region->transitions, sizeof(uint32_t),
+                                                region->no_of_transitions);
+    region->transitions[region->no_of_transitions++] = no_of_transitions;
+
+    transitions = gen_grow(transitions, sizeof(struct gen_transition),
+                                                    no_of_transitions);
+    t = &transitions[no_of_transitions];
+    t->source = source;
+    t->dest = dest;
+    t->trigger = trigger;
+    t->guard = NONE;
+    t->action = NONE;
+
+    if (trigger != NONE && opt_guards && gen_rand(100) < opt_guards)
+        t->guard = no_of_guards++;
+
+    if (opt_actions)
+        t->action = no_of_actions++;
+
+    return no_of_transitions++;
+}
+
+/* A random state of 'r' that isn't a pseudostate, NONE if there is none */
+static uint32_t pick_state(uint32_t r, uint32_t not)
+{
+    struct gen_region *region = &regions[r];
+    uint32_t start = gen_rand(region->no_of_states);
+
+    for (uint32_t n = 0; n < region->no_of_states; n++) {
+        uint32_t s = region->states[(start + n) % region->no_of_states];
+
+        if (states[s].kind == GEN_STATE && s != not)
+            return s;
+    }
+
+    return NONE;
+}
+
+static uint32_t pick_target(uint32_t source)
+{
+    uint32_t r = states[source].region;
+    uint32_t target = NONE;
+
+    /* Out to an enclosing region */
+    while (regions[r].parent != NONE && gen_rand(4) == 0)
+        r = states[regions[r].parent].region;
+
+    target = pick_state(r, NONE);
+
+    /* Into a composite */
+    if (states[target].no_of_regions && gen_rand(2)) {
+        uint32_t sub = states[target].first_region +
+                       gen_rand(states[target].no_of_regions);
+        uint32_t s = pick_state(sub, NONE);
+
+        if (s != NONE)
+            target = s;
+    }
+
+    return target;
+}
+
+static void gen_tree(uint32_t budget, uint32_t width, uint32_t depth,
+                     uint32_t no_of_subregions)
+{
+    new_region(NONE, 0);
+
+    /* Regions are appended while they are filled, breadth first */
+    for (uint32_t r = 0; r < no_of_regions; r++) {
+        /* Every region from this one on needs a state */
+        uint32_t spare = budget - (no_of_regions - r);
+        uint32_t n = 1 + ((spare < width - 1) ? spare : width - 1);
+        uint32_t init = new_state(r, GEN_INITIAL);
+
+        budget -= n;
+
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t s = new_state(r, GEN_STATE);
+
+            /* Regions waiting to be filled need a state each */
+            if (regions[r].depth + 1 >= depth ||
+                budget < (no_of_regions - r - 1) + no_of_subregions)
+                continue;
+
+            states[s].first_region = no_of_regions;
+            states[s].no_of_regions = no_of_subregions;
+
+            for (uint32_t k = 0; k < no_of_subregions; k++)
+                new_region(s, regions[r].depth + 1);
+
+            composites = gen_grow(composites, sizeof(uint32_t),
+                                                    no_of_composites);
+            composites[no_of_composites++] = s;
+        }
+
+        regions[r].init_target = pick_state(r, NONE);
+        new_transition(init, regions[r].init_target, NONE);
+    }
+}
+
+static void gen_transitions(uint32_t per_state)
+{
+    uint32_t n = no_of_states;
+
+    for (uint32_t s = 0; s < n; s++) {
+        if (states[s].kind != GEN_STATE)
+            continue;
+
+        for (uint32_t i = 0; i < per_state; i++)
+            new_transition(s, pick_target(s), gen_rand(opt_events));
+    }
+}
+
+/* s -> choice -> [guard] one state, else another */
+static void gen_choices(uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t r = gen_rand(no_of_regions);
+        uint32_t s = pick_state(r, NONE);
+        uint32_t c = new_state(r, GEN_CHOICE);
+        uint32_t t = NONE;
+
+        new_transition(s, c, gen_rand(opt_events));
+        t = new_transition(c, pick_state(r, NONE), NONE);
+        transitions[t].guard = no_of_guards++;
+        new_transition(c, pick_state(r, NONE), NONE);
+    }
+}
+
+static void gen_junctions(uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t r = gen_rand(no_of_regions);
+        uint32_t s = pick_state(r, NONE);
+        uint32_t j = new_state(r, GEN_JUNCTION);
+
+        new_transition(s, j, gen_rand(opt_events));
+        new_transition(j, pick_state(r, NONE), NONE);
+    }
+}
+
+/* A fork into every region of a composite with orthogonal regions, and a
+ * join out of it from a state other than the initial one in each region
+ */
+static uint32_t gen_forks(uint32_t count)
+{
+    uint32_t no_of_forks = 0;
+
+    for (uint32_t i = 0; i < count && no_of_composites; i++) {
+        uint32_t p = composites[gen_rand(no_of_composites)];
+        uint32_t r = states[p].region;
+        uint32_t fork = NONE;
+        uint32_t join = NONE;
+        uint32_t dest = pick_state(r, p);
+        bool can_join = (dest != NONE);
+
+        if (states[p].no_of_regions < 2)
+            continue;
+
+        fork = new_state(r, GEN_FORK);
+        new_transition(pick_state(r, NONE), fork, gen_rand(opt_events));
+
+        for (uint32_t k = 0; k < states[p].no_of_regions; k++)
+            new_transition(fork, pick_state(states[p].first_region + k,
+                                                        NONE), NONE);
+
+        for (uint32_t k = 0; k < states[p].no_of_regions; k++) {
+            uint32_t sub = states[p].first_region + k;
+
+            if (pick_state(sub, regions[sub].init_target) == NONE)
+                can_join = false;
+        }
+
+        no_of_forks++;
+
+        if (!can_join)
+            continue;
+
+        join = new_state(r, GEN_JOIN);
+
+        for (uint32_t k = 0; k < states[p].no_of_regions; k++) {
+            uint32_t sub = states[p].first_region + k;
+
+            new_transition(pick_state(sub, regions[sub].init_target), join,
+                                                                    NONE);
+        }
+
+        new_transition(join, dest, NONE);
+    }
+
+    return no_of_forks;
+}
+
+static void gen_history(uint32_t count)
+{
+    for (uint32_t i = 0; i < count && no_of_composites; i++) {
+        uint32_t p = composites[gen_rand(no_of_composites)];
+        uint32_t sub = states[p].first_region;
+        uint32_t h = NONE;
+
+        if (regions[sub].has_history)
+            continue;
+
+        regions[sub].has_history = true;
+        h = new_state(sub, GEN_DEEP_HISTORY);
+        new_transition(h, regions[sub].init_target, NONE);
+        new_transition(pick_state(states[p].region, NONE), h,
+                                                    gen_rand(opt_events));
+    }
+}
+
+static void indent(FILE *fp, uint32_t level)
+{
+    for (uint32_t n = 0; n < level; n++)
+        fputc('\t', fp);
+}
+
+static void write_transition(FILE *fp, uint32_t n, uint32_t level)
+{
+    struct gen_transition *t = &transitions[n];
+    bool empty = (t->trigger == NONE) && (t->guard == NONE) &&
+                 (t->action == NONE);
+
+    indent(fp, level);
+    fprintf(fp, "<transition xmi:id=\"t%u\" xmi:type=\"uml:Transition\" "
+                "source=\"s%u\" target=\"s%u\" kind=\"external\"%s>\n",
+                n, t->source, t->dest, empty ? "/" : "");
+
+    if (empty)
+        return;
+
+    if (t->trigger != NONE) {
+        indent(fp, level + 1);
+        fprintf(fp, "<trigger xmi:id=\"t%utrigger\" xmi:type=\"uml:Trigger\" "
+                    "name=\"EV_%u\"/>\n", n, t->trigger);
+    }
+
+    if (t->guard != NONE) {
+        indent(fp, level + 1);
+        fprintf(fp, "<guard xmi:id=\"t%uguard\" xmi:type=\"uml:Constraint\" "
+                    "specification=\"g%u\"/>\n", n, t->guard);
+    }
+
+    if (t->action != NONE) {
+        indent(fp, level + 1);
+        fprintf(fp, "<effect xmi:id=\"t%ueffect\" "
+                    "xmi:type=\"uml:OpaqueBehavior\" name=\"a%u\"/>\n",
+                    n, t->action);
+    }
+
+    indent(fp, level);
+    fprintf(fp, "</transition>\n");
+}
+
+static void write_region(FILE *fp, uint32_t r, uint32_t level)
+{
+    struct gen_region *region = &regions[r];
+
+    indent(fp, level);
+    fprintf(fp, "<region xmi:id=\"r%u\" name=\"R%u\" "
+                "xmi:type=\"uml:Region\">\n", r, r);
+
+    for (uint32_t i = 0; i < region->no_of_states; i++) {
+        uint32_t s = region->states[i];
+        struct gen_state *state = &states[s];
+
+        indent(fp, level + 1);
+
+        if (state->kind != GEN_STATE) {
+            fprintf(fp, "<subvertex xmi:id=\"s%u\" "
+                        "xmi:type=\"uml:Pseudostate\" kind=\"%s\"/>\n",
+                        s, gen_kind_names[state->kind]);
+            continue;
+        }
+
+        fprintf(fp, "<subvertex xmi:id=\"s%u\" name=\"S%u\" "
+                    "xmi:type=\"uml:State\">\n", s, s);
+
+        if (opt_actions) {
+            indent(fp, level + 2);
+            fprintf(fp, "<entry xmi:id=\"s%uentry\" "
+                        "xmi:type=\"uml:OpaqueBehavior\" name=\"e%u\"/>\n",
+                        s, s);
+            indent(fp, level + 2);
+            fprintf(fp, "<exit xmi:id=\"s%uexit\" "
+                        "xmi:type=\"uml:OpaqueBehavior\" name=\"x%u\"/>\n",
+                        s, s);
+        }
+
+        for (uint32_t k = 0; k < state->no_of_regions; k++)
+            write_region(fp, state->first_region + k, level + 2);
+
+        indent(fp, level + 1);
+        fprintf(fp, "</subvertex>\n");
+    }
+
+    for (uint32_t n = 0; n < region->no_of_transitions; n++)
+        write_transition(fp, region->transitions[n], level + 1);
+
+    indent(fp, level);
+    fprintf(fp, "</region>\n");
+}
+
+static void write_xmi(FILE *fp, const char *name)
+{
+    fprintf(fp, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    fprintf(fp, "<xmi:XMI xmi:version=\"2.1\" "
+                "xmlns:uml=\"http://schema.omg.org/spec/UML/2.0\" "
+                "xmlns:xmi=\"http://schema.omg.org/spec/XMI/2.1\">\n");
+    fprintf(fp, "\t<xmi:Documentation exporter=\"ufsmgen\" "
+                "exporterVersion=\"1.0\"/>\n");
+    fprintf(fp, "\t<uml:Model xmi:id=\"model\" xmi:type=\"uml:Model\" "
+                "name=\"RootModel\">\n");
+    fprintf(fp, "\t\t<packagedElement xmi:id=\"machine\" name=\"%s\" "
+                "xmi:type=\"uml:StateMachine\">\n", name);
+
+    write_region(fp, 0, 3);
+
+    fprintf(fp, "\t\t</packagedElement>\n");
+    fprintf(fp, "\t</uml:Model>\n");
+    fprintf(fp, "</xmi:XMI>\n");
+}
+
+/* Guards pass two times out of three, so choices take both branches */
+static void write_stubs(FILE *fp, const char *name)
+{
+    fprintf(fp, "/* Generated by ufsmgen */\n\n");
+    fprintf(fp, "#include <ufsm.h>\n");
+    fprintf(fp, "#include \"%s.h\"\n\n", name);
+    fprintf(fp, "static uint32_t ufsmgen_calls = 0;\n\n");
+
+    if (no_of_guards) {
+        fprintf(fp, "static bool ufsmgen_guard(void)\n{\n");
+        fprintf(fp, "    return (++ufsmgen_calls %% 3) != 0;\n}\n\n");
+    }
+
+    for (uint32_t n = 0; n < no_of_guards; n++)
+        fprintf(fp, "bool g%u(void) { return ufsmgen_guard(); }\n", n);
+
+    for (uint32_t n = 0; n < no_of_actions; n++)
+        fprintf(fp, "void a%u(void) { ufsmgen_calls++; }\n", n);
+
+    for (uint32_t s = 0; opt_actions && s < no_of_states; s++) {
+        if (states[s].kind != GEN_STATE)
+            continue;
+
+        fprintf(fp, "void e%u(void) { ufsmgen_calls++; }\n", s);
+        fprintf(fp, "void x%u(void) { ufsmgen_calls++; }\n", s);
+    }
+
+    fprintf(fp, "\nstruct ufsm_machine * ufsmgen_machine(void)\n{\n");
+    fprintf(fp, "    return get_%s();\n}\n", name);
+}
+
+static FILE * open_output(const char *prefix, const char *name,
+                          const char *suffix)
+{
+    char *path = malloc(strlen(prefix) + strlen(name) + strlen(suffix) + 1);
+    FILE *fp = NULL;
+
+    sprintf(path, "%s%s%s", prefix, name, suffix);
+    fp = fopen(path, "w");
+
+    if (fp == NULL)
+        printf ("Error: Could not open file '%s'\n", path);
+
+    free(path);
+
+    return fp;
+}
+
+int main(int argc, char **argv)
+{
+    const char *name = NULL;
+    const char *prefix = "";
+    uint32_t opt_states = 100;
+    uint32_t opt_width = 4;
+    uint32_t opt_depth = 3;
+    uint32_t opt_regions = 1;
+    uint32_t opt_transitions = 2;
+    uint32_t opt_choices = 0;
+    uint32_t opt_junctions = 0;
+    uint32_t opt_forks = 0;
+    uint32_t opt_history = 0;
+    uint32_t no_of_forks = 0;
+    bool v = false;
+    FILE *fp = NULL;
+    int c;
+
+    if (argc < 2 || argv[1][0] == '-') {
+        printf ("Usage: ufsmgen <output name> [options]\n");
+        printf ("                  -c prefix/  - Output prefix\n");
+        printf ("                  -n <n>      - States, default 100\n");
+        printf ("                  -w <n>      - States per region, default 4\n");
+        printf ("                  -d <n>      - Nesting depth, default 3\n");
+        printf ("                  -r <n>      - Regions per composite, default 1\n");
+        printf ("                  -t <n>      - Transitions per state, default 2\n");
+        printf ("                  -e <n>      - Events, default 8\n");
+        printf ("                  -g <n>      - Percent of guarded transitions\n");
+        printf ("                  -a          - Entry, exit and effect actions\n");
+        printf ("                  -C <n>      - Choices\n");
+        printf ("                  -J <n>      - Junctions\n");
+        printf ("                  -F <n>      - Forks and joins\n");
+        printf ("                  -H <n>      - Deep history states\n");
+        printf ("                  -x <n>      - Random seed\n");
+        printf ("                  -v          - Verbose\n");
+        exit(0);
+    }
+
+    name = argv[1];
+
+    while ((c = getopt(argc - 1, argv + 1, "c:n:w:d:r:t:e:g:aC:J:F:H:x:v")) != -1) {
+        switch (c) {
+            case 'c': prefix = optarg; break;
+            case 'n': opt_states = strtoul(optarg, NULL, 0); break;
+            case 'w': opt_width = strtoul(optarg, NULL, 0); break;
+            case 'd': opt_depth = strtoul(optarg, NULL, 0); break;
+            case 'r': opt_regions = strtoul(optarg, NULL, 0); break;
+            case 't': opt_transitions = strtoul(optarg, NULL, 0); break;
+            case 'e': opt_events = strtoul(optarg, NULL, 0); break;
+            case 'g': opt_guards = strtoul(optarg, NULL, 0); break;
+            case 'a': opt_actions = true; break;
+            case 'C': opt_choices = strtoul(optarg, NULL, 0); break;
+            case 'J': opt_junctions = strtoul(optarg, NULL, 0); break;
+            case 'F': opt_forks = strtoul(optarg, NULL, 0); break;
+            case 'H': opt_history = strtoul(optarg, NULL, 0); break;
+            case 'x': rand_state = strtoul(optarg, NULL, 0); break;
+            case 'v': v = true; break;
+            default:
+                exit(-1);
+        }
+    }
+
+    if (!opt_states || !opt_width || !opt_depth || !opt_regions ||
+        !opt_events || !rand_state) {
+        printf ("Error: -n, -w, -d, -r, -e and -x must not be zero\n");
+        return -1;
+    }
+
+    gen_tree(opt_states, opt_width, opt_depth, opt_regions);
+    gen_transitions(opt_transitions);
+    gen_choices(opt_choices);
+    gen_junctions(opt_junctions);
+    no_of_forks = gen_forks(opt_forks);
+    gen_history(opt_history);
+
+    if (opt_forks && no_of_forks < opt_forks)
+        printf ("Warning: %u of %u forks, they need composites with -r 2 "
+                "or more\n", no_of_forks, opt_forks);
+
+    fp = open_output(prefix, name, ".xmi");
+
+    if (fp == NULL)
+        return -1;
+
+    write_xmi(fp, name);
+    fclose(fp);
+
+    fp = open_output(prefix, name, "_stubs.c");
+
+    if (fp == NULL)
+        return -1;
+
+    write_stubs(fp, name);
+    fclose(fp);
+
+    if (v)
+        printf ("o %u regions, %u states, %u transitions, %u guards\n",
+                no_of_regions, no_of_simple, no_of_transitions, no_of_guards);
+
+    return 0;
+}
@@ -19,18 +19,23 @@
 #include <ufsm.h>
 
 #include "output.h"
+#include "symbols.h"
 
 static struct ufsm_machine *root_machine;
 static uint32_t v = 0;
 static bool flag_strip = false;
+static bool flag_read_only = false;
+static bool flag_pure_guards = false;
 
-struct ufsmimport_connection_map {
-    char *id;
-    char *target_id;
-    struct ufsmimport_connection_map *next;
-};
-
-static struct ufsmimport_connection_map *conmap;
+/* Id to object tables. Machines are added in pass 1, regions, states and
+ * connection point references in pass 2, so every lookup of pass 3 takes
+ * constant time.
+ */
+static struct symbol_table machines_by_id;
+static struct symbol_table regions_by_id;
+static struct symbol_table states_by_id;
+static struct symbol_table conrefs_by_id;
+static struct symbol_table last_transition_by_region;
 
 static xmlChar *get_attr(xmlNode *n, const char* id)
 {
@@ -59,102 +64,73 @@ static bool is_type(xmlNode *n, const char *id)
 }
 
 
-static struct ufsm_machine * ufsmimport_get_machine(struct ufsm_machine *root,
-                                                    const char *id) 
+/* A trigger whose event is a uml:TimeEvent owned by the transition gets
+ * the name 'after(<when>)', or 'at(<when>)' for an absolute time event. The
+ * generator turns these into timers.
+ */
+static const char * time_event_name(xmlNode *t_node, xmlNode *trigger)
 {
-    if (id == NULL)
+    xmlChar *event = get_attr(trigger, "event");
+    char *result = NULL;
+
+    if (event == NULL)
         return NULL;
 
-    for (struct ufsm_machine *m = root; m; m = m->next) {
-        if (strcmp((char *) id, (char *) m->id) == 0)
-            return m;
-    }
-    return NULL;
-}
+    for (xmlNode *n = t_node->children; n && !result; n = n->next) {
+        xmlChar *id = get_attr(n, "id");
+
+        if (id && (strcmp((char *) id, (char *) event) == 0) &&
+            is_type(n, "uml:TimeEvent")) {
+            xmlChar *when = get_attr(n, "when");
+            xmlChar *relative = get_attr(n, "isRelative");
+            bool absolute = relative &&
+                            (strcmp((char *) relative, "false") == 0);
+
+            /* Without 'when' the name is expected to read after(..) */
+            if (when == NULL)
+                result = (char *) get_attr(n, "name");
+
+            if (when) {
+                result = malloc(strlen((char *) when) + 8);
+                sprintf(result, "%s(%s)", absolute ? "at" : "after",
+                                                        (char *) when);
+                xmlFree(when);
+            }
 
-static struct ufsm_region * _get_region(struct ufsm_region *r,
-                                        const char *id)
-{
-    struct ufsm_region *result = NULL;
- 
-    if (strcmp((char *) r->id, id) == 0)
-        return r;
+            if (relative)
+                xmlFree(relative);
+        }
 
-    if (!r->state)
-        return NULL;
+        if (id)
+            xmlFree(id);
+    }
 
-    for (struct ufsm_state *s = r->state; s; s = s->next) {
-        if (s->region)
-            result = _get_region(s->region, id);
+    xmlFree(event);
 
-        if (result)
-            return result;
-    }
-    
-    return NULL;
+    return result;
 }
 
-
-static struct ufsm_region * ufsmimport_get_region(struct ufsm_machine *root,
-                                                    const char *id) 
+static struct ufsm_machine * ufsmimport_get_machine(const char *id)
 {
-    struct ufsm_region *result = NULL;
-
-    if (id == NULL)
-        return NULL;
-
-    for (struct ufsm_machine *m = root; m; m = m->next) {
-        if (m->region)
-            result = _get_region(m->region, id);
-
-        if (result)
-            return result;
-    }
-    return NULL;
+    return symbol_get(&machines_by_id, id);
 }
 
-
-static struct ufsm_state * _get_state(struct ufsm_region *regions,
-                                      const char *id)
+static struct ufsm_region * ufsmimport_get_region(const char *id)
 {
-    struct ufsm_state *result = NULL;
-
-
-    for (struct ufsm_region *r = regions; r; r = r->next) {
-        if (r->state) {
-            for (struct ufsm_state *s = r->state; s; s = s->next) {
-                if (strcmp((char*) s->id, id) == 0)
-                    return s;
-
-                result = _get_state(s->region,id);
-
-                if (result)
-                    return result;
-
-            }
-        }
-    }
-    return NULL;
+    return symbol_get(&regions_by_id, id);
 }
 
-static struct ufsm_state * ufsmimport_get_state(struct ufsm_machine *root,
-                                                    const char *id) 
+/* A connection point reference stands for the state it refers to */
+static struct ufsm_state * ufsmimport_get_state(const char *id)
 {
-    struct ufsm_state *result = NULL;
-
-    for (struct ufsm_machine *m = root; m; m = m->next) {
-        if (m->region)
-            result = _get_state(m->region, id);
-
-        if (result)
-            return result;
-    }
+    struct ufsm_state *result = symbol_get(&states_by_id, id);
+    const char *target_id = NULL;
 
     if (result == NULL) {
-        for (struct ufsmimport_connection_map *cm = conmap; cm; cm = cm->next) {
-            if (strcmp(id, cm->id) == 0)
-                result = ufsmimport_get_state(root, cm->target_id);
-        }
+        target_id = symbol_get(&conrefs_by_id, id);
+
+        if (target_id)
+            result = ufsmimport_get_state(target_id);
     }
 
     return result;
@@ -180,6 +156,7 @@ static uint32_t parse_state(xmlNode *n, struct ufsm_machine *m,
         s->name = (const char *) get_attr(n, "name");
     
     s->id = (const char*) get_attr(n, "id");
+    symbol_add(&states_by_id, s->id, s);
     s->entry = NULL;
     s->exit = NULL;
     s->parent_region = r;
@@ -187,7 +164,7 @@ static uint32_t parse_state(xmlNode *n, struct ufsm_machine *m,
     if (v) printf ("    S %-25s %s %i\n",s->name,s->id, deep_history);
 
     if (get_attr(n,"submachine")) {
-        s->submachine = ufsmimport_get_machine(root_machine,
+        s->submachine = ufsmimport_get_machine(
                             (const char*) get_attr(n,"submachine"));   
         //if (s->submachine->region)
         //    s->submachine->region->parent_state = s;
@@ -246,21 +223,12 @@ static uint32_t parse_state(xmlNode *n, struct ufsm_machine *m,
         } else if(strcmp((char *) r_sub->name, "text") == 0) {
             /* Do nothing */
         } else if(strcmp((char *) r_sub->name, "connection") == 0) {
-            struct ufsmimport_connection_map * cm = NULL;
+            const char *cm_id = (const char *) get_attr(r_sub, "id");
+            char *cm_target_id = (char *) get_attr (r_sub->children->next, "idref");
 
-            if (conmap == NULL) {
-                conmap = malloc(sizeof(struct ufsmimport_connection_map));
-                bzero(conmap, sizeof(struct ufsmimport_connection_map));
-                cm = conmap;
-            } else {
-                conmap->next = malloc(sizeof(struct ufsmimport_connection_map));
-                bzero(conmap->next, sizeof(struct ufsmimport_connection_map));
-                cm = conmap->next;
-            }
-            cm->id = (char *) get_attr(r_sub, "id");
-            cm->target_id = (char *) get_attr (r_sub->children->next, "idref");
+            symbol_add(&conrefs_by_id, cm_id, cm_target_id);
             if (v)
-                printf (" Created connection reference %s -> %s\n", cm->id, cm->target_id);
+                printf (" Created connection reference %s -> %s\n", cm_id, cm_target_id);
     
         } else {
             printf ("Error: Unknown element in state definition: '%s'\n", r_sub->name);
@@ -278,40 +246,10 @@ static uint32_t parse_state(xmlNode *n, struct ufsm_machine *m,
 
 
 
-static struct ufsm_region * _state_belongs_to(struct ufsm_region *region,
-                                              struct ufsm_state *state)
-{
-    struct ufsm_region *result = NULL;
-
-    for (struct ufsm_region *r = region; r; r = r->next) {
-        for (struct ufsm_state *s = r->state; s; s = s->next) {
-            if (s == state)
-                return r;
-            if (s->region) {
-                result = _state_belongs_to(s->region, state);
-                if (result)
-                    return result;
-            }
-        
-        }
-    }
-    
-    return NULL;
-}
-
-static struct ufsm_region * state_belongs_to(struct ufsm_machine *machine,
-                                             struct ufsm_state *state)
+/* parse_state() links every state to the region it's in */
+static struct ufsm_region * state_belongs_to(struct ufsm_state *state)
 {
-    struct ufsm_region *result = NULL;
-
-    for (struct ufsm_machine *m = machine; m; m = m->next) {
-        result = _state_belongs_to(m->region, state);
-        if (result)
-            return result;
-
-    }
-
-    return NULL;
+    return state->parent_region;
 }
 
 static uint32_t parse_transition(xmlNode *n, struct ufsm_machine *m,
@@ -326,7 +264,7 @@ static uint32_t parse_transition(xmlNode *n, struct ufsm_machine *m,
 
         if (is_type(s_node, "uml:State")) {
             for (xmlNode *r_node = s_node->children; r_node; r_node = r_node->next) {
-                struct ufsm_region *region = ufsmimport_get_region(m, 
+                struct ufsm_region *region = ufsmimport_get_region(
                                         (const char*) get_attr(r_node,"id"));
                 if (region)
                     parse_transition(r_node, m, region);
@@ -339,10 +277,10 @@ static uint32_t parse_transition(xmlNode *n, struct ufsm_machine *m,
             t->id = (const char*) get_attr(s_node, "id");
             t->next = NULL;
             struct ufsm_state *src = ufsmimport_get_state(
-                                    m, (const char *) get_attr(s_node, "source"));
+                                    (const char *) get_attr(s_node, "source"));
 
             struct ufsm_state *dest = ufsmimport_get_state(
-                                    m, (const char *) get_attr(s_node, "target"));
+                                    (const char *) get_attr(s_node, "target"));
 
             t->source = src;
             t->dest = dest;
@@ -369,7 +307,10 @@ static uint32_t parse_transition(xmlNode *n, struct ufsm_machine *m,
                 if (is_type(trigger, "uml:Trigger")) 
                 {
                     u_trigger = malloc(sizeof(struct ufsm_trigger));
-                    u_trigger->name = (const char*) get_attr(trigger, "name");
+                    u_trigger->name = time_event_name(s_node, trigger);
+
+                    if (!u_trigger->name)
+                        u_trigger->name = (const char*) get_attr(trigger, "name");
                     u_trigger->next = u_trigger_last;
                     u_trigger_last = u_trigger;
                 } 
@@ -409,22 +350,18 @@ static uint32_t parse_transition(xmlNode *n, struct ufsm_machine *m,
             t->guard = guard_last;
             t->trigger = u_trigger_last;
             
-            struct ufsm_region *trans_region = state_belongs_to(m, src);
+            struct ufsm_region *trans_region = state_belongs_to(src);
+            struct symbol *tail = symbol_entry(
+                                &last_transition_by_region, trans_region->id);
 
-            if (trans_region->transition == NULL) {
+            if (trans_region->transition == NULL)
                 trans_region->transition = t;
-            } else {
-                struct ufsm_transition *tail = trans_region->transition;
-                do {
-                    if (tail->next == NULL) {
-                        tail->next = t;
-                        break;
-                    }
-                    tail = tail->next;                  
-                } while(tail);
-            }
+            else
+                ((struct ufsm_transition *) tail->value)->next = t;
 
-            if (v) printf ("   src belongs to %s\n", state_belongs_to(m, src)->name);
+            tail->value = t;
+
+            if (v) printf ("   src belongs to %s\n", trans_region->name);
             if (v) printf (" T  %-10s -> %-10s %s\n", src->name, 
                                                dest->name, 
                                                t->id);
@@ -446,6 +383,7 @@ static uint32_t parse_region(xmlNode *n, struct ufsm_machine *m,
 
     r->name = (const char *) get_attr(n, "name");
     r->id = (const char*) get_attr(n, "id");
+    symbol_add(&regions_by_id, r->id, r);
     r->has_history = has_deep_history;
 
     if (v) printf ("    R %-25s %s %i\n", r->name, r->id, deep_history);
@@ -544,6 +482,7 @@ static struct ufsm_machine * ufsmimport_pass1 (xmlNode *node)
             //m->next = m_last;
             m->id = (const char*) get_attr(n, "id");
             m->name = (const char*) get_attr(n, "name");
+            symbol_add(&machines_by_id, m->id, m);
             m_last = m;
             if (v) printf ("    M %-25s %s\n",m->name,m->id);
         }
@@ -567,7 +506,7 @@ static uint32_t ufsmimport_pass2 (xmlNode *node, struct ufsm_machine *machines)
                 r = malloc (sizeof(struct ufsm_region));
                 bzero (r, sizeof(struct ufsm_region));
                 r->next = NULL;
-                struct ufsm_machine  *mach = ufsmimport_get_machine(machines,
+                struct ufsm_machine  *mach = ufsmimport_get_machine(
                                             (const char*) get_attr(m, "id"));
                 mach->region = r;
                 r->parent_state = NULL;
@@ -596,7 +535,7 @@ static uint32_t ufsmimport_pass3 (xmlNode *node, struct ufsm_machine *machines)
     for (xmlNode *m = node; m; m = m->next) {
         for (xmlNode *n = m->children; n; n = n->next) {
             if (is_type(n, "uml:Region")) {
-                struct ufsm_region *region = ufsmimport_get_region(machines,
+                struct ufsm_region *region = ufsmimport_get_region(
                                             (const char*) get_attr(n,"id"));
                 
                 parse_transition(n, machines, region);
@@ -641,6 +580,8 @@ int main(int argc, char **argv)
         printf ("                              -v          - Verbose\n");
         printf ("                              -c prefix/  - Output prefix\n");
         printf ("                              -s          - Strip output\n");
+        printf ("                              -r          - Read-only definition\n");
+        printf ("                              -p          - Pure guards\n");
    
         exit(0);
     }
@@ -648,7 +589,7 @@ int main(int argc, char **argv)
     doc = xmlReadFile(argv[1], NULL, 0);
     output_name = argv[2];
 
-    while ((c = getopt(argc-2, argv+2, "svc:")) != -1) {
+    while ((c = getopt(argc-2, argv+2, "svrpc:")) != -1) {
         switch (c) {
             case 'c':
                 output_prefix = optarg;
@@ -659,6 +600,12 @@ int main(int argc, char **argv)
             case 's':
                 flag_strip = true;
             break;
+            case 'r':
+                flag_read_only = true;
+            break;
+            case 'p':
+                flag_pure_guards = true;
+            break;
             default:
                 abort();
         }
@@ -719,7 +666,8 @@ int main(int argc, char **argv)
     }
     
     if (v) printf ("Output prefix: %s\n", output_prefix);
-    ufsm_gen_output(root_machine, output_name, output_prefix,v,flag_strip);
+    ufsm_gen_output(root_machine, output_name, output_prefix, v, flag_strip,
+                    flag_read_only, flag_pure_guards);
 
     return err;
 }
@@ -0,0 +1,76 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* Prints a dump written by ufsm_trace_dump() as the ufsm_debug table */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ufsm.h>
+
+static void print_line(const char *line, void *ctx)
+{
+    fprintf((FILE *) ctx, "%s\n", line);
+}
+
+int main(int argc, char **argv)
+{
+    bool timestamps = false;
+    const char *input = NULL;
+    uint8_t *buf = NULL;
+    long len = 0;
+    FILE *fp = NULL;
+    uint32_t err = UFSM_OK;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0)
+            timestamps = true;
+        else
+            input = argv[i];
+    }
+
+    if (input == NULL) {
+        printf ("Usage: ufsmtrace <dump> [options]\n");
+        printf ("                 -t          - Print timestamps\n");
+        exit(0);
+    }
+
+    fp = fopen(input, "rb");
+
+    if (fp == NULL) {
+        printf ("Error: Could not open file '%s'\n", input);
+        return -1;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    len = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    buf = malloc(len > 0 ? len : 1);
+
+    if (fread(buf, 1, len, fp) != (size_t) len) {
+        printf ("Error: Could not read '%s'\n", input);
+        fclose(fp);
+        return -1;
+    }
+
+    fclose(fp);
+
+    err = ufsm_trace_decode(buf, (uint32_t) len, timestamps,
+                            &print_line, stdout);
+
+    if (err != UFSM_OK) {
+        printf ("Error: '%s' is not a valid trace dump\n", input);
+        return -1;
+    }
+
+    free(buf);
+
+    return 0;
+}
@@ -9,6 +9,12 @@
 
 #include "ufsm.h"
 
+#ifdef __GNUC__
+    #define ufsm_store_release(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#else
+    #define ufsm_store_release(p, v) (*(p) = (v))
+#endif
+
 const char *ufsm_transition_kinds[] =
 {
     "External",
@@ -45,6 +51,9 @@ const char *ufsm_errors[] =
     "Queue empty",
     "Queue full",
     "Machine has terminated",
+    "Too many states",
+    "Buffer too small",
+    "No storage left",
 };
 
 inline static bool ufsm_state_is(struct ufsm_state *s, uint32_t kind)
@@ -52,51 +61,394 @@ inline static bool ufsm_state_is(struct ufsm_state *s, uint32_t kind)
     return s ? (s->kind == kind) : false;
 }
 
-static ufsm_status_t ufsm_make_transition(struct ufsm_machine *m,
-                                          struct ufsm_transition *t,
-                                          struct ufsm_region *r);
+/* Runtime state is either stored in the machine definition itself or, when
+ * the context processes an instance, in the instance data block.
+ * */
+inline static struct ufsm_state *ufsm_get_current(struct ufsm_context *ctx,
+                                                  struct ufsm_region *r)
+{
+    struct ufsm_machine *m = ctx->m;
 
-static ufsm_status_t ufsm_process_completion(struct ufsm_machine *m,
-                                             struct ufsm_state *s)
+    if (ctx->instance)
+        return m->states[ctx->instance->data[r->index]];
+
+    return r->current;
+}
+
+inline static struct ufsm_state *ufsm_get_history(struct ufsm_context *ctx,
+                                                  struct ufsm_region *r)
 {
-    ufsm_status_t err = UFSM_OK;
+    struct ufsm_machine *m = ctx->m;
 
-    for (struct ufsm_transition *t = s->parent_region->transition;
-                                                t; t = t->next)
+    if (ctx->instance)
+        return m->states[ctx->instance->data[m->no_of_regions + r->index]];
+
+    return r->history;
+}
+
+/* Marks a state that has been current or history since the last reset,
+ * see ufsm_reset_machine().
+ * */
+inline static void ufsm_touch(struct ufsm_machine *m, struct ufsm_state *s)
+{
+    uint32_t *touched = &m->data[2 * UFSM_STATE_WORDS(m->no_of_states)];
+
+    if (s)
+        touched[s->index / 32] |= (1u << (s->index % 32));
+}
+
+inline static void ufsm_set_history(struct ufsm_context *ctx,
+                                    struct ufsm_region *r,
+                                    struct ufsm_state *s)
+{
+    struct ufsm_machine *m = ctx->m;
+
+    if (ctx->instance)
+    {
+        ctx->instance->data[m->no_of_regions + r->index] = s ? s->index : 0;
+    }
+    else
+    {
+        r->history = s;
+        ufsm_touch(m, s);
+    }
+}
+
+inline static bool ufsm_bit_get(const uint32_t *bits, uint32_t n)
+{
+    return (bits[n / 32] & (1u << (n % 32))) != 0;
+}
+
+inline static void ufsm_bit_set(uint32_t *bits, uint32_t n, bool value)
+{
+    if (value)
+        bits[n / 32] |= (1u << (n % 32));
+    else
+        bits[n / 32] &= ~(1u << (n % 32));
+}
+
+inline static uint32_t ufsm_highest_bit(uint32_t bits)
+{
+#ifdef __GNUC__
+    return 31 - __builtin_clz(bits);
+#else
+    uint32_t n = 0;
+
+    while (bits >>= 1)
+        n++;
+
+    return n;
+#endif
+}
+
+inline static uint32_t *ufsm_get_cant_exit_bits(struct ufsm_context *ctx)
+{
+    struct ufsm_machine *m = ctx->m;
+
+    if (ctx->instance)
+        return &ctx->instance->data[2 * m->no_of_regions];
+
+    return m->data;
+}
+
+inline static uint32_t *ufsm_get_active_bits(struct ufsm_context *ctx)
+{
+    struct ufsm_machine *m = ctx->m;
+
+    if (ctx->instance)
+        return &ctx->instance->data[2 * m->no_of_regions +
+                                    UFSM_STATE_WORDS(m->no_of_states)];
+
+    return &m->data[UFSM_STATE_WORDS(m->no_of_states)];
+}
+
+inline static uint32_t *ufsm_get_snapshot_bits(struct ufsm_context *ctx)
+{
+    struct ufsm_machine *m = ctx->m;
+
+    if (ctx->instance)
+        return &ctx->instance->data[2 * m->no_of_regions +
+                                    2 * UFSM_STATE_WORDS(m->no_of_states)];
+
+    return &m->data[3 * UFSM_STATE_WORDS(m->no_of_states)];
+}
+
+inline static bool ufsm_get_cant_exit(struct ufsm_context *ctx,
+                                      struct ufsm_state *s)
+{
+    return ufsm_bit_get(ufsm_get_cant_exit_bits(ctx), s->index);
+}
+
+inline static void ufsm_set_cant_exit(struct ufsm_context *ctx,
+                                      struct ufsm_state *s,
+                                      bool cant_exit)
+{
+    ufsm_bit_set(ufsm_get_cant_exit_bits(ctx), s->index, cant_exit);
+}
+
+/* Sets or clears the active bit of 's' and of every state below it that is
+ * reachable through the current state of the nested regions.
+ * */
+static void ufsm_set_active(struct ufsm_context *ctx,
+                            struct ufsm_state *s,
+                            bool active)
+{
+    uint32_t *bits = ufsm_get_active_bits(ctx);
+    struct ufsm_region *r = s->region;
+
+    ufsm_bit_set(bits, s->index, active);
+
+    while (r)
     {
-        if ((t->source == s) && (t->trigger == NULL))
+        struct ufsm_state *current = ufsm_get_current(ctx, r);
+
+        if (current)
         {
-            err = ufsm_make_transition(m, t, s->parent_region);
-            break;
+            ufsm_bit_set(bits, current->index, active);
+
+            if (current->region)
+            {
+                r = current->region;
+                continue;
+            }
         }
+
+        while (r && !r->next)
+            r = (r->parent_state == s) ? NULL : r->parent_state->parent_region;
+
+        if (r)
+            r = r->next;
     }
+}
 
-    return err;
+/* The active bits track the states that can be reached from the top
+ * regions through the current state of each region. Stale current states
+ * below a state that has been left are not part of the configuration.
+ * */
+inline static void ufsm_set_current(struct ufsm_context *ctx,
+                                    struct ufsm_region *r,
+                                    struct ufsm_state *s)
+{
+    struct ufsm_machine *m = ctx->m;
+    struct ufsm_state *old = ufsm_get_current(ctx, r);
+
+    if (ctx->instance)
+    {
+        ctx->instance->data[r->index] = s ? s->index : 0;
+    }
+    else
+    {
+        r->current = s;
+        ufsm_touch(m, s);
+    }
+
+    if ((old == s) || (r->parent_state &&
+        !ufsm_bit_get(ufsm_get_active_bits(ctx), r->parent_state->index)))
+        return;
+
+    if (old)
+        ufsm_set_active(ctx, old, false);
+
+    if (s)
+        ufsm_set_active(ctx, s, true);
+}
+
+inline static struct ufsm_queue *ufsm_get_context_queue(
+                                                struct ufsm_context *ctx)
+{
+    if (ctx->instance)
+        return ctx->instance->queue;
+
+    return &ctx->m->queue;
+}
+
+inline static struct ufsm_queue *ufsm_get_defer_queue(struct ufsm_context *ctx)
+{
+    if (ctx->instance)
+        return ctx->instance->defer_queue;
+
+    return &ctx->m->defer_queue;
+}
+
+inline static bool ufsm_get_terminated(struct ufsm_context *ctx)
+{
+    if (ctx->instance)
+        return ctx->instance->terminated;
+
+    return ctx->m->terminated;
+}
+
+inline static void ufsm_set_terminated(struct ufsm_context *ctx,
+                                     bool terminated)
+{
+    if (ctx->instance)
+        ctx->instance->terminated = terminated;
+    else
+        ctx->m->terminated = terminated;
+}
+
+/* Metrics are recorded for the machine and for instances that keep their
+ * own state entry times, see ufsm_metrics.c.
+ * */
+inline static struct ufsm_metrics *ufsm_get_metrics(struct ufsm_context *ctx)
+{
+    if (ctx->instance && !ctx->instance->entered)
+        return NULL;
+
+    return ctx->m->metrics;
+}
+
+/* Writes one record to a trace ring, see ufsm_trace.c. The ring may be
+ * dumped from another thread, which reads up to 'head'.
+ * */
+inline static void ufsm_trace_put(struct ufsm_trace *t,
+                                  enum ufsm_trace_op op,
+                                  const void *ref,
+                                  bool result)
+{
+    struct ufsm_trace_record *r =
+                        &t->records[t->head & (t->no_of_records - 1)];
+
+    r->time = t->clock ? t->clock() : 0;
+    r->ref = (uint64_t) (uintptr_t) ref;
+    r->ev = t->ev;
+    r->op = (uint16_t) op;
+    r->result = result;
+
+    ufsm_store_release(&t->head, t->head + 1);
+}
+
+/* Records a step to the ring of the context. Inlined at every traced
+ * point, so a context without a ring pays one pointer test and the record
+ * is written without a call.
+ * */
+inline static void ufsm_trace(struct ufsm_context *ctx,
+                              enum ufsm_trace_op op,
+                              const void *ref,
+                              bool result)
+{
+    if (ctx->trace)
+        ufsm_trace_put(ctx->trace, op, ref, result);
+}
+
+/* Forgets the results of pure guards, called when a step starts */
+inline static void ufsm_clear_guard_cache(struct ufsm_context *ctx)
+{
+    ctx->no_of_cached_guards = 0;
+    ctx->guards_passed = NULL;
 }
 
-static ufsm_status_t ufsm_completion_handler(struct ufsm_machine *m,
+static ufsm_status_t ufsm_make_transition(struct ufsm_context *ctx,
+                                          struct ufsm_transition *t,
+                                          struct ufsm_region *r);
+
+static ufsm_status_t ufsm_process_completion(struct ufsm_context *ctx,
                                              struct ufsm_state *s)
+{
+    if (!s->completion)
+        return UFSM_OK;
+
+    ufsm_clear_guard_cache(ctx);
+
+    return ufsm_make_transition(ctx, s->completion, s->parent_region);
+}
+
+/* Completion events have their own lane, the completion stack, which is
+ * drained at the end of every step. They never take a slot in the event
+ * queue. A do-activity that completes between steps only wakes a consumer
+ * sleeping in ufsm_run(), the completion is processed before the next
+ * event.
+ * */
+static ufsm_status_t ufsm_push_completion(struct ufsm_context *ctx,
+                                          struct ufsm_state *s)
 {
     ufsm_status_t err = UFSM_OK;
+    struct ufsm_queue *q = ufsm_get_context_queue(ctx);
 
-    for (struct ufsm_transition *t = s->parent_region->transition;
-                                            t; t = t->next)
+    if (!s->completion)
+        return UFSM_OK;
+
+    err = ufsm_stack_push(&ctx->completion_stack, s);
+
+    if ((err == UFSM_OK) && !ctx->event && q && q->wake)
+        q->wake(q);
+
+    return err;
+}
+
+/* Do-activities are started with the context that entered their state and
+ * complete on it, 'c->m' is the machine.
+ * */
+static uint32_t ufsm_completion_handler(struct ufsm_context *c,
+                                        struct ufsm_state *s)
+{
+    return ufsm_push_completion(c, s);
+}
+
+inline static struct ufsm_timer *ufsm_get_timers(struct ufsm_context *ctx)
+{
+    struct ufsm_machine *m = ctx->m;
+
+    if (ctx->instance)
+        return ctx->instance->timers;
+
+    return m->timers;
+}
+
+/* Time events are only armed on machines that have a timing wheel and
+ * timers, and post to the queue of the machine or instance that armed them.
+ * */
+static void ufsm_arm_time_events(struct ufsm_context *ctx,
+                                 struct ufsm_state *s)
+{
+    struct ufsm_machine *m = ctx->m;
+    struct ufsm_timer *timers = ufsm_get_timers(ctx);
+    struct ufsm_queue *q = ufsm_get_context_queue(ctx);
+
+    if (!m->wheel || !timers || !q)
+        return;
+
+    for (struct ufsm_time_event *te = s->time_events; te; te = te->next)
     {
-        if ((t->source == s) && (t->trigger == NULL))
-        {
-            err = ufsm_stack_push(&m->completion_stack, s);
-            if (err == UFSM_OK)
-                err = ufsm_queue_put(&m->queue, UFSM_COMPLETION_EVENT);
+        struct ufsm_timer *t = &timers[te->index];
 
-        }
+        t->queue = q;
+        t->ev = te->ev;
+
+        if (te->absolute)
+            ufsm_timer_arm_at(m->wheel, t, te->ticks);
+        else
+            ufsm_timer_arm(m->wheel, t, te->ticks);
     }
+}
 
-    return err;
+static void ufsm_cancel_time_events(struct ufsm_context *ctx,
+                                    struct ufsm_state *s)
+{
+    struct ufsm_machine *m = ctx->m;
+    struct ufsm_timer *timers = ufsm_get_timers(ctx);
+
+    if (!m->wheel || !timers)
+        return;
+
+    for (struct ufsm_time_event *te = s->time_events; te; te = te->next)
+        ufsm_timer_cancel(m->wheel, &timers[te->index]);
+}
+
+static void ufsm_cancel_timers(struct ufsm_machine *m,
+                               struct ufsm_timer *timers)
+{
+    if (!m->wheel || !timers)
+        return;
+
+    for (uint32_t n = 0; n < m->no_of_timers; n++)
+        ufsm_timer_cancel(m->wheel, &timers[n]);
 }
 
-static ufsm_status_t ufsm_enter_state(struct ufsm_machine *m,
+static ufsm_status_t ufsm_enter_state(struct ufsm_context *ctx,
                                       struct ufsm_state *s)
 {
+    struct ufsm_machine *m = ctx->m;
     ufsm_status_t err = UFSM_OK;
 
     bool state_completed = false;
@@ -104,29 +456,41 @@ static ufsm_status_t ufsm_enter_state(struct ufsm_machine *m,
     if (m->debug_enter_state)
         m->debug_enter_state(s);
 
+    ufsm_trace(ctx, UFSM_TRACE_ENTER_STATE, s, 0);
+
+    if (ufsm_get_metrics(ctx))
+        ufsm_metrics_enter_state(m->metrics, ctx->instance, s);
+
     for (struct ufsm_entry_exit *e = s->entry; e; e = e->next)
     {
         if (m->debug_entry_exit)
             m->debug_entry_exit(e);
+
+        ufsm_trace(ctx, UFSM_TRACE_ENTRY_EXIT, e, 0);
+
         e->f();
     }
 
+    ufsm_arm_time_events(ctx, s);
+
     if (s->kind == UFSM_STATE_SIMPLE)
         state_completed = true;
 
     for (struct ufsm_doact *d = s->doact; d; d = d->next)
     {
         state_completed = false;
-        d->f_start(m,s,&ufsm_completion_handler);
+        d->f_start(ctx, s, &ufsm_completion_handler);
     }
 
     if (state_completed)
     {
         for (struct ufsm_region *r = s->region; r; r = r->next)
         {
-            if (r->current)
+            struct ufsm_state *current = ufsm_get_current(ctx, r);
+
+            if (current)
             {
-                if (r->current->kind != UFSM_STATE_FINAL)
+                if (current->kind != UFSM_STATE_FINAL)
                     state_completed = false;
             }
             else
@@ -136,22 +500,31 @@ static ufsm_status_t ufsm_enter_state(struct ufsm_machine *m,
         }
 
         if (state_completed)
-            ufsm_completion_handler(m, s);
+            ufsm_push_completion(ctx, s);
 
     }
 
     return err;
 }
 
-inline static void ufsm_leave_state(struct ufsm_machine *m,
+inline static void ufsm_leave_state(struct ufsm_context *ctx,
                                     struct ufsm_state *s)
 {
+    struct ufsm_machine *m = ctx->m;
+
     if (m->debug_exit_state)
         m->debug_exit_state(s);
 
+    ufsm_trace(ctx, UFSM_TRACE_EXIT_STATE, s, 0);
+
     if (s == NULL)
         return;
 
+    if (ufsm_get_metrics(ctx))
+        ufsm_metrics_exit_state(m->metrics, ctx->instance, s);
+
+    ufsm_cancel_time_events(ctx, s);
+
     for (struct ufsm_doact *d = s->doact; d; d = d->next)
         d->f_stop();
 
@@ -159,16 +532,11 @@ inline static void ufsm_leave_state(struct ufsm_machine *m,
     {
         if (m->debug_entry_exit)
             m->debug_entry_exit(e);
-        e->f();
-    }
-}
 
+        ufsm_trace(ctx, UFSM_TRACE_ENTRY_EXIT, e, 0);
 
-inline static void ufsm_set_current_state(struct ufsm_region *r,
-                                          struct ufsm_state *s)
-{
-    if (r)
-        r->current = s;
+        e->f();
+    }
 }
 
 inline static struct ufsm_transition
@@ -189,42 +557,84 @@ inline static struct ufsm_transition
     return NULL;
 }
 
-inline static bool ufsm_test_guards(struct ufsm_machine *m,
-                                    struct ufsm_transition *t)
+/* Pure guards are looked up on their function, since the same function can
+ * be used by several guards. When the cache is full, guards are evaluated
+ * as usual.
+ * */
+static bool ufsm_eval_guard(struct ufsm_context *ctx, struct ufsm_guard *g)
 {
-    bool result = true;
+    struct ufsm_machine *m = ctx->m;
+    bool result = false;
 
-    for (struct ufsm_guard *g = t->guard; g; g = g->next)
+    if (g->pure)
     {
-        bool guard_result = g->f();
+        for (uint32_t i = 0; i < ctx->no_of_cached_guards; i++)
+        {
+            if (ctx->guard_cache[i] != g->f)
+                continue;
+
+            if (m->debug_guard_cached)
+                m->debug_guard_cached(g, ctx->guard_cache_result[i]);
+
+            ufsm_trace(ctx, UFSM_TRACE_GUARD_CACHED, g,
+                               ctx->guard_cache_result[i]);
+
+            return ctx->guard_cache_result[i];
+        }
+    }
+
+    result = g->f();
 
-        if (m->debug_guard)
-            m->debug_guard(g, guard_result);
+    if (m->debug_guard)
+        m->debug_guard(g, result);
 
-        if (!guard_result)
-            result = false;
+    ufsm_trace(ctx, UFSM_TRACE_GUARD, g, result);
+
+    if (g->pure && (ctx->no_of_cached_guards < UFSM_GUARD_CACHE_SIZE))
+    {
+        ctx->guard_cache[ctx->no_of_cached_guards] = g->f;
+        ctx->guard_cache_result[ctx->no_of_cached_guards] = result;
+        ctx->no_of_cached_guards++;
     }
 
     return result;
 }
 
-inline static void ufsm_execute_actions(struct ufsm_machine *m,
+/* Guards are evaluated in order until one of them fails */
+inline static bool ufsm_test_guards(struct ufsm_context *ctx,
+                                    struct ufsm_transition *t)
+{
+    for (struct ufsm_guard *g = t->guard; g; g = g->next)
+    {
+        if (!ufsm_eval_guard(ctx, g))
+            return false;
+    }
+
+    return true;
+}
+
+inline static void ufsm_execute_actions(struct ufsm_context *ctx,
                                         struct ufsm_transition *t)
 {
+    struct ufsm_machine *m = ctx->m;
+
     for (struct ufsm_action *a = t->action; a; a = a->next)
     {
         if (m->debug_action)
             m->debug_action(a);
 
+        ufsm_trace(ctx, UFSM_TRACE_ACTION, a, 0);
+
         a->f();
     }
 }
 
-inline static void ufsm_update_history(struct ufsm_state *s)
+inline static void ufsm_update_history(struct ufsm_context *ctx,
+                                       struct ufsm_state *s)
 {
     if (s->parent_region)
         if (s->parent_region->has_history)
-            s->parent_region->history = s;
+            ufsm_set_history(ctx, s->parent_region, s);
 }
 
 static struct ufsm_transition *ufsm_get_first_state (struct ufsm_region *region)
@@ -243,10 +653,11 @@ static struct ufsm_transition *ufsm_get_first_state (struct ufsm_region *region)
     return NULL;
 }
 
-static ufsm_status_t ufsm_enter_parent_states(struct ufsm_machine *m,
+static ufsm_status_t ufsm_enter_parent_states(struct ufsm_context *ctx,
                                               struct ufsm_region *ancestor,
                                               struct ufsm_region *r)
 {
+    struct ufsm_machine *m = ctx->m;
     ufsm_status_t err = UFSM_OK;
     uint32_t c = 0;
 
@@ -256,7 +667,7 @@ static ufsm_status_t ufsm_enter_parent_states(struct ufsm_machine *m,
     if (!ancestor)
         return UFSM_OK;
 
-    err = ufsm_stack_push(&m->stack, r);
+    err = ufsm_stack_push(&ctx->stack, r);
     c++;
 
     while (ps && (r != ancestor) && (err == UFSM_OK))
@@ -266,7 +677,7 @@ static ufsm_status_t ufsm_enter_parent_states(struct ufsm_machine *m,
         if ((pr == ancestor) || (pr == NULL))
             break;
 
-        err = ufsm_stack_push(&m->stack, pr);
+        err = ufsm_stack_push(&ctx->stack, pr);
 
         c++;
 
@@ -275,7 +686,7 @@ static ufsm_status_t ufsm_enter_parent_states(struct ufsm_machine *m,
 
     for (uint32_t i = 0; i < c; i++)
     {
-        err = ufsm_stack_pop(&m->stack, (void **) &pr);
+        err = ufsm_stack_pop(&ctx->stack, (void **) &pr);
 
         if (err != UFSM_OK)
             break;
@@ -283,20 +694,46 @@ static ufsm_status_t ufsm_enter_parent_states(struct ufsm_machine *m,
         if (m->debug_enter_region)
             m->debug_enter_region(pr);
 
+        ufsm_trace(ctx, UFSM_TRACE_ENTER_REGION, pr, 0);
+
         ps = pr->parent_state;
 
-        if (ps && ps->parent_region->current != ps)
+        if (ps && ufsm_get_current(ctx, ps->parent_region) != ps)
         {
-            ufsm_set_current_state (ps->parent_region, ps);
+            ufsm_set_current(ctx, ps->parent_region, ps);
 
             if (pr != ancestor)
-                ufsm_enter_state(m, ps);
+                ufsm_enter_state(ctx, ps);
         }
     }
 
     return err;
 }
 
+static void ufsm_enter_path(struct ufsm_context *ctx,
+                            struct ufsm_transition *t)
+{
+    struct ufsm_machine *m = ctx->m;
+
+    for (struct ufsm_region **pr = t->enter_path; *pr; pr++)
+    {
+        struct ufsm_state *ps = (*pr)->parent_state;
+
+        if (m->debug_enter_region)
+            m->debug_enter_region(*pr);
+
+        ufsm_trace(ctx, UFSM_TRACE_ENTER_REGION, *pr, 0);
+
+        if (ps && ufsm_get_current(ctx, ps->parent_region) != ps)
+        {
+            ufsm_set_current(ctx, ps->parent_region, ps);
+
+            if (*pr != t->lca)
+                ufsm_enter_state(ctx, ps);
+        }
+    }
+}
+
 static struct ufsm_region * ufsm_least_common_ancestor(struct ufsm_region *r1,
                                                        struct ufsm_region *r2)
 {
@@ -327,12 +764,13 @@ static struct ufsm_region * ufsm_least_common_ancestor(struct ufsm_region *r1,
     return NULL;
 }
 
-static ufsm_status_t ufsm_leave_parent_states(struct ufsm_machine *m,
+static ufsm_status_t ufsm_leave_parent_states(struct ufsm_context *ctx,
                                               struct ufsm_state *src,
                                               struct ufsm_state *dest,
                                               struct ufsm_region **lca,
                                               struct ufsm_region **act)
 {
+    struct ufsm_machine *m = ctx->m;
     struct ufsm_region *rl = NULL;
     struct ufsm_region *ancestor = NULL;
     bool states_to_leave = true;
@@ -359,10 +797,12 @@ static ufsm_status_t ufsm_leave_parent_states(struct ufsm_machine *m,
         if (m->debug_leave_region)
             m->debug_leave_region(rl);
 
+        ufsm_trace(ctx, UFSM_TRACE_LEAVE_REGION, rl, 0);
+
         if (rl->parent_state)
         {
-            ufsm_leave_state(m, rl->parent_state);
-            rl->current = NULL;
+            ufsm_leave_state(ctx, rl->parent_state);
+            ufsm_set_current(ctx, rl, NULL);
 
             if (rl->parent_state->parent_region)
             {
@@ -381,35 +821,57 @@ static ufsm_status_t ufsm_leave_parent_states(struct ufsm_machine *m,
     return UFSM_OK;
 }
 
-inline static ufsm_status_t ufsm_push_sr_pair(struct ufsm_machine *m,
+static void ufsm_leave_path(struct ufsm_context *ctx,
+                            struct ufsm_transition *t,
+                            struct ufsm_region **lca,
+                            struct ufsm_region **act)
+{
+    struct ufsm_machine *m = ctx->m;
+
+    *act = t->dest->parent_region;
+    *lca = t->lca;
+
+    for (struct ufsm_region **rl = t->exit_path; *rl; rl++)
+    {
+        if (m->debug_leave_region)
+            m->debug_leave_region(*rl);
+
+        ufsm_trace(ctx, UFSM_TRACE_LEAVE_REGION, *rl, 0);
+
+        ufsm_leave_state(ctx, (*rl)->parent_state);
+        ufsm_set_current(ctx, *rl, NULL);
+    }
+}
+
+inline static ufsm_status_t ufsm_push_sr_pair(struct ufsm_context *ctx,
                                               struct ufsm_region *r,
                                               struct ufsm_state *s)
 {
     ufsm_status_t err = UFSM_OK;
 
-    err = ufsm_stack_push (&m->stack, r);
+    err = ufsm_stack_push (&ctx->stack, r);
 
     if (err == UFSM_OK)
-        err = ufsm_stack_push (&m->stack, s);
+        err = ufsm_stack_push (&ctx->stack, s);
 
     return err;
 }
 
-inline static ufsm_status_t ufsm_pop_sr_pair(struct ufsm_machine *m,
+inline static ufsm_status_t ufsm_pop_sr_pair(struct ufsm_context *ctx,
                                              struct ufsm_region **r,
                                              struct ufsm_state **s)
 {
     ufsm_status_t err = UFSM_OK;
 
-    err = ufsm_stack_pop (&m->stack, (void **) s);
+    err = ufsm_stack_pop (&ctx->stack, (void **) s);
 
     if (err == UFSM_OK)
-        err = ufsm_stack_pop (&m->stack, (void **) r);
+        err = ufsm_stack_pop (&ctx->stack, (void **) r);
 
     return err;
 }
 
-static ufsm_status_t ufsm_find_active_regions(struct ufsm_machine *m,
+static ufsm_status_t ufsm_find_active_regions(struct ufsm_context *ctx,
                                               struct ufsm_region *r_in,
                                               uint32_t *c)
 {
@@ -422,12 +884,12 @@ process_next_region:
 
     for (; r; r = r->next)
     {
-        s = r->current;
+        s = ufsm_get_current(ctx, r);
 
         if (s)
         {
-            s->cant_exit = false;
-            err = ufsm_push_sr_pair(m, r, s);
+            ufsm_set_cant_exit(ctx, s, false);
+            err = ufsm_push_sr_pair(ctx, r, s);
 
             if (err != UFSM_OK)
                 break;
@@ -436,7 +898,7 @@ process_next_region:
 
             if (s->region)
             {
-                err = ufsm_stack_push(&m->stack2, s->region);
+                err = ufsm_stack_push(&ctx->stack2, s->region);
                 region_counter++;
             }
         }
@@ -445,7 +907,7 @@ process_next_region:
     if (region_counter)
     {
         region_counter--;
-        err = ufsm_stack_pop(&m->stack2, (void **)&r);
+        err = ufsm_stack_pop(&ctx->stack2, (void **)&r);
 
         if (err != UFSM_OK)
             return err;
@@ -456,7 +918,7 @@ process_next_region:
     return err;
 }
 
-static ufsm_status_t ufsm_leave_nested_states(struct ufsm_machine *m,
+static ufsm_status_t ufsm_leave_nested_states(struct ufsm_context *ctx,
                                               struct ufsm_state *s)
 {
     struct ufsm_region *r = NULL;
@@ -464,45 +926,49 @@ static ufsm_status_t ufsm_leave_nested_states(struct ufsm_machine *m,
     uint32_t c = 0;
     ufsm_status_t err = UFSM_OK;
 
-    if (!s->region || !s->region->current)
+    if (!s->region || !ufsm_get_current(ctx, s->region))
         return UFSM_OK;
 
-    err = ufsm_find_active_regions(m, s->region, &c);
+    err = ufsm_find_active_regions(ctx, s->region, &c);
 
     if (err != UFSM_OK)
         return err;
 
     for (uint32_t i = 0; i < c; i++)
     {
-        err = ufsm_pop_sr_pair(m, &r, &s2);
+        err = ufsm_pop_sr_pair(ctx, &r, &s2);
 
         if (err != UFSM_OK)
             break;
 
-        ufsm_leave_state(m, s2);
+        ufsm_leave_state(ctx, s2);
 
         if (r->has_history)
-            r->history = r->current;
+            ufsm_set_history(ctx, r, s2);
 
-        r->current = NULL;
+        ufsm_set_current(ctx, r, NULL);
     }
 
     return err;
 }
 
-static ufsm_status_t ufsm_init_region_history(struct ufsm_machine *m,
+static ufsm_status_t ufsm_init_region_history(struct ufsm_context *ctx,
                                               struct ufsm_region *regions)
 {
+    struct ufsm_machine *m = ctx->m;
     ufsm_status_t err = UFSM_ERROR_NO_INIT_REGION;
+    struct ufsm_state *history = ufsm_get_history(ctx, regions);
 
-    if (regions->has_history && regions->history)
+    if (regions->has_history && history)
     {
-        regions->current = regions->history;
+        ufsm_set_current(ctx, regions, history);
 
         if (m->debug_enter_region)
             m->debug_enter_region(regions);
 
-        ufsm_enter_state(m, regions->current);
+        ufsm_trace(ctx, UFSM_TRACE_ENTER_REGION, regions, 0);
+
+        ufsm_enter_state(ctx, history);
         err = UFSM_OK;
     }
 
@@ -510,35 +976,35 @@ static ufsm_status_t ufsm_init_region_history(struct ufsm_machine *m,
 }
 
 
-inline static ufsm_status_t ufsm_push_rt_pair(struct ufsm_machine *m,
+inline static ufsm_status_t ufsm_push_rt_pair(struct ufsm_context *ctx,
                                               struct ufsm_region *r,
                                               struct ufsm_transition *t)
 {
     ufsm_status_t err = UFSM_OK;
 
-    err = ufsm_stack_push (&m->stack, r);
+    err = ufsm_stack_push (&ctx->stack, r);
 
     if (err == UFSM_OK)
-        err = ufsm_stack_push (&m->stack, t);
+        err = ufsm_stack_push (&ctx->stack, t);
 
     return err;
 }
 
-inline static ufsm_status_t ufsm_pop_rt_pair(struct ufsm_machine *m,
+inline static ufsm_status_t ufsm_pop_rt_pair(struct ufsm_context *ctx,
                                              struct ufsm_region **r,
                                              struct ufsm_transition **t)
 {
     ufsm_status_t err = UFSM_OK;
 
-    err = ufsm_stack_pop (&m->stack, (void **) t);
+    err = ufsm_stack_pop (&ctx->stack, (void **) t);
 
     if (err == UFSM_OK)
-        err = ufsm_stack_pop (&m->stack, (void **) r);
+        err = ufsm_stack_pop (&ctx->stack, (void **) r);
 
     return err;
 }
 
-static ufsm_status_t ufsm_process_regions(struct ufsm_machine *m,
+static ufsm_status_t ufsm_process_regions(struct ufsm_context *ctx,
                                           struct ufsm_state *dest,
                                           uint32_t *c)
 {
@@ -550,9 +1016,9 @@ static ufsm_status_t ufsm_process_regions(struct ufsm_machine *m,
         struct ufsm_transition *init_t = ufsm_get_first_state(s_r);
 
         if (init_t == NULL) {
-            err = ufsm_init_region_history(m, s_r);
+            err = ufsm_init_region_history(ctx, s_r);
         } else {
-            err = ufsm_push_rt_pair(m, s_r, init_t);
+            err = ufsm_push_rt_pair(ctx, s_r, init_t);
             *c = *c + 1;
         }
 
@@ -563,7 +1029,7 @@ static ufsm_status_t ufsm_process_regions(struct ufsm_machine *m,
     return err;
 }
 
-static ufsm_status_t ufsm_process_entry_exit_points(struct ufsm_machine *m,
+static ufsm_status_t ufsm_process_entry_exit_points(struct ufsm_context *ctx,
                                                     struct ufsm_state *dest,
                                                     uint32_t *c)
 {
@@ -574,7 +1040,7 @@ static ufsm_status_t ufsm_process_entry_exit_points(struct ufsm_machine *m,
     {
         if (te->source == dest)
         {
-            err = ufsm_push_rt_pair(m, te->dest->parent_region, te);
+            err = ufsm_push_rt_pair(ctx, te->dest->parent_region, te);
 
             if (err != UFSM_OK)
                 break;
@@ -586,7 +1052,7 @@ static ufsm_status_t ufsm_process_entry_exit_points(struct ufsm_machine *m,
     return err;
 }
 
-static ufsm_status_t ufsm_process_final_state(struct ufsm_machine *m,
+static ufsm_status_t ufsm_process_final_state(struct ufsm_context *ctx,
                                               struct ufsm_region *act_region,
                                               struct ufsm_state *dest,
                                               uint32_t *c)
@@ -595,15 +1061,17 @@ static ufsm_status_t ufsm_process_final_state(struct ufsm_machine *m,
     bool super_exit = false;
     struct ufsm_state *parent_state = act_region->parent_state;
 
-    act_region->current = dest;
+    ufsm_set_current(ctx, act_region, dest);
 
     if (dest->kind == UFSM_STATE_FINAL && parent_state)
     {
         super_exit = true;
         for (struct ufsm_region *ar = parent_state->region; ar; ar = ar->next)
         {
-            if (ar->current)
-                if (ar->current->kind != UFSM_STATE_FINAL)
+            struct ufsm_state *current = ufsm_get_current(ctx, ar);
+
+            if (current)
+                if (current->kind != UFSM_STATE_FINAL)
                     super_exit = false;
         }
     }
@@ -615,7 +1083,7 @@ static ufsm_status_t ufsm_process_final_state(struct ufsm_machine *m,
                                     parent_state->parent_region->transition;
 
         for (struct ufsm_region *ar = parent_region; ar; ar = ar->next)
-            ufsm_leave_state(m, ar->current);
+            ufsm_leave_state(ctx, ufsm_get_current(ctx, ar));
 
         for (struct ufsm_transition *tf = transition; tf; tf = tf->next)
         {
@@ -623,9 +1091,9 @@ static ufsm_status_t ufsm_process_final_state(struct ufsm_machine *m,
                 tf->source == parent_state)
             {
 
-                parent_state->cant_exit = false;
+                ufsm_set_cant_exit(ctx, parent_state, false);
 
-                err = ufsm_push_rt_pair(m, parent_state->parent_region, tf);
+                err = ufsm_push_rt_pair(ctx, parent_state->parent_region, tf);
 
                 if (err != UFSM_OK)
                     break;
@@ -638,7 +1106,7 @@ static ufsm_status_t ufsm_process_final_state(struct ufsm_machine *m,
     return err;
 }
 
-static ufsm_status_t ufsm_process_fork(struct ufsm_machine *m,
+static ufsm_status_t ufsm_process_fork(struct ufsm_context *ctx,
                                        struct ufsm_region *act_region,
                                        struct ufsm_state *dest,
                                        uint32_t *c)
@@ -650,7 +1118,7 @@ static ufsm_status_t ufsm_process_fork(struct ufsm_machine *m,
     {
         if (tf->source == dest)
         {
-            err = ufsm_push_rt_pair(m, act_region, tf);
+            err = ufsm_push_rt_pair(ctx, act_region, tf);
 
             if (err != UFSM_OK)
                 break;
@@ -662,7 +1130,7 @@ static ufsm_status_t ufsm_process_fork(struct ufsm_machine *m,
     return err;
 }
 
-static ufsm_status_t ufsm_process_join(struct ufsm_machine *m,
+static ufsm_status_t ufsm_process_join(struct ufsm_context *ctx,
                                        struct ufsm_region *act_region,
                                        struct ufsm_state *src,
                                        struct ufsm_state *dest,
@@ -677,10 +1145,10 @@ static ufsm_status_t ufsm_process_join(struct ufsm_machine *m,
 
     orth_region = src->parent_region->parent_state->region;
 
-    src->parent_region->current = dest;
+    ufsm_set_current(ctx, src->parent_region, dest);
     for (struct ufsm_region *dr = orth_region; dr; dr = dr->next)
     {
-        if (dr->current != dest)
+        if (ufsm_get_current(ctx, dr) != dest)
             exec_join = false;
     }
 
@@ -692,7 +1160,7 @@ static ufsm_status_t ufsm_process_join(struct ufsm_machine *m,
         {
             if (dt->source == dest)
             {
-                err = ufsm_push_rt_pair(m, dest->parent_region, dt);
+                err = ufsm_push_rt_pair(ctx, dest->parent_region, dt);
 
                 if (err != UFSM_OK)
                     break;
@@ -704,7 +1172,7 @@ static ufsm_status_t ufsm_process_join(struct ufsm_machine *m,
     return err;
 }
 
-static ufsm_status_t ufsm_process_choice(struct ufsm_machine *m,
+static ufsm_status_t ufsm_process_choice(struct ufsm_context *ctx,
                                          struct ufsm_region *act_region,
                                          struct ufsm_state *dest,
                                          uint32_t *c)
@@ -721,12 +1189,15 @@ static ufsm_status_t ufsm_process_choice(struct ufsm_machine *m,
         {
             if (dt->guard)
             {
-                if (ufsm_test_guards(m, dt))
+                if (ufsm_test_guards(ctx, dt))
                 {
-                    err = ufsm_push_rt_pair(m, act_region, dt);
+                    err = ufsm_push_rt_pair(ctx, act_region, dt);
 
                     if (err != UFSM_OK)
                         break;
+
+                    /* Popped next, the guards need not run again */
+                    ctx->guards_passed = dt;
                     made_transition = true;
                     *c = *c + 1;
                     break;
@@ -738,14 +1209,14 @@ static ufsm_status_t ufsm_process_choice(struct ufsm_machine *m,
     }
 
     if (!made_transition && t_default && err == UFSM_OK) {
-        err = ufsm_push_rt_pair(m, act_region, t_default);
+        err = ufsm_push_rt_pair(ctx, act_region, t_default);
         *c = *c + 1;
     }
 
     return err;
 }
 
-static ufsm_status_t ufsm_process_junction(struct ufsm_machine *m,
+static ufsm_status_t ufsm_process_junction(struct ufsm_context *ctx,
                                            struct ufsm_state *dest,
                                            uint32_t *c)
 {
@@ -756,7 +1227,7 @@ static ufsm_status_t ufsm_process_junction(struct ufsm_machine *m,
     {
         if (t->source == dest)
         {
-            err = ufsm_push_rt_pair(m, dest->parent_region, t);
+            err = ufsm_push_rt_pair(ctx, dest->parent_region, t);
             *c = *c + 1;
         }
     }
@@ -764,52 +1235,207 @@ static ufsm_status_t ufsm_process_junction(struct ufsm_machine *m,
     return err;
 }
 
-static void ufsm_update_defer_queue(struct ufsm_machine *m)
+static struct ufsm_transition **ufsm_find_dispatch(struct ufsm_dispatch *d,
+                                                   uint32_t n,
+                                                   uint32_t ev);
+static bool ufsm_transition_has_trigger(struct ufsm_machine *m,
+                                        struct ufsm_transition *t,
+                                        uint32_t ev);
+
+static bool ufsm_state_defers(struct ufsm_machine *m,
+                              struct ufsm_state *s,
+                              uint32_t ev)
 {
-    ufsm_status_t err = UFSM_OK;
-    uint32_t ev;
+    if (s->dispatch)
+    {
+        struct ufsm_transition **tl = ufsm_find_dispatch(s->dispatch,
+                                                         s->no_of_dispatch,
+                                                         ev);
 
-    do {
-        err = ufsm_queue_get(&m->defer_queue, &ev);
-        if (err == UFSM_OK)
-            err = ufsm_queue_put(&m->queue, ev);
-    } while(err == UFSM_OK);
+        for (; tl && *tl; tl++)
+        {
+            if ((*tl)->defer)
+                return true;
+        }
+
+        return false;
+    }
 
+    for (struct ufsm_transition *t = s->parent_region->transition;
+                                                        t; t = t->next)
+    {
+        if (t->defer && (t->source == s) &&
+            ufsm_transition_has_trigger(m, t, ev))
+            return true;
+    }
 
+    return false;
 }
 
-static void ufsm_load_history(struct ufsm_state *src,
-                              struct ufsm_state **dest)
+/* Region after 'r' in a depth first walk that only descends into current
+ * states, or NULL when the walk is done.
+ * */
+static struct ufsm_region * ufsm_next_region(struct ufsm_region *r)
 {
+    while (r && !r->next)
+        r = r->parent_state ? r->parent_state->parent_region : NULL;
 
-    if (ufsm_state_is(src, UFSM_STATE_SHALLOW_HISTORY) ||
-        ufsm_state_is(src, UFSM_STATE_DEEP_HISTORY))
-    {
-        if (src->parent_region->history)
-            *dest = src->parent_region->history;
-    }
-
+    return r ? r->next : NULL;
 }
 
-static ufsm_status_t ufsm_make_transition(struct ufsm_machine *m,
-                                          struct ufsm_transition *t,
-                                          struct ufsm_region *r)
+/* Walks the active configuration from the top regions, starting over when
+ * 's' is NULL. Only parent pointers are used, not the stacks, since this
+ * runs in the middle of a step.
+ * */
+static struct ufsm_state * ufsm_next_active(struct ufsm_context *ctx,
+                                            struct ufsm_state *s)
 {
-    ufsm_status_t err = UFSM_OK;
-    struct ufsm_state *dest = t->dest;
-    struct ufsm_state *src = NULL;
-    struct ufsm_region *act_region = r;
-    struct ufsm_transition *act_t = NULL;
-    struct ufsm_region *lca_region = NULL;
-    uint32_t transition_count = 1;
+    struct ufsm_machine *m = ctx->m;
+    struct ufsm_region *r = m->region;
 
-    ufsm_update_defer_queue(m);
+    if (s)
+        r = s->region ? s->region : ufsm_next_region(s->parent_region);
 
-    err = ufsm_push_rt_pair (m, r, t);
+    for (; r; r = ufsm_next_region(r))
+    {
+        struct ufsm_state *current = ufsm_get_current(ctx, r);
+
+        if (current)
+            return current;
+    }
+
+    return NULL;
+}
+
+/* True if a state in the active configuration defers 'ev' */
+static bool ufsm_event_deferred(struct ufsm_context *ctx, uint32_t ev)
+{
+    struct ufsm_machine *m = ctx->m;
+
+    for (struct ufsm_state *s = ufsm_next_active(ctx, NULL); s;
+                                              s = ufsm_next_active(ctx, s))
+    {
+        if (ufsm_state_defers(m, s, ev))
+            return true;
+    }
+
+    return false;
+}
+
+/* The events below UFSM_TRIGGER_MASK_BITS that the active configuration
+ * defers.
+ * */
+static uint32_t ufsm_deferred_mask(struct ufsm_context *ctx)
+{
+    uint32_t mask = 0;
+
+    for (struct ufsm_state *s = ufsm_next_active(ctx, NULL); s;
+                                              s = ufsm_next_active(ctx, s))
+        mask |= s->defer_mask;
+
+    return mask;
+}
+
+/* Locked queues keep a count, the lock-free kinds are counted by peeking.
+ * Only called by the consumer.
+ * */
+static uint32_t ufsm_queue_count(struct ufsm_queue *q)
+{
+    struct ufsm_event e;
+    uint32_t count = 0;
+
+    if (q->kind == UFSM_QUEUE_LOCKED)
+        return q->s;
+
+    while (ufsm_queue_peek_event(q, count, &e) == UFSM_OK)
+        count++;
+
+    return count;
+}
+
+/* Moves the deferred events that the new configuration no longer defers to
+ * the event queue, each to its own lane. Both the released and the
+ * remaining events keep their relative order. The deferred events of the
+ * new configuration are collected once, only events with larger ids walk
+ * the configuration again.
+ * */
+static void ufsm_update_defer_queue(struct ufsm_context *ctx)
+{
+    ufsm_status_t err = UFSM_OK;
+    struct ufsm_queue *q = ufsm_get_context_queue(ctx);
+    struct ufsm_queue *dq = ufsm_get_defer_queue(ctx);
+    struct ufsm_event e;
+    uint32_t no_of_deferred = 0;
+    uint32_t deferred_mask = 0;
+    bool deferred = false;
+
+    if (!q || !dq)
+        return;
+
+    no_of_deferred = ufsm_queue_count(dq);
+
+    if (!no_of_deferred)
+        return;
+
+    deferred_mask = ufsm_deferred_mask(ctx);
+
+    for (uint32_t i = 0; i < no_of_deferred; i++)
+    {
+        if (ufsm_queue_get_event(dq, &e) != UFSM_OK)
+            break;
+
+        if (e.id < UFSM_TRIGGER_MASK_BITS)
+            deferred = (deferred_mask & (1UL << e.id)) != 0;
+        else
+            deferred = ufsm_event_deferred(ctx, e.id);
+
+        if (deferred)
+            err = ufsm_queue_put_event(dq, &e);
+        else
+            err = ufsm_queue_put_event(q, &e);
+
+        /* The event is dropped */
+        if (err != UFSM_OK && e.release)
+            e.release(&e);
+    }
+}
+
+static void ufsm_load_history(struct ufsm_context *ctx,
+                              struct ufsm_state *src,
+                              struct ufsm_state **dest)
+{
+
+    if (ufsm_state_is(src, UFSM_STATE_SHALLOW_HISTORY) ||
+        ufsm_state_is(src, UFSM_STATE_DEEP_HISTORY))
+    {
+        struct ufsm_state *history = ufsm_get_history(ctx, src->parent_region);
+
+        if (history)
+            *dest = history;
+    }
+
+}
+
+static ufsm_status_t ufsm_make_transition(struct ufsm_context *ctx,
+                                          struct ufsm_transition *t,
+                                          struct ufsm_region *r)
+{
+    struct ufsm_machine *m = ctx->m;
+    ufsm_status_t err = UFSM_OK;
+    struct ufsm_state *dest = t->dest;
+    struct ufsm_state *src = NULL;
+    struct ufsm_region *act_region = r;
+    struct ufsm_transition *act_t = NULL;
+    struct ufsm_region *lca_region = NULL;
+    uint32_t transition_count = 1;
+    bool precomputed = false;
+    bool guards_passed = false;
+
+    err = ufsm_push_rt_pair (ctx, r, t);
 
     while (transition_count && (err == UFSM_OK))
     {
-        err = ufsm_pop_rt_pair(m, &act_region, &act_t);
+        err = ufsm_pop_rt_pair(ctx, &act_region, &act_t);
 
         if (err != UFSM_OK)
             break;
@@ -819,44 +1445,65 @@ static ufsm_status_t ufsm_make_transition(struct ufsm_machine *m,
         src = act_t->source;
         dest = act_t->dest;
 
-        ufsm_load_history(src, &dest);
+        ufsm_load_history(ctx, src, &dest);
 
-        if (!ufsm_test_guards(m, act_t))
+        /* Generated transitions between regions carry their exit and entry
+         * paths. Joins and restored history states take the runtime path.
+         * */
+        precomputed = act_t->lca && (dest == act_t->dest) &&
+                      (dest->kind != UFSM_STATE_JOIN);
+
+        guards_passed = (act_t == ctx->guards_passed);
+        ctx->guards_passed = NULL;
+
+        if (!guards_passed && !ufsm_test_guards(ctx, act_t))
         {
             err = UFSM_ERROR_EVENT_NOT_PROCESSED;
             break;
         }
 
-        if (act_t->source->cant_exit)
+        if (ufsm_get_cant_exit(ctx, act_t->source))
             continue;
 
         if (m->debug_transition)
             m->debug_transition(act_t);
 
+        ufsm_trace(ctx, UFSM_TRACE_TRANSITION, act_t, 0);
+
+        if (ufsm_get_metrics(ctx))
+            ufsm_metrics_transition(m->metrics, act_t);
+
         if (t->kind == UFSM_TRANSITION_EXTERNAL)
         {
             /* If we are in a composite state make sure to
              *  exit all nested states
              **/
 
-            ufsm_leave_nested_states(m, src);
-            ufsm_leave_state(m, act_t->source);
+            ufsm_leave_nested_states(ctx, src);
+            ufsm_leave_state(ctx, act_t->source);
 
             /* For compound transitions parents must be exited and entered
              * in the correct order.
              * */
-            err = ufsm_leave_parent_states(m, src, dest, &lca_region,
+            if (precomputed)
+                ufsm_leave_path(ctx, act_t, &lca_region, &act_region);
+            else
+                err = ufsm_leave_parent_states(ctx, src, dest, &lca_region,
                                                              &act_region);
             if (err != UFSM_OK)
                 break;
         }
 
-        ufsm_execute_actions(m, act_t);
+        ufsm_execute_actions(ctx, act_t);
 
         if ((t->kind == UFSM_TRANSITION_EXTERNAL) &&
             (src->parent_region != dest->parent_region))
         {
-            err = ufsm_enter_parent_states(m, lca_region, dest->parent_region);
+            if (precomputed)
+                ufsm_enter_path(ctx, act_t);
+            else
+                err = ufsm_enter_parent_states(ctx, lca_region,
+                                                    dest->parent_region);
 
             if (err != UFSM_OK)
                 break;
@@ -869,44 +1516,45 @@ static ufsm_status_t ufsm_make_transition(struct ufsm_machine *m,
             case UFSM_STATE_SHALLOW_HISTORY:
             case UFSM_STATE_DEEP_HISTORY:
             case UFSM_STATE_SIMPLE:
-                ufsm_update_history(dest);
-                act_region->current = dest;
+                ufsm_update_history(ctx, dest);
+                ufsm_set_current(ctx, act_region, dest);
                 if (t->kind == UFSM_TRANSITION_EXTERNAL)
                 {
-                    ufsm_enter_state(m, dest);
-                    err = ufsm_process_regions(m, dest, &transition_count);
+                    ufsm_enter_state(ctx, dest);
+                    err = ufsm_process_regions(ctx, dest, &transition_count);
                 }
             break;
             case UFSM_STATE_ENTRY_POINT:
             case UFSM_STATE_EXIT_POINT:
-                err = ufsm_process_entry_exit_points(m,dest,&transition_count);
+                err = ufsm_process_entry_exit_points(ctx, dest,
+                                                        &transition_count);
             break;
             case UFSM_STATE_FINAL:
                 /* If all regions in this state have reached 'Final'
                  *  the superstate should exit if there is an anonymous
                  *  transition to a final state.
                  * */
-                err = ufsm_process_final_state(m, act_region, dest,
+                err = ufsm_process_final_state(ctx, act_region, dest,
                                                         &transition_count);
             break;
             case UFSM_STATE_FORK:
-                err = ufsm_process_fork (m, act_region, dest,
+                err = ufsm_process_fork (ctx, act_region, dest,
                                                         &transition_count);
             break;
             case UFSM_STATE_JOIN:
-                err  = ufsm_process_join(m, act_region, src, dest,
+                err  = ufsm_process_join(ctx, act_region, src, dest,
                                                         &transition_count);
 
             break;
             case UFSM_STATE_CHOICE:
-                err = ufsm_process_choice(m, act_region, dest,
+                err = ufsm_process_choice(ctx, act_region, dest,
                                                         &transition_count);
             break;
             case UFSM_STATE_JUNCTION:
-                err = ufsm_process_junction(m, dest, &transition_count);
+                err = ufsm_process_junction(ctx, dest, &transition_count);
             break;
             case UFSM_STATE_TERMINATE:
-                m->terminated = true;
+                ufsm_set_terminated(ctx, true);
                 return UFSM_OK;
             break;
             default:
@@ -915,218 +1563,1583 @@ static ufsm_status_t ufsm_make_transition(struct ufsm_machine *m,
         }
     }
 
+    /* Internal transitions don't change the configuration */
+    if (t->kind != UFSM_TRANSITION_INTERNAL)
+        ufsm_update_defer_queue(ctx);
+
     return err;
 }
 
 
-static ufsm_status_t ufsm_process_completion_events(struct ufsm_machine *m)
+static ufsm_status_t ufsm_process_completion_events(struct ufsm_context *ctx)
 {
     ufsm_status_t err = UFSM_OK;
     struct ufsm_state *completed_state;
 
 
-    while (ufsm_stack_pop(&m->completion_stack,
+    while (ufsm_stack_pop(&ctx->completion_stack,
                             (void **) &completed_state) == UFSM_OK)
     {
-        err = ufsm_process_completion(m, completed_state);
+        err = ufsm_process_completion(ctx, completed_state);
         if (err != UFSM_OK)
             return err;
     }
     return err;
 }
 
-ufsm_status_t ufsm_init_machine(struct ufsm_machine *m)
+static ufsm_status_t ufsm_reset_stacks(struct ufsm_context *ctx)
+{
+    if (!ctx->stack.data || !ctx->stack2.data || !ctx->completion_stack.data)
+        return UFSM_ERROR;
+
+    ctx->stack.pos = 0;
+    ctx->stack2.pos = 0;
+    ctx->completion_stack.pos = 0;
+
+    return UFSM_OK;
+}
+
+/* Generated machines bring their own stacks, the others take them from
+ * their storage the first time they are initialized.
+ * */
+static ufsm_status_t ufsm_init_stacks(struct ufsm_machine *m)
 {
+    struct ufsm_context *ctx = &m->context;
+    struct ufsm_storage *st = m->storage;
+
+    ctx->m = m;
+
+    if (st && !ctx->stack.data)
+        ufsm_stack_init(&(ctx->stack), UFSM_STACK_SIZE, st->stack_data);
+    if (st && !ctx->stack2.data)
+        ufsm_stack_init(&(ctx->stack2), UFSM_STACK_SIZE, st->stack_data2);
+    if (st && !ctx->completion_stack.data)
+        ufsm_stack_init(&(ctx->completion_stack),
+                        UFSM_COMPLETION_STACK_SIZE, st->completion_stack_data);
+
+    return ufsm_reset_stacks(ctx);
+}
+
+static ufsm_status_t ufsm_enter_initial_states(struct ufsm_context *ctx)
+{
+    struct ufsm_machine *m = ctx->m;
     ufsm_status_t err = UFSM_OK;
 
-    ufsm_stack_init(&(m->stack), UFSM_STACK_SIZE, m->stack_data);
-    ufsm_stack_init(&(m->stack2), UFSM_STACK_SIZE, m->stack_data2);
-    ufsm_stack_init(&(m->completion_stack),
-                    UFSM_COMPLETION_STACK_SIZE, m->completion_stack_data);
-    ufsm_queue_init(&(m->queue), UFSM_QUEUE_SIZE, m->queue_data);
-    ufsm_queue_init(&(m->defer_queue), UFSM_DEFER_QUEUE_SIZE,
-                                            m->defer_queue_data);
-    m->terminated = false;
+    ufsm_set_terminated(ctx, false);
+    ufsm_clear_guard_cache(ctx);
 
     for (struct ufsm_region *r = m->region; r; r = r->next)
     {
         struct ufsm_transition *rt = ufsm_get_first_state(r);
-        err = ufsm_make_transition(m, rt, r);
+        err = ufsm_make_transition(ctx, rt, r);
 
         if (err != UFSM_OK)
             break;
     }
 
     if (err == UFSM_OK)
-        err = ufsm_process_completion_events(m);
+        err = ufsm_process_completion_events(ctx);
 
     return err;
 }
 
-
-static bool ufsm_transition_has_trigger(struct ufsm_machine *m,
-                                        struct ufsm_transition *t,
-                                        uint32_t ev)
+/* The trigger ids of 't' that fit in a defer mask */
+static uint32_t ufsm_defer_mask(struct ufsm_transition *t)
 {
-	for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next)
-	{
-		if (ev == tt->trigger)
-			return true;
-	}
+    uint32_t mask = 0;
 
-	return false;
+    if (t->trigger_mask)
+        return t->trigger_mask;
+
+    if (t->trigger_ids)
+    {
+        for (uint32_t i = 0; i < t->no_of_triggers; i++)
+            if (t->trigger_ids[i] < UFSM_TRIGGER_MASK_BITS)
+                mask |= (1UL << t->trigger_ids[i]);
+
+        return mask;
+    }
+
+    for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next)
+    {
+        if (tt->trigger < UFSM_TRIGGER_MASK_BITS)
+            mask |= (1UL << tt->trigger);
+    }
+
+    return mask;
 }
 
-static bool ufsm_transition(struct ufsm_machine *m, struct ufsm_region *r,
-                            int32_t ev)
+/* Numbers the transitions in 'r' and fills in the trigger mask of those
+ * whose triggers all fit in it, others keep matching on the trigger list.
+ * Points each state to its first completion transition and collects the
+ * events it defers.
+ * */
+static void ufsm_index_transitions(struct ufsm_machine *m,
+                                   struct ufsm_region *r)
 {
-    bool event_consumed = false;
-    ufsm_status_t err = UFSM_OK;
-    struct ufsm_state *current_state = r->current;
-
     for (struct ufsm_transition *t = r->transition; t; t = t->next)
     {
-        if (t->defer && ufsm_transition_has_trigger(m,t,ev)
-                                && (t->source == r->current))
-        {
-            err = ufsm_queue_put(&m->defer_queue, ev);
+        uint32_t mask = 0;
 
-            if (err != UFSM_OK)
-                break;
+        t->index = ++m->no_of_transitions;
 
-        }
-        else if (ufsm_transition_has_trigger(m,t,ev)
-                            && (t->source == current_state))
-        {
-            uint32_t e = ufsm_make_transition(m, t, r);
+        if (t->defer)
+            t->source->defer_mask |= ufsm_defer_mask(t);
 
-            struct ufsm_region *r2 = r;
+        if (t->trigger_mask || t->trigger_ids)
+            continue;
 
-            while (r2 && (ev != -1) && e == UFSM_OK)
-            {
-                if (r2->parent_state)
-                {
-                    r2->parent_state->cant_exit = true;
-                    r2 = r2->parent_state->parent_region;
-                }
-                else
-                    r2 = NULL;
-            }
+        if (!t->trigger)
+        {
+            if (!t->source->completion)
+                t->source->completion = t;
 
-            event_consumed = true;
+            continue;
+        }
 
-            if (e == UFSM_OK)
+        for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next)
+        {
+            if (tt->trigger >= UFSM_TRIGGER_MASK_BITS)
             {
-                if (!r->next)
-                    break;
+                mask = 0;
+                break;
             }
 
+            mask |= (1UL << tt->trigger);
         }
-    }
 
-    return event_consumed;
+        t->trigger_mask = mask;
+    }
 }
 
-
-ufsm_status_t ufsm_process (struct ufsm_machine *m, int32_t ev)
+/* Numbers the regions and states of a hand written machine the same way
+ * ufsmimport does, links nested regions to their parent state and builds
+ * the trigger masks and completion pointers.
+ * */
+static ufsm_status_t ufsm_index_machine(struct ufsm_machine *m)
 {
     ufsm_status_t err = UFSM_OK;
-    uint32_t region_count = 0;
-    struct ufsm_region *region = NULL;
-    struct ufsm_state *s = NULL;
-    bool event_consumed = false;
+    struct ufsm_region *regions = m->region;
+    uint32_t region_counter = 0;
 
-    if (m->terminated)
-        return UFSM_ERROR_MACHINE_TERMINATED;
+    m->no_of_regions = 0;
+    m->no_of_states = 0;
+    m->no_of_transitions = 0;
 
-    ufsm_process_completion_events(m);
+    while (err == UFSM_OK)
+    {
+        for (struct ufsm_region *r = regions; r; r = r->next)
+        {
+            r->index = m->no_of_regions++;
+            ufsm_index_transitions(m, r);
 
-    if (ev == -1)
-        return UFSM_OK;
+            for (struct ufsm_state *s = r->state; s; s = s->next)
+            {
+                s->index = ++m->no_of_states;
 
-    if (m->debug_event)
-        m->debug_event(ev);
+                if (!s->region)
+                    continue;
 
-    ufsm_find_active_regions(m,m->region, &region_count);
+                for (struct ufsm_region *sr = s->region; sr; sr = sr->next)
+                    if (!sr->parent_state)
+                        sr->parent_state = s;
 
-    for (uint32_t i = 0; i < region_count; i++)
-    {
-        err = ufsm_pop_sr_pair(m, &region, &s);
+                err = ufsm_stack_push(&m->context.stack2, s->region);
 
-        if (err != UFSM_OK)
-            break;
+                if (err != UFSM_OK)
+                    break;
 
-        /* First ensure that the active state has not
-         * changed
-         * */
-        if (region->current == s)
-        {
-            if (ufsm_transition (m, region, ev))
-                event_consumed = true;
+                region_counter++;
+            }
+
+            if (err != UFSM_OK)
+                break;
         }
-    }
 
-    if (!event_consumed && err == UFSM_OK)
-        err = UFSM_ERROR_EVENT_NOT_PROCESSED;
+        if (!region_counter || err != UFSM_OK)
+            break;
+
+        region_counter--;
+        err = ufsm_stack_pop(&m->context.stack2, (void **) &regions);
+    }
 
     return err;
 }
 
+#if UFSM_DEFAULT_STORAGES > 0
+static struct ufsm_storage ufsm_default_storage[UFSM_DEFAULT_STORAGES];
+static uint32_t ufsm_no_of_default_storages;
+#endif
 
-static ufsm_status_t ufsm_reset_region(struct ufsm_machine *m,
-                                       struct ufsm_region *regions)
+/* Machines that bring neither stacks nor storage get a default storage,
+ * which they keep from then on.
+ * */
+static ufsm_status_t ufsm_take_default_storage(struct ufsm_machine *m)
+{
+    if (m->storage || m->context.stack.data)
+        return UFSM_OK;
+
+#if UFSM_DEFAULT_STORAGES > 0
+    if (ufsm_no_of_default_storages < UFSM_DEFAULT_STORAGES)
+    {
+        m->storage = &ufsm_default_storage[ufsm_no_of_default_storages++];
+        return UFSM_OK;
+    }
+#endif
+
+    return UFSM_ERROR_NO_STORAGE;
+}
+
+/* The regions of a read-only definition can't hold the current state, so
+ * it can only run as instances.
+ * */
+ufsm_status_t ufsm_init_machine(struct ufsm_machine *m)
 {
     ufsm_status_t err = UFSM_OK;
-    struct ufsm_region *r = NULL;
-    uint32_t regions_count = 1;
 
-    err = ufsm_stack_push(&m->stack, regions);
+    if (m->read_only)
+        return UFSM_ERROR;
+
+    err = ufsm_take_default_storage(m);
 
     if (err != UFSM_OK)
         return err;
 
-    while (regions_count)
+    err = ufsm_init_stacks(m);
+
+    if (err != UFSM_OK)
+        return err;
+
+    if (m->storage && !m->queue.events)
     {
-        err = ufsm_stack_pop(&m->stack, (void **) &r);
+        m->queue.events = m->storage->queue_data;
+        m->queue.no_of_elements = UFSM_QUEUE_SIZE;
+    }
 
-        if (err != UFSM_OK)
-            break;
+    if (m->storage && !m->defer_queue.events)
+    {
+        m->defer_queue.events = m->storage->defer_queue_data;
+        m->defer_queue.no_of_elements = UFSM_DEFER_QUEUE_SIZE;
+    }
 
-        r->history = NULL;
-        r->current = NULL;
+    /* A lock-free queue may already have producers on other threads and
+     * is left as it is. Machines that defer no events have no defer queue.
+     * */
+    if (m->queue.kind == UFSM_QUEUE_LOCKED)
+        ufsm_queue_init_events(&(m->queue), m->queue.no_of_elements,
+                                            m->queue.events);
 
-        for (struct ufsm_state *s = r->state; s; s = s->next)
-        {
-            for (struct ufsm_region *sr = s->region; sr; sr = sr->next)
-            {
-                err = ufsm_stack_push(&m->stack, sr);
+    ufsm_queue_init_events(&(m->defer_queue), m->defer_queue.no_of_elements,
+                                              m->defer_queue.events);
 
-                if (err != UFSM_OK)
-                    break;
+    if (!m->states && !m->no_of_states)
+        err = ufsm_index_machine(m);
 
-                regions_count++;
-            }
+    if (err != UFSM_OK)
+        return err;
 
-            if (err != UFSM_OK)
-                break;
+    if (m->storage && !m->data)
+    {
+        if (m->no_of_states > UFSM_MAX_STATES)
+            return UFSM_ERROR_TOO_MANY_STATES;
+
+        m->data = m->storage->data;
+    }
+
+    if (!m->data)
+        return UFSM_ERROR;
+
+    return ufsm_enter_initial_states(&m->context);
+}
+
+
+static bool ufsm_transition_has_trigger(struct ufsm_machine *m,
+                                        struct ufsm_transition *t,
+                                        uint32_t ev)
+{
+    if (t->trigger_mask)
+        return (ev < UFSM_TRIGGER_MASK_BITS) &&
+               (t->trigger_mask & (1UL << ev));
+
+    if (t->trigger_ids)
+    {
+        uint32_t low = 0;
+        uint32_t high = t->no_of_triggers;
+
+        while (low < high)
+        {
+            uint32_t mid = low + (high - low) / 2;
+
+            if (t->trigger_ids[mid] == ev)
+                return true;
+            else if (t->trigger_ids[mid] < ev)
+                low = mid + 1;
+            else
+                high = mid;
         }
 
+        return false;
     }
-    return err;
+
+	for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next)
+	{
+		if (ev == tt->trigger)
+			return true;
+	}
+
+	return false;
 }
 
-ufsm_status_t ufsm_reset_machine(struct ufsm_machine *m)
+static struct ufsm_transition **ufsm_find_dispatch(struct ufsm_dispatch *d,
+                                                   uint32_t n,
+                                                   uint32_t ev)
 {
-    if (m->debug_reset)
-        m->debug_reset(m);
+    uint32_t low = 0;
+    uint32_t high = n;
 
-    for (struct ufsm_region *r = m->region; r; r = r->next)
-        ufsm_reset_region(m, r);
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
 
-    return UFSM_OK;
+        if (d[mid].ev == ev)
+            return d[mid].transition;
+        else if (d[mid].ev < ev)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return NULL;
 }
 
-struct ufsm_queue * ufsm_get_queue(struct ufsm_machine *m)
+/* Returns true when no further transitions should be tried in region 'r' */
+static bool ufsm_try_transition(struct ufsm_context *ctx,
+                                struct ufsm_region *r,
+                                struct ufsm_transition *t,
+                                int32_t ev,
+                                bool *event_consumed)
 {
-    return &m->queue;
+    struct ufsm_machine *m = ctx->m;
+    ufsm_status_t err = UFSM_OK;
+
+    if (t->defer && (t->source == ufsm_get_current(ctx, r)))
+    {
+        struct ufsm_queue *dq = ufsm_get_defer_queue(ctx);
+
+        /* The event record, and with it the payload, is owned by the defer
+         * queue from now on. It is only stored once even if several
+         * regions defer it.
+         * */
+        if (ctx->event_deferred)
+            return false;
+
+        err = dq ? ufsm_queue_put_event(dq, ctx->event) : UFSM_ERROR_QUEUE_FULL;
+
+        if (err == UFSM_OK)
+            ctx->event_deferred = true;
+
+        return (err != UFSM_OK);
+    }
+
+    err = ufsm_make_transition(ctx, t, r);
+
+    /* Flat machines stop at the first transition that fires, so the
+     * ancestors never have to be blocked.
+     * */
+    struct ufsm_region *r2 = m->flat ? NULL : r;
+
+    while (r2 && (ev != -1) && err == UFSM_OK)
+    {
+        if (r2->parent_state)
+        {
+            ufsm_set_cant_exit(ctx, r2->parent_state, true);
+            r2 = r2->parent_state->parent_region;
+        }
+        else
+            r2 = NULL;
+    }
+
+    *event_consumed = true;
+
+    return ((err == UFSM_OK) && !r->next);
+}
+
+static bool ufsm_transition(struct ufsm_context *ctx, struct ufsm_region *r,
+                            int32_t ev)
+{
+    struct ufsm_machine *m = ctx->m;
+    bool event_consumed = false;
+    struct ufsm_state *current_state = ufsm_get_current(ctx, r);
+
+    /* Generated machines carry a dispatch index on each state which lists
+     * the candidate transitions for an event directly. Hand written
+     * machines without an index fall back to scanning the region.
+     * */
+    if (current_state->dispatch)
+    {
+        struct ufsm_transition **tl =
+                    ufsm_find_dispatch(current_state->dispatch,
+                                       current_state->no_of_dispatch, ev);
+
+        for (; tl && *tl; tl++)
+        {
+            if (ufsm_try_transition(ctx, r, *tl, ev, &event_consumed))
+                break;
+        }
+
+        return event_consumed;
+    }
+
+    for (struct ufsm_transition *t = r->transition; t; t = t->next)
+    {
+        if (!ufsm_transition_has_trigger(m, t, ev) ||
+            (t->source != current_state))
+            continue;
+
+        if (ufsm_try_transition(ctx, r, t, ev, &event_consumed))
+            break;
+    }
+
+    return event_consumed;
+}
+
+
+/* Hand written machines without a state table rediscover the active
+ * regions on every event.
+ * */
+static ufsm_status_t ufsm_dispatch_regions(struct ufsm_context *ctx,
+                                           int32_t ev,
+                                           bool *event_consumed)
+{
+    struct ufsm_machine *m = ctx->m;
+    ufsm_status_t err = UFSM_OK;
+    uint32_t region_count = 0;
+    struct ufsm_region *region = NULL;
+    struct ufsm_state *s = NULL;
+
+    ufsm_find_active_regions(ctx,m->region, &region_count);
+
+    for (uint32_t i = 0; i < region_count; i++)
+    {
+        err = ufsm_pop_sr_pair(ctx, &region, &s);
+
+        if (err != UFSM_OK)
+            break;
+
+        /* First ensure that the active state has not
+         * changed
+         * */
+        if (ufsm_get_current(ctx, region) == s)
+        {
+            if (ufsm_transition (ctx, region, ev))
+                *event_consumed = true;
+        }
+    }
+
+    return err;
+}
+
+/* Machines without orthogonal regions have a single active leaf state whose
+ * flattened dispatch table lists the candidate transitions of the leaf and
+ * of its ancestors, innermost first. The first transition that fires ends
+ * the step.
+ * */
+static struct ufsm_state * ufsm_get_leaf(struct ufsm_context *ctx)
+{
+    struct ufsm_machine *m = ctx->m;
+    struct ufsm_state *leaf = m->region ? ufsm_get_current(ctx, m->region)
+                                        : NULL;
+
+    while (leaf && leaf->region && ufsm_get_current(ctx, leaf->region))
+        leaf = ufsm_get_current(ctx, leaf->region);
+
+    return leaf;
+}
+
+static ufsm_status_t ufsm_dispatch_flat(struct ufsm_context *ctx,
+                                        int32_t ev,
+                                        bool *event_consumed)
+{
+    struct ufsm_state *leaf = ufsm_get_leaf(ctx);
+    struct ufsm_transition **tl = NULL;
+
+    if (!leaf)
+        return UFSM_OK;
+
+    tl = ufsm_find_dispatch(leaf->flat_dispatch, leaf->no_of_flat_dispatch,
+                                                                    ev);
+
+    for (; tl && *tl; tl++)
+    {
+        struct ufsm_region *r = (*tl)->source->parent_region;
+
+        /* Sources are active unless an earlier candidate failed part way */
+        if (ufsm_get_current(ctx, r) != (*tl)->source)
+            continue;
+
+        if (ufsm_try_transition(ctx, r, *tl, ev, event_consumed))
+            break;
+    }
+
+    return UFSM_OK;
+}
+
+/* Dispatches 'ev' to the states that were active when the event arrived,
+ * innermost first. States are numbered so that nested states have higher
+ * indices than their parents, which makes a reverse walk of the active
+ * bits visit them in the same order as ufsm_find_active_regions.
+ * */
+static ufsm_status_t ufsm_dispatch_active(struct ufsm_context *ctx,
+                                          int32_t ev,
+                                          bool *event_consumed)
+{
+    struct ufsm_machine *m = ctx->m;
+    uint32_t *active = ufsm_get_active_bits(ctx);
+    uint32_t *cant_exit = ufsm_get_cant_exit_bits(ctx);
+    uint32_t *snapshot = ufsm_get_snapshot_bits(ctx);
+    uint32_t words = UFSM_STATE_WORDS(m->no_of_states);
+
+    for (uint32_t w = 0; w < words; w++)
+    {
+        snapshot[w] = active[w];
+        cant_exit[w] = 0;
+    }
+
+    for (uint32_t w = words; w-- > 0;)
+    {
+        while (snapshot[w])
+        {
+            uint32_t bit = ufsm_highest_bit(snapshot[w]);
+            struct ufsm_state *s = m->states[w * 32 + bit];
+
+            snapshot[w] &= ~(1u << bit);
+
+            /* Skip states that have been left by an earlier
+             * transition in this step.
+             * */
+            if (ufsm_get_current(ctx, s->parent_region) == s)
+            {
+                if (ufsm_transition (ctx, s->parent_region, ev))
+                    *event_consumed = true;
+            }
+        }
+    }
+
+    return UFSM_OK;
+}
+
+/* Returns false when no transition in the current configuration can be
+ * triggered or deferred by 'ev'. Flat machines only test the bitmap of the
+ * active leaf, which includes its ancestors. Machines without bitmaps, such
+ * as hand written ones, are interested in every event.
+ * */
+static bool ufsm_interested(struct ufsm_context *ctx, int32_t ev)
+{
+    struct ufsm_machine *m = ctx->m;
+    uint32_t id = (uint32_t) ev;
+    uint32_t *active = NULL;
+    struct ufsm_state *s = NULL;
+
+    if (!m->states || !m->no_of_events)
+        return true;
+
+    if (id >= m->no_of_events)
+        return false;
+
+    if (m->flat)
+    {
+        s = ufsm_get_leaf(ctx);
+        return s && s->interest && ufsm_bit_get(s->interest, id);
+    }
+
+    active = ufsm_get_active_bits(ctx);
+
+    for (uint32_t w = 0; w < UFSM_STATE_WORDS(m->no_of_states); w++)
+    {
+        for (uint32_t bits = active[w]; bits; bits &= bits - 1)
+        {
+            s = m->states[w * 32 + ufsm_highest_bit(bits & -bits)];
+
+            if (s->interest && ufsm_bit_get(s->interest, id))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+inline static void ufsm_release_event(struct ufsm_event *e)
+{
+    if (e->release)
+        e->release(e);
+}
+
+/* Runs one step for 'e'. Pending completion events must already have been
+ * processed.
+ * */
+static ufsm_status_t ufsm_dispatch_event(struct ufsm_context *ctx,
+                                         struct ufsm_event *e)
+{
+    struct ufsm_machine *m = ctx->m;
+    ufsm_status_t err = UFSM_OK;
+    bool event_consumed = false;
+    int32_t ev = (int32_t) e->id;
+
+    if (ev == UFSM_COMPLETION_EVENT)
+    {
+        ufsm_release_event(e);
+        return UFSM_OK;
+    }
+
+    if (m->debug_event)
+        m->debug_event(ev);
+
+    if (ctx->trace)
+    {
+        ctx->trace->ev = (uint32_t) ev;
+        ufsm_trace_put(ctx->trace, UFSM_TRACE_EVENT, NULL, 0);
+    }
+
+    if (!ufsm_interested(ctx, ev))
+    {
+        ufsm_release_event(e);
+        return UFSM_ERROR_EVENT_NOT_PROCESSED;
+    }
+
+    ctx->event = e;
+    ctx->event_deferred = false;
+    ufsm_clear_guard_cache(ctx);
+
+    if (m->flat)
+        err = ufsm_dispatch_flat(ctx, ev, &event_consumed);
+    else if (m->states)
+        err = ufsm_dispatch_active(ctx, ev, &event_consumed);
+    else
+        err = ufsm_dispatch_regions(ctx, ev, &event_consumed);
+
+    if (!event_consumed && err == UFSM_OK)
+        err = UFSM_ERROR_EVENT_NOT_PROCESSED;
+
+    if (!ctx->event_deferred)
+        ufsm_release_event(e);
+
+    ctx->event = NULL;
+
+    return err;
+}
+
+static ufsm_status_t ufsm_step_event(struct ufsm_context *ctx,
+                                     struct ufsm_event *e)
+{
+    ufsm_status_t err = UFSM_OK;
+    ufsm_status_t completion_err = UFSM_OK;
+    struct ufsm_metrics *mx = ufsm_get_metrics(ctx);
+    uint32_t ev = e->id;
+    uint64_t start = 0;
+
+    if (ufsm_get_terminated(ctx))
+    {
+        ufsm_release_event(e);
+        return UFSM_ERROR_MACHINE_TERMINATED;
+    }
+
+    if (mx)
+        start = ufsm_metrics_start(mx);
+
+    ufsm_process_completion_events(ctx);
+
+    err = ufsm_dispatch_event(ctx, e);
+
+    /* Run to completion: completion events caused by this event are
+     * processed before returning.
+     * */
+    completion_err = ufsm_process_completion_events(ctx);
+
+    if (err == UFSM_OK)
+        err = completion_err;
+
+    if (mx)
+        ufsm_metrics_event(mx, ev, start, err);
+
+    return err;
+}
+
+/* Processes 'n' events in order. Completion events caused by one event are
+ * processed before the next one is dispatched. The result for each event is
+ * stored in 'status', if given, and 'processed', if given, is set to the
+ * number of events taken from 'events'. If the machine terminates the remaining events
+ * are left to the caller and UFSM_ERROR_MACHINE_TERMINATED is returned.
+ * */
+static ufsm_status_t ufsm_step_batch(struct ufsm_context *ctx,
+                                     struct ufsm_event *events,
+                                     uint32_t n,
+                                     ufsm_status_t *status,
+                                     uint32_t *processed)
+{
+    struct ufsm_metrics *mx = ufsm_get_metrics(ctx);
+    ufsm_status_t err = UFSM_OK;
+    ufsm_status_t completion_err = UFSM_OK;
+    uint32_t i = 0;
+
+    if (!ufsm_get_terminated(ctx))
+        ufsm_process_completion_events(ctx);
+
+    for (; (i < n) && !ufsm_get_terminated(ctx); i++)
+    {
+        uint32_t ev = events[i].id;
+        uint64_t start = 0;
+
+        if (mx)
+            start = ufsm_metrics_start(mx);
+
+        err = ufsm_dispatch_event(ctx, &events[i]);
+        completion_err = ufsm_process_completion_events(ctx);
+
+        if (err == UFSM_OK)
+            err = completion_err;
+
+        if (mx)
+            ufsm_metrics_event(mx, ev, start, err);
+
+        if (status)
+            status[i] = err;
+    }
+
+    if (processed)
+        *processed = i;
+
+    return (i < n) ? UFSM_ERROR_MACHINE_TERMINATED : UFSM_OK;
+}
+
+/* Machines that are processed without an instance use their own context */
+inline static struct ufsm_context * ufsm_machine_context(
+                                                struct ufsm_machine *m)
+{
+    m->context.m = m;
+    return &m->context;
+}
+
+bool ufsm_event_of_interest(struct ufsm_machine *m, int32_t ev)
+{
+    return ufsm_interested(ufsm_machine_context(m), ev);
+}
+
+ufsm_status_t ufsm_process_event(struct ufsm_machine *m,
+                                 struct ufsm_event *e)
+{
+    if (m->read_only)
+    {
+        ufsm_release_event(e);
+        return UFSM_ERROR;
+    }
+
+    return ufsm_step_event(ufsm_machine_context(m), e);
+}
+
+ufsm_status_t ufsm_process_batch(struct ufsm_machine *m,
+                                 struct ufsm_event *events,
+                                 uint32_t n,
+                                 ufsm_status_t *status,
+                                 uint32_t *processed)
+{
+    if (m->read_only)
+    {
+        if (processed)
+            *processed = 0;
+
+        return UFSM_ERROR;
+    }
+
+    return ufsm_step_batch(ufsm_machine_context(m), events, n, status,
+                                                            processed);
+}
+
+ufsm_status_t ufsm_process (struct ufsm_machine *m, int32_t ev)
+{
+    struct ufsm_event e =
+    {
+        .id = (uint32_t) ev,
+    };
+
+    return ufsm_process_event(m, &e);
+}
+
+/* The event being dispatched, for guards and actions that need the
+ * payload. NULL outside of event processing.
+ * */
+const struct ufsm_event * ufsm_get_event(struct ufsm_machine *m)
+{
+    return m->context.event;
+}
+
+/* The same for instances that are processed on a context of their own */
+const struct ufsm_event * ufsm_get_context_event(struct ufsm_context *c)
+{
+    return c->event;
+}
+
+const void * ufsm_event_data(const struct ufsm_event *e)
+{
+    return e->ptr ? e->ptr : e->data;
+}
+
+bool ufsm_is_active(struct ufsm_machine *m, struct ufsm_state *s)
+{
+    struct ufsm_context *ctx = ufsm_machine_context(m);
+
+    if (!ctx->instance && !m->data)
+        return false;
+
+    return ufsm_bit_get(ufsm_get_active_bits(ctx), s->index);
+}
+
+/* Only regions below states that have been entered since the last reset
+ * can hold a current or history state, so the rest of the tree is skipped.
+ * */
+static ufsm_status_t ufsm_reset_region(struct ufsm_machine *m,
+                                       struct ufsm_region *regions)
+{
+    ufsm_status_t err = UFSM_OK;
+    struct ufsm_region *r = NULL;
+    uint32_t regions_count = 1;
+    uint32_t *touched = &m->data[2 * UFSM_STATE_WORDS(m->no_of_states)];
+
+    err = ufsm_stack_push(&m->context.stack, regions);
+
+    if (err != UFSM_OK)
+        return err;
+
+    while (regions_count)
+    {
+        err = ufsm_stack_pop(&m->context.stack, (void **) &r);
+
+        if (err != UFSM_OK)
+            break;
+
+        regions_count--;
+        r->current = NULL;
+        r->history = NULL;
+
+        for (struct ufsm_state *s = r->state; s; s = s->next)
+        {
+            if (!ufsm_bit_get(touched, s->index))
+                continue;
+
+            for (struct ufsm_region *sr = s->region; sr; sr = sr->next)
+            {
+                err = ufsm_stack_push(&m->context.stack, sr);
+
+                if (err != UFSM_OK)
+                    break;
+
+                regions_count++;
+            }
+
+            if (err != UFSM_OK)
+                break;
+        }
+
+    }
+    return err;
+}
+
+/* Generated machines clear the regions of the touched states straight from
+ * the state table. The cost is a few words of memset plus one step per
+ * state that has been current or history since the last reset.
+ * */
+ufsm_status_t ufsm_reset_machine(struct ufsm_machine *m)
+{
+    ufsm_status_t err = UFSM_OK;
+    uint32_t no_of_words = UFSM_STATE_WORDS(m->no_of_states);
+    uint32_t *touched = NULL;
+
+    if (m->read_only)
+        return UFSM_ERROR;
+
+    if (m->debug_reset)
+        m->debug_reset(m);
+
+    if (m->context.trace)
+        ufsm_trace_put(m->context.trace, UFSM_TRACE_RESET, m, 0);
+
+    ufsm_cancel_timers(m, m->timers);
+
+    /* Nothing has been entered before the first initialization */
+    if (!m->data)
+        return UFSM_OK;
+
+    touched = &m->data[2 * no_of_words];
+
+    if (m->states)
+    {
+        for (uint32_t w = 0; w < no_of_words; w++)
+        {
+            uint32_t bits = touched[w];
+
+            while (bits)
+            {
+                uint32_t n = ufsm_highest_bit(bits);
+                struct ufsm_region *r = m->states[w * 32 + n]->parent_region;
+
+                bits &= ~(1u << n);
+                r->current = NULL;
+                r->history = NULL;
+            }
+        }
+    }
+    else
+    {
+        for (struct ufsm_region *r = m->region; r && (err == UFSM_OK);
+                                                            r = r->next)
+            err = ufsm_reset_region(m, r);
+
+        m->context.stack.pos = 0;
+    }
+
+    for (uint32_t w = 0; w < UFSM_MACHINE_DATA_SIZE(m->no_of_states); w++)
+        m->data[w] = 0;
+
+    return err;
+}
+
+struct ufsm_queue * ufsm_get_queue(struct ufsm_machine *m)
+{
+    if (m->context.instance)
+        return m->context.instance->queue;
+
+    return &m->queue;
+}
+
+/* While an instance is bound 'm' only provides the definition and the debug
+ * hooks. All state that survives between calls is kept in the instance and
+ * the scratch of the step in its context, so an instance with a context of
+ * its own never writes to 'm'.
+ *
+ * A context of its own stays with the last instance it served, so that a
+ * do-activity completing between steps lands on that instance and is taken
+ * at its next step. Pending completions are dropped when the context moves
+ * on to another instance.
+ * */
+static struct ufsm_context * ufsm_bind_instance(struct ufsm_machine *m,
+                                                struct ufsm_instance *i)
+{
+    struct ufsm_context *ctx = i->context;
+
+    if (!ctx)
+    {
+        ufsm_init_stacks(m);
+        ctx = &m->context;
+    }
+    else if (ctx->instance != i)
+        ufsm_reset_stacks(ctx);
+    else
+    {
+        ctx->stack.pos = 0;
+        ctx->stack2.pos = 0;
+    }
+
+    ctx->m = m;
+    ctx->instance = i;
+
+    return ctx;
+}
+
+static void ufsm_unbind_instance(struct ufsm_context *ctx)
+{
+    if (ctx == &ctx->m->context)
+        ctx->instance = NULL;
+}
+
+ufsm_status_t ufsm_context_init(struct ufsm_context *c,
+                                struct ufsm_machine *m,
+                                uint32_t no_of_elements,
+                                void **data)
+{
+    uint32_t a = m->context.stack.no_of_elements;
+    uint32_t b = m->context.stack2.no_of_elements;
+    uint32_t n = m->context.completion_stack.no_of_elements;
+
+    if (!a || !b || !n || (no_of_elements < (a + b + n)))
+        return UFSM_ERROR;
+
+    ufsm_stack_init(&(c->stack), a, data);
+    ufsm_stack_init(&(c->stack2), b, &data[a]);
+    ufsm_stack_init(&(c->completion_stack), n, &data[a + b]);
+
+    c->m = m;
+    c->instance = NULL;
+    c->trace = NULL;
+    c->event = NULL;
+    c->event_deferred = false;
+    c->guards_passed = NULL;
+    ufsm_clear_guard_cache(c);
+
+    return UFSM_OK;
+}
+
+ufsm_status_t ufsm_instance_init(struct ufsm_instance *i,
+                                 struct ufsm_machine *m,
+                                 uint32_t no_of_elements,
+                                 uint32_t *data)
+{
+    if (m->states == NULL)
+        return UFSM_ERROR;
+
+    if (no_of_elements < UFSM_INSTANCE_DATA_SIZE(m->no_of_regions,
+                                                 m->no_of_states))
+        return UFSM_ERROR;
+
+    i->terminated = false;
+    i->context = NULL;
+    i->data = data;
+    i->queue = NULL;
+    i->defer_queue = NULL;
+    i->timers = NULL;
+    i->entered = NULL;
+
+    for (uint32_t n = 0; n < no_of_elements; n++)
+        data[n] = 0;
+
+    return UFSM_OK;
+}
+
+ufsm_status_t ufsm_init_machine_instance(struct ufsm_machine *m,
+                                         struct ufsm_instance *i)
+{
+    struct ufsm_context *ctx = ufsm_bind_instance(m, i);
+    ufsm_status_t err = ufsm_enter_initial_states(ctx);
+
+    ufsm_unbind_instance(ctx);
+
+    return err;
+}
+
+ufsm_status_t ufsm_reset_machine_instance(struct ufsm_machine *m,
+                                          struct ufsm_instance *i)
+{
+    uint32_t no_of_elements = UFSM_INSTANCE_DATA_SIZE(m->no_of_regions,
+                                                      m->no_of_states);
+    struct ufsm_trace *trace = i->context ? i->context->trace :
+                                            m->context.trace;
+    if (m->debug_reset)
+        m->debug_reset(m);
+
+    if (trace)
+        ufsm_trace_put(trace, UFSM_TRACE_RESET, m, 0);
+
+    ufsm_cancel_timers(m, i->timers);
+
+    for (uint32_t n = 0; n < no_of_elements; n++)
+        i->data[n] = 0;
+
+    if (i->entered)
+    {
+        for (uint32_t n = 0; n < UFSM_METRICS_ENTERED_SIZE(m->no_of_states);
+                                                                        n++)
+            i->entered[n] = 0;
+    }
+
+    /* Completions of do-activities that were pending on its context */
+    if (i->context && (i->context->instance == i))
+        i->context->completion_stack.pos = 0;
+
+    i->terminated = false;
+
+    return UFSM_OK;
+}
+
+ufsm_status_t ufsm_process_instance(struct ufsm_machine *m,
+                                    struct ufsm_instance *i,
+                                    int32_t ev)
+{
+    struct ufsm_event e =
+    {
+        .id = (uint32_t) ev,
+    };
+
+    return ufsm_process_event_instance(m, i, &e);
+}
+
+ufsm_status_t ufsm_process_event_instance(struct ufsm_machine *m,
+                                          struct ufsm_instance *i,
+                                          struct ufsm_event *e)
+{
+    struct ufsm_context *ctx = ufsm_bind_instance(m, i);
+    ufsm_status_t err = ufsm_step_event(ctx, e);
+
+    ufsm_unbind_instance(ctx);
+
+    return err;
+}
+
+ufsm_status_t ufsm_process_batch_instance(struct ufsm_machine *m,
+                                          struct ufsm_instance *i,
+                                          struct ufsm_event *events,
+                                          uint32_t n,
+                                          ufsm_status_t *status,
+                                          uint32_t *processed)
+{
+    struct ufsm_context *ctx = ufsm_bind_instance(m, i);
+    ufsm_status_t err = ufsm_step_batch(ctx, events, n, status, processed);
+
+    ufsm_unbind_instance(ctx);
+
+    return err;
+}
+
+bool ufsm_event_of_interest_instance(struct ufsm_machine *m,
+                                     struct ufsm_instance *i,
+                                     int32_t ev)
+{
+    struct ufsm_context *ctx = ufsm_bind_instance(m, i);
+    bool result = ufsm_interested(ctx, ev);
+
+    ufsm_unbind_instance(ctx);
+
+    return result;
+}
+
+bool ufsm_is_active_instance(struct ufsm_machine *m,
+                             struct ufsm_instance *i,
+                             struct ufsm_state *s)
+{
+    uint32_t *bits = &i->data[2 * m->no_of_regions +
+                              UFSM_STATE_WORDS(m->no_of_states)];
+
+    return ufsm_bit_get(bits, s->index);
+}
+
+/* Snapshot encoding, all integers are unsigned LEB128 varints:
+ *
+ *   magic, version, flags (bit 0: terminated)
+ *   number of regions, number of states
+ *   for each region with a current or history state, in walk order:
+ *       region index + 1, current state index, history state index
+ *   0
+ *   index of each state that can't exit, in ascending order
+ *   0
+ *   event queue and defer queue, each as:
+ *       number of events, then for each event: id, lane, size, inline data
+ *
+ * State index zero means no state. The active bits are not stored, they
+ * follow from the current states.
+ * */
+#define UFSM_SNAPSHOT_MAGIC 0x75
+#define UFSM_SNAPSHOT_VERSION 2
+
+struct ufsm_snapshot_buf
+{
+    uint8_t *out;
+    const uint8_t *in;
+    uint32_t len;
+    uint32_t pos;
+    uint32_t next_region;
+    bool error;
+};
+
+typedef ufsm_status_t (*ufsm_region_cb_t) (struct ufsm_context *ctx,
+                                           struct ufsm_region *r,
+                                           struct ufsm_snapshot_buf *b);
+
+/* Visits every region of the machine, active or not, in an order that only
+ * depends on the definition.
+ * */
+static ufsm_status_t ufsm_walk_regions(struct ufsm_context *ctx,
+                                       ufsm_region_cb_t cb,
+                                       struct ufsm_snapshot_buf *b)
+{
+    struct ufsm_machine *m = ctx->m;
+    ufsm_status_t err = UFSM_OK;
+    struct ufsm_region *r = NULL;
+
+    ctx->stack.pos = 0;
+
+    for (r = m->region; r && (err == UFSM_OK); r = r->next)
+        err = ufsm_stack_push(&ctx->stack, r);
+
+    while ((err == UFSM_OK) &&
+           (ufsm_stack_pop(&ctx->stack, (void **) &r) == UFSM_OK))
+    {
+        err = cb(ctx, r, b);
+
+        for (struct ufsm_state *s = r->state; s && (err == UFSM_OK);
+                                                        s = s->next)
+        {
+            for (struct ufsm_region *sr = s->region; sr && (err == UFSM_OK);
+                                                        sr = sr->next)
+                err = ufsm_stack_push(&ctx->stack, sr);
+        }
+    }
+
+    ctx->stack.pos = 0;
+
+    return err;
+}
+
+/* Keeps counting past the end of the buffer, so the needed size is known */
+static void ufsm_put_varint(struct ufsm_snapshot_buf *b, uint32_t v)
+{
+    do
+    {
+        uint8_t byte = v & 0x7f;
+
+        v >>= 7;
+
+        if (v)
+            byte |= 0x80;
+
+        if (b->pos < b->len)
+            b->out[b->pos] = byte;
+        else
+            b->error = true;
+
+        b->pos++;
+    } while (v);
+}
+
+static uint32_t ufsm_get_varint(struct ufsm_snapshot_buf *b)
+{
+    uint32_t v = 0;
+
+    for (uint32_t shift = 0; (shift < 32) && (b->pos < b->len); shift += 7)
+    {
+        uint8_t byte = b->in[b->pos++];
+
+        v |= (uint32_t) (byte & 0x7f) << shift;
+
+        if (!(byte & 0x80))
+            return v;
+    }
+
+    b->error = true;
+
+    return 0;
+}
+
+static ufsm_status_t ufsm_snapshot_region(struct ufsm_context *ctx,
+                                          struct ufsm_region *r,
+                                          struct ufsm_snapshot_buf *b)
+{
+    struct ufsm_state *current = ufsm_get_current(ctx, r);
+    struct ufsm_state *history = ufsm_get_history(ctx, r);
+
+    if (current || history)
+    {
+        ufsm_put_varint(b, r->index + 1);
+        ufsm_put_varint(b, current ? current->index : 0);
+        ufsm_put_varint(b, history ? history->index : 0);
+    }
+
+    return UFSM_OK;
+}
+
+static ufsm_status_t ufsm_snapshot_queue(struct ufsm_queue *q,
+                                         struct ufsm_snapshot_buf *b)
+{
+    struct ufsm_event e;
+    uint32_t count = q ? ufsm_queue_count(q) : 0;
+
+    ufsm_put_varint(b, count);
+
+    for (uint32_t n = 0; n < count; n++)
+    {
+        ufsm_queue_peek_event(q, n, &e);
+
+        /* Addresses mean nothing in another process */
+        if (e.ptr || e.release || (e.size > UFSM_EVENT_DATA_SIZE))
+            return UFSM_ERROR;
+
+        ufsm_put_varint(b, e.id);
+        ufsm_put_varint(b, e.lane);
+        ufsm_put_varint(b, e.size);
+
+        for (uint32_t i = 0; i < e.size; i++)
+            ufsm_put_varint(b, e.data[i]);
+    }
+
+    return UFSM_OK;
+}
+
+static ufsm_status_t ufsm_take_snapshot(struct ufsm_context *ctx,
+                                        uint8_t *buf,
+                                        uint32_t len,
+                                        uint32_t *used)
+{
+    struct ufsm_machine *m = ctx->m;
+    ufsm_status_t err = UFSM_OK;
+    uint32_t *cant_exit = NULL;
+    struct ufsm_snapshot_buf b =
+    {
+        .out = buf,
+        .len = len,
+    };
+
+    if (!ctx->instance && !m->data)
+        return UFSM_ERROR;
+
+    cant_exit = ufsm_get_cant_exit_bits(ctx);
+    ufsm_put_varint(&b, UFSM_SNAPSHOT_MAGIC);
+    ufsm_put_varint(&b, UFSM_SNAPSHOT_VERSION);
+    ufsm_put_varint(&b, ufsm_get_terminated(ctx) ? 1 : 0);
+    ufsm_put_varint(&b, m->no_of_regions);
+    ufsm_put_varint(&b, m->no_of_states);
+
+    err = ufsm_walk_regions(ctx, &ufsm_snapshot_region, &b);
+    ufsm_put_varint(&b, 0);
+
+    for (uint32_t n = 1; n <= m->no_of_states; n++)
+    {
+        if (ufsm_bit_get(cant_exit, n))
+            ufsm_put_varint(&b, n);
+    }
+
+    ufsm_put_varint(&b, 0);
+
+    if (err == UFSM_OK)
+        err = ufsm_snapshot_queue(ufsm_get_context_queue(ctx), &b);
+
+    if (err == UFSM_OK)
+        err = ufsm_snapshot_queue(ufsm_get_defer_queue(ctx), &b);
+
+    *used = b.pos;
+
+    if ((err == UFSM_OK) && b.error)
+        err = UFSM_ERROR_BUFFER_TOO_SMALL;
+
+    return err;
+}
+
+/* Stores the active configuration, the history, the can't exit flags and
+ * the queued events of 'm' in 'buf' using state and region indices only.
+ * 'used' is set to the size of the snapshot, also when 'buf' is too small.
+ * Events that carry 'ptr' or 'release' can't be stored. Must be called
+ * between steps.
+ * */
+ufsm_status_t ufsm_snapshot(struct ufsm_machine *m,
+                            uint8_t *buf,
+                            uint32_t len,
+                            uint32_t *used)
+{
+    return ufsm_take_snapshot(ufsm_machine_context(m), buf, len, used);
+}
+
+static struct ufsm_state * ufsm_region_state(struct ufsm_region *r,
+                                             uint32_t index,
+                                             struct ufsm_snapshot_buf *b)
+{
+    if (!index)
+        return NULL;
+
+    for (struct ufsm_state *s = r->state; s; s = s->next)
+    {
+        if (s->index == index)
+            return s;
+    }
+
+    b->error = true;
+
+    return NULL;
+}
+
+/* Regions without an entry in the snapshot are cleared */
+static ufsm_status_t ufsm_restore_region(struct ufsm_context *ctx,
+                                         struct ufsm_region *r,
+                                         struct ufsm_snapshot_buf *b)
+{
+    struct ufsm_machine *m = ctx->m;
+    struct ufsm_state *current = NULL;
+    struct ufsm_state *history = NULL;
+
+    if (b->next_region == r->index + 1)
+    {
+        current = ufsm_region_state(r, ufsm_get_varint(b), b);
+        history = ufsm_region_state(r, ufsm_get_varint(b), b);
+        b->next_region = ufsm_get_varint(b);
+    }
+
+    if (ctx->instance)
+    {
+        ctx->instance->data[r->index] = current ? current->index : 0;
+        ctx->instance->data[m->no_of_regions + r->index] =
+                                            history ? history->index : 0;
+    }
+    else
+    {
+        r->current = current;
+        r->history = history;
+        ufsm_touch(m, current);
+        ufsm_touch(m, history);
+    }
+
+    return b->error ? UFSM_ERROR : UFSM_OK;
+}
+
+static ufsm_status_t ufsm_restore_queue(struct ufsm_queue *q,
+                                        struct ufsm_snapshot_buf *b)
+{
+    ufsm_status_t err = UFSM_OK;
+    struct ufsm_event e;
+    uint32_t count = ufsm_get_varint(b);
+
+    while (q && (ufsm_queue_get_event(q, &e) == UFSM_OK))
+        ufsm_release_event(&e);
+
+    for (uint32_t n = 0; (n < count) && (err == UFSM_OK); n++)
+    {
+        e = (struct ufsm_event) { .id = ufsm_get_varint(b) };
+        e.lane = ufsm_get_varint(b);
+        e.size = ufsm_get_varint(b);
+
+        if (e.size > UFSM_EVENT_DATA_SIZE)
+            return UFSM_ERROR;
+
+        for (uint32_t i = 0; i < e.size; i++)
+            e.data[i] = (uint8_t) ufsm_get_varint(b);
+
+        if (b->error)
+            return UFSM_ERROR;
+
+        err = q ? ufsm_queue_put_event(q, &e) : UFSM_ERROR_QUEUE_FULL;
+    }
+
+    return err;
+}
+
+/* Arms the time events of the current state of 'r' again */
+static ufsm_status_t ufsm_restore_time_events(struct ufsm_context *ctx,
+                                              struct ufsm_region *r,
+                                              struct ufsm_snapshot_buf *b)
+{
+    struct ufsm_state *s = ufsm_get_current(ctx, r);
+
+    if (s && ufsm_bit_get(ufsm_get_active_bits(ctx), s->index))
+        ufsm_arm_time_events(ctx, s);
+
+    return UFSM_OK;
+}
+
+static ufsm_status_t ufsm_restore_snapshot(struct ufsm_context *ctx,
+                                           const uint8_t *buf,
+                                           uint32_t len)
+{
+    struct ufsm_machine *m = ctx->m;
+    ufsm_status_t err = UFSM_OK;
+    uint32_t *cant_exit = NULL;
+    uint32_t *active = NULL;
+    bool terminated = false;
+    struct ufsm_snapshot_buf b =
+    {
+        .in = buf,
+        .len = len,
+    };
+
+    if (!ctx->instance && !m->data)
+        return UFSM_ERROR;
+
+    cant_exit = ufsm_get_cant_exit_bits(ctx);
+    active = ufsm_get_active_bits(ctx);
+
+    if ((ufsm_get_varint(&b) != UFSM_SNAPSHOT_MAGIC) ||
+        (ufsm_get_varint(&b) != UFSM_SNAPSHOT_VERSION))
+        return UFSM_ERROR;
+
+    terminated = (ufsm_get_varint(&b) & 1) != 0;
+
+    if ((ufsm_get_varint(&b) != m->no_of_regions) ||
+        (ufsm_get_varint(&b) != m->no_of_states) || b.error)
+        return UFSM_ERROR;
+
+    b.next_region = ufsm_get_varint(&b);
+    err = ufsm_walk_regions(ctx, &ufsm_restore_region, &b);
+
+    if ((err != UFSM_OK) || b.next_region)
+        return UFSM_ERROR;
+
+    for (uint32_t n = 0; n < UFSM_STATE_WORDS(m->no_of_states); n++)
+    {
+        cant_exit[n] = 0;
+        active[n] = 0;
+    }
+
+    for (uint32_t n = ufsm_get_varint(&b); n && !b.error;
+                                           n = ufsm_get_varint(&b))
+    {
+        if (n > m->no_of_states)
+            return UFSM_ERROR;
+
+        ufsm_bit_set(cant_exit, n, true);
+    }
+
+    for (struct ufsm_region *r = m->region; r; r = r->next)
+    {
+        struct ufsm_state *current = ufsm_get_current(ctx, r);
+
+        if (current)
+            ufsm_set_active(ctx, current, true);
+    }
+
+    ufsm_set_terminated(ctx, terminated);
+    err = ufsm_reset_stacks(ctx);
+
+    if (err != UFSM_OK)
+        return err;
+
+    /* Time events of the restored states start over */
+    ufsm_cancel_timers(m, ufsm_get_timers(ctx));
+    err = ufsm_walk_regions(ctx, &ufsm_restore_time_events, &b);
+
+    if (err != UFSM_OK)
+        return err;
+
+    err = ufsm_restore_queue(ufsm_get_context_queue(ctx), &b);
+
+    if (err == UFSM_OK)
+        err = ufsm_restore_queue(ufsm_get_defer_queue(ctx), &b);
+
+    if ((err == UFSM_OK) && b.error)
+        err = UFSM_ERROR;
+
+    return err;
+}
+
+/* Replaces the runtime state of an initialized machine with a snapshot
+ * taken from the same definition. No entry or exit actions are run and
+ * do-activities are not restarted. After a failed restore the machine must
+ * be reset.
+ * */
+ufsm_status_t ufsm_restore(struct ufsm_machine *m,
+                           const uint8_t *buf,
+                           uint32_t len)
+{
+    if (m->read_only)
+        return UFSM_ERROR;
+
+    return ufsm_restore_snapshot(ufsm_machine_context(m), buf, len);
+}
+
+ufsm_status_t ufsm_snapshot_instance(struct ufsm_machine *m,
+                                     struct ufsm_instance *i,
+                                     uint8_t *buf,
+                                     uint32_t len,
+                                     uint32_t *used)
+{
+    struct ufsm_context *ctx = ufsm_bind_instance(m, i);
+    ufsm_status_t err = ufsm_take_snapshot(ctx, buf, len, used);
+
+    ufsm_unbind_instance(ctx);
+
+    return err;
+}
+
+ufsm_status_t ufsm_restore_instance(struct ufsm_machine *m,
+                                    struct ufsm_instance *i,
+                                    const uint8_t *buf,
+                                    uint32_t len)
+{
+    struct ufsm_context *ctx = ufsm_bind_instance(m, i);
+    ufsm_status_t err = ufsm_restore_snapshot(ctx, buf, len);
+
+    ufsm_unbind_instance(ctx);
+
+    return err;
 }
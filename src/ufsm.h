@@ -28,6 +28,9 @@ enum ufsm_status_codes
     UFSM_ERROR_QUEUE_EMPTY,
     UFSM_ERROR_QUEUE_FULL,
     UFSM_ERROR_MACHINE_TERMINATED,
+    UFSM_ERROR_TOO_MANY_STATES,
+    UFSM_ERROR_BUFFER_TOO_SMALL,
+    UFSM_ERROR_NO_STORAGE,
 };
 
 typedef enum ufsm_status_codes ufsm_status_t;
@@ -38,6 +41,10 @@ extern const char *ufsm_errors[];
 #define UFSM_NO_TRIGGER -1
 #define UFSM_COMPLETION_EVENT -1
 
+/* Machines generated by ufsmimport come with stacks, queues and state
+ * bitsets sized for their structure. The sizes below are those of a
+ * 'struct ufsm_storage', which provides them for other machines.
+ */
 #ifndef UFSM_STACK_SIZE
     #define UFSM_STACK_SIZE 128
 #endif
@@ -54,10 +61,61 @@ extern const char *ufsm_errors[];
     #define UFSM_DEFER_QUEUE_SIZE 16
 #endif
 
+#ifndef UFSM_CACHE_LINE_SIZE
+    #define UFSM_CACHE_LINE_SIZE 64
+#endif
+
+#ifndef UFSM_EVENT_DATA_SIZE
+    #define UFSM_EVENT_DATA_SIZE 8
+#endif
+
+/* States of a machine that uses the bitsets of a 'struct ufsm_storage',
+ * generated machines and instances have theirs sized for the chart
+ */
+#ifndef UFSM_MAX_STATES
+    #define UFSM_MAX_STATES 256
+#endif
+
+/* Hand written machines without 'storage' take one of these from the
+ * library on their first initialization
+ */
+#ifndef UFSM_DEFAULT_STORAGES
+    #define UFSM_DEFAULT_STORAGES 4
+#endif
+
+#ifndef UFSM_GUARD_CACHE_SIZE
+    #define UFSM_GUARD_CACHE_SIZE 8
+#endif
+
+/* The timing wheel has UFSM_TIMER_LEVELS levels of 64 slots each and
+ * covers 64^UFSM_TIMER_LEVELS ticks without re-cascading
+ */
+#ifndef UFSM_TIMER_LEVELS
+    #define UFSM_TIMER_LEVELS 4
+#endif
+
+/* Expired timers posted per round of ufsm_timer_tick, outside the lock */
+#ifndef UFSM_TIMER_BATCH
+    #define UFSM_TIMER_BATCH 16
+#endif
+
+/* Latency histogram buckets, bucket n counts the events that took less
+ * than 2^n clock units
+ */
+#ifndef UFSM_METRICS_BUCKETS
+    #define UFSM_METRICS_BUCKETS 32
+#endif
+
 #ifndef NULL
     #define NULL ((void *) 0)
 #endif
 
+/* Event ids below this fit in a transition's trigger mask */
+#define UFSM_TRIGGER_MASK_BITS 32
+
+#define UFSM_TIMER_SLOT_BITS 6
+#define UFSM_TIMER_SLOTS (1 << UFSM_TIMER_SLOT_BITS)
+
 struct ufsm_state;
 struct ufsm_machine;
 struct ufsm_action;
@@ -65,13 +123,20 @@ struct ufsm_guard;
 struct ufsm_transition;
 struct ufsm_region;
 struct ufsm_entry_exit;
+struct ufsm_event;
+struct ufsm_queue;
+struct ufsm_context;
 
 typedef bool (*ufsm_guard_func_t) (void);
 typedef void (*ufsm_action_func_t) (void);
 typedef void (*ufsm_entry_exit_func_t) (void);
 typedef void (*ufsm_queue_cb_t) (void);
-typedef uint32_t (*ufsm_doact_cb_t) (struct ufsm_machine *m, struct ufsm_state *s);
-typedef void (*ufsm_doact_func_t) (struct ufsm_machine *m,
+typedef void (*ufsm_queue_wake_t) (struct ufsm_queue *q);
+typedef void (*ufsm_timer_cb_t) (void);
+typedef void (*ufsm_event_release_t) (struct ufsm_event *e);
+typedef uint32_t (*ufsm_doact_cb_t) (struct ufsm_context *c,
+                                     struct ufsm_state *s);
+typedef void (*ufsm_doact_func_t) (struct ufsm_context *c,
                                    struct ufsm_state *s,
                                    ufsm_doact_cb_t cb);
 
@@ -81,12 +146,21 @@ typedef void (*ufsm_debug_transition_t) (struct ufsm_transition *t);
 typedef void (*ufsm_debug_enter_region_t) (struct ufsm_region *region);
 typedef void (*ufsm_debug_leave_region_t) (struct ufsm_region *region);
 typedef void (*ufsm_debug_guard_t) (struct ufsm_guard *guard, bool result);
+typedef void (*ufsm_debug_guard_cached_t) (struct ufsm_guard *guard,
+                                           bool result);
 typedef void (*ufsm_debug_action_t) (struct ufsm_action *action);
 typedef void (*ufsm_debug_enter_state_t) (struct ufsm_state *s);
 typedef void (*ufsm_debug_exit_state_t) (struct ufsm_state *s);
 typedef void (*ufsm_debug_entry_exit_t) (struct ufsm_entry_exit *f);
 typedef void (*ufsm_debug_reset_t) (struct ufsm_machine *m);
 
+/* Tracing callbacks */
+typedef uint64_t (*ufsm_trace_clock_t) (void);
+typedef void (*ufsm_trace_print_t) (const char *line, void *ctx);
+
+/* Metrics callbacks */
+typedef uint64_t (*ufsm_metrics_clock_t) (void);
+
 enum ufsm_transition_kind
 {
     UFSM_TRANSITION_EXTERNAL,
@@ -121,16 +195,203 @@ struct ufsm_stack
     uint32_t pos;
 };
 
+/* Event record. A payload is either stored inline in 'data' or, to avoid
+ * copying large buffers, referenced through 'ptr'. 'release' is called
+ * once the event has been handled and is not deferred, so a pooled buffer
+ * can be returned to its owner. Only the record is copied when the event is
+ * queued or deferred, never the buffer behind 'ptr'.
+ *
+ * 'lane' selects the priority lane of a queue with lanes, zero being the
+ * lowest priority. It stays with the event while it is deferred.
+ */
+struct ufsm_event
+{
+    uint32_t id;
+    uint32_t size;
+    uint32_t lane;
+    void *ptr;
+    ufsm_event_release_t release;
+    uint8_t data[UFSM_EVENT_DATA_SIZE];
+};
+
+enum ufsm_queue_kind
+{
+    UFSM_QUEUE_LOCKED,
+    UFSM_QUEUE_SPSC,
+    UFSM_QUEUE_MPSC,
+    UFSM_QUEUE_LANES,
+};
+
+/* A queue stores either plain event ids in 'data' or complete event records
+ * in 'events', depending on how it was initialized.
+ *
+ * Locked queues serialise access through the optional 'lock' and 'unlock'
+ * callbacks. The lock-free kinds ignore them: an SPSC queue allows one
+ * producer and one consumer thread, an MPSC queue any number of producers
+ * and one consumer. Their 'head' and 'tail' indices are free running and
+ * kept on separate cache lines.
+ *
+ * A queue with lanes holds no events itself but puts each event in
+ * 'lanes[e->lane]', which can be queues of any other kind. Gets take from
+ * the highest non-empty lane first.
+ *
+ * 'wake' is called after every successful put, outside of any lock. It is
+ * set by ufsm_run() to wake a consumer that sleeps on 'wake_seq' while
+ * 'waiters' is non zero. A hook set before is kept in 'next_wake' and
+ * called after it until ufsm_run() returns.
+ */
 struct ufsm_queue
 {
+    enum ufsm_queue_kind kind;
     uint32_t no_of_elements;
     uint32_t s;
-    uint32_t head;
-    uint32_t tail;
     uint32_t *data;
+    struct ufsm_event *events;
+    uint32_t *seq;
+    struct ufsm_queue *lanes;
+    uint32_t no_of_lanes;
     ufsm_queue_cb_t on_data;
     ufsm_queue_cb_t lock;
     ufsm_queue_cb_t unlock;
+    ufsm_queue_wake_t wake;
+    ufsm_queue_wake_t next_wake;
+    uint32_t wake_seq;
+    uint32_t waiters;
+    uint32_t no_of_full;
+    uint8_t head_pad[UFSM_CACHE_LINE_SIZE];
+    uint32_t head;
+    uint8_t tail_pad[UFSM_CACHE_LINE_SIZE];
+    uint32_t tail;
+};
+
+/* Timer of one time event. While armed it is linked into a slot of a
+ * timing wheel and 'ev' is posted to 'queue' when it expires.
+ */
+struct ufsm_timer
+{
+    struct ufsm_timer *next;
+    struct ufsm_timer *prev;
+    uint64_t expires;
+    struct ufsm_queue *queue;
+    uint32_t ev;
+};
+
+/* Hierarchical timing wheel, see ufsm_timer.c. Level n holds the timers
+ * that expire within 64^(n+1) ticks in slots of 64^n ticks. 'slots' are
+ * the list heads. 'lock' and 'unlock' are called around every operation
+ * when the wheel is used from more than one thread.
+ */
+struct ufsm_timer_wheel
+{
+    uint64_t now;
+    ufsm_timer_cb_t lock;
+    ufsm_timer_cb_t unlock;
+    struct ufsm_timer slots[UFSM_TIMER_LEVELS][UFSM_TIMER_SLOTS];
+};
+
+/* A UML time event, after(ticks) or at(ticks). The timer is armed with
+ * 'ev' when the owning state is entered and canceled when it is left.
+ * 'index' selects the timer in the machine's or instance's 'timers'.
+ */
+struct ufsm_time_event
+{
+    uint32_t index;
+    uint64_t ticks;
+    bool absolute;
+    uint32_t ev;
+    struct ufsm_time_event *next;
+};
+
+/* Per-session runtime state of a machine. The definition, i.e. the regions,
+ * states and transitions, is shared between all instances and is never
+ * written while an instance is processed. The scratch of a step is taken
+ * from 'context', or from the machine's own context if it is NULL.
+ *
+ * 'data' is laid out as:
+ *   [0, R)          Active state index for each region
+ *   [R, 2R)         History state index for each region
+ *   [2R, 2R+W)      One bit per state, set while the state can't exit
+ *   [2R+W, 2R+2W)   One bit per state, set while the state is active
+ *   [2R+2W, 2R+3W)  The active bits at the start of a dispatch
+ *
+ * where R is the number of regions in the machine and W the number of words
+ * needed for one bit per state. State index zero means no state.
+ * See UFSM_INSTANCE_DATA_SIZE.
+ *
+ * 'entered' holds the entry time of each state for the machine's metrics,
+ * UFSM_METRICS_ENTERED_SIZE words. Nothing is recorded for an instance
+ * without it.
+ */
+struct ufsm_instance
+{
+    bool terminated;
+    struct ufsm_context *context;
+    uint32_t *data;
+    struct ufsm_queue *queue;
+    struct ufsm_queue *defer_queue;
+    struct ufsm_timer *timers;
+    uint64_t *entered;
+};
+
+/* Words needed for one bit per state, including the unused index zero */
+#define UFSM_STATE_WORDS(no_of_states) (((no_of_states) + 32) / 32)
+
+#define UFSM_INSTANCE_DATA_SIZE(no_of_regions, no_of_states) \
+        (2 * (no_of_regions) + 3 * UFSM_STATE_WORDS(no_of_states))
+
+/* 'data' of a machine that keeps its runtime state in the definition:
+ *   [0, W)          One bit per state, set while the state can't exit
+ *   [W, 2W)         One bit per state, set while the state is active
+ *   [2W, 3W)        One bit per state that has been current or history
+ *                   since the last reset
+ *   [3W, 4W)        The active bits at the start of a dispatch
+ *
+ * Generated machines come with it, others take it from 'storage' when they
+ * are initialized.
+ */
+#define UFSM_MACHINE_DATA_SIZE(no_of_states) \
+        (4 * UFSM_STATE_WORDS(no_of_states))
+
+/* Scratch of one step: the stacks, the event being dispatched and the
+ * results of pure guards. Every machine has one, 'context', and instances
+ * that are processed on several threads at once need one per thread, see
+ * ufsm_context_init(). Steps are recorded to 'trace' if it is set.
+ */
+struct ufsm_context
+{
+    struct ufsm_machine *m;
+    struct ufsm_instance *instance;
+    struct ufsm_trace *trace;
+    struct ufsm_stack stack;
+    struct ufsm_stack stack2;
+    struct ufsm_stack completion_stack;
+    struct ufsm_event *event;
+    bool event_deferred;
+    ufsm_guard_func_t guard_cache[UFSM_GUARD_CACHE_SIZE];
+    bool guard_cache_result[UFSM_GUARD_CACHE_SIZE];
+    uint32_t no_of_cached_guards;
+    struct ufsm_transition *guards_passed;
+};
+
+/* Stack entries of a context for a machine with the stacks of a
+ * 'struct ufsm_storage', generated machines note their own size as
+ * '<Machine>_CONTEXT_DATA_SIZE'.
+ */
+#define UFSM_CONTEXT_DATA_SIZE \
+        (2 * UFSM_STACK_SIZE + UFSM_COMPLETION_STACK_SIZE)
+
+/* Storage of the default sizes for a machine that is written by hand or
+ * built at runtime. ufsm_init_machine() takes the stacks, queues and
+ * bitsets that the machine doesn't already have from 'storage'.
+ */
+struct ufsm_storage
+{
+    void *stack_data[UFSM_STACK_SIZE];
+    void *stack_data2[UFSM_STACK_SIZE];
+    void *completion_stack_data[UFSM_COMPLETION_STACK_SIZE];
+    struct ufsm_event queue_data[UFSM_QUEUE_SIZE];
+    struct ufsm_event defer_queue_data[UFSM_DEFER_QUEUE_SIZE];
+    uint32_t data[UFSM_MACHINE_DATA_SIZE(UFSM_MAX_STATES)];
 };
 
 struct ufsm_machine
@@ -147,22 +408,166 @@ struct ufsm_machine
     ufsm_debug_exit_state_t debug_exit_state;
     ufsm_debug_reset_t debug_reset;
     ufsm_debug_entry_exit_t debug_entry_exit;
+    ufsm_debug_guard_cached_t debug_guard_cached;
     bool terminated;
-    void *stack_data[UFSM_STACK_SIZE];
-    void *stack_data2[UFSM_STACK_SIZE];
-    void *completion_stack_data[UFSM_COMPLETION_STACK_SIZE];
-    uint32_t queue_data[UFSM_QUEUE_SIZE];
-    uint32_t defer_queue_data[UFSM_DEFER_QUEUE_SIZE];
+    bool stop;
+    uint32_t sched_state;
+    struct ufsm_storage *storage;
+    uint32_t *data;
     struct ufsm_queue queue;
     struct ufsm_queue defer_queue;
     struct ufsm_state *parent_state;
-    struct ufsm_stack stack;
-    struct ufsm_stack stack2;
-    struct ufsm_stack completion_stack;
+    struct ufsm_context context;
     struct ufsm_region *region;
+    uint32_t no_of_regions;
+    uint32_t no_of_states;
+    struct ufsm_state * const *states;
+    bool flat;
+    bool read_only;
+    uint32_t no_of_events;
+    uint32_t no_of_transitions;
+    struct ufsm_metrics *metrics;
+    struct ufsm_timer_wheel *wheel;
+    struct ufsm_timer *timers;
+    uint32_t no_of_timers;
     struct ufsm_machine *next;
 };
 
+enum ufsm_trace_op
+{
+    UFSM_TRACE_EVENT,
+    UFSM_TRACE_TRANSITION,
+    UFSM_TRACE_ENTER_REGION,
+    UFSM_TRACE_LEAVE_REGION,
+    UFSM_TRACE_GUARD,
+    UFSM_TRACE_GUARD_CACHED,
+    UFSM_TRACE_ACTION,
+    UFSM_TRACE_ENTER_STATE,
+    UFSM_TRACE_EXIT_STATE,
+    UFSM_TRACE_RESET,
+    UFSM_TRACE_ENTRY_EXIT,
+};
+
+/* One traced debug callback. 'ref' is the address of the transition,
+ * state, region, guard, action, entry/exit or machine, resolved through
+ * the symbols of a dump. 'ev' is the event being processed and 'result'
+ * the result of a guard.
+ */
+struct ufsm_trace_record
+{
+    uint64_t time;
+    uint64_t ref;
+    uint32_t ev;
+    uint16_t op;
+    uint16_t result;
+};
+
+/* Ring of the latest 'no_of_records' records, a power of two, written by
+ * the steps of the contexts it is set on, one at a time. 'head' is free
+ * running. 'clock', if set, timestamps the records.
+ */
+struct ufsm_trace
+{
+    struct ufsm_trace_record *records;
+    uint32_t no_of_records;
+    uint32_t head;
+    uint32_t ev;
+    ufsm_trace_clock_t clock;
+};
+
+/* Words of one metrics shard, rounded up to whole cache lines:
+ *   [0, T+1)                Times each transition was taken
+ *   [T+1, T+S+2)            Time spent in each state
+ *   [T+S+2, T+2S+3)         Times each state was left
+ *   then (E+1) * UFSM_METRICS_BUCKETS latency buckets per event id, the
+ *   last row for ids from E and up, and the number of events processed
+ *   and not processed.
+ *
+ * where T, S and E are the number of transitions, states and events of the
+ * machine. Index zero of transitions and states is unused.
+ */
+#define UFSM_METRICS_LINE(words) \
+        ((((words) + 7) / 8) * 8)
+
+#define UFSM_METRICS_SHARD_SIZE(no_of_transitions, no_of_states, \
+                                no_of_events) \
+        UFSM_METRICS_LINE((no_of_transitions) + 2 * (no_of_states) + 5 + \
+                          ((no_of_events) + 1) * UFSM_METRICS_BUCKETS)
+
+/* The entry time of each state, index zero unused */
+#define UFSM_METRICS_ENTERED_SIZE(no_of_states) ((no_of_states) + 1)
+
+/* The entry times of the machine's own states followed by 'no_of_shards'
+ * shards
+ */
+#define UFSM_METRICS_DATA_SIZE(no_of_shards, no_of_transitions, \
+                               no_of_states, no_of_events) \
+        (UFSM_METRICS_LINE(UFSM_METRICS_ENTERED_SIZE(no_of_states)) + \
+         (no_of_shards) * \
+         UFSM_METRICS_SHARD_SIZE(no_of_transitions, no_of_states, \
+                                 no_of_events))
+
+/* Runtime metrics of a machine, see ufsm_metrics.c. Each thread that
+ * processes events writes its own shard, selected with
+ * ufsm_metrics_thread(). 'clock', if set, times state dwell and event
+ * latency.
+ */
+struct ufsm_metrics
+{
+    uint64_t *data;
+    uint32_t no_of_shards;
+    uint32_t shard_size;
+    uint32_t no_of_transitions;
+    uint32_t no_of_states;
+    uint32_t no_of_events;
+    ufsm_metrics_clock_t clock;
+};
+
+/* The sum of all shards. The arrays point into the buffer given to
+ * ufsm_metrics_snapshot() and are indexed like the shards.
+ */
+struct ufsm_metrics_snapshot
+{
+    uint64_t *transitions;
+    uint64_t *dwell;
+    uint64_t *visits;
+    uint64_t *latency;
+    uint64_t events;
+    uint64_t not_processed;
+    uint64_t queue_full;
+    uint64_t defer_queue_full;
+};
+
+/* A run queue of machines with pending events. Any thread may push and
+ * pop, so idle workers can steal from the queues of busy ones. A slot is
+ * free for position 'pos' when seq == pos and holds a machine when
+ * seq == pos + 1.
+ */
+struct ufsm_sched_worker
+{
+    struct ufsm_machine **data;
+    uint32_t *seq;
+    uint32_t no_of_elements;
+    uint8_t head_pad[UFSM_CACHE_LINE_SIZE];
+    uint32_t head;
+    uint8_t tail_pad[UFSM_CACHE_LINE_SIZE];
+    uint32_t tail;
+    uint8_t end_pad[UFSM_CACHE_LINE_SIZE];
+};
+
+/* Runs machines on a fixed set of worker threads, see ufsm_sched.c. Idle
+ * workers sleep on 'wake_seq' while 'sleepers' is non zero.
+ */
+struct ufsm_sched
+{
+    struct ufsm_sched_worker *workers;
+    uint32_t no_of_workers;
+    uint32_t next;
+    uint32_t wake_seq;
+    uint32_t sleepers;
+    bool stop;
+};
+
 struct ufsm_action
 {
     const char *id;
@@ -171,11 +576,15 @@ struct ufsm_action
     struct ufsm_action *next;
 };
 
+/* A guard is 'pure' when its result can't change during a step. Results of
+ * pure guards are remembered until the step is completed.
+ */
 struct ufsm_guard
 {
     const char *id;
     const char *name;
     ufsm_guard_func_t f;
+    bool pure;
     struct ufsm_guard *next;
 };
 
@@ -203,6 +612,31 @@ struct ufsm_trigger
     struct ufsm_trigger *next;
 };
 
+/* Dispatch index entry. 'transition' is a NULL terminated list of the
+ * transitions, in region order, that have 'ev' as a trigger and the owning
+ * state as source. Entries are sorted on 'ev'.
+ */
+struct ufsm_dispatch
+{
+    uint32_t ev;
+    struct ufsm_transition **transition;
+};
+
+/* 'trigger' is a list of the events that fire the transition. When every
+ * trigger id is below UFSM_TRIGGER_MASK_BITS, 'trigger_mask' has one bit
+ * set per trigger and is matched with a single test. Otherwise
+ * 'trigger_ids' can hold the 'no_of_triggers' ids sorted ascending, which
+ * are binary searched. The list is only walked when neither is set.
+ *
+ * 'lca' is the least common ancestor region of the source and destination
+ * of a transition between regions. When it is set, 'exit_path' lists the
+ * regions whose parent state is left, innermost first, and 'enter_path' the
+ * regions whose parent state is entered, outermost first. Both lists are
+ * NULL terminated. Transitions without 'lca' have the paths computed at
+ * runtime.
+ *
+ * 'index' numbers the transitions of a machine from one, like the states.
+ */
 struct ufsm_transition
 {
     const char *id;
@@ -210,10 +644,17 @@ struct ufsm_transition
     bool defer;
     enum ufsm_transition_kind kind;
     struct ufsm_trigger *trigger;
+    uint32_t trigger_mask;
+    const uint32_t *trigger_ids;
+    uint32_t no_of_triggers;
     struct ufsm_action *action;
     struct ufsm_guard *guard;
     struct ufsm_state *source;
     struct ufsm_state *dest;
+    struct ufsm_region *lca;
+    struct ufsm_region **exit_path;
+    struct ufsm_region **enter_path;
+    uint32_t index;
     struct ufsm_transition *next;
 };
 
@@ -227,14 +668,29 @@ struct ufsm_region
     struct ufsm_state *state;
     struct ufsm_transition *transition;
     struct ufsm_state *parent_state;
+    uint32_t index;
     struct ufsm_region *next;
 };
 
+/* 'flat_dispatch' is set by ufsmimport on machines without orthogonal
+ * regions, which have 'flat' set. It is indexed like 'dispatch' but also
+ * lists the transitions of every ancestor, innermost first, so an event is
+ * dispatched with a single lookup on the active leaf state.
+ *
+ * 'interest' is a bitmap over the machine's 'no_of_events' event ids with
+ * the events that trigger or are deferred by a transition from the state
+ * or one of its ancestors. NULL means no such event.
+ *
+ * 'defer_mask' has one bit per event id below UFSM_TRIGGER_MASK_BITS that
+ * a transition from the state defers.
+ *
+ * 'time_events' lists the after() and at() triggers of the transitions
+ * leaving the state, armed on entry and canceled on exit.
+ */
 struct ufsm_state
 {
     const char *id;
     const char *name;
-    bool cant_exit;
     enum ufsm_state_kind kind;
     struct ufsm_entry_exit *entry;
     struct ufsm_doact *doact;
@@ -242,12 +698,79 @@ struct ufsm_state
     struct ufsm_region *region;
     struct ufsm_region *parent_region;
     struct ufsm_machine *submachine;
+    struct ufsm_dispatch *dispatch;
+    uint32_t no_of_dispatch;
+    struct ufsm_dispatch *flat_dispatch;
+    uint32_t no_of_flat_dispatch;
+    const uint32_t *interest;
+    uint32_t defer_mask;
+    struct ufsm_time_event *time_events;
+    struct ufsm_transition *completion;
+    uint32_t index;
     struct ufsm_state *next;
 };
 
 ufsm_status_t ufsm_init_machine(struct ufsm_machine *m);
 ufsm_status_t ufsm_reset_machine(struct ufsm_machine *m);
 ufsm_status_t ufsm_process (struct ufsm_machine *m, int32_t ev);
+ufsm_status_t ufsm_process_event(struct ufsm_machine *m,
+                                 struct ufsm_event *e);
+ufsm_status_t ufsm_process_batch(struct ufsm_machine *m,
+                                 struct ufsm_event *events,
+                                 uint32_t n,
+                                 ufsm_status_t *status,
+                                 uint32_t *processed);
+const struct ufsm_event * ufsm_get_event(struct ufsm_machine *m);
+const struct ufsm_event * ufsm_get_context_event(struct ufsm_context *c);
+const void * ufsm_event_data(const struct ufsm_event *e);
+ufsm_status_t ufsm_instance_init(struct ufsm_instance *i,
+                                 struct ufsm_machine *m,
+                                 uint32_t no_of_elements,
+                                 uint32_t *data);
+ufsm_status_t ufsm_context_init(struct ufsm_context *c,
+                                struct ufsm_machine *m,
+                                uint32_t no_of_elements,
+                                void **data);
+ufsm_status_t ufsm_init_machine_instance(struct ufsm_machine *m,
+                                         struct ufsm_instance *i);
+ufsm_status_t ufsm_reset_machine_instance(struct ufsm_machine *m,
+                                          struct ufsm_instance *i);
+ufsm_status_t ufsm_process_instance(struct ufsm_machine *m,
+                                    struct ufsm_instance *i,
+                                    int32_t ev);
+ufsm_status_t ufsm_process_event_instance(struct ufsm_machine *m,
+                                          struct ufsm_instance *i,
+                                          struct ufsm_event *e);
+ufsm_status_t ufsm_process_batch_instance(struct ufsm_machine *m,
+                                          struct ufsm_instance *i,
+                                          struct ufsm_event *events,
+                                          uint32_t n,
+                                          ufsm_status_t *status,
+                                          uint32_t *processed);
+ufsm_status_t ufsm_snapshot(struct ufsm_machine *m,
+                            uint8_t *buf,
+                            uint32_t len,
+                            uint32_t *used);
+ufsm_status_t ufsm_restore(struct ufsm_machine *m,
+                           const uint8_t *buf,
+                           uint32_t len);
+ufsm_status_t ufsm_snapshot_instance(struct ufsm_machine *m,
+                                     struct ufsm_instance *i,
+                                     uint8_t *buf,
+                                     uint32_t len,
+                                     uint32_t *used);
+ufsm_status_t ufsm_restore_instance(struct ufsm_machine *m,
+                                    struct ufsm_instance *i,
+                                    const uint8_t *buf,
+                                    uint32_t len);
+bool ufsm_is_active(struct ufsm_machine *m, struct ufsm_state *s);
+bool ufsm_event_of_interest(struct ufsm_machine *m, int32_t ev);
+bool ufsm_event_of_interest_instance(struct ufsm_machine *m,
+                                     struct ufsm_instance *i,
+                                     int32_t ev);
+bool ufsm_is_active_instance(struct ufsm_machine *m,
+                             struct ufsm_instance *i,
+                             struct ufsm_state *s);
 ufsm_status_t ufsm_stack_init(struct ufsm_stack *stack,
                               uint32_t no_of_elements,
                               void **stack_data);
@@ -257,7 +780,98 @@ ufsm_status_t ufsm_queue_init(struct ufsm_queue *q, uint32_t no_of_elements,
                               uint32_t *data);
 ufsm_status_t ufsm_queue_put(struct ufsm_queue *q, uint32_t ev);
 ufsm_status_t ufsm_queue_get(struct ufsm_queue *q, uint32_t *ev);
+ufsm_status_t ufsm_queue_put_lane(struct ufsm_queue *q, uint32_t ev,
+                                  uint32_t lane);
+ufsm_status_t ufsm_queue_init_events(struct ufsm_queue *q,
+                                     uint32_t no_of_elements,
+                                     struct ufsm_event *data);
+ufsm_status_t ufsm_queue_put_event(struct ufsm_queue *q,
+                                   const struct ufsm_event *e);
+ufsm_status_t ufsm_queue_get_event(struct ufsm_queue *q,
+                                   struct ufsm_event *e);
+ufsm_status_t ufsm_queue_peek_event(struct ufsm_queue *q,
+                                    uint32_t n,
+                                    struct ufsm_event *e);
+ufsm_status_t ufsm_queue_get_batch(struct ufsm_queue *q,
+                                   struct ufsm_event *e,
+                                   uint32_t no_of_elements,
+                                   uint32_t *count);
+ufsm_status_t ufsm_queue_init_spsc(struct ufsm_queue *q,
+                                   uint32_t no_of_elements,
+                                   struct ufsm_event *data);
+ufsm_status_t ufsm_queue_init_mpsc(struct ufsm_queue *q,
+                                   uint32_t no_of_elements,
+                                   struct ufsm_event *data,
+                                   uint32_t *seq);
+ufsm_status_t ufsm_queue_init_lanes(struct ufsm_queue *q,
+                                    uint32_t no_of_lanes,
+                                    struct ufsm_queue *lanes);
 struct ufsm_queue * ufsm_get_queue(struct ufsm_machine *m);
 void ufsm_debug_machine(struct ufsm_machine *m);
+ufsm_status_t ufsm_run(struct ufsm_machine *m);
+ufsm_status_t ufsm_run_until(struct ufsm_machine *m, uint64_t deadline);
+void ufsm_stop(struct ufsm_machine *m);
+uint64_t ufsm_run_time(void);
+ufsm_status_t ufsm_sched_init(struct ufsm_sched *s,
+                              struct ufsm_sched_worker *workers,
+                              uint32_t no_of_workers,
+                              uint32_t no_of_elements,
+                              struct ufsm_machine **data,
+                              uint32_t *seq);
+ufsm_status_t ufsm_sched_run(struct ufsm_sched *s, uint32_t worker);
+ufsm_status_t ufsm_sched_post(struct ufsm_sched *s,
+                              struct ufsm_machine *m,
+                              int32_t ev);
+ufsm_status_t ufsm_sched_post_event(struct ufsm_sched *s,
+                                    struct ufsm_machine *m,
+                                    const struct ufsm_event *e);
+void ufsm_sched_stop(struct ufsm_sched *s);
+ufsm_status_t ufsm_trace_init(struct ufsm_trace *t,
+                             uint32_t no_of_records,
+                             struct ufsm_trace_record *records,
+                             ufsm_trace_clock_t clock);
+void ufsm_trace_machine(struct ufsm_machine *m, struct ufsm_trace *t);
+void ufsm_trace_context(struct ufsm_context *c, struct ufsm_trace *t);
+ufsm_status_t ufsm_trace_dump(struct ufsm_trace *t,
+                              struct ufsm_machine *m,
+                              uint8_t *buf,
+                              uint32_t len,
+                              uint32_t *used);
+ufsm_status_t ufsm_trace_decode(const uint8_t *buf,
+                                uint32_t len,
+                                bool timestamps,
+                                ufsm_trace_print_t print,
+                                void *ctx);
+ufsm_status_t ufsm_metrics_init(struct ufsm_metrics *mx,
+                                struct ufsm_machine *m,
+                                uint32_t no_of_shards,
+                                uint64_t *data,
+                                ufsm_metrics_clock_t clock);
+void ufsm_metrics_thread(uint32_t shard);
+ufsm_status_t ufsm_metrics_snapshot(struct ufsm_machine *m,
+                                    uint64_t *data,
+                                    struct ufsm_metrics_snapshot *s);
+void ufsm_metrics_transition(struct ufsm_metrics *mx,
+                             struct ufsm_transition *t);
+void ufsm_metrics_enter_state(struct ufsm_metrics *mx,
+                              struct ufsm_instance *i,
+                              struct ufsm_state *s);
+void ufsm_metrics_exit_state(struct ufsm_metrics *mx,
+                             struct ufsm_instance *i,
+                             struct ufsm_state *s);
+uint64_t ufsm_metrics_start(struct ufsm_metrics *mx);
+void ufsm_metrics_event(struct ufsm_metrics *mx,
+                        uint32_t ev,
+                        uint64_t start,
+                        ufsm_status_t err);
+void ufsm_timer_init(struct ufsm_timer_wheel *w);
+void ufsm_timer_arm(struct ufsm_timer_wheel *w,
+                    struct ufsm_timer *t,
+                    uint64_t ticks);
+void ufsm_timer_arm_at(struct ufsm_timer_wheel *w,
+                       struct ufsm_timer *t,
+                       uint64_t expires);
+void ufsm_timer_cancel(struct ufsm_timer_wheel *w, struct ufsm_timer *t);
+ufsm_status_t ufsm_timer_tick(struct ufsm_timer_wheel *w, uint64_t ticks);
 
 #endif
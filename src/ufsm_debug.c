@@ -94,6 +94,11 @@ static void debug_guard(struct ufsm_guard *g, bool result)
     printf ("    | Guard      | %s() = %i\n", g->name, result);
 }
 
+static void debug_guard_cached(struct ufsm_guard *g, bool result)
+{
+    printf ("    | Guard      | %s() = %i (cached)\n", g->name, result);
+}
+
 static void debug_enter_state(struct ufsm_state *s)
 {
     printf ("    | S enter    | %s {%s}\n", s->name,get_state_type(s));
@@ -124,6 +129,7 @@ void ufsm_debug_machine(struct ufsm_machine *m)
     m->debug_event = &debug_event;
     m->debug_action = &debug_action;
     m->debug_guard = &debug_guard;
+    m->debug_guard_cached = &debug_guard_cached;
     m->debug_enter_state = &debug_enter_state;
     m->debug_exit_state = &debug_exit_state;
     m->debug_reset = &debug_reset;
@@ -0,0 +1,246 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* Runtime metrics. A machine with 'metrics' set counts the transitions it
+ * takes, how long it stays in each state and how long each event takes to
+ * process, see UFSM_METRICS_SHARD_SIZE for the layout. Every thread writes
+ * to its own shard, so recording takes no lock and no atomic operation.
+ * ufsm_metrics_snapshot() adds up the shards for an exporter, it may run
+ * on any thread while events are being processed.
+ *
+ * The entry times that dwell is measured from belong to whoever holds the
+ * active states: the machine's own are in 'data' ahead of the shards and
+ * an instance brings its own in 'entered'. Both are only written by the
+ * one thread processing that machine or instance at a time. An instance
+ * without 'entered' records nothing, so the counters never mix instances
+ * that are timed with ones that are not.
+ */
+
+#include <string.h>
+#include <ufsm.h>
+
+#ifdef __GNUC__
+    #define UFSM_THREAD_LOCAL __thread
+    #define ufsm_load_relaxed(p) __atomic_load_n(p, __ATOMIC_RELAXED)
+#else
+    #define UFSM_THREAD_LOCAL
+    #define ufsm_load_relaxed(p) (*(p))
+#endif
+
+static UFSM_THREAD_LOCAL uint32_t ufsm_metrics_self = 0;
+
+/* The state entry times of 'i', or of the machine itself */
+static uint64_t * ufsm_metrics_entered(struct ufsm_metrics *mx,
+                                       struct ufsm_instance *i)
+{
+    return i ? i->entered : mx->data;
+}
+
+static uint64_t * ufsm_metrics_shard(struct ufsm_metrics *mx, uint32_t n)
+{
+    return &mx->data[UFSM_METRICS_LINE(
+                        UFSM_METRICS_ENTERED_SIZE(mx->no_of_states)) +
+                     n * mx->shard_size];
+}
+
+static uint64_t * ufsm_metrics_own_shard(struct ufsm_metrics *mx)
+{
+    if (ufsm_metrics_self >= mx->no_of_shards)
+        return NULL;
+
+    return ufsm_metrics_shard(mx, ufsm_metrics_self);
+}
+
+/* Points 's' into a shard laid out as 'data' */
+static void ufsm_metrics_layout(struct ufsm_metrics *mx,
+                                uint64_t *data,
+                                struct ufsm_metrics_snapshot *s)
+{
+    s->transitions = data;
+    s->dwell = &s->transitions[mx->no_of_transitions + 1];
+    s->visits = &s->dwell[mx->no_of_states + 1];
+    s->latency = &s->visits[mx->no_of_states + 1];
+}
+
+static uint32_t ufsm_metrics_bucket(uint64_t t)
+{
+    uint32_t b = 0;
+
+#ifdef __GNUC__
+    if (t)
+        b = 64 - __builtin_clzll(t);
+#else
+    for (; t; t >>= 1)
+        b++;
+#endif
+
+    return (b < UFSM_METRICS_BUCKETS) ? b : (UFSM_METRICS_BUCKETS - 1);
+}
+
+static uint64_t ufsm_metrics_queue_full(struct ufsm_queue *q)
+{
+    uint64_t full = ufsm_load_relaxed(&q->no_of_full);
+
+    if (q->kind == UFSM_QUEUE_LANES)
+    {
+        for (uint32_t l = 0; l < q->no_of_lanes; l++)
+            full += ufsm_load_relaxed(&q->lanes[l].no_of_full);
+    }
+
+    return full;
+}
+
+/* Attaches 'mx' to 'm'. 'data' holds UFSM_METRICS_DATA_SIZE() words for
+ * the number of transitions, states and events of 'm', which is numbered
+ * when it's generated and by ufsm_init_machine() when it's hand written.
+ * A clock should not return zero, which marks a state as not entered.
+ * */
+ufsm_status_t ufsm_metrics_init(struct ufsm_metrics *mx,
+                                struct ufsm_machine *m,
+                                uint32_t no_of_shards,
+                                uint64_t *data,
+                                ufsm_metrics_clock_t clock)
+{
+    if (!data || !no_of_shards || !m->no_of_states)
+        return UFSM_ERROR;
+
+    mx->data = data;
+    mx->no_of_shards = no_of_shards;
+    mx->no_of_transitions = m->no_of_transitions;
+    mx->no_of_states = m->no_of_states;
+    mx->no_of_events = m->no_of_events;
+    mx->shard_size = UFSM_METRICS_SHARD_SIZE(mx->no_of_transitions,
+                                             mx->no_of_states,
+                                             mx->no_of_events);
+    mx->clock = clock;
+
+    memset(data, 0, sizeof(uint64_t) *
+                    UFSM_METRICS_DATA_SIZE(no_of_shards,
+                                           mx->no_of_transitions,
+                                           mx->no_of_states,
+                                           mx->no_of_events));
+
+    m->metrics = mx;
+
+    return UFSM_OK;
+}
+
+/* Selects the shard written by the calling thread. Threads that process
+ * events at the same time must use different shards, shards from
+ * 'no_of_shards' and up record nothing.
+ * */
+void ufsm_metrics_thread(uint32_t shard)
+{
+    ufsm_metrics_self = shard;
+}
+
+void ufsm_metrics_transition(struct ufsm_metrics *mx,
+                             struct ufsm_transition *t)
+{
+    uint64_t *shard = ufsm_metrics_own_shard(mx);
+
+    if (shard && t->index && (t->index <= mx->no_of_transitions))
+        shard[t->index]++;
+}
+
+void ufsm_metrics_enter_state(struct ufsm_metrics *mx,
+                              struct ufsm_instance *i,
+                              struct ufsm_state *s)
+{
+    if (mx->clock && (s->index <= mx->no_of_states))
+        ufsm_metrics_entered(mx, i)[s->index] = mx->clock();
+}
+
+void ufsm_metrics_exit_state(struct ufsm_metrics *mx,
+                             struct ufsm_instance *i,
+                             struct ufsm_state *s)
+{
+    uint64_t *entered = ufsm_metrics_entered(mx, i);
+    uint64_t *shard = ufsm_metrics_own_shard(mx);
+    struct ufsm_metrics_snapshot l;
+
+    if (!shard || !mx->clock || !s->index ||
+        (s->index > mx->no_of_states) || !entered[s->index])
+        return;
+
+    ufsm_metrics_layout(mx, shard, &l);
+    l.dwell[s->index] += mx->clock() - entered[s->index];
+    l.visits[s->index]++;
+    entered[s->index] = 0;
+}
+
+uint64_t ufsm_metrics_start(struct ufsm_metrics *mx)
+{
+    return mx->clock ? mx->clock() : 0;
+}
+
+void ufsm_metrics_event(struct ufsm_metrics *mx,
+                        uint32_t ev,
+                        uint64_t start,
+                        ufsm_status_t err)
+{
+    uint64_t *shard = ufsm_metrics_own_shard(mx);
+    uint64_t *counters = NULL;
+    struct ufsm_metrics_snapshot l;
+
+    if (!shard)
+        return;
+
+    ufsm_metrics_layout(mx, shard, &l);
+    counters = &l.latency[(mx->no_of_events + 1) * UFSM_METRICS_BUCKETS];
+
+    counters[0]++;
+
+    if (err == UFSM_ERROR_EVENT_NOT_PROCESSED)
+        counters[1]++;
+
+    if (!mx->clock)
+        return;
+
+    if (ev >= mx->no_of_events)
+        ev = mx->no_of_events;
+
+    l.latency[ev * UFSM_METRICS_BUCKETS +
+              ufsm_metrics_bucket(mx->clock() - start)]++;
+}
+
+/* Adds up the shards of the metrics attached to 'm' into 'data', which
+ * holds one UFSM_METRICS_SHARD_SIZE(). The counters of a thread that is
+ * processing an event may be one event behind.
+ * */
+ufsm_status_t ufsm_metrics_snapshot(struct ufsm_machine *m,
+                                    uint64_t *data,
+                                    struct ufsm_metrics_snapshot *s)
+{
+    struct ufsm_metrics *mx = m->metrics;
+    uint64_t *counters = NULL;
+
+    if (!mx || !data)
+        return UFSM_ERROR;
+
+    memset(data, 0, sizeof(uint64_t) * mx->shard_size);
+
+    for (uint32_t n = 0; n < mx->no_of_shards; n++)
+    {
+        uint64_t *shard = ufsm_metrics_shard(mx, n);
+
+        for (uint32_t w = 0; w < mx->shard_size; w++)
+            data[w] += ufsm_load_relaxed(&shard[w]);
+    }
+
+    ufsm_metrics_layout(mx, data, s);
+    counters = &s->latency[(mx->no_of_events + 1) * UFSM_METRICS_BUCKETS];
+
+    s->events = counters[0];
+    s->not_processed = counters[1];
+    s->queue_full = ufsm_metrics_queue_full(&m->queue);
+    s->defer_queue_full = ufsm_metrics_queue_full(&m->defer_queue);
+
+    return UFSM_OK;
+}
@@ -9,7 +9,144 @@
 
 #include <ufsm.h>
 
-uint32_t ufsm_queue_put(struct ufsm_queue *q, uint32_t ev)
+/* The lock-free queues rely on the GCC/Clang atomic builtins. Without them
+ * only locked queues can be initialized.
+ */
+#ifdef __GNUC__
+    #define UFSM_ATOMICS 1
+    #define ufsm_load_acquire(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+    #define ufsm_load_relaxed(p) __atomic_load_n(p, __ATOMIC_RELAXED)
+    #define ufsm_store_release(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+    #define ufsm_add_relaxed(p, v) __atomic_add_fetch(p, v, __ATOMIC_RELAXED)
+    #define ufsm_cas(p, expected, v) __atomic_compare_exchange_n(p, expected, \
+                            v, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#else
+    #define UFSM_ATOMICS 0
+    #define ufsm_load_acquire(p) (*(p))
+    #define ufsm_load_relaxed(p) (*(p))
+    #define ufsm_store_release(p, v) (*(p) = (v))
+    #define ufsm_add_relaxed(p, v) (*(p) += (v))
+    #define ufsm_cas(p, expected, v) (*(p) = (v), true)
+#endif
+
+static void ufsm_queue_store(struct ufsm_queue *q,
+                             const struct ufsm_event *e)
+{
+    if (q->events)
+        q->events[q->head] = *e;
+    else
+        q->data[q->head] = e->id;
+}
+
+static void ufsm_queue_load(struct ufsm_queue *q, struct ufsm_event *e)
+{
+    if (q->events)
+        *e = q->events[q->tail];
+    else
+        *e = (struct ufsm_event) { .id = q->data[q->tail] };
+}
+
+/* Single producer: 'head' is only written by the producer and 'tail' only
+ * by the consumer. Both run freely and are masked on access, which is why
+ * the size must be a power of two.
+ */
+static uint32_t ufsm_queue_put_spsc(struct ufsm_queue *q,
+                                    const struct ufsm_event *e)
+{
+    uint32_t head = ufsm_load_relaxed(&q->head);
+    uint32_t tail = ufsm_load_acquire(&q->tail);
+
+    if ((head - tail) >= q->no_of_elements)
+        return UFSM_ERROR_QUEUE_FULL;
+
+    q->events[head & (q->no_of_elements - 1)] = *e;
+    ufsm_store_release(&q->head, head + 1);
+
+    return UFSM_OK;
+}
+
+static uint32_t ufsm_queue_get_spsc(struct ufsm_queue *q,
+                                    struct ufsm_event *e,
+                                    uint32_t no_of_elements,
+                                    uint32_t *count)
+{
+    uint32_t tail = ufsm_load_relaxed(&q->tail);
+    uint32_t head = ufsm_load_acquire(&q->head);
+    uint32_t n = 0;
+
+    while ((n < no_of_elements) && (tail + n != head)) {
+        e[n] = q->events[(tail + n) & (q->no_of_elements - 1)];
+        n++;
+    }
+
+    if (n)
+        ufsm_store_release(&q->tail, tail + n);
+
+    *count = n;
+
+    return n ? UFSM_OK : UFSM_ERROR_QUEUE_EMPTY;
+}
+
+/* Multiple producers: a producer claims a slot by advancing 'head' and
+ * publishes it through the slot's sequence number. A slot is free for
+ * position 'pos' when seq == pos and holds an event when seq == pos + 1.
+ */
+static uint32_t ufsm_queue_put_mpsc(struct ufsm_queue *q,
+                                    const struct ufsm_event *e)
+{
+    uint32_t mask = q->no_of_elements - 1;
+    uint32_t pos = ufsm_load_relaxed(&q->head);
+
+    while (true) {
+        uint32_t seq = ufsm_load_acquire(&q->seq[pos & mask]);
+        int32_t diff = (int32_t) (seq - pos);
+
+        if (diff == 0) {
+            if (ufsm_cas(&q->head, &pos, pos + 1))
+                break;
+        } else if (diff < 0) {
+            return UFSM_ERROR_QUEUE_FULL;
+        } else {
+            pos = ufsm_load_relaxed(&q->head);
+        }
+    }
+
+    q->events[pos & mask] = *e;
+    ufsm_store_release(&q->seq[pos & mask], pos + 1);
+
+    return UFSM_OK;
+}
+
+static uint32_t ufsm_queue_get_mpsc(struct ufsm_queue *q,
+                                    struct ufsm_event *e,
+                                    uint32_t no_of_elements,
+                                    uint32_t *count)
+{
+    uint32_t mask = q->no_of_elements - 1;
+    uint32_t tail = ufsm_load_relaxed(&q->tail);
+    uint32_t n = 0;
+
+    while (n < no_of_elements) {
+        uint32_t pos = tail + n;
+
+        if (ufsm_load_acquire(&q->seq[pos & mask]) != pos + 1)
+            break;
+
+        e[n] = q->events[pos & mask];
+        ufsm_store_release(&q->seq[pos & mask], pos + q->no_of_elements);
+        n++;
+    }
+
+    if (n)
+        ufsm_store_release(&q->tail, tail + n);
+
+    *count = n;
+
+    return n ? UFSM_OK : UFSM_ERROR_QUEUE_EMPTY;
+}
+
+static uint32_t ufsm_queue_put_locked(struct ufsm_queue *q,
+                                      const struct ufsm_event *e)
 {
     uint32_t err = UFSM_OK;
 
@@ -17,7 +154,7 @@ uint32_t ufsm_queue_put(struct ufsm_queue *q, uint32_t ev)
         q->lock();
 
     if (q->s < q->no_of_elements) {
-        q->data[q->head] = ev;
+        ufsm_queue_store(q, e);
         q->s++;
         q->head++;
 
@@ -37,39 +174,318 @@ uint32_t ufsm_queue_put(struct ufsm_queue *q, uint32_t ev)
     return err;
 }
 
-uint32_t ufsm_queue_get(struct ufsm_queue *q, uint32_t *ev)
+static uint32_t ufsm_queue_get_locked(struct ufsm_queue *q,
+                                      struct ufsm_event *e,
+                                      uint32_t no_of_elements,
+                                      uint32_t *count)
 {
-    uint32_t err = UFSM_OK;
+    uint32_t n = 0;
 
     if (q->lock)
         q->lock();
 
-    if (q->s) {
-        *ev = q->data[q->tail];
+    while (q->s && (n < no_of_elements)) {
+        ufsm_queue_load(q, &e[n++]);
         q->s--;
         q->tail++;
 
         if (q->tail >= q->no_of_elements)
             q->tail = 0;
-
-    } else {
-        err = UFSM_ERROR_QUEUE_EMPTY;
     }
 
     if (q->unlock)
         q->unlock();
 
+    *count = n;
+
+    return n ? UFSM_OK : UFSM_ERROR_QUEUE_EMPTY;
+}
+
+/* Fills 'e' from the highest lane down, so the events of a higher lane are
+ * always returned before those of a lower one. Each event carries the lane
+ * it came from, also when the lane only stores ids.
+ */
+static uint32_t ufsm_queue_get_lanes(struct ufsm_queue *q,
+                                     struct ufsm_event *e,
+                                     uint32_t no_of_elements,
+                                     uint32_t *count)
+{
+    uint32_t n = 0;
+
+    for (uint32_t l = q->no_of_lanes; l-- && (n < no_of_elements);) {
+        uint32_t lane_count = 0;
+
+        if (ufsm_queue_get_batch(&q->lanes[l], &e[n], no_of_elements - n,
+                                    &lane_count) != UFSM_OK)
+            continue;
+
+        for (uint32_t i = 0; i < lane_count; i++)
+            e[n + i].lane = l;
+
+        n += lane_count;
+    }
+
+    *count = n;
+
+    return n ? UFSM_OK : UFSM_ERROR_QUEUE_EMPTY;
+}
+
+static uint32_t ufsm_queue_peek_lanes(struct ufsm_queue *q, uint32_t n,
+                                      struct ufsm_event *e)
+{
+    for (uint32_t l = q->no_of_lanes; l--;) {
+        uint32_t lane_count = 0;
+
+        if (ufsm_queue_peek_event(&q->lanes[l], n, e) == UFSM_OK) {
+            e->lane = l;
+            return UFSM_OK;
+        }
+
+        while (ufsm_queue_peek_event(&q->lanes[l], lane_count, e) ==
+                                                            UFSM_OK)
+            lane_count++;
+
+        n -= lane_count;
+    }
+
+    return UFSM_ERROR_QUEUE_EMPTY;
+}
+
+uint32_t ufsm_queue_put_event(struct ufsm_queue *q,
+                              const struct ufsm_event *e)
+{
+    uint32_t err = UFSM_OK;
+
+    /* A queue of plain ids can't carry a payload */
+    if (!q->events && !q->lanes && (e->size || e->ptr || e->release))
+        return UFSM_ERROR;
+
+    switch (q->kind) {
+        case UFSM_QUEUE_SPSC:
+            err = ufsm_queue_put_spsc(q, e);
+        break;
+        case UFSM_QUEUE_MPSC:
+            err = ufsm_queue_put_mpsc(q, e);
+        break;
+        case UFSM_QUEUE_LANES:
+            if (e->lane < q->no_of_lanes)
+                err = ufsm_queue_put_event(&q->lanes[e->lane], e);
+            else
+                err = UFSM_ERROR;
+        break;
+        default:
+            err = ufsm_queue_put_locked(q, e);
+        break;
+    }
+
+    /* Counted for the metrics, a lane counts its own */
+    if (err == UFSM_ERROR_QUEUE_FULL && q->kind != UFSM_QUEUE_LANES)
+        ufsm_add_relaxed(&q->no_of_full, 1);
+
+    if (err != UFSM_OK)
+        return err;
+
+    if (q->kind != UFSM_QUEUE_LOCKED && q->on_data)
+        q->on_data();
+
+    /* Called outside of the lock, see ufsm_run() */
+    if (q->wake)
+        q->wake(q);
+
+    return err;
+}
+
+/* Moves up to 'no_of_elements' events to 'e' in one go, 'count' is set to
+ * the number of events returned.
+ */
+uint32_t ufsm_queue_get_batch(struct ufsm_queue *q,
+                              struct ufsm_event *e,
+                              uint32_t no_of_elements,
+                              uint32_t *count)
+{
+    switch (q->kind) {
+        case UFSM_QUEUE_SPSC:
+            return ufsm_queue_get_spsc(q, e, no_of_elements, count);
+        case UFSM_QUEUE_MPSC:
+            return ufsm_queue_get_mpsc(q, e, no_of_elements, count);
+        case UFSM_QUEUE_LANES:
+            return ufsm_queue_get_lanes(q, e, no_of_elements, count);
+        default:
+            return ufsm_queue_get_locked(q, e, no_of_elements, count);
+    }
+}
+
+/* Copies event number 'n', counted from the oldest, without removing it.
+ * Must not race with the consumer.
+ */
+uint32_t ufsm_queue_peek_event(struct ufsm_queue *q, uint32_t n,
+                               struct ufsm_event *e)
+{
+    uint32_t err = UFSM_OK;
+    uint32_t tail = ufsm_load_relaxed(&q->tail);
+    uint32_t mask = q->no_of_elements - 1;
+
+    switch (q->kind) {
+        case UFSM_QUEUE_SPSC:
+            if ((ufsm_load_acquire(&q->head) - tail) <= n)
+                return UFSM_ERROR_QUEUE_EMPTY;
+
+            *e = q->events[(tail + n) & mask];
+        break;
+        case UFSM_QUEUE_MPSC:
+            if (ufsm_load_acquire(&q->seq[(tail + n) & mask]) != tail + n + 1)
+                return UFSM_ERROR_QUEUE_EMPTY;
+
+            *e = q->events[(tail + n) & mask];
+        break;
+        case UFSM_QUEUE_LANES:
+            err = ufsm_queue_peek_lanes(q, n, e);
+        break;
+        default:
+            if (q->lock)
+                q->lock();
+
+            if (n < q->s) {
+                uint32_t saved_tail = q->tail;
+
+                q->tail = (q->tail + n) % q->no_of_elements;
+                ufsm_queue_load(q, e);
+                q->tail = saved_tail;
+            } else {
+                err = UFSM_ERROR_QUEUE_EMPTY;
+            }
+
+            if (q->unlock)
+                q->unlock();
+        break;
+    }
+
+    return err;
+}
+
+uint32_t ufsm_queue_get_event(struct ufsm_queue *q, struct ufsm_event *e)
+{
+    uint32_t count;
+
+    return ufsm_queue_get_batch(q, e, 1, &count);
+}
+
+uint32_t ufsm_queue_put(struct ufsm_queue *q, uint32_t ev)
+{
+    struct ufsm_event e =
+    {
+        .id = ev,
+    };
+
+    return ufsm_queue_put_event(q, &e);
+}
+
+uint32_t ufsm_queue_put_lane(struct ufsm_queue *q, uint32_t ev,
+                             uint32_t lane)
+{
+    struct ufsm_event e =
+    {
+        .id = ev,
+        .lane = lane,
+    };
+
+    return ufsm_queue_put_event(q, &e);
+}
+
+/* Only the id is returned, a payload that is still held by the event is
+ * released.
+ */
+uint32_t ufsm_queue_get(struct ufsm_queue *q, uint32_t *ev)
+{
+    struct ufsm_event e;
+    uint32_t err = ufsm_queue_get_event(q, &e);
+
+    if (err == UFSM_OK) {
+        *ev = e.id;
+
+        if (e.release)
+            e.release(&e);
+    }
+
     return err;
 }
 
 uint32_t ufsm_queue_init(struct ufsm_queue *q, uint32_t no_of_elements,
                                                uint32_t *data)
 {
+    q->kind = UFSM_QUEUE_LOCKED;
     q->head = 0;
     q->tail = 0;
     q->data = data;
+    q->events = NULL;
+    q->seq = NULL;
+    q->lanes = NULL;
+    q->no_of_lanes = 0;
+    q->no_of_full = 0;
     q->s = 0;
     q->no_of_elements = no_of_elements;
 
     return UFSM_OK;
 }
+
+uint32_t ufsm_queue_init_events(struct ufsm_queue *q,
+                                uint32_t no_of_elements,
+                                struct ufsm_event *data)
+{
+    uint32_t err = ufsm_queue_init(q, no_of_elements, NULL);
+
+    q->events = data;
+
+    return err;
+}
+
+uint32_t ufsm_queue_init_spsc(struct ufsm_queue *q,
+                              uint32_t no_of_elements,
+                              struct ufsm_event *data)
+{
+    if (!UFSM_ATOMICS || !no_of_elements ||
+        (no_of_elements & (no_of_elements - 1)))
+        return UFSM_ERROR;
+
+    ufsm_queue_init_events(q, no_of_elements, data);
+    q->kind = UFSM_QUEUE_SPSC;
+
+    return UFSM_OK;
+}
+
+uint32_t ufsm_queue_init_mpsc(struct ufsm_queue *q,
+                              uint32_t no_of_elements,
+                              struct ufsm_event *data,
+                              uint32_t *seq)
+{
+    if (!UFSM_ATOMICS || !no_of_elements ||
+        (no_of_elements & (no_of_elements - 1)))
+        return UFSM_ERROR;
+
+    ufsm_queue_init_events(q, no_of_elements, data);
+    q->kind = UFSM_QUEUE_MPSC;
+    q->seq = seq;
+
+    for (uint32_t i = 0; i < no_of_elements; i++)
+        seq[i] = i;
+
+    return UFSM_OK;
+}
+
+/* 'lanes' must be initialized queues. They are consumed through 'q' and
+ * any thread safety is that of the individual lanes.
+ */
+uint32_t ufsm_queue_init_lanes(struct ufsm_queue *q,
+                               uint32_t no_of_lanes,
+                               struct ufsm_queue *lanes)
+{
+    if (!no_of_lanes || !lanes)
+        return UFSM_ERROR;
+
+    ufsm_queue_init(q, 0, NULL);
+    q->kind = UFSM_QUEUE_LANES;
+    q->lanes = lanes;
+    q->no_of_lanes = no_of_lanes;
+
+    return UFSM_OK;
+}
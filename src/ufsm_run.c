@@ -0,0 +1,185 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* Blocking run-to-completion driver for Linux. The consumer sleeps on a
+ * futex in the machine's event queue and is woken by ufsm_queue_put.
+ */
+
+#define _GNU_SOURCE
+
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <ufsm.h>
+
+#define UFSM_NSEC_PER_SEC 1000000000ULL
+
+static void ufsm_run_signal(struct ufsm_queue *q)
+{
+    __atomic_add_fetch(&q->wake_seq, 1, __ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(&q->waiters, __ATOMIC_SEQ_CST))
+        syscall(SYS_futex, &q->wake_seq, FUTEX_WAKE_PRIVATE, 1,
+                                            NULL, NULL, 0);
+}
+
+/* Installed as the queue's wake hook while running, chains to the hook
+ * that was set before.
+ */
+static void ufsm_run_wake(struct ufsm_queue *q)
+{
+    ufsm_queue_wake_t next = __atomic_load_n(&q->next_wake,
+                                             __ATOMIC_ACQUIRE);
+
+    ufsm_run_signal(q);
+
+    if (next)
+        next(q);
+}
+
+/* Sleeps until the queue is woken or 'deadline' passes. 'seq' is the
+ * value of 'wake_seq' read before the queue was found to be empty, so a put
+ * that happens in between makes the wait return immediately.
+ */
+static void ufsm_run_wait(struct ufsm_queue *q, uint32_t seq,
+                                                uint64_t deadline)
+{
+    struct timespec ts =
+    {
+        .tv_sec = deadline / UFSM_NSEC_PER_SEC,
+        .tv_nsec = deadline % UFSM_NSEC_PER_SEC,
+    };
+
+    syscall(SYS_futex, &q->wake_seq, FUTEX_WAIT_BITSET_PRIVATE, seq,
+                            deadline ? &ts : NULL, NULL,
+                            FUTEX_BITSET_MATCH_ANY);
+}
+
+static void ufsm_run_release(struct ufsm_event *events, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+        if (events[i].release)
+            events[i].release(&events[i]);
+}
+
+/* Monotonic time in nanoseconds, for computing deadlines */
+uint64_t ufsm_run_time(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t) ts.tv_sec * UFSM_NSEC_PER_SEC + ts.tv_nsec;
+}
+
+static ufsm_status_t ufsm_run_loop(struct ufsm_machine *m,
+                                   struct ufsm_queue *q,
+                                   uint64_t deadline)
+{
+    ufsm_status_t err = UFSM_OK;
+    struct ufsm_event events[UFSM_QUEUE_SIZE];
+    uint32_t count = 0;
+    uint32_t processed = 0;
+    uint32_t seq = 0;
+
+    while (true)
+    {
+        if (__atomic_exchange_n(&m->stop, false, __ATOMIC_SEQ_CST))
+            return UFSM_OK;
+
+        if (m->terminated)
+            return UFSM_ERROR_MACHINE_TERMINATED;
+
+        seq = __atomic_load_n(&q->wake_seq, __ATOMIC_SEQ_CST);
+
+        /* A do-activity completed between steps */
+        if (m->context.completion_stack.pos)
+            ufsm_process_batch(m, NULL, 0, NULL, &processed);
+
+        err = ufsm_queue_get_batch(q, events, UFSM_QUEUE_SIZE, &count);
+
+        if (err == UFSM_OK)
+        {
+            err = ufsm_process_batch(m, events, count, NULL, &processed);
+
+            /* Nobody else will see the events after termination */
+            if (err == UFSM_ERROR_MACHINE_TERMINATED)
+                ufsm_run_release(&events[processed], count - processed);
+
+            continue;
+        }
+
+        if (deadline && ufsm_run_time() >= deadline)
+            return UFSM_OK;
+
+        __atomic_store_n(&q->waiters, 1, __ATOMIC_SEQ_CST);
+
+        /* Check again now that producers will wake us */
+        if ((__atomic_load_n(&q->wake_seq, __ATOMIC_SEQ_CST) == seq) &&
+            !__atomic_load_n(&m->stop, __ATOMIC_SEQ_CST))
+        {
+            ufsm_run_wait(q, seq, deadline);
+        }
+
+        __atomic_store_n(&q->waiters, 0, __ATOMIC_SEQ_CST);
+    }
+}
+
+/* Processes events from the machine's queue until ufsm_stop() is called,
+ * the machine terminates or the monotonic clock reaches 'deadline'. A
+ * deadline of zero means no deadline. The whole queue is drained on every
+ * wakeup and the calling thread sleeps while the queue is empty. A wake
+ * hook that is already set on the queue keeps being called and is put
+ * back on return.
+ */
+ufsm_status_t ufsm_run_until(struct ufsm_machine *m, uint64_t deadline)
+{
+    ufsm_status_t err = UFSM_OK;
+    struct ufsm_queue *q = ufsm_get_queue(m);
+    ufsm_queue_wake_t wake = NULL;
+
+    if (!q)
+        return UFSM_ERROR;
+
+    wake = __atomic_load_n(&q->wake, __ATOMIC_ACQUIRE);
+
+    /* Already running, for example from an action */
+    if (wake == &ufsm_run_wake)
+        return UFSM_ERROR;
+
+    __atomic_store_n(&q->next_wake, wake, __ATOMIC_RELEASE);
+    __atomic_store_n(&q->wake, &ufsm_run_wake, __ATOMIC_RELEASE);
+
+    err = ufsm_run_loop(m, q, deadline);
+
+    __atomic_store_n(&q->wake, wake, __ATOMIC_RELEASE);
+    __atomic_store_n(&q->next_wake, NULL, __ATOMIC_RELEASE);
+
+    return err;
+}
+
+ufsm_status_t ufsm_run(struct ufsm_machine *m)
+{
+    return ufsm_run_until(m, 0);
+}
+
+/* Makes ufsm_run() return once the current step is completed. Can be
+ * called from any thread, or from an action. A stop request made while the
+ * machine is not running makes the next ufsm_run() return immediately.
+ */
+void ufsm_stop(struct ufsm_machine *m)
+{
+    struct ufsm_queue *q = ufsm_get_queue(m);
+
+    __atomic_store_n(&m->stop, true, __ATOMIC_SEQ_CST);
+
+    if (q)
+        ufsm_run_signal(q);
+}
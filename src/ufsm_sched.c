@@ -0,0 +1,311 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* Work-stealing scheduler for Linux. Machines with pending events are kept
+ * in per-worker run queues. A worker runs one batch of events for a machine
+ * at a time and steals from the other queues when its own is empty.
+ *
+ * A machine is in at most one run queue and is processed by at most one
+ * worker at a time, tracked by 'sched_state':
+ *
+ *   IDLE       No pending events, or not known to the scheduler
+ *   SCHEDULED  In a run queue
+ *   RUNNING    Being processed by a worker
+ *   PENDING    Being processed, and events were posted meanwhile
+ */
+
+#define _GNU_SOURCE
+
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <ufsm.h>
+
+enum ufsm_sched_states
+{
+    UFSM_SCHED_IDLE,
+    UFSM_SCHED_SCHEDULED,
+    UFSM_SCHED_RUNNING,
+    UFSM_SCHED_PENDING,
+};
+
+#define ufsm_load(p) __atomic_load_n(p, __ATOMIC_SEQ_CST)
+#define ufsm_store(p, v) __atomic_store_n(p, v, __ATOMIC_SEQ_CST)
+#define ufsm_cas(p, expected, v) __atomic_compare_exchange_n(p, expected, \
+                            v, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+
+/* Worker of the calling thread, used to post to the local run queue */
+static __thread struct ufsm_sched *ufsm_sched_self = NULL;
+static __thread uint32_t ufsm_sched_self_worker = 0;
+
+static bool ufsm_sched_push(struct ufsm_sched_worker *w,
+                            struct ufsm_machine *m)
+{
+    uint32_t mask = w->no_of_elements - 1;
+    uint32_t pos = ufsm_load(&w->head);
+
+    while (true) {
+        uint32_t seq = ufsm_load(&w->seq[pos & mask]);
+        int32_t diff = (int32_t) (seq - pos);
+
+        if (diff == 0) {
+            if (ufsm_cas(&w->head, &pos, pos + 1))
+                break;
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = ufsm_load(&w->head);
+        }
+    }
+
+    w->data[pos & mask] = m;
+    ufsm_store(&w->seq[pos & mask], pos + 1);
+
+    return true;
+}
+
+static struct ufsm_machine * ufsm_sched_pop(struct ufsm_sched_worker *w)
+{
+    uint32_t mask = w->no_of_elements - 1;
+    uint32_t pos = ufsm_load(&w->tail);
+    struct ufsm_machine *m = NULL;
+
+    while (true) {
+        uint32_t seq = ufsm_load(&w->seq[pos & mask]);
+        int32_t diff = (int32_t) (seq - (pos + 1));
+
+        if (diff == 0) {
+            if (ufsm_cas(&w->tail, &pos, pos + 1))
+                break;
+        } else if (diff < 0) {
+            return NULL;
+        } else {
+            pos = ufsm_load(&w->tail);
+        }
+    }
+
+    m = w->data[pos & mask];
+    ufsm_store(&w->seq[pos & mask], pos + w->no_of_elements);
+
+    return m;
+}
+
+static void ufsm_sched_wake(struct ufsm_sched *s, int no_of_workers)
+{
+    __atomic_add_fetch(&s->wake_seq, 1, __ATOMIC_SEQ_CST);
+
+    if (ufsm_load(&s->sleepers))
+        syscall(SYS_futex, &s->wake_seq, FUTEX_WAKE_PRIVATE, no_of_workers,
+                                                        NULL, NULL, 0);
+}
+
+/* Puts a machine in state SCHEDULED on a run queue, preferably the one of
+ * the calling worker. The run queues together must be able to hold every
+ * machine, so a free slot is always found.
+ */
+static void ufsm_sched_enqueue(struct ufsm_sched *s, struct ufsm_machine *m)
+{
+    uint32_t w = 0;
+
+    if (ufsm_sched_self == s)
+        w = ufsm_sched_self_worker;
+    else
+        w = __atomic_fetch_add(&s->next, 1, __ATOMIC_RELAXED);
+
+    for (uint32_t i = 0; ; i++)
+    {
+        if (ufsm_sched_push(&s->workers[(w + i) % s->no_of_workers], m))
+            break;
+    }
+
+    ufsm_sched_wake(s, 1);
+}
+
+static struct ufsm_machine * ufsm_sched_find(struct ufsm_sched *s,
+                                             uint32_t worker)
+{
+    struct ufsm_machine *m = NULL;
+
+    for (uint32_t i = 0; (i < s->no_of_workers) && !m; i++)
+        m = ufsm_sched_pop(&s->workers[(worker + i) % s->no_of_workers]);
+
+    return m;
+}
+
+/* Processes at most one queue worth of events, then gives other machines
+ * a turn.
+ */
+static void ufsm_sched_process(struct ufsm_sched *s, struct ufsm_machine *m)
+{
+    struct ufsm_queue *q = ufsm_get_queue(m);
+    struct ufsm_event events[UFSM_QUEUE_SIZE];
+    uint32_t count = 0;
+    uint32_t processed = 0;
+    uint32_t state = UFSM_SCHED_RUNNING;
+    ufsm_status_t err = UFSM_OK;
+
+    ufsm_store(&m->sched_state, UFSM_SCHED_RUNNING);
+
+    err = ufsm_queue_get_batch(q, events, UFSM_QUEUE_SIZE, &count);
+
+    if (err == UFSM_OK)
+    {
+        err = ufsm_process_batch(m, events, count, NULL, &processed);
+
+        /* Nobody else will see the events after termination */
+        for (uint32_t i = processed; i < count; i++)
+            if (events[i].release)
+                events[i].release(&events[i]);
+    }
+
+    if ((count < UFSM_QUEUE_SIZE) &&
+        ufsm_cas(&m->sched_state, &state, UFSM_SCHED_IDLE))
+        return;
+
+    ufsm_store(&m->sched_state, UFSM_SCHED_SCHEDULED);
+    ufsm_sched_enqueue(s, m);
+}
+
+/* 'data' and 'seq' hold 'no_of_elements' entries for each worker. The
+ * number of elements must be a power of two and the run queues together
+ * must have room for every machine that is posted to.
+ */
+ufsm_status_t ufsm_sched_init(struct ufsm_sched *s,
+                              struct ufsm_sched_worker *workers,
+                              uint32_t no_of_workers,
+                              uint32_t no_of_elements,
+                              struct ufsm_machine **data,
+                              uint32_t *seq)
+{
+    if (!no_of_workers || !no_of_elements ||
+        (no_of_elements & (no_of_elements - 1)))
+        return UFSM_ERROR;
+
+    s->workers = workers;
+    s->no_of_workers = no_of_workers;
+    s->next = 0;
+    s->wake_seq = 0;
+    s->sleepers = 0;
+    s->stop = false;
+
+    for (uint32_t i = 0; i < no_of_workers; i++)
+    {
+        struct ufsm_sched_worker *w = &workers[i];
+
+        w->data = &data[i * no_of_elements];
+        w->seq = &seq[i * no_of_elements];
+        w->no_of_elements = no_of_elements;
+        w->head = 0;
+        w->tail = 0;
+
+        for (uint32_t n = 0; n < no_of_elements; n++)
+            w->seq[n] = n;
+    }
+
+    return UFSM_OK;
+}
+
+/* Worker loop, called from one thread per worker, typically pinned to its
+ * own core. Returns when ufsm_sched_stop() is called.
+ */
+ufsm_status_t ufsm_sched_run(struct ufsm_sched *s, uint32_t worker)
+{
+    struct ufsm_machine *m = NULL;
+    uint32_t seq = 0;
+
+    if (worker >= s->no_of_workers)
+        return UFSM_ERROR;
+
+    ufsm_sched_self = s;
+    ufsm_sched_self_worker = worker;
+
+    while (!ufsm_load(&s->stop))
+    {
+        m = ufsm_sched_find(s, worker);
+
+        if (m)
+        {
+            ufsm_sched_process(s, m);
+            continue;
+        }
+
+        seq = ufsm_load(&s->wake_seq);
+        __atomic_add_fetch(&s->sleepers, 1, __ATOMIC_SEQ_CST);
+
+        /* Check again now that posters will wake us */
+        m = ufsm_sched_find(s, worker);
+
+        if (!m && !ufsm_load(&s->stop))
+            syscall(SYS_futex, &s->wake_seq, FUTEX_WAIT_PRIVATE, seq,
+                                                    NULL, NULL, 0);
+
+        __atomic_sub_fetch(&s->sleepers, 1, __ATOMIC_SEQ_CST);
+
+        if (m)
+            ufsm_sched_process(s, m);
+    }
+
+    ufsm_sched_self = NULL;
+
+    return UFSM_OK;
+}
+
+/* Posts an event to 'm' from any thread. The machine's queue must be safe
+ * for several producers, for example an MPSC queue.
+ */
+ufsm_status_t ufsm_sched_post_event(struct ufsm_sched *s,
+                                    struct ufsm_machine *m,
+                                    const struct ufsm_event *e)
+{
+    ufsm_status_t err = ufsm_queue_put_event(ufsm_get_queue(m), e);
+    uint32_t state = ufsm_load(&m->sched_state);
+
+    if (err != UFSM_OK)
+        return err;
+
+    while (true)
+    {
+        switch (state)
+        {
+            case UFSM_SCHED_IDLE:
+                if (ufsm_cas(&m->sched_state, &state, UFSM_SCHED_SCHEDULED))
+                {
+                    ufsm_sched_enqueue(s, m);
+                    return UFSM_OK;
+                }
+            break;
+            case UFSM_SCHED_RUNNING:
+                if (ufsm_cas(&m->sched_state, &state, UFSM_SCHED_PENDING))
+                    return UFSM_OK;
+            break;
+            default:
+                return UFSM_OK;
+        }
+    }
+}
+
+ufsm_status_t ufsm_sched_post(struct ufsm_sched *s,
+                              struct ufsm_machine *m,
+                              int32_t ev)
+{
+    struct ufsm_event e =
+    {
+        .id = (uint32_t) ev,
+    };
+
+    return ufsm_sched_post_event(s, m, &e);
+}
+
+/* Makes every worker return from ufsm_sched_run() */
+void ufsm_sched_stop(struct ufsm_sched *s)
+{
+    ufsm_store(&s->stop, true);
+    ufsm_sched_wake(s, INT_MAX);
+}
@@ -0,0 +1,247 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* Hierarchical timing wheel for time events. 'now' counts the ticks so
+ * far and a timer expires on the tick that brings 'now' to 'expires'.
+ * Timers are kept in doubly linked slot lists, so arming and canceling are
+ * O(1). Level 0 has one slot per tick. A timer further away sits on a
+ * higher level and is moved down, cascaded, when the wheel reaches its
+ * slot. Each timer is cascaded at most once per level.
+ *
+ * Expired timers are taken out of the wheel under the lock and their events
+ * are posted after it is released, UFSM_TIMER_BATCH at a time. While its
+ * event is posted a timer is unlinked with 'prev' pointing at itself.
+ * Arming or canceling it clears that, so a failed post is only retried
+ * for timers that were left alone in the meantime.
+ */
+
+#include <ufsm.h>
+
+#define UFSM_TIMER_MASK (UFSM_TIMER_SLOTS - 1)
+#define UFSM_TIMER_RANGE (1ULL << (UFSM_TIMER_LEVELS * UFSM_TIMER_SLOT_BITS))
+
+struct ufsm_timer_post
+{
+    struct ufsm_timer *t;
+    struct ufsm_queue *queue;
+    uint32_t ev;
+};
+
+static void ufsm_timer_lock(struct ufsm_timer_wheel *w)
+{
+    if (w->lock)
+        w->lock();
+}
+
+static void ufsm_timer_unlock(struct ufsm_timer_wheel *w)
+{
+    if (w->unlock)
+        w->unlock();
+}
+
+static void ufsm_timer_list_init(struct ufsm_timer *head)
+{
+    head->next = head;
+    head->prev = head;
+}
+
+static void ufsm_timer_unlink(struct ufsm_timer *t)
+{
+    t->prev->next = t->next;
+    t->next->prev = t->prev;
+    t->next = NULL;
+    t->prev = NULL;
+}
+
+static void ufsm_timer_insert(struct ufsm_timer_wheel *w,
+                              struct ufsm_timer *t)
+{
+    uint64_t delta = (t->expires > w->now) ? (t->expires - w->now) : 0;
+    uint64_t expires = w->now + delta;
+    uint32_t level = 0;
+    struct ufsm_timer *head = NULL;
+
+    /* Timers beyond the range wait in the last level and are put back
+     * when it is cascaded.
+     * */
+    if (delta >= UFSM_TIMER_RANGE)
+        expires = w->now + UFSM_TIMER_RANGE - 1;
+
+    while ((level < UFSM_TIMER_LEVELS - 1) &&
+           (delta >> ((level + 1) * UFSM_TIMER_SLOT_BITS)))
+        level++;
+
+    head = &w->slots[level][(expires >> (level * UFSM_TIMER_SLOT_BITS)) &
+                                                        UFSM_TIMER_MASK];
+
+    t->next = head;
+    t->prev = head->prev;
+    head->prev->next = t;
+    head->prev = t;
+}
+
+/* Moves the timers of one slot to the levels below. Returns the slot index
+ * so the caller knows when the level above has to be cascaded too.
+ * */
+static uint32_t ufsm_timer_cascade(struct ufsm_timer_wheel *w,
+                                   uint32_t level)
+{
+    uint32_t index = (w->now >> (level * UFSM_TIMER_SLOT_BITS)) &
+                                                        UFSM_TIMER_MASK;
+    struct ufsm_timer *head = &w->slots[level][index];
+
+    while (head->next != head)
+    {
+        struct ufsm_timer *t = head->next;
+
+        ufsm_timer_unlink(t);
+        ufsm_timer_insert(w, t);
+    }
+
+    return index;
+}
+
+void ufsm_timer_init(struct ufsm_timer_wheel *w)
+{
+    w->now = 0;
+
+    for (uint32_t level = 0; level < UFSM_TIMER_LEVELS; level++)
+        for (uint32_t n = 0; n < UFSM_TIMER_SLOTS; n++)
+            ufsm_timer_list_init(&w->slots[level][n]);
+}
+
+/* Arms 't' to expire 'ticks' ticks from now, zero meaning on the next
+ * tick. A timer that is already armed is moved.
+ */
+void ufsm_timer_arm(struct ufsm_timer_wheel *w,
+                    struct ufsm_timer *t,
+                    uint64_t ticks)
+{
+    ufsm_timer_lock(w);
+
+    if (t->next)
+        ufsm_timer_unlink(t);
+
+    t->expires = w->now + (ticks ? ticks : 1);
+    ufsm_timer_insert(w, t);
+
+    ufsm_timer_unlock(w);
+}
+
+/* Arms 't' to expire when the wheel reaches 'expires', or on the next tick
+ * if that has passed.
+ */
+void ufsm_timer_arm_at(struct ufsm_timer_wheel *w,
+                       struct ufsm_timer *t,
+                       uint64_t expires)
+{
+    ufsm_timer_lock(w);
+
+    if (t->next)
+        ufsm_timer_unlink(t);
+
+    t->expires = (expires > w->now) ? expires : w->now + 1;
+    ufsm_timer_insert(w, t);
+
+    ufsm_timer_unlock(w);
+}
+
+void ufsm_timer_cancel(struct ufsm_timer_wheel *w, struct ufsm_timer *t)
+{
+    ufsm_timer_lock(w);
+
+    if (t->next)
+        ufsm_timer_unlink(t);
+
+    t->prev = NULL;
+
+    ufsm_timer_unlock(w);
+}
+
+/* Takes up to UFSM_TIMER_BATCH expired timers out of the wheel, advancing
+ * it while 'ticks' are left. Called with the lock held.
+ */
+static uint32_t ufsm_timer_collect(struct ufsm_timer_wheel *w,
+                                   uint64_t *ticks,
+                                   struct ufsm_timer_post *posts)
+{
+    uint32_t n = 0;
+
+    while (n < UFSM_TIMER_BATCH)
+    {
+        uint32_t index = w->now & UFSM_TIMER_MASK;
+        struct ufsm_timer *head = &w->slots[0][index];
+
+        if (head->next != head)
+        {
+            struct ufsm_timer *t = head->next;
+
+            ufsm_timer_unlink(t);
+            t->prev = t;
+            posts[n].t = t;
+            posts[n].queue = t->queue;
+            posts[n].ev = t->ev;
+            n++;
+            continue;
+        }
+
+        if (*ticks == 0)
+            break;
+
+        (*ticks)--;
+        index = ++w->now & UFSM_TIMER_MASK;
+
+        for (uint32_t level = 1; !index && (level < UFSM_TIMER_LEVELS);
+                                                            level++)
+            index = ufsm_timer_cascade(w, level);
+    }
+
+    return n;
+}
+
+/* Advances the wheel by 'ticks' and posts the events of the timers that
+ * expire. A timer whose queue is full is retried on the next tick and
+ * UFSM_ERROR_QUEUE_FULL is returned. The queues are not called with the
+ * lock held.
+ */
+ufsm_status_t ufsm_timer_tick(struct ufsm_timer_wheel *w, uint64_t ticks)
+{
+    ufsm_status_t err = UFSM_OK;
+    struct ufsm_timer_post posts[UFSM_TIMER_BATCH];
+    uint32_t no_of_posts;
+
+    do
+    {
+        ufsm_timer_lock(w);
+        no_of_posts = ufsm_timer_collect(w, &ticks, posts);
+        ufsm_timer_unlock(w);
+
+        for (uint32_t n = 0; n < no_of_posts; n++)
+        {
+            struct ufsm_timer *t = posts[n].t;
+
+            if (ufsm_queue_put(posts[n].queue, posts[n].ev) == UFSM_OK)
+                continue;
+
+            err = UFSM_ERROR_QUEUE_FULL;
+
+            ufsm_timer_lock(w);
+
+            if (t->prev == t)
+            {
+                t->expires = w->now + 1;
+                ufsm_timer_insert(w, t);
+            }
+
+            ufsm_timer_unlock(w);
+        }
+    } while (no_of_posts == UFSM_TIMER_BATCH);
+
+    return err;
+}
@@ -0,0 +1,586 @@
+/**
+ * uFSM
+ *
+ * Copyright (C) 2018 Jonas Persson <jonpe960@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* Binary trace recorder. ufsm.c writes fixed size records, at the points
+ * where it calls the debug callbacks, to the ring set on the context of
+ * the step. Recording takes no lock, no call and does no formatting.
+ * ufsm_trace_dump() copies the ring together with the names of the
+ * machine's objects, and ufsm_trace_decode() turns a dump into the table
+ * printed by ufsm_debug_machine().
+ *
+ * Dump layout, all numbers little endian:
+ *
+ *   "UFSMTRC1"
+ *   u32 no_of_symbols, then per symbol: u64 ref, u32 length, text
+ *   u32 no_of_records, then per record: u64 time, u64 ref, u32 ev,
+ *                                       u16 op, u16 result
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <ufsm.h>
+
+#define UFSM_TRACE_MAGIC "UFSMTRC1"
+#define UFSM_TRACE_TEXT_SIZE 256
+#define UFSM_TRACE_INDEX_BITS 10
+#define UFSM_TRACE_INDEX_SIZE (1 << UFSM_TRACE_INDEX_BITS)
+
+#ifdef __GNUC__
+    #define ufsm_load_acquire(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#else
+    #define ufsm_load_acquire(p) (*(p))
+#endif
+
+struct ufsm_trace_buf
+{
+    uint8_t *out;
+    const uint8_t *in;
+    uint32_t len;
+    uint32_t pos;
+    bool error;
+};
+
+/* Open addressed table from a symbol's ref to its position in a dump plus
+ * one, zero marks a free slot. Symbols that do not fit are looked up by
+ * scanning the dump.
+ */
+struct ufsm_trace_index
+{
+    uint32_t pos[UFSM_TRACE_INDEX_SIZE];
+    uint32_t no_of_entries;
+    bool overflow;
+};
+
+ufsm_status_t ufsm_trace_init(struct ufsm_trace *t,
+                              uint32_t no_of_records,
+                              struct ufsm_trace_record *records,
+                              ufsm_trace_clock_t clock)
+{
+    if (!records || !no_of_records ||
+        (no_of_records & (no_of_records - 1)))
+        return UFSM_ERROR;
+
+    t->records = records;
+    t->no_of_records = no_of_records;
+    t->head = 0;
+    t->ev = 0;
+    t->clock = clock;
+
+    return UFSM_OK;
+}
+
+/* Records the steps of the machine itself to 't', NULL stops recording */
+void ufsm_trace_machine(struct ufsm_machine *m, struct ufsm_trace *t)
+{
+    m->context.trace = t;
+}
+
+/* Records the steps taken on 'c', an instance's context, to 't' */
+void ufsm_trace_context(struct ufsm_context *c, struct ufsm_trace *t)
+{
+    c->trace = t;
+}
+
+/* Keeps counting past the end of the buffer, so the needed size is known */
+static void ufsm_trace_put_bytes(struct ufsm_trace_buf *b, const void *data,
+                                 uint32_t n)
+{
+    if (b->pos + n <= b->len)
+        memcpy(&b->out[b->pos], data, n);
+
+    b->pos += n;
+}
+
+static void ufsm_trace_put_uint(struct ufsm_trace_buf *b, uint64_t v,
+                                uint32_t n)
+{
+    uint8_t bytes[8];
+
+    for (uint32_t i = 0; i < n; i++)
+        bytes[i] = (uint8_t) (v >> (8 * i));
+
+    ufsm_trace_put_bytes(b, bytes, n);
+}
+
+static uint64_t ufsm_trace_get_uint(struct ufsm_trace_buf *b, uint32_t n)
+{
+    uint64_t v = 0;
+
+    if (b->pos + n > b->len)
+    {
+        b->error = true;
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < n; i++)
+        v |= (uint64_t) b->in[b->pos++] << (8 * i);
+
+    return v;
+}
+
+static const char * ufsm_trace_state_type(struct ufsm_state *s)
+{
+    if (s->kind != UFSM_STATE_SIMPLE)
+        return ufsm_state_kinds[s->kind];
+
+    if (s->submachine)
+        return "Submachine State";
+
+    if (s->region)
+        return "Composite State";
+
+    return "Simple State";
+}
+
+static void ufsm_trace_put_symbol(struct ufsm_trace_buf *b,
+                                  uint32_t *no_of_symbols,
+                                  const void *ref,
+                                  const char *text)
+{
+    uint32_t n = (uint32_t) strlen(text);
+
+    ufsm_trace_put_uint(b, (uint64_t) (uintptr_t) ref, 8);
+    ufsm_trace_put_uint(b, n, 4);
+    ufsm_trace_put_bytes(b, text, n);
+    (*no_of_symbols)++;
+}
+
+/* Symbol text is what ufsm_debug.c prints in the details column, apart
+ * from the result of a guard.
+ */
+static void ufsm_trace_put_transition(struct ufsm_trace_buf *b,
+                                      uint32_t *no_of_symbols,
+                                      struct ufsm_transition *t)
+{
+    char text[UFSM_TRACE_TEXT_SIZE];
+    int n = snprintf(text, sizeof(text), "%s {%s} --> %s {%s} T=",
+                                t->source->name,
+                                ufsm_trace_state_type(t->source),
+                                t->dest->name,
+                                ufsm_trace_state_type(t->dest));
+
+    for (struct ufsm_trigger *tt = t->trigger; tt; tt = tt->next)
+    {
+        if (n < (int) sizeof(text))
+            n += snprintf(&text[n], sizeof(text) - n, "%s ", tt->name);
+    }
+
+    if (!t->trigger && (n < (int) sizeof(text)))
+        snprintf(&text[n], sizeof(text) - n, "COMPLETION");
+
+    ufsm_trace_put_symbol(b, no_of_symbols, t, text);
+
+    for (struct ufsm_guard *g = t->guard; g; g = g->next)
+    {
+        snprintf(text, sizeof(text), "%s()", g->name);
+        ufsm_trace_put_symbol(b, no_of_symbols, g, text);
+    }
+
+    for (struct ufsm_action *a = t->action; a; a = a->next)
+    {
+        snprintf(text, sizeof(text), "%s()", a->name);
+        ufsm_trace_put_symbol(b, no_of_symbols, a, text);
+    }
+}
+
+static void ufsm_trace_put_state(struct ufsm_trace_buf *b,
+                                 uint32_t *no_of_symbols,
+                                 struct ufsm_state *s)
+{
+    char text[UFSM_TRACE_TEXT_SIZE];
+
+    snprintf(text, sizeof(text), "%s {%s}", s->name,
+                                    ufsm_trace_state_type(s));
+    ufsm_trace_put_symbol(b, no_of_symbols, s, text);
+
+    for (struct ufsm_entry_exit *e = s->entry; e; e = e->next)
+        ufsm_trace_put_symbol(b, no_of_symbols, e, e->name);
+
+    for (struct ufsm_entry_exit *e = s->exit; e; e = e->next)
+        ufsm_trace_put_symbol(b, no_of_symbols, e, e->name);
+
+    if (s->submachine)
+        ufsm_trace_put_symbol(b, no_of_symbols, s->submachine,
+                                                s->submachine->name);
+}
+
+/* The regions below 's' are walked from the state their 'parent_state'
+ * points back to, which is what the walk climbs out through. A submachine
+ * shared by several states is therefore named once.
+ */
+static struct ufsm_region * ufsm_trace_child_region(struct ufsm_state *s)
+{
+    struct ufsm_region *sr = s->region;
+
+    if (!sr && s->submachine)
+        sr = s->submachine->region;
+
+    return (sr && (sr->parent_state == s)) ? sr : NULL;
+}
+
+static void ufsm_trace_put_region(struct ufsm_trace_buf *b,
+                                  uint32_t *no_of_symbols,
+                                  struct ufsm_region *r)
+{
+    char text[UFSM_TRACE_TEXT_SIZE];
+
+    snprintf(text, sizeof(text), "%s, H=%i", r->name, r->has_history);
+    ufsm_trace_put_symbol(b, no_of_symbols, r, text);
+
+    for (struct ufsm_transition *t = r->transition; t; t = t->next)
+        ufsm_trace_put_transition(b, no_of_symbols, t);
+}
+
+/* Walks every region of 'm' and its submachines depth first through the
+ * parent pointers, so neither the machine's stacks nor recursion is used
+ * and a dump can be taken while the machine is processing.
+ */
+static void ufsm_trace_put_symbols(struct ufsm_trace_buf *b,
+                                   struct ufsm_machine *m,
+                                   uint32_t *no_of_symbols)
+{
+    struct ufsm_region *r = m->region;
+    struct ufsm_state *s = NULL;
+
+    ufsm_trace_put_symbol(b, no_of_symbols, m, m->name);
+
+    if (!r)
+        return;
+
+    ufsm_trace_put_region(b, no_of_symbols, r);
+    s = r->state;
+
+    while (r)
+    {
+        if (s)
+        {
+            struct ufsm_region *sr = ufsm_trace_child_region(s);
+
+            ufsm_trace_put_state(b, no_of_symbols, s);
+
+            if (sr)
+            {
+                r = sr;
+                ufsm_trace_put_region(b, no_of_symbols, r);
+                s = r->state;
+            }
+            else
+            {
+                s = s->next;
+            }
+        }
+        else if (r->next)
+        {
+            r = r->next;
+            ufsm_trace_put_region(b, no_of_symbols, r);
+            s = r->state;
+        }
+        else if (r->parent_state)
+        {
+            /* All regions of the parent are done */
+            s = r->parent_state->next;
+            r = r->parent_state->parent_region;
+        }
+        else
+        {
+            r = NULL;
+        }
+    }
+}
+
+/* Copies the records in 't' and the symbols of 'm' to 'buf'. 'used' is set
+ * to the needed size even if the buffer is too small, in which case
+ * UFSM_ERROR_BUFFER_TOO_SMALL is returned. The ring is read without a lock,
+ * so dump from the thread that owns it or while that thread is idle.
+ */
+ufsm_status_t ufsm_trace_dump(struct ufsm_trace *t,
+                              struct ufsm_machine *m,
+                              uint8_t *buf,
+                              uint32_t len,
+                              uint32_t *used)
+{
+    struct ufsm_trace_buf b =
+    {
+        .out = buf,
+        .len = len,
+    };
+    uint32_t head = ufsm_load_acquire(&t->head);
+    uint32_t first = 0;
+    uint32_t no_of_symbols = 0;
+    uint32_t symbols_pos = 0;
+
+    if (head > t->no_of_records)
+        first = head - t->no_of_records;
+
+    ufsm_trace_put_bytes(&b, UFSM_TRACE_MAGIC, 8);
+    symbols_pos = b.pos;
+    ufsm_trace_put_uint(&b, 0, 4);
+
+    ufsm_trace_put_symbols(&b, m, &no_of_symbols);
+
+    if (symbols_pos + 4 <= len)
+    {
+        uint32_t pos = b.pos;
+
+        b.pos = symbols_pos;
+        ufsm_trace_put_uint(&b, no_of_symbols, 4);
+        b.pos = pos;
+    }
+
+    ufsm_trace_put_uint(&b, head - first, 4);
+
+    for (uint32_t n = first; n != head; n++)
+    {
+        struct ufsm_trace_record *r = &t->records[n & (t->no_of_records - 1)];
+
+        ufsm_trace_put_uint(&b, r->time, 8);
+        ufsm_trace_put_uint(&b, r->ref, 8);
+        ufsm_trace_put_uint(&b, r->ev, 4);
+        ufsm_trace_put_uint(&b, r->op, 2);
+        ufsm_trace_put_uint(&b, r->result, 2);
+    }
+
+    *used = b.pos;
+
+    return (b.pos > len) ? UFSM_ERROR_BUFFER_TOO_SMALL : UFSM_OK;
+}
+
+static void ufsm_trace_copy_text(const uint8_t *src, uint32_t size,
+                                 char *text)
+{
+    if (size >= UFSM_TRACE_TEXT_SIZE)
+        size = UFSM_TRACE_TEXT_SIZE - 1;
+
+    memcpy(text, src, size);
+    text[size] = 0;
+}
+
+static uint32_t ufsm_trace_hash(uint64_t ref)
+{
+    return (uint32_t) (((ref >> 3) * 0x9E3779B97F4A7C15ULL) >>
+                                            (64 - UFSM_TRACE_INDEX_BITS));
+}
+
+/* Reads at a position already checked by ufsm_trace_get_uint() */
+static uint64_t ufsm_trace_uint_at(const uint8_t *buf, uint32_t pos,
+                                   uint32_t n)
+{
+    uint64_t v = 0;
+
+    for (uint32_t i = 0; i < n; i++)
+        v |= (uint64_t) buf[pos + i] << (8 * i);
+
+    return v;
+}
+
+/* Adds the symbol at 'pos' unless the table is full. One slot is always
+ * left free so that a lookup ends. The first of several symbols with the
+ * same ref is found first, as with the scan.
+ */
+static void ufsm_trace_index_add(struct ufsm_trace_index *index,
+                                 uint64_t ref, uint32_t pos)
+{
+    uint32_t slot = ufsm_trace_hash(ref);
+
+    if (index->no_of_entries == UFSM_TRACE_INDEX_SIZE - 1)
+    {
+        index->overflow = true;
+        return;
+    }
+
+    while (index->pos[slot])
+        slot = (slot + 1) & (UFSM_TRACE_INDEX_SIZE - 1);
+
+    index->pos[slot] = pos + 1;
+    index->no_of_entries++;
+}
+
+/* Finds the text of 'ref' by scanning the symbols, "?" when it is unknown */
+static void ufsm_trace_find_symbol(const uint8_t *buf, uint32_t len,
+                                   uint32_t no_of_symbols, uint64_t ref,
+                                   char *text)
+{
+    struct ufsm_trace_buf b =
+    {
+        .in = buf,
+        .len = len,
+        .pos = 12,
+    };
+
+    strcpy(text, "?");
+
+    for (uint32_t n = 0; (n < no_of_symbols) && !b.error; n++)
+    {
+        uint64_t sym = ufsm_trace_get_uint(&b, 8);
+        uint32_t size = (uint32_t) ufsm_trace_get_uint(&b, 4);
+
+        if (b.error || (b.pos + size > len))
+            return;
+
+        if (sym == ref)
+        {
+            ufsm_trace_copy_text(&buf[b.pos], size, text);
+            return;
+        }
+
+        b.pos += size;
+    }
+}
+
+/* Finds the text of 'ref' through the index, "?" when it is unknown */
+static void ufsm_trace_lookup(struct ufsm_trace_index *index,
+                              const uint8_t *buf, uint32_t len,
+                              uint32_t no_of_symbols, uint64_t ref,
+                              char *text)
+{
+    uint32_t slot = ufsm_trace_hash(ref);
+
+    for (; index->pos[slot]; slot = (slot + 1) & (UFSM_TRACE_INDEX_SIZE - 1))
+    {
+        uint32_t pos = index->pos[slot] - 1;
+
+        if (ufsm_trace_uint_at(buf, pos, 8) == ref)
+        {
+            uint32_t size = (uint32_t) ufsm_trace_uint_at(buf, pos + 8, 4);
+
+            ufsm_trace_copy_text(&buf[pos + 12], size, text);
+            return;
+        }
+    }
+
+    if (index->overflow)
+        ufsm_trace_find_symbol(buf, len, no_of_symbols, ref, text);
+    else
+        strcpy(text, "?");
+}
+
+/* Prints a dump as the table of ufsm_debug_machine(), one line per call to
+ * 'print'. With 'timestamps' set every line starts with the time of the
+ * record.
+ */
+ufsm_status_t ufsm_trace_decode(const uint8_t *buf,
+                                uint32_t len,
+                                bool timestamps,
+                                ufsm_trace_print_t print,
+                                void *ctx)
+{
+    struct ufsm_trace_buf b =
+    {
+        .in = buf,
+        .len = len,
+    };
+    char line[2 * UFSM_TRACE_TEXT_SIZE];
+    char text[UFSM_TRACE_TEXT_SIZE];
+    struct ufsm_trace_index index;
+    uint32_t no_of_symbols = 0;
+    uint32_t no_of_records = 0;
+
+    if ((len < 12) || memcmp(buf, UFSM_TRACE_MAGIC, 8))
+        return UFSM_ERROR;
+
+    memset(&index, 0, sizeof(index));
+
+    b.pos = 8;
+    no_of_symbols = (uint32_t) ufsm_trace_get_uint(&b, 4);
+
+    for (uint32_t n = 0; (n < no_of_symbols) && !b.error; n++)
+    {
+        uint32_t pos = b.pos;
+        uint64_t ref = ufsm_trace_get_uint(&b, 8);
+        uint32_t size = (uint32_t) ufsm_trace_get_uint(&b, 4);
+
+        if (b.error || (b.pos + size > len))
+            return UFSM_ERROR;
+
+        ufsm_trace_index_add(&index, ref, pos);
+        b.pos += size;
+    }
+
+    no_of_records = (uint32_t) ufsm_trace_get_uint(&b, 4);
+
+    if (b.error)
+        return UFSM_ERROR;
+
+    print(timestamps ? "             TIME  EV |     OP     | Details" :
+                       " EV |     OP     | Details", ctx);
+
+    for (uint32_t n = 0; n < no_of_records; n++)
+    {
+        uint64_t time = ufsm_trace_get_uint(&b, 8);
+        uint64_t ref = ufsm_trace_get_uint(&b, 8);
+        uint32_t ev = (uint32_t) ufsm_trace_get_uint(&b, 4);
+        uint16_t op = (uint16_t) ufsm_trace_get_uint(&b, 2);
+        uint16_t result = (uint16_t) ufsm_trace_get_uint(&b, 2);
+        int pos = 0;
+
+        if (b.error)
+            return UFSM_ERROR;
+
+        ufsm_trace_lookup(&index, buf, len, no_of_symbols, ref, text);
+
+        if (timestamps)
+            pos = snprintf(line, sizeof(line), "%17llu ",
+                                        (unsigned long long) time);
+
+        switch (op)
+        {
+            case UFSM_TRACE_EVENT:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            " %-3i|            |", (int) ev);
+            break;
+            case UFSM_TRACE_TRANSITION:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            "    | Transition | %s", text);
+            break;
+            case UFSM_TRACE_ENTER_REGION:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            "    | R enter    | %s", text);
+            break;
+            case UFSM_TRACE_LEAVE_REGION:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            "    | R exit     | %s", text);
+            break;
+            case UFSM_TRACE_GUARD:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            "    | Guard      | %s = %i", text, result);
+            break;
+            case UFSM_TRACE_GUARD_CACHED:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            "    | Guard      | %s = %i (cached)", text,
+                                                                result);
+            break;
+            case UFSM_TRACE_ACTION:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            "    | Action     | %s", text);
+            break;
+            case UFSM_TRACE_ENTER_STATE:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            "    | S enter    | %s", text);
+            break;
+            case UFSM_TRACE_EXIT_STATE:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            "    | S exit     | %s", text);
+            break;
+            case UFSM_TRACE_RESET:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            " -- | RESET      | %s", text);
+            break;
+            case UFSM_TRACE_ENTRY_EXIT:
+                snprintf(&line[pos], sizeof(line) - pos,
+                            "    | Call       | %s", text);
+            break;
+            default:
+                return UFSM_ERROR;
+        }
+
+        print(line, ctx);
+    }
+
+    return UFSM_OK;
+}